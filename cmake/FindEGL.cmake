@@ -0,0 +1,26 @@
+# - Find EGL
+# Find the native EGL includes and libraries
+#
+#  EGL_INCLUDE_DIR - where to find EGL/egl.h, etc.
+#  EGL_LIBRARIES   - List of libraries when using EGL.
+#  EGL_FOUND       - True if EGL found.
+
+if(EGL_INCLUDE_DIR)
+    # Already in cache, be silent
+    set(EGL_FIND_QUIETLY TRUE)
+endif(EGL_INCLUDE_DIR)
+
+find_path(EGL_INCLUDE_DIR EGL/egl.h)
+
+find_library(EGL_egl_LIBRARY NAMES EGL)
+
+# Handle the QUIETLY and REQUIRED arguments and set EGL_FOUND
+# to TRUE if all listed variables are TRUE.
+include(FindPackageHandleStandardArgs)
+find_package_handle_standard_args(EGL DEFAULT_MSG
+    EGL_INCLUDE_DIR EGL_egl_LIBRARY)
+
+set(EGL_LIBRARIES ${EGL_egl_LIBRARY})
+
+mark_as_advanced(EGL_INCLUDE_DIR)
+mark_as_advanced(EGL_egl_LIBRARY)
@@ -24,6 +24,9 @@ Russ Taylor <russ@sensics.com>
 
 #pragma once
 
+#include <stddef.h>
+#include <stdint.h>
+
 namespace osvr {
 namespace renderkit {
 
@@ -53,6 +56,50 @@ namespace renderkit {
         /// sure it is current before calling any RenderManager
         /// method.
         bool shareOpenGLContext = false;
+
+        /// Used by the "OpenGLOffscreen" render library, which has no
+        /// windows.  Called on the presenting thread with each finished
+        /// display, with the context that presented it current and the
+        /// display's framebuffer (which only exists in that context)
+        /// bound, so that it can be read back or copied.  The color
+        /// texture is shared with RenderManager's other contexts.
+        typedef void (*DisplayFramebufferCallback)(
+            void* userData //< displayFramebufferUserData
+            ,
+            size_t display //< Which display (0-indexed)
+            ,
+            GLuint framebuffer //< Framebuffer holding the display
+            ,
+            GLuint colorTexture //< Texture attached to the framebuffer
+            ,
+            int width //< Width of the texture
+            ,
+            int height //< Height of the texture
+            );
+        DisplayFramebufferCallback displayFramebufferCallback = nullptr;
+        void* displayFramebufferUserData = nullptr;
+
+        /// Called on the presenting thread with each captured display
+        /// (or eye) once its asynchronous read-back has finished, two or
+        /// more presents after it was captured, when the captureBuffers
+        /// configuration entry is nonzero.  Pixels are RGBA, 8 bits per
+        /// channel, tightly packed with the bottom row first, and are only
+        /// valid during the call.
+        typedef void (*CaptureCallback)(
+            void* userData //< captureUserData
+            ,
+            size_t display //< Which display (0-indexed)
+            ,
+            int eye //< Which eye, or -1 for the whole display
+            ,
+            const uint8_t* pixels //< First byte of the bottom row
+            ,
+            int width //< Width of the capture
+            ,
+            int height //< Height of the capture
+            );
+        CaptureCallback captureCallback = nullptr;
+        void* captureUserData = nullptr;
     };
 
     /// @brief Describes a OpenGL textures to be rendered
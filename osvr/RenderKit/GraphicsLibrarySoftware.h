@@ -0,0 +1,76 @@
+/** @file
+@brief Header file describing the OSVR software (CPU) rendering library
+callback info
+
+@date 2026
+
+@author
+Sensics, Inc.
+<http://sensics.com/osvr>
+*/
+
+// Copyright 2026 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace osvr {
+namespace renderkit {
+
+    /// @brief Describes an image in CPU memory
+    ///
+    /// This is one of the members of the RenderBuffer union
+    /// from RenderManager.h.  It is used both for the buffers that
+    /// an application renders into and for the finished display images
+    /// that the software RenderManager produces.  Pixels are RGBA, 8 bits
+    /// per channel.  As in OpenGL, the first row in memory is the bottom
+    /// row of the image.
+
+    class RenderBufferSoftware {
+      public:
+        uint8_t* data = nullptr; //< First byte of the bottom row
+        size_t width = 0;        //< Pixels per row
+        size_t height = 0;       //< Number of rows
+        size_t stride = 0;       //< Bytes from the start of one row to the next
+    };
+
+    /// @brief Describes the software rendering library being used
+    ///
+    /// This is one of the members of the GraphicsLibrary union
+    /// from RenderManager.h.  There is no window, so finished display
+    /// images are handed to a callback, which can show, stream or
+    /// compare them.  To set the callback, pass a GraphicsLibrary
+    /// whose Software member points to one of these to
+    /// createRenderManager().
+
+    class GraphicsLibrarySoftware {
+      public:
+        /// Called on the presenting thread with each finished display
+        /// image, which is only valid during the call.
+        typedef void (*DisplayImageCallback)(
+            void* userData //< displayImageUserData
+            ,
+            size_t display //< Which display (0-indexed)
+            ,
+            const RenderBufferSoftware& image //< The finished image
+            );
+        DisplayImageCallback displayImageCallback = nullptr;
+        void* displayImageUserData = nullptr;
+    };
+
+} // namespace renderkit
+} // namespace osvr
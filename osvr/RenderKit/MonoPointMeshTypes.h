@@ -33,6 +33,8 @@
 
 // Standard includes
 #include <array>
+#include <cstddef>
+#include <memory>
 #include <vector>
 
 namespace osvr {
@@ -51,6 +53,97 @@ namespace renderkit {
     typedef std::vector< //!< One mapping per eye
         MonoPointDistortionMeshDescription> MonoPointDistortionMeshDescriptions;
 
+    /// Compact store of the points of a mono point-sample distortion mesh,
+    /// with each coordinate of the points in an array of its own, for the
+    /// code that searches the points.  It is filled in once, by whatever
+    /// parses the mesh, and then shared through a
+    /// MonoPointDistortionMeshSamplesPtr rather than copied.  The meshes
+    /// compiled into the library are used where they are, without a copy.
+    class MonoPointDistortionMeshSamples {
+      public:
+        /// Samples to be filled in with add().
+        MonoPointDistortionMeshSamples() { usePoints(); }
+
+        /// Samples that use arrays which outlive them, such as those of the
+        /// compiled-in meshes, in place.  These cannot be added to.
+        MonoPointDistortionMeshSamples(size_t count, const float* fromX,
+                                       const float* fromY, const float* toX,
+                                       const float* toY)
+            : m_size(count), m_fromXData(fromX), m_fromYData(fromY),
+              m_toXData(toX), m_toYData(toY) {}
+
+        /// Samples copied from a description.
+        explicit MonoPointDistortionMeshSamples(
+            MonoPointDistortionMeshDescription const& points) {
+            reserve(points.size());
+            for (auto const& point : points) {
+                add(static_cast<float>(point[0][0]),
+                    static_cast<float>(point[0][1]),
+                    static_cast<float>(point[1][0]),
+                    static_cast<float>(point[1][1]));
+            }
+        }
+
+        void reserve(size_t count) {
+            m_fromX.reserve(count);
+            m_fromY.reserve(count);
+            m_toX.reserve(count);
+            m_toY.reserve(count);
+            usePoints();
+        }
+
+        void add(float fromX, float fromY, float toX, float toY) {
+            m_fromX.push_back(fromX);
+            m_fromY.push_back(fromY);
+            m_toX.push_back(toX);
+            m_toY.push_back(toY);
+            usePoints();
+        }
+
+        /// Give back storage reserved beyond the points added.
+        void shrinkToFit() {
+            m_fromX.shrink_to_fit();
+            m_fromY.shrink_to_fit();
+            m_toX.shrink_to_fit();
+            m_toY.shrink_to_fit();
+            usePoints();
+        }
+
+        size_t size() const { return m_size; }
+        float fromX(size_t i) const { return m_fromXData[i]; }
+        float fromY(size_t i) const { return m_fromYData[i]; }
+        float toX(size_t i) const { return m_toXData[i]; }
+        float toY(size_t i) const { return m_toYData[i]; }
+
+      private:
+        MonoPointDistortionMeshSamples(
+            const MonoPointDistortionMeshSamples&) = delete;
+        MonoPointDistortionMeshSamples&
+        operator=(const MonoPointDistortionMeshSamples&) = delete;
+
+        /// Read the points from our own arrays.
+        void usePoints() {
+            m_size = m_fromX.size();
+            m_fromXData = m_fromX.data();
+            m_fromYData = m_fromY.data();
+            m_toXData = m_toX.data();
+            m_toYData = m_toY.data();
+        }
+
+        std::vector<float> m_fromX, m_fromY; //!< Physical-display location
+        std::vector<float> m_toX, m_toY;     //!< Canonical-display location
+        size_t m_size = 0;
+        const float* m_fromXData = nullptr;
+        const float* m_fromYData = nullptr;
+        const float* m_toXData = nullptr;
+        const float* m_toYData = nullptr;
+    };
+    typedef std::shared_ptr<const MonoPointDistortionMeshSamples>
+        MonoPointDistortionMeshSamplesPtr;
+
+    typedef std::vector< //!< One mesh per eye
+        MonoPointDistortionMeshSamplesPtr> MonoPointDistortionMeshSamplesPerEye;
+
 } // namespace renderkit
 } // namespace osvr
 #endif // INCLUDED_MonoPointMeshTypes_h_GUID_33CEDC76_9C34_4F8A_935B_652409FE6B30
@@ -0,0 +1,398 @@
+/** @file
+@brief Source file implementing a streaming reader for external distortion
+point-sample files.
+
+@date 2026
+
+@author
+Sensics, Inc.
+<http://sensics.com/osvr>
+*/
+
+// Copyright 2026 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Internal Includes
+#include "PointSamplesFileReader.h"
+
+// Library/third-party includes
+// - none
+
+// Standard includes
+#include <chrono>
+#include <cstdlib>
+#include <sstream>
+
+namespace osvr {
+namespace renderkit {
+
+    /// How much of the file to hold at once.
+    static const size_t BUFFER_SIZE = 64 * 1024;
+
+    /// Deeper nesting than this (which no descriptor has) is refused
+    /// rather than risk running out of stack.
+    static const size_t MAX_DEPTH = 64;
+
+    /// Where the samples live in the file.
+    static const char* const SAMPLES_PATH[] = {"display", "hmd",
+                                               "distortion"};
+    static const size_t SAMPLES_LEVEL =
+        sizeof(SAMPLES_PATH) / sizeof(SAMPLES_PATH[0]);
+
+    PointSamplesFileReader::PointSamplesFileReader()
+        : m_next(0), m_end(0), m_line(1), m_bytes(0), m_points(0),
+          m_seconds(0) {}
+
+    void PointSamplesFileReader::addSamples(
+        const std::string& name, MonoPointDistortionMeshSamplesPerEye& mesh) {
+        Samples s;
+        s.name = name;
+        s.mesh = &mesh;
+        m_samples.push_back(s);
+    }
+
+    bool PointSamplesFileReader::read(const std::string& fileName) {
+        auto start = std::chrono::steady_clock::now();
+        m_error.clear();
+        m_bytes = 0;
+        m_points = 0;
+        m_next = m_end = 0;
+        m_line = 1;
+
+        m_file.open(fileName.c_str(), std::ios::in | std::ios::binary);
+        if (!m_file.is_open()) {
+            m_error = "Couldn't open file " + fileName;
+            return false;
+        }
+        m_buffer.resize(BUFFER_SIZE);
+
+        // The file is one object, with nothing but whitespace after it.
+        bool ret = expect('{') && readObject(0, 0);
+        char c;
+        if (ret && peek(c)) {
+            ret = fail("Unexpected text after the end of the file's object");
+        } else if (ret) {
+            m_error.clear();
+        }
+
+        m_file.close();
+        m_buffer.clear();
+        m_buffer.shrink_to_fit();
+        m_seconds = std::chrono::duration<double>(
+                        std::chrono::steady_clock::now() - start)
+                        .count();
+        return ret;
+    }
+
+    bool PointSamplesFileReader::fill() {
+        if (m_next < m_end) {
+            return true;
+        }
+        if (!m_file.good()) {
+            return fail("Unexpected end of file");
+        }
+        m_file.read(m_buffer.data(), m_buffer.size());
+        m_next = 0;
+        m_end = static_cast<size_t>(m_file.gcount());
+        m_bytes += m_end;
+        if (m_end == 0) {
+            return fail("Unexpected end of file");
+        }
+        return true;
+    }
+
+    bool PointSamplesFileReader::peek(char& c) {
+        while (fill()) {
+            c = m_buffer[m_next];
+            if (c == '\n') {
+                m_line++;
+            } else if (c != ' ' && c != '\t' && c != '\r') {
+                return true;
+            }
+            m_next++;
+        }
+        return false;
+    }
+
+    bool PointSamplesFileReader::expect(char c) {
+        char next;
+        if (!peek(next)) {
+            return false;
+        }
+        if (next != c) {
+            return fail(std::string("Expected '") + c + "' but found '" +
+                        next + "'");
+        }
+        m_next++;
+        return true;
+    }
+
+    bool PointSamplesFileReader::readString(std::string& s) {
+        if (!expect('"')) {
+            return false;
+        }
+        s.clear();
+        while (fill()) {
+            char c = m_buffer[m_next++];
+            if (c == '"') {
+                return true;
+            }
+            if (c == '\n') {
+                return fail("Newline in string");
+            }
+            if (c == '\\') {
+                // We only compare keys against plain names, so escapes are
+                // kept as they are rather than decoded.
+                s.push_back(c);
+                if (!fill()) {
+                    break;
+                }
+                c = m_buffer[m_next++];
+            }
+            s.push_back(c);
+        }
+        return false;
+    }
+
+    bool PointSamplesFileReader::readNumber(double& d) {
+        char c;
+        if (!peek(c)) {
+            return false;
+        }
+        // Numbers are short, so gather one up and let strtod() decide
+        // whether it is well formed.
+        char text[64];
+        size_t length = 0;
+        while (fill()) {
+            c = m_buffer[m_next];
+            if (!((c >= '0' && c <= '9') || c == '-' || c == '+' ||
+                  c == '.' || c == 'e' || c == 'E')) {
+                break;
+            }
+            if (length + 1 >= sizeof(text)) {
+                return fail("Number too long");
+            }
+            text[length++] = c;
+            m_next++;
+        }
+        text[length] = '\0';
+        char* end;
+        d = strtod(text, &end);
+        if (length == 0 || end != text + length) {
+            return fail(std::string("Malformed number '") + text + "'");
+        }
+        return true;
+    }
+
+    bool PointSamplesFileReader::readLiteral(const char* literal) {
+        for (size_t i = 0; literal[i] != '\0'; i++) {
+            if (!fill()) {
+                return false;
+            }
+            if (m_buffer[m_next++] != literal[i]) {
+                return fail(std::string("Expected '") + literal + "'");
+            }
+        }
+        return true;
+    }
+
+    bool PointSamplesFileReader::readObject(size_t level, size_t depth) {
+        // The opening brace has been read.  level is how many entries of
+        // SAMPLES_PATH lead here, or past the end of it if this object is
+        // not on that path.
+        char c;
+        if (!peek(c)) {
+            return false;
+        }
+        if (c == '}') {
+            m_next++;
+            return true;
+        }
+        while (true) {
+            if (!readString(m_key) || !expect(':') || !peek(c)) {
+                return false;
+            }
+
+            // Is this a member we want, or on the way to them?
+            bool handled = false;
+            if (level == SAMPLES_LEVEL) {
+                for (auto& s : m_samples) {
+                    if (s.name == m_key) {
+                        if (!readEyes(*s.mesh)) {
+                            return false;
+                        }
+                        handled = true;
+                        break;
+                    }
+                }
+            } else if (level < SAMPLES_LEVEL && c == '{' &&
+                       m_key == SAMPLES_PATH[level]) {
+                m_next++;
+                if (!readObject(level + 1, depth + 1)) {
+                    return false;
+                }
+                handled = true;
+            }
+            if (!handled && !skipValue(depth + 1)) {
+                return false;
+            }
+
+            if (!peek(c)) {
+                return false;
+            }
+            m_next++;
+            if (c == '}') {
+                return true;
+            }
+            if (c != ',') {
+                return fail(std::string("Expected ',' or '}' but found '") +
+                            c + "'");
+            }
+        }
+    }
+
+    bool PointSamplesFileReader::readEyes(
+        MonoPointDistortionMeshSamplesPerEye& mesh) {
+        mesh.clear();
+        if (!expect('[')) {
+            return false;
+        }
+        char c;
+        while (true) {
+            auto eye = std::make_shared<MonoPointDistortionMeshSamples>();
+            if (!expect('[')) {
+                return false;
+            }
+            while (true) {
+                if (!readPoint(*eye)) {
+                    return false;
+                }
+                m_points++;
+                if (!peek(c)) {
+                    return false;
+                }
+                m_next++;
+                if (c == ']') {
+                    break;
+                }
+                if (c != ',') {
+                    return fail("Malformed " + m_key + " list for eye");
+                }
+            }
+            eye->shrinkToFit();
+            mesh.push_back(eye);
+
+            if (!peek(c)) {
+                return false;
+            }
+            m_next++;
+            if (c == ']') {
+                return true;
+            }
+            if (c != ',') {
+                return fail("Malformed " + m_key + " list");
+            }
+        }
+    }
+
+    bool PointSamplesFileReader::readPoint(
+        MonoPointDistortionMeshSamples& eye) {
+        char c;
+        if (!peek(c)) {
+            return false;
+        }
+        if (c == ']') {
+            return fail("Empty " + m_key + " list for eye");
+        }
+        double fromX, fromY, toX, toY;
+        if (!(expect('[') && expect('[') && readNumber(fromX) &&
+              expect(',') && readNumber(fromY) && expect(']') &&
+              expect(',') && expect('[') && readNumber(toX) &&
+              expect(',') && readNumber(toY) && expect(']') &&
+              expect(']'))) {
+            m_error += " in " + m_key + " list entry";
+            return false;
+        }
+        eye.add(static_cast<float>(fromX), static_cast<float>(fromY),
+                static_cast<float>(toX), static_cast<float>(toY));
+        return true;
+    }
+
+    bool PointSamplesFileReader::skipValue(size_t depth) {
+        if (depth > MAX_DEPTH) {
+            return fail("Too deeply nested");
+        }
+        char c;
+        if (!peek(c)) {
+            return false;
+        }
+        std::string s;
+        double d;
+        switch (c) {
+        case '{':
+            m_next++;
+            return readObject(SAMPLES_LEVEL + 1, depth);
+        case '[':
+            m_next++;
+            if (!peek(c)) {
+                return false;
+            }
+            if (c == ']') {
+                m_next++;
+                return true;
+            }
+            while (true) {
+                if (!skipValue(depth + 1) || !peek(c)) {
+                    return false;
+                }
+                m_next++;
+                if (c == ']') {
+                    return true;
+                }
+                if (c != ',') {
+                    return fail(
+                        std::string("Expected ',' or ']' but found '") + c +
+                        "'");
+                }
+            }
+        case '"':
+            return readString(s);
+        case 't':
+            return readLiteral("true");
+        case 'f':
+            return readLiteral("false");
+        case 'n':
+            return readLiteral("null");
+        default:
+            if (!((c >= '0' && c <= '9') || c == '-')) {
+                return fail(std::string("Unexpected '") + c + "'");
+            }
+            return readNumber(d);
+        }
+    }
+
+    bool PointSamplesFileReader::fail(const std::string& message) {
+        // Only the innermost failure gets a line number.
+        if (message.compare(0, 5, "Line ") == 0) {
+            m_error = message;
+        } else {
+            std::ostringstream s;
+            s << "Line " << m_line << ": " << message;
+            m_error = s.str();
+        }
+        return false;
+    }
+
+} // namespace renderkit
+} // namespace osvr
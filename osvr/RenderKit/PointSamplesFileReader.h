@@ -0,0 +1,113 @@
+/** @file
+@brief Header file describing a streaming reader for external distortion
+point-sample files.
+
+@date 2026
+
+@author
+Sensics, Inc.
+<http://sensics.com/osvr>
+*/
+
+// Copyright 2026 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+// Internal Includes
+#include "MonoPointMeshTypes.h"
+
+// Library/third-party includes
+// - none
+
+// Standard includes
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace osvr {
+namespace renderkit {
+
+    /// @brief Reads point-sample distortion meshes from an external file.
+    ///
+    /// The files are display descriptors whose
+    /// display/hmd/distortion object holds the samples, such as
+    /// mono_point_samples or red_point_samples: an array per eye of
+    /// [[from x, from y], [to x, to y]] points.  Dense calibration meshes
+    /// make these files large, so rather than parsing the whole file into
+    /// a JSON document and copying out of it, this tokenizes the file in
+    /// fixed-size chunks and writes each point straight into the compact
+    /// samples for its eye, checking its form as it goes.  Everything else
+    /// in the file is checked for well-formedness and skipped.
+    class PointSamplesFileReader {
+      public:
+        PointSamplesFileReader();
+
+        /// Read the eyes of the distortion member called name, if the file
+        /// has one, into mesh (replacing what is there).
+        void addSamples(const std::string& name,
+                        MonoPointDistortionMeshSamplesPerEye& mesh);
+
+        /// Read the file.  On failure, returns false and error() says why.
+        bool read(const std::string& fileName);
+
+        const std::string& error() const { return m_error; }
+
+        /// How much was read, and how long it took.
+        size_t bytes() const { return m_bytes; }
+        size_t points() const { return m_points; }
+        double seconds() const { return m_seconds; }
+
+      private:
+        PointSamplesFileReader(const PointSamplesFileReader&) = delete;
+        PointSamplesFileReader&
+        operator=(const PointSamplesFileReader&) = delete;
+
+        struct Samples {
+            std::string name;
+            MonoPointDistortionMeshSamplesPerEye* mesh;
+        };
+        std::vector<Samples> m_samples;
+
+        // Tokenizer.  Each returns false (with m_error set) on a syntax
+        // error or the end of the file.
+        bool fill();
+        bool peek(char& c); //< Next non-whitespace character
+        bool expect(char c);
+        bool readString(std::string& s);
+        bool readNumber(double& d);
+        bool readLiteral(const char* literal);
+
+        // Parser.
+        bool readObject(size_t level, size_t depth);
+        bool readEyes(MonoPointDistortionMeshSamplesPerEye& mesh);
+        bool readPoint(MonoPointDistortionMeshSamples& eye);
+        bool skipValue(size_t depth);
+        bool fail(const std::string& message);
+
+        std::ifstream m_file;
+        std::vector<char> m_buffer;
+        size_t m_next;  //< Next character in m_buffer
+        size_t m_end;   //< End of the characters in m_buffer
+        size_t m_line;  //< For error messages
+        std::string m_key;
+
+        std::string m_error;
+        size_t m_bytes;
+        size_t m_points;
+        double m_seconds;
+    };
+
+} // namespace renderkit
+} // namespace osvr
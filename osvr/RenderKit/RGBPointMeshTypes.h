@@ -44,6 +44,10 @@ namespace renderkit {
             MonoPointDistortionMeshDescription>,
         3> RGBPointDistortionMeshDescriptions;
 
+    typedef std::array< //!< One set of meshes per color red, green, blue
+        MonoPointDistortionMeshSamplesPerEye,
+        3> RGBPointDistortionMeshSamples;
+
 } // namespace renderkit
 } // namespace osvr
 #endif // INCLUDED_RGBPointMeshTypes_h_GUID_33CEDC76_9C34_4F8A_935B_652409FE6B30
@@ -40,7 +40,10 @@ Russ Taylor <russ@sensics.com>
 #include <string>
 #include <memory>
 #include <mutex>
+#include <condition_variable>
+#include <thread>
 #include <array>
+#include <atomic>
 
 namespace osvr {
 namespace renderkit {
@@ -66,12 +69,18 @@ namespace renderkit {
     /// and also #include the appropriate file that describes the class.
     class GraphicsLibraryD3D11;
     class GraphicsLibraryOpenGL;
+    class GraphicsLibrarySoftware;
+    // NOTE: Adding the Software member changed the size of this class (and
+    // of RenderBuffer), so code built against earlier headers must be
+    // rebuilt.
     class GraphicsLibrary {
       public:
         GraphicsLibraryD3D11* D3D11 =
             nullptr; //< #include <osvr/RenderKit/GraphicsLibraryD3D11.h>
         GraphicsLibraryOpenGL* OpenGL =
             nullptr; //< #include <osvr/RenderKit/GraphicsLibraryOpenGL.h>
+        GraphicsLibrarySoftware* Software =
+            nullptr; //< #include <osvr/RenderKit/GraphicsLibrarySoftware.h>
     };
 
     /// @brief Used to pass Render Texture targets to be rendered
@@ -84,17 +93,23 @@ namespace renderkit {
     /// file that describes the class.
     class RenderBufferD3D11;
     class RenderBufferOpenGL;
+    class RenderBufferSoftware;
+    // NOTE: Adding the Software member changed the size of this class, as
+    // for GraphicsLibrary.
     class RenderBuffer {
       public:
         OSVR_RENDERMANAGER_EXPORT RenderBuffer() {
             D3D11 = nullptr;
             OpenGL = nullptr;
+            Software = nullptr;
         }
 
         RenderBufferD3D11*
             D3D11; //< #include <osvr/RenderKit/GraphicsLibraryD3D11.h>
         RenderBufferOpenGL*
             OpenGL; //< #include <osvr/RenderKit/GraphicsLibraryOpenGL.h>
+        RenderBufferSoftware*
+            Software; //< #include <osvr/RenderKit/GraphicsLibrarySoftware.h>
     };
 
     /// @brief Returns timing information about the rendering system
@@ -113,6 +128,204 @@ namespace renderkit {
         // presented.
     } RenderTimingInfo;
 
+    /// @brief Returns frame-pacing information about the rendering system
+    ///
+    /// Structure that holds RenderManager's running estimates of how long
+    /// the application takes to render a frame and how long RenderManager
+    /// takes to present it, which are used by WaitForNextFrameStart() to
+    /// decide when to wake the application.  Also reports how many paced
+    /// frames missed their deadline.  Times are in seconds and will be 0
+    /// if they have not yet been measured.
+    typedef struct {
+        double estimatedRenderSeconds;  //< Smoothed application render time
+        double estimatedPresentSeconds; //< Smoothed RenderManager present cost
+        double refreshIntervalSeconds;  //< Display refresh interval in use
+        unsigned refreshesPerFrame; //< Refreshes each frame is shown for
+        size_t framesPaced;     //< Frames bracketed by BeginFrame()/EndFrame()
+        size_t missedDeadlines; //< Paced frames that missed their deadline
+        bool lastFrameMissedDeadline; //< Did the most-recent frame miss?
+    } FramePacingInfo;
+
+    /// @brief Timestamps for the stages of one present
+    ///
+    /// RenderManager records one of these each time it presents a frame
+    /// (including when it re-presents one on its own) and keeps the most
+    /// recent ones in a fixed-size history that is read with
+    /// GetFrameTimingRecords().  Stages in order: the present starts,
+    /// any wait for the time-warp window before vsync ends, the poses used
+    /// for time warp are read, the time-warp matrices are computed, the
+    /// draws for each eye are submitted, and the buffers are swapped.
+    /// Times that do not apply have the value (0,0): the pose read when
+    /// time warp is off, and eyes past numEyes.
+    ///
+    /// When the graphics library supports timer queries, the GPU time
+    /// spent on the present pass and on each eye's draw is filled in a few
+    /// frames later, once the GPU has reported it; until then (and when
+    /// it is not supported) these durations are 0.
+    enum { FRAME_TIMING_MAX_EYES = 4 };
+    typedef struct {
+        uint64_t frame; //< Sequence number of the present
+        bool repeat;    //< Re-presentation of an earlier frame?
+        OSVR_TimeValue presentEntry;  //< Present started
+        OSVR_TimeValue vsyncWaitExit; //< Done waiting for time-warp window
+        OSVR_TimeValue poseLatch;     //< Poses for time warp read
+        OSVR_TimeValue warpComputed;  //< Time-warp matrices computed
+        size_t numEyes;               //< Eyes with submission times below
+        OSVR_TimeValue eyeSubmitStart[FRAME_TIMING_MAX_EYES];
+        OSVR_TimeValue eyeSubmitEnd[FRAME_TIMING_MAX_EYES];
+        OSVR_TimeValue swapReturn; //< Buffers swapped and frame finalized
+        double gpuPresentSeconds;  //< GPU time, first draw to last draw
+        double gpuEyeSeconds[FRAME_TIMING_MAX_EYES]; //< GPU time per eye
+    } FrameTimingRecord;
+
+    /// @brief Describes a handler that is given frame-timing records one
+    /// at a time, for callers that keep them in a form of their own.
+    ///
+    /// Called while the frame-timing history is locked, so it should only
+    /// copy the record.
+    typedef void (*FrameTimingRecordCallback)(
+        void* userData //< Passed into GetFrameTimingRecords
+        ,
+        size_t index //< Position of the record, oldest first
+        ,
+        const FrameTimingRecord& record //< The record
+        );
+
+    /// @brief Distribution of one stage's duration, in seconds
+    typedef struct {
+        double p50;
+        double p90;
+        double p99;
+        double max;
+    } FrameTimingPercentiles;
+
+    /// @brief Rolling statistics over the frame-timing history
+    ///
+    /// Durations are computed from the records returned by
+    /// GetFrameTimingRecords().  The pose-to-swap latency only covers
+    /// frames that were time-warped, and the GPU present time only covers
+    /// frames whose GPU timing has been read back.
+    typedef struct {
+        size_t frames; //< Number of records summarized
+        FrameTimingPercentiles presentSeconds;   //< Entry to swap return
+        FrameTimingPercentiles vsyncWaitSeconds; //< Entry to wait exit
+        FrameTimingPercentiles warpSeconds; //< Wait exit to warp computed
+        FrameTimingPercentiles submitSeconds; //< First to last eye submit
+        FrameTimingPercentiles swapSeconds;   //< Last eye to swap return
+        FrameTimingPercentiles poseToSwapSeconds; //< Pose read to swap
+        FrameTimingPercentiles gpuPresentSeconds; //< GPU present pass
+    } FrameTimingStats;
+
+    /// @brief Which pose a motion-to-photon latency is measured from
+    typedef enum {
+        LATENCY_APP_POSE,      //< Pose the application rendered with
+        LATENCY_TIME_WARP_POSE //< Pose the frame was time-warped to
+    } LatencySource;
+
+    /// @brief Summary of the motion-to-photon latency of presented frames
+    ///
+    /// Latency runs from the timestamp of the head tracker report that a
+    /// pose came from to the estimated time the eye's image is shown:
+    /// when the swap returned (or the next retrace, if swaps do not wait
+    /// for it) plus the eye's configured delay after vsync.  Client-side
+    /// prediction is not subtracted.  Percentiles are read from a
+    /// histogram with 0.25 ms buckets, so they are rounded up to the next
+    /// bucket; latencies of 64 ms or more all land in the last bucket.
+    typedef struct {
+        uint64_t samples;   //< Frames measured
+        double meanSeconds; //< Mean latency
+        double p50Seconds;
+        double p90Seconds;
+        double p99Seconds;
+        double maxSeconds; //< Exact largest latency seen
+    } LatencyStats;
+
+    /// @brief Why a refresh did not show a new frame on time
+    ///
+    /// A present that completes more than one refresh after the previous
+    /// one missed a retrace.  It is blamed on the application if the
+    /// frame reached RenderManager too late to be presented by that
+    /// retrace, on late time warp if time warp was not done in time, and
+    /// on the compositor (RenderManager's present) otherwise.  When a
+    /// presenter thread that is rendering at a fraction of the refresh
+    /// rate has to show the last frame again at a frame boundary because
+    /// no new frame has arrived, that is also an application miss.
+    typedef enum {
+        FRAME_DROP_APP,        //< Application frame arrived late
+        FRAME_DROP_COMPOSITOR, //< Present did not finish in time
+        FRAME_DROP_LATE_WARP   //< Time warp finished too late
+    } FrameDropType;
+
+    /// @brief Counts of missed refreshes, by cause
+    ///
+    /// Retraces can only be detected with vertical sync, once the refresh
+    /// interval has been estimated.
+    typedef struct {
+        uint64_t presents;         //< Presents completed
+        uint64_t appMisses;        //< FRAME_DROP_APP
+        uint64_t compositorMisses; //< FRAME_DROP_COMPOSITOR
+        uint64_t lateWarps;        //< FRAME_DROP_LATE_WARP
+    } FrameDropStats;
+
+    /// @brief Describes the parameters for a frame-drop callback handler.
+    ///
+    /// Called on the thread that presents, as soon as a missed refresh is
+    /// detected, while RenderManager's state is locked.  It should return
+    /// quickly and must not call RenderManager methods other than
+    /// GetFrameDropStats(); engines can use it to set a flag to shed
+    /// quality on the next frame, for example.
+    typedef void (*FrameDropCallback)(
+        void* userData //< Passed into SetFrameDropCallback
+        ,
+        FrameDropType type //< Why the refresh was missed
+        ,
+        uint64_t frame //< Frame-timing sequence number of the present
+        );
+
+    /// @brief Describes the scheduling applied to the present thread
+    ///
+    /// Filled in the first time RenderManager presents from a thread,
+    /// based on the presentThread settings in the renderManagerConfig.
+    /// Reports what was actually applied, which may be less than what was
+    /// asked for when the process does not have permission.
+    typedef struct {
+        bool applied;       //< Has any setting been applied?
+        bool realTime;      //< Running under SCHED_FIFO or SCHED_RR?
+        int priority;       //< Real-time priority, if realTime
+        bool niceApplied;   //< Was a nice value applied?
+        int nice;           //< Nice value, if niceApplied
+        size_t pinnedCPUs;  //< CPUs the thread is pinned to (0 = not pinned)
+        size_t lockedBytes; //< Bytes of the thread's stack locked in memory
+    } PresentThreadSchedulingInfo;
+
+    /// @brief How long one stage of opening the display took
+    ///
+    /// Read with GetStartupTiming().  Stages that ran on a thread of their
+    /// own overlapped the others, so the durations can add up to more
+    /// than OpenDisplay() took.  Stages that were not run because an
+    /// earlier one failed have ran set false.
+    typedef struct {
+        const char* name; //< Name of the stage
+        bool worker;      //< Ran on a thread of its own?
+        bool ran;         //< Was it run?
+        bool succeeded;   //< Did it succeed?
+        double startSeconds; //< When it started, from the start of the first
+        double seconds;      //< How long it took
+    } StartupStageTiming;
+
+    /// @brief Identifies a frame handed to PresentRenderBuffers(), so that
+    /// the application can find out when it has been presented.  Tokens
+    /// increase by one with each present; 0 is never used.
+    typedef uint64_t PresentToken;
+
+    /// @brief Status of a frame handed to PresentRenderBuffers()
+    typedef enum {
+        PRESENT_PENDING,   //< Queued and not yet presented
+        PRESENT_SUCCEEDED, //< Presented
+        PRESENT_FAILED,    //< Presentation failed or the frame was dropped
+        PRESENT_UNKNOWN    //< Invalid token, or too old to remember
+    } PresentStatus;
+
     /// @brief Simple structure for representing a float based RGB color
     typedef struct {
         float r;
@@ -229,6 +442,9 @@ namespace renderkit {
     /// 2D float data, like a texture coordinate for example.
     using Float2 = std::array<float, 2>;
 
+    class TraceWriter;
+    class InputLog;
+
     class RenderManager {
       public:
         ///-------------------------------------------------------------
@@ -383,17 +599,32 @@ namespace renderkit {
         /// modelview matrices will be in world space; the client is
         /// responsible for converting hand space and such into the
         /// correct coordinate system.
+        ///  NOTE: This returns a new vector, which allocates each call.
+        /// Frame loops that should not allocate use the overload below
+        /// that fills in a vector they keep.
         ///  @return Returns an empty vector on failure.
         inline std::vector<RenderInfo> OSVR_RENDERMANAGER_EXPORT
         GetRenderInfo(const RenderParams& params = RenderParams()) {
             std::vector<RenderInfo> ret;
-            size_t num = LatchRenderInfo(params);
-            for (size_t i = 0; i < num; i++) {
-                ret.push_back(GetRenderInfo(i));
-            }
+            GetRenderInfo(params, ret);
             return ret;
         }
 
+        /// @brief Gets parameters needed to render all eyes and displays
+        /// into a vector the caller keeps.
+        ///
+        /// The same as GetRenderInfo(params), except that the results are
+        /// written into info, whose storage is reused, so an application
+        /// that passes the same vector each frame does not allocate
+        /// after the first.  This is not virtual, so that it leaves the
+        /// class's virtual table as it was; render libraries change what
+        /// it returns by overriding GetRenderInfoInternal().
+        ///  @return The number of entries in info, 0 (with info empty)
+        /// on failure.
+        size_t OSVR_RENDERMANAGER_EXPORT
+        GetRenderInfo(const RenderParams& params,
+                      std::vector<RenderInfo>& info);
+
         /// @brief Registers texture buffers to be used to render all eyes and
         /// displays.
         ///
@@ -471,6 +702,21 @@ namespace renderkit {
         ///  @param[in] flipInY Should we flip all of the buffers over in
         /// Y before presentation (this is helpful for OpenGL/Direct3D
         /// interop, where the buffer coordinates are different).
+        ///  @param[out] token If not NULL, filled in with a token that can
+        /// be passed to GetPresentStatus() or WaitForPresent().
+        ///  NOTE: When the presentQueueDepth setting is nonzero and the
+        /// RenderManager supports it, this copies the request into a queue
+        /// and returns without waiting for it to be presented; a presenter
+        /// thread presents queued frames in order at the display rate.  If
+        /// the queue is full, this waits until there is room.  The buffers
+        /// are read after this returns, so the application must not render
+        /// into them again until their token is no longer PRESENT_PENDING;
+        /// this usually means cycling through one more set of buffers than
+        /// the queue depth.  The return value only reports whether the frame
+        /// was queued; use the token to find out whether it was presented.
+        ///  When the refreshesPerFrame setting is above 1, frames are also
+        /// queued, and each one is re-presented until the next is shown, so
+        /// its token stays PRESENT_PENDING until it has been superseded.
         ///  @return Returns true on success and false on failure.
         bool OSVR_RENDERMANAGER_EXPORT
         PresentRenderBuffers(const std::vector<RenderBuffer>& buffers,
@@ -479,7 +725,21 @@ namespace renderkit {
                              const std::vector<OSVR_ViewportDescription>&
                                  normalizedCroppingViewports =
                                      std::vector<OSVR_ViewportDescription>(),
-                             bool flipInY = false);
+                             bool flipInY = false,
+                             PresentToken* token = nullptr);
+
+        /// @brief Find out whether a frame has been presented.
+        ///  @param[in] token Token returned by PresentRenderBuffers().
+        ///  @return The status of that frame.  The outcome is remembered
+        /// for the most recent 16 frames; older ones are PRESENT_UNKNOWN.
+        PresentStatus OSVR_RENDERMANAGER_EXPORT
+        GetPresentStatus(PresentToken token);
+
+        /// @brief Wait until a frame is no longer pending presentation.
+        ///  @param[in] token Token returned by PresentRenderBuffers().
+        ///  @return The final status of that frame.
+        PresentStatus OSVR_RENDERMANAGER_EXPORT
+        WaitForPresent(PresentToken token);
 
         /// @brief Sends solid color to all eyes and displays.
         ///
@@ -511,6 +771,181 @@ namespace renderkit {
             return false;
         }
 
+        ///-------------------------------------------------------------
+        /// @brief Wait until it is time to start rendering the next frame
+        ///
+        /// Blocks until the latest time at which the application can start
+        /// rendering a frame (and so latch the freshest poses) and still
+        /// have it presented at the next vertical retrace.  This is based
+        /// on a running estimate of the time between BeginFrame() and
+        /// the call to PresentRenderBuffers() or the end of Render(), plus
+        /// RenderManager's own present cost.  If the next retrace can no
+        /// longer be made, the one after it is targeted.
+        ///   Retrace times come from GetTimingInfo() when the RenderManager
+        /// provides it and are otherwise estimated from the times at which
+        /// vertical-sync'ed presents complete.  Returns immediately when
+        /// neither is available yet.
+        ///   Call BeginFrame() right after this returns and EndFrame() once
+        /// the frame has been presented.
+        ///  @return True on success, false on failure.
+        bool OSVR_RENDERMANAGER_EXPORT WaitForNextFrameStart();
+
+        /// @brief Mark the start of application rendering for a frame.
+        ///  @return True on success, false on failure.
+        bool OSVR_RENDERMANAGER_EXPORT BeginFrame();
+
+        /// @brief Mark the end of a frame started with BeginFrame().
+        ///
+        /// Call after PresentRenderBuffers() or Render() returns.  Updates
+        /// the render-time estimate and checks whether the frame was
+        /// handed to RenderManager in time to make its target retrace;
+        /// the result is available from GetFramePacingInfo().
+        ///  @return True on success, false on failure (no BeginFrame()).
+        bool OSVR_RENDERMANAGER_EXPORT EndFrame();
+
+        /// @brief Read the frame-pacing estimates and deadline counters.
+        ///  @return True on success, false on failure.
+        bool OSVR_RENDERMANAGER_EXPORT GetFramePacingInfo(
+            FramePacingInfo& info //!< Info that is returned
+            );
+
+        /// @brief Read the timing of the most-recent presents.
+        ///
+        /// Copies up to maxRecords of the newest records from the
+        /// frame-timing history (which holds the last 256) into the array,
+        /// oldest first.  Does not allocate, and does not wait for a
+        /// present that is in progress.
+        ///  @param[out] numRecords How many records were copied.
+        ///  @return True on success, false on failure.
+        bool OSVR_RENDERMANAGER_EXPORT GetFrameTimingRecords(
+            FrameTimingRecord* records //!< Array to fill in
+            , size_t maxRecords //!< Size of the array
+            , size_t& numRecords //!< Number of records filled in
+            );
+
+        /// @brief Read the timing of the most-recent presents, handing
+        /// each record to a callback instead of copying it into an array.
+        /// Otherwise the same as the version above.
+        bool OSVR_RENDERMANAGER_EXPORT GetFrameTimingRecords(
+            FrameTimingRecordCallback callback //!< Given each record
+            , void* userData //!< Passed to the callback
+            , size_t maxRecords //!< Most records to hand over
+            , size_t& numRecords //!< Number of records handed over
+            );
+
+        /// @brief Read percentiles of each stage's duration over the
+        /// frame-timing history.
+        ///  @return True on success, false if nothing has been presented.
+        bool OSVR_RENDERMANAGER_EXPORT GetFrameTimingStats(
+            FrameTimingStats& stats //!< Statistics that are returned
+            );
+
+        /// @brief Read the motion-to-photon latency of the frames that have
+        /// been presented to an eye.
+        ///
+        /// RenderManager measures every frame it presents, from the pose
+        /// the application rendered with (when it came from a
+        /// GetRenderInfo() call) and from the pose used for time warp.  The
+        /// measurements are kept in histograms that are updated and read
+        /// without locks, so this can be called from any thread at any
+        /// time.
+        ///  @return True on success, false if the eye is out of range.
+        bool OSVR_RENDERMANAGER_EXPORT GetMotionToPhotonLatency(
+            size_t whichEye //!< Eye to read
+            , LatencySource source //!< Pose to measure from
+            , LatencyStats& stats //!< Statistics that are returned
+            );
+
+        /// @brief Copy the raw motion-to-photon latency histogram for an eye.
+        ///  Bucket i counts latencies from i to i+1 times bucketSeconds,
+        /// except the last, which counts everything beyond.
+        ///  @return True on success, false if the eye is out of range.
+        bool OSVR_RENDERMANAGER_EXPORT GetMotionToPhotonHistogram(
+            size_t whichEye //!< Eye to read
+            , LatencySource source //!< Pose to measure from
+            , std::vector<uint64_t>& counts //!< Count in each bucket
+            , double& bucketSeconds //!< Width of each bucket
+            );
+
+        /// @brief Clear the motion-to-photon latency histograms.
+        void OSVR_RENDERMANAGER_EXPORT ResetMotionToPhotonLatency();
+
+        ///-------------------------------------------------------------
+        /// @brief Set a callback for missed refreshes.
+        ///
+        /// The userdata pointer will be handed to the callback function.
+        /// Pass a NULL callback to stop being called.
+        bool OSVR_RENDERMANAGER_EXPORT SetFrameDropCallback(
+            FrameDropCallback callback //< Function to call, or NULL
+            ,
+            void* userData = nullptr //< Passed to callback function
+            );
+
+        /// @brief Read the counts of missed refreshes.  Does not lock, so
+        /// it can be called from a FrameDropCallback.
+        ///  @return True on success, false on failure.
+        bool OSVR_RENDERMANAGER_EXPORT GetFrameDropStats(
+            FrameDropStats& stats //!< Counts that are returned
+            );
+
+        /// @brief Set the counts of missed refreshes back to zero.
+        void OSVR_RENDERMANAGER_EXPORT ResetFrameDropStats();
+
+        /// @brief Read what scheduling was applied to the present thread.
+        ///
+        /// The presentThread settings from the ConstructorParameters are
+        /// applied once, to the presenter thread when presents are queued
+        /// or to the time-warp thread when asynchronous time warp is in
+        /// use.  An application thread that presents for itself only has
+        /// them applied, the first time it presents, if
+        /// m_presentThreadApplyToCaller is set.
+        ///  @return True and filled-in info once the settings have been
+        /// tried (the info says which of them took effect), false if none
+        /// were requested or there has been no present yet.
+        bool OSVR_RENDERMANAGER_EXPORT GetPresentThreadScheduling(
+            PresentThreadSchedulingInfo& info //!< Info that is returned
+            );
+
+        /// @brief Read how long each stage of OpenDisplay() took.
+        ///
+        /// Render libraries that open their display in stages report
+        /// each one, in the order they were scheduled.
+        ///  @return True and filled-in stages once OpenDisplay() has been
+        /// called, false if it has not or the library does not report
+        /// stages.
+        bool OSVR_RENDERMANAGER_EXPORT GetStartupTiming(
+            std::vector<StartupStageTiming>& stages //!< Stages returned
+            );
+
+        ///-------------------------------------------------------------
+        /// @brief Turn dynamic render resolution on or off
+        ///
+        /// When enabled, RenderManager measures how long each frame takes
+        /// to render and present compared to the display refresh interval
+        /// and scales the width and height of the viewports it reports in
+        /// RenderInfo to hold the refresh rate.  It backs off quickly when
+        /// frames run over budget and recovers slowly when there is
+        /// headroom, so that it does not oscillate.
+        ///   The scale is relative to the size set by the render overfill
+        /// and oversample factors, which is the size the render buffers
+        /// should still be allocated at; they do not need to be reallocated
+        /// when the scale changes.  The application should render each eye
+        /// into the reported viewport, which starts at the origin of the
+        /// region that eye uses in its buffer.  PresentRenderBuffers()
+        /// compares the viewports in the RenderInfo that was used against
+        /// the full size and crops the buffers to match.
+        ///  @param enable Turn the controller on (true) or off (false).
+        /// Turning it off returns to full resolution.
+        ///  @param minScale Smallest scale to use, greater than 0.
+        ///  @param maxScale Largest scale to use, at most 1.
+        ///  @return True on success, false on invalid bounds.
+        bool OSVR_RENDERMANAGER_EXPORT SetDynamicResolution(
+            bool enable, float minScale = 0.5f, float maxScale = 1.0f);
+
+        /// @brief Read the current dynamic render-resolution scale.
+        ///  @return Scale applied to render viewports, 1 when disabled.
+        float OSVR_RENDERMANAGER_EXPORT GetDynamicResolutionScale();
+
         ///-------------------------------------------------------------
         /// Class that stores one of a set of possible distortion parameters.
         /// The type of parameters is determined by the m_type, and which
@@ -598,11 +1033,19 @@ namespace renderkit {
             size_t m_desiredTriangles; //< How many triangles would we like in
             // the mesh?
 
-            // Parameters valid for a mesh of type mono_point_samples
+            // Parameters valid for a mesh of type mono_point_samples.
+            // deprecated: m_monoPointSamples is only read for an eye that
+            // has no m_monoPointMeshSamples, and is copied into the
+            // compact form each time a mesh is computed from it.
             MonoPointDistortionMeshDescriptions m_monoPointSamples;
+            MonoPointDistortionMeshSamplesPerEye
+                m_monoPointMeshSamples; //< Shared, filled from the config
 
-            // Parameters valid for a mesh of type rgb_point_samples
+            // Parameters valid for a mesh of type rgb_point_samples, used
+            // in the same way as the mono ones above.
             RGBPointDistortionMeshDescriptions m_rgbPointSamples;
+            RGBPointDistortionMeshSamples
+                m_rgbPointMeshSamples; //< Shared, filled from the config
 
             // Parameters valid for a mesh of type rgb_symmetric_polynomials
             std::vector<float> m_distortionPolynomialRed; //< Constant, linear,
@@ -654,10 +1097,28 @@ namespace renderkit {
 
                 m_clientPredictionEnabled = false;
                 m_clientPredictionLocalTimeOverride = false;
+                m_latencyLogSeconds = 0;
 
                 m_core = false;
+                m_glErrorChecking = DefaultGLErrorChecking;
+                m_glErrorCheckInterval = 60;
 
                 m_graphicsLibrary = GraphicsLibrary();
+
+                m_presentThreadScheduling = DefaultScheduling;
+                m_presentThreadPriority = 1;
+                m_presentThreadNice = 0;
+                m_presentThreadLockMemory = false;
+                m_presentThreadApplyToCaller = false;
+
+                m_presentQueueDepth = 0;
+                m_refreshesPerFrame = 1;
+                m_nullRefreshRate = 90;
+                m_softwareCompositorThreads = 0;
+                m_captureBuffers = 0;
+                m_captureDownscale = 1;
+                m_captureEye = -1;
+                m_backgroundDistortionMeshes = false;
             }
             typedef enum {
                 Zero,
@@ -666,6 +1127,20 @@ namespace renderkit {
                 TwoSeventy
             } Display_Rotation;
 
+            typedef enum {
+                DefaultScheduling,
+                FIFOScheduling,
+                RoundRobinScheduling
+            } Thread_Scheduling;
+
+            typedef enum {
+                FullGLErrorChecking,        //< glGetError() after each step
+                DebugOutputGLErrorChecking, //< KHR_debug error callback
+                FrameEndGLErrorChecking,    //< One glGetError() per frame
+                SampledGLErrorChecking,     //< Full checking every Nth frame
+                DefaultGLErrorChecking      //< Chosen by the library's build
+            } GL_Error_Checking;
+
             bool m_directMode; //< Should we render using DirectMode?
 
             void addCandidatePNPID(const char* pnpid);
@@ -738,6 +1213,10 @@ namespace renderkit {
             std::vector<float> m_eyeDelaysMS;
             bool m_clientPredictionLocalTimeOverride;  //< Override tracker timestamp?
 
+            /// How often to log motion-to-photon latency, in seconds
+            /// (0 = never).
+            double m_latencyLogSeconds;
+
             OSVRDisplayConfiguration
                 m_displayConfiguration; //< Display configuration
 
@@ -747,10 +1226,86 @@ namespace renderkit {
             /// has no effect when using graphics libraries
             bool m_core;
 
+            /// How often the OpenGL RenderManager calls glGetError() while
+            /// rendering and presenting frames, each call of which can
+            /// stall the pipeline.  Errors stay recorded until they are
+            /// read, so every mode reports them; the frequent checks only
+            /// narrow down where they happened.  Defaults to full checking
+            /// if the library is a debug build and frame-end checking if
+            /// it is a release build, whatever the application is.
+            GL_Error_Checking m_glErrorChecking;
+            unsigned m_glErrorCheckInterval; //< Frames between sampled checks
+
             /// Graphics library (device/context) to use instead of creating one
             /// if the pointer is non-NULL.  Note that the appropriate context
             /// pointer for the m_renderLibrary must be filled in.
             GraphicsLibrary m_graphicsLibrary;
+
+            /// Scheduling policy for the thread that presents (or, with
+            /// asynchronous time warp, time-warps) frames.  Real-time
+            /// policies fall back on m_presentThreadNice when the process
+            /// is not permitted to use them.  Only supported on Linux.
+            Thread_Scheduling m_presentThreadScheduling;
+            int m_presentThreadPriority; //< Real-time priority, clamped to
+            // the range allowed for the policy
+            int m_presentThreadNice; //< Nice value (0 = leave unchanged)
+            std::vector<int>
+                m_presentThreadCPUs; //< CPUs to pin to (empty = leave alone)
+            bool m_presentThreadLockMemory; //< Lock the thread's stack in RAM?
+            /// Also apply these to an application thread that presents for
+            /// itself, when there is no presenter or time-warp thread?
+            bool m_presentThreadApplyToCaller;
+
+            /// How many frames PresentRenderBuffers() may queue for a
+            /// presenter thread before it waits (1-3).  0 presents on the
+            /// caller's thread before returning.
+            unsigned m_presentQueueDepth;
+
+            /// Number of display refreshes each application frame is shown
+            /// for (1-4).  Above 1, the application presents every Nth
+            /// refresh and the presenter thread re-presents the last frame,
+            /// time-warped to fresh poses, on the refreshes in between.
+            /// Requires queued presentation and vertical sync.
+            unsigned m_refreshesPerFrame;
+
+            /// Refresh rate (Hz) of the display simulated by the "Null"
+            /// render library.  0 reports no display timing and never
+            /// waits for vertical sync.
+            double m_nullRefreshRate;
+
+            /// Threads the "Software" render library composites each display
+            /// with, including the presenting thread (0 = one per core).
+            unsigned m_softwareCompositorThreads;
+
+            /// Length of the ring of pixel buffers that the OpenGL render
+            /// libraries read presented displays back into, for the
+            /// application's captureCallback (0 = no capture).  Frames are
+            /// delivered two or more presents late, without waiting on the
+            /// GPU; with fewer than three buffers, some are dropped.
+            unsigned m_captureBuffers;
+            unsigned m_captureDownscale; //< Divide captured sizes by this
+            int m_captureEye; //< Capture only this eye (-1 = all displays)
+
+            /// Build the distortion meshes on a background thread, presenting
+            /// with an undistorted mesh until they are ready, rather than
+            /// making OpenDisplay() and UpdateDistortionMeshes() wait for
+            /// them.  Back ends that can't do this build them in the
+            /// foreground.
+            bool m_backgroundDistortionMeshes;
+
+            /// Chrome trace-event file to write a timeline of RenderManager's
+            /// work to (empty = no tracing).
+            std::string m_traceFile;
+
+            /// File to record the inputs RenderManager reads each frame
+            /// (poses, velocities, display timing and render parameters)
+            /// to, for later replay (empty = no recording).
+            std::string m_recordInputFile;
+
+            /// File of recorded inputs to read in place of the client
+            /// context (empty = read live inputs).  Cannot be combined
+            /// with m_recordInputFile.
+            std::string m_replayInputFile;
         };
 
         /// Describes the type of mesh to be constructed for distortion
@@ -823,8 +1378,11 @@ namespace renderkit {
 
         /// Internal versions of functions that require a mutex, so that
         /// we can call them from functions with a mutex without blocking.
-        virtual std::vector<RenderInfo>
-        GetRenderInfoInternal(const RenderParams& params = RenderParams());
+        /// GetRenderInfoInternal() fills in info, re-using its storage so
+        /// that it does not allocate each frame, and returns false (with
+        /// info empty) on failure.
+        virtual bool GetRenderInfoInternal(const RenderParams& params,
+                                           std::vector<RenderInfo>& info);
 
         virtual bool RegisterRenderBuffersInternal(
             const std::vector<RenderBuffer>& buffers,
@@ -998,10 +1556,14 @@ namespace renderkit {
         /// translation impact.
         ///  @return True on success, false (with empty transforms vector) on
         /// failure.
-        virtual bool
-        ComputeAsynchronousTimeWarps(std::vector<RenderInfo> usedRenderInfo,
-                                     std::vector<RenderInfo> currentRenderInfo,
-                                     float assumedDepth = 2.0f);
+        virtual bool ComputeAsynchronousTimeWarps(
+            const std::vector<RenderInfo>& usedRenderInfo,
+            const std::vector<RenderInfo>& currentRenderInfo,
+            float assumedDepth = 2.0f);
+
+        /// RenderInfo for the time of presentation, used to compute the
+        /// time warps; kept so that its storage is reused between frames.
+        std::vector<RenderInfo> m_presentRenderInfo;
 
         /// Asynchronous time warp matrices suitable for use in OpenGL,
         /// taking (-0.5,-0.5) to (0.5,0.5) coordinates into the appropriate new
@@ -1022,6 +1584,474 @@ namespace renderkit {
         bool m_renderBuffersRegistered; //!< Keeps track of whether we have
         //! registered buffers
 
+        /// @brief State used by the frame-pacing methods.
+        ///  Durations are in seconds and are exponentially-smoothed.
+        struct FramePacingState {
+            double renderSeconds = 0;   //< Application render time
+            double renderDeviation = 0; //< Mean absolute render-time error
+            double presentSeconds = 0;  //< Present cost, minus waits/swaps
+            double refreshInterval = 0; //< Estimated from completed presents
+            OSVR_TimeValue lastPresentDone = {0, 0}; //< When swap returned
+            OSVR_TimeValue frameBegin = {0, 0};      //< From BeginFrame()
+            OSVR_TimeValue presentEntry = {0, 0}; //< Start of current present
+            OSVR_TimeValue pendingRetrace = {0, 0}; //< From WaitFor...()
+            OSVR_TimeValue targetRetrace = {0, 0};  //< Current frame's target
+            bool havePendingRetrace = false;
+            bool haveTargetRetrace = false;
+            bool inFrame = false;          //< Between BeginFrame/EndFrame?
+            bool presentedInFrame = false; //< Presented since BeginFrame()?
+            size_t framesPaced = 0;
+            size_t missedDeadlines = 0;
+            bool lastFrameMissedDeadline = false;
+            unsigned refreshesPerFrame = 1; //< Ratio the presenter is using
+            unsigned presentPhase = 0; //< Refresh phase of last present
+        } m_framePacing;
+
+        /// @brief Find the time of the next vertical retrace.
+        ///  Uses GetTimingInfo() if it is available and falls back on the
+        /// refresh interval estimated from completed presents.
+        ///  @return True and filled-in values on success, false if the
+        /// retrace timing is not known.
+        bool GetNextRetraceInternal(
+            const OSVR_TimeValue& now //< Current time
+            , OSVR_TimeValue& nextRetrace //< Output time of next retrace
+            , double& intervalSeconds //< Output refresh interval
+            );
+
+        /// @brief Find the next retrace that a new application frame can
+        /// be shown at.
+        ///  When rendering at a fraction of the refresh rate, this is the
+        /// next retrace at which the presenter thread picks up a new frame
+        /// and the interval is that between such retraces.  Otherwise it is
+        /// the same as GetNextRetraceInternal().
+        bool GetNextFrameRetraceInternal(
+            const OSVR_TimeValue& now //< Current time
+            , OSVR_TimeValue& nextRetrace //< Output time of next retrace
+            , double& intervalSeconds //< Output interval between frames
+            );
+
+        /// @brief How long before a retrace a frame must reach present.
+        double FramePresentLeadSecondsInternal() const;
+
+        /// @brief Record the timing of a present that just finished.
+        ///  @return True if the present completed more than one refresh
+        /// interval after the previous one, meaning a retrace was missed.
+        bool RecordPresentTimingInternal(
+            const OSVR_TimeValue& presentDone //< When the swap returned
+            , double presentSeconds //< Present cost, minus waits and swaps
+            );
+
+        /// @brief History of per-present timing records.  The ring has
+        /// its own mutex, which is held only while copying records in or
+        /// out, so readers see whole records without waiting for a present
+        /// to finish.
+        struct FrameTimingState {
+            enum { HISTORY = 256 };
+            std::mutex mutex;
+            std::array<FrameTimingRecord, HISTORY> records; //< Ring
+            size_t next = 0;   //< Index the next record goes in
+            size_t count = 0;  //< Number of valid records
+            uint64_t frames = 0; //< Number of presents recorded
+            FrameTimingRecord current = {}; //< Being filled, under m_mutex
+        } m_frameTiming;
+
+        /// @brief Add m_frameTiming.current to the history.
+        void PublishFrameTimingInternal();
+
+        /// @brief State used by the dynamic render-resolution controller.
+        struct DynamicResolutionState {
+            bool enabled = false;
+            float minScale = 0.5f;
+            float maxScale = 1.0f;
+            float scale = 1.0f;            //< Current viewport scale
+            unsigned overBudgetFrames = 0;  //< Consecutive frames over
+            unsigned underBudgetFrames = 0; //< Consecutive frames well under
+        } m_dynamicResolution;
+
+        /// @brief Per-eye viewport and projection on the Render path.
+        /// These depend only on the display configuration and size, the
+        /// overfill and oversample factors, and (for the projections) the
+        /// clipping planes, so they are computed once and reused by
+        /// GetRenderInfoInternal(), which then only has to construct the
+        /// poses each frame.  Each is recomputed whenever any of the
+        /// values it was computed from (stored here) changes.  The
+        /// present path gets render info with the parameters passed to
+        /// PresentRenderBuffers(), whose clipping planes need not match
+        /// those the application rendered with, so the projections for
+        /// the two most recently used pairs of clipping planes are kept;
+        /// alternating between them does not recompute either.
+        struct RenderGeometryCache {
+            bool viewportsValid = false;
+            size_t numEyes = 0;
+            int displayWidth = 0;
+            int displayHeight = 0;
+            float overfill = 0;
+            float oversample = 0;
+            std::vector<OSVR_ViewportDescription> viewports;
+
+            struct Projections {
+                bool valid = false;
+                double nearClip = 0;
+                double farClip = 0;
+                std::vector<OSVR_ProjectionMatrix> eyes;
+            };
+            /// The most recently used first.
+            std::array<Projections, 2> projections;
+        } m_renderGeometry;
+
+        /// @brief Make the viewports in m_renderGeometry match the current
+        /// state, recomputing them if needed.
+        /// @return True on success, false on failure.
+        bool UpdateRenderViewportsInternal();
+
+        /// @brief Make all of m_renderGeometry match the current state and
+        /// the clipping planes in params, recomputing it if needed.
+        /// @return True on success, false on failure.
+        bool UpdateRenderGeometryInternal(const RenderParams& params);
+
+        /// @brief Timing of the stages of OpenDisplay(), filled in by
+        /// render libraries that schedule it in stages.
+        std::vector<StartupStageTiming> m_startupTiming;
+
+        /// @brief Scheduling applied to the present thread, and which
+        /// thread it was applied to.
+        PresentThreadSchedulingInfo m_presentThreadSchedulingInfo = {};
+        std::thread::id m_presentThreadId;
+
+        /// @brief Apply the presentThread settings to the calling thread,
+        /// unless they have already been applied to a thread.
+        void SchedulePresentThread();
+
+        /// @brief Where to write trace events, or NULL when not tracing.
+        /// Shared with any RenderManager that wraps or is wrapped by this
+        /// one and traces to the same file.
+        std::shared_ptr<TraceWriter> m_trace;
+
+        /// @brief Update the client context, tracing the call.  When
+        /// replaying recorded input, the context is not updated and the
+        /// recorded result is returned instead.
+        OSVR_ReturnCode ClientUpdateInternal();
+
+        /// @brief Records the inputs read from the client context, or
+        /// replays them in its place; NULL when doing neither.
+        std::shared_ptr<InputLog> m_inputLog;
+
+        /// @brief Read the head's (index 0) or a render-callback space's
+        /// (index 1 + space) pose, through the input log if there is one.
+        OSVR_ReturnCode ReadPoseInternal(OSVR_ClientInterface iface,
+                                         size_t index,
+                                         OSVR_TimeValue& timestamp,
+                                         OSVR_PoseState& pose);
+
+        /// @brief Read the head's velocity, through the input log if there
+        /// is one.
+        OSVR_ReturnCode ReadVelocityInternal(OSVR_TimeValue& timestamp,
+                                             OSVR_VelocityState& velocity);
+
+        /// @brief Read an eye's display timing for prediction, through the
+        /// input log if there is one.
+        bool ReadTimingInfoInternal(size_t whichEye, RenderTimingInfo& info);
+
+        /// @brief Read the clock for prediction, through the input log if
+        /// there is one.
+        void ReadNowInternal(OSVR_TimeValue& now);
+
+        /// @brief Timestamp of the head tracker report that
+        /// ConstructModelView() most recently read, if it read one.
+        OSVR_TimeValue m_headPoseTimestamp = {0, 0};
+        bool m_headPoseTimestampValid = false;
+
+        /// @brief Histogram of motion-to-photon latencies that is written
+        /// by the presenting thread and read by others without locking.
+        struct LatencyHistogram {
+            enum { BUCKETS = 256, BUCKET_MICROSECONDS = 250 };
+            std::array<std::atomic<uint64_t>, BUCKETS> counts;
+            std::atomic<uint64_t> samples;
+            std::atomic<uint64_t> sumMicroseconds;
+            std::atomic<uint64_t> maxMicroseconds;
+            void clear();
+            void add(uint64_t microseconds);
+        };
+
+        /// @brief State used to measure motion-to-photon latency.
+        struct LatencyState {
+            enum { POSE_HISTORY = 8 };
+            /// World-space poses recently handed out to be rendered with,
+            /// along with the tracker timestamps they
+            /// came from, so we can tell how old the pose an application
+            /// rendered with was.  Guarded by m_mutex.
+            struct PoseRecord {
+                OSVR_PoseState pose;
+                OSVR_TimeValue timestamp;
+            };
+            std::array<std::array<PoseRecord, POSE_HISTORY>,
+                       FRAME_TIMING_MAX_EYES>
+                poses = {};
+            std::array<size_t, FRAME_TIMING_MAX_EYES> nextPose = {};
+            std::array<std::array<LatencyHistogram, 2>, FRAME_TIMING_MAX_EYES>
+                histograms; //< Indexed by eye and LatencySource
+            OSVR_TimeValue lastLog = {0, 0};
+        } m_latency;
+
+        /// @brief Remember the tracker timestamp of the poses we just
+        /// handed out, if they came from the tracker.
+        void RecordPoseTimestampsInternal(
+            const std::vector<RenderInfo>& renderInfo);
+
+        /// @brief Measure the latency of a frame whose swap just returned.
+        void RecordMotionToPhotonInternal(
+            const std::vector<RenderInfo>& renderInfoUsed //< From the app
+            , bool haveWarpPose //< Was the frame time-warped?
+            , const OSVR_TimeValue& warpPoseTimestamp //< Its pose's report
+            , const OSVR_TimeValue& swapReturn //< When the swap returned
+            );
+
+        /// @brief Print the latency statistics if it is time to.
+        void LogMotionToPhotonInternal(const OSVR_TimeValue& now);
+
+        /// @brief Counts of missed refreshes, which are written by the
+        /// presenting thread and read by others without locking.
+        struct FrameDropState {
+            std::atomic<uint64_t> presents;
+            std::atomic<uint64_t> appMisses;
+            std::atomic<uint64_t> compositorMisses;
+            std::atomic<uint64_t> lateWarps;
+        } m_frameDrops;
+
+        /// @brief Stores frame-drop callback information.  Guarded by
+        /// m_mutex.
+        struct {
+            FrameDropCallback m_callback = nullptr;
+            void* m_userData = nullptr;
+        } m_frameDropCallback;
+
+        /// @brief Work out why the present that just finished, which was
+        /// presented more than a refresh after the one before it, missed
+        /// its retrace, and report it.
+        void ClassifyMissedRetraceInternal(
+            const OSVR_TimeValue& previousPresentDone //< Last swap return
+            );
+
+        /// @brief Count a missed refresh and call the callback.
+        void ReportFrameDropInternal(FrameDropType type, uint64_t frame);
+
+        //=============================================================
+        // GPU timing of the present pass.  Derived classes that can put
+        // timestamps into the GPU's command stream override the
+        // GPUTimer*() methods; PresentRenderBuffersInternal() uses them to
+        // time a few frames in flight at once and reads each one back,
+        // without waiting, on a later frame.  The results go into the
+        // frame-timing history and into the frame-pacing present lead.
+
+        /// @brief Timestamps within one frame's set.  Eye e's draw is
+        /// bracketed by GPU_TIMER_EYE_START + 2*e and the one after it.
+        enum {
+            GPU_TIMER_FRAME_START = 0,
+            GPU_TIMER_FRAME_END = 1,
+            GPU_TIMER_EYE_START = 2,
+            GPU_TIMER_MARKS = GPU_TIMER_EYE_START + 2 * FRAME_TIMING_MAX_EYES
+        };
+
+        /// @brief Number of frames whose timestamps can be in flight.
+        enum { GPU_TIMER_FRAMES = 4 };
+
+        /// @brief Start a set of timestamps, writing the frame-start one.
+        ///  @return False if GPU timing is not available, in which case
+        /// nothing else is called for this frame.
+        virtual bool GPUTimerBegin(size_t /*slot*/) { return false; }
+
+        /// @brief Write one timestamp into the set.
+        virtual void GPUTimerMark(size_t /*slot*/, size_t /*mark*/) {}
+
+        /// @brief Write the frame-end timestamp and close the set.
+        virtual void GPUTimerEnd(size_t /*slot*/) {}
+
+        /// @brief Read back a set if the GPU has finished with it, without
+        /// waiting.  Marks that were not written are not read.
+        ///  @param[out] seconds Times of the marks relative to the frame
+        /// start, filled in when valid is set.
+        ///  @param[out] valid False if the set finished but its results
+        /// could not be used (the GPU clock changed, for example).
+        ///  @return True if the set is finished, false if it is pending.
+        virtual bool GPUTimerRead(size_t /*slot*/, size_t /*numEyes*/,
+                                  double* /*seconds*/, bool& valid) {
+            valid = false;
+            return true;
+        }
+
+        /// @brief Sets of timestamps in flight, oldest at next.
+        struct GPUTimingState {
+            struct Slot {
+                bool pending = false; //< Waiting to be read back?
+                uint64_t frame = 0;   //< Frame-timing record it belongs to
+                size_t numEyes = 0;   //< Eyes that were marked
+            };
+            std::array<Slot, GPU_TIMER_FRAMES> slots;
+            size_t next = 0;      //< Slot the current frame uses
+            bool begun = false;   //< Current frame's set started?
+            bool ended = false;   //< Current frame's set closed?
+            size_t skipped = 0;   //< Frames not timed, all slots pending
+            double presentSeconds = 0; //< Smoothed GPU present pass
+            bool warnedWindow = false; //< Warned about time-warp window?
+        } m_gpuTiming;
+
+        /// @brief Read back any finished sets and start one for this
+        /// frame, if there is a free slot.
+        void BeginGPUTimingInternal();
+
+        /// @brief Mark the start or end of an eye's draw.
+        void MarkGPUTimingInternal(size_t eye, bool end);
+
+        /// @brief Close this frame's set before the buffers are swapped.
+        void EndGPUTimingInternal();
+
+        /// @brief Queue this frame's set for read-back, once its
+        /// frame-timing record has been published.
+        void FinishGPUTimingInternal();
+
+        /// @brief Put read-back GPU times into a frame-timing record.
+        void RecordGPUTimingInternal(const GPUTimingState::Slot& slot,
+                                     const double* seconds);
+
+        //=============================================================
+        // Queued presentation.  When m_params.m_presentQueueDepth is
+        // nonzero (or m_params.m_refreshesPerFrame is above 1) and
+        // QueuedPresentSupported() returns true, the
+        // PresentRenderBuffers() call copies its arguments into a queue
+        // and a presenter thread calls PresentRenderBuffersInternal() on
+        // them.  When rendering at a fraction of the refresh rate, the
+        // presenter thread holds on to the last frame and presents it
+        // again (re-warped) on each refresh until it is superseded.  The
+        // presenter thread holds m_mutex while presenting, except while it
+        // is in PresentDisplayFinalize().  Calls that would change the
+        // state it is presenting from wait until it has it back.  Derived
+        // classes that support this must call StopPresentQueue() at the
+        // start of their destructor.
+
+        /// @brief Can this RenderManager present from the presenter thread?
+        virtual bool QueuedPresentSupported() { return false; }
+
+        /// @brief Called on the presenter thread before its first present,
+        /// to make a graphics context current there, for example.
+        ///  @return True on success, false (and presentation stays on the
+        /// caller's thread) on failure.
+        virtual bool QueuedPresentThreadInitialize() { return true; }
+
+        /// @brief Called on the presenter thread before it exits.
+        virtual void QueuedPresentThreadFinalize() {}
+
+        /// @brief Called on the application's thread when a frame is
+        /// queued, to make sure its rendering into the buffers is complete
+        /// before the presenter thread reads them.
+        ///  @param[out] syncObject Library-specific object that will be
+        /// passed to QueuedPresentWait(); may be left NULL.
+        ///  @return True on success, false on failure.
+        virtual bool QueuedPresentSubmit(void*& syncObject) {
+            syncObject = nullptr;
+            return true;
+        }
+
+        /// @brief Wait for and release a syncObject from
+        /// QueuedPresentSubmit().  Normally called on the presenter thread
+        /// before presenting the frame.
+        ///  @return True on success, false on failure.
+        virtual bool QueuedPresentWait(void* /*syncObject*/) { return true; }
+
+        /// @brief Is the calling thread the presenter thread?
+        bool OnPresentQueueThread();
+
+        /// @brief Stop the presenter thread, if it is running.  Frames
+        /// still in the queue are marked PRESENT_FAILED.
+        void StopPresentQueue();
+
+        /// @brief A frame waiting for the presenter thread.  The pose
+        /// pointers in renderParams point at the copies held here.
+        struct QueuedPresent {
+            PresentToken token = 0;
+            std::vector<RenderBuffer> buffers;
+            std::vector<RenderInfo> renderInfoUsed;
+            RenderParams renderParams;
+            OSVR_PoseState worldFromRoomAppend;
+            OSVR_PoseState roomFromHeadReplace;
+            std::vector<OSVR_ViewportDescription> normalizedCroppingViewports;
+            bool flipInY = false;
+            void* syncObject = nullptr;
+        };
+
+        /// @brief State used by queued presentation, guarded by its own
+        /// mutex so that it is available while a present is happening.
+        struct PresentQueueState {
+            enum {
+                MAX_DEPTH = 3,
+                SLOTS = MAX_DEPTH + 1, //< Room for a held frame too
+                STATUS_HISTORY = 16
+            };
+            std::thread thread;
+            std::thread::id threadId;
+            std::mutex mutex;
+            std::condition_variable changed;
+            std::array<QueuedPresent, SLOTS> frames; //< Ring of frames
+            size_t first = 0;     //< Index of the oldest queued frame
+            size_t count = 0;     //< Number of queued frames
+            bool holding = false; //< Is frames[first] being re-presented?
+            bool running = false; //< Is the presenter thread running?
+            bool failed = false;  //< Should we stop trying to queue?
+            bool quit = false;    //< Tells the presenter thread to exit
+            PresentToken nextToken = 1;
+            PresentToken lastCompleted = 0;
+            PresentToken historyToken[STATUS_HISTORY] = {};
+            bool historySucceeded[STATUS_HISTORY] = {};
+        } m_presentQueue;
+
+        /// @brief Lock on m_mutex held by the presenter thread while it
+        /// presents, so PresentRenderBuffersInternal() can release it
+        /// around the swap.
+        std::unique_lock<std::mutex>* m_presentQueueStateLock = nullptr;
+
+        /// @brief Is the presenter thread re-presenting a held frame?  Set
+        /// while it holds m_mutex.
+        bool m_presentIsRepeat = false;
+
+        /// @brief Has the presenter thread released m_mutex part way
+        /// through a present?  Guarded by m_mutex; m_presentInFlightDone
+        /// is notified when it is cleared.
+        bool m_presentInFlight = false;
+        std::condition_variable m_presentInFlightDone;
+
+        /// @brief Wait until the presenter thread is not part way through
+        /// a present, for calls that change the state it presents from:
+        /// the frame-timing record, the present plan, the time-warp
+        /// matrices and the distortion meshes.
+        ///  @param lock Lock on m_mutex, released while waiting.
+        void WaitForPresentInFlightInternal(std::unique_lock<std::mutex>& lock);
+
+        /// @brief Queue a frame for the presenter thread, starting it if
+        /// needed.
+        ///  @param[out] queued False if the frame should be presented
+        /// synchronously instead, in which case the return value is
+        /// meaningless.
+        bool QueuePresentRenderBuffersInternal(
+            const std::vector<RenderBuffer>& buffers,
+            const std::vector<RenderInfo>& renderInfoUsed,
+            const RenderParams& renderParams,
+            const std::vector<OSVR_ViewportDescription>&
+                normalizedCroppingViewports,
+            bool flipInY, PresentToken* token, bool& queued);
+
+        /// @brief Body of the presenter thread.
+        void PresentQueueThreadInternal();
+
+        /// @brief Record the outcome of a present.  Call with
+        /// m_presentQueue.mutex locked.
+        void CompletePresentInternal(PresentToken token, bool succeeded);
+
+        /// @brief Adjust the dynamic resolution scale given how long the
+        /// most-recent frame kept us busy.
+        void UpdateDynamicResolutionInternal(
+            double busySeconds //< App render time plus present cost
+            , bool missedRetrace //< Did the frame miss a retrace?
+            );
+
         //=============================================================
         // These methods are helper methods for the Render* callback
         // functions below, making it easy for them to compute the
@@ -1144,13 +2174,14 @@ namespace renderkit {
           /// Constructor, provided the list of points it is to use.
           /// Fills in the acceleration structure so that calls to
           /// interpolate will be faster.
-          /// @param points Unstructured mesh points to use for interpolation
+          /// @param points Unstructured mesh points to use for
+          ///        interpolation, shared rather than copied.
           /// @param numSamplesX Optional parameter describing the size of
           ///        the acceleration mesh structure.
           /// @param numSamplesY Optional parameter describing the size of
           ///        the acceleration mesh structure.
           UnstructuredMeshInterpolator(
-            const MonoPointDistortionMeshDescription& points,
+            MonoPointDistortionMeshSamplesPtr points,
             int numSamplesX = 20,
             int numSamplesY = 20
           );
@@ -1167,21 +2198,24 @@ namespace renderkit {
 
         protected:
 
-          /// Return the three nearest non-collinear points in the
-          /// unstructured mesh description passed in.  If there are
-          /// not three such points, can return fewer.
+          /// Find the three nearest non-collinear points in the
+          /// unstructured mesh, among those listed in candidates (or among
+          /// all of them if candidates is null).  If there are not three
+          /// such points, can find fewer.
           /// @param xN Normalized texture coordinate in X
           /// @param yN Normalized texture coordinate in Y
-          /// @param points Vector of points to search in.
-          /// @return vector of up to three points.
-          MonoPointDistortionMeshDescription getNearestPoints(
+          /// @param candidates Indices of the points to search in.
+          /// @param nearest [out] Indices of the points found.
+          /// @return How many points were found, up to three.
+          size_t getNearestPoints(
             float xN, float yN,
-            const MonoPointDistortionMeshDescription &points);
+            const std::vector<uint32_t>* candidates,
+            uint32_t nearest[3]);
 
-          const MonoPointDistortionMeshDescription m_points;
+          const MonoPointDistortionMeshSamplesPtr m_points;
 
-          /// Structure to store points from the m_points array
-          /// in a regular mesh covering the range of
+          /// Structure to store the indices of points from the m_points
+          /// array in a regular mesh covering the range of
           /// normalized texture coordinates from (0,0) to (1,1).
           ///  It is filled by the constructor and is used by the
           /// interpolator to hopefully provide a fast way to get
@@ -1191,9 +2225,14 @@ namespace renderkit {
           /// searched.
           std::vector<    // Range in X
             std::vector<  // Range in Y
-              MonoPointDistortionMeshDescription //< Points
+              std::vector<uint32_t> //< Point indices
             >
           > m_grid;
+
+          /// Distance and index of each point searched, reused between
+          /// searches so that they don't allocate.
+          std::vector<std::pair<double, uint32_t> > m_byDistance;
+
           int m_numSamplesX = 0; //< Size of the grid in X
           int m_numSamplesY = 0; //< Size of the grid in Y
 
@@ -1247,7 +2286,7 @@ namespace renderkit {
         Float2 DistortionCorrectTextureCoordinate(
             size_t eye //< Eye this relates to
             , Float2 const& inCoords //< Coordinates to modify
-            , DistortionParameters distort //< Distortion parameters
+            , DistortionParameters const& distort //< Distortion parameters
             , size_t color //< 0 = red, 1 = green, 2 = blue
             );
 
@@ -1298,9 +2337,69 @@ namespace renderkit {
         DistortionMesh ComputeDistortionMesh(
             size_t eye //< Which eye?
             , DistortionMeshType type //< Type of mesh to produce
-            , DistortionParameters distort //< Distortion parameters
+            , DistortionParameters const& distort //< Distortion parameters
+            );
+
+        /// @brief Compute a mesh for each eye.
+        /// @return False if any of them could not be made.
+        bool ComputeDistortionMeshes(
+            DistortionMeshType type //< Type of mesh to produce
+            ,
+            std::vector<DistortionParameters> const&
+                distort //< Distortion parameters
+            ,
+            std::vector<DistortionMesh>& meshes //< Filled in, one per eye
+            );
+
+        /// @brief Can SetDistortionMeshesInternal() be used?  Back ends that
+        /// can have their meshes built in the background override both.
+        virtual bool SetDistortionMeshesSupported() { return false; }
+
+        /// @brief Install distortion meshes that have already been computed,
+        /// one per eye, in place of the current ones.
+        virtual bool SetDistortionMeshesInternal(
+            std::vector<DistortionMesh> const& /*meshes*/) {
+            return false;
+        }
+
+        /// @brief Make the distortion meshes, as UpdateDistortionMeshes()
+        /// does, but on a background thread if the constructor parameters
+        /// ask for that and the back end supports it.  Derived-class
+        /// OpenDisplay() methods call this.
+        ///  When the meshes are built in the background, each eye first gets
+        /// an undistorted two-triangle mesh if fallback is true (or keeps
+        /// the mesh it has if not), until SwapInBackgroundDistortionMeshes()
+        /// installs the finished ones.
+        bool BuildDistortionMeshesInternal(
+            DistortionMeshType type //< Type of mesh to produce
+            ,
+            std::vector<DistortionParameters> const&
+                distort //< Distortion parameters
+            ,
+            bool fallback //< Install an undistorted mesh meanwhile?
             );
 
+        /// @brief Install the meshes built in the background, if they are
+        /// done.  Called at the start of each presented frame, so that the
+        /// swap happens on a frame boundary.
+        void SwapInBackgroundDistortionMeshes();
+
+        /// @brief Wait for any background mesh build to finish and discard
+        /// its meshes.  Derived classes that build meshes in the background
+        /// must call this at the start of their destructors.
+        void StopBackgroundDistortionMeshes();
+
+        /// Distortion meshes being built in the background.  The thread
+        /// owns everything but the thread object until done is set; the
+        /// mesh-building state in the base class (m_interpolators) is also
+        /// the thread's while it runs.
+        struct BackgroundMeshState {
+            std::thread thread;
+            std::atomic<bool> done;
+            bool succeeded = false;
+            std::vector<DistortionMesh> meshes;
+        } m_backgroundMeshes;
+
         //=============================================================
         // These methods must be implemented by all derived classes.
         //  They enable the Render() method above to do the generic work
@@ -1382,6 +2481,23 @@ namespace renderkit {
         PresentDisplayInitialize(size_t display //< Which display (0-indexed)
                                  ) = 0;
 
+        /// @brief What presenting an eye needs that does not change from
+        /// frame to frame.  These are computed by
+        /// UpdatePresentPlanInternal() when the display or the cropping
+        /// viewport changes, rather than by every PresentEye() call.
+        struct PresentEyePlan {
+            /// rotate_180 for the eye plus the display scan-out rotation.
+            double rotateDegrees = 0;
+            /// ConstructViewportForPresent() adjusted by RotateViewport().
+            OSVR_ViewportDescription viewport = {};
+            /// ComputeDisplayOrientationMatrix() for rotateDegrees.
+            matrix16 orientation = {};
+            /// Normalized cropping viewport and the
+            /// ComputeRenderBufferCropMatrix() for it.
+            OSVR_ViewportDescription crop = {};
+            matrix16 cropMatrix = {};
+        };
+
         /// @brief Initialize presentation for a specified eye
         /// @todo add time shear parameters
         class PresentEyeParameters {
@@ -1393,6 +2509,7 @@ namespace renderkit {
                 m_buffer.D3D11 = nullptr;
                 m_buffer.OpenGL = nullptr;
                 m_timeWarp = nullptr;
+                m_plan = nullptr;
             }
 
             size_t m_index;         //< Which eye (0-indexed)
@@ -1410,9 +2527,29 @@ namespace renderkit {
             OSVR_ViewportDescription m_normalizedCroppingViewport;
             matrix16* m_timeWarp; //< Time Warp matrix to use (nullptr
             // for none)
+            /// Precomputed state for this eye, matching the above.
+            const PresentEyePlan* m_plan;
         };
         virtual bool PresentEye(PresentEyeParameters params) = 0;
 
+        /// @brief Per-eye present plans, recomputed whenever any of the
+        /// values they were computed from (stored here) changes.  Each
+        /// eye's crop matrix is recomputed on its own when its cropping
+        /// viewport changes.
+        struct PresentPlanState {
+            bool valid = false;
+            size_t numEyes = 0;
+            int displayWidth = 0;
+            int displayHeight = 0;
+            bool flipInY = false;
+            std::vector<PresentEyePlan> eyes;
+        } m_presentPlan;
+
+        /// @brief Make m_presentPlan match the current state, recomputing
+        /// it if needed.
+        /// @return True on success, false on failure.
+        bool UpdatePresentPlanInternal(bool flipInY);
+
         /// @brief Set the specified eye to the specified color
         /// @param eye[in] The eye to set.
         /// @param color[in] The color to set, RGB, 0-1 for each.
@@ -1431,7 +2568,8 @@ namespace renderkit {
         friend RenderManager OSVR_RENDERMANAGER_EXPORT*
         createRenderManager(OSVR_ClientContext context,
                             const std::string& renderLibraryName,
-                            GraphicsLibrary graphicsLibrary);
+                            GraphicsLibrary graphicsLibrary,
+                            double connectTimeoutSeconds);
     };
 
     //=========================================================================
@@ -1455,7 +2593,9 @@ namespace renderkit {
     /// is responsible for constructing and destroying both the object pointed
     /// to and the appropriate pointer within it.
     ///   This function hangs until it receives configuration information from
-    /// a running server connected to by an OSVR context that it creates.
+    /// a running server connected to by an OSVR context that it creates,
+    /// or for at most the number of seconds in the
+    /// OSVR_RENDERMANAGER_CONNECT_TIMEOUT environment variable, if set.
     /// @param core Whether to use the OpenGL Core profile. Has no effect when
     /// Not using the OpenGL graphicsLibrary
     /// @return Pointer to a created object or nullptr if it cannot create one
@@ -1465,6 +2605,20 @@ namespace renderkit {
                         const std::string& renderLibraryName,
                         GraphicsLibrary graphicsLibrary = GraphicsLibrary());
 
+    /// @brief Factory to create an appropriate RenderManager, giving up on
+    /// the server after a time.
+    ///
+    /// As above, but if the configuration has not arrived from the server
+    /// within connectTimeoutSeconds (0 to wait as long as it takes), this
+    /// returns nullptr.  The OSVR_RENDERMANAGER_CONNECT_TIMEOUT environment
+    /// variable, if set, overrides connectTimeoutSeconds, so that a kiosk
+    /// or test machine can be given a limit without rebuilding.
+    RenderManager OSVR_RENDERMANAGER_EXPORT*
+    createRenderManager(OSVR_ClientContext context,
+                        const std::string& renderLibraryName,
+                        GraphicsLibrary graphicsLibrary,
+                        double connectTimeoutSeconds);
+
     //=========================================================================
     /// C API for the RenderManager (will be in a separate file).
     /// @todo
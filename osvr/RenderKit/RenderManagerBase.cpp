@@ -47,6 +47,15 @@ Russ Taylor <russ@sensics.com>
 #include "RenderManagerOpenGL.h"
 #endif
 
+#ifdef RM_USE_OPENGL_EGL
+#include "RenderManagerOpenGLOffscreen.h"
+#endif
+
+#include "RenderManagerNull.h"
+#include "RenderManagerSoftware.h"
+#include "RenderManagerThreadScheduling.h"
+#include "RenderManagerTrace.h"
+#include "RenderManagerInputLog.h"
 #include "VendorIdTools.h"
 
 // OSVR Includes
@@ -78,6 +87,8 @@ Russ Taylor <russ@sensics.com>
 #include <memory>
 #include <map>
 #include <algorithm>
+#include <cmath>
+#include <cstdlib>
 
 
 // @todo Consider pulling this function into Core.
@@ -251,6 +262,29 @@ static void OSVR_from_q(OSVR_PoseState& pose, const q_xyz_quat_type& xform) {
     osvrQuatSetW(&pose.rotation, xform.quat[Q_W]);
 }
 
+/// @brief Offset a time value by a (possibly negative) number of seconds.
+static OSVR_TimeValue offsetTimeValue(const OSVR_TimeValue& base,
+                                      double seconds) {
+    OSVR_TimeValue offset;
+    double whole = std::floor(seconds);
+    offset.seconds = static_cast<OSVR_TimeValue_Seconds>(whole);
+    offset.microseconds =
+        static_cast<OSVR_TimeValue_Microseconds>((seconds - whole) * 1e6);
+    OSVR_TimeValue ret = base;
+    osvrTimeValueSum(&ret, &offset);
+    return ret;
+}
+
+/// @brief Exponentially smooth a running estimate, seeding it if empty.
+static void smoothEstimate(double& estimate, double sample,
+                           double weight = 0.1) {
+    if (estimate <= 0) {
+        estimate = sample;
+    } else {
+        estimate += weight * (sample - estimate);
+    }
+}
+
 namespace osvr {
 namespace renderkit {
 
@@ -266,6 +300,7 @@ namespace renderkit {
         // list above, so we don't get warnings about out-of-order
         // initialization if they are re-ordered in the header file.
         m_params = p;
+        m_backgroundMeshes.done = false;
 
         /// Clear the callback for display, so it will
         /// not be present until set
@@ -300,6 +335,93 @@ namespace renderkit {
 
         // We haven't yet registered our render buffers, so can't present them
         m_renderBuffersRegistered = false;
+
+        // Start tracing if we've been asked to.  Failing to open the trace
+        // file is reported but is not fatal.
+        if (!m_params.m_traceFile.empty()) {
+            m_trace = TraceWriter::Open(m_params.m_traceFile);
+        }
+
+        // Record or replay our inputs if we've been asked to.  A log that
+        // can't be opened is reported but is not fatal.
+        if (!m_params.m_recordInputFile.empty()) {
+            m_inputLog =
+                InputLog::OpenForRecording(m_params.m_recordInputFile);
+        } else if (!m_params.m_replayInputFile.empty()) {
+            m_inputLog = InputLog::OpenForReplay(m_params.m_replayInputFile);
+        }
+
+        // Start with empty latency histograms and frame-drop counts.
+        ResetMotionToPhotonLatency();
+        ResetFrameDropStats();
+    }
+
+    /// @brief The input-log stream that reads on this thread belong to.
+    static InputLog::Stream inputStream(bool onPresentThread) {
+        return onPresentThread ? InputLog::PRESENT_STREAM
+                               : InputLog::APPLICATION_STREAM;
+    }
+
+    OSVR_ReturnCode RenderManager::ClientUpdateInternal() {
+        OSVR_ReturnCode ret = OSVR_RETURN_SUCCESS;
+        if (!m_inputLog || !m_inputLog->Replaying()) {
+            TraceScope trace(m_trace.get(), "osvrClientUpdate");
+            ret = osvrClientUpdate(m_context);
+        }
+        if (m_inputLog &&
+            !m_inputLog->ClientUpdate(inputStream(OnPresentQueueThread()),
+                                      ret)) {
+            // The replay has finished.
+            return OSVR_RETURN_FAILURE;
+        }
+        return ret;
+    }
+
+    OSVR_ReturnCode RenderManager::ReadPoseInternal(OSVR_ClientInterface iface,
+                                                    size_t index,
+                                                    OSVR_TimeValue& timestamp,
+                                                    OSVR_PoseState& pose) {
+        OSVR_ReturnCode ret = OSVR_RETURN_FAILURE;
+        if (!m_inputLog || !m_inputLog->Replaying()) {
+            ret = osvrGetPoseState(iface, &timestamp, &pose);
+        }
+        if (m_inputLog) {
+            m_inputLog->Pose(inputStream(OnPresentQueueThread()), index, ret,
+                             timestamp, pose);
+        }
+        return ret;
+    }
+
+    OSVR_ReturnCode
+    RenderManager::ReadVelocityInternal(OSVR_TimeValue& timestamp,
+                                        OSVR_VelocityState& velocity) {
+        OSVR_ReturnCode ret = OSVR_RETURN_FAILURE;
+        if (!m_inputLog || !m_inputLog->Replaying()) {
+            ret = osvrGetVelocityState(m_roomFromHeadInterface, &timestamp,
+                                       &velocity);
+        }
+        if (m_inputLog) {
+            m_inputLog->Velocity(inputStream(OnPresentQueueThread()), ret,
+                                 timestamp, velocity);
+        }
+        return ret;
+    }
+
+    bool RenderManager::ReadTimingInfoInternal(size_t whichEye,
+                                               RenderTimingInfo& info) {
+        bool ret = GetTimingInfo(whichEye, info);
+        if (m_inputLog) {
+            m_inputLog->TimingInfo(inputStream(OnPresentQueueThread()),
+                                   whichEye, ret, info);
+        }
+        return ret;
+    }
+
+    void RenderManager::ReadNowInternal(OSVR_TimeValue& now) {
+        osvrTimeValueGetNow(&now);
+        if (m_inputLog) {
+            m_inputLog->Now(inputStream(OnPresentQueueThread()), now);
+        }
     }
 
     bool RenderManager::SetDisplayCallback(DisplayCallback callback,
@@ -420,6 +542,11 @@ namespace renderkit {
     }
 
     RenderManager::~RenderManager() {
+        // Derived classes that present from a queue or build meshes in the
+        // background should already have stopped them, while their graphics
+        // state was still around.
+        StopPresentQueue();
+        StopBackgroundDistortionMeshes();
 
         // Unregister any remaining callback handlers for devices that
         // are set to update our transformation matrices.
@@ -438,8 +565,11 @@ namespace renderkit {
 
     bool RenderManager::Render(const RenderParams& params) {
         // All public methods that use internal state should be guarded
-        // by a mutex.
-        std::lock_guard<std::mutex> lock(m_mutex);
+        // by a mutex.  Rendering presents, so it also has to wait for the
+        // presenter thread.
+        std::unique_lock<std::mutex> lock(m_mutex);
+        WaitForPresentInFlightInternal(lock);
+        TraceScope trace(m_trace.get(), "Render");
 
         // Make sure we're doing okay.
         if (!doingOkay()) {
@@ -460,7 +590,7 @@ namespace renderkit {
 
         // Update the transformations so that we have the most-recent
         // state in them.
-        if (osvrClientUpdate(m_context) == OSVR_RETURN_FAILURE) {
+        if (ClientUpdateInternal() == OSVR_RETURN_FAILURE) {
             std::cerr
                 << "RenderManager::Render(): client context update failed."
                 << std::endl;
@@ -469,7 +599,8 @@ namespace renderkit {
 
         // Read the transformations
         m_renderParamsForRender = params;
-        m_renderInfoForRender = GetRenderInfoInternal(params);
+        GetRenderInfoInternal(params, m_renderInfoForRender);
+        RecordPoseTimestampsInternal(m_renderInfoForRender);
 
         // Initialize the rendering for the whole frame.
         if (!RenderFrameInitialize()) {
@@ -497,6 +628,7 @@ namespace renderkit {
 
                 // Figure out which overall eye this is.
                 size_t eye = eyeInDisplay + display * GetNumEyesPerDisplay();
+                TraceScope traceEye(m_trace.get(), "RenderEye");
 
                 // Initialize the projection matrix and viewport.
                 // Then call any user callback to handle whatever else
@@ -567,13 +699,23 @@ namespace renderkit {
             }
         }
 
+        // The application's rendering is done once the frame is being
+        // finalized, which is where the results are presented.
+        if (m_framePacing.inFrame && !m_framePacing.presentedInFrame) {
+            osvrTimeValueGetNow(&m_framePacing.presentEntry);
+            m_framePacing.presentedInFrame = true;
+        }
+
         // Finalize the rendering for the whole frame.
-        if (!RenderFrameFinalize()) {
-            return false;
+        {
+            TraceScope traceFinalize(m_trace.get(), "RenderFrameFinalize");
+            if (!RenderFrameFinalize()) {
+                return false;
+            }
         }
 
-        // Keep track of the timing information.
-        /// @todo
+        // The timing information for the frame was recorded when it was
+        // presented by RenderFrameFinalize().
 
         return true;
     }
@@ -587,7 +729,8 @@ namespace renderkit {
     }
 
     size_t RenderManager::LatchRenderInfoInternal(const RenderParams& params) {
-      m_latchedRenderInfo = GetRenderInfoInternal(params);
+      GetRenderInfoInternal(params, m_latchedRenderInfo);
+      RecordPoseTimestampsInternal(m_latchedRenderInfo);
       return m_latchedRenderInfo.size();
     }
 
@@ -603,56 +746,79 @@ namespace renderkit {
         return ret;
     }
 
-    std::vector<RenderInfo>
-    RenderManager::GetRenderInfoInternal(const RenderParams& params) {
+    size_t RenderManager::GetRenderInfo(const RenderParams& params,
+                                        std::vector<RenderInfo>& info) {
+        // All public methods that use internal state should be guarded
+        // by a mutex.
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        LatchRenderInfoInternal(params);
+        info.assign(m_latchedRenderInfo.begin(), m_latchedRenderInfo.end());
+        return info.size();
+    }
+
+    bool RenderManager::GetRenderInfoInternal(const RenderParams& requested,
+                                              std::vector<RenderInfo>& ret) {
         // Start with an empty vector, which will be returned as such on
-        // failure.
-        std::vector<RenderInfo> ret;
+        // failure.  Clearing it keeps its storage for re-use.
+        ret.clear();
+
+        // Record the parameters we were asked to use, or replace them
+        // with recorded ones.
+        RenderParams params = requested;
+        if (m_inputLog &&
+            !m_inputLog->Params(inputStream(OnPresentQueueThread()),
+                                params)) {
+            return false;
+        }
 
         // Make sure we're doing okay.
         if (!doingOkay()) {
             std::cerr << "RenderManager::GetRenderInfo(): Display not opened."
                       << std::endl;
             ret.clear();
-            return ret;
+            return false;
         }
 
         // Update the transformations so that we have the most-recent
         // state in them.
-        if (osvrClientUpdate(m_context) == OSVR_RETURN_FAILURE) {
+        if (ClientUpdateInternal() == OSVR_RETURN_FAILURE) {
             std::cerr << "RenderManager::GetRenderInfo(): client context "
                          "update failed."
                       << std::endl;
             ret.clear();
-            return ret;
+            return false;
+        }
+
+        // Get the viewports and projections, which are only recomputed
+        // when something they depend on has changed.
+        if (!UpdateRenderGeometryInternal(params)) {
+            ret.clear();
+            return false;
         }
 
         // Determine parameters for each eye, filling in all relevant
         // parameters.
-        size_t numEyes = GetNumEyes();
+        size_t numEyes = m_renderGeometry.numEyes;
+        ret.reserve(numEyes);
         for (size_t eye = 0; eye < numEyes; eye++) {
             RenderInfo info;
             info.library = m_library;
 
-            // Compute the viewport.
-            // NOTE: The viewport needs to start at 0 and include the
-            // overfill border on all sides because this is the user's
-            // RenderTexture we are describing, not the final output
-            // screen.
-            OSVR_ViewportDescription v;
-            if (!ConstructViewportForRender(eye, v)) {
-                ret.clear();
-                return ret;
+            // The viewport.
+            OSVR_ViewportDescription v = m_renderGeometry.viewports[eye];
+
+            // Shrink the viewport if we're using dynamic resolution.  The
+            // buffer remains the full size and PresentRenderBuffers() crops
+            // to the part that was rendered.
+            if (m_dynamicResolution.scale < 1.0f) {
+                v.width = std::floor(v.width * m_dynamicResolution.scale);
+                v.height = std::floor(v.height * m_dynamicResolution.scale);
             }
             info.viewport = v;
 
-            // Construct the projection matrix.
-            if (!ConstructProjection(eye, params.nearClipDistanceMeters,
-                                     params.farClipDistanceMeters,
-                                     info.projection)) {
-                ret.clear();
-                return ret;
-            }
+            // The projection matrix.
+            info.projection = m_renderGeometry.projections[0].eyes[eye];
 
             // Construct a ModelView transform for world space.
             // By passing m_callbacks.size(), we guarantee world space.
@@ -662,14 +828,159 @@ namespace renderkit {
                              "ConstructModelView"
                           << std::endl;
                 ret.clear();
-                return ret;
+                return false;
             }
 
             // Add this to the list of eyes to be rendered.
             ret.push_back(info);
         }
 
-        return ret;
+        return true;
+    }
+
+    bool RenderManager::UpdateRenderViewportsInternal() {
+        RenderGeometryCache& g = m_renderGeometry;
+        size_t numEyes = GetNumEyes();
+        if (g.viewportsValid && g.numEyes == numEyes &&
+            g.displayWidth == m_displayWidth &&
+            g.displayHeight == m_displayHeight &&
+            g.overfill == m_params.m_renderOverfillFactor &&
+            g.oversample == m_params.m_renderOversampleFactor) {
+            return true;
+        }
+
+        // Whatever changed may change the projections too.
+        g.viewportsValid = false;
+        for (auto& projections : g.projections) {
+            projections.valid = false;
+        }
+        g.viewports.resize(numEyes);
+        for (size_t eye = 0; eye < numEyes; eye++) {
+            // NOTE: The viewport needs to start at 0 and include the
+            // overfill border on all sides because this is the user's
+            // RenderTexture we are describing, not the final output
+            // screen.
+            if (!ConstructViewportForRender(eye, g.viewports[eye])) {
+                return false;
+            }
+        }
+        g.numEyes = numEyes;
+        g.displayWidth = m_displayWidth;
+        g.displayHeight = m_displayHeight;
+        g.overfill = m_params.m_renderOverfillFactor;
+        g.oversample = m_params.m_renderOversampleFactor;
+        g.viewportsValid = true;
+        return true;
+    }
+
+    bool RenderManager::UpdateRenderGeometryInternal(
+        const RenderParams& params) {
+        if (!UpdateRenderViewportsInternal()) {
+            return false;
+        }
+        // Use whichever set of projections was made for these clipping
+        // planes, moving it to the front, or else replace the one used
+        // longest ago.  Swapping the sets does not allocate.
+        RenderGeometryCache& g = m_renderGeometry;
+        for (size_t i = 0; i < g.projections.size(); i++) {
+            RenderGeometryCache::Projections& p = g.projections[i];
+            if (p.valid && p.nearClip == params.nearClipDistanceMeters &&
+                p.farClip == params.farClipDistanceMeters) {
+                if (i != 0) {
+                    std::swap(g.projections[0], p);
+                }
+                return true;
+            }
+        }
+
+        std::swap(g.projections[0], g.projections[1]);
+        RenderGeometryCache::Projections& p = g.projections[0];
+        p.valid = false;
+        p.eyes.resize(g.numEyes);
+        for (size_t eye = 0; eye < g.numEyes; eye++) {
+            if (!ConstructProjection(eye, params.nearClipDistanceMeters,
+                                     params.farClipDistanceMeters,
+                                     p.eyes[eye])) {
+                return false;
+            }
+        }
+        p.nearClip = params.nearClipDistanceMeters;
+        p.farClip = params.farClipDistanceMeters;
+        p.valid = true;
+        return true;
+    }
+
+    bool RenderManager::UpdatePresentPlanInternal(bool flipInY) {
+        PresentPlanState& plan = m_presentPlan;
+        size_t numEyes = GetNumEyes();
+        if (plan.valid && plan.numEyes == numEyes &&
+            plan.displayWidth == m_displayWidth &&
+            plan.displayHeight == m_displayHeight &&
+            plan.flipInY == flipInY) {
+            return true;
+        }
+
+        plan.valid = false;
+        plan.eyes.resize(numEyes);
+        for (size_t eye = 0; eye < numEyes; eye++) {
+            PresentEyePlan& e = plan.eyes[eye];
+
+            // See if we need to rotate by 90 or 180 degrees about Z.  If
+            // so, do so
+            // NOTE: This would adjust the distortion center of projection,
+            // but it is assumed that we're doing this to make scan-out
+            // circuitry behave rather than to change where the actual pixel
+            // location of the center of projection is.
+            e.rotateDegrees = 0;
+            if (m_params.m_displayConfiguration.getEyes()[eye].m_rotate180 !=
+                0) {
+                e.rotateDegrees = 180;
+            }
+
+            // If we have display scan-out rotation, we add it to the amount
+            // of rotation we've already been asked to do.
+            switch (m_params.m_displayRotation) {
+            case ConstructorParameters::Display_Rotation::Ninety:
+                e.rotateDegrees += 90.0;
+                break;
+            case ConstructorParameters::Display_Rotation::OneEighty:
+                e.rotateDegrees += 180.0;
+                break;
+            case ConstructorParameters::Display_Rotation::TwoSeventy:
+                e.rotateDegrees += 270.0;
+                break;
+            default:
+                // Nothing to do here.
+                break;
+            }
+
+            // The viewport on the display, adjusted for how much the
+            // display is rotated with respect to the rendering window.
+            OSVR_ViewportDescription v;
+            if (!ConstructViewportForPresent(
+                    eye, v, m_params.m_displayConfiguration.getSwapEyes())) {
+                return false;
+            }
+            e.viewport = RotateViewport(v);
+
+            if (!ComputeDisplayOrientationMatrix(
+                    static_cast<float>(e.rotateDegrees), flipInY,
+                    e.orientation)) {
+                return false;
+            }
+
+            // Start with the full buffer; PresentRenderBuffersInternal()
+            // updates this if it is asked to crop.
+            e.crop.left = e.crop.lower = 0;
+            e.crop.width = e.crop.height = 1;
+            ComputeRenderBufferCropMatrix(e.crop, e.cropMatrix);
+        }
+        plan.numEyes = numEyes;
+        plan.displayWidth = m_displayWidth;
+        plan.displayHeight = m_displayHeight;
+        plan.flipInY = flipInY;
+        plan.valid = true;
+        return true;
     }
 
     bool RenderManager::RegisterRenderBuffers(
@@ -696,14 +1007,402 @@ namespace renderkit {
         const RenderParams& renderParams,
         const std::vector<OSVR_ViewportDescription>&
             normalizedCroppingViewports,
-        bool flipInY) {
-        // All public methods that use internal state should be guarded
-        // by a mutex.
-        std::lock_guard<std::mutex> lock(m_mutex);
+        bool flipInY, PresentToken* token) {
+        // Hand the frame to the presenter thread if we're queueing, which
+        // we also need to do to render at a fraction of the refresh rate.
+        if ((m_params.m_presentQueueDepth > 0) ||
+            (m_params.m_refreshesPerFrame > 1)) {
+            bool queued;
+            bool ret = QueuePresentRenderBuffersInternal(
+                buffers, renderInfoUsed, renderParams,
+                normalizedCroppingViewports, flipInY, token, queued);
+            if (queued) {
+                return ret;
+            }
+        }
+
+        bool ret;
+        {
+            // All public methods that use internal state should be guarded
+            // by a mutex.
+            std::unique_lock<std::mutex> lock(m_mutex);
+            WaitForPresentInFlightInternal(lock);
+
+            // Record when the application handed us its frame for pacing.
+            if (m_framePacing.inFrame && !m_framePacing.presentedInFrame) {
+                osvrTimeValueGetNow(&m_framePacing.presentEntry);
+                m_framePacing.presentedInFrame = true;
+            }
+
+            ret = PresentRenderBuffersInternal(buffers, renderInfoUsed,
+                                               renderParams,
+                                               normalizedCroppingViewports,
+                                               flipInY);
+        }
+
+        // The frame is already done, so its token is complete.
+        std::lock_guard<std::mutex> lock(m_presentQueue.mutex);
+        PresentToken myToken = m_presentQueue.nextToken++;
+        CompletePresentInternal(myToken, ret);
+        if (token) {
+            *token = myToken;
+        }
+        return ret;
+    }
+
+    PresentStatus RenderManager::GetPresentStatus(PresentToken token) {
+        // This uses only the queue state, so it has its own mutex.
+        std::lock_guard<std::mutex> lock(m_presentQueue.mutex);
+
+        if ((token == 0) || (token >= m_presentQueue.nextToken)) {
+            return PRESENT_UNKNOWN;
+        }
+        if (token > m_presentQueue.lastCompleted) {
+            return PRESENT_PENDING;
+        }
+        size_t i = token % PresentQueueState::STATUS_HISTORY;
+        if (m_presentQueue.historyToken[i] != token) {
+            return PRESENT_UNKNOWN;
+        }
+        return m_presentQueue.historySucceeded[i] ? PRESENT_SUCCEEDED
+                                                  : PRESENT_FAILED;
+    }
+
+    PresentStatus RenderManager::WaitForPresent(PresentToken token) {
+        {
+            std::unique_lock<std::mutex> lock(m_presentQueue.mutex);
+            m_presentQueue.changed.wait(lock, [&] {
+                return (token >= m_presentQueue.nextToken) ||
+                       (token <= m_presentQueue.lastCompleted);
+            });
+        }
+        return GetPresentStatus(token);
+    }
+
+    void RenderManager::CompletePresentInternal(PresentToken token,
+                                                bool succeeded) {
+        size_t i = token % PresentQueueState::STATUS_HISTORY;
+        m_presentQueue.historyToken[i] = token;
+        m_presentQueue.historySucceeded[i] = succeeded;
+        m_presentQueue.lastCompleted = token;
+    }
+
+    void RenderManager::WaitForPresentInFlightInternal(
+        std::unique_lock<std::mutex>& lock) {
+        // The presenter thread itself never has to wait for this.
+        if (m_presentInFlight && !OnPresentQueueThread()) {
+            m_presentInFlightDone.wait(lock,
+                                       [this] { return !m_presentInFlight; });
+        }
+    }
+
+    bool RenderManager::OnPresentQueueThread() {
+        std::lock_guard<std::mutex> lock(m_presentQueue.mutex);
+        return m_presentQueue.running &&
+               (std::this_thread::get_id() == m_presentQueue.threadId);
+    }
+
+    bool RenderManager::QueuePresentRenderBuffersInternal(
+        const std::vector<RenderBuffer>& buffers,
+        const std::vector<RenderInfo>& renderInfoUsed,
+        const RenderParams& renderParams,
+        const std::vector<OSVR_ViewportDescription>&
+            normalizedCroppingViewports,
+        bool flipInY, PresentToken* token, bool& queued) {
+        queued = false;
+        {
+            std::lock_guard<std::mutex> lock(m_presentQueue.mutex);
+            if (m_presentQueue.failed) {
+                return false;
+            }
+        }
+
+        // Check our state and have the graphics library make sure the
+        // buffers will be ready before the presenter thread reads them.
+        void* syncObject = nullptr;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (!QueuedPresentSupported()) {
+                std::cerr << "RenderManager::PresentRenderBuffers(): Queued "
+                             "presentation not supported by this "
+                             "RenderManager, presenting synchronously."
+                          << std::endl;
+                if (m_params.m_refreshesPerFrame > 1) {
+                    std::cerr << "RenderManager::PresentRenderBuffers(): "
+                                 "Rendering at full rate; use asynchronous "
+                                 "time warp to re-present frames instead."
+                              << std::endl;
+                }
+                std::lock_guard<std::mutex> qlock(m_presentQueue.mutex);
+                m_presentQueue.failed = true;
+                return false;
+            }
+            queued = true;
+            if (!doingOkay()) {
+                std::cerr << "RenderManager::PresentRenderBuffers(): Display "
+                             "not opened."
+                          << std::endl;
+                return false;
+            }
+            if (!m_renderBuffersRegistered) {
+                std::cerr << "RenderManager::PresentRenderBuffers(): Buffers "
+                             "not registered."
+                          << std::endl;
+                return false;
+            }
+            if (m_framePacing.inFrame && !m_framePacing.presentedInFrame) {
+                osvrTimeValueGetNow(&m_framePacing.presentEntry);
+                m_framePacing.presentedInFrame = true;
+            }
+            if (!QueuedPresentSubmit(syncObject)) {
+                std::cerr << "RenderManager::PresentRenderBuffers(): Could "
+                             "not submit frame to the present queue."
+                          << std::endl;
+                return false;
+            }
+        }
+
+        std::unique_lock<std::mutex> lock(m_presentQueue.mutex);
+
+        // Start the presenter thread the first time through and wait to
+        // hear whether it could get ready to present.
+        if (!m_presentQueue.running) {
+            if (m_presentQueue.thread.joinable()) {
+                m_presentQueue.thread.join();
+            }
+            m_presentQueue.quit = false;
+            m_presentQueue.thread =
+                std::thread(&RenderManager::PresentQueueThreadInternal, this);
+            m_presentQueue.changed.wait(lock, [this] {
+                return m_presentQueue.running || m_presentQueue.failed;
+            });
+            if (!m_presentQueue.running) {
+                m_presentQueue.thread.join();
+                lock.unlock();
+                std::cerr << "RenderManager::PresentRenderBuffers(): Could "
+                             "not start present thread, presenting "
+                             "synchronously."
+                          << std::endl;
+                QueuedPresentWait(syncObject);
+                queued = false;
+                return false;
+            }
+        }
+
+        // Wait for room in the queue.  A frame that the presenter thread
+        // is holding on to for re-presentation does not count against the
+        // depth.
+        size_t depth = std::min<size_t>(
+            std::max(m_params.m_presentQueueDepth, 1u),
+            PresentQueueState::MAX_DEPTH);
+        m_presentQueue.changed.wait(lock, [&] {
+            size_t waiting =
+                m_presentQueue.count - (m_presentQueue.holding ? 1 : 0);
+            return (waiting < depth) || !m_presentQueue.running;
+        });
+        if (!m_presentQueue.running) {
+            lock.unlock();
+            QueuedPresentWait(syncObject);
+            return false;
+        }
+
+        // Copy the frame into the next free slot.  Assigning into the
+        // vectors re-uses their storage from earlier frames.
+        size_t slot = (m_presentQueue.first + m_presentQueue.count) %
+                      PresentQueueState::SLOTS;
+        QueuedPresent& frame = m_presentQueue.frames[slot];
+        frame.token = m_presentQueue.nextToken++;
+        frame.buffers.assign(buffers.begin(), buffers.end());
+        frame.renderInfoUsed.assign(renderInfoUsed.begin(),
+                                    renderInfoUsed.end());
+        frame.renderParams = renderParams;
+        if (renderParams.worldFromRoomAppend) {
+            frame.worldFromRoomAppend = *renderParams.worldFromRoomAppend;
+            frame.renderParams.worldFromRoomAppend = &frame.worldFromRoomAppend;
+        }
+        if (renderParams.roomFromHeadReplace) {
+            frame.roomFromHeadReplace = *renderParams.roomFromHeadReplace;
+            frame.renderParams.roomFromHeadReplace = &frame.roomFromHeadReplace;
+        }
+        frame.normalizedCroppingViewports.assign(
+            normalizedCroppingViewports.begin(),
+            normalizedCroppingViewports.end());
+        frame.flipInY = flipInY;
+        frame.syncObject = syncObject;
+        m_presentQueue.count++;
+        if (token) {
+            *token = frame.token;
+        }
+        m_presentQueue.changed.notify_all();
+        return true;
+    }
+
+    void RenderManager::SchedulePresentThread() {
+        // Only the first thread to present gets the settings, so that they
+        // do not move back and forth between threads.
+        if (m_presentThreadId != std::thread::id()) {
+            return;
+        }
+        m_presentThreadId = std::this_thread::get_id();
+        if (!PresentThreadSchedulingRequested(m_params)) {
+            return;
+        }
+        ApplyPresentThreadScheduling(m_params, m_presentThreadSchedulingInfo);
+        const PresentThreadSchedulingInfo& info =
+            m_presentThreadSchedulingInfo;
+        std::cerr << "RenderManager::SchedulePresentThread(): Present "
+                     "thread scheduling: ";
+        if (info.realTime) {
+            std::cerr << "real-time priority " << info.priority;
+        } else if (info.niceApplied) {
+            std::cerr << "nice " << info.nice;
+        } else {
+            std::cerr << "default";
+        }
+        std::cerr << ", pinned to " << info.pinnedCPUs << " CPU(s), "
+                  << info.lockedBytes << " bytes locked" << std::endl;
+    }
+
+    void RenderManager::PresentQueueThreadInternal() {
+        bool ready = QueuedPresentThreadInitialize();
+        // This is done before we say we're running, which the thread that
+        // started us waits for, so it is never racing a present.
+        if (ready) {
+            SchedulePresentThread();
+        }
+        {
+            std::lock_guard<std::mutex> lock(m_presentQueue.mutex);
+            m_presentQueue.threadId = std::this_thread::get_id();
+            m_presentQueue.running = ready;
+            m_presentQueue.failed = !ready;
+        }
+        m_presentQueue.changed.notify_all();
+        if (!ready) {
+            return;
+        }
+
+        // Figure out how many refreshes to show each frame for.  Without
+        // vertical sync, re-presenting would just spin as fast as it can.
+        unsigned refreshes = std::max(m_params.m_refreshesPerFrame, 1u);
+        if ((refreshes > 1) && !m_params.m_verticalSync) {
+            std::cerr << "RenderManager::PresentQueueThreadInternal(): "
+                         "refreshesPerFrame requires vertical sync, "
+                         "presenting each frame once."
+                      << std::endl;
+            refreshes = 1;
+        }
+        unsigned phase = 0; // Refresh phase of the next present
+        bool heldSucceeded = false;
+
+        while (true) {
+            // Wait for a frame.  It stays in its slot until we're done
+            // with it, which keeps the application from re-using the slot.
+            QueuedPresent* frame;
+            bool quit;
+            bool repeat;
+            {
+                std::unique_lock<std::mutex> lock(m_presentQueue.mutex);
+                m_presentQueue.changed.wait(lock, [this] {
+                    return m_presentQueue.quit || (m_presentQueue.count > 0);
+                });
+                if (m_presentQueue.count == 0) {
+                    break;
+                }
+
+                // Let go of a held frame when it has been shown for all of
+                // its refreshes and the next one is waiting; otherwise show
+                // it again.  A late frame waits for the next frame boundary
+                // so that the ratio stays locked.
+                if (m_presentQueue.holding &&
+                    (m_presentQueue.quit ||
+                     ((phase == 0) && (m_presentQueue.count > 1)))) {
+                    CompletePresentInternal(
+                        m_presentQueue.frames[m_presentQueue.first].token,
+                        heldSucceeded);
+                    m_presentQueue.first =
+                        (m_presentQueue.first + 1) % PresentQueueState::SLOTS;
+                    m_presentQueue.count--;
+                    m_presentQueue.holding = false;
+                    lock.unlock();
+                    m_presentQueue.changed.notify_all();
+                    continue;
+                }
+                frame = &m_presentQueue.frames[m_presentQueue.first];
+                quit = m_presentQueue.quit;
+                repeat = m_presentQueue.holding;
+            }
+
+            // Present it, unless we're shutting down, in which case we
+            // only release it.  New frames always start a frame period.
+            bool ret = true;
+            if (!repeat) {
+                ret = QueuedPresentWait(frame->syncObject);
+                frame->syncObject = nullptr;
+                phase = 0;
+            }
+            if (quit) {
+                ret = false;
+            } else if (ret) {
+                std::unique_lock<std::mutex> stateLock(m_mutex);
+                m_presentQueueStateLock = &stateLock;
+                m_presentIsRepeat = repeat;
+                ret = PresentRenderBuffersInternal(
+                    frame->buffers, frame->renderInfoUsed, frame->renderParams,
+                    frame->normalizedCroppingViewports, frame->flipInY);
+                m_presentIsRepeat = false;
+                m_presentQueueStateLock = nullptr;
+
+                // Tell frame pacing where we are in the frame period.
+                m_framePacing.refreshesPerFrame = refreshes;
+                m_framePacing.presentPhase = phase;
+
+                // Showing the old frame again at a frame boundary means
+                // that the application's next frame did not arrive in time.
+                if (ret && repeat && (phase == 0)) {
+                    ReportFrameDropInternal(FRAME_DROP_APP,
+                                            m_frameTiming.frames - 1);
+                }
+            }
+            phase = (phase + 1) % refreshes;
+
+            // Hold on to a newly-presented frame if we'll show it again.
+            // Complete the others, including a held frame that we could
+            // not re-present.
+            {
+                std::lock_guard<std::mutex> lock(m_presentQueue.mutex);
+                if (!repeat && ret && (refreshes > 1)) {
+                    m_presentQueue.holding = true;
+                    heldSucceeded = true;
+                } else if (!repeat || !ret) {
+                    CompletePresentInternal(frame->token,
+                                            repeat ? heldSucceeded : ret);
+                    m_presentQueue.first =
+                        (m_presentQueue.first + 1) % PresentQueueState::SLOTS;
+                    m_presentQueue.count--;
+                    m_presentQueue.holding = false;
+                }
+            }
+            m_presentQueue.changed.notify_all();
+        }
+
+        QueuedPresentThreadFinalize();
+        {
+            std::lock_guard<std::mutex> lock(m_presentQueue.mutex);
+            m_presentQueue.running = false;
+        }
+        m_presentQueue.changed.notify_all();
+    }
 
-        return PresentRenderBuffersInternal(
-            buffers, renderInfoUsed, renderParams, normalizedCroppingViewports,
-            flipInY);
+    void RenderManager::StopPresentQueue() {
+        {
+            std::lock_guard<std::mutex> lock(m_presentQueue.mutex);
+            if (!m_presentQueue.thread.joinable()) {
+                return;
+            }
+            m_presentQueue.quit = true;
+        }
+        m_presentQueue.changed.notify_all();
+        m_presentQueue.thread.join();
     }
 
     bool RenderManager::PresentRenderBuffersInternal(
@@ -713,6 +1412,8 @@ namespace renderkit {
         const std::vector<OSVR_ViewportDescription>&
                                        normalizedCroppingViewports,
         bool flipInY) {
+        TraceScope trace(m_trace.get(), "PresentRenderBuffers");
+
         // Make sure we're doing okay.
         if (!doingOkay()) {
             std::cerr
@@ -729,6 +1430,26 @@ namespace renderkit {
             return false;
         }
 
+        // The presenter thread has its scheduling set when it starts.  An
+        // application thread that presents for itself only has its
+        // scheduling changed if that was asked for.
+        if (m_params.m_presentThreadApplyToCaller && !OnPresentQueueThread()) {
+            SchedulePresentThread();
+        }
+
+        // Keep track of how long we take, not counting the time we spend
+        // waiting for vsync, so that frame pacing knows our present cost.
+        OSVR_TimeValue presentStart;
+        osvrTimeValueGetNow(&presentStart);
+        double waitSeconds = 0;
+        OSVR_TimeValue waitStart, waitEnd;
+
+        // Start the timing record for this present.
+        FrameTimingRecord& timing = m_frameTiming.current;
+        timing = FrameTimingRecord();
+        timing.repeat = m_presentIsRepeat;
+        timing.presentEntry = presentStart;
+
         // Initialize the presentation for the whole frame.
         if (!PresentFrameInitialize()) {
             std::cerr << "RenderManager::PresentRenderBuffers(): "
@@ -736,6 +1457,7 @@ namespace renderkit {
                       << std::endl;
             return false;
         }
+        SwapInBackgroundDistortionMeshes();
 
         // If we're doing Time Warp and we have a positive maximum
         // milliseconds until vsync, and we are able to read the timing
@@ -756,6 +1478,11 @@ namespace renderkit {
             threshold.microseconds =
                 static_cast<OSVR_TimeValue_Microseconds>(thresholdF * 1e6);
 
+            // The client updates in this loop are covered by the wait's
+            // trace event rather than traced one by one, because there
+            // can be hundreds of them.
+            TraceScope traceWait(m_trace.get(), "VsyncWait");
+            osvrTimeValueGetNow(&waitStart);
             bool proceed;
             do {
                 // Go ahead unless something stops us.
@@ -788,22 +1515,49 @@ namespace renderkit {
 
                 ++count;
             } while (!proceed);
+            osvrTimeValueGetNow(&waitEnd);
+            waitSeconds += osvrTimeValueDurationSeconds(&waitEnd, &waitStart);
         }
+        osvrTimeValueGetNow(&timing.vsyncWaitExit);
 
         // Use the current and previous parameters to construct info
-        // needed to perform Time Warp.
-        std::vector<RenderInfo> currentRenderInfo =
-            GetRenderInfoInternal(renderParams);
-        // @todo make the depth for time warp a parameter?
-        if (m_params.m_enableTimeWarp) {
-            if (!ComputeAsynchronousTimeWarps(renderInfoUsed, currentRenderInfo,
-                                              2.0f)) {
-                std::cerr << "RenderManager::PresentRenderBuffers: Could not "
-                             "compute time warps"
-                          << std::endl;
-                return false;
+        // needed to perform Time Warp.  Keep track of how old the tracker
+        // report behind the time-warp pose is, for latency measurement.
+        bool haveWarpPose = false;
+        OSVR_TimeValue warpPoseTimestamp = {0, 0};
+        {
+            TraceScope traceWarp(m_trace.get(), "ComputeTimeWarps");
+            if (m_params.m_enableTimeWarp) {
+                osvrTimeValueGetNow(&timing.poseLatch);
+            }
+            GetRenderInfoInternal(renderParams, m_presentRenderInfo);
+            haveWarpPose =
+                m_params.m_enableTimeWarp && m_headPoseTimestampValid;
+            warpPoseTimestamp = m_headPoseTimestamp;
+            // @todo make the depth for time warp a parameter?
+            if (m_params.m_enableTimeWarp) {
+                if (!ComputeAsynchronousTimeWarps(renderInfoUsed,
+                                                  m_presentRenderInfo, 2.0f)) {
+                    std::cerr << "RenderManager::PresentRenderBuffers: Could "
+                                 "not compute time warps"
+                              << std::endl;
+                    return false;
+                }
             }
         }
+        osvrTimeValueGetNow(&timing.warpComputed);
+
+        // Get what doesn't change from frame to frame about presenting
+        // each eye.
+        if (!UpdatePresentPlanInternal(flipInY)) {
+            std::cerr << "RenderManager::PresentRenderBuffers(): Could not "
+                         "construct present plan"
+                      << std::endl;
+            return false;
+        }
+        // Only the viewports are needed here; the projections depend on
+        // clipping planes that need not match the application's.
+        bool haveRenderViewports = UpdateRenderViewportsInternal();
 
         // Render into each display, setting up the display beforehand and
         // finalizing it after.
@@ -816,6 +1570,9 @@ namespace renderkit {
                           << std::endl;
                 return false;
             }
+            if (display == 0) {
+                BeginGPUTimingInternal();
+            }
 
             // Render for each eye, setting up the appropriate projection
             // and viewport.
@@ -829,43 +1586,10 @@ namespace renderkit {
                 /// head velocity to the transform.  Probably in
                 /// the RenderParams structure passed in.
 
-                // See if we need to rotate by 90 or 180 degrees about Z.  If
-                // so, do so
-                // NOTE: This would adjust the distortion center of projection,
-                // but it is
-                // assumed that we're doing this to make scan-out circuitry
-                // behave
-                // rather than to change where the actual pixel location of the
-                // center
-                // of projection is.
-                float rotate_pixels_degrees = 0;
-                if (m_params.m_displayConfiguration.getEyes()[eye]
-                        .m_rotate180 != 0) {
-                    rotate_pixels_degrees = 180;
-                }
-
-                // If we have display scan-out rotation, we add it to the amount
-                // of
-                // rotation we've already been asked to do.
-                switch (m_params.m_displayRotation) {
-                case ConstructorParameters::Display_Rotation::Ninety:
-                    rotate_pixels_degrees += 90.0;
-                    break;
-                case ConstructorParameters::Display_Rotation::OneEighty:
-                    rotate_pixels_degrees += 180.0;
-                    break;
-                case ConstructorParameters::Display_Rotation::TwoSeventy:
-                    rotate_pixels_degrees += 270.0;
-                    break;
-                default:
-                    // Nothing to do here.
-                    break;
-                }
-
-                /// Pass rotate_pixels_degrees
+                PresentEyePlan& plan = m_presentPlan.eyes[eye];
                 PresentEyeParameters p;
                 p.m_index = eye;
-                p.m_rotateDegrees = rotate_pixels_degrees;
+                p.m_rotateDegrees = plan.rotateDegrees;
                 if (buffers.size() <= eye) {
                     std::cerr << "RenderManager::PresentRenderBuffers: Given "
                               << GetNumEyes() << " eyes, but only "
@@ -903,35 +1627,138 @@ namespace renderkit {
                     bufferCrop.width = 1;
                     bufferCrop.height = 1;
                 }
+
+                // If the application rendered into a viewport smaller than
+                // the full render size (as happens with dynamic resolution),
+                // only the part of the eye's region starting at its origin
+                // holds the image, so we crop further to just that part.
+                if (haveRenderViewports && (eye < renderInfoUsed.size()) &&
+                    (eye < m_renderGeometry.numEyes) &&
+                    (m_renderGeometry.viewports[eye].width > 0) &&
+                    (m_renderGeometry.viewports[eye].height > 0)) {
+                    const OSVR_ViewportDescription& fullViewport =
+                        m_renderGeometry.viewports[eye];
+                    const OSVR_ViewportDescription& used =
+                        renderInfoUsed[eye].viewport;
+                    if ((used.width > 0) && (used.width < fullViewport.width)) {
+                        bufferCrop.width *= used.width / fullViewport.width;
+                    }
+                    if ((used.height > 0) &&
+                        (used.height < fullViewport.height)) {
+                        bufferCrop.height *=
+                            used.height / fullViewport.height;
+                    }
+                }
                 p.m_normalizedCroppingViewport = bufferCrop;
 
+                // Only recompute the crop matrix when the crop changes.
+                if ((bufferCrop.left != plan.crop.left) ||
+                    (bufferCrop.lower != plan.crop.lower) ||
+                    (bufferCrop.width != plan.crop.width) ||
+                    (bufferCrop.height != plan.crop.height)) {
+                    plan.crop = bufferCrop;
+                    ComputeRenderBufferCropMatrix(plan.crop, plan.cropMatrix);
+                }
+                p.m_plan = &plan;
+
+                OSVR_TimeValue submitStart;
+                osvrTimeValueGetNow(&submitStart);
+                TraceScope traceEye(m_trace.get(), "PresentEye");
+                MarkGPUTimingInternal(eye, false);
                 if (!PresentEye(p)) {
                     std::cerr << "RenderManager::PresentRenderBuffers(): "
                                  "PresentEye failed."
                               << std::endl;
                     return false;
                 }
+                MarkGPUTimingInternal(eye, true);
+                if (eye < FRAME_TIMING_MAX_EYES) {
+                    timing.eyeSubmitStart[eye] = submitStart;
+                    osvrTimeValueGetNow(&timing.eyeSubmitEnd[eye]);
+                    timing.numEyes = std::max(timing.numEyes, eye + 1);
+                }
             }
 
-            // We're done with this display.
-            if (!PresentDisplayFinalize(display)) {
+            // We're done with this display.  This is where buffers are
+            // swapped, which may block waiting for vsync.  The presenter
+            // thread lets the application at our state while it waits,
+            // except for the state this present is still using.
+            if (display + 1 == GetNumDisplays()) {
+                EndGPUTimingInternal();
+            }
+            osvrTimeValueGetNow(&waitStart);
+            std::unique_lock<std::mutex>* stateLock = nullptr;
+            if (m_presentQueueStateLock && OnPresentQueueThread()) {
+                stateLock = m_presentQueueStateLock;
+                m_presentInFlight = true;
+                stateLock->unlock();
+            }
+            bool finalized;
+            {
+                TraceScope traceSwap(m_trace.get(), "PresentDisplayFinalize");
+                finalized = PresentDisplayFinalize(display);
+            }
+            if (stateLock) {
+                stateLock->lock();
+                m_presentInFlight = false;
+                m_presentInFlightDone.notify_all();
+            }
+            if (!finalized) {
                 std::cerr << "RenderManager::PresentRenderBuffers(): "
                              "PresentDisplayFinalize failed."
                           << std::endl;
                 return false;
             }
+            osvrTimeValueGetNow(&waitEnd);
+            waitSeconds += osvrTimeValueDurationSeconds(&waitEnd, &waitStart);
         }
 
         // Finalize the rendering for the whole frame.
-        if (!PresentFrameFinalize()) {
+        osvrTimeValueGetNow(&waitStart);
+        bool frameFinalized;
+        {
+            TraceScope traceFinalize(m_trace.get(), "PresentFrameFinalize");
+            frameFinalized = PresentFrameFinalize();
+        }
+        if (!frameFinalized) {
             std::cerr << "RenderManager::PresentRenderBuffers(): "
                          "PresentFrameFinalize failed."
                       << std::endl;
             return false;
         }
-
-        // Keep track of the timing information.
-        /// @todo
+        osvrTimeValueGetNow(&waitEnd);
+        waitSeconds += osvrTimeValueDurationSeconds(&waitEnd, &waitStart);
+        timing.swapReturn = waitEnd;
+        PublishFrameTimingInternal();
+        FinishGPUTimingInternal();
+        RecordMotionToPhotonInternal(renderInfoUsed, haveWarpPose,
+                                     warpPoseTimestamp, waitEnd);
+        LogMotionToPhotonInternal(waitEnd);
+
+        // Keep track of the timing information.  The application was busy
+        // from the end of the previous present until this one started, or
+        // for its measured render time if it is using frame pacing.
+        double appSeconds = 0;
+        if (m_framePacing.framesPaced > 0) {
+            appSeconds = m_framePacing.renderSeconds;
+        } else if (m_framePacing.lastPresentDone.seconds != 0) {
+            appSeconds = osvrTimeValueDurationSeconds(
+                &presentStart, &m_framePacing.lastPresentDone);
+        }
+        double presentSeconds =
+            osvrTimeValueDurationSeconds(&waitEnd, &presentStart) -
+            waitSeconds;
+        OSVR_TimeValue previousPresentDone = m_framePacing.lastPresentDone;
+        bool missedRetrace =
+            RecordPresentTimingInternal(waitEnd, presentSeconds);
+        m_frameDrops.presents++;
+        if (missedRetrace) {
+            ClassifyMissedRetraceInternal(previousPresentDone);
+        }
+        if (!m_presentIsRepeat) {
+            UpdateDynamicResolutionInternal(appSeconds + presentSeconds,
+                                            missedRetrace);
+        }
 
         return true;
     }
@@ -940,7 +1767,8 @@ namespace renderkit {
         const RGBColorf &color) {
       // All public methods that use internal state should be guarded
       // by a mutex.
-      std::lock_guard<std::mutex> lock(m_mutex);
+      std::unique_lock<std::mutex> lock(m_mutex);
+      WaitForPresentInFlightInternal(lock);
 
       return PresentSolidColorInternal(color);
     }
@@ -962,6 +1790,7 @@ namespace renderkit {
           << std::endl;
         return false;
       }
+      SwapInBackgroundDistortionMeshes();
 
       // Render into each display, setting up the display beforehand and
       // finalizing it after.
@@ -980,35 +1809,963 @@ namespace renderkit {
         for (size_t eyeInDisplay = 0; eyeInDisplay < GetNumEyesPerDisplay();
           eyeInDisplay++) {
 
-          // Figure out which overall eye this is.
-          size_t eye = eyeInDisplay + display * GetNumEyesPerDisplay();
+          // Figure out which overall eye this is.
+          size_t eye = eyeInDisplay + display * GetNumEyesPerDisplay();
+
+          if (!SolidColorEye(eye, color)) {
+            std::cerr << "RenderManager::PresentSolidColorInternal(): "
+              "PresentEye failed."
+              << std::endl;
+            return false;
+          }
+        }
+
+        // We're done with this display.
+        if (!PresentDisplayFinalize(display)) {
+          std::cerr << "RenderManager::PresentSolidColorInternal(): "
+            "PresentDisplayFinalize failed."
+            << std::endl;
+          return false;
+        }
+      }
+
+      // Finalize the rendering for the whole frame.
+      if (!PresentFrameFinalize()) {
+        std::cerr << "RenderManager::PresentSolidColorInternal(): "
+          "PresentFrameFinalize failed."
+          << std::endl;
+        return false;
+      }
+
+      return true;
+    }
+
+    bool RenderManager::WaitForNextFrameStart() {
+        OSVR_TimeValue wakeTime;
+        {
+            // All public methods that use internal state should be guarded
+            // by a mutex.  We release it before sleeping so that other
+            // threads can use us while we wait.
+            std::lock_guard<std::mutex> lock(m_mutex);
+
+            OSVR_TimeValue now;
+            osvrTimeValueGetNow(&now);
+            OSVR_TimeValue nextRetrace;
+            double interval;
+            if (!GetNextFrameRetraceInternal(now, nextRetrace, interval)) {
+                // We don't know when the display refreshes yet, so we
+                // can't do any better than starting right away.
+                m_framePacing.havePendingRetrace = false;
+                return true;
+            }
+
+            // Figure out how long before the retrace the application needs
+            // to start to have its frame in our hands in time, including
+            // a margin for variation in its render time.  If we can't make
+            // the next retrace, aim for the first one that we can make.
+            double lead = m_framePacing.renderSeconds +
+                          2 * m_framePacing.renderDeviation +
+                          FramePresentLeadSecondsInternal();
+            while (osvrTimeValueDurationSeconds(&nextRetrace, &now) < lead) {
+                nextRetrace = offsetTimeValue(nextRetrace, interval);
+            }
+            m_framePacing.pendingRetrace = nextRetrace;
+            m_framePacing.havePendingRetrace = true;
+            wakeTime = offsetTimeValue(nextRetrace, -lead);
+        }
+
+        // Sleep until shortly before the wake time and then yield until it
+        // arrives, because sleeps are only accurate to about a millisecond
+        // on some platforms.
+        OSVR_TimeValue now;
+        osvrTimeValueGetNow(&now);
+        double remaining = osvrTimeValueDurationSeconds(&wakeTime, &now);
+        if (remaining > 2e-3) {
+            std::this_thread::sleep_for(std::chrono::microseconds(
+                static_cast<long long>((remaining - 2e-3) * 1e6)));
+        }
+        do {
+            std::this_thread::yield();
+            osvrTimeValueGetNow(&now);
+        } while (osvrTimeValueGreater(&wakeTime, &now));
+
+        return true;
+    }
+
+    bool RenderManager::BeginFrame() {
+        // All public methods that use internal state should be guarded
+        // by a mutex.
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        OSVR_TimeValue now;
+        osvrTimeValueGetNow(&now);
+        m_framePacing.frameBegin = now;
+        m_framePacing.inFrame = true;
+        m_framePacing.presentedInFrame = false;
+
+        // Use the retrace that WaitForNextFrameStart() aimed for, if it was
+        // called.  Otherwise, aim for the first one we can still make.
+        if (m_framePacing.havePendingRetrace) {
+            m_framePacing.targetRetrace = m_framePacing.pendingRetrace;
+            m_framePacing.haveTargetRetrace = true;
+            m_framePacing.havePendingRetrace = false;
+        } else {
+            OSVR_TimeValue nextRetrace;
+            double interval;
+            m_framePacing.haveTargetRetrace =
+                GetNextFrameRetraceInternal(now, nextRetrace, interval);
+            if (m_framePacing.haveTargetRetrace) {
+                double lead = m_framePacing.renderSeconds +
+                              FramePresentLeadSecondsInternal();
+                while (osvrTimeValueDurationSeconds(&nextRetrace, &now) <
+                       lead) {
+                    nextRetrace = offsetTimeValue(nextRetrace, interval);
+                }
+                m_framePacing.targetRetrace = nextRetrace;
+            }
+        }
+        return true;
+    }
+
+    bool RenderManager::EndFrame() {
+        // All public methods that use internal state should be guarded
+        // by a mutex.
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        if (!m_framePacing.inFrame) {
+            std::cerr << "RenderManager::EndFrame(): Called without a "
+                         "matching BeginFrame()"
+                      << std::endl;
+            return false;
+        }
+        m_framePacing.inFrame = false;
+
+        // The application's part of the frame ends when it hands the frame
+        // to us, so we don't count our own present time against it.  If it
+        // never presented, we count the whole frame.
+        OSVR_TimeValue handOff;
+        if (m_framePacing.presentedInFrame) {
+            handOff = m_framePacing.presentEntry;
+        } else {
+            osvrTimeValueGetNow(&handOff);
+        }
+        double rendered = osvrTimeValueDurationSeconds(
+            &handOff, &m_framePacing.frameBegin);
+        if (m_framePacing.framesPaced > 0) {
+            smoothEstimate(m_framePacing.renderDeviation,
+                           std::abs(rendered - m_framePacing.renderSeconds));
+        }
+        smoothEstimate(m_framePacing.renderSeconds, rendered);
+        if (m_trace) {
+            m_trace->AddEvent("ApplicationFrame", m_framePacing.frameBegin,
+                              handOff);
+        }
+        m_framePacing.framesPaced++;
+
+        // See whether the frame arrived in time to make its retrace.
+        m_framePacing.lastFrameMissedDeadline = false;
+        if (m_framePacing.haveTargetRetrace) {
+            OSVR_TimeValue deadline =
+                offsetTimeValue(m_framePacing.targetRetrace,
+                                -FramePresentLeadSecondsInternal());
+            if (osvrTimeValueGreater(&handOff, &deadline)) {
+                m_framePacing.lastFrameMissedDeadline = true;
+                m_framePacing.missedDeadlines++;
+            }
+        }
+        m_framePacing.haveTargetRetrace = false;
+        return true;
+    }
+
+    bool RenderManager::GetFramePacingInfo(FramePacingInfo& info) {
+        // All public methods that use internal state should be guarded
+        // by a mutex.
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        info.estimatedRenderSeconds = m_framePacing.renderSeconds;
+        info.estimatedPresentSeconds = m_framePacing.presentSeconds;
+        info.refreshIntervalSeconds = 0;
+        OSVR_TimeValue now, nextRetrace;
+        osvrTimeValueGetNow(&now);
+        double interval;
+        if (GetNextRetraceInternal(now, nextRetrace, interval)) {
+            info.refreshIntervalSeconds = interval;
+        }
+        info.refreshesPerFrame = m_framePacing.refreshesPerFrame;
+        info.framesPaced = m_framePacing.framesPaced;
+        info.missedDeadlines = m_framePacing.missedDeadlines;
+        info.lastFrameMissedDeadline = m_framePacing.lastFrameMissedDeadline;
+        return true;
+    }
+
+    void RenderManager::PublishFrameTimingInternal() {
+        std::lock_guard<std::mutex> lock(m_frameTiming.mutex);
+        FrameTimingRecord& record = m_frameTiming.records[m_frameTiming.next];
+        record = m_frameTiming.current;
+        record.frame = m_frameTiming.frames++;
+        m_frameTiming.next =
+            (m_frameTiming.next + 1) % FrameTimingState::HISTORY;
+        m_frameTiming.count = std::min<size_t>(m_frameTiming.count + 1,
+                                               FrameTimingState::HISTORY);
+    }
+
+    /// @brief Copy a frame-timing record into an array of them.
+    static void copyFrameTimingRecord(void* userData, size_t index,
+                                      const FrameTimingRecord& record) {
+        static_cast<FrameTimingRecord*>(userData)[index] = record;
+    }
+
+    bool RenderManager::GetFrameTimingRecords(FrameTimingRecord* records,
+                                              size_t maxRecords,
+                                              size_t& numRecords) {
+        if ((maxRecords > 0) && (records == nullptr)) {
+            std::cerr << "RenderManager::GetFrameTimingRecords(): NULL "
+                         "records array"
+                      << std::endl;
+            numRecords = 0;
+            return false;
+        }
+        return GetFrameTimingRecords(copyFrameTimingRecord, records,
+                                     maxRecords, numRecords);
+    }
+
+    bool RenderManager::GetFrameTimingRecords(
+        FrameTimingRecordCallback callback, void* userData, size_t maxRecords,
+        size_t& numRecords) {
+        // This uses only the timing history, so it has its own mutex.
+        std::lock_guard<std::mutex> lock(m_frameTiming.mutex);
+
+        numRecords = std::min(maxRecords, m_frameTiming.count);
+        if ((numRecords > 0) && (callback == nullptr)) {
+            std::cerr << "RenderManager::GetFrameTimingRecords(): NULL "
+                         "callback"
+                      << std::endl;
+            numRecords = 0;
+            return false;
+        }
+        size_t start = m_frameTiming.next + FrameTimingState::HISTORY -
+                       numRecords;
+        for (size_t i = 0; i < numRecords; i++) {
+            callback(userData, i,
+                     m_frameTiming.records[(start + i) %
+                                           FrameTimingState::HISTORY]);
+        }
+        return true;
+    }
+
+    /// @brief Fill in the percentiles of the first count values, which are
+    /// reordered in the process.
+    static void computePercentiles(double* values, size_t count,
+                                   FrameTimingPercentiles& out) {
+        out = FrameTimingPercentiles();
+        if (count == 0) {
+            return;
+        }
+        auto percentile = [&](double fraction) {
+            size_t i = static_cast<size_t>(fraction * (count - 1) + 0.5);
+            std::nth_element(values, values + i, values + count);
+            return values[i];
+        };
+        out.p50 = percentile(0.50);
+        out.p90 = percentile(0.90);
+        out.p99 = percentile(0.99);
+        out.max = *std::max_element(values, values + count);
+    }
+
+    bool RenderManager::GetFrameTimingStats(FrameTimingStats& stats) {
+        // Copy out the durations while holding the history's mutex and
+        // sort them after we let it go.
+        enum { PRESENT, WAIT, WARP, SUBMIT, SWAP, POSE, GPU, STAGES };
+        std::array<std::array<double, FrameTimingState::HISTORY>, STAGES>
+            durations;
+        std::array<size_t, STAGES> counts = {};
+        size_t frames;
+        {
+            std::lock_guard<std::mutex> lock(m_frameTiming.mutex);
+            frames = m_frameTiming.count;
+            for (size_t i = 0; i < frames; i++) {
+                const FrameTimingRecord& r = m_frameTiming.records[i];
+                durations[PRESENT][counts[PRESENT]++] =
+                    osvrTimeValueDurationSeconds(&r.swapReturn,
+                                                 &r.presentEntry);
+                durations[WAIT][counts[WAIT]++] = osvrTimeValueDurationSeconds(
+                    &r.vsyncWaitExit, &r.presentEntry);
+                durations[WARP][counts[WARP]++] = osvrTimeValueDurationSeconds(
+                    &r.warpComputed, &r.vsyncWaitExit);
+                if (r.numEyes > 0) {
+                    durations[SUBMIT][counts[SUBMIT]++] =
+                        osvrTimeValueDurationSeconds(
+                            &r.eyeSubmitEnd[r.numEyes - 1],
+                            &r.eyeSubmitStart[0]);
+                    durations[SWAP][counts[SWAP]++] =
+                        osvrTimeValueDurationSeconds(
+                            &r.swapReturn, &r.eyeSubmitEnd[r.numEyes - 1]);
+                }
+                if (r.poseLatch.seconds != 0) {
+                    durations[POSE][counts[POSE]++] =
+                        osvrTimeValueDurationSeconds(&r.swapReturn,
+                                                     &r.poseLatch);
+                }
+                if (r.gpuPresentSeconds > 0) {
+                    durations[GPU][counts[GPU]++] = r.gpuPresentSeconds;
+                }
+            }
+        }
+
+        stats = FrameTimingStats();
+        stats.frames = frames;
+        if (frames == 0) {
+            return false;
+        }
+        computePercentiles(durations[PRESENT].data(), counts[PRESENT],
+                           stats.presentSeconds);
+        computePercentiles(durations[WAIT].data(), counts[WAIT],
+                           stats.vsyncWaitSeconds);
+        computePercentiles(durations[WARP].data(), counts[WARP],
+                           stats.warpSeconds);
+        computePercentiles(durations[SUBMIT].data(), counts[SUBMIT],
+                           stats.submitSeconds);
+        computePercentiles(durations[SWAP].data(), counts[SWAP],
+                           stats.swapSeconds);
+        computePercentiles(durations[POSE].data(), counts[POSE],
+                           stats.poseToSwapSeconds);
+        computePercentiles(durations[GPU].data(), counts[GPU],
+                           stats.gpuPresentSeconds);
+        return true;
+    }
+
+    void RenderManager::BeginGPUTimingInternal() {
+        GPUTimingState& g = m_gpuTiming;
+        g.begun = false;
+        g.ended = false;
+
+        // Sets finish in the order they were started, so we read them
+        // oldest first and stop at the first one the GPU hasn't finished.
+        std::array<double, GPU_TIMER_MARKS> seconds;
+        for (size_t i = 0; i < GPU_TIMER_FRAMES; i++) {
+            size_t index = (g.next + i) % GPU_TIMER_FRAMES;
+            GPUTimingState::Slot& slot = g.slots[index];
+            if (!slot.pending) {
+                continue;
+            }
+            bool valid = false;
+            if (!GPUTimerRead(index, slot.numEyes, seconds.data(), valid)) {
+                break;
+            }
+            slot.pending = false;
+            if (valid) {
+                RecordGPUTimingInternal(slot, seconds.data());
+            }
+        }
+
+        // If the GPU is so far behind that every set is still in flight,
+        // we skip timing this frame rather than wait for it.
+        GPUTimingState::Slot& slot = g.slots[g.next];
+        if (slot.pending) {
+            g.skipped++;
+            return;
+        }
+        if (!GPUTimerBegin(g.next)) {
+            return;
+        }
+        g.begun = true;
+        slot.frame = m_frameTiming.frames;
+        slot.numEyes = 0;
+    }
+
+    void RenderManager::MarkGPUTimingInternal(size_t eye, bool end) {
+        GPUTimingState& g = m_gpuTiming;
+        if (!g.begun || g.ended || (eye >= FRAME_TIMING_MAX_EYES)) {
+            return;
+        }
+        GPUTimerMark(g.next, GPU_TIMER_EYE_START + 2 * eye + (end ? 1 : 0));
+        if (end) {
+            g.slots[g.next].numEyes =
+                std::max(g.slots[g.next].numEyes, eye + 1);
+        }
+    }
+
+    void RenderManager::EndGPUTimingInternal() {
+        GPUTimingState& g = m_gpuTiming;
+        if (g.begun && !g.ended) {
+            GPUTimerEnd(g.next);
+            g.ended = true;
+        }
+    }
+
+    void RenderManager::FinishGPUTimingInternal() {
+        GPUTimingState& g = m_gpuTiming;
+        if (g.ended) {
+            g.slots[g.next].pending = true;
+            g.next = (g.next + 1) % GPU_TIMER_FRAMES;
+        }
+        g.begun = false;
+        g.ended = false;
+    }
+
+    void RenderManager::RecordGPUTimingInternal(
+        const GPUTimingState::Slot& slot, const double* seconds) {
+        double present =
+            seconds[GPU_TIMER_FRAME_END] - seconds[GPU_TIMER_FRAME_START];
+        if (present <= 0) {
+            return;
+        }
+        smoothEstimate(m_gpuTiming.presentSeconds, present);
+
+        {
+            // The record is still in the history unless it has been
+            // overwritten by newer ones.
+            std::lock_guard<std::mutex> lock(m_frameTiming.mutex);
+            FrameTimingRecord& record =
+                m_frameTiming.records[slot.frame % FrameTimingState::HISTORY];
+            if ((m_frameTiming.frames - slot.frame <= m_frameTiming.count) &&
+                (record.frame == slot.frame)) {
+                record.gpuPresentSeconds = present;
+                for (size_t eye = 0; eye < slot.numEyes; eye++) {
+                    record.gpuEyeSeconds[eye] =
+                        seconds[GPU_TIMER_EYE_START + 2 * eye + 1] -
+                        seconds[GPU_TIMER_EYE_START + 2 * eye];
+                }
+            }
+        }
+
+        // Time warp is done in a window before vsync; if the GPU can't
+        // draw the present pass within it, the frames will miss vsync.
+        if (m_params.m_enableTimeWarp &&
+            (m_params.m_maxMSBeforeVsyncTimeWarp > 0) &&
+            !m_gpuTiming.warnedWindow &&
+            (m_gpuTiming.presentSeconds * 1e3 >
+             m_params.m_maxMSBeforeVsyncTimeWarp)) {
+            std::cerr << "RenderManager: Warning: The GPU takes "
+                      << m_gpuTiming.presentSeconds * 1e3
+                      << " ms to draw the present pass, which is more than "
+                         "the "
+                      << m_params.m_maxMSBeforeVsyncTimeWarp
+                      << " ms maxMSBeforeVsync time-warp window; consider "
+                         "increasing it"
+                      << std::endl;
+            m_gpuTiming.warnedWindow = true;
+        }
+    }
+
+    void RenderManager::LatencyHistogram::clear() {
+        for (auto& count : counts) {
+            count.store(0, std::memory_order_relaxed);
+        }
+        samples.store(0, std::memory_order_relaxed);
+        sumMicroseconds.store(0, std::memory_order_relaxed);
+        maxMicroseconds.store(0, std::memory_order_relaxed);
+    }
+
+    void RenderManager::LatencyHistogram::add(uint64_t microseconds) {
+        // Only the presenting thread adds, so the max does not need a
+        // compare-and-swap loop.
+        size_t bucket = std::min<size_t>(
+            static_cast<size_t>(microseconds / BUCKET_MICROSECONDS),
+            BUCKETS - 1);
+        counts[bucket].fetch_add(1, std::memory_order_relaxed);
+        sumMicroseconds.fetch_add(microseconds, std::memory_order_relaxed);
+        if (microseconds > maxMicroseconds.load(std::memory_order_relaxed)) {
+            maxMicroseconds.store(microseconds, std::memory_order_relaxed);
+        }
+        samples.fetch_add(1, std::memory_order_release);
+    }
+
+    void RenderManager::RecordPoseTimestampsInternal(
+        const std::vector<RenderInfo>& renderInfo) {
+        if (!m_headPoseTimestampValid) {
+            return;
+        }
+        size_t numEyes = std::min<size_t>(renderInfo.size(),
+                                          FRAME_TIMING_MAX_EYES);
+        for (size_t eye = 0; eye < numEyes; eye++) {
+            size_t& next = m_latency.nextPose[eye];
+            LatencyState::PoseRecord& record = m_latency.poses[eye][next];
+            record.pose = renderInfo[eye].pose;
+            record.timestamp = m_headPoseTimestamp;
+            next = (next + 1) % LatencyState::POSE_HISTORY;
+        }
+    }
+
+    /// @brief Are two poses exactly the same?  Poses that have been
+    /// handed to the application and back are copied bit for bit.
+    static bool samePose(const OSVR_PoseState& a, const OSVR_PoseState& b) {
+        for (size_t i = 0; i < 3; i++) {
+            if (a.translation.data[i] != b.translation.data[i]) {
+                return false;
+            }
+        }
+        for (size_t i = 0; i < 4; i++) {
+            if (a.rotation.data[i] != b.rotation.data[i]) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    void RenderManager::RecordMotionToPhotonInternal(
+        const std::vector<RenderInfo>& renderInfoUsed, bool haveWarpPose,
+        const OSVR_TimeValue& warpPoseTimestamp,
+        const OSVR_TimeValue& swapReturn) {
+        // The image goes out at the retrace that the swap waited for, or
+        // the next one if it did not wait.
+        OSVR_TimeValue scanOut = swapReturn;
+        if (!m_params.m_verticalSyncBlocksRendering) {
+            OSVR_TimeValue nextRetrace;
+            double interval;
+            if (GetNextRetraceInternal(swapReturn, nextRetrace, interval)) {
+                scanOut = nextRetrace;
+            }
+        }
+
+        size_t numEyes = std::min<size_t>(GetNumEyes(), FRAME_TIMING_MAX_EYES);
+        for (size_t eye = 0; eye < numEyes; eye++) {
+            OSVR_TimeValue photons = scanOut;
+            if (eye < m_params.m_eyeDelaysMS.size()) {
+                photons = offsetTimeValue(photons,
+                                          m_params.m_eyeDelaysMS[eye] / 1e3);
+            }
+            auto addSample = [&](LatencySource source,
+                                 const OSVR_TimeValue& reported) {
+                double seconds =
+                    osvrTimeValueDurationSeconds(&photons, &reported);
+                if (seconds >= 0) {
+                    m_latency.histograms[eye][source].add(
+                        static_cast<uint64_t>(seconds * 1e6));
+                }
+            };
+
+            // Find the tracker report behind the pose the application used.
+            // Search from the newest, since a still head or a replaced
+            // pose can make several of them the same.
+            if (eye < renderInfoUsed.size()) {
+                for (size_t i = 1; i <= LatencyState::POSE_HISTORY; i++) {
+                    const LatencyState::PoseRecord& record =
+                        m_latency.poses[eye][(m_latency.nextPose[eye] +
+                                              LatencyState::POSE_HISTORY - i) %
+                                             LatencyState::POSE_HISTORY];
+                    if ((record.timestamp.seconds != 0) &&
+                        samePose(record.pose, renderInfoUsed[eye].pose)) {
+                        addSample(LATENCY_APP_POSE, record.timestamp);
+                        break;
+                    }
+                }
+            }
+            if (haveWarpPose) {
+                addSample(LATENCY_TIME_WARP_POSE, warpPoseTimestamp);
+            }
+        }
+    }
+
+    void RenderManager::LogMotionToPhotonInternal(const OSVR_TimeValue& now) {
+        if (m_params.m_latencyLogSeconds <= 0) {
+            return;
+        }
+        if (m_latency.lastLog.seconds == 0) {
+            m_latency.lastLog = now;
+            return;
+        }
+        if (osvrTimeValueDurationSeconds(&now, &m_latency.lastLog) <
+            m_params.m_latencyLogSeconds) {
+            return;
+        }
+        m_latency.lastLog = now;
+
+        size_t numEyes = std::min<size_t>(GetNumEyes(), FRAME_TIMING_MAX_EYES);
+        for (size_t eye = 0; eye < numEyes; eye++) {
+            static const char* names[] = {"app pose", "time-warp pose"};
+            for (int source = 0; source < 2; source++) {
+                LatencyStats stats;
+                GetMotionToPhotonLatency(
+                    eye, static_cast<LatencySource>(source), stats);
+                if (stats.samples == 0) {
+                    continue;
+                }
+                std::cerr << "RenderManager: Eye " << eye
+                          << " motion-to-photon latency from "
+                          << names[source] << " (ms): mean "
+                          << stats.meanSeconds * 1e3 << ", p50 "
+                          << stats.p50Seconds * 1e3 << ", p90 "
+                          << stats.p90Seconds * 1e3 << ", p99 "
+                          << stats.p99Seconds * 1e3 << ", max "
+                          << stats.maxSeconds * 1e3 << " over "
+                          << stats.samples << " frames" << std::endl;
+            }
+        }
+    }
+
+    bool RenderManager::GetMotionToPhotonLatency(size_t whichEye,
+                                                 LatencySource source,
+                                                 LatencyStats& stats) {
+        // This reads only the histograms, so it does not lock.
+        stats = LatencyStats();
+        if ((whichEye >= FRAME_TIMING_MAX_EYES) ||
+            ((source != LATENCY_APP_POSE) &&
+             (source != LATENCY_TIME_WARP_POSE))) {
+            std::cerr << "RenderManager::GetMotionToPhotonLatency(): Eye or "
+                         "source out of range"
+                      << std::endl;
+            return false;
+        }
+        const LatencyHistogram& h = m_latency.histograms[whichEye][source];
+
+        // Copy the counts once so the percentiles are consistent with each
+        // other even if a frame is added while we read.
+        std::array<uint64_t, LatencyHistogram::BUCKETS> counts;
+        uint64_t total = 0;
+        for (size_t i = 0; i < counts.size(); i++) {
+            counts[i] = h.counts[i].load(std::memory_order_relaxed);
+            total += counts[i];
+        }
+        stats.samples = total;
+        if (total == 0) {
+            return true;
+        }
+        const double bucketSeconds =
+            LatencyHistogram::BUCKET_MICROSECONDS / 1e6;
+        stats.meanSeconds =
+            h.sumMicroseconds.load(std::memory_order_relaxed) / 1e6 /
+            h.samples.load(std::memory_order_acquire);
+        stats.maxSeconds =
+            h.maxMicroseconds.load(std::memory_order_relaxed) / 1e6;
+        auto percentile = [&](double fraction) {
+            uint64_t needed =
+                static_cast<uint64_t>(std::ceil(fraction * total));
+            uint64_t seen = 0;
+            for (size_t i = 0; i < counts.size(); i++) {
+                seen += counts[i];
+                if (seen >= needed) {
+                    return std::min((i + 1) * bucketSeconds, stats.maxSeconds);
+                }
+            }
+            return stats.maxSeconds;
+        };
+        stats.p50Seconds = percentile(0.50);
+        stats.p90Seconds = percentile(0.90);
+        stats.p99Seconds = percentile(0.99);
+        return true;
+    }
+
+    bool RenderManager::GetMotionToPhotonHistogram(
+        size_t whichEye, LatencySource source, std::vector<uint64_t>& counts,
+        double& bucketSeconds) {
+        if ((whichEye >= FRAME_TIMING_MAX_EYES) ||
+            ((source != LATENCY_APP_POSE) &&
+             (source != LATENCY_TIME_WARP_POSE))) {
+            std::cerr << "RenderManager::GetMotionToPhotonHistogram(): Eye or "
+                         "source out of range"
+                      << std::endl;
+            return false;
+        }
+        const LatencyHistogram& h = m_latency.histograms[whichEye][source];
+        counts.resize(LatencyHistogram::BUCKETS);
+        for (size_t i = 0; i < counts.size(); i++) {
+            counts[i] = h.counts[i].load(std::memory_order_relaxed);
+        }
+        bucketSeconds = LatencyHistogram::BUCKET_MICROSECONDS / 1e6;
+        return true;
+    }
+
+    void RenderManager::ResetMotionToPhotonLatency() {
+        for (auto& eye : m_latency.histograms) {
+            for (auto& histogram : eye) {
+                histogram.clear();
+            }
+        }
+    }
+
+    bool RenderManager::SetFrameDropCallback(FrameDropCallback callback,
+                                             void* userData) {
+        // All public methods that use internal state should be guarded
+        // by a mutex.
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        m_frameDropCallback.m_callback = callback;
+        m_frameDropCallback.m_userData = userData;
+        return true;
+    }
+
+    bool RenderManager::GetFrameDropStats(FrameDropStats& stats) {
+        // The counts are atomic, so this does not lock.
+        stats.presents = m_frameDrops.presents.load();
+        stats.appMisses = m_frameDrops.appMisses.load();
+        stats.compositorMisses = m_frameDrops.compositorMisses.load();
+        stats.lateWarps = m_frameDrops.lateWarps.load();
+        return true;
+    }
+
+    void RenderManager::ResetFrameDropStats() {
+        m_frameDrops.presents = 0;
+        m_frameDrops.appMisses = 0;
+        m_frameDrops.compositorMisses = 0;
+        m_frameDrops.lateWarps = 0;
+    }
+
+    void RenderManager::ClassifyMissedRetraceInternal(
+        const OSVR_TimeValue& previousPresentDone) {
+        // Presents that keep up complete on the retrace after the previous
+        // one, so that is the one this present was aiming for.  To make
+        // it, each stage had to finish at least the present's own cost
+        // (on the CPU or the GPU, whichever is longer) before it.
+        const FrameTimingRecord& timing = m_frameTiming.current;
+        OSVR_TimeValue retrace = offsetTimeValue(
+            previousPresentDone, m_framePacing.refreshInterval);
+        double presentCost =
+            std::max(m_framePacing.presentSeconds, m_gpuTiming.presentSeconds);
+        OSVR_TimeValue deadline = offsetTimeValue(retrace, -presentCost);
+
+        FrameDropType type = FRAME_DROP_COMPOSITOR;
+        if (!timing.repeat &&
+            osvrTimeValueGreater(&timing.presentEntry, &deadline)) {
+            type = FRAME_DROP_APP;
+        } else if (m_params.m_enableTimeWarp &&
+                   osvrTimeValueGreater(&timing.warpComputed, &deadline)) {
+            type = FRAME_DROP_LATE_WARP;
+        }
+        ReportFrameDropInternal(type, m_frameTiming.frames - 1);
+    }
+
+    void RenderManager::ReportFrameDropInternal(FrameDropType type,
+                                                uint64_t frame) {
+        switch (type) {
+        case FRAME_DROP_APP:
+            m_frameDrops.appMisses++;
+            break;
+        case FRAME_DROP_COMPOSITOR:
+            m_frameDrops.compositorMisses++;
+            break;
+        case FRAME_DROP_LATE_WARP:
+            m_frameDrops.lateWarps++;
+            break;
+        }
+        if (m_frameDropCallback.m_callback != nullptr) {
+            m_frameDropCallback.m_callback(m_frameDropCallback.m_userData,
+                                           type, frame);
+        }
+    }
+
+    bool RenderManager::GetPresentThreadScheduling(
+        PresentThreadSchedulingInfo& info) {
+        // All public methods that use internal state should be guarded
+        // by a mutex.
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        if ((m_presentThreadId == std::thread::id()) ||
+            !PresentThreadSchedulingRequested(m_params)) {
+            return false;
+        }
+        info = m_presentThreadSchedulingInfo;
+        return true;
+    }
+
+    bool RenderManager::GetStartupTiming(
+        std::vector<StartupStageTiming>& stages) {
+        // All public methods that use internal state should be guarded
+        // by a mutex.
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        stages = m_startupTiming;
+        return !stages.empty();
+    }
+
+    bool RenderManager::GetNextRetraceInternal(const OSVR_TimeValue& now,
+                                               OSVR_TimeValue& nextRetrace,
+                                               double& intervalSeconds) {
+        // Use the timing information from the first eye if we can get it,
+        // assuming that all of the other displays are synchronized to it.
+        // @todo Consider what happens for non-genlocked displays
+        RenderTimingInfo info;
+        if (GetTimingInfo(0, info)) {
+            intervalSeconds =
+                info.hardwareDisplayInterval.seconds +
+                info.hardwareDisplayInterval.microseconds / 1e6;
+            if (intervalSeconds > 0) {
+                double sinceRetrace =
+                    info.timeSincelastVerticalRetrace.seconds +
+                    info.timeSincelastVerticalRetrace.microseconds / 1e6;
+                nextRetrace =
+                    offsetTimeValue(now, intervalSeconds - sinceRetrace);
+                return true;
+            }
+        }
+
+        // Otherwise, extrapolate from the last vertical-sync'ed present.
+        if (m_framePacing.refreshInterval <= 0) {
+            return false;
+        }
+        intervalSeconds = m_framePacing.refreshInterval;
+        double since = osvrTimeValueDurationSeconds(
+            &now, &m_framePacing.lastPresentDone);
+        double periods = std::floor(since / intervalSeconds) + 1;
+        nextRetrace = offsetTimeValue(m_framePacing.lastPresentDone,
+                                      periods * intervalSeconds);
+        return true;
+    }
+
+    bool RenderManager::GetNextFrameRetraceInternal(
+        const OSVR_TimeValue& now, OSVR_TimeValue& nextRetrace,
+        double& intervalSeconds) {
+        if (!GetNextRetraceInternal(now, nextRetrace, intervalSeconds)) {
+            return false;
+        }
+        unsigned refreshes = m_framePacing.refreshesPerFrame;
+        if ((refreshes <= 1) || (m_framePacing.lastPresentDone.seconds == 0)) {
+            return true;
+        }
+
+        // The presenter thread picks up a new frame when the swap for the
+        // last refresh of the previous frame returns.  Count how many
+        // refreshes past our last present the next retrace is and move
+        // forward to the first such pick-up.
+        double since = osvrTimeValueDurationSeconds(
+            &nextRetrace, &m_framePacing.lastPresentDone);
+        long elapsed = std::lround(since / intervalSeconds);
+        long ratio = static_cast<long>(refreshes);
+        long offset =
+            ((-(elapsed + m_framePacing.presentPhase + 1)) % ratio + ratio) %
+            ratio;
+        nextRetrace = offsetTimeValue(nextRetrace, offset * intervalSeconds);
+        intervalSeconds *= refreshes;
+        return true;
+    }
+
+    double RenderManager::FramePresentLeadSecondsInternal() const {
+        // When we're waiting to do time warp right before vsync, the frame
+        // must be handed to us before that window opens.  We also leave a
+        // half-millisecond safety margin.
+        // The present is not done until the GPU has drawn it, which can
+        // take longer than it takes us to submit the draws.
+        double lead =
+            std::max(m_framePacing.presentSeconds, m_gpuTiming.presentSeconds);
+        if (m_params.m_enableTimeWarp &&
+            (m_params.m_maxMSBeforeVsyncTimeWarp > 0)) {
+            lead = std::max(lead, m_params.m_maxMSBeforeVsyncTimeWarp / 1e3);
+        }
+        return lead + 0.5e-3;
+    }
+
+    bool RenderManager::RecordPresentTimingInternal(
+        const OSVR_TimeValue& presentDone, double presentSeconds) {
+        smoothEstimate(m_framePacing.presentSeconds, presentSeconds);
+        bool missedRetrace = false;
+
+        // When we're vertical-sync'ed, swaps complete on retraces, so the
+        // spacing between them tells us the refresh interval.  Skip
+        // intervals that include dropped frames and much-too-short ones.
+        if (m_params.m_verticalSync &&
+            (m_framePacing.lastPresentDone.seconds != 0)) {
+            double interval = osvrTimeValueDurationSeconds(
+                &presentDone, &m_framePacing.lastPresentDone);
+            double& estimate = m_framePacing.refreshInterval;
+            missedRetrace = (estimate > 0) && (interval > 1.5 * estimate);
+            if ((interval > 1e-3) && (interval < 0.1)) {
+                if ((estimate <= 0) || (interval < 0.75 * estimate)) {
+                    estimate = interval;
+                } else if (interval < 1.25 * estimate) {
+                    smoothEstimate(estimate, interval, 0.05);
+                }
+            }
+        }
+        m_framePacing.lastPresentDone = presentDone;
+        return missedRetrace;
+    }
 
-          if (!SolidColorEye(eye, color)) {
-            std::cerr << "RenderManager::PresentSolidColorInternal(): "
-              "PresentEye failed."
-              << std::endl;
+    bool RenderManager::SetDynamicResolution(bool enable, float minScale,
+                                             float maxScale) {
+        // All public methods that use internal state should be guarded
+        // by a mutex.
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        if ((minScale <= 0) || (maxScale > 1) || (minScale > maxScale)) {
+            std::cerr << "RenderManager::SetDynamicResolution(): Invalid "
+                         "bounds ("
+                      << minScale << ", " << maxScale
+                      << "); need 0 < min <= max <= 1" << std::endl;
             return false;
-          }
         }
-
-        // We're done with this display.
-        if (!PresentDisplayFinalize(display)) {
-          std::cerr << "RenderManager::PresentSolidColorInternal(): "
-            "PresentDisplayFinalize failed."
-            << std::endl;
-          return false;
+        m_dynamicResolution.enabled = enable;
+        m_dynamicResolution.minScale = minScale;
+        m_dynamicResolution.maxScale = maxScale;
+        m_dynamicResolution.overBudgetFrames = 0;
+        m_dynamicResolution.underBudgetFrames = 0;
+        if (enable) {
+            // Start at the largest allowed size and back off as needed.
+            m_dynamicResolution.scale = maxScale;
+        } else {
+            m_dynamicResolution.scale = 1.0f;
         }
-      }
+        return true;
+    }
 
-      // Finalize the rendering for the whole frame.
-      if (!PresentFrameFinalize()) {
-        std::cerr << "RenderManager::PresentSolidColorInternal(): "
-          "PresentFrameFinalize failed."
-          << std::endl;
-        return false;
-      }
+    float RenderManager::GetDynamicResolutionScale() {
+        // All public methods that use internal state should be guarded
+        // by a mutex.
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_dynamicResolution.scale;
+    }
 
-      return true;
+    void RenderManager::UpdateDynamicResolutionInternal(double busySeconds,
+                                                        bool missedRetrace) {
+        DynamicResolutionState& dr = m_dynamicResolution;
+        if (!dr.enabled) {
+            return;
+        }
+        OSVR_TimeValue now, nextRetrace;
+        osvrTimeValueGetNow(&now);
+        double interval;
+        if (!GetNextRetraceInternal(now, nextRetrace, interval)) {
+            return;
+        }
+        // Frames may be shown for several refreshes, each of which gives
+        // the application that much more time.
+        interval *= m_framePacing.refreshesPerFrame;
+
+        // Aim to keep the frame busy for this fraction of the refresh
+        // interval.  Frames above the upper threshold (or that missed a
+        // retrace) count against the scale and those below the lower one
+        // count towards it; in between is a dead band.  We react to a few
+        // slow frames but require many fast ones before growing, and we
+        // limit the step size, so that the scale does not oscillate.
+        const double targetLoad = 0.8;
+        const double highLoad = 0.9;
+        const double lowLoad = 0.65;
+        const unsigned framesBeforeShrinking = 3;
+        const unsigned framesBeforeGrowing = 45;
+        double load = busySeconds / interval;
+        bool overBudget = missedRetrace || (load > highLoad);
+        if (overBudget) {
+            dr.underBudgetFrames = 0;
+            if (++dr.overBudgetFrames < framesBeforeShrinking) {
+                return;
+            }
+        } else if (load < lowLoad) {
+            dr.overBudgetFrames = 0;
+            if (++dr.underBudgetFrames < framesBeforeGrowing) {
+                return;
+            }
+        } else {
+            dr.overBudgetFrames = 0;
+            dr.underBudgetFrames = 0;
+            return;
+        }
+        dr.overBudgetFrames = 0;
+        dr.underBudgetFrames = 0;
+
+        // Render time scales with the number of pixels, which goes as the
+        // square of the viewport scale.  A frame that missed its retrace
+        // shrinks us even if it did not seem busy, since something we
+        // don't measure made it late.
+        double step = 0.85;
+        if (load > 0) {
+            step = std::sqrt(targetLoad / load);
+        }
+        if (overBudget) {
+            step = std::max(0.8, std::min(step, 0.95));
+        } else {
+            step = std::max(1.02, std::min(step, 1.1));
+        }
+        float scale = static_cast<float>(dr.scale * step);
+        dr.scale = std::max(dr.minScale, std::min(scale, dr.maxScale));
     }
 
     bool RenderManager::UpdateDistortionMeshes(
@@ -1019,9 +2776,14 @@ namespace renderkit {
         ) {
         // All public methods that use internal state should be guarded
         // by a mutex.
-        std::lock_guard<std::mutex> lock(m_mutex);
-
-        return UpdateDistortionMeshesInternal(type, distort);
+        std::unique_lock<std::mutex> lock(m_mutex);
+        WaitForPresentInFlightInternal(lock);
+        TraceScope trace(m_trace.get(), "UpdateDistortionMeshes");
+
+        // A build still going on in the background is for parameters that
+        // these replace.
+        StopBackgroundDistortionMeshes();
+        return BuildDistortionMeshesInternal(type, distort, false);
     }
 
     void RenderManager::SetRoomRotationUsingHead() {
@@ -1329,15 +3091,12 @@ namespace renderkit {
         // need to rotate all of them and then test which
         // is the new lower-left corner and what the new width
         // and height are.
-        std::vector<double> LL = {viewport.left, viewport.lower};
-        std::vector<double> UL = {viewport.left + viewport.width,
-                                  viewport.lower};
-        std::vector<double> UU = {viewport.left + viewport.width,
-                                  viewport.lower + viewport.height};
-        std::vector<double> LU = {viewport.left,
-                                  viewport.lower + viewport.height};
-
-        std::vector<std::vector<double> > verts = {LL, UL, UU, LU};
+        std::array<std::array<double, 2>, 4> verts = {{
+            {{viewport.left, viewport.lower}},
+            {{viewport.left + viewport.width, viewport.lower}},
+            {{viewport.left + viewport.width,
+              viewport.lower + viewport.height}},
+            {{viewport.left, viewport.lower + viewport.height}}}};
 
         // Normalize the vertex coordinates to the range -1..1
         for (auto& vert : verts) {
@@ -1351,7 +3110,7 @@ namespace renderkit {
         //   Y' = X * sin(angle) + Y * cos(angle)
         double cR = cos(radians);
         double sR = sin(radians);
-        std::vector<std::vector<double> > vertsRot = verts;
+        std::array<std::array<double, 2>, 4> vertsRot = verts;
         for (size_t i = 0; i < verts.size(); i++) {
             vertsRot[i][0] = verts[i][0] * cR - verts[i][1] * sR;
             vertsRot[i][1] = verts[i][0] * sR + verts[i][1] * cR;
@@ -1472,6 +3231,7 @@ namespace renderkit {
         if (params.roomFromHeadReplace != nullptr) {
             /// Use the params.m_headFromRoom as our transform
             q_from_OSVR(q_roomFromHead, *params.roomFromHeadReplace);
+            m_headPoseTimestampValid = false;
         } else {
             /// Use the state interface to read the most-recent
             /// location of the head.  It will have been updated
@@ -1479,10 +3239,14 @@ namespace renderkit {
             /// DO NOT update the client here, so that we're using the
             /// same state for all eyes.
             OSVR_TimeValue timestamp;
-            if (osvrGetPoseState(m_roomFromHeadInterface, &timestamp,
-                                 &m_roomFromHead) == OSVR_RETURN_FAILURE) {
+            m_headPoseTimestampValid = false;
+            if (ReadPoseInternal(m_roomFromHeadInterface, 0, timestamp,
+                                 m_roomFromHead) == OSVR_RETURN_FAILURE) {
                 // This it not an error -- they may have put in an invalid
                 // state name for the head; we just ignore that case.
+            } else {
+                m_headPoseTimestamp = timestamp;
+                m_headPoseTimestampValid = true;
             }
 
             // Do prediction of where this eye will be when it is presented
@@ -1492,7 +3256,7 @@ namespace renderkit {
               // If we can't get timing info, we just set its offset to 0.
               float msUntilPresent = 0;
               RenderTimingInfo timing;
-              if (GetTimingInfo(whichEye, timing)) {
+              if (ReadTimingInfoInternal(whichEye, timing)) {
                 msUntilPresent +=
                   (timing.timeUntilNextPresentRequired.seconds * 1e3f) +
                   (timing.timeUntilNextPresentRequired.microseconds / 1e3f);
@@ -1504,7 +3268,7 @@ namespace renderkit {
               float msSinceTrackerReport = 0;
               if (!m_params.m_clientPredictionLocalTimeOverride) {
                 OSVR_TimeValue now;
-                osvrTimeValueGetNow(&now);
+                ReadNowInternal(now);
                 msSinceTrackerReport = static_cast<float>(
                   osvrTimeValueDurationSeconds(&now, &timestamp) * 1e3
                   );
@@ -1527,8 +3291,8 @@ namespace renderkit {
               OSVR_VelocityState vel;
               vel.linearVelocityValid = false;
               vel.angularVelocityValid = false;
-              if (osvrGetVelocityState(m_roomFromHeadInterface, &timestamp,
-                  &vel) != OSVR_RETURN_SUCCESS) {
+              if (ReadVelocityInternal(timestamp, vel) !=
+                  OSVR_RETURN_SUCCESS) {
                 // We're okay with failure here, we just use a zero
                 // velocity to predict.
               }
@@ -1583,9 +3347,10 @@ namespace renderkit {
             makeIdentity(q_worldFromSpace);
         } else {
             OSVR_TimeValue timestamp;
-            if (osvrGetPoseState(
-                    m_callbacks[whichSpace].m_interface, &timestamp,
-                    &m_callbacks[whichSpace].m_state) == OSVR_RETURN_FAILURE) {
+            if (ReadPoseInternal(m_callbacks[whichSpace].m_interface,
+                                 1 + whichSpace, timestamp,
+                                 m_callbacks[whichSpace].m_state) ==
+                OSVR_RETURN_FAILURE) {
                 // They asked for a space that does not exist.  Return false to
                 // let them know we didn't get the one they wanted.
                 return false;
@@ -1601,8 +3366,8 @@ namespace renderkit {
     }
 
     bool RenderManager::ComputeAsynchronousTimeWarps(
-        std::vector<RenderInfo> usedRenderInfo,
-        std::vector<RenderInfo> currentRenderInfo, float assumedDepth) {
+        const std::vector<RenderInfo>& usedRenderInfo,
+        const std::vector<RenderInfo>& currentRenderInfo, float assumedDepth) {
         // Empty out the time warp vector until we fill it again below.
         m_asynchronousTimeWarps.clear();
 
@@ -1819,31 +3584,29 @@ namespace renderkit {
     }
 
     RenderManager::UnstructuredMeshInterpolator::UnstructuredMeshInterpolator(
-        const MonoPointDistortionMeshDescription& points,
+        MonoPointDistortionMeshSamplesPtr points,
         int numSamplesX, int numSamplesY
         ) : m_points(points), m_numSamplesX(numSamplesX),
         m_numSamplesY(numSamplesY) {
 
-      // Construct and fill in the grid of nearby points that is used by the
-      // interpolation function to accelerate the search for the three
-      // nearest non-collinear points.
-      std::vector< MonoPointDistortionMeshDescription> ySet;
-      MonoPointDistortionMeshDescription empty;
-      for (size_t y = 0; y < m_numSamplesY; y++) {
-        ySet.emplace_back(empty);
-      }
-      for (size_t x = 0; x < m_numSamplesX; x++) {
-        m_grid.emplace_back(ySet);
+      // Construct and fill in the grid of nearby point indices that is
+      // used by the interpolation function to accelerate the search for
+      // the three nearest non-collinear points.
+      m_grid.resize(m_numSamplesX);
+      for (auto& ySet : m_grid) {
+        ySet.resize(m_numSamplesY);
       }
-      
+      m_byDistance.reserve(m_points->size());
+
       // Go through each point in the unstructured grid and insert its index
       // into all grid elements that are within 1/4th (rounded up) of the
       // total span of the grid from its normalized location.
+      const MonoPointDistortionMeshSamples& pts = *m_points;
       int xHalfSpan = static_cast<int>(0.9 + (1.0/4.0)*0.5 * m_numSamplesX);
       int yHalfSpan = static_cast<int>(0.9 + (1.0/4.0)*0.5 * m_numSamplesY);
-      for (size_t i = 0; i < points.size(); i++) {
+      for (size_t i = 0; i < pts.size(); i++) {
         int xIndex, yIndex;
-        if (getIndex(points[i][0][0], points[i][0][1], xIndex, yIndex)) {
+        if (getIndex(pts.fromX(i), pts.fromY(i), xIndex, yIndex)) {
 
           // Get the range of locations to insert
           int xMin = xIndex - xHalfSpan;
@@ -1858,7 +3621,7 @@ namespace renderkit {
           // Insert this point into each of these locations.
           for (int x = xMin; x <= xMax; x++) {
             for (int y = yMin; y <= yMax; y++) {
-              m_grid[x][y].push_back(points[i]);
+              m_grid[x][y].push_back(static_cast<uint32_t>(i));
             }
           }
         }
@@ -1877,48 +3640,48 @@ namespace renderkit {
         if (!getIndex(xN, yN, xIndex, yIndex)) {
           return ret;
         }
-        MonoPointDistortionMeshDescription points;
-        points = getNearestPoints(xN, yN, m_grid[xIndex][yIndex]);
+        uint32_t nearest[3];
+        size_t found =
+          getNearestPoints(xN, yN, &m_grid[xIndex][yIndex], nearest);
 
         // If we didn't get enough points from the acceleration
         // structure, look in the whole points array
-        if (points.size() < 3) {
-          points = getNearestPoints(xN, yN, m_points);
+        if (found < 3) {
+          found = getNearestPoints(xN, yN, nullptr, nearest);
+        }
+        if (found == 0) {
+          return ret;
         }
 
         // If we didn't get three points, just return the output of
         // the first point we found.
-
-        if (points.size() < 3) {
-          float xNew = static_cast<float>(points[0][1][0]);
-          float yNew = static_cast<float>(points[0][1][1]);
-          ret[0] = xNew;
-          ret[1] = yNew;
+        const MonoPointDistortionMeshSamples& pts = *m_points;
+        if (found < 3) {
+          ret[0] = pts.toX(nearest[0]);
+          ret[1] = pts.toY(nearest[0]);
           return ret;
         }
 
         // Found three points -- interpolate them.
         float xNew = static_cast<float>(interpolate(
-          points[0][0][0], points[0][0][1], points[0][1][0],
-          points[1][0][0], points[1][0][1], points[1][1][0],
-          points[2][0][0], points[2][0][1], points[2][1][0], xN,
-          yN));
+          pts.fromX(nearest[0]), pts.fromY(nearest[0]), pts.toX(nearest[0]),
+          pts.fromX(nearest[1]), pts.fromY(nearest[1]), pts.toX(nearest[1]),
+          pts.fromX(nearest[2]), pts.fromY(nearest[2]), pts.toX(nearest[2]),
+          xN, yN));
         float yNew = static_cast<float>(interpolate(
-          points[0][0][0], points[0][0][1], points[0][1][1],
-          points[1][0][0], points[1][0][1], points[1][1][1],
-          points[2][0][0], points[2][0][1], points[2][1][1], xN,
-          yN));
+          pts.fromX(nearest[0]), pts.fromY(nearest[0]), pts.toY(nearest[0]),
+          pts.fromX(nearest[1]), pts.fromY(nearest[1]), pts.toY(nearest[1]),
+          pts.fromX(nearest[2]), pts.fromY(nearest[2]), pts.toY(nearest[2]),
+          xN, yN));
         ret[0] = xNew;
         ret[1] = yNew;
         return ret;
     }
 
-    MonoPointDistortionMeshDescription
-      RenderManager::UnstructuredMeshInterpolator::getNearestPoints(
+    size_t RenderManager::UnstructuredMeshInterpolator::getNearestPoints(
           float xN, float yN,
-          const MonoPointDistortionMeshDescription &points) {
-
-      MonoPointDistortionMeshDescription ret;
+          const std::vector<uint32_t>* candidates,
+          uint32_t nearest[3]) {
 
       // Find the three non-collinear points in the mesh that are nearest
       // to the normalized point we are trying to look up.  We start by
@@ -1927,44 +3690,86 @@ namespace renderkit {
       // one that is not collinear with the first two (normalized dot
       // product magnitude far enough from 1).  If we don't find such
       // points, we just go with the values from the closest point.
-      typedef std::multimap<double, size_t> PointDistanceIndexMap;
-      PointDistanceIndexMap map;
-      //if (points.size() < 460 && points.size() > 0) std::cout << "XXX Sorting mesh of size " << points.size() << std::endl;
-      for (size_t i = 0; i < points.size(); i++) {
-        // Insertion into the multimap sorts them by distance.
-        map.insert(std::make_pair(
-          pointDistance(xN, yN, points[i][0][0], points[i][0][1]), i));
+      const MonoPointDistortionMeshSamples& pts = *m_points;
+      size_t count = candidates ? candidates->size() : pts.size();
+      m_byDistance.clear();
+      for (size_t c = 0; c < count; c++) {
+        uint32_t i = candidates ? (*candidates)[c] : static_cast<uint32_t>(c);
+        m_byDistance.push_back(std::make_pair(
+          pointDistance(xN, yN, pts.fromX(i), pts.fromY(i)), i));
       }
+      // A stable sort by distance keeps equally-distant points in the order
+      // they were listed, as insertion into a multimap used to.
+      std::stable_sort(m_byDistance.begin(), m_byDistance.end(),
+        [](std::pair<double, uint32_t> const& a,
+           std::pair<double, uint32_t> const& b) {
+          return a.first < b.first;
+        });
 
-      PointDistanceIndexMap::const_iterator it = map.begin();
-      size_t first = it->second;
-      it++;
-      size_t second = it->second;
-      it++;
-      size_t third = first;
-      while (it != map.end()) {
-        if (!nearly_collinear(points[first][0], points[second][0],
-          points[it->second][0])) {
-          third = it->second;
-          break;
-        }
-        it++;
+      if (m_byDistance.empty()) {
+        return 0;
       }
-
-      // Push back all of the points we found, which may not include
-      // a third point if the first is the same as the third.
-      if (map.size() >= 1) { ret.push_back(points[first]); }
-      if (map.size() >= 2) { ret.push_back(points[second]); }
-      if (third != first) {
-        ret.push_back(points[third]);
+      nearest[0] = m_byDistance[0].second;
+      if (m_byDistance.size() < 2) {
+        return 1;
       }
-      return ret;
+      nearest[1] = m_byDistance[1].second;
+
+      // Look for a third point that is not collinear with the first two.
+      std::array<double, 2> first = {
+        { pts.fromX(nearest[0]), pts.fromY(nearest[0]) } };
+      std::array<double, 2> second = {
+        { pts.fromX(nearest[1]), pts.fromY(nearest[1]) } };
+      for (size_t c = 2; c < m_byDistance.size(); c++) {
+        uint32_t i = m_byDistance[c].second;
+        std::array<double, 2> third = { { pts.fromX(i), pts.fromY(i) } };
+        if (!nearly_collinear(first, second, third)) {
+          nearest[2] = i;
+          return 3;
+        }
+      }
+      return 2;
+    }
+
+    /// @brief How many eyes a point-sample mesh has, from the shared
+    /// samples if there are any and from the nested vectors if not.
+    static size_t pointSampleEyes(
+        const MonoPointDistortionMeshSamplesPerEye& samples,
+        const MonoPointDistortionMeshDescriptions& descriptions) {
+        return samples.empty() ? descriptions.size() : samples.size();
+    }
+
+    /// @brief How many points one eye's mesh has, found the same way.
+    static size_t pointSampleCount(
+        const MonoPointDistortionMeshSamplesPerEye& samples,
+        const MonoPointDistortionMeshDescriptions& descriptions, size_t eye) {
+        if (!samples.empty()) {
+            return ((eye < samples.size()) && samples[eye])
+                       ? samples[eye]->size()
+                       : 0;
+        }
+        return (eye < descriptions.size()) ? descriptions[eye].size() : 0;
+    }
+
+    /// @brief The points of one eye's mesh: the shared samples if there
+    /// are any, or else a compact copy of the nested vectors.
+    static MonoPointDistortionMeshSamplesPtr pointSamples(
+        const MonoPointDistortionMeshSamplesPerEye& samples,
+        const MonoPointDistortionMeshDescriptions& descriptions, size_t eye) {
+        if (!samples.empty()) {
+            return (eye < samples.size()) ? samples[eye] : nullptr;
+        }
+        if (eye >= descriptions.size()) {
+            return nullptr;
+        }
+        return MonoPointDistortionMeshSamplesPtr(
+            new MonoPointDistortionMeshSamples(descriptions[eye]));
     }
 
     Float2 RenderManager::DistortionCorrectTextureCoordinate(
         size_t eye //< Which eye?
         , Float2 const& inCoords //< Coordinates to modify
-        , DistortionParameters distort //< Distortion parameters
+        , DistortionParameters const& distort //< Distortion parameters
         , size_t color //< 0 = red, 1 = green, 2 = blue
         ) {
         Float2 ret = inCoords;
@@ -2063,13 +3868,8 @@ namespace renderkit {
         } break;
         case osvr::renderkit::RenderManager::DistortionParameters::
             mono_point_samples: {
-            if (eye >= distort.m_monoPointSamples.size()) {
-                return ret;
-            }
-
-            MonoPointDistortionMeshDescription& points =
-                distort.m_monoPointSamples[eye];
-            if (points.size() < 3) {
+            if (pointSampleCount(distort.m_monoPointMeshSamples,
+                                 distort.m_monoPointSamples, eye) < 3) {
                 return ret;
             }
 
@@ -2087,13 +3887,8 @@ namespace renderkit {
             if (color >= 3) {
                 return ret;
             }
-            if (eye >= distort.m_rgbPointSamples[color].size()) {
-                return ret;
-            }
-
-            MonoPointDistortionMeshDescription& points =
-                distort.m_rgbPointSamples[color][eye];
-            if (points.size() < 3) {
+            if (pointSampleCount(distort.m_rgbPointMeshSamples[color],
+                                 distort.m_rgbPointSamples[color], eye) < 3) {
                 return ret;
             }
 
@@ -2121,7 +3916,7 @@ namespace renderkit {
     RenderManager::ComputeDistortionMesh(
         size_t eye //< Which eye?
         , DistortionMeshType type //< Type of mesh to produce
-        , DistortionParameters distort //< Distortion parameters
+        , DistortionParameters const& distort //< Distortion parameters
         ) {
         RenderManager::DistortionMesh ret;
 
@@ -2166,119 +3961,57 @@ namespace renderkit {
             }
         } else if (distort.m_type ==
                    RenderManager::DistortionParameters::mono_point_samples) {
-            if (distort.m_monoPointSamples.size() != 2) {
+            size_t eyes = pointSampleEyes(distort.m_monoPointMeshSamples,
+                                          distort.m_monoPointSamples);
+            if (eyes != 2) {
                 std::cerr << "RenderManager::ComputeDistortionMesh: Need 2 "
                              "meshes, found "
-                          << distort.m_monoPointSamples.size() << std::endl;
+                          << eyes << std::endl;
                 return ret;
             }
-            // Add a new interpolator to be used when we're finding
-            // mesh coordinates.
-            if (distort.m_monoPointSamples[eye].size() < 3) {
+            // The interpolator shares the compact points rather than
+            // copying them.
+            MonoPointDistortionMeshSamplesPtr points =
+                pointSamples(distort.m_monoPointMeshSamples,
+                             distort.m_monoPointSamples, eye);
+            if (!points || (points->size() < 3)) {
                 std::cerr << "RenderManager::ComputeDistortionMesh: Need "
                               "3+ points, found "
-                          << distort.m_monoPointSamples[eye].size()
-                          << std::endl;
+                          << (points ? points->size() : 0) << std::endl;
                 return ret;
             }
-            for (size_t i = 0; i < distort.m_monoPointSamples[eye].size();
-                  i++) {
-                if (distort.m_monoPointSamples[eye][i].size() != 2) {
-                    std::cerr
-                        << "RenderManager::ComputeDistortionMesh: Need 2 "
-                        << "points in the mesh, found "
-                        << distort.m_monoPointSamples[eye][i].size()
-                        << std::endl;
-                    return ret;
-                }
-                if (distort.m_monoPointSamples[eye][i][0].size() != 2) {
-                    std::cerr
-                        << "RenderManager::ComputeDistortionMesh: Need 2 "
-                        << "values in input point, found "
-                        << distort.m_monoPointSamples[eye][i][0].size()
-                        << std::endl;
-                    return ret;
-                }
-                if (distort.m_monoPointSamples[eye][i][1].size() != 2) {
-                    std::cerr
-                        << "RenderManager::ComputeDistortionMesh: Need 2 "
-                        << "values in output point, found "
-                        << distort.m_monoPointSamples[eye][i][1].size()
-                        << std::endl;
-                    return ret;
-                }
-            }
             // Add a new interpolator to be used when we're finding
             // mesh coordinates.
-            m_interpolators.emplace_back(new
-              UnstructuredMeshInterpolator(distort.m_monoPointSamples[eye]));
+            m_interpolators.emplace_back(
+                new UnstructuredMeshInterpolator(points));
         }
         else if (distort.m_type ==
                    RenderManager::DistortionParameters::rgb_point_samples) {
-            if (distort.m_rgbPointSamples.size() != 3) {
-                std::cerr << "RenderManager::ComputeDistortionMesh: Need 3 "
-                             "color meshes, found "
-                          << distort.m_rgbPointSamples.size() << std::endl;
-                return ret;
-            }
             for (size_t clr = 0; clr < 3; clr++) {
-                if (distort.m_rgbPointSamples[clr].size() != 2) {
+                size_t eyes =
+                    pointSampleEyes(distort.m_rgbPointMeshSamples[clr],
+                                    distort.m_rgbPointSamples[clr]);
+                if (eyes != 2) {
                     std::cerr << "RenderManager::ComputeDistortionMesh: Need 2 "
                                  "eye meshes, found "
-                              << distort.m_rgbPointSamples[clr].size()
-                              << std::endl;
+                              << eyes << std::endl;
                     return ret;
                 }
-                // Add a new interpolator to be used when we're finding
-                // mesh coordinates.
-                if (distort.m_rgbPointSamples[clr][eye].size() < 3) {
+                MonoPointDistortionMeshSamplesPtr points =
+                    pointSamples(distort.m_rgbPointMeshSamples[clr],
+                                 distort.m_rgbPointSamples[clr], eye);
+                if (!points || (points->size() < 3)) {
                     std::cerr
                         << "RenderManager::ComputeDistortionMesh: Need "
                             "3+ points, found "
-                        << distort.m_rgbPointSamples[clr][eye].size()
-                        << std::endl;
+                        << (points ? points->size() : 0) << std::endl;
                     return ret;
                 }
-                for (size_t i = 0;
-                      i < distort.m_rgbPointSamples[clr][eye].size(); i++) {
-                    if (distort.m_rgbPointSamples[clr][eye][i].size() !=
-                        2) {
-                        std::cerr
-                            << "RenderManager::ComputeDistortionMesh: Need "
-                                "2 "
-                            << "points in the mesh, found "
-                            << distort.m_rgbPointSamples[clr][eye][i].size()
-                            << std::endl;
-                        return ret;
-                    }
-                    if (distort.m_rgbPointSamples[clr][eye][i][0].size() !=
-                        2) {
-                        std::cerr
-                            << "RenderManager::ComputeDistortionMesh: Need "
-                                "2 "
-                            << "values in input point, found "
-                            << distort.m_rgbPointSamples[clr][eye][i][0]
-                                    .size()
-                            << std::endl;
-                        return ret;
-                    }
-                    if (distort.m_rgbPointSamples[clr][eye][i][1].size() !=
-                        2) {
-                        std::cerr
-                            << "RenderManager::ComputeDistortionMesh: Need "
-                                "2 "
-                            << "values in output point, found "
-                            << distort.m_rgbPointSamples[clr][eye][i][1]
-                                    .size()
-                            << std::endl;
-                        return ret;
-                    }
-                }
 
                 // Add a new interpolator to be used when we're finding
                 // mesh coordinates, one per eye.
-                m_interpolators.emplace_back(new
-                  UnstructuredMeshInterpolator(distort.m_rgbPointSamples[clr][eye]));
+                m_interpolators.emplace_back(
+                    new UnstructuredMeshInterpolator(points));
             }
         } else {
             std::cerr << "RenderManager::ComputeDistortionMesh: Unrecognized "
@@ -2382,33 +4115,263 @@ namespace renderkit {
         return ret;
     }
 
-    static std::string osvrRenderManagerGetString(OSVR_ClientContext context,
-                                                  const std::string& path) {
-        size_t len;
-        if (osvrClientGetStringParameterLength(context, path.c_str(), &len) ==
-            OSVR_RETURN_FAILURE) {
-            std::string msg =
-                std::string("Couldn't get osvr string length for path ") + path;
-            std::cerr << msg << std::endl;
-            throw std::runtime_error(msg);
+    bool RenderManager::ComputeDistortionMeshes(
+        DistortionMeshType type //< Type of mesh to produce
+        ,
+        std::vector<DistortionParameters> const&
+            distort //< Distortion parameters
+        ,
+        std::vector<DistortionMesh>& meshes //< Filled in, one per eye
+        ) {
+        size_t const numEyes = GetNumEyes();
+        if (numEyes > distort.size()) {
+            std::cerr << "RenderManager::ComputeDistortionMeshes: Not enough "
+                         "distortion parameters for all eyes"
+                      << std::endl;
+            return false;
+        }
+        meshes.clear();
+        meshes.reserve(numEyes);
+        for (size_t eye = 0; eye < numEyes; eye++) {
+            meshes.push_back(ComputeDistortionMesh(eye, type, distort[eye]));
+            if (meshes.back().vertices.empty()) {
+                std::cerr << "RenderManager::ComputeDistortionMeshes: Could "
+                             "not create mesh for eye "
+                          << eye << std::endl;
+                return false;
+            }
         }
+        return true;
+    }
 
-        // struct TempBuffer {
-        //    char *buffer;
-        //    TempBuffer(size_t len) { buffer = new char[len + 1]; }
-        //    ~TempBuffer() { delete[] buffer; }
-        //} tempBuffer(len);
-        std::vector<char> tempBuffer(len + 1);
+    bool RenderManager::BuildDistortionMeshesInternal(
+        DistortionMeshType type //< Type of mesh to produce
+        ,
+        std::vector<DistortionParameters> const&
+            distort //< Distortion parameters
+        ,
+        bool fallback //< Install an undistorted mesh meanwhile?
+        ) {
+        if (!m_params.m_backgroundDistortionMeshes ||
+            !SetDistortionMeshesSupported()) {
+            return UpdateDistortionMeshesInternal(type, distort);
+        }
+
+        // An undistorted mesh of two triangles is quick to make, and lets
+        // the application show something right away.
+        if (fallback) {
+            DistortionParameters identity;
+            identity.m_desiredTriangles = 2;
+            std::vector<DistortionParameters> identities(GetNumEyes(),
+                                                         identity);
+            std::vector<DistortionMesh> meshes;
+            if (!ComputeDistortionMeshes(SQUARE, identities, meshes) ||
+                !SetDistortionMeshesInternal(meshes)) {
+                std::cerr << "RenderManager::BuildDistortionMeshesInternal: "
+                             "Could not construct fallback distortion mesh"
+                          << std::endl;
+                return false;
+            }
+        }
+
+        // The thread gets its own copy of the parameters, which the caller
+        // may not keep around.
+        StopBackgroundDistortionMeshes();
+        m_backgroundMeshes.done = false;
+        m_backgroundMeshes.thread = std::thread([this, type, distort] {
+            {
+                TraceScope trace(m_trace.get(),
+                                 "ComputeDistortionMeshesInBackground");
+                m_backgroundMeshes.succeeded = ComputeDistortionMeshes(
+                    type, distort, m_backgroundMeshes.meshes);
+            }
+            m_backgroundMeshes.done = true;
+        });
+        return true;
+    }
+
+    void RenderManager::SwapInBackgroundDistortionMeshes() {
+        if (!m_backgroundMeshes.thread.joinable() ||
+            !m_backgroundMeshes.done) {
+            return;
+        }
+        m_backgroundMeshes.thread.join();
+        TraceScope trace(m_trace.get(), "SwapInDistortionMeshes");
+
+        // If the meshes could not be made, there is nothing better than
+        // what we are already presenting with, so we keep going with it.
+        if (!m_backgroundMeshes.succeeded ||
+            !SetDistortionMeshesInternal(m_backgroundMeshes.meshes)) {
+            std::cerr << "RenderManager::SwapInBackgroundDistortionMeshes: "
+                         "Could not construct distortion meshes, continuing "
+                         "without them"
+                      << std::endl;
+        }
+        m_backgroundMeshes.meshes.clear();
+    }
 
+    void RenderManager::StopBackgroundDistortionMeshes() {
+        if (m_backgroundMeshes.thread.joinable()) {
+            m_backgroundMeshes.thread.join();
+        }
+        m_backgroundMeshes.meshes.clear();
+    }
+
+    /// @brief Read a string parameter from the server if it has arrived.
+    /// @return True and fills in value if it has, false if not (yet).
+    static bool osvrRenderManagerTryGetString(OSVR_ClientContext context,
+                                              const std::string& path,
+                                              std::string& value) {
+        size_t len = 0;
+        if ((osvrClientGetStringParameterLength(context, path.c_str(), &len) ==
+             OSVR_RETURN_FAILURE) ||
+            (len == 0)) {
+            return false;
+        }
+        std::vector<char> tempBuffer(len + 1);
         if (osvrClientGetStringParameter(context, path.c_str(),
                                          tempBuffer.data(),
                                          len + 1) == OSVR_RETURN_FAILURE) {
-            std::string msg =
-                std::string("Couldn't get osvr string buffer for path ") + path;
-            std::cerr << msg << std::endl;
-            throw std::runtime_error(msg);
+            return false;
+        }
+        value = tempBuffer.data();
+        return true;
+    }
+
+    /// @brief Pump the client context until the server has sent the
+    /// /renderManagerConfig and /display strings, reading each as soon as
+    /// it arrives.  The wait between updates starts at 1 ms and doubles up
+    /// to 32 ms, so a running server is heard from almost at once without
+    /// spinning while one starts up.  Complaints about waiting also come
+    /// less and less often.
+    /// @param timeout Seconds to give up after (0 = wait forever).
+    /// @return True if both arrived, false if not.
+    static bool connectToServer(OSVR_ClientContext context, double timeout,
+                                std::string& configString,
+                                std::string& displayString) {
+        typedef std::chrono::steady_clock Clock;
+        Clock::time_point start = Clock::now();
+        std::chrono::milliseconds wait(1);
+        const std::chrono::milliseconds maxWait(32);
+        double nextComplaint = 1;
+        bool haveConfig = false;
+        bool haveDisplay = false;
+        while (true) {
+            osvrClientUpdate(context);
+            if (!haveConfig) {
+                haveConfig = osvrRenderManagerTryGetString(
+                    context, "/renderManagerConfig", configString);
+            }
+            if (!haveDisplay) {
+                haveDisplay = osvrRenderManagerTryGetString(
+                    context, "/display", displayString);
+            }
+            double elapsed =
+                std::chrono::duration<double>(Clock::now() - start).count();
+            if (haveConfig && haveDisplay) {
+                std::cout << "createRenderManager(): Got configuration from "
+                             "server after "
+                          << elapsed * 1e3 << " ms" << std::endl;
+                return true;
+            }
+
+            // The two strings need not arrive in the same update, so we
+            // keep waiting for whichever is still missing.
+            const char* missing =
+                haveDisplay ? "/renderManagerConfig" : "Display";
+            if ((timeout > 0) && (elapsed >= timeout)) {
+                std::cerr << "createRenderManager(): Timed out after "
+                          << timeout << " seconds waiting to get " << missing
+                          << " from server" << std::endl;
+                return false;
+            }
+            if (elapsed >= nextComplaint) {
+                std::cerr << "createRenderManager(): Waiting to get "
+                          << missing << " from server..." << std::endl;
+                nextComplaint *= 2;
+            }
+            std::this_thread::sleep_for(wait);
+            wait = std::min(wait * 2, maxWait);
+        }
+    }
+
+    /// @brief Parse the /renderManagerConfig string for settings that the
+    /// osvr::client::RenderManagerConfig parser does not know about.
+    /// @return The "renderManagerConfig" member if there is one, the
+    /// top-level object if not, or a null value if it cannot be parsed.
+    static Json::Value
+    osvrRenderManagerGetConfigParams(const std::string& configString) {
+        Json::Reader reader;
+        Json::Value root;
+        if (!reader.parse(configString, root) || !root.isObject()) {
+            return Json::Value();
+        }
+        if (root.isMember("renderManagerConfig") &&
+            root["renderManagerConfig"].isObject()) {
+            return root["renderManagerConfig"];
+        }
+        return root;
+    }
+
+    /// @brief Fill in the present-thread scheduling parameters from the
+    /// "presentThread" section of the renderManagerConfig, if present.
+    /// @return True on success, false (with an error message) if the
+    /// section is invalid.
+    static bool
+    parsePresentThreadConfig(const Json::Value& params,
+                             RenderManager::ConstructorParameters& p) {
+        const Json::Value& section = params["presentThread"];
+        if (section.isNull()) {
+            return true;
+        }
+        if (!section.isObject()) {
+            std::cerr << "createRenderManager: presentThread in "
+                         "rendermanager config file is not an object"
+                      << std::endl;
+            return false;
+        }
+        std::string policy = section.get("schedulingPolicy", "default")
+                                 .asString();
+        if (policy == "fifo" || policy == "SCHED_FIFO") {
+            p.m_presentThreadScheduling =
+                RenderManager::ConstructorParameters::FIFOScheduling;
+        } else if (policy == "rr" || policy == "SCHED_RR") {
+            p.m_presentThreadScheduling =
+                RenderManager::ConstructorParameters::RoundRobinScheduling;
+        } else if (policy == "default") {
+            p.m_presentThreadScheduling =
+                RenderManager::ConstructorParameters::DefaultScheduling;
+        } else {
+            std::cerr << "createRenderManager: Unrecognized presentThread "
+                         "schedulingPolicy ("
+                      << policy << ") in rendermanager config file"
+                      << std::endl;
+            return false;
+        }
+        p.m_presentThreadPriority =
+            section.get("priority", p.m_presentThreadPriority).asInt();
+        p.m_presentThreadNice =
+            section.get("niceFallback", p.m_presentThreadNice).asInt();
+        p.m_presentThreadLockMemory =
+            section.get("lockMemory", p.m_presentThreadLockMemory).asBool();
+        p.m_presentThreadApplyToCaller =
+            section
+                .get("applyToApplicationThread",
+                     p.m_presentThreadApplyToCaller)
+                .asBool();
+        const Json::Value& cpus = section["cpuAffinity"];
+        p.m_presentThreadCPUs.clear();
+        if (cpus.isArray()) {
+            for (Json::ArrayIndex i = 0; i < cpus.size(); i++) {
+                p.m_presentThreadCPUs.push_back(cpus[i].asInt());
+            }
+        } else if (!cpus.isNull()) {
+            std::cerr << "createRenderManager: presentThread cpuAffinity in "
+                         "rendermanager config file is not an array"
+                      << std::endl;
+            return false;
         }
-        return std::string(tempBuffer.data(), len);
+        return true;
     }
 
     void
@@ -2496,40 +4459,36 @@ namespace renderkit {
     RenderManager* createRenderManager(OSVR_ClientContext contextParameter,
                                        const std::string& renderLibraryName,
                                        GraphicsLibrary graphicsLibrary) {
+        return createRenderManager(contextParameter, renderLibraryName,
+                                   graphicsLibrary, 0);
+    }
+
+    RenderManager* createRenderManager(OSVR_ClientContext contextParameter,
+                                       const std::string& renderLibraryName,
+                                       GraphicsLibrary graphicsLibrary,
+                                       double connectTimeoutSeconds) {
         // Null pointer return in case we can't open one.
         std::unique_ptr<RenderManager> ret;
 
-        // Wait until we get a connection to a display object, from which we
-        // will
-        // read information that we need about display device resolutions and
-        // distortion correction parameters.  Once we hear from the display
-        // device, we presume that we will also be able to read our
-        // RenderManager parameters.  Complain as we don't hear from the
-        // display device.
-        // @todo Verify that waiting for the display is sufficient to be
-        // sure we'll get the RenderManager string.
-        OSVR_ReturnCode displayReturnCode;
-        OSVR_DisplayConfig display;
-        std::chrono::time_point<std::chrono::system_clock> start, end;
-        start = std::chrono::system_clock::now();
-        do {
-          osvrClientUpdate(contextParameter);
-          displayReturnCode = osvrClientGetDisplay(contextParameter, &display);
-            end = std::chrono::system_clock::now();
-            std::chrono::duration<double> elapsed = end - start;
-            if (elapsed.count() >= 1) {
-                std::cerr << "RenderManager::createRenderManager(): Waiting to "
-                             "get Display from server..."
-                          << std::endl;
-                start = end;
-            }
-            std::this_thread::sleep_for(std::chrono::milliseconds(200));
-        } while (displayReturnCode == OSVR_RETURN_FAILURE);
-        std::cerr << "RenderManager::createRenderManager(): Got Display info "
-                     "from server "
-                     "(ignore earlier errors that occured while we were "
-                     "waiting to connect)"
-                  << std::endl;
+        // Wait until we hear from the server with the information that we
+        // need about display device resolutions and distortion correction
+        // parameters and our RenderManager parameters.  This waits as
+        // long as the caller asked for (0 for as long as it takes); the
+        // OSVR_RENDERMANAGER_CONNECT_TIMEOUT environment variable
+        // overrides that, for unattended use where a missing server should
+        // not mean a hang.
+        double connectTimeout = std::max(connectTimeoutSeconds, 0.0);
+        const char* timeoutString =
+            std::getenv("OSVR_RENDERMANAGER_CONNECT_TIMEOUT");
+        if (timeoutString != nullptr) {
+            connectTimeout = std::max(std::atof(timeoutString), 0.0);
+        }
+        std::string configString;
+        std::string displayString;
+        if (!connectToServer(contextParameter, connectTimeout, configString,
+                             displayString)) {
+            return nullptr;
+        }
 
         // Check the information in the pipeline configuration to determine
         // what kind of renderer to instantiate.  Also fill in the parameters
@@ -2545,8 +4504,6 @@ namespace renderkit {
             // C++ cross-dll boundary issue, and making it
             // a header-only lib might fix it, but we're moving the code here
             // for now.
-          std::string configString = osvrRenderManagerGetString(contextParameter,
-              "/renderManagerConfig");
             osvr::client::RenderManagerConfigPtr cfg(
                 new osvr::client::RenderManagerConfig(configString));
             pipelineConfig = cfg;
@@ -2578,6 +4535,9 @@ namespace renderkit {
         if (renderLibraryName == "OpenGLcore") {
             p.m_renderLibrary = "OpenGL";
             p.m_core = true;;
+        } else if (renderLibraryName == "OpenGLOffscreencore") {
+            p.m_renderLibrary = "OpenGLOffscreen";
+            p.m_core = true;
         } else {
             p.m_renderLibrary = renderLibraryName;
         }
@@ -2627,11 +4587,149 @@ namespace renderkit {
         p.m_clientPredictionLocalTimeOverride =
           pipelineConfig->getclientPredictionLocalTimeOverride();
 
-        std::string jsonString;
+        // Settings that RenderManagerConfig does not parse for us.
+        Json::Value extraParams =
+            osvrRenderManagerGetConfigParams(configString);
+        if (!parsePresentThreadConfig(extraParams, p)) {
+            return nullptr;
+        }
+        if (extraParams.isMember("presentQueueDepth")) {
+            int depth = extraParams["presentQueueDepth"].asInt();
+            if ((depth < 0) || (depth > 3)) {
+                std::cerr << "createRenderManager: presentQueueDepth ("
+                          << depth << ") in rendermanager config file must "
+                                      "be between 0 and 3"
+                          << std::endl;
+                return nullptr;
+            }
+            p.m_presentQueueDepth = static_cast<unsigned>(depth);
+        }
+        if (extraParams.isMember("refreshesPerFrame")) {
+            int refreshes = extraParams["refreshesPerFrame"].asInt();
+            if ((refreshes < 1) || (refreshes > 4)) {
+                std::cerr << "createRenderManager: refreshesPerFrame ("
+                          << refreshes << ") in rendermanager config file "
+                                          "must be between 1 and 4"
+                          << std::endl;
+                return nullptr;
+            }
+            p.m_refreshesPerFrame = static_cast<unsigned>(refreshes);
+        }
+        if (extraParams.isMember("traceFile")) {
+            p.m_traceFile = extraParams["traceFile"].asString();
+        }
+        if (extraParams.isMember("latencyLogSeconds")) {
+            p.m_latencyLogSeconds =
+                extraParams["latencyLogSeconds"].asDouble();
+        }
+        if (extraParams.isMember("glErrorChecking")) {
+            std::string mode = extraParams["glErrorChecking"].asString();
+            if (mode == "full") {
+                p.m_glErrorChecking =
+                    RenderManager::ConstructorParameters::FullGLErrorChecking;
+            } else if (mode == "debugOutput") {
+                p.m_glErrorChecking = RenderManager::ConstructorParameters::
+                    DebugOutputGLErrorChecking;
+            } else if (mode == "frameEnd") {
+                p.m_glErrorChecking = RenderManager::ConstructorParameters::
+                    FrameEndGLErrorChecking;
+            } else if (mode == "sampled") {
+                p.m_glErrorChecking = RenderManager::ConstructorParameters::
+                    SampledGLErrorChecking;
+            } else {
+                std::cerr << "createRenderManager: Unrecognized "
+                             "glErrorChecking ("
+                          << mode << ") in rendermanager config file"
+                          << std::endl;
+                return nullptr;
+            }
+        }
+        if (extraParams.isMember("glErrorCheckInterval")) {
+            int interval = extraParams["glErrorCheckInterval"].asInt();
+            if (interval < 1) {
+                std::cerr << "createRenderManager: glErrorCheckInterval ("
+                          << interval << ") in rendermanager config file "
+                                         "must be at least 1"
+                          << std::endl;
+                return nullptr;
+            }
+            p.m_glErrorCheckInterval = static_cast<unsigned>(interval);
+        }
+        if (extraParams.isMember("recordInputFile")) {
+            p.m_recordInputFile = extraParams["recordInputFile"].asString();
+        }
+        if (extraParams.isMember("replayInputFile")) {
+            p.m_replayInputFile = extraParams["replayInputFile"].asString();
+        }
+        if (extraParams.isMember("nullRefreshRate")) {
+            double rate = extraParams["nullRefreshRate"].asDouble();
+            if (rate < 0) {
+                std::cerr << "createRenderManager: nullRefreshRate (" << rate
+                          << ") in rendermanager config file must not be "
+                             "negative"
+                          << std::endl;
+                return nullptr;
+            }
+            p.m_nullRefreshRate = rate;
+        }
+        if (extraParams.isMember("softwareCompositorThreads")) {
+            int threads = extraParams["softwareCompositorThreads"].asInt();
+            if (threads < 0) {
+                std::cerr << "createRenderManager: softwareCompositorThreads ("
+                          << threads << ") in rendermanager config file "
+                                        "must not be negative"
+                          << std::endl;
+                return nullptr;
+            }
+            p.m_softwareCompositorThreads = static_cast<unsigned>(threads);
+        }
+        if (extraParams.isMember("captureBuffers")) {
+            int buffers = extraParams["captureBuffers"].asInt();
+            if ((buffers < 0) || (buffers > 8)) {
+                std::cerr << "createRenderManager: captureBuffers ("
+                          << buffers << ") in rendermanager config file "
+                                        "must be between 0 and 8"
+                          << std::endl;
+                return nullptr;
+            }
+            p.m_captureBuffers = static_cast<unsigned>(buffers);
+        }
+        if (extraParams.isMember("captureDownscale")) {
+            int downscale = extraParams["captureDownscale"].asInt();
+            if (downscale < 1) {
+                std::cerr << "createRenderManager: captureDownscale ("
+                          << downscale << ") in rendermanager config file "
+                                          "must be at least 1"
+                          << std::endl;
+                return nullptr;
+            }
+            p.m_captureDownscale = static_cast<unsigned>(downscale);
+        }
+        if (extraParams.isMember("captureEye")) {
+            p.m_captureEye = extraParams["captureEye"].asInt();
+            if (p.m_captureEye < -1) {
+                std::cerr << "createRenderManager: captureEye ("
+                          << p.m_captureEye << ") in rendermanager config "
+                                               "file must be -1 (all) or "
+                                               "an eye index"
+                          << std::endl;
+                return nullptr;
+            }
+        }
+        if (extraParams.isMember("backgroundDistortionMeshes")) {
+            p.m_backgroundDistortionMeshes =
+                extraParams["backgroundDistortionMeshes"].asBool();
+        }
+        if (!p.m_recordInputFile.empty() && !p.m_replayInputFile.empty()) {
+            std::cerr << "createRenderManager: Cannot both record "
+                         "(recordInputFile) and replay (replayInputFile) "
+                         "input"
+                      << std::endl;
+            return nullptr;
+        }
+
         try {
-            std::string jsonString =
-              osvrRenderManagerGetString(contextParameter, "/display");
-            OSVRDisplayConfiguration displayConfig(jsonString);
+            OSVRDisplayConfiguration displayConfig(displayString);
             p.m_displayConfiguration = displayConfig;
         } catch (std::exception& /*e*/) {
             std::cerr << "createRenderManager: Could not parse /display string "
@@ -2779,8 +4877,8 @@ namespace renderkit {
                    OSVRDisplayConfiguration::MONO_POINT_SAMPLES) {
             distortion.m_type = osvr::renderkit::RenderManager::
                 DistortionParameters::Type::mono_point_samples;
-            distortion.m_monoPointSamples =
-                p.m_displayConfiguration.getDistortionMonoPointMeshes();
+            distortion.m_monoPointMeshSamples =
+                p.m_displayConfiguration.getDistortionMonoPointSamples();
             // Push back the same parameter set for both eyes; the parameter has
             // a vector that has info for each eye, and the code that uses this
             // will select the right one.
@@ -2793,8 +4891,8 @@ namespace renderkit {
                    OSVRDisplayConfiguration::RGB_POINT_SAMPLES) {
             distortion.m_type = osvr::renderkit::RenderManager::
                 DistortionParameters::Type::rgb_point_samples;
-            distortion.m_rgbPointSamples =
-                p.m_displayConfiguration.getDistortionRGBPointMeshes();
+            distortion.m_rgbPointMeshSamples =
+                p.m_displayConfiguration.getDistortionRGBPointSamples();
             // Push back the same parameter set for both eyes; the parameter has
             // a vector that has info for each eye, and the code that uses this
             // will select the right one.
@@ -2825,6 +4923,10 @@ namespace renderkit {
               if (p.m_asynchronousTimeWarp) {
                 RenderManager::ConstructorParameters pTemp = p;
                 pTemp.m_graphicsLibrary.D3D11 = nullptr;
+                // Only the time-warp thread presents with the wrapped one.
+                pTemp.m_presentThreadApplyToCaller = true;
+                pTemp.m_recordInputFile.clear();
+                pTemp.m_replayInputFile.clear();
                 auto wrappedRm = openRenderManagerDirectMode(contextParameter, pTemp);
                 ret.reset(new RenderManagerD3D11ATW(contextParameter, p, wrappedRm));
               } else {
@@ -2858,6 +4960,10 @@ namespace renderkit {
                 RenderManager::ConstructorParameters p2 = p;
                 p2.m_renderLibrary = "Direct3D11";
                 p2.m_directMode = true;
+                // Only the outermost RenderManager reads inputs through
+                // the log.
+                p2.m_recordInputFile.clear();
+                p2.m_replayInputFile.clear();
 
                 // @todo This needs to be fixed elsewhere, and generalized to
                 // work with all forms of distortion correction.
@@ -2904,6 +5010,8 @@ namespace renderkit {
                 if (p.m_asynchronousTimeWarp) {
                   RenderManager::ConstructorParameters pTemp = p2;
                   pTemp.m_graphicsLibrary.D3D11 = nullptr;
+                  // Only the time-warp thread presents with the wrapped one.
+                  pTemp.m_presentThreadApplyToCaller = true;
                   auto wrappedRm = openRenderManagerDirectMode(contextParameter, pTemp);
                   host.reset(new RenderManagerD3D11ATW(contextParameter, p2, wrappedRm));
                 } else {
@@ -2936,6 +5044,25 @@ namespace renderkit {
                 return nullptr;
 #endif
             }
+        } else if (p.m_renderLibrary == "OpenGLOffscreen") {
+            // Has no windows, so DirectMode and asynchronous time warp do
+            // not apply.
+#ifdef RM_USE_OPENGL_EGL
+            ret.reset(new RenderManagerOpenGLOffscreen(contextParameter, p));
+#else
+            std::cerr << "createRenderManager: OpenGLOffscreen render "
+                         "library not compiled in"
+                      << std::endl;
+            return nullptr;
+#endif
+        } else if (p.m_renderLibrary == "Null") {
+            // Needs no window or device, so DirectMode and asynchronous
+            // time warp do not apply.
+            ret.reset(new RenderManagerNull(contextParameter, p));
+        } else if (p.m_renderLibrary == "Software") {
+            // Composites on the CPU into images in memory, so DirectMode
+            // and asynchronous time warp do not apply either.
+            ret.reset(new RenderManagerSoftware(contextParameter, p));
         } else {
             std::cerr << "createRenderManager: Unrecognized render library: "
                       << p.m_renderLibrary << std::endl;
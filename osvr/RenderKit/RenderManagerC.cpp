@@ -46,8 +46,7 @@ osvrRenderManagerGetNumRenderInfo(OSVR_RenderManager renderManager,
     osvr::renderkit::RenderManager::RenderParams _renderParams;
     ConvertRenderParams(renderParams, _renderParams);
     auto rm = reinterpret_cast<osvr::renderkit::RenderManager*>(renderManager);
-    auto ri = rm->GetRenderInfo(_renderParams);
-    *numRenderInfoOut = ri.size();
+    *numRenderInfoOut = rm->LatchRenderInfo(_renderParams);
     return OSVR_RETURN_SUCCESS;
 }
 
@@ -127,3 +126,64 @@ OSVR_ReturnCode osvrRenderManagerPresentSolidColorf(
   return success ? OSVR_RETURN_SUCCESS : OSVR_RETURN_FAILURE;
 }
 
+OSVR_ReturnCode
+osvrRenderManagerGetTimingInfo(OSVR_RenderManager renderManager,
+                               size_t whichEye,
+                               OSVR_RenderTimingInfo* timingInfoOut) {
+    auto rm = reinterpret_cast<osvr::renderkit::RenderManager*>(renderManager);
+    osvr::renderkit::RenderTimingInfo timingInfo;
+    if (!timingInfoOut || !rm->GetTimingInfo(whichEye, timingInfo)) {
+        return OSVR_RETURN_FAILURE;
+    }
+    ConvertTimingInfo(timingInfo, *timingInfoOut);
+    return OSVR_RETURN_SUCCESS;
+}
+
+OSVR_ReturnCode
+osvrRenderManagerGetFrameTimingRecords(OSVR_RenderManager renderManager,
+                                       OSVR_FrameTimingRecord* recordsOut,
+                                       size_t maxRecords,
+                                       size_t* numRecordsOut) {
+    auto rm = reinterpret_cast<osvr::renderkit::RenderManager*>(renderManager);
+    if (!numRecordsOut || (!recordsOut && (maxRecords > 0))) {
+        return OSVR_RETURN_FAILURE;
+    }
+    // Convert each record straight into the caller's array.
+    auto convert = [](void* userData, size_t index,
+                      const osvr::renderkit::FrameTimingRecord& record) {
+        ConvertFrameTimingRecord(
+            record, static_cast<OSVR_FrameTimingRecord*>(userData)[index]);
+    };
+    size_t numRecords = 0;
+    if (!rm->GetFrameTimingRecords(convert, recordsOut, maxRecords,
+                                   numRecords)) {
+        return OSVR_RETURN_FAILURE;
+    }
+    *numRecordsOut = numRecords;
+    return OSVR_RETURN_SUCCESS;
+}
+
+OSVR_ReturnCode
+osvrRenderManagerGetFrameTimingStats(OSVR_RenderManager renderManager,
+                                     OSVR_FrameTimingStats* statsOut) {
+    auto rm = reinterpret_cast<osvr::renderkit::RenderManager*>(renderManager);
+    osvr::renderkit::FrameTimingStats stats;
+    if (!statsOut || !rm->GetFrameTimingStats(stats)) {
+        return OSVR_RETURN_FAILURE;
+    }
+    ConvertFrameTimingStats(stats, *statsOut);
+    return OSVR_RETURN_SUCCESS;
+}
+
+OSVR_ReturnCode
+osvrRenderManagerGetFrameDropStats(OSVR_RenderManager renderManager,
+                                   OSVR_FrameDropStats* statsOut) {
+    auto rm = reinterpret_cast<osvr::renderkit::RenderManager*>(renderManager);
+    osvr::renderkit::FrameDropStats stats;
+    if (!statsOut || !rm->GetFrameDropStats(stats)) {
+        return OSVR_RETURN_FAILURE;
+    }
+    ConvertFrameDropStats(stats, *statsOut);
+    return OSVR_RETURN_SUCCESS;
+}
+
@@ -98,7 +98,67 @@ typedef enum {
     OSVR_OPEN_STATUS_COMPLETE
 } OSVR_OpenStatus;
 
-// @todo OSVR_RenderTimingInfo
+//=========================================================================
+/// Timing of the display.  Times will be (0,0) if they are not available
+/// from a particular RenderManager.
+typedef struct OSVR_RenderTimingInfo {
+    OSVR_TimeValue hardwareDisplayInterval; //< Time between refreshes
+    OSVR_TimeValue timeSincelastVerticalRetrace; //< Time since the last
+    // retrace ended (the last presentation)
+    OSVR_TimeValue timeUntilNextPresentRequired; //< How long until images
+    // must be sent to be displayed at the next retrace
+} OSVR_RenderTimingInfo;
+
+//=========================================================================
+/// Timestamps for the stages of one present, oldest stage first.  Times
+/// that do not apply have the value (0,0): the pose read when time warp
+/// is off, and eyes past numEyes.  GPU durations are 0 until the GPU has
+/// reported them, a few frames later, or if timer queries are not
+/// supported.
+#define OSVR_FRAME_TIMING_MAX_EYES 4
+typedef struct OSVR_FrameTimingRecord {
+    uint64_t frame;      //< Sequence number of the present
+    OSVR_CBool repeat;   //< Re-presentation of an earlier frame?
+    OSVR_TimeValue presentEntry;  //< Present started
+    OSVR_TimeValue vsyncWaitExit; //< Done waiting for time-warp window
+    OSVR_TimeValue poseLatch;     //< Poses for time warp read
+    OSVR_TimeValue warpComputed;  //< Time-warp matrices computed
+    size_t numEyes;               //< Eyes with submission times below
+    OSVR_TimeValue eyeSubmitStart[OSVR_FRAME_TIMING_MAX_EYES];
+    OSVR_TimeValue eyeSubmitEnd[OSVR_FRAME_TIMING_MAX_EYES];
+    OSVR_TimeValue swapReturn; //< Buffers swapped and frame finalized
+    double gpuPresentSeconds;  //< GPU time, first draw to last draw
+    double gpuEyeSeconds[OSVR_FRAME_TIMING_MAX_EYES]; //< GPU time per eye
+} OSVR_FrameTimingRecord;
+
+/// Distribution of one stage's duration, in seconds
+typedef struct OSVR_FrameTimingPercentiles {
+    double p50;
+    double p90;
+    double p99;
+    double max;
+} OSVR_FrameTimingPercentiles;
+
+/// Rolling statistics over the frame-timing history
+typedef struct OSVR_FrameTimingStats {
+    size_t frames; //< Number of records summarized
+    OSVR_FrameTimingPercentiles presentSeconds;   //< Entry to swap return
+    OSVR_FrameTimingPercentiles vsyncWaitSeconds; //< Entry to wait exit
+    OSVR_FrameTimingPercentiles warpSeconds; //< Wait exit to warp computed
+    OSVR_FrameTimingPercentiles submitSeconds; //< First to last eye submit
+    OSVR_FrameTimingPercentiles swapSeconds;   //< Last eye to swap return
+    OSVR_FrameTimingPercentiles poseToSwapSeconds; //< Pose read to swap
+    OSVR_FrameTimingPercentiles gpuPresentSeconds; //< GPU present pass
+} OSVR_FrameTimingStats;
+
+/// Counts of refreshes that did not show a new frame on time, by cause.
+/// Only detected with vertical sync.
+typedef struct OSVR_FrameDropStats {
+    uint64_t presents;         //< Presents completed
+    uint64_t appMisses;        //< Application frame arrived late
+    uint64_t compositorMisses; //< Present did not finish in time
+    uint64_t lateWarps;        //< Time warp finished too late
+} OSVR_FrameDropStats;
 
 OSVR_RENDERMANAGER_EXPORT OSVR_ReturnCode
 osvrDestroyRenderManager(OSVR_RenderManager renderManager);
@@ -161,6 +221,32 @@ osvrRenderManagerPresentSolidColorf(
     OSVR_RenderManager renderManager,
     OSVR_RGB_FLOAT rgb);
 
+/// Reads the timing of the display that the given eye is on.
+OSVR_RENDERMANAGER_EXPORT OSVR_ReturnCode osvrRenderManagerGetTimingInfo(
+    OSVR_RenderManager renderManager, size_t whichEye,
+    OSVR_RenderTimingInfo* timingInfoOut);
+
+/// Copies up to maxRecords of the newest per-present timing records
+/// (RenderManager keeps the last 256) into recordsOut, oldest first,
+/// and sets numRecordsOut to the number copied.
+OSVR_RENDERMANAGER_EXPORT OSVR_ReturnCode
+osvrRenderManagerGetFrameTimingRecords(OSVR_RenderManager renderManager,
+                                       OSVR_FrameTimingRecord* recordsOut,
+                                       size_t maxRecords,
+                                       size_t* numRecordsOut);
+
+/// Reads percentiles of each present stage's duration over the
+/// frame-timing history.  Fails if nothing has been presented yet.
+OSVR_RENDERMANAGER_EXPORT OSVR_ReturnCode
+osvrRenderManagerGetFrameTimingStats(OSVR_RenderManager renderManager,
+                                     OSVR_FrameTimingStats* statsOut);
+
+/// Reads the counts of missed refreshes since the RenderManager was
+/// created.
+OSVR_RENDERMANAGER_EXPORT OSVR_ReturnCode
+osvrRenderManagerGetFrameDropStats(OSVR_RenderManager renderManager,
+                                   OSVR_FrameDropStats* statsOut);
+
 OSVR_EXTERN_C_END
 
 #endif
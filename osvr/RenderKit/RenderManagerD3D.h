@@ -74,7 +74,8 @@ namespace renderkit {
         friend RenderManager OSVR_RENDERMANAGER_EXPORT*
         createRenderManager(OSVR_ClientContext context,
                             const std::string& renderLibraryName,
-                            GraphicsLibrary graphicsLibrary);
+                            GraphicsLibrary graphicsLibrary,
+                            double connectTimeoutSeconds);
     };
 
 } // namespace renderkit
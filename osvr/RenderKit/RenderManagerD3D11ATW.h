@@ -28,6 +28,7 @@ Sensics, Inc.
 #include "RenderManagerD3DBase.h"
 #include "RenderManagerOpenGL.h"
 #include "GraphicsLibraryD3D11.h"
+#include "RenderManagerTrace.h"
 
 #include <vector>
 #include <string>
@@ -75,6 +76,10 @@ namespace osvr {
                 bool flipInY;
             } mNextFrameInfo;
 
+            /// The ATW thread's copies of mNextFrameInfo.renderBuffers,
+            /// rebuilt each refresh in storage that is reused.
+            std::vector<osvr::renderkit::RenderBuffer> mAtwRenderBuffers;
+
             bool mQuit = false;
             bool mStarted = false;
             bool mFirstFramePresented = false;
@@ -362,15 +367,16 @@ namespace osvr {
                         // Lock our mutex so that we're not rendering while new buffers are
                         // being presented.
                         std::lock_guard<std::mutex> lock(mLock);
+                        TraceScope trace(m_trace.get(), "TimeWarpIteration");
                         if (mFirstFramePresented) {
                             // Update the context so we get our callbacks called and
                             // update tracker state, which will be read during the
                             // time-warp calculation in our harnessed RenderManager.
-                            osvrClientUpdate(mRenderManager->m_context);
+                            mRenderManager->ClientUpdateInternal();
 
                             {
-                                // make a new RenderBuffers array with the atw thread's buffers
-                                std::vector<osvr::renderkit::RenderBuffer> atwRenderBuffers;
+                                // fill in the RenderBuffers array with the atw thread's buffers
+                                mAtwRenderBuffers.clear();
                                 for (size_t i = 0; i < mNextFrameInfo.renderBuffers.size(); i++) {
                                     auto key = mNextFrameInfo.renderBuffers[i].D3D11;
                                     auto bufferInfoItr = mBufferMap.find(key);
@@ -379,14 +385,14 @@ namespace osvr {
                                         m_doingOkay = false;
                                         mQuit = true;
                                     }
-                                    atwRenderBuffers.push_back(bufferInfoItr->second.atwBuffer);
+                                    mAtwRenderBuffers.push_back(bufferInfoItr->second.atwBuffer);
                                 }
 
                                 // Send the rendered results to the screen, using the
                                 // RenderInfo that was handed to us by the client the last
                                 // time they gave us some images.
                                 if (!mRenderManager->PresentRenderBuffers(
-                                    atwRenderBuffers,
+                                    mAtwRenderBuffers,
                                     mNextFrameInfo.renderInfo,
                                     mNextFrameInfo.renderParams,
                                     mNextFrameInfo.normalizedCroppingViewports,
@@ -630,7 +636,8 @@ namespace osvr {
             friend RenderManager OSVR_RENDERMANAGER_EXPORT*
                 createRenderManager(OSVR_ClientContext context,
                 const std::string& renderLibraryName,
-                GraphicsLibrary graphicsLibrary);
+                GraphicsLibrary graphicsLibrary,
+                double connectTimeoutSeconds);
         };
     }
 }
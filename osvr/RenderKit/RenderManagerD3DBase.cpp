@@ -175,6 +175,17 @@ namespace renderkit {
           m_completionQuery = nullptr;
         }
 
+        for (auto& queries : m_gpuTimerQueries) {
+          if (queries.disjoint) {
+            queries.disjoint->Release();
+          }
+          for (auto query : queries.timestamps) {
+            if (query) {
+              query->Release();
+            }
+          }
+        }
+
         delete m_buffers.D3D11;
         delete m_library.D3D11;
     }
@@ -223,9 +234,106 @@ namespace renderkit {
         }
       }
 
+      //======================================================
+      // Construct the queries used to time the present pass on the GPU.
+      // If any of them can't be made, we just don't time it.
+      {
+        m_gpuTimerSupported = true;
+        D3D11_QUERY_DESC disjointDesc = {};
+        disjointDesc.Query = D3D11_QUERY_TIMESTAMP_DISJOINT;
+        D3D11_QUERY_DESC timestampDesc = {};
+        timestampDesc.Query = D3D11_QUERY_TIMESTAMP;
+        for (auto& queries : m_gpuTimerQueries) {
+          if (FAILED(m_D3D11device->CreateQuery(&disjointDesc,
+                                                &queries.disjoint))) {
+            queries.disjoint = nullptr;
+            m_gpuTimerSupported = false;
+          }
+          for (auto& query : queries.timestamps) {
+            if (FAILED(m_D3D11device->CreateQuery(&timestampDesc, &query))) {
+              query = nullptr;
+              m_gpuTimerSupported = false;
+            }
+          }
+        }
+        if (!m_gpuTimerSupported) {
+          std::cerr << "RenderManagerD3D11Base::SetDeviceAndContext: "
+            "Warning: Failed to create timestamp queries, so GPU present "
+            "times will not be reported" << std::endl;
+        }
+      }
+
       return true;
     }
 
+    bool RenderManagerD3D11Base::GPUTimerBegin(size_t slot) {
+        if (!m_gpuTimerSupported) {
+            return false;
+        }
+        // A present that failed part-way can leave a set open.
+        if (m_gpuTimerActive) {
+            m_D3D11Context->End(m_gpuTimerActive);
+        }
+        GPUTimerQueries& queries = m_gpuTimerQueries[slot];
+        m_D3D11Context->Begin(queries.disjoint);
+        m_gpuTimerActive = queries.disjoint;
+        m_D3D11Context->End(queries.timestamps[GPU_TIMER_FRAME_START]);
+        return true;
+    }
+
+    void RenderManagerD3D11Base::GPUTimerMark(size_t slot, size_t mark) {
+        // Timestamp queries are written by End() alone.
+        m_D3D11Context->End(m_gpuTimerQueries[slot].timestamps[mark]);
+    }
+
+    void RenderManagerD3D11Base::GPUTimerEnd(size_t slot) {
+        GPUTimerQueries& queries = m_gpuTimerQueries[slot];
+        m_D3D11Context->End(queries.timestamps[GPU_TIMER_FRAME_END]);
+        m_D3D11Context->End(queries.disjoint);
+        m_gpuTimerActive = nullptr;
+    }
+
+    bool RenderManagerD3D11Base::GPUTimerRead(size_t slot, size_t numEyes,
+                                              double* seconds, bool& valid) {
+        valid = false;
+        GPUTimerQueries& queries = m_gpuTimerQueries[slot];
+
+        // We never flush or wait here; the swap will flush.
+        D3D11_QUERY_DATA_TIMESTAMP_DISJOINT disjoint;
+        HRESULT hr = m_D3D11Context->GetData(
+            queries.disjoint, &disjoint, sizeof(disjoint),
+            D3D11_ASYNC_GETDATA_DONOTFLUSH);
+        if (hr == S_FALSE) {
+            return false;
+        }
+        if (FAILED(hr) || disjoint.Disjoint || (disjoint.Frequency == 0)) {
+            return true;
+        }
+
+        UINT64 start = 0;
+        hr = m_D3D11Context->GetData(
+            queries.timestamps[GPU_TIMER_FRAME_START], &start, sizeof(start),
+            D3D11_ASYNC_GETDATA_DONOTFLUSH);
+        if (hr != S_OK) {
+            return hr != S_FALSE;
+        }
+        double frequency = static_cast<double>(disjoint.Frequency);
+        size_t marks = GPU_TIMER_EYE_START + 2 * numEyes;
+        for (size_t mark = GPU_TIMER_FRAME_END; mark < marks; mark++) {
+            UINT64 ticks = 0;
+            hr = m_D3D11Context->GetData(queries.timestamps[mark], &ticks,
+                                         sizeof(ticks),
+                                         D3D11_ASYNC_GETDATA_DONOTFLUSH);
+            if (hr != S_OK) {
+                return hr != S_FALSE;
+            }
+            seconds[mark] = static_cast<double>(ticks - start) / frequency;
+        }
+        seconds[GPU_TIMER_FRAME_START] = 0;
+        valid = true;
+        return true;
+    }
+
     bool RenderManagerD3D11Base::constructRenderBuffers() {
         HRESULT hr;
         for (size_t i = 0; i < GetNumEyes(); i++) {
@@ -630,8 +738,8 @@ namespace renderkit {
     }
 
     bool RenderManagerD3D11Base::ComputeAsynchronousTimeWarps(
-        std::vector<RenderInfo> usedRenderInfo,
-        std::vector<RenderInfo> currentRenderInfo, float assumedDepth) {
+        const std::vector<RenderInfo>& usedRenderInfo,
+        const std::vector<RenderInfo>& currentRenderInfo, float assumedDepth) {
         /// @todo Make this and the base-class method share code rather than
         /// repeat
 
@@ -809,9 +917,14 @@ namespace renderkit {
         m_buffers.D3D11->depthStencilBuffer =
             m_renderBuffers[eye].D3D11->depthStencilBuffer;
 
-        // Set the viewport for rendering to this eye.
+        // Set the viewport for rendering to this eye.  We use the one from
+        // the RenderInfo so that any dynamic-resolution scale is applied.
         OSVR_ViewportDescription v;
-        ConstructViewportForRender(eye, v);
+        if (eye < m_renderInfoForRender.size()) {
+            v = m_renderInfoForRender[eye].viewport;
+        } else {
+            ConstructViewportForRender(eye, v);
+        }
         CD3D11_VIEWPORT viewport(
             static_cast<float>(v.left), static_cast<float>(v.lower),
             static_cast<float>(v.width), static_cast<float>(v.height));
@@ -1064,6 +1177,12 @@ namespace renderkit {
                       << std::endl;
             return false;
         }
+        if (params.m_plan == nullptr) {
+            std::cerr << "RenderManagerD3D11::PresentEye(): NULL present "
+                         "plan pointer"
+                      << std::endl;
+            return false;
+        }
 
         //-----------------------------------------------------------------
         // Record all state we change and re-set it to what it was
@@ -1271,16 +1390,7 @@ namespace renderkit {
         // example).
         // @todo think about how we get square pixels, to properly handle
         // distortion correction.
-        matrix16 modelViewMat;
-        if (!ComputeDisplayOrientationMatrix(
-                static_cast<float>(params.m_rotateDegrees), params.m_flipInY,
-                modelViewMat)) {
-            std::cerr << "RenderManagerD3D11Base::PresentEye(): "
-                         "ComputeDisplayOrientationMatrix failed"
-                      << std::endl;
-            return false;
-        }
-        DirectX::XMMATRIX modelView(modelViewMat.data);
+        DirectX::XMMATRIX modelView(params.m_plan->orientation.data);
 
         // Set up the texture matrix to handle asynchronous time warp.
         // We are able to use the matrix directly because it is using
@@ -1306,11 +1416,10 @@ namespace renderkit {
         // We read in, multiply by the transpose of the crop matrix (going from
         // OpenGL form to Direct3D requires a transpose), and write out
         // textureMat.
-        matrix16 crop;
-        ComputeRenderBufferCropMatrix(params.m_normalizedCroppingViewport,
-                                      crop);
         Eigen::Map<Eigen::Matrix4f> textureEi(textureMat);
-        textureEi = textureEi * Eigen::Matrix4f::Map(crop.data).transpose();
+        textureEi = textureEi *
+                    Eigen::Matrix4f::Map(params.m_plan->cropMatrix.data)
+                        .transpose();
 
         DirectX::XMMATRIX texture(textureMat);
         cbPerObject wvp = {projection, modelView, texture};
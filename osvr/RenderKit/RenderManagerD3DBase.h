@@ -35,6 +35,7 @@ Sensics, Inc.
 #include <DirectXMath.h>
 #endif
 
+#include <array>
 #include <vector>
 #include <string>
 
@@ -167,10 +168,10 @@ namespace renderkit {
 
         /// We can't use an OpenGL-compliant texture warp matrix, so need to
         /// override it here.
-        bool
-        ComputeAsynchronousTimeWarps(std::vector<RenderInfo> usedRenderInfo,
-                                     std::vector<RenderInfo> currentRenderInfo,
-                                     float assumedDepth = 2.0f) override;
+        bool ComputeAsynchronousTimeWarps(
+            const std::vector<RenderInfo>& usedRenderInfo,
+            const std::vector<RenderInfo>& currentRenderInfo,
+            float assumedDepth = 2.0f) override;
 
         //===================================================================
         // Overloaded render functions from the base class.  Not all of the
@@ -200,6 +201,23 @@ namespace renderkit {
         /// our buffers over to the ATW thread.
         ID3D11Query* m_completionQuery = nullptr;
 
+        //===================================================================
+        // Overloaded GPU-timing functions from the base class, which use
+        // timestamp queries inside a timestamp-disjoint query per frame.
+        bool GPUTimerBegin(size_t slot) override;
+        void GPUTimerMark(size_t slot, size_t mark) override;
+        void GPUTimerEnd(size_t slot) override;
+        bool GPUTimerRead(size_t slot, size_t numEyes, double* seconds,
+                          bool& valid) override;
+
+        struct GPUTimerQueries {
+            ID3D11Query* disjoint = nullptr; //< Gives the clock frequency
+            std::array<ID3D11Query*, GPU_TIMER_MARKS> timestamps = {};
+        };
+        std::array<GPUTimerQueries, GPU_TIMER_FRAMES> m_gpuTimerQueries;
+        bool m_gpuTimerSupported = false; //< All queries were created?
+        ID3D11Query* m_gpuTimerActive = nullptr; //< Begun but not ended
+
         friend class RenderManagerD3D11OpenGL;
         friend class RenderManagerD3D11ATW;
     };
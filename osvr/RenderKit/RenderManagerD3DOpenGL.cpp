@@ -532,11 +532,12 @@ namespace renderkit {
       return true;
     }
 
-    std::vector<RenderInfo> RenderManagerD3D11OpenGL::GetRenderInfoInternal(
-      const RenderParams& params) {
+    bool RenderManagerD3D11OpenGL::GetRenderInfoInternal(
+      const RenderParams& params, std::vector<RenderInfo>& ret) {
 
-      std::vector<RenderInfo> ret;
-      ret = RenderManager::GetRenderInfoInternal(params);
+      if (!RenderManager::GetRenderInfoInternal(params, ret)) {
+        return false;
+      }
 
       // We need to flip the projection information so that our output
       // images match those used by Direct3D, so we don't need to (1)
@@ -548,7 +549,7 @@ namespace renderkit {
         ret[i].projection.top = temp;
       }
 
-      return ret;
+      return true;
     }
 } // namespace renderkit
 } // namespace osvr
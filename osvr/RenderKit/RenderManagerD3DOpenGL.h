@@ -116,8 +116,8 @@ namespace renderkit {
         // flip the textures and (2) Modify the time warp calculations.
         // We flip this back again inside PresentRenderBuffers() so that
         // time warp is not confused by changing motion.
-        virtual std::vector<RenderInfo>
-          GetRenderInfoInternal(const RenderParams& params = RenderParams());
+        bool GetRenderInfoInternal(const RenderParams& params,
+                                   std::vector<RenderInfo>& info) override;
 
         // We use the render-buffer registration to construct
         // D3D buffers to be used for PresentMode, which we then map
@@ -143,7 +143,8 @@ namespace renderkit {
         friend RenderManager OSVR_RENDERMANAGER_EXPORT*
         createRenderManager(OSVR_ClientContext context,
                             const std::string& renderLibraryName,
-                            GraphicsLibrary graphicsLibrary);
+                            GraphicsLibrary graphicsLibrary,
+                            double connectTimeoutSeconds);
     };
 
 } // namespace renderkit
@@ -96,6 +96,74 @@ inline void ConvertRenderParams(
     renderParamsOut.worldFromRoomAppend = renderParams.worldFromRoomAppend;
 }
 
+inline void
+ConvertTimingInfo(const osvr::renderkit::RenderTimingInfo& timingInfo,
+                  OSVR_RenderTimingInfo& timingInfoOut) {
+    timingInfoOut.hardwareDisplayInterval = timingInfo.hardwareDisplayInterval;
+    timingInfoOut.timeSincelastVerticalRetrace =
+        timingInfo.timeSincelastVerticalRetrace;
+    timingInfoOut.timeUntilNextPresentRequired =
+        timingInfo.timeUntilNextPresentRequired;
+}
+
+inline void
+ConvertFrameTimingRecord(const osvr::renderkit::FrameTimingRecord& record,
+                         OSVR_FrameTimingRecord& recordOut) {
+    static_assert(OSVR_FRAME_TIMING_MAX_EYES ==
+                      osvr::renderkit::FRAME_TIMING_MAX_EYES,
+                  "C and C++ frame-timing records must hold the same eyes");
+    recordOut.frame = record.frame;
+    recordOut.repeat = record.repeat ? OSVR_TRUE : OSVR_FALSE;
+    recordOut.presentEntry = record.presentEntry;
+    recordOut.vsyncWaitExit = record.vsyncWaitExit;
+    recordOut.poseLatch = record.poseLatch;
+    recordOut.warpComputed = record.warpComputed;
+    recordOut.numEyes = record.numEyes;
+    for (size_t i = 0; i < OSVR_FRAME_TIMING_MAX_EYES; i++) {
+        recordOut.eyeSubmitStart[i] = record.eyeSubmitStart[i];
+        recordOut.eyeSubmitEnd[i] = record.eyeSubmitEnd[i];
+        recordOut.gpuEyeSeconds[i] = record.gpuEyeSeconds[i];
+    }
+    recordOut.swapReturn = record.swapReturn;
+    recordOut.gpuPresentSeconds = record.gpuPresentSeconds;
+}
+
+inline void ConvertFrameTimingPercentiles(
+    const osvr::renderkit::FrameTimingPercentiles& percentiles,
+    OSVR_FrameTimingPercentiles& percentilesOut) {
+    percentilesOut.p50 = percentiles.p50;
+    percentilesOut.p90 = percentiles.p90;
+    percentilesOut.p99 = percentiles.p99;
+    percentilesOut.max = percentiles.max;
+}
+
+inline void
+ConvertFrameTimingStats(const osvr::renderkit::FrameTimingStats& stats,
+                        OSVR_FrameTimingStats& statsOut) {
+    statsOut.frames = stats.frames;
+    ConvertFrameTimingPercentiles(stats.presentSeconds,
+                                  statsOut.presentSeconds);
+    ConvertFrameTimingPercentiles(stats.vsyncWaitSeconds,
+                                  statsOut.vsyncWaitSeconds);
+    ConvertFrameTimingPercentiles(stats.warpSeconds, statsOut.warpSeconds);
+    ConvertFrameTimingPercentiles(stats.submitSeconds,
+                                  statsOut.submitSeconds);
+    ConvertFrameTimingPercentiles(stats.swapSeconds, statsOut.swapSeconds);
+    ConvertFrameTimingPercentiles(stats.poseToSwapSeconds,
+                                  statsOut.poseToSwapSeconds);
+    ConvertFrameTimingPercentiles(stats.gpuPresentSeconds,
+                                  statsOut.gpuPresentSeconds);
+}
+
+inline void
+ConvertFrameDropStats(const osvr::renderkit::FrameDropStats& stats,
+                      OSVR_FrameDropStats& statsOut) {
+    statsOut.presents = stats.presents;
+    statsOut.appMisses = stats.appMisses;
+    statsOut.compositorMisses = stats.compositorMisses;
+    statsOut.lateWarps = stats.lateWarps;
+}
+
 template <class OSVR_GraphicsLibraryType, class OSVR_RenderManagerType>
 OSVR_ReturnCode
 osvrCreateRenderManagerImpl(OSVR_ClientContext clientContext,
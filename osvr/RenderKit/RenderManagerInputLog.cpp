@@ -0,0 +1,382 @@
+/** @file
+@brief Implementation of how RenderManager records the inputs it reads
+each frame, and replays them in place of the client context.
+
+@date 2026
+
+@author
+Sensics, Inc.
+<http://sensics.com/osvr>
+*/
+
+// Copyright 2026 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Internal Includes
+#include "RenderManagerInputLog.h"
+
+// Library/third-party includes
+// - none
+
+// Standard includes
+#include <cstring>
+#include <iostream>
+#include <iterator>
+#include <type_traits>
+
+namespace osvr {
+namespace renderkit {
+
+    /// File header: a magic number, the format version and a marker that
+    /// shows the byte order it was written in.
+    static const char LOG_MAGIC[8] = {'O', 'S', 'V', 'R', 'R', 'M', 'I', 'L'};
+    static const uint32_t LOG_VERSION = 1;
+    static const uint32_t LOG_BYTE_ORDER = 0x01020304;
+
+    /// Size of an entry's header once it has been sorted into its stream:
+    /// the kind, the index and the payload size.
+    static const size_t ENTRY_HEADER_SIZE = 1 + 4 + 4;
+
+    /// Flags saying which optional poses a recorded RenderParams has.
+    static const uint8_t PARAMS_WORLD_FROM_ROOM = 1;
+    static const uint8_t PARAMS_ROOM_FROM_HEAD = 2;
+
+    std::unique_ptr<InputLog>
+    InputLog::OpenForRecording(const std::string& fileName) {
+        std::unique_ptr<InputLog> ret(new InputLog());
+        ret->m_fileName = fileName;
+        ret->m_file.open(fileName.c_str(),
+                         std::ios::out | std::ios::trunc | std::ios::binary);
+        if (!ret->m_file) {
+            std::cerr << "InputLog::OpenForRecording(): Could not open "
+                      << fileName << std::endl;
+            return nullptr;
+        }
+        ret->m_file.write(LOG_MAGIC, sizeof(LOG_MAGIC));
+        ret->m_file.write(reinterpret_cast<const char*>(&LOG_VERSION),
+                          sizeof(LOG_VERSION));
+        ret->m_file.write(reinterpret_cast<const char*>(&LOG_BYTE_ORDER),
+                          sizeof(LOG_BYTE_ORDER));
+        return ret;
+    }
+
+    std::unique_ptr<InputLog>
+    InputLog::OpenForReplay(const std::string& fileName) {
+        std::ifstream file(fileName.c_str(), std::ios::in | std::ios::binary);
+        if (!file) {
+            std::cerr << "InputLog::OpenForReplay(): Could not open "
+                      << fileName << std::endl;
+            return nullptr;
+        }
+        std::vector<char> data((std::istreambuf_iterator<char>(file)),
+                               std::istreambuf_iterator<char>());
+
+        char magic[sizeof(LOG_MAGIC)];
+        uint32_t version, byteOrder;
+        size_t pos = sizeof(magic) + sizeof(version) + sizeof(byteOrder);
+        if (data.size() < pos) {
+            std::cerr << "InputLog::OpenForReplay(): " << fileName
+                      << " is too short to be an input log" << std::endl;
+            return nullptr;
+        }
+        memcpy(magic, &data[0], sizeof(magic));
+        memcpy(&version, &data[sizeof(magic)], sizeof(version));
+        memcpy(&byteOrder, &data[sizeof(magic) + sizeof(version)],
+               sizeof(byteOrder));
+        if (memcmp(magic, LOG_MAGIC, sizeof(magic)) != 0) {
+            std::cerr << "InputLog::OpenForReplay(): " << fileName
+                      << " is not an input log" << std::endl;
+            return nullptr;
+        }
+        if (byteOrder != LOG_BYTE_ORDER) {
+            std::cerr << "InputLog::OpenForReplay(): " << fileName
+                      << " was recorded on a machine with a different byte "
+                         "order"
+                      << std::endl;
+            return nullptr;
+        }
+        if (version != LOG_VERSION) {
+            std::cerr << "InputLog::OpenForReplay(): " << fileName
+                      << " is version " << version << ", expected "
+                      << LOG_VERSION << std::endl;
+            return nullptr;
+        }
+
+        // Sort the entries into their streams, dropping the stream byte.
+        std::unique_ptr<InputLog> ret(new InputLog());
+        ret->m_replaying = true;
+        ret->m_fileName = fileName;
+        while (pos < data.size()) {
+            uint32_t size;
+            if (pos + 1 + ENTRY_HEADER_SIZE > data.size()) {
+                break;
+            }
+            memcpy(&size, &data[pos + 1 + 1 + 4], sizeof(size));
+            size_t end = pos + 1 + ENTRY_HEADER_SIZE + size;
+            uint8_t stream = static_cast<uint8_t>(data[pos]);
+            if (end > data.size() || stream >= STREAMS) {
+                break;
+            }
+            std::vector<char>& to = ret->m_streams[stream].data;
+            to.insert(to.end(), data.begin() + pos + 1, data.begin() + end);
+            pos = end;
+        }
+        if (pos != data.size()) {
+            std::cerr << "InputLog::OpenForReplay(): Ignoring a truncated "
+                         "or damaged entry at the end of "
+                      << fileName << std::endl;
+        }
+        return ret;
+    }
+
+    InputLog::~InputLog() {
+        if (m_file.is_open()) {
+            m_file.close();
+        }
+    }
+
+    bool InputLog::ClientUpdate(Stream stream, OSVR_ReturnCode& result) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (!BeginEntry(stream, CLIENT_UPDATE, 0)) {
+            return false;
+        }
+        uint8_t code = static_cast<uint8_t>(result);
+        Transfer(stream, code);
+        result = static_cast<OSVR_ReturnCode>(code);
+
+        // When replaying, the first update lines the recorded clock up
+        // with the real one; every later time is shifted by the same
+        // amount.
+        OSVR_TimeValue now;
+        osvrTimeValueGetNow(&now);
+        OSVR_TimeValue recorded = now;
+        Transfer(stream, recorded);
+        if (m_replaying && !m_haveTimeShift && !m_finished) {
+            m_timeShift = now;
+            osvrTimeValueDifference(&m_timeShift, &recorded);
+            m_haveTimeShift = true;
+        }
+        return EndEntry(stream);
+    }
+
+    bool InputLog::Params(Stream stream, RenderManager::RenderParams& params) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (!BeginEntry(stream, PARAMS, 0)) {
+            return false;
+        }
+        uint8_t flags = 0;
+        if (params.worldFromRoomAppend) {
+            flags |= PARAMS_WORLD_FROM_ROOM;
+            m_worldFromRoom = *params.worldFromRoomAppend;
+        }
+        if (params.roomFromHeadReplace) {
+            flags |= PARAMS_ROOM_FROM_HEAD;
+            m_roomFromHead = *params.roomFromHeadReplace;
+        }
+        Transfer(stream, flags);
+        if (flags & PARAMS_WORLD_FROM_ROOM) {
+            Transfer(stream, m_worldFromRoom);
+        }
+        if (flags & PARAMS_ROOM_FROM_HEAD) {
+            Transfer(stream, m_roomFromHead);
+        }
+        Transfer(stream, params.nearClipDistanceMeters);
+        Transfer(stream, params.farClipDistanceMeters);
+        Transfer(stream, params.IPDMeters);
+        if (m_replaying) {
+            params.worldFromRoomAppend =
+                (flags & PARAMS_WORLD_FROM_ROOM) ? &m_worldFromRoom : nullptr;
+            params.roomFromHeadReplace =
+                (flags & PARAMS_ROOM_FROM_HEAD) ? &m_roomFromHead : nullptr;
+        }
+        return EndEntry(stream);
+    }
+
+    void InputLog::Pose(Stream stream, size_t index, OSVR_ReturnCode& result,
+                        OSVR_TimeValue& timestamp, OSVR_PoseState& pose) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (!BeginEntry(stream, POSE, static_cast<uint32_t>(index))) {
+            return;
+        }
+        uint8_t code = static_cast<uint8_t>(result);
+        Transfer(stream, code);
+        result = static_cast<OSVR_ReturnCode>(code);
+        TransferTimestamp(stream, timestamp);
+        Transfer(stream, pose);
+        EndEntry(stream);
+    }
+
+    void InputLog::Velocity(Stream stream, OSVR_ReturnCode& result,
+                            OSVR_TimeValue& timestamp,
+                            OSVR_VelocityState& velocity) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (!BeginEntry(stream, VELOCITY, 0)) {
+            return;
+        }
+        uint8_t code = static_cast<uint8_t>(result);
+        Transfer(stream, code);
+        result = static_cast<OSVR_ReturnCode>(code);
+        TransferTimestamp(stream, timestamp);
+        // Field by field, so the file does not depend on struct padding.
+        for (size_t i = 0; i < 3; i++) {
+            Transfer(stream, velocity.linearVelocity.data[i]);
+        }
+        Transfer(stream, velocity.linearVelocityValid);
+        for (size_t i = 0; i < 4; i++) {
+            Transfer(stream,
+                     velocity.angularVelocity.incrementalRotation.data[i]);
+        }
+        Transfer(stream, velocity.angularVelocity.dt);
+        Transfer(stream, velocity.angularVelocityValid);
+        EndEntry(stream);
+    }
+
+    void InputLog::TimingInfo(Stream stream, size_t eye, bool& valid,
+                              RenderTimingInfo& info) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (!BeginEntry(stream, TIMING_INFO, static_cast<uint32_t>(eye))) {
+            return;
+        }
+        uint8_t ok = valid ? 1 : 0;
+        Transfer(stream, ok);
+        valid = (ok != 0);
+        // These are all durations, so they are not shifted.
+        Transfer(stream, info.hardwareDisplayInterval);
+        Transfer(stream, info.timeSincelastVerticalRetrace);
+        Transfer(stream, info.timeUntilNextPresentRequired);
+        EndEntry(stream);
+    }
+
+    void InputLog::Now(Stream stream, OSVR_TimeValue& now) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (!BeginEntry(stream, NOW, 0)) {
+            return;
+        }
+        TransferTimestamp(stream, now);
+        EndEntry(stream);
+    }
+
+    bool InputLog::BeginEntry(Stream stream, Kind kind, uint32_t index) {
+        if (!m_replaying) {
+            if (!m_file.is_open()) {
+                return false;
+            }
+            uint8_t streamByte = static_cast<uint8_t>(stream);
+            uint8_t kindByte = kind;
+            uint32_t size = 0;
+            m_entry.clear();
+            Transfer(stream, streamByte);
+            Transfer(stream, kindByte);
+            Transfer(stream, index);
+            Transfer(stream, size);
+            return true;
+        }
+
+        if (m_finished) {
+            return false;
+        }
+        ReplayStream& r = m_streams[stream];
+        if (r.next + ENTRY_HEADER_SIZE > r.data.size()) {
+            Finish("reached the end of the log");
+            return false;
+        }
+        uint8_t kindByte = static_cast<uint8_t>(r.data[r.next]);
+        uint32_t entryIndex, size;
+        memcpy(&entryIndex, &r.data[r.next + 1], sizeof(entryIndex));
+        memcpy(&size, &r.data[r.next + 1 + 4], sizeof(size));
+        if (kindByte != kind || entryIndex != index) {
+            Finish("the log does not match the inputs being read (was it "
+                   "recorded with a different configuration?)");
+            return false;
+        }
+        r.read = r.next + ENTRY_HEADER_SIZE;
+        r.payloadEnd = r.read + size;
+        r.next = r.payloadEnd;
+        return true;
+    }
+
+    bool InputLog::EndEntry(Stream stream) {
+        if (m_replaying) {
+            return !m_finished;
+        }
+        uint32_t size =
+            static_cast<uint32_t>(m_entry.size() - 1 - ENTRY_HEADER_SIZE);
+        memcpy(&m_entry[1 + 1 + 4], &size, sizeof(size));
+        m_file.write(m_entry.data(), m_entry.size());
+        if (!m_file) {
+            std::cerr << "InputLog: Could not write to " << m_fileName
+                      << ", recording stopped" << std::endl;
+            m_file.close();
+        }
+        return true;
+    }
+
+    template <typename T> void InputLog::Transfer(Stream stream, T& value) {
+        static_assert(std::is_arithmetic<T>::value,
+                      "Only plain numbers are stored directly");
+        if (!m_replaying) {
+            const char* bytes = reinterpret_cast<const char*>(&value);
+            m_entry.insert(m_entry.end(), bytes, bytes + sizeof(value));
+            return;
+        }
+        if (m_finished) {
+            return;
+        }
+        ReplayStream& r = m_streams[stream];
+        if (r.read + sizeof(value) > r.payloadEnd) {
+            Finish("an entry in the log is too short");
+            return;
+        }
+        memcpy(&value, &r.data[r.read], sizeof(value));
+        r.read += sizeof(value);
+    }
+
+    void InputLog::Transfer(Stream stream, OSVR_TimeValue& value) {
+        int64_t seconds = value.seconds;
+        int32_t microseconds = value.microseconds;
+        Transfer(stream, seconds);
+        Transfer(stream, microseconds);
+        value.seconds = static_cast<OSVR_TimeValue_Seconds>(seconds);
+        value.microseconds =
+            static_cast<OSVR_TimeValue_Microseconds>(microseconds);
+    }
+
+    void InputLog::TransferTimestamp(Stream stream, OSVR_TimeValue& value) {
+        Transfer(stream, value);
+        // Zero means "no time", so leave it that way.
+        if (m_replaying && m_haveTimeShift &&
+            (value.seconds != 0 || value.microseconds != 0)) {
+            osvrTimeValueSum(&value, &m_timeShift);
+        }
+    }
+
+    void InputLog::Transfer(Stream stream, OSVR_PoseState& value) {
+        for (size_t i = 0; i < 3; i++) {
+            Transfer(stream, value.translation.data[i]);
+        }
+        for (size_t i = 0; i < 4; i++) {
+            Transfer(stream, value.rotation.data[i]);
+        }
+    }
+
+    void InputLog::Finish(const char* reason) {
+        if (!m_finished) {
+            std::cerr << "InputLog: Stopped replaying " << m_fileName << ": "
+                      << reason << std::endl;
+        }
+        m_finished = true;
+    }
+
+} // namespace renderkit
+} // namespace osvr
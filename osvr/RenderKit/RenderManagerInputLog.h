@@ -0,0 +1,174 @@
+/** @file
+@brief Header file describing how RenderManager records the inputs it
+reads each frame, and replays them in place of the client context.
+
+@date 2026
+
+@author
+Sensics, Inc.
+<http://sensics.com/osvr>
+*/
+
+// Copyright 2026 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+// Internal Includes
+#include "RenderManager.h"
+
+// Library/third-party includes
+#include <osvr/ClientKit/InterfaceStateC.h>
+#include <osvr/Util/TimeValueC.h>
+
+// Standard includes
+#include <array>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace osvr {
+namespace renderkit {
+
+    /// @brief Records everything RenderManager reads from the client
+    /// context (and the other inputs that change its output) to a compact
+    /// binary file, or plays such a file back in its place.
+    ///
+    /// Each method is called where RenderManager reads an input, with the
+    /// value it read.  When recording, the value is appended to the file;
+    /// when replaying, it is replaced by the next value from the file.
+    /// Inputs read by the presenter thread are kept in their own stream,
+    /// so that replay does not depend on how its work interleaved with the
+    /// application's.  When replaying, the whole file is read up front so
+    /// that the frame loop does no file I/O, and recorded times are
+    /// shifted so the first frame's clock reading matches the time the
+    /// replay started, keeping pose ages (and measured latency) realistic.
+    ///
+    /// The file is written in the host's byte order and is only meant to
+    /// be replayed on the same kind of machine.
+    class InputLog {
+      public:
+        /// @brief Which thread's inputs a call belongs to.
+        enum Stream { APPLICATION_STREAM = 0, PRESENT_STREAM = 1, STREAMS };
+
+        /// @brief Start recording to a file, replacing its contents.
+        ///  @return The log, or nullptr if the file cannot be opened.
+        static std::unique_ptr<InputLog>
+        OpenForRecording(const std::string& fileName);
+
+        /// @brief Read a file to replay.
+        ///  @return The log, or nullptr if the file cannot be read.
+        static std::unique_ptr<InputLog>
+        OpenForReplay(const std::string& fileName);
+
+        ~InputLog();
+
+        /// @brief Is this log replaying (rather than recording)?
+        bool Replaying() const { return m_replaying; }
+
+        /// @brief Record or replay the result of a client update.  The
+        /// application's stream also records when it happened.
+        ///  @return False when replaying and the log has run out or does
+        /// not match the calls being made, true otherwise.
+        bool ClientUpdate(Stream stream, OSVR_ReturnCode& result);
+
+        /// @brief Record or replay the parameters passed to Render() or
+        /// GetRenderInfo().  When replaying, the pose pointers point into
+        /// the log and are valid until the next call.
+        ///  @return False when replaying and the log has run out or does
+        /// not match the calls being made, true otherwise.
+        bool Params(Stream stream, RenderManager::RenderParams& params);
+
+        /// @brief Record or replay a read of the head's (index 0) or a
+        /// render-callback space's (index 1 + space) pose.
+        void Pose(Stream stream, size_t index, OSVR_ReturnCode& result,
+                  OSVR_TimeValue& timestamp, OSVR_PoseState& pose);
+
+        /// @brief Record or replay a read of the head's velocity.
+        void Velocity(Stream stream, OSVR_ReturnCode& result,
+                      OSVR_TimeValue& timestamp, OSVR_VelocityState& velocity);
+
+        /// @brief Record or replay a read of an eye's display timing.
+        void TimingInfo(Stream stream, size_t eye, bool& valid,
+                        RenderTimingInfo& info);
+
+        /// @brief Record or replay a reading of the clock.
+        void Now(Stream stream, OSVR_TimeValue& now);
+
+      private:
+        InputLog() = default;
+        InputLog(const InputLog&) = delete;
+        InputLog& operator=(const InputLog&) = delete;
+
+        /// @brief Kinds of entries.  Each entry in the file is the stream,
+        /// the kind, an index and the size of its payload, followed by the
+        /// payload.
+        enum Kind : uint8_t {
+            CLIENT_UPDATE = 1,
+            PARAMS,
+            POSE,
+            VELOCITY,
+            TIMING_INFO,
+            NOW
+        };
+
+        /// @brief Start an entry.  When replaying, checks that the next
+        /// entry in the stream is of this kind and index.
+        ///  @return False if the entry should be skipped.
+        bool BeginEntry(Stream stream, Kind kind, uint32_t index);
+
+        /// @brief Finish an entry, writing it out when recording.
+        ///  @return False if replaying and the entry was too short.
+        bool EndEntry(Stream stream);
+
+        /// @brief Copy a value into the entry being recorded or out of the
+        /// entry being replayed.
+        template <typename T> void Transfer(Stream stream, T& value);
+        void Transfer(Stream stream, OSVR_TimeValue& value);
+        void TransferTimestamp(Stream stream, OSVR_TimeValue& value);
+        void Transfer(Stream stream, OSVR_PoseState& value);
+
+        /// @brief Stop replaying, saying why.
+        void Finish(const char* reason);
+
+        std::mutex m_mutex; //< Guards all of the members below
+        bool m_replaying = false;
+        bool m_finished = false; //< Replay ran out or stopped matching
+
+        std::string m_fileName;
+        std::ofstream m_file; //< Being recorded to
+        std::vector<char> m_entry; //< Entry being recorded
+
+        /// Entries to replay, demultiplexed into their streams.
+        struct ReplayStream {
+            std::vector<char> data;
+            size_t next = 0; //< Offset of the next entry
+            size_t read = 0; //< Offset being read in the current entry
+            size_t payloadEnd = 0; //< End of the entry being read
+        };
+        std::array<ReplayStream, STREAMS> m_streams;
+
+        /// Amount recorded times are shifted by when replaying.
+        bool m_haveTimeShift = false;
+        OSVR_TimeValue m_timeShift;
+
+        /// Storage for poses that replayed parameters point to.
+        OSVR_PoseState m_worldFromRoom;
+        OSVR_PoseState m_roomFromHead;
+    };
+
+} // namespace renderkit
+} // namespace osvr
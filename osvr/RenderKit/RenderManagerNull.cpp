@@ -0,0 +1,301 @@
+/** @file
+@brief Implementation of a RenderManager that needs no window or graphics
+device, for testing and benchmarking.
+
+@date 2026
+
+@author
+Sensics, Inc.
+<http://sensics.com/osvr>
+*/
+
+// Copyright 2026 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Internal Includes
+#include "RenderManagerNull.h"
+
+// Library/third-party includes
+#include <Eigen/Core>
+
+// Standard includes
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <thread>
+
+namespace osvr {
+namespace renderkit {
+
+    /// @brief Convert a non-negative number of seconds to a time value.
+    static OSVR_TimeValue secondsToTimeValue(double seconds) {
+        OSVR_TimeValue ret;
+        double whole = std::floor(seconds);
+        ret.seconds = static_cast<OSVR_TimeValue_Seconds>(whole);
+        ret.microseconds =
+            static_cast<OSVR_TimeValue_Microseconds>((seconds - whole) * 1e6);
+        return ret;
+    }
+
+    RenderManagerNull::RenderManagerNull(OSVR_ClientContext context,
+                                         ConstructorParameters p)
+        : RenderManager(context, p) {
+        // Initialize all of the variables that don't have to be done in the
+        // list above, so we don't get warnings about out-of-order
+        // initialization if they are re-ordered in the header file.
+        m_doingOkay = true;
+        m_displayOpen = false;
+        m_firstRetrace.seconds = 0;
+        m_firstRetrace.microseconds = 0;
+        m_refreshInterval = 0;
+        if (p.m_nullRefreshRate > 0) {
+            m_refreshInterval = 1.0 / p.m_nullRefreshRate;
+        }
+        m_presentedFrames = 0;
+
+        // There is no graphics library, so m_library and m_buffers keep
+        // their NULL pointers.
+    }
+
+    RenderManagerNull::~RenderManagerNull() {
+        // The presenter thread and the background mesh build use our
+        // state, so they have to finish before we go away.
+        StopPresentQueue();
+        StopBackgroundDistortionMeshes();
+    }
+
+    RenderManager::OpenResults RenderManagerNull::OpenDisplay(void) {
+        // All public methods that use internal state should be guarded
+        // by a mutex.
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        OpenResults ret;
+        ret.library = m_library;
+        ret.status = COMPLETE; // Until we hear otherwise
+        if (!doingOkay()) {
+            ret.status = FAILURE;
+            return ret;
+        }
+
+        // The simulated display starts refreshing now.
+        osvrTimeValueGetNow(&m_firstRetrace);
+
+        if (!BuildDistortionMeshesInternal(
+                SQUARE, m_params.m_distortionParameters, true)) {
+            std::cerr << "RenderManagerNull::OpenDisplay: Could not "
+                         "construct distortion mesh"
+                      << std::endl;
+            m_doingOkay = false;
+            ret.status = FAILURE;
+            return ret;
+        }
+        m_presentedEyes.resize(GetNumEyes());
+
+        //======================================================
+        // Done, we now have a display to use.
+        m_displayOpen = true;
+        return ret;
+    }
+
+    bool RenderManagerNull::GetTimingInfo(size_t whichEye,
+                                          RenderTimingInfo& info) {
+        if (!m_displayOpen || (m_refreshInterval <= 0)) {
+            return false;
+        }
+        OSVR_TimeValue now;
+        osvrTimeValueGetNow(&now);
+        double since = std::fmod(
+            osvrTimeValueDurationSeconds(&now, &m_firstRetrace),
+            m_refreshInterval);
+        double untilRequired = m_refreshInterval - since -
+                               m_params.m_maxMSBeforeVsyncTimeWarp / 1e3;
+        info.hardwareDisplayInterval = secondsToTimeValue(m_refreshInterval);
+        info.timeSincelastVerticalRetrace = secondsToTimeValue(since);
+        info.timeUntilNextPresentRequired =
+            secondsToTimeValue(std::max(untilRequired, 0.0));
+        return true;
+    }
+
+    void RenderManagerNull::waitForRetrace() {
+        OSVR_TimeValue now;
+        osvrTimeValueGetNow(&now);
+        double since = osvrTimeValueDurationSeconds(&now, &m_firstRetrace);
+        double periods = std::floor(since / m_refreshInterval) + 1;
+        std::this_thread::sleep_for(std::chrono::duration<double>(
+            periods * m_refreshInterval - since));
+    }
+
+    bool RenderManagerNull::UpdateDistortionMeshesInternal(
+        DistortionMeshType type //< Type of mesh to produce
+        ,
+        std::vector<DistortionParameters> const&
+            distort //< Distortion parameters
+        ) {
+        std::vector<DistortionMesh> meshes;
+        if (!ComputeDistortionMeshes(type, distort, meshes)) {
+            std::cerr << "RenderManagerNull::UpdateDistortionMesh: Could "
+                         "not create meshes"
+                      << std::endl;
+            return false;
+        }
+        m_distortionMeshes.swap(meshes);
+        return true;
+    }
+
+    bool RenderManagerNull::SetDistortionMeshesInternal(
+        std::vector<DistortionMesh> const& meshes) {
+        m_distortionMeshes = meshes;
+        return true;
+    }
+
+    bool RenderManagerNull::RenderPathSetup() {
+        // One (empty) buffer per eye to present in Render() mode.
+        m_colorBuffers.assign(GetNumEyes(), RenderBuffer());
+        return RegisterRenderBuffersInternal(m_colorBuffers);
+    }
+
+    bool RenderManagerNull::RenderFrameInitialize() {
+        return PresentFrameInitialize();
+    }
+
+    bool RenderManagerNull::RenderDisplayInitialize(size_t display) {
+        return display < GetNumDisplays();
+    }
+
+    bool RenderManagerNull::RenderEyeInitialize(size_t eye) {
+        // Call the display set-up callback for each eye, because they each
+        // have their own buffer whether or not they actually end up
+        // in different windows.
+        if (m_displayCallback.m_callback != nullptr) {
+            m_displayCallback.m_callback(m_displayCallback.m_userData,
+                                         m_library, m_buffers);
+        }
+        return true;
+    }
+
+    bool RenderManagerNull::RenderSpace(
+        size_t whichSpace //< Index into m_callbacks vector
+        , size_t whichEye //< Which eye are we rendering for?
+        , OSVR_PoseState pose //< ModelView transform to use
+        , OSVR_ViewportDescription viewport //< Viewport to use
+        , OSVR_ProjectionMatrix projection //< Projection to use
+        ) {
+        /// @todo Fill in the timing information
+        OSVR_TimeValue deadline;
+        deadline.microseconds = 0;
+        deadline.seconds = 0;
+
+        RenderCallbackInfo& cb = m_callbacks[whichSpace];
+        cb.m_callback(cb.m_userData, m_library, m_buffers, viewport, pose,
+                      projection, deadline);
+        return true;
+    }
+
+    bool RenderManagerNull::RenderFrameFinalize() {
+        if (!PresentRenderBuffersInternal(m_colorBuffers, m_renderInfoForRender,
+                                          m_renderParamsForRender)) {
+            std::cerr << "RenderManagerNull::RenderFrameFinalize: Could "
+                         "not present render buffers"
+                      << std::endl;
+            return false;
+        }
+        return true;
+    }
+
+    bool RenderManagerNull::PresentDisplayInitialize(size_t display) {
+        return display < GetNumDisplays();
+    }
+
+    bool RenderManagerNull::PresentEye(PresentEyeParameters params) {
+        if (params.m_index >= m_presentedEyes.size()) {
+            std::cerr << "RenderManagerNull::PresentEye(): Eye index out of "
+                         "range"
+                      << std::endl;
+            return false;
+        }
+        if (params.m_plan == nullptr) {
+            std::cerr << "RenderManagerNull::PresentEye(): NULL present "
+                         "plan pointer"
+                      << std::endl;
+            return false;
+        }
+        PresentedEye& presented = m_presentedEyes[params.m_index];
+
+        // The viewport for this eye, adjusted for how much the display is
+        // rotated with respect to the rendering window, and the ModelView
+        // matrix that rotates and flips the quad to match the display
+        // scan-out.
+        presented.viewport = params.m_plan->viewport;
+        presented.modelView = params.m_plan->orientation;
+
+        // The texture matrix: time warp, then cropping to the part of the
+        // buffer that holds this eye.
+        matrix16 timeWarp = {{1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1}};
+        if (params.m_timeWarp != nullptr) {
+            timeWarp = *params.m_timeWarp;
+        }
+        Eigen::Map<Eigen::Matrix4f> texture(presented.texture.data);
+        texture = Eigen::Map<Eigen::Matrix4f>(timeWarp.data) *
+                  Eigen::Map<const Eigen::Matrix4f>(
+                      params.m_plan->cropMatrix.data);
+
+        presented.triangles =
+            m_distortionMeshes[params.m_index].indices.size() / 3;
+        presented.solidColor = false;
+        return true;
+    }
+
+    bool RenderManagerNull::SolidColorEye(size_t eye, const RGBColorf& color) {
+        if (eye >= m_presentedEyes.size()) {
+            return false;
+        }
+        OSVR_ViewportDescription viewportDesc;
+        if (!ConstructViewportForPresent(
+                eye, viewportDesc,
+                m_params.m_displayConfiguration.getSwapEyes())) {
+            std::cerr << "RenderManagerNull::SolidColorEye(): Could not "
+                         "construct viewport"
+                      << std::endl;
+            return false;
+        }
+        PresentedEye& presented = m_presentedEyes[eye];
+        presented.viewport = RotateViewport(viewportDesc);
+        presented.triangles = 0;
+        presented.solidColor = true;
+        presented.color = color;
+        return true;
+    }
+
+    bool RenderManagerNull::PresentDisplayFinalize(size_t display) {
+        if (display >= GetNumDisplays()) {
+            return false;
+        }
+
+        // All of the simulated displays refresh together, so the "swap"
+        // after the last one is where we wait for vertical sync.
+        if (m_params.m_verticalSync && (m_refreshInterval > 0) &&
+            (display + 1 == GetNumDisplays())) {
+            waitForRetrace();
+        }
+        return true;
+    }
+
+    bool RenderManagerNull::PresentFrameFinalize() {
+        m_presentedFrames++;
+        return true;
+    }
+
+} // namespace renderkit
+} // namespace osvr
@@ -0,0 +1,151 @@
+/** @file
+@brief Header file describing a RenderManager that needs no window or
+graphics device, for testing and benchmarking.
+
+@date 2026
+
+@author
+Sensics, Inc.
+<http://sensics.com/osvr>
+*/
+
+// Copyright 2026 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+// Internal Includes
+#include "RenderManager.h"
+
+// Library/third-party includes
+#include <osvr/Util/TimeValueC.h>
+
+// Standard includes
+#include <vector>
+
+namespace osvr {
+namespace renderkit {
+
+    /// @brief A RenderManager that draws nothing.
+    ///
+    /// It runs all of the base-class work for Render() and
+    /// PresentRenderBuffers() -- poses, prediction, time warp, distortion
+    /// meshes, frame pacing and timing, the presenter thread -- and does
+    /// on the CPU the per-eye bookkeeping that a real back end does before
+    /// drawing, but issues no graphics calls.  The display is simulated:
+    /// it refreshes at m_nullRefreshRate, and with vertical sync turned on
+    /// presenting blocks until its next refresh.  Selected with the "Null"
+    /// render library.
+    ///  The GraphicsLibrary and RenderBuffer pointers it hands out are all
+    /// NULL, and applications should pass RenderBuffers with NULL pointers
+    /// to PresentRenderBuffers().
+    class RenderManagerNull : public RenderManager {
+      public:
+        virtual ~RenderManagerNull();
+
+        // Is the renderer currently working?
+        bool doingOkay() override { return m_doingOkay; }
+
+        // Opens the simulated display.
+        OpenResults OpenDisplay() override;
+
+        // Reports the simulated display's refresh timing.
+        bool GetTimingInfo(size_t whichEye, RenderTimingInfo& info) override;
+
+      protected:
+        /// Construct a Null render manager.
+        RenderManagerNull(OSVR_ClientContext context, ConstructorParameters p);
+
+        bool UpdateDistortionMeshesInternal(
+            DistortionMeshType type //< Type of mesh to produce
+            ,
+            std::vector<DistortionParameters> const&
+                distort //< Distortion parameters
+            ) override;
+        bool SetDistortionMeshesSupported() override { return true; }
+        bool SetDistortionMeshesInternal(
+            std::vector<DistortionMesh> const& meshes) override;
+
+        bool m_doingOkay;   //< Are we doing okay?
+        bool m_displayOpen; //< Has our display been opened?
+
+        /// Time of a (simulated) vertical retrace, from which the others
+        /// follow every m_refreshInterval seconds.
+        OSVR_TimeValue m_firstRetrace;
+        double m_refreshInterval; //< Seconds; 0 when not simulating refresh
+
+        /// Sleep until just after the next simulated retrace.
+        void waitForRetrace();
+
+        /// Buffers handed to PresentRenderBuffersInternal() in Render() mode.
+        std::vector<RenderBuffer> m_colorBuffers;
+
+        /// Distortion mesh for each eye, which a real back end would
+        /// upload to the GPU.
+        std::vector<DistortionMesh> m_distortionMeshes;
+
+        /// What the last present did for each eye, standing in for the
+        /// state a real back end would set before drawing it.
+        struct PresentedEye {
+            OSVR_ViewportDescription viewport;
+            matrix16 modelView;
+            matrix16 texture;
+            size_t triangles = 0; //< Distortion-mesh triangles "drawn"
+            bool solidColor = false;
+            RGBColorf color;
+        };
+        std::vector<PresentedEye> m_presentedEyes;
+        size_t m_presentedFrames; //< Frames finalized
+
+        //===================================================================
+        // Overloaded render functions from the base class.
+        bool RenderPathSetup() override;
+        bool RenderFrameInitialize() override;
+        bool RenderDisplayInitialize(size_t display) override;
+        bool RenderEyeInitialize(size_t eye) override;
+        bool RenderSpace(size_t whichSpace //< Index into m_callbacks vector
+                         ,
+                         size_t whichEye //< Which eye are we rendering for?
+                         ,
+                         OSVR_PoseState pose //< ModelView transform to use
+                         ,
+                         OSVR_ViewportDescription viewport //< Viewport to use
+                         ,
+                         OSVR_ProjectionMatrix projection //< Projection to use
+                         ) override;
+        bool RenderEyeFinalize(size_t eye) override { return true; }
+        bool RenderDisplayFinalize(size_t display) override { return true; }
+        bool RenderFrameFinalize() override;
+
+        bool PresentFrameInitialize() override { return true; }
+        bool PresentDisplayInitialize(size_t display) override;
+        bool PresentEye(PresentEyeParameters params) override;
+        bool SolidColorEye(size_t eye, const RGBColorf& color) override;
+        bool PresentDisplayFinalize(size_t display) override;
+        bool PresentFrameFinalize() override;
+
+        //===================================================================
+        // There is no graphics context to share, so the presenter thread
+        // can always be used.
+        bool QueuedPresentSupported() override { return true; }
+
+        friend RenderManager OSVR_RENDERMANAGER_EXPORT*
+        createRenderManager(OSVR_ClientContext context,
+                            const std::string& renderLibraryName,
+                            GraphicsLibrary graphicsLibrary,
+                            double connectTimeoutSeconds);
+    };
+
+} // namespace renderkit
+} // namespace osvr
@@ -36,6 +36,9 @@ Sensics, Inc.
 #include "RenderManagerOpenGL.h"
 #include "GraphicsLibraryOpenGL.h"
 #include "RenderManagerSDLInitQuit.h"
+#include "RenderManagerStartupScheduler.h"
+#include "RenderManagerTrace.h"
+#include <algorithm>
 #include <iostream>
 #include <Eigen/Core>
 #include <Eigen/Geometry>
@@ -131,11 +134,92 @@ namespace renderkit {
     bool RenderManagerOpenGL::checkForGLError(const std::string& message) {
         GLenum err = glGetError();
         if (err != GL_NO_ERROR) {
-            std::cout << message << ": OpenGL error " << err << std::endl;
+            std::cerr << message << ": OpenGL error " << err << std::endl;
         }
         return (err != GL_NO_ERROR);
     }
 
+    bool RenderManagerOpenGL::glewInitSucceeded(GLenum result) {
+#ifdef RM_USE_OPENGLES20
+        return true;
+#else
+        return result == GLEW_OK;
+#endif
+    }
+
+    bool RenderManagerOpenGL::checkForGLErrorInFrame(const char* message) {
+        if (!m_glCheckEveryStep) {
+            return false;
+        }
+        GLenum err = glGetError();
+        if (err != GL_NO_ERROR) {
+            std::cerr << message << ": OpenGL error " << err << std::endl;
+            m_glErrorInFrame = true;
+        }
+        return (err != GL_NO_ERROR);
+    }
+
+    bool RenderManagerOpenGL::checkForGLErrorAtFrameEnd(const char* message) {
+        // OpenGL may have recorded more than one kind of error, and it
+        // keeps each until it is read, so read them all; otherwise they
+        // would be blamed on the next frame.  The debug-output callback
+        // has already reported them as they happened, but they are still
+        // recorded.  A broken context can keep returning errors, so we
+        // stop after a few.
+        bool found = m_glErrorInFrame;
+        m_glErrorInFrame = false;
+        for (int i = 0; i < 8; i++) {
+            GLenum err = glGetError();
+            if (err == GL_NO_ERROR) {
+                break;
+            }
+            found = true;
+            if (m_glErrorChecking ==
+                ConstructorParameters::DebugOutputGLErrorChecking) {
+                continue;
+            }
+            std::cerr << message << ": OpenGL error " << err;
+            if (!m_glCheckEveryStep) {
+                std::cerr << " during this frame (set glErrorChecking to "
+                             "full to find where)";
+            }
+            std::cerr << std::endl;
+        }
+        return found;
+    }
+
+#ifndef RM_USE_OPENGLES20
+    static void GLAPIENTRY glDebugOutputCallback(GLenum /*source*/,
+                                                 GLenum type, GLuint id,
+                                                 GLenum /*severity*/,
+                                                 GLsizei /*length*/,
+                                                 const GLchar* message,
+                                                 const void* /*userParam*/) {
+        if (type == GL_DEBUG_TYPE_ERROR) {
+            std::cerr << "RenderManagerOpenGL: OpenGL error " << id << ": "
+                      << message << std::endl;
+        }
+    }
+#endif
+
+    bool RenderManagerOpenGL::enableGLDebugOutput() {
+#ifdef RM_USE_OPENGLES20
+        return false;
+#else
+        if (!GLEW_KHR_debug) {
+            return false;
+        }
+        // Only errors; the other messages are not what we're asked for.
+        glEnable(GL_DEBUG_OUTPUT);
+        glDebugMessageControl(GL_DONT_CARE, GL_DONT_CARE, GL_DONT_CARE, 0,
+                              nullptr, GL_FALSE);
+        glDebugMessageControl(GL_DONT_CARE, GL_DEBUG_TYPE_ERROR, GL_DONT_CARE,
+                              0, nullptr, GL_TRUE);
+        glDebugMessageCallback(glDebugOutputCallback, nullptr);
+        return !checkForGLError("RenderManagerOpenGL::enableGLDebugOutput");
+#endif
+    }
+
     RenderManagerOpenGL::RenderManagerOpenGL(
         OSVR_ClientContext context,
         ConstructorParameters p)
@@ -146,7 +230,27 @@ namespace renderkit {
         m_doingOkay = true;
         m_displayOpen = false;
         m_GLContext = nullptr;
+        m_presentGLContext = nullptr;
+        m_shaderGLContext = nullptr;
+        m_presentVAO = 0;
+        m_meshVAO = 0;
         m_programId = 0;
+        m_glErrorChecking = p.m_glErrorChecking;
+        if (m_glErrorChecking ==
+            ConstructorParameters::DefaultGLErrorChecking) {
+#ifdef NDEBUG
+            m_glErrorChecking = ConstructorParameters::FrameEndGLErrorChecking;
+#else
+            m_glErrorChecking = ConstructorParameters::FullGLErrorChecking;
+#endif
+        }
+        m_glCheckEveryStep =
+            (m_glErrorChecking !=
+             ConstructorParameters::FrameEndGLErrorChecking) &&
+            (m_glErrorChecking !=
+             ConstructorParameters::DebugOutputGLErrorChecking);
+        m_glErrorFrames = 0;
+        m_glErrorInFrame = false;
 
         // Construct the appropriate GraphicsLibrary pointer.
         m_library.OpenGL = new GraphicsLibraryOpenGL;
@@ -154,27 +258,46 @@ namespace renderkit {
     }
 
     RenderManagerOpenGL::~RenderManagerOpenGL() {
+        // The presenter thread uses our context and buffers, so it has to
+        // finish before we get rid of them.
+        StopPresentQueue();
+        StopBackgroundDistortionMeshes();
+
+        // What we made lives in our context, so it has to be deleted
+        // before the context is.
+        if (m_GLContext != nullptr) {
+            makeContextCurrent(0, false);
+        }
+        deleteGPUTimerQueries(m_gpuTimerQueries);
+        deleteCaptures();
+        deleteDisplayObjects();
         removeOpenGLContexts();
 
-        if (m_displayOpen) {
+        delete m_buffers.OpenGL;
+        delete m_library.OpenGL;
+    }
 
-            glDeleteFramebuffers(1, &m_frameBuffer);
-            size_t numEyes = GetNumEyes();
-            // @todo Handle the case of multiple displays per eye
-            for (size_t i = 0; i < m_colorBuffers.size(); i++) {
-                glDeleteTextures(1, &m_colorBuffers[i].OpenGL->colorBufferName);
-                delete m_colorBuffers[i].OpenGL;
-                glDeleteRenderbuffers(1, &m_depthBuffers[i]);
-            }
+    void RenderManagerOpenGL::deleteDisplayObjects() {
+        if (!m_displayOpen) {
+            return;
+        }
+        glDeleteFramebuffers(1, &m_frameBuffer);
+        // @todo Handle the case of multiple displays per eye
+        for (size_t i = 0; i < m_colorBuffers.size(); i++) {
+            glDeleteTextures(1, &m_colorBuffers[i].OpenGL->colorBufferName);
+            delete m_colorBuffers[i].OpenGL;
+            glDeleteRenderbuffers(1, &m_depthBuffers[i]);
+        }
+        m_colorBuffers.clear();
+        m_depthBuffers.clear();
 
-            m_distortionMeshBuffer.clear();
+        m_distortionMeshBuffer.clear();
+        glDeleteVertexArrays(1, &m_meshVAO);
+        m_meshVAO = 0;
 
-            /// @todo Clean up anything else we need to
+        /// @todo Clean up anything else we need to
 
-            m_displayOpen = false;
-        }
-        delete m_buffers.OpenGL;
-        delete m_library.OpenGL;
+        m_displayOpen = false;
     }
 
     bool RenderManagerOpenGL::RenderPathSetup() {
@@ -281,6 +404,12 @@ namespace renderkit {
             SDL_GL_SetAttribute(SDL_GL_CONTEXT_PROFILE_MASK,
                 SDL_GL_CONTEXT_PROFILE_CORE);
         }
+        if (m_glErrorChecking ==
+            ConstructorParameters::DebugOutputGLErrorChecking) {
+            // Some drivers only send debug output to debug contexts.
+            SDL_GL_SetAttribute(SDL_GL_CONTEXT_FLAGS,
+                                SDL_GL_CONTEXT_DEBUG_FLAG);
+        }
 
         // For now, append the display ID to the title.
         /// @todo Make a different title for each window in the config file
@@ -334,6 +463,11 @@ namespace renderkit {
             glDeleteProgram(m_programId);
             m_programId = 0;
         }
+        removeShaderContext();
+        if (m_presentGLContext) {
+            SDL_GL_DeleteContext(m_presentGLContext);
+            m_presentGLContext = nullptr;
+        }
         if (m_GLContext) {
             SDL_GL_DeleteContext(m_GLContext);
             m_GLContext = 0;
@@ -352,6 +486,141 @@ namespace renderkit {
         return true;
     }
 
+    bool RenderManagerOpenGL::makeContextCurrent(size_t display,
+                                                 bool presentContext) {
+        SDL_GLContext context = presentContext ? m_presentGLContext
+                                               : m_GLContext;
+        if (SDL_GL_MakeCurrent(m_displays[display].m_window, context) != 0) {
+            std::cerr << "RenderManagerOpenGL::makeContextCurrent: "
+                      << SDL_GetError() << std::endl;
+            return false;
+        }
+        return true;
+    }
+
+    void RenderManagerOpenGL::releaseContext() {
+        SDL_GL_MakeCurrent(m_displays[0].m_window, nullptr);
+    }
+
+    bool RenderManagerOpenGL::setSwapInterval(int interval) {
+        return SDL_GL_SetSwapInterval(interval) == 0;
+    }
+
+    bool RenderManagerOpenGL::addPresentContext() {
+        // Creating it makes it current, so we put ours back afterwards.
+        SDL_GL_SetAttribute(SDL_GL_SHARE_WITH_CURRENT_CONTEXT, 1);
+        m_presentGLContext = SDL_GL_CreateContext(m_displays[0].m_window);
+        SDL_GL_SetAttribute(SDL_GL_SHARE_WITH_CURRENT_CONTEXT, 0);
+        SDL_GL_MakeCurrent(m_displays[0].m_window, m_GLContext);
+        return m_presentGLContext != nullptr;
+    }
+
+    bool RenderManagerOpenGL::addShaderContext() {
+#ifdef __APPLE__
+        // Cocoa only lets a window's context be made current on the main
+        // thread, so the shaders are compiled there.
+        return false;
+#else
+        // Creating it makes it current, so we put ours back afterwards.
+        SDL_GL_SetAttribute(SDL_GL_SHARE_WITH_CURRENT_CONTEXT, 1);
+        m_shaderGLContext = SDL_GL_CreateContext(m_displays[0].m_window);
+        SDL_GL_SetAttribute(SDL_GL_SHARE_WITH_CURRENT_CONTEXT, 0);
+        SDL_GL_MakeCurrent(m_displays[0].m_window, m_GLContext);
+        return m_shaderGLContext != nullptr;
+#endif
+    }
+
+    bool RenderManagerOpenGL::makeShaderContextCurrent(bool current) {
+        // SDL only promises that windows work from the thread that made
+        // them, but WGL and GLX let a context be made current on a window
+        // from any thread, as long as no other thread has it current.  If
+        // this fails, the shaders are compiled on the application's
+        // thread instead.
+        return SDL_GL_MakeCurrent(m_displays[0].m_window,
+                                  current ? m_shaderGLContext : nullptr) == 0;
+    }
+
+    void RenderManagerOpenGL::removeShaderContext() {
+        if (m_shaderGLContext) {
+            SDL_GL_DeleteContext(m_shaderGLContext);
+            m_shaderGLContext = nullptr;
+        }
+    }
+
+    bool RenderManagerOpenGL::swapDisplay(size_t display) {
+        SDL_GL_SwapWindow(m_displays[display].m_window);
+        return true;
+    }
+
+    bool RenderManagerOpenGL::compileShaders() {
+        //======================================================
+        // Construct the shaders and program we'll use to present things
+        // handling time warp/distortion.
+        GLuint vertexShaderId;   //< Vertex shader for time warp/distortion
+        GLuint fragmentShaderId; //< Fragment shader for the same
+
+        vertexShaderId = glCreateShader(GL_VERTEX_SHADER);
+        glShaderSource(vertexShaderId, 1, &distortionVertexShader, nullptr);
+        glCompileShader(vertexShaderId);
+        if (!checkShaderError(vertexShaderId)) {
+            GLint infoLogLength;
+            glGetShaderiv(vertexShaderId, GL_INFO_LOG_LENGTH, &infoLogLength);
+            std::vector<GLchar> strInfoLog(infoLogLength + 1);
+            glGetShaderInfoLog(vertexShaderId, infoLogLength, NULL,
+                               strInfoLog.data());
+
+            std::cerr << "RenderManagerOpenGL::compileShaders: Could not "
+                         "construct vertex shader:"
+                      << std::endl << strInfoLog.data() << std::endl;
+            return false;
+        }
+
+        fragmentShaderId = glCreateShader(GL_FRAGMENT_SHADER);
+        glShaderSource(fragmentShaderId, 1, &distortionFragmentShader,
+                       nullptr);
+        glCompileShader(fragmentShaderId);
+        if (!checkShaderError(fragmentShaderId)) {
+            GLint infoLogLength;
+            glGetShaderiv(fragmentShaderId, GL_INFO_LOG_LENGTH, &infoLogLength);
+            std::vector<GLchar> strInfoLog(infoLogLength + 1);
+            glGetShaderInfoLog(fragmentShaderId, infoLogLength, NULL,
+                               strInfoLog.data());
+
+            std::cerr << "RenderManagerOpenGL::compileShaders: Could not "
+                         "construct fragment shader:"
+                      << std::endl << strInfoLog.data() << std::endl;
+            return false;
+        }
+
+        checkForGLError(
+            "RenderManagerOpenGL::compileShaders after shader compile");
+
+        m_programId = glCreateProgram();
+        glAttachShader(m_programId, vertexShaderId);
+        glAttachShader(m_programId, fragmentShaderId);
+        glLinkProgram(m_programId);
+        if (!checkProgramError(m_programId)) {
+            std::cerr << "RenderManagerOpenGL::compileShaders: Could not "
+                         "link shader program "
+                      << std::endl;
+            return false;
+        }
+        checkForGLError(
+            "RenderManagerOpenGL::compileShaders after program link");
+
+        m_projectionUniformId =
+            glGetUniformLocation(m_programId, "projectionMatrix");
+        m_modelViewUniformId =
+            glGetUniformLocation(m_programId, "modelViewMatrix");
+        m_textureUniformId =
+            glGetUniformLocation(m_programId, "textureMatrix");
+
+        // Now that they are linked, we don't need to keep them around.
+        glDeleteShader(vertexShaderId);
+        glDeleteShader(fragmentShaderId);
+        return true;
+    }
+
     RenderManager::OpenResults RenderManagerOpenGL::OpenDisplay(void) {
         // All public methods that use internal state should be guarded
         // by a mutex.
@@ -392,137 +661,222 @@ namespace renderkit {
         p.numBuffers = m_params.m_numBuffers;
         p.visible = true;
         p.core = m_params.m_core;
-        for (size_t display = 0; display < GetNumDisplays(); display++) {
-            if (!addOpenGLContext(p)) {
-                std::cerr << "RenderManagerOpenGL::OpenDisplay: Cannot get GL "
-                             "context "
-                          << "for display " << display << std::endl;
-                ret.status = FAILURE;
-                return ret;
+
+        //======================================================
+        // Open the display in stages.  Those that use SDL or our OpenGL
+        // context run on this thread, in order.  Computing the distortion
+        // meshes only needs the CPU, so unless they are being built in the
+        // background after we return, that runs on a thread of its own
+        // while the window is made, as does compiling the shaders once
+        // there is a context to do it in.
+        StartupScheduler stages;
+
+        auto windows = stages.add("CreateWindows", true, {}, [&] {
+            for (size_t display = 0; display < GetNumDisplays(); display++) {
+                if (!addOpenGLContext(p)) {
+                    std::cerr << "RenderManagerOpenGL::OpenDisplay: Cannot "
+                                 "get GL context "
+                              << "for display " << display << std::endl;
+                    return false;
+                }
             }
-        }
 
-        std::cout << "OpenGL Vendor  : " << glGetString(GL_VENDOR) << std::endl;
-        std::cout << "OpenGL Renderer: " << glGetString(GL_RENDERER) << std::endl;
-        std::cout << "OpenGL Version : " << glGetString(GL_VERSION) << std::endl;
+            std::cout << "OpenGL Vendor  : " << glGetString(GL_VENDOR)
+                      << std::endl;
+            std::cout << "OpenGL Renderer: " << glGetString(GL_RENDERER)
+                      << std::endl;
+            std::cout << "OpenGL Version : " << glGetString(GL_VERSION)
+                      << std::endl;
 
-        checkForGLError("RenderManagerOpenGL::OpenDisplay after context creation");
+            checkForGLError(
+                "RenderManagerOpenGL::OpenDisplay after context creation");
+            return true;
+        });
 
+        auto extensions = stages.add("InitializeExtensions", true, {windows},
+                                     [&] {
 #ifndef RM_USE_OPENGLES20
-        //======================================================
-        // We need to call glewInit() so that we have access to
-        // the extensions needed below.
-        char* glewver = strdup((char *)glewGetString(GLEW_VERSION));
-        int glewmajor = atoi(strtok (glewver,"."));
-        if (glewmajor < 2) {
-            std::cout << "GLEW Version " << glewGetString(GLEW_VERSION)
-                      << " is older than 2.0.0. "
-                      << "Enabling GLEW experimental mode..." << std::endl;
-            glewExperimental = true; // Needed for core profile
-        }
-        if (glewInit() != GLEW_OK) {
-            std::cerr
-                << "RenderManagerOpenGL::OpenDisplay: Can't initialize GLEW"
-                << std::endl;
-            removeOpenGLContexts();
-            ret.status = FAILURE;
-            return ret;
-        }
-        // Clear any GL error that Glew caused.  Apparently on Non-Windows
-        // platforms, this can cause a spurious  error 1280.
-        glGetError();
+            //======================================================
+            // We need to call glewInit() so that we have access to
+            // the extensions needed below.
+            char* glewver = strdup((char *)glewGetString(GLEW_VERSION));
+            int glewmajor = atoi(strtok (glewver,"."));
+            if (glewmajor < 2) {
+                std::cout << "GLEW Version " << glewGetString(GLEW_VERSION)
+                          << " is older than 2.0.0. "
+                          << "Enabling GLEW experimental mode..." << std::endl;
+                glewExperimental = true; // Needed for core profile
+            }
+            if (!glewInitSucceeded(glewInit())) {
+                std::cerr
+                    << "RenderManagerOpenGL::OpenDisplay: Can't initialize GLEW"
+                    << std::endl;
+                return false;
+            }
+            // Clear any GL error that Glew caused.  Apparently on Non-Windows
+            // platforms, this can cause a spurious  error 1280.
+            glGetError();
+
+            //======================================================
+            // See if we can time the present pass on the GPU.  This needs
+            // glQueryCounter(), which EXT_timer_query does not have.
+            m_gpuTimerSupported = GLEW_VERSION_3_3 || GLEW_ARB_timer_query;
+            if (!m_gpuTimerSupported) {
+                std::cout << "RenderManagerOpenGL::OpenDisplay: Timer queries "
+                             "not available, so GPU present times will not be "
+                             "reported"
+                          << std::endl;
+            }
 #endif
 
-        //======================================================
-        // Set vertical sync behavior.
-        if (m_params.m_verticalSync) {
-            if (SDL_GL_SetSwapInterval(1) != 0) {
-                std::cerr << "RenderManagerOpenGL::OpenDisplay: Warning: Could "
-                             "not set vertical retrace on"
+            //======================================================
+            // Have the driver tell us about errors if we've been asked to.
+            if ((m_glErrorChecking ==
+                 ConstructorParameters::DebugOutputGLErrorChecking) &&
+                !enableGLDebugOutput()) {
+                std::cerr << "RenderManagerOpenGL::OpenDisplay: Warning: "
+                             "KHR_debug output not available, checking for "
+                             "OpenGL errors once per frame instead"
                           << std::endl;
+                m_glErrorChecking =
+                    ConstructorParameters::FrameEndGLErrorChecking;
             }
-        } else {
-            if (SDL_GL_SetSwapInterval(0) != 0) {
-                std::cerr << "RenderManagerOpenGL::OpenDisplay: Warning: Could "
-                             "not set vertical retrace off"
-                          << std::endl;
+
+            //======================================================
+            // Set vertical sync behavior.
+            if (m_params.m_verticalSync) {
+                if (!setSwapInterval(1)) {
+                    std::cerr << "RenderManagerOpenGL::OpenDisplay: Warning: "
+                                 "Could not set vertical retrace on"
+                              << std::endl;
+                }
+            } else {
+                if (!setSwapInterval(0)) {
+                    std::cerr << "RenderManagerOpenGL::OpenDisplay: Warning: "
+                                 "Could not set vertical retrace off"
+                              << std::endl;
+                }
             }
-        }
 
-        checkForGLError("RenderManagerOpenGL::OpenDisplay after vsync setting");
+            checkForGLError(
+                "RenderManagerOpenGL::OpenDisplay after vsync setting");
+            return true;
+        });
 
         //======================================================
-        // Construct the shaders and program we'll use to present things
-        // handling time warp/distortion.
-        GLuint vertexShaderId;   //< Vertex shader for time warp/distortion
-        GLuint fragmentShaderId; //< Fragment shader for time warp/distortion
+        // Make what the displays are presented into, if they are not
+        // windows.  Capture and the presenter thread read from them.
+        auto displayBuffers =
+            stages.add("CreateDisplayFramebuffers", true, {extensions}, [&] {
+                if (!addDisplayFramebuffers()) {
+                    std::cerr << "RenderManagerOpenGL::OpenDisplay: Could "
+                                 "not make display framebuffers"
+                              << std::endl;
+                    return false;
+                }
+                return true;
+            });
 
-        vertexShaderId = glCreateShader(GL_VERTEX_SHADER);
-        glShaderSource(vertexShaderId, 1, &distortionVertexShader, nullptr);
-        glCompileShader(vertexShaderId);
-        if (!checkShaderError(vertexShaderId)) {
-            GLint infoLogLength;
-            glGetShaderiv(vertexShaderId, GL_INFO_LOG_LENGTH, &infoLogLength);
-            GLchar* strInfoLog = new GLchar[infoLogLength + 1];
-            glGetShaderInfoLog(vertexShaderId, infoLogLength, NULL, strInfoLog);
-
-            removeOpenGLContexts();
-            std::cerr << "RenderManagerOpenGL::OpenDisplay: Could not "
-                         "construct vertex shader:"
-                      << std::endl << strInfoLog << std::endl;
-            ret.status = FAILURE;
-            return ret;
-        }
-
-        fragmentShaderId = glCreateShader(GL_FRAGMENT_SHADER);
-        glShaderSource(fragmentShaderId, 1, &distortionFragmentShader, nullptr);
-        glCompileShader(fragmentShaderId);
-        if (!checkShaderError(fragmentShaderId)) {
-            GLint infoLogLength;
-            glGetShaderiv(fragmentShaderId, GL_INFO_LOG_LENGTH, &infoLogLength);
-            GLchar* strInfoLog = new GLchar[infoLogLength + 1];
-            glGetShaderInfoLog(fragmentShaderId, infoLogLength, NULL, strInfoLog);
-
-            removeOpenGLContexts();
-            std::cerr << "RenderManagerOpenGL::OpenDisplay: Could not "
-                         "construct fragment shader:"
-                      << std::endl << strInfoLog << std::endl;
-            ret.status = FAILURE;
-            return ret;
+        //======================================================
+        // Compile and link the shaders on a thread of their own, in a
+        // context that shares objects with ours, while capture is set up
+        // and the meshes are computed.  Some drivers take a long time to
+        // do this.  If we can't get that context, or can't make it current
+        // there, they are compiled on this thread once the others are done.
+        auto shaderContext =
+            stages.add("CreateShaderContext", true, {extensions}, [&] {
+                if (!addShaderContext()) {
+                    std::cerr << "RenderManagerOpenGL::OpenDisplay: "
+                                 "Warning: Could not create context for "
+                                 "compiling shaders, compiling them on the "
+                                 "application's thread"
+                              << std::endl;
+                }
+                return true;
+            });
+
+        auto shadersCompiled =
+            stages.add("CompileShaders", false, {shaderContext}, [&] {
+                if (!haveShaderContext() || !makeShaderContextCurrent(true)) {
+                    return true;
+                }
+                bool compiled = compileShaders();
+                // Objects made in one context are only sure to be seen
+                // complete in another once the commands that made them
+                // have finished.
+                glFinish();
+                makeShaderContextCurrent(false);
+                return compiled;
+            });
+
+        auto shaders =
+            stages.add("FinishShaders", true, {shadersCompiled}, [&] {
+                removeShaderContext();
+                if ((m_programId == 0) && !compileShaders()) {
+                    return false;
+                }
+                return true;
+            });
+
+        // When the meshes are built in the background, the mesh stage
+        // installs an undistorted one and starts that instead.
+        std::vector<DistortionMesh> meshes;
+        bool backgroundMeshes = m_params.m_backgroundDistortionMeshes;
+        auto meshesComputed = shaders;
+        if (!backgroundMeshes) {
+            meshesComputed =
+                stages.add("ComputeDistortionMeshes", false, {}, [&] {
+                    return ComputeDistortionMeshes(
+                        SQUARE, m_params.m_distortionParameters, meshes);
+                });
         }
 
-        checkForGLError("RenderManagerOpenGL::OpenDisplay after shader compile");
-
-        m_programId = glCreateProgram();
-        glAttachShader(m_programId, vertexShaderId);
-        glAttachShader(m_programId, fragmentShaderId);
-        glLinkProgram(m_programId);
-        if (!checkProgramError(m_programId)) {
-            removeOpenGLContexts();
-            std::cerr << "RenderManagerOpenGL::OpenDisplay: Could not link "
-                         "shader program "
-                      << std::endl;
-            ret.status = FAILURE;
-            return ret;
-        }
-        checkForGLError("RenderManagerOpenGL::OpenDisplay after program link");
+        auto meshesSet = stages.add(
+            "SetDistortionMeshes", true, {shaders, meshesComputed}, [&] {
+                glGenVertexArrays(1, &m_meshVAO);
+                if (backgroundMeshes
+                        ? !BuildDistortionMeshesInternal(
+                              SQUARE, m_params.m_distortionParameters, true)
+                        : !SetDistortionMeshesInternal(meshes)) {
+                    std::cerr << "RenderManagerOpenGL::OpenDisplay: Could "
+                                 "not construct distortion mesh"
+                              << std::endl;
+                    return false;
+                }
+                return true;
+            });
 
-        m_projectionUniformId =
-            glGetUniformLocation(m_programId, "projectionMatrix");
-        m_modelViewUniformId =
-            glGetUniformLocation(m_programId, "modelViewMatrix");
-        m_textureUniformId = glGetUniformLocation(m_programId, "textureMatrix");
+        //======================================================
+        // Get ready to capture presented displays if we've been asked to.
+        auto capture = stages.add("SetupCapture", true, {displayBuffers}, [&] {
+            if (!setupCapture(p.width, p.height)) {
+                std::cerr << "RenderManagerOpenGL::OpenDisplay: Could not "
+                             "set up capture"
+                          << std::endl;
+                return false;
+            }
+            return true;
+        });
 
-        // Now that they are linked, we don't need to keep them around.
-        glDeleteShader(vertexShaderId);
-        glDeleteShader(fragmentShaderId);
+        //======================================================
+        // If we're going to present from a separate thread, make a context
+        // for it that shares our textures, buffers, and programs, which must
+        // all have been made.  If we can't get one, presentation stays on
+        // the application's thread.
+        stages.add("CreatePresentContext", true, {meshesSet, capture}, [&] {
+            if ((m_params.m_presentQueueDepth > 0) && !addPresentContext()) {
+                std::cerr << "RenderManagerOpenGL::OpenDisplay: Warning: "
+                             "Could not create context for queued "
+                             "presentation"
+                          << std::endl;
+            }
+            return true;
+        });
 
-        if (!UpdateDistortionMeshesInternal(SQUARE,
-                                            m_params.m_distortionParameters)) {
+        bool opened = stages.run(m_trace.get());
+        m_startupTiming = stages.timing();
+        if (!opened) {
             removeOpenGLContexts();
-            std::cerr << "RenderManagerOpenGL::OpenDisplay: Could not "
-                         "construct distortion mesh"
-                      << std::endl;
             ret.status = FAILURE;
             return ret;
         }
@@ -541,20 +895,23 @@ namespace renderkit {
     }
 
     bool RenderManagerOpenGL::RenderDisplayInitialize(size_t display) {
-        checkForGLError("RenderManagerOpenGL::RenderDisplayInitialize start");
+        checkForGLErrorInFrame(
+            "RenderManagerOpenGL::RenderDisplayInitialize start");
 
         // Make our OpenGL context current
-        SDL_GL_MakeCurrent(m_displays[display].m_window, m_GLContext);
-        checkForGLError("RenderManagerOpenGL::RenderDisplayInitialize end");
+        makeContextCurrent(display, false);
+        checkForGLErrorInFrame(
+            "RenderManagerOpenGL::RenderDisplayInitialize end");
         return true;
     }
 
     bool RenderManagerOpenGL::RenderEyeInitialize(size_t eye) {
-        checkForGLError("RenderManagerOpenGL::RenderEyeInitialize starting");
+        checkForGLErrorInFrame(
+            "RenderManagerOpenGL::RenderEyeInitialize starting");
 
         // Render to our framebuffer
         glBindFramebuffer(GL_FRAMEBUFFER, m_frameBuffer);
-        if (checkForGLError(
+        if (checkForGLErrorInFrame(
                 "RenderManagerOpenGL::RenderEyeInitialize glBindFrameBuffer")) {
             return false;
         }
@@ -564,7 +921,7 @@ namespace renderkit {
                              m_colorBuffers[eye].OpenGL->colorBufferName, 0);
         glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT,
                                   GL_RENDERBUFFER, m_depthBuffers[eye]);
-        if (checkForGLError(
+        if (checkForGLErrorInFrame(
                 "RenderManagerOpenGL::RenderEyeInitialize Setting textures")) {
             return false;
         }
@@ -586,7 +943,8 @@ namespace renderkit {
                                          m_library, m_buffers);
         }
 
-        if (checkForGLError("RenderManagerOpenGL::RenderEyeInitialize")) {
+        if (checkForGLErrorInFrame(
+                "RenderManagerOpenGL::RenderEyeInitialize")) {
             return false;
         }
         return true;
@@ -604,12 +962,12 @@ namespace renderkit {
         deadline.microseconds = 0;
         deadline.seconds = 0;
 
-        checkForGLError(
+        checkForGLErrorInFrame(
           "RenderManagerOpenGL::RenderSpace: Before calling user callback");
         RenderCallbackInfo& cb = m_callbacks[whichSpace];
         cb.m_callback(cb.m_userData, m_library, m_buffers, viewport, pose,
                       projection, deadline);
-        checkForGLError(
+        checkForGLErrorInFrame(
           "RenderManagerOpenGL::RenderSpace: After calling user callback");
 
         /// @todo Keep track of timing information
@@ -618,14 +976,12 @@ namespace renderkit {
     }
 
     RenderManagerOpenGL::DistortionMeshBuffer::DistortionMeshBuffer()
-        : VAO(0)
-        , vertexBuffer(0)
+        : vertexBuffer(0)
         , indexBuffer(0)
     {   }
 
     RenderManagerOpenGL::DistortionMeshBuffer::DistortionMeshBuffer(
         DistortionMeshBuffer && rhs) {
-        VAO = std::move(rhs.VAO);
         vertexBuffer = std::move(rhs.vertexBuffer);
         indexBuffer = std::move(rhs.indexBuffer);
         vertices = std::move(rhs.vertices);
@@ -641,7 +997,6 @@ namespace renderkit {
         DistortionMeshBuffer && rhs) {
         if (&rhs != this) {
             Clear();
-            VAO = std::move(rhs.VAO);
             vertexBuffer = std::move(rhs.vertexBuffer);
             indexBuffer = std::move(rhs.indexBuffer);
             vertices = std::move(rhs.vertices);
@@ -651,10 +1006,6 @@ namespace renderkit {
     }
 
     void RenderManagerOpenGL::DistortionMeshBuffer::Clear() {
-        if (VAO) {
-            glDeleteVertexArrays(1, &VAO);
-            VAO = 0;
-        }
         if (vertexBuffer) {
             glDeleteBuffers(1, &vertexBuffer);
             vertexBuffer = 0;
@@ -667,41 +1018,52 @@ namespace renderkit {
         indices.clear();
     }
 
+    void RenderManagerOpenGL::setDistortionVertexAttributes() {
+        size_t const stride = sizeof(DistortionVertex);
+        glVertexAttribPointer(0, 4, GL_FLOAT, GL_FALSE, stride,
+            (void*)offsetof(DistortionVertex,pos));
+        glEnableVertexAttribArray(0);
+        glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, stride,
+            (void*)offsetof(DistortionVertex, texRed));
+        glEnableVertexAttribArray(1);
+        glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, stride,
+            (void*)offsetof(DistortionVertex, texGreen));
+        glEnableVertexAttribArray(2);
+        glVertexAttribPointer(3, 2, GL_FLOAT, GL_FALSE, stride,
+            (void*)offsetof(DistortionVertex, texBlue));
+        glEnableVertexAttribArray(3);
+    }
+
     bool RenderManagerOpenGL::UpdateDistortionMeshesInternal(
         DistortionMeshType type //< Type of mesh to produce
         ,
         std::vector<DistortionParameters> const&
             distort //< Distortion parameters
         ) {
-
-        // Clear the triangle and quad buffers if we have created them before.
-        m_distortionMeshBuffer.clear();
-
-        // Construct the data buffer that will hold the vertices and texture
-        // coordinates for R,G,B distortion mapping.
-
-        size_t const numEyes = GetNumEyes();
-        if (numEyes > distort.size()) {
-            std::cerr << "RenderManagerD3D11Base::UpdateDistortionMesh: "
-                "Not enough distortion parameters for all eyes" << std::endl;
+        std::vector<DistortionMesh> meshes;
+        if (!ComputeDistortionMeshes(type, distort, meshes) ||
+            !SetDistortionMeshesInternal(meshes)) {
+            std::cerr << "RenderManagerOpenGL::UpdateDistortionMesh: Could "
+                         "not create meshes"
+                      << std::endl;
             removeOpenGLContexts();
             return false;
         }
+        return true;
+    }
 
-        m_distortionMeshBuffer.resize(numEyes);
-        for (size_t eye = 0; eye < numEyes; eye++) {
-
-            auto & meshBuffer = m_distortionMeshBuffer[eye];
+    bool RenderManagerOpenGL::SetDistortionMeshesInternal(
+        std::vector<DistortionMesh> const& meshes) {
+        // Construct the data buffers that will hold the vertices and texture
+        // coordinates for R,G,B distortion mapping.  These are shared between
+        // contexts, so this can be done on the presenter thread as well as
+        // ours; the vertex arrays that are not shared are aimed at them when
+        // each eye is drawn.
+        std::vector<DistortionMeshBuffer> buffers(meshes.size());
+        for (size_t eye = 0; eye < meshes.size(); eye++) {
 
-            // Compute the distortion mesh
-            DistortionMesh mesh = ComputeDistortionMesh(eye, type, distort[eye]);
-            if (mesh.vertices.empty()) {
-                std::cerr << "RenderManagerOpenGL::UpdateDistortionMesh: Could "
-                             "not create mesh "
-                          << "for eye " << eye << std::endl;
-                removeOpenGLContexts();
-                return false;
-            }
+            auto & meshBuffer = buffers[eye];
+            auto const & mesh = meshes[eye];
 
             // Transcribe the vertex data into the correct format
             meshBuffer.vertices.resize(mesh.vertices.size());
@@ -726,39 +1088,29 @@ namespace renderkit {
             // Copy the index data
             meshBuffer.indices = mesh.indices;
 
-            // Construct the geometry we're going to render into the eyes
-            glGenVertexArrays(1, &meshBuffer.VAO);
-            glBindVertexArray(meshBuffer.VAO);
-            
+            // Construct the geometry we're going to render into the eyes.
+            // The index buffer is filled through the array-buffer binding
+            // because the element-array binding belongs to whatever vertex
+            // array is bound.
             glGenBuffers(1, &meshBuffer.vertexBuffer);
             glBindBuffer(GL_ARRAY_BUFFER, meshBuffer.vertexBuffer);
             glBufferData(GL_ARRAY_BUFFER,
                 sizeof(DistortionVertex) * meshBuffer.vertices.size(),
                 &meshBuffer.vertices[0], GL_STATIC_DRAW);
 
-            size_t const stride = sizeof(DistortionVertex);
-            glVertexAttribPointer(0, 4, GL_FLOAT, GL_FALSE, stride,
-                (void*)offsetof(DistortionVertex,pos));
-            glEnableVertexAttribArray(0);
-            glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, stride,
-                (void*)offsetof(DistortionVertex, texRed));
-            glEnableVertexAttribArray(1);
-            glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, stride,
-                (void*)offsetof(DistortionVertex, texGreen));
-            glEnableVertexAttribArray(2);
-            glVertexAttribPointer(3, 2, GL_FLOAT, GL_FALSE, stride,
-                (void*)offsetof(DistortionVertex, texBlue));
-            glEnableVertexAttribArray(3);
-
             glGenBuffers(1, &meshBuffer.indexBuffer);
-            glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, meshBuffer.indexBuffer);
-            glBufferData(GL_ELEMENT_ARRAY_BUFFER,
+            glBindBuffer(GL_ARRAY_BUFFER, meshBuffer.indexBuffer);
+            glBufferData(GL_ARRAY_BUFFER,
                 sizeof(decltype(meshBuffer.indices[0])) * meshBuffer.indices.size(),
                 &meshBuffer.indices[0], GL_STATIC_DRAW);
-
-            glBindVertexArray(0);
+            glBindBuffer(GL_ARRAY_BUFFER, 0);
+        }
+        if (checkForGLError(
+                "RenderManagerOpenGL::SetDistortionMeshesInternal")) {
+            return false;
         }
 
+        m_distortionMeshBuffer.swap(buffers);
         return true;
     }
 
@@ -767,7 +1119,7 @@ namespace renderkit {
     }
 
     bool RenderManagerOpenGL::RenderFrameFinalize() {
-        checkForGLError(
+        checkForGLErrorInFrame(
           "RenderManagerOpenGL::RenderFramaFinalize: start");
         if (!PresentRenderBuffersInternal(m_colorBuffers, m_renderInfoForRender,
                                           m_renderParamsForRender)) {
@@ -783,12 +1135,14 @@ namespace renderkit {
         if (display >= GetNumDisplays()) {
             return false;
         }
-        checkForGLError(
+        checkForGLErrorInFrame(
           "RenderManagerOpenGL::PresentDisplayInitialize: start");
 
-        // Make our OpenGL context current
-        SDL_GL_MakeCurrent(m_displays[display].m_window, m_GLContext);
-        checkForGLError(
+        // Make our OpenGL context current, or the presenter thread's
+        // context if we're on that thread, and draw into the display.
+        makeContextCurrent(display, OnPresentQueueThread());
+        glBindFramebuffer(GL_FRAMEBUFFER, displayFramebuffer(display));
+        checkForGLErrorInFrame(
           "RenderManagerOpenGL::PresentDisplayInitialize: after making GL current");
         return true;
     }
@@ -798,11 +1152,38 @@ namespace renderkit {
             return false;
         }
 
-        SDL_GL_SwapWindow(m_displays[display].m_window);
-        return true;
+        // This catches errors from anywhere in the present pass (and the
+        // render pass before it), including those that were not checked
+        // for as they happened, for the cost of one glGetError() when
+        // there were none.
+        if (checkForGLErrorAtFrameEnd(
+                "RenderManagerOpenGL::PresentDisplayFinalize")) {
+            return false;
+        }
+
+        captureDisplay(display);
+        return swapDisplay(display);
     }
 
     bool RenderManagerOpenGL::PresentFrameFinalize() {
+        // Decide whether the next frame gets checked step by step.
+        if (m_glErrorChecking ==
+            ConstructorParameters::SampledGLErrorChecking) {
+            m_glErrorFrames++;
+            m_glCheckEveryStep =
+                (m_glErrorFrames % m_params.m_glErrorCheckInterval) == 0;
+        }
+
+        // SDL events have to be handled on the thread that made the
+        // window, so the presenter thread leaves them for
+        // QueuedPresentSubmit().
+        if (OnPresentQueueThread()) {
+            return true;
+        }
+        return handleSDLEvents();
+    }
+
+    bool RenderManagerOpenGL::handleSDLEvents() {
         // Let SDL handle any system events that it needs to.
         SDL_Event e;
         while (SDL_PollEvent(&e)) {
@@ -817,7 +1198,7 @@ namespace renderkit {
     }
 
     bool RenderManagerOpenGL::PresentEye(PresentEyeParameters params) {
-        if (checkForGLError(
+        if (checkForGLErrorInFrame(
                 "RenderManagerOpenGL::PresentEye start")) {
             return false;
         }
@@ -827,25 +1208,23 @@ namespace renderkit {
                 << std::endl;
             return false;
         }
-
-        // Construct the OpenGL viewport based on which eye this is.
-        OSVR_ViewportDescription viewportDesc;
-        if (!ConstructViewportForPresent(
-                params.m_index, viewportDesc,
-                m_params.m_displayConfiguration.getSwapEyes())) {
-            std::cerr << "RenderManagerOpenGL::PresentEye(): Could not "
-                         "construct viewport"
+        if (params.m_plan == nullptr) {
+            std::cerr << "RenderManagerOpenGL::PresentEye(): NULL present "
+                         "plan pointer"
                       << std::endl;
             return false;
         }
-        // Adjust the viewport based on how much the display window is
-        // rotated with respect to the rendering window.
-        viewportDesc = RotateViewport(viewportDesc);
+        const PresentEyePlan& plan = *params.m_plan;
+
+        // The OpenGL viewport for this eye, already adjusted for how much
+        // the display window is rotated with respect to the rendering
+        // window.
+        const OSVR_ViewportDescription& viewportDesc = plan.viewport;
         glViewport(static_cast<GLint>(viewportDesc.left),
                    static_cast<GLint>(viewportDesc.lower),
                    static_cast<GLsizei>(viewportDesc.width),
                    static_cast<GLsizei>(viewportDesc.height));
-        if (checkForGLError(
+        if (checkForGLErrorInFrame(
           "RenderManagerOpenGL::PresentEye after glViewport")) {
           return false;
         }
@@ -860,9 +1239,10 @@ namespace renderkit {
         /// returning.
         GLint userProgram;
         glGetIntegerv(GL_CURRENT_PROGRAM, &userProgram);
-        checkForGLError("RenderManagerOpenGL::PresentEye after get user program");
+        checkForGLErrorInFrame(
+            "RenderManagerOpenGL::PresentEye after get user program");
         glUseProgram(m_programId);
-        if (checkForGLError(
+        if (checkForGLErrorInFrame(
           "RenderManagerOpenGL::PresentEye after use program")) {
           return false;
         }
@@ -876,8 +1256,8 @@ namespace renderkit {
         GLfloat scaleProj[16] = { myScale, 0, 0, 0, 0, myScale, 0, 0,
           0, 0, 1, 0, 0, 0, 0, 1 };
         glUniformMatrix4fv(m_projectionUniformId, 1, GL_FALSE, scaleProj);
-        if (checkForGLError("RenderManagerOpenGL::PresentEye after projection "
-          "matrix setting")) {
+        if (checkForGLErrorInFrame("RenderManagerOpenGL::PresentEye after "
+                                   "projection matrix setting")) {
           return false;
         }
 
@@ -888,18 +1268,10 @@ namespace renderkit {
         // example).
         // @todo think about how we get square pixels, to properly handle
         // distortion correction.
-        matrix16 modelView;
-        if (!ComputeDisplayOrientationMatrix(
-          static_cast<float>(params.m_rotateDegrees), params.m_flipInY,
-          modelView)) {
-          std::cerr << "RenderManagerOpenGL::PresentEye(): "
-            "ComputeDisplayOrientationMatrix failed"
-            << std::endl;
-          return false;
-        }
-        glUniformMatrix4fv(m_modelViewUniformId, 1, GL_FALSE, modelView.data);
-        if (checkForGLError("RenderManagerOpenGL::PresentEye after modelView "
-          "matrix setting")) {
+        glUniformMatrix4fv(m_modelViewUniformId, 1, GL_FALSE,
+                           plan.orientation.data);
+        if (checkForGLErrorInFrame("RenderManagerOpenGL::PresentEye after "
+                                   "modelView matrix setting")) {
           return false;
         }
 
@@ -926,26 +1298,23 @@ namespace renderkit {
         // texture matrix to map the original range (0..1) to the proper
         // location.
         // We read in, multiply, and write out textureMat.
-        matrix16 crop;
-        ComputeRenderBufferCropMatrix(params.m_normalizedCroppingViewport,
-          crop);
-        Eigen::Map<Eigen::MatrixXf> textureEigen(textureMat, 4, 4);
-        Eigen::Map<Eigen::MatrixXf> cropEigen(crop.data, 4, 4);
-        Eigen::MatrixXf full(4, 4);
-        full = textureEigen * cropEigen;
-        memcpy(textureMat, full.data(), 16 * sizeof(float));
+        Eigen::Map<Eigen::Matrix4f> textureEigen(textureMat);
+        textureEigen =
+            textureEigen * Eigen::Map<const Eigen::Matrix4f>(
+                               plan.cropMatrix.data);
 
         glUniformMatrix4fv(m_textureUniformId, 1, GL_FALSE, textureMat);
-        if (checkForGLError("RenderManagerOpenGL::PresentEye after texture "
-          "matrix setting")) {
+        if (checkForGLErrorInFrame("RenderManagerOpenGL::PresentEye after "
+                                   "texture matrix setting")) {
           return false;
         }
 
         // Render the geometry to fill the viewport, with the texture
         // mapped onto it.
 
-        // Render to the 0th frame buffer, which is the screen.
-        glBindFramebuffer(GL_FRAMEBUFFER, 0);
+        // Render to the display's frame buffer, which is normally the
+        // 0th one, the screen.
+        glBindFramebuffer(GL_FRAMEBUFFER, displayFramebuffer(display));
 
         // Bind the texture that we're going to use to render into the
         // frame buffer.
@@ -977,7 +1346,7 @@ namespace renderkit {
         glDisable(GL_DEPTH_TEST);
         glDisable(GL_CULL_FACE);
 
-        if (checkForGLError(
+        if (checkForGLErrorInFrame(
           "RenderManagerOpenGL::PresentEye after environment setting")) {
           return false;
         }
@@ -985,13 +1354,18 @@ namespace renderkit {
         // @todo save and later restore the state telling which texture is bound
         // and which vertex attributes are set
 
-        if (checkForGLError(
+        if (checkForGLErrorInFrame(
           "RenderManagerOpenGL::PresentEye after texture bind")) {
           return false;
         }
 
+        // Vertex arrays are not shared between contexts, so each context
+        // aims its own at this eye's mesh buffers.
         auto const & meshBuffer = m_distortionMeshBuffer[params.m_index];
-        glBindVertexArray(meshBuffer.VAO);
+        glBindVertexArray(OnPresentQueueThread() ? m_presentVAO : m_meshVAO);
+        glBindBuffer(GL_ARRAY_BUFFER, meshBuffer.vertexBuffer);
+        setDistortionVertexAttributes();
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, meshBuffer.indexBuffer);
         glDrawElements(GL_TRIANGLES,
           static_cast<GLsizei>(meshBuffer.indices.size()),
           GL_UNSIGNED_SHORT, 0);
@@ -1010,7 +1384,7 @@ namespace renderkit {
           glDisable(GL_CULL_FACE);
         }
 
-        if (checkForGLError("RenderManagerOpenGL::PresentEye end")) {
+        if (checkForGLErrorInFrame("RenderManagerOpenGL::PresentEye end")) {
             return false;
         }
 
@@ -1040,7 +1414,7 @@ namespace renderkit {
         static_cast<GLint>(viewportDesc.lower),
         static_cast<GLsizei>(viewportDesc.width),
         static_cast<GLsizei>(viewportDesc.height));
-      if (checkForGLError(
+      if (checkForGLErrorInFrame(
         "RenderManagerOpenGL::SolidColorEye after glViewport")) {
         return false;
       }
@@ -1052,6 +1426,391 @@ namespace renderkit {
       return true;
     }
 
+    bool RenderManagerOpenGL::QueuedPresentSupported() {
+        return havePresentContext();
+    }
+
+    bool RenderManagerOpenGL::QueuedPresentThreadInitialize() {
+        if (!makeContextCurrent(0, true)) {
+            std::cerr << "RenderManagerOpenGL::QueuedPresentThreadInitialize: "
+                         "Could not make context current"
+                      << std::endl;
+            return false;
+        }
+
+        // Swap interval is per-context, so match what OpenDisplay() set.
+        setSwapInterval(m_params.m_verticalSync ? 1 : 0);
+
+        // So is debug output.
+        if (m_glErrorChecking ==
+            ConstructorParameters::DebugOutputGLErrorChecking) {
+            enableGLDebugOutput();
+        }
+
+        glGenVertexArrays(1, &m_presentVAO);
+        if (checkForGLError("RenderManagerOpenGL::"
+                            "QueuedPresentThreadInitialize")) {
+            releaseContext();
+            return false;
+        }
+        return true;
+    }
+
+    void RenderManagerOpenGL::QueuedPresentThreadFinalize() {
+        deleteGPUTimerQueries(m_presentGPUTimerQueries);
+#ifndef RM_USE_OPENGLES20
+        if (m_presentCaptureFramebuffer != 0) {
+            glDeleteFramebuffers(1, &m_presentCaptureFramebuffer);
+            m_presentCaptureFramebuffer = 0;
+        }
+#endif
+        if (m_presentVAO) {
+            glDeleteVertexArrays(1, &m_presentVAO);
+            m_presentVAO = 0;
+        }
+        releaseContext();
+    }
+
+    bool RenderManagerOpenGL::QueuedPresentSubmit(void*& syncObject) {
+        syncObject = nullptr;
+
+        // The presenter thread can't handle window events, so we do it
+        // here on the application's thread.
+        if (!handleSDLEvents()) {
+            return false;
+        }
+
+        // Make sure that the application's rendering into the buffers is
+        // done before the presenter thread's context reads them.
+#ifdef RM_USE_OPENGLES20
+        // No fences in OpenGL ES 2.0.
+        glFinish();
+#else
+        syncObject = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+        glFlush();
+        if (syncObject == nullptr) {
+            checkForGLError("RenderManagerOpenGL::QueuedPresentSubmit");
+            return false;
+        }
+#endif
+        return true;
+    }
+
+    bool RenderManagerOpenGL::QueuedPresentWait(void* syncObject) {
+#ifndef RM_USE_OPENGLES20
+        if (syncObject != nullptr) {
+            GLsync fence = static_cast<GLsync>(syncObject);
+            glWaitSync(fence, 0, GL_TIMEOUT_IGNORED);
+            glDeleteSync(fence);
+        }
+#endif
+        return true;
+    }
+
+    RenderManagerOpenGL::GPUTimerQueries&
+    RenderManagerOpenGL::currentGPUTimerQueries() {
+        if (OnPresentQueueThread()) {
+            return m_presentGPUTimerQueries;
+        }
+        return m_gpuTimerQueries;
+    }
+
+    void RenderManagerOpenGL::deleteGPUTimerQueries(GPUTimerQueries& queries) {
+#ifndef RM_USE_OPENGLES20
+        if (queries.created) {
+            for (auto& frame : queries.ids) {
+                glDeleteQueries(static_cast<GLsizei>(frame.size()),
+                                frame.data());
+            }
+            queries.created = false;
+        }
+#endif
+    }
+
+    bool RenderManagerOpenGL::GPUTimerBegin(size_t slot) {
+#ifdef RM_USE_OPENGLES20
+        // OpenGL ES 2.0 has no timer queries.
+        return false;
+#else
+        if (!m_gpuTimerSupported) {
+            return false;
+        }
+        GPUTimerQueries& queries = currentGPUTimerQueries();
+        if (!queries.created) {
+            for (auto& frame : queries.ids) {
+                glGenQueries(static_cast<GLsizei>(frame.size()),
+                             frame.data());
+            }
+            queries.created = true;
+            if (checkForGLError(
+                    "RenderManagerOpenGL::GPUTimerBegin creating queries")) {
+                std::cerr << "RenderManagerOpenGL::GPUTimerBegin: Disabling "
+                             "GPU timing"
+                          << std::endl;
+                m_gpuTimerSupported = false;
+                return false;
+            }
+        }
+        m_gpuTimerSlotQueries[slot] = &queries;
+        glQueryCounter(queries.ids[slot][GPU_TIMER_FRAME_START],
+                       GL_TIMESTAMP);
+        return true;
+#endif
+    }
+
+    void RenderManagerOpenGL::GPUTimerMark(size_t slot, size_t mark) {
+#ifndef RM_USE_OPENGLES20
+        glQueryCounter(m_gpuTimerSlotQueries[slot]->ids[slot][mark],
+                       GL_TIMESTAMP);
+#endif
+    }
+
+    void RenderManagerOpenGL::GPUTimerEnd(size_t slot) {
+        GPUTimerMark(slot, GPU_TIMER_FRAME_END);
+    }
+
+    bool RenderManagerOpenGL::GPUTimerRead(size_t slot, size_t numEyes,
+                                           double* seconds, bool& valid) {
+        valid = false;
+#ifndef RM_USE_OPENGLES20
+        // Queries from the other context can't be read from this one;
+        // this only happens when presentation moves between threads.
+        GPUTimerQueries* queries = m_gpuTimerSlotQueries[slot];
+        if (queries != &currentGPUTimerQueries()) {
+            return true;
+        }
+        auto const& ids = queries->ids[slot];
+
+        // Results arrive in order, so if the last one is in, all are.
+        GLint available = 0;
+        glGetQueryObjectiv(ids[GPU_TIMER_FRAME_END],
+                           GL_QUERY_RESULT_AVAILABLE, &available);
+        if (!available) {
+            return false;
+        }
+        GLuint64 start = 0;
+        glGetQueryObjectui64v(ids[GPU_TIMER_FRAME_START], GL_QUERY_RESULT,
+                              &start);
+        size_t marks = GPU_TIMER_EYE_START + 2 * numEyes;
+        for (size_t mark = GPU_TIMER_FRAME_END; mark < marks; mark++) {
+            GLuint64 ns = 0;
+            glGetQueryObjectui64v(ids[mark], GL_QUERY_RESULT, &ns);
+            seconds[mark] = static_cast<double>(ns - start) * 1e-9;
+        }
+        seconds[GPU_TIMER_FRAME_START] = 0;
+        valid = !checkForGLErrorInFrame("RenderManagerOpenGL::GPUTimerRead");
+#endif
+        return true;
+    }
+
+    bool RenderManagerOpenGL::setupCapture(int displayWidth,
+                                           int displayHeight) {
+        if (m_params.m_captureBuffers == 0) {
+            return true;
+        }
+        const GraphicsLibraryOpenGL* library =
+            m_params.m_graphicsLibrary.OpenGL;
+        if ((library == nullptr) || (library->captureCallback == nullptr)) {
+            std::cerr << "RenderManagerOpenGL::setupCapture: Warning: "
+                         "captureBuffers is set but the application gave no "
+                         "captureCallback, so nothing will be captured"
+                      << std::endl;
+            return true;
+        }
+#ifdef RM_USE_OPENGLES20
+        // OpenGL ES 2.0 has no pixel-buffer objects, fences or blits.
+        std::cerr << "RenderManagerOpenGL::setupCapture: Warning: Capture "
+                     "is not available with OpenGL ES 2.0"
+                  << std::endl;
+        return true;
+#else
+        if (!(GLEW_VERSION_3_2 || GLEW_ARB_sync)) {
+            std::cerr << "RenderManagerOpenGL::setupCapture: Warning: "
+                         "Fences not available, so nothing will be captured"
+                      << std::endl;
+            return true;
+        }
+
+        // Work out what part of each display to capture, and how big.
+        GLsizei downscale =
+            static_cast<GLsizei>(std::max(m_params.m_captureDownscale, 1u));
+        m_captures.resize(GetNumDisplays());
+        for (size_t display = 0; display < m_captures.size(); display++) {
+            DisplayCapture& capture = m_captures[display];
+            capture.width = displayWidth;
+            capture.height = displayHeight;
+            if (m_params.m_captureEye >= 0) {
+                size_t eye = static_cast<size_t>(m_params.m_captureEye);
+                OSVR_ViewportDescription v;
+                if ((eye >= GetNumEyes()) ||
+                    !ConstructViewportForPresent(
+                        eye, v,
+                        m_params.m_displayConfiguration.getSwapEyes())) {
+                    std::cerr << "RenderManagerOpenGL::setupCapture: "
+                                 "captureEye "
+                              << eye << " is not a valid eye" << std::endl;
+                    m_captures.clear();
+                    return false;
+                }
+                if (GetDisplayUsedByEye(eye) != display) {
+                    // Nothing to capture on this display.
+                    continue;
+                }
+                v = RotateViewport(v);
+                capture.eye = m_params.m_captureEye;
+                capture.x = static_cast<GLint>(v.left);
+                capture.y = static_cast<GLint>(v.lower);
+                capture.width = static_cast<GLsizei>(v.width);
+                capture.height = static_cast<GLsizei>(v.height);
+            }
+            capture.captureWidth = std::max(capture.width / downscale, 1);
+            capture.captureHeight = std::max(capture.height / downscale, 1);
+
+            glGenTextures(1, &capture.texture);
+            glBindTexture(GL_TEXTURE_2D, capture.texture);
+            glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, capture.captureWidth,
+                         capture.captureHeight, 0, GL_RGBA, GL_UNSIGNED_BYTE,
+                         nullptr);
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+            glBindTexture(GL_TEXTURE_2D, 0);
+
+            GLsizeiptr bytes = static_cast<GLsizeiptr>(capture.captureWidth) *
+                               capture.captureHeight * 4;
+            capture.slots.resize(m_params.m_captureBuffers);
+            for (CaptureSlot& slot : capture.slots) {
+                glGenBuffers(1, &slot.pixelBuffer);
+                glBindBuffer(GL_PIXEL_PACK_BUFFER, slot.pixelBuffer);
+                glBufferData(GL_PIXEL_PACK_BUFFER, bytes, nullptr,
+                             GL_STREAM_READ);
+            }
+            glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+        }
+        if (checkForGLError("RenderManagerOpenGL::setupCapture")) {
+            deleteCaptures();
+            return false;
+        }
+        return true;
+#endif
+    }
+
+    void RenderManagerOpenGL::captureDisplay(size_t display) {
+#ifndef RM_USE_OPENGLES20
+        if (display >= m_captures.size()) {
+            return;
+        }
+        DisplayCapture& capture = m_captures[display];
+        if (capture.slots.empty()) {
+            return;
+        }
+        const GraphicsLibraryOpenGL* library =
+            m_params.m_graphicsLibrary.OpenGL;
+        size_t numSlots = capture.slots.size();
+        capture.presents++;
+
+        // Hand over the captures whose read-backs have finished, oldest
+        // first, without waiting for any that have not.  The one from the
+        // previous present is left for the next even if its fence has
+        // passed, so that mapping it is never the first thing to wait on
+        // the GPU's copy, and captures always arrive two presents late.
+        while (capture.slots[capture.oldest].fence != nullptr) {
+            CaptureSlot& slot = capture.slots[capture.oldest];
+            if (capture.presents - slot.present < 2) {
+                break;
+            }
+            GLsync fence = static_cast<GLsync>(slot.fence);
+            GLenum status = glClientWaitSync(fence, 0, 0);
+            if ((status != GL_ALREADY_SIGNALED) &&
+                (status != GL_CONDITION_SATISFIED)) {
+                break;
+            }
+            glDeleteSync(fence);
+            slot.fence = nullptr;
+            glBindBuffer(GL_PIXEL_PACK_BUFFER, slot.pixelBuffer);
+            GLsizeiptr bytes = static_cast<GLsizeiptr>(capture.captureWidth) *
+                               capture.captureHeight * 4;
+            const void* pixels = glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0,
+                                                  bytes, GL_MAP_READ_BIT);
+            if (pixels != nullptr) {
+                library->captureCallback(
+                    library->captureUserData, display, capture.eye,
+                    static_cast<const uint8_t*>(pixels), capture.captureWidth,
+                    capture.captureHeight);
+                glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+            }
+            glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+            capture.oldest = (capture.oldest + 1) % numSlots;
+        }
+
+        // Start this display's capture, unless the GPU is so far behind
+        // that every slot is still waiting.
+        CaptureSlot& slot = capture.slots[capture.next];
+        if (slot.fence != nullptr) {
+            capture.dropped++;
+            return;
+        }
+
+        // Framebuffers are not shared, so each context has its own to
+        // downscale into.
+        GLuint& framebuffer = OnPresentQueueThread()
+                                  ? m_presentCaptureFramebuffer
+                                  : m_captureFramebuffer;
+        if (framebuffer == 0) {
+            glGenFramebuffers(1, &framebuffer);
+        }
+        GLuint displayBuffer = displayFramebuffer(display);
+        glBindFramebuffer(GL_DRAW_FRAMEBUFFER, framebuffer);
+        glFramebufferTexture2D(GL_DRAW_FRAMEBUFFER, GL_COLOR_ATTACHMENT0,
+                               GL_TEXTURE_2D, capture.texture, 0);
+        glBindFramebuffer(GL_READ_FRAMEBUFFER, displayBuffer);
+        glBlitFramebuffer(capture.x, capture.y, capture.x + capture.width,
+                          capture.y + capture.height, 0, 0,
+                          capture.captureWidth, capture.captureHeight,
+                          GL_COLOR_BUFFER_BIT, GL_LINEAR);
+
+        // Read into the pixel buffer, which returns right away, and fence
+        // it so we know when it is ready.
+        glBindFramebuffer(GL_READ_FRAMEBUFFER, framebuffer);
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, slot.pixelBuffer);
+        glPixelStorei(GL_PACK_ALIGNMENT, 4);
+        glReadPixels(0, 0, capture.captureWidth, capture.captureHeight,
+                     GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+        slot.fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+        slot.present = capture.presents;
+        glBindFramebuffer(GL_FRAMEBUFFER, displayBuffer);
+        if (slot.fence != nullptr) {
+            capture.next = (capture.next + 1) % numSlots;
+        }
+        checkForGLErrorInFrame("RenderManagerOpenGL::captureDisplay");
+#endif
+    }
+
+    void RenderManagerOpenGL::deleteCaptures() {
+#ifndef RM_USE_OPENGLES20
+        for (DisplayCapture& capture : m_captures) {
+            for (CaptureSlot& slot : capture.slots) {
+                if (slot.fence != nullptr) {
+                    glDeleteSync(static_cast<GLsync>(slot.fence));
+                }
+                glDeleteBuffers(1, &slot.pixelBuffer);
+            }
+            if (capture.texture != 0) {
+                glDeleteTextures(1, &capture.texture);
+            }
+            if (capture.dropped > 0) {
+                std::cout << "RenderManagerOpenGL: Dropped " << capture.dropped
+                          << " captures because the GPU fell behind"
+                          << std::endl;
+            }
+        }
+        if (m_captureFramebuffer != 0) {
+            glDeleteFramebuffers(1, &m_captureFramebuffer);
+            m_captureFramebuffer = 0;
+        }
+#endif
+        m_captures.clear();
+    }
 
 } // namespace renderkit
 } // namespace osvr
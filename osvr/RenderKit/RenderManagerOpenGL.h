@@ -74,6 +74,7 @@ Sensics, Inc.
 
 #include <stdlib.h>
 
+#include <array>
 #include <vector>
 #include <string>
 
@@ -102,10 +103,17 @@ namespace renderkit {
             std::vector<DistortionParameters> const&
                 distort //< Distortion parameters
             ) override;
+        bool SetDistortionMeshesSupported() override { return true; }
+        bool SetDistortionMeshesInternal(
+            std::vector<DistortionMesh> const& meshes) override;
 
         bool m_doingOkay;   //< Are we doing okay?
         bool m_displayOpen; //< Has our display been opened?
 
+        /// Delete the buffers and vertex arrays made when the display was
+        /// opened.  Our context must still be current.
+        void deleteDisplayObjects();
+
         // Methods to open and close a window, used to get
         // the GL contexts established.  We have these outside
         // the OpenDisplay() call so that child classes can
@@ -137,8 +145,50 @@ namespace renderkit {
                 core = false; // compatibility by default, not to break existing apps
             }
         };
-        bool addOpenGLContext(GLContextParams p);
-        bool removeOpenGLContexts();
+        virtual bool addOpenGLContext(GLContextParams p);
+        virtual bool removeOpenGLContexts();
+
+        // Window-system operations, done with SDL here.  A child class
+        // that has no windows overrides these along with the two methods
+        // above.
+        /// Make our context current for drawing a display, or the
+        /// presenter thread's context if presentContext is true.
+        virtual bool makeContextCurrent(size_t display, bool presentContext);
+        /// Leave the calling thread with no context current.
+        virtual void releaseContext();
+        /// Set the swap interval of the current context.
+        virtual bool setSwapInterval(int interval);
+        /// Make m_presentGLContext, sharing objects with m_GLContext,
+        /// leaving m_GLContext current.
+        virtual bool addPresentContext();
+        /// Is there a context for the presenter thread?
+        virtual bool havePresentContext() {
+            return m_presentGLContext != nullptr;
+        }
+        /// Make m_shaderGLContext, sharing objects with m_GLContext, for
+        /// compiling the shaders on a worker thread while the display is
+        /// opened, leaving m_GLContext current.
+        virtual bool addShaderContext();
+        /// Make the shader context current on the calling thread, or
+        /// leave the calling thread with none current if current is false.
+        virtual bool makeShaderContextCurrent(bool current);
+        /// Get rid of the shader context, which must not be current on any
+        /// thread.
+        virtual void removeShaderContext();
+        /// Is there a context for compiling the shaders?
+        virtual bool haveShaderContext() {
+            return m_shaderGLContext != nullptr;
+        }
+        /// Framebuffer that a display is presented into (0 = its window)
+        /// in the current context.
+        virtual GLuint displayFramebuffer(size_t display) { return 0; }
+        /// Show a display once it has been presented into.
+        virtual bool swapDisplay(size_t display);
+        /// Did glewInit() load what we need, given what it returned?
+        virtual bool glewInitSucceeded(GLenum result);
+        /// Make what the displays are presented into, in our context, once
+        /// the extensions have been loaded.  Windows need nothing.
+        virtual bool addDisplayFramebuffers() { return true; }
 
         /// Construct the buffers we're going to use in Render() mode, which
         /// we use to actually use the Presentation mode.  This gives us the
@@ -157,6 +207,12 @@ namespace renderkit {
 
         SDL_GLContext
             m_GLContext; //< The context we use to render to all displays
+        SDL_GLContext m_presentGLContext; //< Shared context used by the
+                                          /// queued-present thread
+        SDL_GLContext m_shaderGLContext; //< Shared context used to compile
+                                         /// the shaders while opening
+        GLuint m_presentVAO; //< Vertex array for the queued-present thread
+        GLuint m_meshVAO;    //< Vertex array for our context
 
         // Special vertex/fragment shader information for our shader that
         // handles
@@ -181,8 +237,11 @@ namespace renderkit {
             GLfloat texBlue[2];
         };
 
+        /// Describe the layout of a DistortionVertex to the currently-bound
+        /// vertex array, reading from the currently-bound array buffer.
+        static void setDistortionVertexAttributes();
+
         struct DistortionMeshBuffer {
-            GLuint VAO;
             GLuint vertexBuffer;
             GLuint indexBuffer;
             std::vector<DistortionVertex> vertices;
@@ -229,15 +288,121 @@ namespace renderkit {
         bool PresentDisplayFinalize(size_t display) override;
         bool PresentFrameFinalize() override;
 
+        /// Let SDL handle any system events that it needs to.
+        /// @return False if the window has been asked to close.
+        virtual bool handleSDLEvents();
+
+        //===================================================================
+        // Overloaded queued-present functions from the base class.  The
+        // presenter thread uses its own context that shares our objects.
+        bool QueuedPresentSupported() override;
+        bool QueuedPresentThreadInitialize() override;
+        void QueuedPresentThreadFinalize() override;
+        bool QueuedPresentSubmit(void*& syncObject) override;
+        bool QueuedPresentWait(void* syncObject) override;
+
+        //===================================================================
+        // Overloaded GPU-timing functions from the base class, which use
+        // timestamp queries (OpenGL 3.3 or ARB_timer_query).  Query objects
+        // are not shared between contexts, so the presenter thread has its
+        // own set.
+        bool GPUTimerBegin(size_t slot) override;
+        void GPUTimerMark(size_t slot, size_t mark) override;
+        void GPUTimerEnd(size_t slot) override;
+        bool GPUTimerRead(size_t slot, size_t numEyes, double* seconds,
+                          bool& valid) override;
+
+        struct GPUTimerQueries {
+            bool created = false;
+            std::array<std::array<GLuint, GPU_TIMER_MARKS>, GPU_TIMER_FRAMES>
+                ids;
+        };
+        bool m_gpuTimerSupported = false; //< Timestamp queries available?
+        GPUTimerQueries m_gpuTimerQueries; //< For m_GLContext
+        GPUTimerQueries m_presentGPUTimerQueries; //< For m_presentGLContext
+        std::array<GPUTimerQueries*, GPU_TIMER_FRAMES>
+            m_gpuTimerSlotQueries = {}; //< Set each slot was issued from
+
+        /// Queries for the context that is current on the calling thread.
+        GPUTimerQueries& currentGPUTimerQueries();
+        static void deleteGPUTimerQueries(GPUTimerQueries& queries);
+
+        //===================================================================
+        // Capture of presented displays for the application's
+        // captureCallback.  Each capture is downscaled into a texture,
+        // read back into the next of a ring of pixel-buffer objects and
+        // fenced; captures are handed over two or more presents later,
+        // once their fences have passed, so presenting never waits for the
+        // GPU.  If the ring is full, the new capture is dropped instead.
+        struct CaptureSlot {
+            GLuint pixelBuffer = 0;
+            void* fence = nullptr; //< GLsync; nullptr when the slot is free
+            size_t present = 0;    //< DisplayCapture::presents when taken
+        };
+        struct DisplayCapture {
+            int eye = -1; //< Eye captured, or -1 for the whole display
+            GLint x = 0, y = 0;                    //< Region of the display
+            GLsizei width = 0, height = 0;         //< that is captured
+            GLsizei captureWidth = 0, captureHeight = 0; //< After downscaling
+            GLuint texture = 0; //< Downscaled copy, shared between contexts
+            std::vector<CaptureSlot> slots;
+            size_t next = 0;    //< Slot the next capture is read into
+            size_t oldest = 0;  //< Slot whose capture is handed over next
+            size_t dropped = 0; //< Captures skipped because the ring was full
+            size_t presents = 0; //< Times the display has been captured
+        };
+        std::vector<DisplayCapture> m_captures; //< Per display; empty if off
+        GLuint m_captureFramebuffer = 0;        //< For m_GLContext
+        GLuint m_presentCaptureFramebuffer = 0; //< For m_presentGLContext
+
+        /// Make the capture textures and pixel buffers, for displays the
+        /// given size, if capture has been asked for.
+        bool setupCapture(int displayWidth, int displayHeight);
+        /// Hand over finished captures of a display and start a new one.
+        void captureDisplay(size_t display);
+        /// Delete the capture objects, dropping unfinished captures.
+        void deleteCaptures();
+
         /// See if we had an OpenGL error
         /// @return True if there is an error, false if not.
         /// @param [in] message Message to print if there is an error
         static bool checkForGLError(const std::string& message);
 
+        /// Check for an OpenGL error after a step of rendering or
+        /// presenting a frame, if m_glErrorChecking calls for checking
+        /// every step on this frame.  Errors that are not checked for here
+        /// stay recorded and are reported by checkForGLErrorAtFrameEnd().
+        /// @return True if there is an error, false if not (or unchecked).
+        bool checkForGLErrorInFrame(const char* message);
+
+        /// Read every OpenGL error recorded since the last check, printing
+        /// them unless the debug-output callback has already reported
+        /// them.
+        /// @return True if there was an error during the frame, whether
+        /// read here or by checkForGLErrorInFrame(), false if not.
+        bool checkForGLErrorAtFrameEnd(const char* message);
+
+        /// Have the driver report errors through a KHR_debug callback on
+        /// the current context.
+        /// @return True on success, false if it is not available.
+        bool enableGLDebugOutput();
+
+        /// Compile and link the program that presents with time warp and
+        /// distortion, in the current context.
+        bool compileShaders();
+
+        /// Error checking in use, which falls back to frame-end checking
+        /// if debug output was asked for but is not available.
+        ConstructorParameters::GL_Error_Checking m_glErrorChecking;
+        bool m_glCheckEveryStep; //< checkForGLErrorInFrame() checks?
+        size_t m_glErrorFrames;  //< Frames presented, for sampling
+        bool m_glErrorInFrame;   //< checkForGLErrorInFrame() found one?
+
         friend RenderManager OSVR_RENDERMANAGER_EXPORT*
         createRenderManager(OSVR_ClientContext context,
                             const std::string& renderLibraryName,
-                            GraphicsLibrary graphicsLibrary);
+                            GraphicsLibrary graphicsLibrary,
+                            double connectTimeoutSeconds);
     };
 
 } // namespace renderkit
@@ -0,0 +1,463 @@
+/** @file
+@brief Implementation of an OpenGL RenderManager that presents into
+offscreen framebuffers through EGL, with no windows.
+
+@date 2026
+
+@author
+Sensics, Inc.
+<http://sensics.com/osvr>
+*/
+
+// Copyright 2026 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Internal Includes
+#include <GL/glew.h>
+#include "RenderManagerOpenGLOffscreen.h"
+#include "GraphicsLibraryOpenGL.h"
+
+// Library/third-party includes
+#include <EGL/eglext.h>
+
+// Standard includes
+#include <string>
+#include <iostream>
+#include <sstream>
+
+#ifndef EGL_PLATFORM_SURFACELESS_MESA
+#define EGL_PLATFORM_SURFACELESS_MESA 0x31DD
+#endif
+
+namespace osvr {
+namespace renderkit {
+
+    /// @brief Is an extension in an EGL extension string?
+    static bool hasEGLExtension(const char* extensions, const char* name) {
+        if (extensions == nullptr) {
+            return false;
+        }
+        std::istringstream list(extensions);
+        std::string extension;
+        while (list >> extension) {
+            if (extension == name) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    RenderManagerOpenGLOffscreen::RenderManagerOpenGLOffscreen(
+        OSVR_ClientContext context, ConstructorParameters p)
+        : RenderManagerOpenGL(context, p) {
+        // Initialize all of the variables that don't have to be done in the
+        // list above, so we don't get warnings about out-of-order
+        // initialization if they are re-ordered in the header file.
+        m_eglDisplay = EGL_NO_DISPLAY;
+        m_eglOwnDisplay = false;
+        m_eglConfig = nullptr;
+        m_eglContext = EGL_NO_CONTEXT;
+        m_eglPresentContext = EGL_NO_CONTEXT;
+        m_eglShaderContext = EGL_NO_CONTEXT;
+        m_eglSurface = EGL_NO_SURFACE;
+        m_eglPresentSurface = EGL_NO_SURFACE;
+        m_eglShaderSurface = EGL_NO_SURFACE;
+    }
+
+    RenderManagerOpenGLOffscreen::~RenderManagerOpenGLOffscreen() {
+        // The presenter thread uses our context and buffers, so it has to
+        // finish before we get rid of them.  Our parent's destructor
+        // can't call our versions of makeContextCurrent() and
+        // removeOpenGLContexts(), so we delete what was made in our
+        // context while it is current, then the context.
+        StopPresentQueue();
+        StopBackgroundDistortionMeshes();
+        if (m_eglContext != EGL_NO_CONTEXT) {
+            makeContextCurrent(0, false);
+            deleteGPUTimerQueries(m_gpuTimerQueries);
+            deleteCaptures();
+            deleteDisplayObjects();
+        }
+        removeOpenGLContexts();
+    }
+
+    bool RenderManagerOpenGLOffscreen::addDisplayFramebuffers() {
+        // Our context is current, and GLEW has been initialized.
+        for (OffscreenDisplay& d : m_offscreenDisplays) {
+            glGenTextures(1, &d.colorTexture);
+            glBindTexture(GL_TEXTURE_2D, d.colorTexture);
+            glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, d.width, d.height, 0,
+                         GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+            glBindTexture(GL_TEXTURE_2D, 0);
+            if (!makeDisplayFramebuffer(d, d.framebuffer)) {
+                return false;
+            }
+        }
+        return !checkForGLError(
+            "RenderManagerOpenGLOffscreen::addDisplayFramebuffers");
+    }
+
+    bool RenderManagerOpenGLOffscreen::makeDisplayFramebuffer(
+        const OffscreenDisplay& d, GLuint& framebuffer) {
+        glGenFramebuffers(1, &framebuffer);
+        glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+        glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0,
+                               GL_TEXTURE_2D, d.colorTexture, 0);
+        bool complete = glCheckFramebufferStatus(GL_FRAMEBUFFER) ==
+                        GL_FRAMEBUFFER_COMPLETE;
+        glBindFramebuffer(GL_FRAMEBUFFER, 0);
+        return complete;
+    }
+
+    bool RenderManagerOpenGLOffscreen::addOpenGLContext(GLContextParams p) {
+        // All of the displays share the one context.
+        if (m_eglContext == EGL_NO_CONTEXT) {
+            // If the application wants us to share its context, it has to
+            // be an EGL one, and we use its display.
+            EGLContext share = EGL_NO_CONTEXT;
+            if ((m_params.m_graphicsLibrary.OpenGL != nullptr) &&
+                m_params.m_graphicsLibrary.OpenGL->shareOpenGLContext) {
+                share = eglGetCurrentContext();
+                if (share == EGL_NO_CONTEXT) {
+                    std::cerr << "RenderManagerOpenGLOffscreen::"
+                                 "addOpenGLContext: Asked to share a "
+                                 "context, but no EGL context is current"
+                              << std::endl;
+                    return false;
+                }
+                m_eglDisplay = eglGetCurrentDisplay();
+            } else {
+                // Prefer Mesa's surfaceless platform, which needs neither a
+                // window system nor a GPU; otherwise take the default.
+                const char* clientExtensions =
+                    eglQueryString(EGL_NO_DISPLAY, EGL_EXTENSIONS);
+                PFNEGLGETPLATFORMDISPLAYEXTPROC getPlatformDisplay =
+                    reinterpret_cast<PFNEGLGETPLATFORMDISPLAYEXTPROC>(
+                        eglGetProcAddress("eglGetPlatformDisplayEXT"));
+                if (hasEGLExtension(clientExtensions,
+                                    "EGL_MESA_platform_surfaceless") &&
+                    (getPlatformDisplay != nullptr)) {
+                    m_eglDisplay = getPlatformDisplay(
+                        EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY,
+                        nullptr);
+                }
+                if (m_eglDisplay == EGL_NO_DISPLAY) {
+                    m_eglDisplay = eglGetDisplay(EGL_DEFAULT_DISPLAY);
+                }
+                EGLint major, minor;
+                if ((m_eglDisplay == EGL_NO_DISPLAY) ||
+                    !eglInitialize(m_eglDisplay, &major, &minor)) {
+                    std::cerr << "RenderManagerOpenGLOffscreen::"
+                                 "addOpenGLContext: Could not initialize "
+                                 "EGL"
+                              << std::endl;
+                    m_eglDisplay = EGL_NO_DISPLAY;
+                    return false;
+                }
+                m_eglOwnDisplay = true;
+            }
+            if (!eglBindAPI(EGL_OPENGL_API)) {
+                std::cerr << "RenderManagerOpenGLOffscreen::addOpenGLContext: "
+                             "EGL does not support desktop OpenGL"
+                          << std::endl;
+                return false;
+            }
+
+            const EGLint configAttributes[] = {
+                EGL_SURFACE_TYPE, EGL_PBUFFER_BIT,
+                EGL_RENDERABLE_TYPE, EGL_OPENGL_BIT,
+                EGL_RED_SIZE, p.bitsPerPixel,
+                EGL_GREEN_SIZE, p.bitsPerPixel,
+                EGL_BLUE_SIZE, p.bitsPerPixel,
+                EGL_ALPHA_SIZE, p.bitsPerPixel,
+                EGL_DEPTH_SIZE, 24,
+                EGL_NONE};
+            EGLint numConfigs = 0;
+            if (!eglChooseConfig(m_eglDisplay, configAttributes, &m_eglConfig,
+                                 1, &numConfigs) ||
+                (numConfigs < 1)) {
+                std::cerr << "RenderManagerOpenGLOffscreen::addOpenGLContext: "
+                             "No matching EGL configuration"
+                          << std::endl;
+                return false;
+            }
+
+            m_eglContextAttributes.clear();
+            if (p.core) {
+                m_eglContextAttributes.insert(
+                    m_eglContextAttributes.end(),
+                    {EGL_CONTEXT_MAJOR_VERSION_KHR, 3,
+                     EGL_CONTEXT_MINOR_VERSION_KHR, 3,
+                     EGL_CONTEXT_OPENGL_PROFILE_MASK_KHR,
+                     EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT_KHR});
+            }
+            if (m_glErrorChecking ==
+                ConstructorParameters::DebugOutputGLErrorChecking) {
+                // Some drivers only send debug output to debug contexts.
+                m_eglContextAttributes.insert(
+                    m_eglContextAttributes.end(),
+                    {EGL_CONTEXT_FLAGS_KHR,
+                     EGL_CONTEXT_OPENGL_DEBUG_BIT_KHR});
+            }
+            m_eglContextAttributes.push_back(EGL_NONE);
+            m_eglContext = eglCreateContext(m_eglDisplay, m_eglConfig, share,
+                                            m_eglContextAttributes.data());
+            if (m_eglContext == EGL_NO_CONTEXT) {
+                std::cerr << "RenderManagerOpenGLOffscreen::addOpenGLContext: "
+                             "Could not get OpenGL context"
+                          << std::endl;
+                return false;
+            }
+
+            if (!hasEGLExtension(eglQueryString(m_eglDisplay, EGL_EXTENSIONS),
+                                 "EGL_KHR_surfaceless_context")) {
+                const EGLint pbufferAttributes[] = {EGL_WIDTH, 1, EGL_HEIGHT,
+                                                    1, EGL_NONE};
+                m_eglSurface = eglCreatePbufferSurface(
+                    m_eglDisplay, m_eglConfig, pbufferAttributes);
+                if (m_eglSurface == EGL_NO_SURFACE) {
+                    std::cerr << "RenderManagerOpenGLOffscreen::"
+                                 "addOpenGLContext: Could not get pbuffer"
+                              << std::endl;
+                    return false;
+                }
+            }
+            if (!eglMakeCurrent(m_eglDisplay, m_eglSurface, m_eglSurface,
+                                m_eglContext)) {
+                std::cerr << "RenderManagerOpenGLOffscreen::addOpenGLContext: "
+                             "Could not make context current"
+                          << std::endl;
+                return false;
+            }
+        }
+
+        // The display's framebuffer is made in addDisplayFramebuffers(),
+        // once GLEW has been initialized.
+        OffscreenDisplay d;
+        d.width = p.width;
+        d.height = p.height;
+        m_offscreenDisplays.push_back(d);
+        m_displays.push_back(DisplayInfo());
+        return true;
+    }
+
+    bool RenderManagerOpenGLOffscreen::removeOpenGLContexts() {
+        if (m_eglDisplay == EGL_NO_DISPLAY) {
+            return true;
+        }
+        if (m_eglContext != EGL_NO_CONTEXT) {
+            eglMakeCurrent(m_eglDisplay, m_eglSurface, m_eglSurface,
+                           m_eglContext);
+            if (m_programId != 0) {
+                glDeleteProgram(m_programId);
+                m_programId = 0;
+            }
+            // The context may share these with the application's, so
+            // destroying it need not delete them.
+            for (OffscreenDisplay& d : m_offscreenDisplays) {
+                if (d.framebuffer != 0) {
+                    glDeleteFramebuffers(1, &d.framebuffer);
+                }
+                if (d.colorTexture != 0) {
+                    glDeleteTextures(1, &d.colorTexture);
+                }
+            }
+        }
+        eglMakeCurrent(m_eglDisplay, EGL_NO_SURFACE, EGL_NO_SURFACE,
+                       EGL_NO_CONTEXT);
+        removeShaderContext();
+        if (m_eglPresentContext != EGL_NO_CONTEXT) {
+            eglDestroyContext(m_eglDisplay, m_eglPresentContext);
+            m_eglPresentContext = EGL_NO_CONTEXT;
+        }
+        if (m_eglPresentSurface != EGL_NO_SURFACE) {
+            eglDestroySurface(m_eglDisplay, m_eglPresentSurface);
+            m_eglPresentSurface = EGL_NO_SURFACE;
+        }
+        if (m_eglContext != EGL_NO_CONTEXT) {
+            eglDestroyContext(m_eglDisplay, m_eglContext);
+            m_eglContext = EGL_NO_CONTEXT;
+        }
+        if (m_eglSurface != EGL_NO_SURFACE) {
+            eglDestroySurface(m_eglDisplay, m_eglSurface);
+            m_eglSurface = EGL_NO_SURFACE;
+        }
+        // Leave the display alone if it belongs to the application.
+        if (m_eglOwnDisplay) {
+            eglTerminate(m_eglDisplay);
+        }
+        m_eglDisplay = EGL_NO_DISPLAY;
+        m_eglOwnDisplay = false;
+        m_offscreenDisplays.clear();
+        m_displays.clear();
+        return true;
+    }
+
+    bool
+    RenderManagerOpenGLOffscreen::makeContextCurrent(size_t display,
+                                                     bool presentContext) {
+        EGLBoolean ok;
+        if (presentContext) {
+            ok = eglMakeCurrent(m_eglDisplay, m_eglPresentSurface,
+                                m_eglPresentSurface, m_eglPresentContext);
+        } else {
+            ok = eglMakeCurrent(m_eglDisplay, m_eglSurface, m_eglSurface,
+                                m_eglContext);
+        }
+        if (!ok) {
+            std::cerr << "RenderManagerOpenGLOffscreen::makeContextCurrent: "
+                         "EGL error 0x"
+                      << std::hex << eglGetError() << std::dec << std::endl;
+            return false;
+        }
+        return true;
+    }
+
+    void RenderManagerOpenGLOffscreen::releaseContext() {
+        eglMakeCurrent(m_eglDisplay, EGL_NO_SURFACE, EGL_NO_SURFACE,
+                       EGL_NO_CONTEXT);
+    }
+
+    bool RenderManagerOpenGLOffscreen::addSharedContext(EGLContext& context,
+                                                        EGLSurface& surface) {
+        // Unlike SDL, EGL does not make the new context current.
+        context = eglCreateContext(m_eglDisplay, m_eglConfig, m_eglContext,
+                                   m_eglContextAttributes.data());
+        if (context == EGL_NO_CONTEXT) {
+            return false;
+        }
+        if (m_eglSurface != EGL_NO_SURFACE) {
+            const EGLint pbufferAttributes[] = {EGL_WIDTH, 1, EGL_HEIGHT, 1,
+                                                EGL_NONE};
+            surface = eglCreatePbufferSurface(m_eglDisplay, m_eglConfig,
+                                              pbufferAttributes);
+            if (surface == EGL_NO_SURFACE) {
+                eglDestroyContext(m_eglDisplay, context);
+                context = EGL_NO_CONTEXT;
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool RenderManagerOpenGLOffscreen::addPresentContext() {
+        return addSharedContext(m_eglPresentContext, m_eglPresentSurface);
+    }
+
+    bool RenderManagerOpenGLOffscreen::addShaderContext() {
+        return addSharedContext(m_eglShaderContext, m_eglShaderSurface);
+    }
+
+    bool RenderManagerOpenGLOffscreen::makeShaderContextCurrent(bool current) {
+        if (!current) {
+            return eglMakeCurrent(m_eglDisplay, EGL_NO_SURFACE,
+                                  EGL_NO_SURFACE, EGL_NO_CONTEXT) == EGL_TRUE;
+        }
+        // The API is bound per thread, and this is not the thread that
+        // bound it when our context was made.
+        return eglBindAPI(EGL_OPENGL_API) &&
+               eglMakeCurrent(m_eglDisplay, m_eglShaderSurface,
+                              m_eglShaderSurface, m_eglShaderContext);
+    }
+
+    void RenderManagerOpenGLOffscreen::removeShaderContext() {
+        if (m_eglShaderContext != EGL_NO_CONTEXT) {
+            eglDestroyContext(m_eglDisplay, m_eglShaderContext);
+            m_eglShaderContext = EGL_NO_CONTEXT;
+        }
+        if (m_eglShaderSurface != EGL_NO_SURFACE) {
+            eglDestroySurface(m_eglDisplay, m_eglShaderSurface);
+            m_eglShaderSurface = EGL_NO_SURFACE;
+        }
+    }
+
+    GLuint RenderManagerOpenGLOffscreen::displayFramebuffer(size_t display) {
+        if (display >= m_offscreenDisplays.size()) {
+            return 0;
+        }
+        if (OnPresentQueueThread()) {
+            return m_offscreenDisplays[display].presentFramebuffer;
+        }
+        return m_offscreenDisplays[display].framebuffer;
+    }
+
+    bool RenderManagerOpenGLOffscreen::swapDisplay(size_t display) {
+        if (display >= m_offscreenDisplays.size()) {
+            return false;
+        }
+
+        // Hand the finished display over while its framebuffer is still
+        // bound, then make sure the work gets to the GPU even though
+        // nothing is swapped.
+        const GraphicsLibraryOpenGL* library =
+            m_params.m_graphicsLibrary.OpenGL;
+        if ((library != nullptr) &&
+            (library->displayFramebufferCallback != nullptr)) {
+            const OffscreenDisplay& d = m_offscreenDisplays[display];
+            GLuint framebuffer = displayFramebuffer(display);
+            glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+            library->displayFramebufferCallback(
+                library->displayFramebufferUserData, display, framebuffer,
+                d.colorTexture, d.width, d.height);
+        }
+        glFlush();
+        return true;
+    }
+
+    bool RenderManagerOpenGLOffscreen::glewInitSucceeded(GLenum result) {
+        // GLEW built for GLX loads the OpenGL entry points and then looks
+        // for a GLX display, which an EGL context does not have.  The
+        // GLX extensions it would go on to load are of no use to us.
+#ifdef GLEW_ERROR_NO_GLX_DISPLAY
+        if (result == GLEW_ERROR_NO_GLX_DISPLAY) {
+            return true;
+        }
+#endif
+        return RenderManagerOpenGL::glewInitSucceeded(result);
+    }
+
+    bool RenderManagerOpenGLOffscreen::QueuedPresentThreadInitialize() {
+        if (!RenderManagerOpenGL::QueuedPresentThreadInitialize()) {
+            return false;
+        }
+
+        // Framebuffers are not shared, so the presenter thread needs its
+        // own on each display's texture.
+        for (OffscreenDisplay& d : m_offscreenDisplays) {
+            if (!makeDisplayFramebuffer(d, d.presentFramebuffer)) {
+                std::cerr << "RenderManagerOpenGLOffscreen::"
+                             "QueuedPresentThreadInitialize: Could not make "
+                             "display framebuffer"
+                          << std::endl;
+                QueuedPresentThreadFinalize();
+                return false;
+            }
+        }
+        return true;
+    }
+
+    void RenderManagerOpenGLOffscreen::QueuedPresentThreadFinalize() {
+        for (OffscreenDisplay& d : m_offscreenDisplays) {
+            if (d.presentFramebuffer != 0) {
+                glDeleteFramebuffers(1, &d.presentFramebuffer);
+                d.presentFramebuffer = 0;
+            }
+        }
+        RenderManagerOpenGL::QueuedPresentThreadFinalize();
+    }
+
+} // namespace renderkit
+} // namespace osvr
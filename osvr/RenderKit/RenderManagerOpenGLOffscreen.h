@@ -0,0 +1,130 @@
+/** @file
+@brief Header file describing an OpenGL RenderManager that presents into
+offscreen framebuffers through EGL, with no windows.
+
+@date 2026
+
+@author
+Sensics, Inc.
+<http://sensics.com/osvr>
+*/
+
+// Copyright 2026 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+// Internal Includes
+#include "RenderManagerOpenGL.h"
+
+// Library/third-party includes
+#include <EGL/egl.h>
+
+// Standard includes
+#include <vector>
+
+namespace osvr {
+namespace renderkit {
+
+    /// @brief An OpenGL RenderManager that needs no window system.
+    ///
+    /// It gets its context from EGL -- surfaceless where the driver
+    /// supports it (as Mesa does, including llvmpipe), on a small
+    /// pbuffer otherwise -- and presents each display into a
+    /// framebuffer with a texture attached, instead of a window.  The
+    /// finished displays are handed to the displayFramebufferCallback in
+    /// the application's GraphicsLibraryOpenGL for capture.  There is no
+    /// vertical sync.  Selected with the "OpenGLOffscreen" render
+    /// library.
+    class RenderManagerOpenGLOffscreen : public RenderManagerOpenGL {
+      public:
+        virtual ~RenderManagerOpenGLOffscreen();
+
+      protected:
+        /// Construct an offscreen OpenGL render manager.
+        RenderManagerOpenGLOffscreen(OSVR_ClientContext context,
+                                     ConstructorParameters p);
+
+        EGLDisplay m_eglDisplay; //< Initialized by the first context
+        bool m_eglOwnDisplay;    //< Did we initialize it (not the app)?
+        EGLConfig m_eglConfig;
+        std::vector<EGLint> m_eglContextAttributes;
+        EGLContext m_eglContext; //< The context we use for all displays
+        EGLContext m_eglPresentContext; //< For the queued-present thread
+        EGLContext m_eglShaderContext;  //< For compiling the shaders
+
+        /// Without EGL_KHR_surfaceless_context, each context needs a
+        /// (tiny, unused) pbuffer surface of its own to be made current
+        /// on.  EGL_NO_SURFACE when surfaceless.
+        EGLSurface m_eglSurface;
+        EGLSurface m_eglPresentSurface;
+        EGLSurface m_eglShaderSurface;
+
+        /// What each display is presented into.  Textures are shared
+        /// between contexts but framebuffers are not, so the presenter
+        /// thread has its own framebuffer on the same texture.
+        struct OffscreenDisplay {
+            int width = 0;
+            int height = 0;
+            GLuint colorTexture = 0;
+            GLuint framebuffer = 0;        //< In m_eglContext
+            GLuint presentFramebuffer = 0; //< In m_eglPresentContext
+        };
+        std::vector<OffscreenDisplay> m_offscreenDisplays;
+
+        /// Make a framebuffer rendering into a display's texture, in the
+        /// current context.
+        static bool makeDisplayFramebuffer(const OffscreenDisplay& d,
+                                           GLuint& framebuffer);
+
+        //===================================================================
+        // Overloaded window-system operations from the OpenGL
+        // RenderManager.
+        bool addOpenGLContext(GLContextParams p) override;
+        bool removeOpenGLContexts() override;
+        bool makeContextCurrent(size_t display, bool presentContext) override;
+        void releaseContext() override;
+        bool setSwapInterval(int interval) override { return true; }
+        bool addPresentContext() override;
+        bool havePresentContext() override {
+            return m_eglPresentContext != EGL_NO_CONTEXT;
+        }
+        bool addShaderContext() override;
+        bool makeShaderContextCurrent(bool current) override;
+        void removeShaderContext() override;
+        bool haveShaderContext() override {
+            return m_eglShaderContext != EGL_NO_CONTEXT;
+        }
+        /// Make a context sharing objects with m_eglContext, and the
+        /// pbuffer it needs if it is not surfaceless.
+        bool addSharedContext(EGLContext& context, EGLSurface& surface);
+
+        bool addDisplayFramebuffers() override;
+        GLuint displayFramebuffer(size_t display) override;
+        bool swapDisplay(size_t display) override;
+        bool glewInitSucceeded(GLenum result) override;
+        bool handleSDLEvents() override { return true; }
+
+        bool QueuedPresentThreadInitialize() override;
+        void QueuedPresentThreadFinalize() override;
+
+        friend RenderManager OSVR_RENDERMANAGER_EXPORT*
+        createRenderManager(OSVR_ClientContext context,
+                            const std::string& renderLibraryName,
+                            GraphicsLibrary graphicsLibrary,
+                            double connectTimeoutSeconds);
+    };
+
+} // namespace renderkit
+} // namespace osvr
@@ -0,0 +1,497 @@
+/** @file
+@brief Implementation of a RenderManager that does distortion correction
+and time warp on the CPU.
+
+@date 2026
+
+@author
+Sensics, Inc.
+<http://sensics.com/osvr>
+*/
+
+// Copyright 2026 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Internal Includes
+#include "RenderManagerSoftware.h"
+
+// Library/third-party includes
+#include <Eigen/Core>
+
+// Standard includes
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+
+namespace osvr {
+namespace renderkit {
+
+    /// Rows of a display in each band that the pool hands to a thread.
+    /// Small enough to balance the load, large enough that each thread
+    /// spends its time drawing rather than culling triangles.
+    static const int BAND_ROWS = 32;
+
+    //=======================================================================
+    // The thread pool.
+
+    RenderManagerSoftware::BandPool::BandPool(unsigned threads)
+        : m_nextBand(0) {
+        for (unsigned i = 1; i < threads; i++) {
+            m_threads.push_back(std::thread(&BandPool::WorkerThread, this));
+        }
+    }
+
+    RenderManagerSoftware::BandPool::~BandPool() {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_quit = true;
+        }
+        m_start.notify_all();
+        for (std::thread& t : m_threads) {
+            t.join();
+        }
+    }
+
+    void RenderManagerSoftware::BandPool::Run(size_t bands,
+                                              BandFunction function,
+                                              void* userData) {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_function = function;
+            m_userData = userData;
+            m_bands = bands;
+            m_nextBand = 0;
+            m_working = m_threads.size();
+            m_generation++;
+        }
+        m_start.notify_all();
+
+        // The calling thread does its share too.
+        RunBands();
+
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_done.wait(lock, [this] { return m_working == 0; });
+    }
+
+    void RenderManagerSoftware::BandPool::WorkerThread() {
+        uint64_t seen = 0;
+        while (true) {
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                m_start.wait(lock, [this, seen] {
+                    return m_quit || (m_generation != seen);
+                });
+                if (m_quit) {
+                    return;
+                }
+                seen = m_generation;
+            }
+            RunBands();
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                if (--m_working == 0) {
+                    m_done.notify_one();
+                }
+            }
+        }
+    }
+
+    void RenderManagerSoftware::BandPool::RunBands() {
+        size_t band;
+        while ((band = m_nextBand++) < m_bands) {
+            m_function(m_userData, band);
+        }
+    }
+
+    //=======================================================================
+    // Compositing.
+
+    /// @brief Read one channel of a texel, or the (black) border if it is
+    /// outside the image.
+    static inline float texel(const RenderBufferSoftware& image, int x, int y,
+                              int channel) {
+        if ((x < 0) || (y < 0) || (x >= static_cast<int>(image.width)) ||
+            (y >= static_cast<int>(image.height))) {
+            return 0;
+        }
+        return image.data[y * image.stride + x * 4 + channel];
+    }
+
+    /// @brief Sample red, green and blue bilinearly, each at its own
+    /// location (in texels, with texel centers at whole numbers), and
+    /// write the pixel.  The clamping, weights and blend are done for the
+    /// channels together in the lanes of Eigen arrays, which it vectorizes;
+    /// the texels are fetched one channel at a time, because each channel
+    /// samples its own location.
+    static inline void sampleBilinear(const RenderBufferSoftware& source,
+                                      const Eigen::Array4f& s,
+                                      const Eigen::Array4f& t,
+                                      uint8_t* out) {
+        // Locations more than a texel outside the image only see the
+        // border, so clamp them to keep the integer conversion in range.
+        Eigen::Array4f sc =
+            s.max(Eigen::Array4f::Constant(-2))
+                .min(Eigen::Array4f::Constant(
+                    static_cast<float>(source.width) + 1));
+        Eigen::Array4f tc =
+            t.max(Eigen::Array4f::Constant(-2))
+                .min(Eigen::Array4f::Constant(
+                    static_cast<float>(source.height) + 1));
+        // Truncating values shifted to be positive rounds down.
+        Eigen::Array4i s0 = (sc + 2.0f).cast<int>() - 2;
+        Eigen::Array4i t0 = (tc + 2.0f).cast<int>() - 2;
+        Eigen::Array4f fs = sc - s0.cast<float>();
+        Eigen::Array4f ft = tc - t0.cast<float>();
+
+        Eigen::Array4f c00, c10, c01, c11;
+        for (int c = 0; c < 3; c++) {
+            c00[c] = texel(source, s0[c], t0[c], c);
+            c10[c] = texel(source, s0[c] + 1, t0[c], c);
+            c01[c] = texel(source, s0[c], t0[c] + 1, c);
+            c11[c] = texel(source, s0[c] + 1, t0[c] + 1, c);
+        }
+        c00[3] = c10[3] = c01[3] = c11[3] = 0;
+
+        Eigen::Array4f color =
+            (c00 * (1.0f - fs) + c10 * fs) * (1.0f - ft) +
+            (c01 * (1.0f - fs) + c11 * fs) * ft;
+        Eigen::Array4i rounded =
+            (color + 0.5f).cast<int>().min(Eigen::Array4i::Constant(255));
+        out[0] = static_cast<uint8_t>(rounded[0]);
+        out[1] = static_cast<uint8_t>(rounded[1]);
+        out[2] = static_cast<uint8_t>(rounded[2]);
+        out[3] = 255;
+    }
+
+    /// @brief Does an edge with a zero edge function own the pixel?  This
+    /// is the top-left rule, for counter-clockwise triangles with Y up, so
+    /// that pixels on edges shared between triangles are drawn once.
+    static inline bool ownsEdge(float dx, float dy) {
+        return (dy < 0) || ((dy == 0) && (dx < 0));
+    }
+
+    void RenderManagerSoftware::compositeBand(void* userData, size_t band) {
+        const EyeComposite& eye = *static_cast<EyeComposite*>(userData);
+        const std::vector<WarpedVertex>& vertices = *eye.vertices;
+        const std::vector<uint16_t>& indices = *eye.indices;
+        int bandLower = eye.lower + static_cast<int>(band) * BAND_ROWS;
+        int bandUpper = std::min(bandLower + BAND_ROWS, eye.upper);
+
+        for (size_t i = 0; i + 2 < indices.size(); i += 3) {
+            const WarpedVertex* v0 = &vertices[indices[i]];
+            const WarpedVertex* v1 = &vertices[indices[i + 1]];
+            const WarpedVertex* v2 = &vertices[indices[i + 2]];
+            float area = (v1->x - v0->x) * (v2->y - v0->y) -
+                         (v1->y - v0->y) * (v2->x - v0->x);
+            if (area == 0) {
+                continue;
+            }
+            if (area < 0) {
+                std::swap(v1, v2);
+                area = -area;
+            }
+
+            // Pixels whose centers could be inside, within this band.
+            float minX = std::min(v0->x, std::min(v1->x, v2->x));
+            float maxX = std::max(v0->x, std::max(v1->x, v2->x));
+            float minY = std::min(v0->y, std::min(v1->y, v2->y));
+            float maxY = std::max(v0->y, std::max(v1->y, v2->y));
+            int xStart =
+                std::max(eye.left, static_cast<int>(std::floor(minX - 0.5f)));
+            int xEnd = std::min(eye.right,
+                                static_cast<int>(std::ceil(maxX - 0.5f)) + 1);
+            int yStart =
+                std::max(bandLower, static_cast<int>(std::floor(minY - 0.5f)));
+            int yEnd = std::min(bandUpper,
+                                static_cast<int>(std::ceil(maxY - 0.5f)) + 1);
+            if ((xStart >= xEnd) || (yStart >= yEnd)) {
+                continue;
+            }
+
+            // Edge functions, each positive inside and weighting the
+            // vertex opposite it, and how they change per pixel.
+            float dx12 = v2->x - v1->x, dy12 = v2->y - v1->y;
+            float dx20 = v0->x - v2->x, dy20 = v0->y - v2->y;
+            float dx01 = v1->x - v0->x, dy01 = v1->y - v0->y;
+            bool own0 = ownsEdge(dx12, dy12);
+            bool own1 = ownsEdge(dx20, dy20);
+            bool own2 = ownsEdge(dx01, dy01);
+            float invArea = 1.0f / area;
+
+            Eigen::Map<const Eigen::Array4f> s0(v0->s), s1(v1->s), s2(v2->s);
+            Eigen::Map<const Eigen::Array4f> t0(v0->t), t1(v1->t), t2(v2->t);
+
+            for (int y = yStart; y < yEnd; y++) {
+                float px = xStart + 0.5f;
+                float py = y + 0.5f;
+                float e0 = dx12 * (py - v1->y) - dy12 * (px - v1->x);
+                float e1 = dx20 * (py - v2->y) - dy20 * (px - v2->x);
+                float e2 = dx01 * (py - v0->y) - dy01 * (px - v0->x);
+                uint8_t* out =
+                    eye.target->data + y * eye.target->stride + xStart * 4;
+                for (int x = xStart; x < xEnd;
+                     x++, e0 -= dy12, e1 -= dy20, e2 -= dy01, out += 4) {
+                    if ((e0 < 0) || (e1 < 0) || (e2 < 0) ||
+                        ((e0 == 0) && !own0) || ((e1 == 0) && !own1) ||
+                        ((e2 == 0) && !own2)) {
+                        continue;
+                    }
+                    float b0 = e0 * invArea;
+                    float b1 = e1 * invArea;
+                    float b2 = e2 * invArea;
+                    sampleBilinear(*eye.source, b0 * s0 + b1 * s1 + b2 * s2,
+                                   b0 * t0 + b1 * t1 + b2 * t2, out);
+                }
+            }
+        }
+    }
+
+    //=======================================================================
+    // The RenderManager.
+
+    RenderManagerSoftware::RenderManagerSoftware(OSVR_ClientContext context,
+                                                 ConstructorParameters p)
+        : RenderManagerNull(context, p) {
+        // Construct the appropriate GraphicsLibrary pointer, taking the
+        // display callback from the application if it gave us one.
+        m_library.Software = new GraphicsLibrarySoftware;
+        if (p.m_graphicsLibrary.Software != nullptr) {
+            *m_library.Software = *p.m_graphicsLibrary.Software;
+        }
+        m_buffers.Software = new RenderBufferSoftware;
+
+        unsigned threads = p.m_softwareCompositorThreads;
+        if (threads == 0) {
+            threads = std::max(std::thread::hardware_concurrency(), 1u);
+        }
+        m_bandPool.reset(new BandPool(threads));
+    }
+
+    RenderManagerSoftware::~RenderManagerSoftware() {
+        // The presenter thread uses our images and threads, so it has to
+        // finish before we get rid of them.
+        StopPresentQueue();
+        m_bandPool.reset();
+        delete m_buffers.Software;
+        delete m_library.Software;
+    }
+
+    RenderManager::OpenResults RenderManagerSoftware::OpenDisplay(void) {
+        OpenResults ret = RenderManagerNull::OpenDisplay();
+        if (ret.status == FAILURE) {
+            return ret;
+        }
+
+        // All public methods that use internal state should be guarded
+        // by a mutex.
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        // Make an image for each display, swapping its aspect ratio if the
+        // display is rotated by 90 or 270 degrees, as a window would be.
+        size_t width = m_displayWidth;
+        size_t height = m_displayHeight;
+        if ((m_params.m_displayRotation ==
+             ConstructorParameters::Display_Rotation::Ninety) ||
+            (m_params.m_displayRotation ==
+             ConstructorParameters::Display_Rotation::TwoSeventy)) {
+            std::swap(width, height);
+        }
+        m_displayImages.resize(GetNumDisplays());
+        for (DisplayImage& d : m_displayImages) {
+            d.pixels.assign(width * height * 4, 0);
+            d.image.data = d.pixels.data();
+            d.image.width = width;
+            d.image.height = height;
+            d.image.stride = width * 4;
+        }
+
+        // Our biggest mesh sets the size of the transformed vertices.
+        size_t vertices = 0;
+        for (const DistortionMesh& mesh : m_distortionMeshes) {
+            vertices = std::max(vertices, mesh.vertices.size());
+        }
+        m_warpedVertices.reserve(vertices);
+
+        ret.library = m_library;
+        return ret;
+    }
+
+    bool RenderManagerSoftware::RenderPathSetup() {
+        // Make a buffer for each eye, the size it will be rendered at.
+        size_t numEyes = GetNumEyes();
+        m_colorBufferPixels.resize(numEyes);
+        m_colorBufferImages.resize(numEyes);
+        m_colorBuffers.assign(numEyes, RenderBuffer());
+        for (size_t i = 0; i < numEyes; i++) {
+            OSVR_ViewportDescription v;
+            ConstructViewportForRender(i, v);
+            size_t width = static_cast<size_t>(v.width);
+            size_t height = static_cast<size_t>(v.height);
+            m_colorBufferPixels[i].assign(width * height * 4, 0);
+            RenderBufferSoftware& image = m_colorBufferImages[i];
+            image.data = m_colorBufferPixels[i].data();
+            image.width = width;
+            image.height = height;
+            image.stride = width * 4;
+            m_colorBuffers[i].Software = &image;
+        }
+
+        // Register the render buffers we're going to use to present
+        return RegisterRenderBuffersInternal(m_colorBuffers);
+    }
+
+    bool RenderManagerSoftware::RenderEyeInitialize(size_t eye) {
+        // Hand the callbacks this eye's buffer.
+        if (eye >= m_colorBufferImages.size()) {
+            return false;
+        }
+        *m_buffers.Software = m_colorBufferImages[eye];
+        return RenderManagerNull::RenderEyeInitialize(eye);
+    }
+
+    bool RenderManagerSoftware::PresentDisplayInitialize(size_t display) {
+        if (!RenderManagerNull::PresentDisplayInitialize(display)) {
+            return false;
+        }
+
+        // Start from opaque black, so that what is outside of the meshes
+        // is the same every frame.
+        std::vector<uint8_t>& pixels = m_displayImages[display].pixels;
+        for (size_t i = 0; i < pixels.size(); i += 4) {
+            pixels[i] = pixels[i + 1] = pixels[i + 2] = 0;
+            pixels[i + 3] = 255;
+        }
+        return true;
+    }
+
+    bool RenderManagerSoftware::PresentEye(PresentEyeParameters params) {
+        if (params.m_buffer.Software == nullptr) {
+            std::cerr
+                << "RenderManagerSoftware::PresentEye(): NULL buffer pointer"
+                << std::endl;
+            return false;
+        }
+
+        // Work out the viewport and the matrices.
+        if (!RenderManagerNull::PresentEye(params)) {
+            return false;
+        }
+        const PresentedEye& presented = m_presentedEyes[params.m_index];
+        const DistortionMesh& mesh = m_distortionMeshes[params.m_index];
+        const RenderBufferSoftware& source = *params.m_buffer.Software;
+        RenderBufferSoftware& target =
+            m_displayImages[GetDisplayUsedByEye(params.m_index)].image;
+
+        // Run the mesh's vertices through what the OpenGL vertex shader
+        // does: the projection scales by the overfill factor and the
+        // ModelView rotates and flips for the display, while the texture
+        // matrix time-warps and crops each channel's coordinates.
+        Eigen::Map<const Eigen::Matrix4f> modelView(presented.modelView.data);
+        Eigen::Map<const Eigen::Matrix4f> texture(presented.texture.data);
+        const OSVR_ViewportDescription& vp = presented.viewport;
+        float scale = m_params.m_renderOverfillFactor;
+        float width = static_cast<float>(source.width);
+        float height = static_cast<float>(source.height);
+        m_warpedVertices.resize(mesh.vertices.size());
+        for (size_t i = 0; i < mesh.vertices.size(); i++) {
+            const DistortionMeshVertex& v = mesh.vertices[i];
+            WarpedVertex& w = m_warpedVertices[i];
+            Eigen::Vector4f pos =
+                modelView * Eigen::Vector4f(v.m_pos[0], v.m_pos[1], 0, 1);
+            float x = scale * pos[0] / pos[3];
+            float y = scale * pos[1] / pos[3];
+            w.x = static_cast<float>(vp.left + (x + 1) * 0.5 * vp.width);
+            w.y = static_cast<float>(vp.lower + (y + 1) * 0.5 * vp.height);
+
+            const Float2* coords[3] = {&v.m_texRed, &v.m_texGreen,
+                                       &v.m_texBlue};
+            for (int c = 0; c < 3; c++) {
+                Eigen::Vector4f warped =
+                    texture *
+                    Eigen::Vector4f((*coords[c])[0], (*coords[c])[1], 0, 1);
+                w.s[c] = warped[0] * width - 0.5f;
+                w.t[c] = warped[1] * height - 0.5f;
+            }
+            w.s[3] = w.t[3] = 0;
+        }
+
+        // Rasterize the eye's part of the display in bands.
+        EyeComposite eye;
+        eye.vertices = &m_warpedVertices;
+        eye.source = &source;
+        eye.target = &target;
+        eye.indices = &mesh.indices;
+        eye.left = std::max(0, static_cast<int>(std::floor(vp.left)));
+        eye.lower = std::max(0, static_cast<int>(std::floor(vp.lower)));
+        eye.right = std::min(static_cast<int>(target.width),
+                             static_cast<int>(std::ceil(vp.left + vp.width)));
+        eye.upper =
+            std::min(static_cast<int>(target.height),
+                     static_cast<int>(std::ceil(vp.lower + vp.height)));
+        if ((eye.left >= eye.right) || (eye.lower >= eye.upper)) {
+            return true;
+        }
+        size_t bands = (eye.upper - eye.lower + BAND_ROWS - 1) / BAND_ROWS;
+        m_bandPool->Run(bands, &RenderManagerSoftware::compositeBand, &eye);
+        return true;
+    }
+
+    bool RenderManagerSoftware::SolidColorEye(size_t eye,
+                                              const RGBColorf& color) {
+        if (!RenderManagerNull::SolidColorEye(eye, color)) {
+            return false;
+        }
+        const OSVR_ViewportDescription& vp = m_presentedEyes[eye].viewport;
+        RenderBufferSoftware& target =
+            m_displayImages[GetDisplayUsedByEye(eye)].image;
+        int left = std::max(0, static_cast<int>(vp.left));
+        int lower = std::max(0, static_cast<int>(vp.lower));
+        int right = std::min(static_cast<int>(target.width),
+                             static_cast<int>(vp.left + vp.width));
+        int upper = std::min(static_cast<int>(target.height),
+                             static_cast<int>(vp.lower + vp.height));
+        uint8_t pixel[4] = {
+            static_cast<uint8_t>(std::min(std::max(color.r, 0.0f), 1.0f) *
+                                     255 + 0.5f),
+            static_cast<uint8_t>(std::min(std::max(color.g, 0.0f), 1.0f) *
+                                     255 + 0.5f),
+            static_cast<uint8_t>(std::min(std::max(color.b, 0.0f), 1.0f) *
+                                     255 + 0.5f),
+            255};
+        for (int y = lower; y < upper; y++) {
+            uint8_t* out = target.data + y * target.stride + left * 4;
+            for (int x = left; x < right; x++, out += 4) {
+                std::copy(pixel, pixel + 4, out);
+            }
+        }
+        return true;
+    }
+
+    bool RenderManagerSoftware::PresentDisplayFinalize(size_t display) {
+        if (display >= m_displayImages.size()) {
+            return false;
+        }
+
+        // Hand the finished image over, then wait for the simulated
+        // vertical sync.
+        if (m_library.Software->displayImageCallback != nullptr) {
+            m_library.Software->displayImageCallback(
+                m_library.Software->displayImageUserData, display,
+                m_displayImages[display].image);
+        }
+        return RenderManagerNull::PresentDisplayFinalize(display);
+    }
+
+} // namespace renderkit
+} // namespace osvr
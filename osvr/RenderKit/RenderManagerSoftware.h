@@ -0,0 +1,157 @@
+/** @file
+@brief Header file describing a RenderManager that does distortion
+correction and time warp on the CPU.
+
+@date 2026
+
+@author
+Sensics, Inc.
+<http://sensics.com/osvr>
+*/
+
+// Copyright 2026 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+// Internal Includes
+#include "RenderManagerNull.h"
+#include "GraphicsLibrarySoftware.h"
+
+// Library/third-party includes
+// - none
+
+// Standard includes
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace osvr {
+namespace renderkit {
+
+    /// @brief A RenderManager that composites on the CPU.
+    ///
+    /// It does what the OpenGL RenderManager's present shaders do --
+    /// draws each eye's distortion mesh with per-channel texture
+    /// coordinates, transformed by the display-orientation and
+    /// time-warp matrices, sampling the eye's buffer bilinearly with a
+    /// black border -- into RGBA images in memory, one per display.  The
+    /// finished images are handed to the GraphicsLibrarySoftware display
+    /// callback.  Each display is split into bands of rows that a pool of
+    /// threads composites in parallel.  Display timing is simulated as in
+    /// RenderManagerNull.  Selected with the "Software" render library.
+    ///  It is a reference for what the GPU back ends should produce and a
+    /// fallback where there is no GPU, such as remote or streamed
+    /// displays.
+    class RenderManagerSoftware : public RenderManagerNull {
+      public:
+        virtual ~RenderManagerSoftware();
+
+        // Opens the simulated display and makes its images.
+        OpenResults OpenDisplay() override;
+
+      protected:
+        /// Construct a Software render manager.
+        RenderManagerSoftware(OSVR_ClientContext context,
+                              ConstructorParameters p);
+
+        /// @brief Runs the bands of a display on a set of threads.
+        class BandPool {
+          public:
+            typedef void (*BandFunction)(void* userData, size_t band);
+
+            /// @param threads Threads to run on, counting the caller.
+            explicit BandPool(unsigned threads);
+            ~BandPool();
+
+            /// Call function for each band in [0, bands), spread across the
+            /// threads, returning when they are all done.  Not reentrant.
+            void Run(size_t bands, BandFunction function, void* userData);
+
+          private:
+            BandPool(const BandPool&) = delete;
+            BandPool& operator=(const BandPool&) = delete;
+
+            void WorkerThread();
+            void RunBands();
+
+            std::mutex m_mutex; //< Guards the members below
+            std::condition_variable m_start;
+            std::condition_variable m_done;
+            uint64_t m_generation = 0; //< Bumped for each Run()
+            size_t m_working = 0;      //< Workers still in this Run()
+            bool m_quit = false;
+            BandFunction m_function = nullptr;
+            void* m_userData = nullptr;
+            size_t m_bands = 0;
+            std::atomic<size_t> m_nextBand;
+            std::vector<std::thread> m_threads;
+        };
+        std::unique_ptr<BandPool> m_bandPool;
+
+        /// Image and storage for each display.
+        struct DisplayImage {
+            std::vector<uint8_t> pixels;
+            RenderBufferSoftware image;
+        };
+        std::vector<DisplayImage> m_displayImages;
+
+        /// Storage for the buffers used in Render() mode.
+        std::vector<std::vector<uint8_t> > m_colorBufferPixels;
+        std::vector<RenderBufferSoftware> m_colorBufferImages;
+
+        /// A distortion-mesh vertex after the present transforms: its
+        /// window position and the texel it samples in each of red, green
+        /// and blue (the fourth entries are unused).
+        struct WarpedVertex {
+            float x, y;
+            float s[4]; //< Texel column, from the left
+            float t[4]; //< Texel row, from the bottom
+        };
+        std::vector<WarpedVertex> m_warpedVertices;
+
+        /// What the bands of the eye being presented share.
+        struct EyeComposite {
+            const std::vector<WarpedVertex>* vertices;
+            const RenderBufferSoftware* source;
+            RenderBufferSoftware* target;
+            const std::vector<uint16_t>* indices;
+            int left, lower, right, upper; //< Viewport, clipped to target
+        };
+
+        /// Composite one band of rows of the eye in an EyeComposite.
+        static void compositeBand(void* userData, size_t band);
+
+        //===================================================================
+        // Overloaded render functions from the base class.
+        bool RenderPathSetup() override;
+        bool RenderEyeInitialize(size_t eye) override;
+
+        bool PresentDisplayInitialize(size_t display) override;
+        bool PresentEye(PresentEyeParameters params) override;
+        bool SolidColorEye(size_t eye, const RGBColorf& color) override;
+        bool PresentDisplayFinalize(size_t display) override;
+
+        friend RenderManager OSVR_RENDERMANAGER_EXPORT*
+        createRenderManager(OSVR_ClientContext context,
+                            const std::string& renderLibraryName,
+                            GraphicsLibrary graphicsLibrary,
+                            double connectTimeoutSeconds);
+    };
+
+} // namespace renderkit
+} // namespace osvr
@@ -0,0 +1,187 @@
+/** @file
+@brief Source file implementing how RenderManager runs the stages of
+opening a display, overlapping those that do not need the graphics context.
+
+@date 2026
+
+@author
+Sensics, Inc.
+<http://sensics.com/osvr>
+*/
+
+// Copyright 2026 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Internal Includes
+#include "RenderManagerStartupScheduler.h"
+#include "RenderManagerTrace.h"
+
+// Library/third-party includes
+#include <osvr/Util/TimeValueC.h>
+
+// Standard includes
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <sstream>
+#include <thread>
+
+namespace osvr {
+namespace renderkit {
+
+    StartupScheduler::Stage
+    StartupScheduler::add(const char* name, bool onCaller,
+                          std::initializer_list<Stage> after,
+                          std::function<bool()> work) {
+        StageInfo info;
+        for (Stage s : after) {
+            if (s < m_stages.size()) {
+                info.after.push_back(s);
+            }
+        }
+        info.work = work;
+        m_stages.push_back(info);
+
+        StartupStageTiming timing = {};
+        timing.name = name;
+        timing.worker = !onCaller;
+        m_timing.push_back(timing);
+        return m_stages.size() - 1;
+    }
+
+    bool StartupScheduler::run(TraceWriter* trace) {
+        typedef std::chrono::steady_clock Clock;
+        Clock::time_point start = Clock::now();
+
+        std::mutex mutex; //< Guards the stage state below
+        std::condition_variable changed;
+        std::vector<std::thread> threads;
+        bool failed = false;
+
+        // Runs a stage, recording how long it took.  Called without the
+        // mutex held.
+        auto runStage = [&](Stage s) {
+            OSVR_TimeValue traceStart;
+            osvrTimeValueGetNow(&traceStart);
+            Clock::time_point stageStart = Clock::now();
+            bool ok = m_stages[s].work();
+            Clock::time_point stageEnd = Clock::now();
+            if (trace) {
+                OSVR_TimeValue traceEnd;
+                osvrTimeValueGetNow(&traceEnd);
+                trace->AddEvent(m_timing[s].name, traceStart, traceEnd);
+            }
+
+            std::lock_guard<std::mutex> lock(mutex);
+            StartupStageTiming& t = m_timing[s];
+            t.ran = true;
+            t.succeeded = ok;
+            t.startSeconds =
+                std::chrono::duration<double>(stageStart - start).count();
+            t.seconds =
+                std::chrono::duration<double>(stageEnd - stageStart).count();
+            m_stages[s].finished = true;
+            if (!ok) {
+                failed = true;
+            }
+            changed.notify_all();
+        };
+
+        // Is a stage waiting only on stages that have succeeded?
+        auto ready = [&](Stage s) {
+            if (m_stages[s].started) {
+                return false;
+            }
+            for (Stage a : m_stages[s].after) {
+                if (!m_stages[a].finished || !m_timing[a].succeeded) {
+                    return false;
+                }
+            }
+            return true;
+        };
+
+        std::unique_lock<std::mutex> lock(mutex);
+        while (true) {
+            // Start everything that can run elsewhere, and find the first
+            // stage that can run here.
+            size_t running = 0;
+            bool haveCallerStage = false;
+            Stage callerStage = 0;
+            for (Stage s = 0; s < m_stages.size(); s++) {
+                if (m_stages[s].started && !m_stages[s].finished) {
+                    running++;
+                }
+                if (failed || !ready(s)) {
+                    continue;
+                }
+                if (m_timing[s].worker) {
+                    m_stages[s].started = true;
+                    running++;
+                    threads.push_back(std::thread(runStage, s));
+                } else if (!haveCallerStage) {
+                    haveCallerStage = true;
+                    callerStage = s;
+                }
+            }
+
+            if (haveCallerStage) {
+                m_stages[callerStage].started = true;
+                lock.unlock();
+                runStage(callerStage);
+                lock.lock();
+            } else if (running > 0) {
+                changed.wait(lock);
+            } else {
+                // Everything has run, or is waiting on a stage that
+                // failed.
+                break;
+            }
+        }
+        lock.unlock();
+
+        for (auto& t : threads) {
+            t.join();
+        }
+        m_seconds =
+            std::chrono::duration<double>(Clock::now() - start).count();
+        return !failed;
+    }
+
+    std::string StartupScheduler::summary() const {
+        std::ostringstream s;
+        s << static_cast<int>(m_seconds * 1e3 + 0.5) << " ms (";
+        bool first = true;
+        for (auto const& t : m_timing) {
+            if (!t.ran) {
+                continue;
+            }
+            if (!first) {
+                s << ", ";
+            }
+            first = false;
+            s << t.name << " " << static_cast<int>(t.seconds * 1e3 + 0.5)
+              << " ms";
+            if (t.worker) {
+                s << " in parallel";
+            }
+            if (!t.succeeded) {
+                s << " FAILED";
+            }
+        }
+        s << ")";
+        return s.str();
+    }
+
+} // namespace renderkit
+} // namespace osvr
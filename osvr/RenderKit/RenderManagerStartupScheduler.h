@@ -0,0 +1,98 @@
+/** @file
+@brief Header file describing how RenderManager runs the stages of opening
+a display, overlapping those that do not need the thread opening it.
+
+@date 2026
+
+@author
+Sensics, Inc.
+<http://sensics.com/osvr>
+*/
+
+// Copyright 2026 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+// Internal Includes
+#include "RenderManager.h"
+
+// Library/third-party includes
+// - none
+
+// Standard includes
+#include <functional>
+#include <initializer_list>
+#include <string>
+#include <vector>
+
+namespace osvr {
+namespace renderkit {
+
+    class TraceWriter;
+
+    /// @brief Runs a set of stages in an order given by their
+    /// dependencies.
+    ///
+    /// Stages that use the window system or the context current on the
+    /// thread that is opening the display must run on that thread; the
+    /// others (such as computing distortion meshes, or compiling shaders
+    /// in a context of their own) are each run on a thread of their own
+    /// as soon as the stages they depend on are done, so that they overlap
+    /// with the first kind.  If a stage fails, no more stages are started,
+    /// those already running are waited for, and run() returns false.
+    /// The time each stage took is recorded.
+    class StartupScheduler {
+      public:
+        typedef size_t Stage;
+
+        /// @brief Add a stage.
+        ///  @param name Must outlive the scheduler; normally a literal.
+        ///  @param onCaller Must the stage run on the thread calling run()?
+        ///  @param after Stages that must succeed before this one starts.
+        /// These must already have been added, so there can be no cycles.
+        ///  @param work Does the stage; returns false on failure.
+        ///  @return The stage, for use in the after list of later stages.
+        Stage add(const char* name, bool onCaller,
+                  std::initializer_list<Stage> after,
+                  std::function<bool()> work);
+
+        /// @brief Run all of the stages, returning when they are done.
+        ///  @param trace Writer to record each stage to, or nullptr.
+        ///  @return True if all of them succeeded.
+        bool run(TraceWriter* trace);
+
+        /// @brief Timing of each stage, in the order they were added.
+        /// Stages that did not run have succeeded and ran set false.
+        const std::vector<StartupStageTiming>& timing() const {
+            return m_timing;
+        }
+
+        /// @brief Describe the timing on one line, for printing.
+        std::string summary() const;
+
+      private:
+        struct StageInfo {
+            std::vector<Stage> after;
+            std::function<bool()> work;
+            bool started = false;
+            bool finished = false;
+        };
+        std::vector<StageInfo> m_stages;
+        std::vector<StartupStageTiming> m_timing;
+        double m_seconds = 0; //< Total time spent in run()
+    };
+
+} // namespace renderkit
+} // namespace osvr
@@ -0,0 +1,241 @@
+/** @file
+@brief Implementation of how RenderManager sets the scheduling of the
+thread that presents frames.
+
+@date 2026
+
+@author
+Sensics, Inc.
+<http://sensics.com/osvr>
+*/
+
+// Copyright 2026 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Internal Includes
+#include "RenderManagerThreadScheduling.h"
+
+// Library/third-party includes
+#ifdef __linux__
+#include <alloca.h>
+#include <pthread.h>
+#include <sched.h>
+#include <sys/mman.h>
+#include <sys/resource.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+// Standard includes
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <iostream>
+
+namespace osvr {
+namespace renderkit {
+
+    bool PresentThreadSchedulingRequested(
+        const RenderManager::ConstructorParameters& p) {
+        return (p.m_presentThreadScheduling !=
+                RenderManager::ConstructorParameters::DefaultScheduling) ||
+               (p.m_presentThreadNice != 0) ||
+               !p.m_presentThreadCPUs.empty() || p.m_presentThreadLockMemory;
+    }
+
+#ifdef __linux__
+
+    /// Largest amount of the thread's stack that we'll try to lock.  Main
+    /// threads report the whole stack rlimit as their size, which is much
+    /// more than a present loop uses and often more than RLIMIT_MEMLOCK
+    /// allows.
+    static const size_t MAX_LOCKED_STACK_BYTES = 512 * 1024;
+
+    /// Write to each page of the calling thread's stack from here down to
+    /// the given address, which makes the kernel map them.  The stack
+    /// must be allowed to grow that far.
+    static void __attribute__((noinline)) touchStackDownTo(char* bottom) {
+        char here;
+        if (bottom >= &here) {
+            return;
+        }
+        size_t size = static_cast<size_t>(&here - bottom);
+        volatile char* buffer = static_cast<volatile char*>(alloca(size));
+        size_t page = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+        for (size_t i = 0; i < size; i += page) {
+            buffer[i] = 0;
+        }
+    }
+
+    /// Set the nice value of the calling thread (not the whole process).
+    static bool setThreadNice(int nice, PresentThreadSchedulingInfo& info) {
+        pid_t tid = static_cast<pid_t>(syscall(SYS_gettid));
+        if (setpriority(PRIO_PROCESS, static_cast<id_t>(tid), nice) != 0) {
+            std::cerr << "ApplyPresentThreadScheduling(): Could not set nice "
+                         "value "
+                      << nice << ": " << std::strerror(errno) << std::endl;
+            return false;
+        }
+        info.niceApplied = true;
+        info.nice = nice;
+        info.applied = true;
+        return true;
+    }
+
+    bool ApplyPresentThreadScheduling(
+        const RenderManager::ConstructorParameters& p,
+        PresentThreadSchedulingInfo& info) {
+        info = PresentThreadSchedulingInfo();
+        bool ret = true;
+        pthread_t self = pthread_self();
+
+        //==========================================================
+        // Scheduling policy, falling back on a nice value if we're not
+        // allowed to use a real-time policy.
+        if (p.m_presentThreadScheduling !=
+            RenderManager::ConstructorParameters::DefaultScheduling) {
+            int policy = SCHED_FIFO;
+            if (p.m_presentThreadScheduling ==
+                RenderManager::ConstructorParameters::RoundRobinScheduling) {
+                policy = SCHED_RR;
+            }
+            sched_param param;
+            param.sched_priority = std::max(
+                sched_get_priority_min(policy),
+                std::min(p.m_presentThreadPriority,
+                         sched_get_priority_max(policy)));
+            int err = pthread_setschedparam(self, policy, &param);
+            if (err == 0) {
+                info.realTime = true;
+                info.priority = param.sched_priority;
+                info.applied = true;
+            } else {
+                std::cerr << "ApplyPresentThreadScheduling(): Could not set "
+                          << (policy == SCHED_FIFO ? "SCHED_FIFO" : "SCHED_RR")
+                          << " priority " << param.sched_priority << ": "
+                          << std::strerror(err) << std::endl;
+                ret = false;
+                if (p.m_presentThreadNice != 0) {
+                    std::cerr << "ApplyPresentThreadScheduling(): Falling "
+                                 "back on nice value "
+                              << p.m_presentThreadNice << std::endl;
+                    setThreadNice(p.m_presentThreadNice, info);
+                }
+            }
+        } else if (p.m_presentThreadNice != 0) {
+            if (!setThreadNice(p.m_presentThreadNice, info)) {
+                ret = false;
+            }
+        }
+
+        //==========================================================
+        // CPU affinity.
+        if (!p.m_presentThreadCPUs.empty()) {
+            cpu_set_t cpus;
+            CPU_ZERO(&cpus);
+            size_t count = 0;
+            for (int cpu : p.m_presentThreadCPUs) {
+                if ((cpu < 0) || (cpu >= CPU_SETSIZE)) {
+                    std::cerr << "ApplyPresentThreadScheduling(): Ignoring "
+                                 "invalid CPU "
+                              << cpu << std::endl;
+                    ret = false;
+                    continue;
+                }
+                if (!CPU_ISSET(cpu, &cpus)) {
+                    CPU_SET(cpu, &cpus);
+                    count++;
+                }
+            }
+            if (count > 0) {
+                int err = pthread_setaffinity_np(self, sizeof(cpus), &cpus);
+                if (err == 0) {
+                    info.pinnedCPUs = count;
+                    info.applied = true;
+                } else {
+                    std::cerr << "ApplyPresentThreadScheduling(): Could not "
+                                 "set CPU affinity: "
+                              << std::strerror(err) << std::endl;
+                    ret = false;
+                }
+            }
+        }
+
+        //==========================================================
+        // Lock the part of the stack nearest its base (where the present
+        // path runs) so that it cannot be paged out.
+        if (p.m_presentThreadLockMemory) {
+            pthread_attr_t attr;
+            void* stackAddr = nullptr;
+            size_t stackSize = 0;
+            bool haveStack = false;
+            if (pthread_getattr_np(self, &attr) == 0) {
+                haveStack =
+                    (pthread_attr_getstack(&attr, &stackAddr, &stackSize) == 0);
+                pthread_attr_destroy(&attr);
+            }
+            if (!haveStack) {
+                std::cerr << "ApplyPresentThreadScheduling(): Could not find "
+                             "the thread's stack to lock"
+                          << std::endl;
+                ret = false;
+            } else {
+                // Stacks grow down, so lock the top of the range.
+                size_t lockSize = std::min(stackSize, MAX_LOCKED_STACK_BYTES);
+                char* lockStart =
+                    static_cast<char*>(stackAddr) + (stackSize - lockSize);
+                int err = (mlock(lockStart, lockSize) == 0) ? 0 : errno;
+                if (err == ENOMEM) {
+                    // The main thread's stack is only mapped as far down
+                    // as it has grown, so grow it over the range and try
+                    // again.
+                    touchStackDownTo(lockStart);
+                    err = (mlock(lockStart, lockSize) == 0) ? 0 : errno;
+                }
+                if (err == 0) {
+                    info.lockedBytes = lockSize;
+                    info.applied = true;
+                } else {
+                    std::cerr << "ApplyPresentThreadScheduling(): Could not "
+                                 "lock "
+                              << lockSize
+                              << " bytes of stack: " << std::strerror(err)
+                              << " (check RLIMIT_MEMLOCK)" << std::endl;
+                    ret = false;
+                }
+            }
+        }
+
+        return ret;
+    }
+
+#else
+
+    bool ApplyPresentThreadScheduling(
+        const RenderManager::ConstructorParameters& p,
+        PresentThreadSchedulingInfo& info) {
+        info = PresentThreadSchedulingInfo();
+        if (PresentThreadSchedulingRequested(p)) {
+            std::cerr << "ApplyPresentThreadScheduling(): Present-thread "
+                         "scheduling is not supported on this platform"
+                      << std::endl;
+            return false;
+        }
+        return true;
+    }
+
+#endif
+
+} // namespace renderkit
+} // namespace osvr
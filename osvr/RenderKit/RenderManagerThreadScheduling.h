@@ -0,0 +1,56 @@
+/** @file
+@brief Header file describing how RenderManager sets the scheduling of
+the thread that presents frames.
+
+@date 2026
+
+@author
+Sensics, Inc.
+<http://sensics.com/osvr>
+*/
+
+// Copyright 2026 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+// Internal Includes
+#include "RenderManager.h"
+
+namespace osvr {
+namespace renderkit {
+
+    /// @brief Does the configuration ask for any change to the scheduling
+    /// of the present thread?
+    bool PresentThreadSchedulingRequested(
+        const RenderManager::ConstructorParameters& p);
+
+    /// @brief Apply the present-thread scheduling settings from the
+    /// parameters to the calling thread.
+    ///
+    /// Tries for a real-time scheduling policy and falls back on the
+    /// configured nice value when the process is not permitted to use
+    /// one.  Then pins the thread to the requested CPUs and locks its
+    /// stack into memory.  Each step is attempted even if an earlier one
+    /// fails.  Only implemented on Linux; other platforms report that
+    /// nothing was applied.
+    /// @return True if everything that was requested was applied, false
+    /// if any part of it could not be.  The info structure describes
+    /// what was actually applied in either case.
+    bool ApplyPresentThreadScheduling(
+        const RenderManager::ConstructorParameters& p,
+        PresentThreadSchedulingInfo& info);
+
+} // namespace renderkit
+} // namespace osvr
@@ -0,0 +1,159 @@
+/** @file
+@brief Implementation of how RenderManager writes a timeline of its work
+to a Chrome trace-event file.
+
+@date 2026
+
+@author
+Sensics, Inc.
+<http://sensics.com/osvr>
+*/
+
+// Copyright 2026 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Internal Includes
+#include "RenderManagerTrace.h"
+
+// Library/third-party includes
+// - none
+
+// Standard includes
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <map>
+
+namespace osvr {
+namespace renderkit {
+
+    /// Number of events we can hold between writes.  At the rates that
+    /// RenderManager produces them this is several seconds' worth.
+    static const size_t EVENT_CAPACITY = 65536;
+
+    /// How often the writer thread wakes up to write events.
+    static const std::chrono::milliseconds WRITE_INTERVAL(100);
+
+    /// Writers that are open, by file name, so that RenderManagers that
+    /// wrap each other share one rather than clobbering the file.
+    static std::mutex s_writersMutex;
+    static std::map<std::string, std::weak_ptr<TraceWriter> > s_writers;
+
+    /// Small numbers for threads, which read better in the viewers than
+    /// platform thread IDs.
+    static std::atomic<unsigned> s_nextThread(1);
+    static thread_local unsigned t_thread = 0;
+
+    std::shared_ptr<TraceWriter>
+    TraceWriter::Open(const std::string& fileName) {
+        std::lock_guard<std::mutex> lock(s_writersMutex);
+        std::shared_ptr<TraceWriter> ret = s_writers[fileName].lock();
+        if (ret) {
+            return ret;
+        }
+
+        ret.reset(new TraceWriter());
+        ret->m_fileName = fileName;
+        ret->m_file.open(fileName.c_str(), std::ios::out | std::ios::trunc);
+        if (!ret->m_file) {
+            std::cerr << "TraceWriter::Open(): Could not open trace file "
+                      << fileName << std::endl;
+            return nullptr;
+        }
+        ret->m_file << "[\n";
+        ret->m_pending.reserve(EVENT_CAPACITY);
+        ret->m_thread = std::thread(&TraceWriter::WriteThread, ret.get());
+        s_writers[fileName] = ret;
+        return ret;
+    }
+
+    TraceWriter::~TraceWriter() {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_quit = true;
+        }
+        m_changed.notify_all();
+        if (m_thread.joinable()) {
+            m_thread.join();
+        }
+        if (m_file.is_open()) {
+            m_file << "\n]\n";
+            m_file.close();
+        }
+        if (m_dropped > 0) {
+            std::cerr << "TraceWriter: Dropped " << m_dropped
+                      << " events from " << m_fileName
+                      << " because they arrived faster than they could be "
+                         "written"
+                      << std::endl;
+        }
+    }
+
+    void TraceWriter::AddEvent(const char* name, const OSVR_TimeValue& start,
+                               const OSVR_TimeValue& end) {
+        if (t_thread == 0) {
+            t_thread = s_nextThread++;
+        }
+        TraceEvent event = {name, start, end, t_thread};
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_pending.size() >= EVENT_CAPACITY) {
+            m_dropped++;
+            return;
+        }
+        m_pending.push_back(event);
+    }
+
+    void TraceWriter::WriteThread() {
+        // We swap buffers with the producers, so both keep their storage.
+        std::vector<TraceEvent> writing;
+        writing.reserve(EVENT_CAPACITY);
+        bool quit = false;
+        while (!quit) {
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                m_changed.wait_for(lock, WRITE_INTERVAL,
+                                   [this] { return m_quit; });
+                quit = m_quit;
+                writing.swap(m_pending);
+            }
+            WriteEvents(writing);
+            writing.clear();
+        }
+    }
+
+    void TraceWriter::WriteEvents(const std::vector<TraceEvent>& events) {
+        for (const TraceEvent& e : events) {
+            long long start =
+                static_cast<long long>(e.start.seconds) * 1000000LL +
+                e.start.microseconds;
+            long long end = static_cast<long long>(e.end.seconds) * 1000000LL +
+                            e.end.microseconds;
+            if (!m_firstEvent) {
+                m_file << ",\n";
+            }
+            m_firstEvent = false;
+            m_file << "{\"name\":\"" << e.name
+                   << "\",\"cat\":\"RenderManager\",\"ph\":\"X\",\"pid\":1,"
+                      "\"tid\":"
+                   << e.thread << ",\"ts\":" << start
+                   << ",\"dur\":" << (end - start) << "}";
+        }
+        if (!events.empty()) {
+            m_file.flush();
+        }
+    }
+
+} // namespace renderkit
+} // namespace osvr
@@ -0,0 +1,133 @@
+/** @file
+@brief Header file describing how RenderManager writes a timeline of
+its work to a Chrome trace-event file.
+
+@date 2026
+
+@author
+Sensics, Inc.
+<http://sensics.com/osvr>
+*/
+
+// Copyright 2026 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+// Internal Includes
+// - none
+
+// Library/third-party includes
+#include <osvr/Util/TimeValueC.h>
+
+// Standard includes
+#include <condition_variable>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace osvr {
+namespace renderkit {
+
+    /// @brief Writes timed scopes to a file in the Chrome trace-event
+    /// JSON format, which can be loaded into chrome://tracing or the
+    /// Perfetto UI.
+    ///
+    /// Events are appended to a pre-allocated buffer under a mutex that
+    /// is only held long enough to copy them in; a background thread
+    /// formats and writes them a few times a second.  If the buffer fills
+    /// before the thread gets to it, further events are dropped and
+    /// counted rather than allocating.  The file is written as a JSON
+    /// array, which the viewers accept even if it was not closed because
+    /// the application crashed.
+    class TraceWriter {
+      public:
+        /// @brief Get the writer for a file, opening the file if no other
+        /// RenderManager in this process is already writing to it.
+        ///  @return The writer, or nullptr if the file cannot be opened.
+        static std::shared_ptr<TraceWriter> Open(const std::string& fileName);
+
+        ~TraceWriter();
+
+        /// @brief Record an event that ran from start to end on the calling
+        /// thread.
+        ///  @param name Must outlive the writer; normally a literal.
+        void AddEvent(const char* name, const OSVR_TimeValue& start,
+                      const OSVR_TimeValue& end);
+
+      private:
+        TraceWriter() = default;
+        TraceWriter(const TraceWriter&) = delete;
+        TraceWriter& operator=(const TraceWriter&) = delete;
+
+        /// @brief One complete ("X") event.
+        struct TraceEvent {
+            const char* name;
+            OSVR_TimeValue start;
+            OSVR_TimeValue end;
+            unsigned thread; //< Small per-thread number used as the tid
+        };
+
+        /// @brief Body of the thread that writes the events.
+        void WriteThread();
+
+        /// @brief Format events into the file.
+        void WriteEvents(const std::vector<TraceEvent>& events);
+
+        std::string m_fileName;
+        std::ofstream m_file;
+        bool m_firstEvent = true;
+
+        std::mutex m_mutex; //< Guards the members below
+        std::condition_variable m_changed;
+        std::vector<TraceEvent> m_pending; //< Waiting to be written
+        size_t m_dropped = 0; //< Events dropped because m_pending was full
+        bool m_quit = false;
+        std::thread m_thread;
+    };
+
+    /// @brief Records the time from its construction to its destruction as
+    /// a trace event.  Does nothing if the writer is NULL, which is the
+    /// case when tracing is not enabled.
+    class TraceScope {
+      public:
+        TraceScope(TraceWriter* writer, const char* name)
+            : m_writer(writer), m_name(name) {
+            if (m_writer) {
+                osvrTimeValueGetNow(&m_start);
+            }
+        }
+
+        ~TraceScope() {
+            if (m_writer) {
+                OSVR_TimeValue end;
+                osvrTimeValueGetNow(&end);
+                m_writer->AddEvent(m_name, m_start, end);
+            }
+        }
+
+      private:
+        TraceScope(const TraceScope&) = delete;
+        TraceScope& operator=(const TraceScope&) = delete;
+
+        TraceWriter* m_writer;
+        const char* m_name;
+        OSVR_TimeValue m_start;
+    };
+
+} // namespace renderkit
+} // namespace osvr
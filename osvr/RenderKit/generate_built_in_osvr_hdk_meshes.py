@@ -0,0 +1,155 @@
+#!/usr/bin/env python
+# Copyright 2026 Sensics, Inc.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+"""Generate osvr_display_config_built_in_osvr_hdk_meshes.h.
+
+Decodes the hex-encoded JSON configurations in
+osvr_display_config_built_in_osvr_hdks.h and writes their
+mono_point_samples out as float arrays, one per coordinate of each eye, so
+that the library can use the built-in distortion meshes in place, without
+parsing any JSON or copying the points.  The build runs it:
+
+    python generate_built_in_osvr_hdk_meshes.py <JSON header> <output>
+
+Builds without a Python interpreter use the copy in pregenerated/, so
+regenerate that too when the configurations or this script change.
+"""
+
+import json
+import re
+import sys
+
+# The value of mono_point_samples_built_in for each configuration.
+NAMES = [
+    ("osvr_display_config_built_in_osvr_hdk13_v1", "OSVR_HDK_13_V1"),
+    ("osvr_display_config_built_in_osvr_hdk13_v2", "OSVR_HDK_13_V2"),
+    ("osvr_display_config_built_in_osvr_hdk20_v1", "OSVR_HDK_20_V1"),
+]
+
+HEADER = """/** @file
+@brief Built-in distortion meshes for the OSVR HDKs, as float arrays.
+
+Generated by generate_built_in_osvr_hdk_meshes.py from
+osvr_display_config_built_in_osvr_hdks.h; do not edit.
+
+@date 2026
+
+@author
+Sensics, Inc.
+<http://sensics.com/osvr>
+*/
+
+// Copyright 2026 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+// Standard includes
+#include <stddef.h>
+
+/// The points of one eye of a mesh: from x, from y, to x and to y, each in
+/// an array of its own.
+struct BuiltInMeshEye {
+    size_t points;
+    const float* fromX;
+    const float* fromY;
+    const float* toX;
+    const float* toY;
+};
+
+"""
+
+# The arrays written for each eye, and where in a [[from x, from y],
+# [to x, to y]] point each comes from.
+COORDINATES = ["from_x", "from_y", "to_x", "to_y"]
+COORDINATE_INDICES = [(0, 0), (0, 1), (1, 0), (1, 1)]
+
+VALUES_PER_LINE = 8
+
+
+def decode(source, variable):
+    """Return the bytes of one hex-encoded array in the JSON header."""
+    match = re.search(r"\b" + variable + r"\[\] = \{([^}]*)\}", source)
+    values = [int(v, 16) for v in re.findall(r"0x[0-9a-fA-F]+",
+                                              match.group(1))]
+    return bytes(bytearray(values)).rstrip(b"\0").decode("utf-8")
+
+
+def literal(number):
+    """Write a JSON number as a float literal, keeping its digits."""
+    if "." not in number and "e" not in number and "E" not in number:
+        number += ".0"
+    return number + "f"
+
+
+def main(jsonHeader, output):
+    with open(jsonHeader) as f:
+        source = f.read()
+
+    out = [HEADER]
+    table = []
+    for variable, name in NAMES:
+        config = json.loads(decode(source, variable), parse_float=str,
+                            parse_int=str)
+        eyes = config["display"]["hmd"]["distortion"]["mono_point_samples"]
+        prefix = variable.replace("_config_", "_mesh_")
+
+        out.append("// %s\n" % name)
+        for e, eye in enumerate(eyes):
+            for coordinate, (i, j) in zip(COORDINATES, COORDINATE_INDICES):
+                out.append("static const float %s_eye%d_%s[] = {\n" % (
+                    prefix, e, coordinate))
+                values = [literal(point[i][j]) for point in eye]
+                for row in range(0, len(values), VALUES_PER_LINE):
+                    out.append("  %s,\n" % ", ".join(
+                        values[row:row + VALUES_PER_LINE]))
+                out.append("};\n")
+        out.append("static const BuiltInMeshEye %s_eyes[] = {\n" % prefix)
+        for e, eye in enumerate(eyes):
+            out.append("  {%d,\n   %s},\n" % (len(eye), ",\n   ".join(
+                "%s_eye%d_%s" % (prefix, e, coordinate)
+                for coordinate in COORDINATES)))
+        out.append("};\n\n")
+        table.append((name, prefix + "_eyes", len(eyes)))
+
+    out.append("/// The built-in meshes, by mono_point_samples_built_in name.\n"
+               "static const struct {\n"
+               "    const char* name;\n"
+               "    const BuiltInMeshEye* eyePoints; //< Points of each eye\n"
+               "    size_t eyes;\n"
+               "} osvr_display_mesh_built_in_osvr_hdks[] = {\n")
+    for name, eyePoints, eyes in table:
+        out.append("  {\"%s\", %s, %d},\n" % (name, eyePoints, eyes))
+    out.append("};\n")
+
+    with open(output, "w") as f:
+        f.write("".join(out))
+
+
+if __name__ == "__main__":
+    if len(sys.argv) != 3:
+        sys.exit("Usage: %s <JSON header> <output>" % sys.argv[0])
+    main(sys.argv[1], sys.argv[2])
@@ -25,6 +25,7 @@
 
 // Internal Includes
 #include "osvr_display_configuration.h"
+#include "PointSamplesFileReader.h"
 
 // Library/third-party includes
 #include <boost/units/io.hpp>
@@ -33,11 +34,11 @@
 
 // Standard includes
 #include <cassert>
-#include <fstream>
 #include <iostream>
+#include <utility>
 
 // Included files that define built-in distortion meshes.
-#include "osvr_display_config_built_in_osvr_hdks.h"
+#include "osvr_display_config_built_in_osvr_hdk_meshes.h"
 
 OSVRDisplayConfiguration::OSVRDisplayConfiguration() {
     // do nothing
@@ -48,79 +49,109 @@ OSVRDisplayConfiguration::OSVRDisplayConfiguration(
     parse(display_description);
 }
 
-inline void parseDistortionMonoPointMeshes(
-    Json::Value const& distortion,
-    osvr::renderkit::MonoPointDistortionMeshDescriptions& mesh) {
-    Json::Value myDistortion = distortion;
-
-    // See if we have the name of a built-in config to parse.  If so, we open it
-    // and grab its values to parse, replacing the ones that they sent
-    // in.
-    const Json::Value builtIn = distortion["mono_point_samples_built_in"];
-    if ((!builtIn.isNull()) && (builtIn.isString())) {
-        // Read a Json value from the built-in config, then replace the
-        // distortion mesh with that from the file.
-        std::string builtInString;
-        Json::Value builtInData;
-        if (builtIn.asString() == "OSVR_HDK_13_V1") {
-            builtInString = osvr_display_config_built_in_osvr_hdk13_v1;
-        } else if (builtIn.asString() == "OSVR_HDK_13_V2") {
-            builtInString = osvr_display_config_built_in_osvr_hdk13_v2;
-        } else if (builtIn.asString() == "OSVR_HDK_20_V1") {
-          builtInString = osvr_display_config_built_in_osvr_hdk20_v1;
-        } else {
-            std::cerr
-                << "OSVRDisplayConfiguration::parse(): ERROR: Unrecognized "
-                   "mono_point_samples_built_in value: "
-                << builtIn.asString() << "!\n";
+/// Parse the point samples for each eye from a JSON array of arrays of
+/// [[fromX, fromY], [toX, toY]] points.  what names the samples in the
+/// errors.
+inline osvr::renderkit::MonoPointDistortionMeshSamplesPerEye
+parsePointSamples(Json::Value const& eyeArray, std::string const& what) {
+    osvr::renderkit::MonoPointDistortionMeshSamplesPerEye mesh;
+    for (auto& pointArray : eyeArray) {
+        if (pointArray.empty()) {
+            /// @todo A proper "no-op" default should be placed here, instead of
+            /// erroring out.
+            std::cerr << "OSVRDisplayConfiguration::parse(): ERROR: Empty "
+                      << " distortion " << what
+                      << " point distortion list for eye!\n";
             throw DisplayConfigurationParseException(
-                "Couldn't open external mono point file.");
+                "Empty " + what + " point distortion list for eye.");
         }
-
-        Json::Reader reader;
-        if (!reader.parse(builtInString, builtInData)) {
-            std::cerr << "OSVRDisplayConfiguration::parse(): ERROR: Couldn't "
-                         "parse built-in configuration "
-                      << builtIn.asString() << "!\n";
-            std::cerr << "Errors: " << reader.getFormattedErrorMessages();
-            throw DisplayConfigurationParseException(
-                "Couldn't parse external mono point file.");
+        auto eye =
+            std::make_shared<osvr::renderkit::MonoPointDistortionMeshSamples>();
+        eye->reserve(pointArray.size());
+        for (auto& elt : pointArray) {
+            if ((elt.size() != 2) || (elt[0].size() != 2) ||
+                (elt[1].size() != 2)) {
+                /// @todo A proper "no-op" default should be placed here,
+                /// instead of erroring out.
+                std::cerr
+                    << "OSVRDisplayConfiguration::parse(): ERROR: Malformed"
+                    << " distortion " << what
+                    << " point distortion list entry!\n";
+                throw DisplayConfigurationParseException(
+                    "Malformed " + what + " point distortion list entry.");
+            }
+            eye->add(elt[0][0].asFloat(), elt[0][1].asFloat(),
+                     elt[1][0].asFloat(), elt[1][1].asFloat());
         }
-        myDistortion = builtInData["display"]["hmd"]["distortion"];
+        mesh.push_back(eye);
+    }
+    return mesh;
+}
+
+/// Read the point samples asked of reader from an external file.
+inline void readExternalPointSamples(
+    osvr::renderkit::PointSamplesFileReader& reader,
+    std::string const& fileName, std::string const& what) {
+    if (!reader.read(fileName)) {
+        std::cerr << "OSVRDisplayConfiguration::parse(): ERROR: Couldn't "
+                     "read "
+                  << what << " point file " << fileName << ": "
+                  << reader.error() << "\n";
+        throw DisplayConfigurationParseException("Couldn't read external " +
+                                                 what + " point file.");
     }
+}
 
-    // See if we have the name of an external file to parse.  If so, we open it
-    // and grab its values to parse, replacing the ones that they sent
-    // in.
+inline void parseDistortionMonoPointMeshes(
+    Json::Value const& distortion,
+    osvr::renderkit::MonoPointDistortionMeshSamplesPerEye& mesh) {
+    // See if we have the name of a built-in mesh.  These are compiled in as
+    // arrays of points, so there is no JSON to parse, and the mesh uses them
+    // where they are.  An external file, if they name one too, takes
+    // precedence.
+    const Json::Value builtIn = distortion["mono_point_samples_built_in"];
     const Json::Value externalFile =
         distortion["mono_point_samples_external_file"];
-    if ((!externalFile.isNull()) && (externalFile.isString())) {
-        // Read a Json value from the external file, then replace the distortion
-        // mesh with that from the file.
-        Json::Value externalData;
-        Json::Reader reader;
-        std::ifstream fs;
-        fs.open(externalFile.asString().c_str(), std::fstream::in);
-        if (!fs.is_open()) {
-            std::cerr << "OSVRDisplayConfiguration::parse(): ERROR: Couldn't "
-                         "open file "
-                      << externalFile.asString() << "!\n";
-            throw DisplayConfigurationParseException(
-                "Couldn't open external mono point file.");
+    if (builtIn.isString() && !externalFile.isString()) {
+        for (auto const& builtInMesh : osvr_display_mesh_built_in_osvr_hdks) {
+            if (builtIn.asString() != builtInMesh.name) {
+                continue;
+            }
+            mesh.clear();
+            for (size_t eye = 0; eye < builtInMesh.eyes; eye++) {
+                const BuiltInMeshEye& points = builtInMesh.eyePoints[eye];
+                mesh.push_back(std::make_shared<
+                               osvr::renderkit::MonoPointDistortionMeshSamples>(
+                    points.points, points.fromX, points.fromY, points.toX,
+                    points.toY));
+            }
+            return;
         }
-        if (!reader.parse(fs, externalData)) {
+        std::cerr << "OSVRDisplayConfiguration::parse(): ERROR: Unrecognized "
+                     "mono_point_samples_built_in value: "
+                  << builtIn.asString() << "!\n";
+        throw DisplayConfigurationParseException(
+            "Unrecognized built-in mono point distortion.");
+    }
+
+    // See if we have the name of an external file to parse.  If so, we read
+    // the points straight from it, in place of the ones that they sent in.
+    if (externalFile.isString()) {
+        mesh.clear();
+        osvr::renderkit::PointSamplesFileReader reader;
+        reader.addSamples("mono_point_samples", mesh);
+        readExternalPointSamples(reader, externalFile.asString(), "mono");
+        if (mesh.empty()) {
             std::cerr << "OSVRDisplayConfiguration::parse(): ERROR: Couldn't "
-                         "parse file "
+                         "find non-empty distortion mono point distortion in "
                       << externalFile.asString() << "!\n";
-            std::cerr << "Errors: " << reader.getFormattedErrorMessages();
             throw DisplayConfigurationParseException(
-                "Couldn't parse external mono point file.");
+                "Couldn't find non-empty mono point distortion.");
         }
-        myDistortion = externalData["display"]["hmd"]["distortion"];
-        fs.close();
+        return;
     }
 
-    const Json::Value eyeArray = myDistortion["mono_point_samples"];
+    const Json::Value eyeArray = distortion["mono_point_samples"];
     if (eyeArray.isNull() || eyeArray.empty()) {
         /// @todo A proper "no-op" default should be placed here, instead of
         /// erroring out.
@@ -129,83 +160,43 @@ inline void parseDistortionMonoPointMeshes(
         throw DisplayConfigurationParseException(
             "Couldn't find non-empty mono point distortion.");
     }
-    mesh.clear();
-    for (auto& pointArray : eyeArray) {
-        osvr::renderkit::MonoPointDistortionMeshDescription eye;
-        if (pointArray.empty()) {
-            /// @todo A proper "no-op" default should be placed here, instead of
-            /// erroring out.
-            std::cerr << "OSVRDisplayConfiguration::parse(): ERROR: Empty "
-                      << " distortion mono point distortion list for eye!\n";
-            throw DisplayConfigurationParseException(
-                "Empty mono point distortion list for eye.");
-        }
-        for (auto& elt : pointArray) {
-            std::array<std::array<double, 2>, 2> point;
-            if ((elt.size() != 2) || (elt[0].size() != 2) ||
-                (elt[1].size() != 2)) {
-                /// @todo A proper "no-op" default should be placed here,
-                /// instead of erroring out.
-                std::cerr
-                    << "OSVRDisplayConfiguration::parse(): ERROR: Malformed"
-                    << " distortion mono point distortion list entry!\n";
-                throw DisplayConfigurationParseException(
-                    "Malformed mono point distortion list entry.");
-            }
-            std::array<double, 2> in, out;
-            in[0] = (elt[0][0].asDouble());
-            in[1] = (elt[0][1].asDouble());
-            out[0] = (elt[1][0].asDouble());
-            out[1] = (elt[1][1].asDouble());
-            point[0] = (in);
-            point[1] = (out);
-            eye.push_back(point);
-        }
-        mesh.push_back(eye);
-    }
+    mesh = parsePointSamples(eyeArray, "mono");
 }
 
 inline void parseDistortionRGBPointMeshes(
     Json::Value const& distortion,
-    osvr::renderkit::RGBPointDistortionMeshDescriptions& mesh) {
-    Json::Value myDistortion = distortion;
+    osvr::renderkit::RGBPointDistortionMeshSamples& mesh) {
+    std::array<std::string, 3> names = {
+        "red_point_samples", "green_point_samples", "blue_point_samples"};
 
-    // See if we have the name of an external file to parse.  If so, we open it
-    // and grab its values to parse.  Otherwise, we parse the ones that they
+    // See if we have the name of an external file to parse.  If so, we read
+    // the points straight from it.  Otherwise, we parse the ones that they
     // sent in.
     const Json::Value externalFile =
         distortion["rgb_point_samples_external_file"];
-    if ((!externalFile.isNull()) && (externalFile.isString())) {
-        // Read a Json value from the external file, then replace the distortion
-        // mesh with that from the file.
-        Json::Value externalData;
-        Json::Reader reader;
-        std::ifstream fs;
-        fs.open(externalFile.asString().c_str(), std::fstream::in);
-        if (!fs.is_open()) {
-            std::cerr << "OSVRDisplayConfiguration::parse(): ERROR: Couldn't "
-                         "open file "
-                      << externalFile.asString() << "!\n";
-            throw DisplayConfigurationParseException(
-                "Couldn't open external rgb point file.");
+    if (externalFile.isString()) {
+        osvr::renderkit::PointSamplesFileReader reader;
+        for (size_t clr = 0; clr < 3; clr++) {
+            mesh[clr].clear();
+            reader.addSamples(names[clr], mesh[clr]);
         }
-        if (!reader.parse(fs, externalData)) {
-            std::cerr << "OSVRDisplayConfiguration::parse(): ERROR: Couldn't "
-                         "parse file "
-                      << externalFile.asString() << "!\n";
-            std::cerr << "Errors: " << reader.getFormattedErrorMessages();
-            throw DisplayConfigurationParseException(
-                "Couldn't parse external rgb point file.");
+        readExternalPointSamples(reader, externalFile.asString(), "rgb");
+        for (size_t clr = 0; clr < 3; clr++) {
+            if (mesh[clr].empty()) {
+                std::cerr
+                    << "OSVRDisplayConfiguration::parse(): ERROR: Couldn't "
+                       "find non-empty distortion rgb point distortion for "
+                    << names[clr] << " in " << externalFile.asString()
+                    << std::endl;
+                throw DisplayConfigurationParseException(
+                    "Couldn't find non-empty rgb point distortion.");
+            }
         }
-        myDistortion = externalData["display"]["hmd"]["distortion"];
-        fs.close();
+        return;
     }
 
-    std::array<std::string, 3> names = {
-        "red_point_samples", "green_point_samples", "blue_point_samples"};
-
     for (size_t clr = 0; clr < 3; clr++) {
-        const Json::Value eyeArray = myDistortion[names[clr].c_str()];
+        const Json::Value eyeArray = distortion[names[clr].c_str()];
         if (eyeArray.isNull() || eyeArray.empty()) {
             /// @todo A proper "no-op" default should be placed here, instead of
             /// erroring out.
@@ -216,44 +207,7 @@ inline void parseDistortionRGBPointMeshes(
             throw DisplayConfigurationParseException(
                 "Couldn't find non-empty rgb point distortion.");
         }
-
-        mesh[clr].clear();
-        for (auto& pointArray : eyeArray) {
-            osvr::renderkit::MonoPointDistortionMeshDescription eye;
-            if (pointArray.empty()) {
-                /// @todo A proper "no-op" default should be placed here,
-                /// instead of
-                /// erroring out.
-                std::cerr << "OSVRDisplayConfiguration::parse(): ERROR: Empty "
-                          << " distortion rgb point distortion list for eye!"
-                          << std::endl;
-                throw DisplayConfigurationParseException(
-                    "Empty rgb point distortion list for eye.");
-            }
-            for (auto& elt : pointArray) {
-                std::array<std::array<double, 2>, 2> point;
-                if ((elt.size() != 2) || (elt[0].size() != 2) ||
-                    (elt[1].size() != 2)) {
-                    /// @todo A proper "no-op" default should be placed here,
-                    /// instead of erroring out.
-                    std::cerr
-                        << "OSVRDisplayConfiguration::parse(): ERROR: Malformed"
-                        << " distortion rgb point distortion list entry!"
-                        << std::endl;
-                    throw DisplayConfigurationParseException(
-                        "Malformed rgb point distortion list entry.");
-                }
-                std::array<double, 2> in, out;
-                in[0] = (elt[0][0].asDouble());
-                in[1] = (elt[0][1].asDouble());
-                out[0] = (elt[1][0].asDouble());
-                out[1] = (elt[1][1].asDouble());
-                point[0] = (in);
-                point[1] = (out);
-                eye.push_back(point);
-            }
-            mesh[clr].push_back(eye);
-        }
+        mesh[clr] = parsePointSamples(eyeArray, "rgb");
     }
 }
 
@@ -451,7 +405,8 @@ void OSVRDisplayConfiguration::parse(const std::string& display_description) {
             std::cout << "OSVRDisplayConfiguration::parse(): Using rgb point "
                          "sample distortion.\n";
             m_distortionType = RGB_POINT_SAMPLES;
-            parseDistortionRGBPointMeshes(distortion, m_distortionRGBPointMesh);
+            parseDistortionRGBPointMeshes(distortion,
+                                          m_distortionRGBPointMesh);
 
         } else if (m_distortionTypeString == "rgb_k1_coefficients") {
 #if 0
@@ -613,13 +568,45 @@ std::string OSVRDisplayConfiguration::getDistortionTypeString() const {
     return m_distortionTypeString;
 }
 
+/// Copy the points of each eye's mesh into nested vectors.
+static osvr::renderkit::MonoPointDistortionMeshDescriptions
+describePointSamples(
+    osvr::renderkit::MonoPointDistortionMeshSamplesPerEye const& eyes) {
+    osvr::renderkit::MonoPointDistortionMeshDescriptions ret;
+    for (auto const& samples : eyes) {
+        osvr::renderkit::MonoPointDistortionMeshDescription eye;
+        size_t count = samples ? samples->size() : 0;
+        eye.reserve(count);
+        for (size_t i = 0; i < count; i++) {
+            eye.push_back({{{{samples->fromX(i), samples->fromY(i)}},
+                            {{samples->toX(i), samples->toY(i)}}}});
+        }
+        ret.push_back(std::move(eye));
+    }
+    return ret;
+}
+
 osvr::renderkit::MonoPointDistortionMeshDescriptions
 OSVRDisplayConfiguration::getDistortionMonoPointMeshes() const {
-    return m_distortionMonoPointMesh;
+    return describePointSamples(m_distortionMonoPointMesh);
 }
 
 osvr::renderkit::RGBPointDistortionMeshDescriptions
 OSVRDisplayConfiguration::getDistortionRGBPointMeshes() const {
+    osvr::renderkit::RGBPointDistortionMeshDescriptions ret;
+    for (size_t color = 0; color < 3; color++) {
+        ret[color] = describePointSamples(m_distortionRGBPointMesh[color]);
+    }
+    return ret;
+}
+
+osvr::renderkit::MonoPointDistortionMeshSamplesPerEye const&
+OSVRDisplayConfiguration::getDistortionMonoPointSamples() const {
+    return m_distortionMonoPointMesh;
+}
+
+osvr::renderkit::RGBPointDistortionMeshSamples const&
+OSVRDisplayConfiguration::getDistortionRGBPointSamples() const {
     return m_distortionRGBPointMesh;
 }
 
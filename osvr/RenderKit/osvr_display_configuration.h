@@ -41,6 +41,7 @@
 #include <string>
 #include <iostream>
 #include <exception>
+#include <memory>
 #include <stdexcept>
 #include <vector>
 
@@ -108,11 +109,21 @@ class OSVRDisplayConfiguration {
     /// deprecated
     std::string OSVR_RENDERMANAGER_EXPORT getDistortionTypeString() const;
     /// Only valid if getDistortionType() == MONO_POINT_SAMPLES
+    /// deprecated: copies the points; use getDistortionMonoPointSamples()
     osvr::renderkit::MonoPointDistortionMeshDescriptions
     getDistortionMonoPointMeshes() const;
     /// Only valid if getDistortionType() == RGB_POINT_SAMPLES
+    /// deprecated: copies the points; use getDistortionRGBPointSamples()
     osvr::renderkit::RGBPointDistortionMeshDescriptions
     getDistortionRGBPointMeshes() const;
+    /// Only valid if getDistortionType() == MONO_POINT_SAMPLES.  Shared
+    /// by every copy of the configuration.
+    osvr::renderkit::MonoPointDistortionMeshSamplesPerEye const&
+    getDistortionMonoPointSamples() const;
+    /// Only valid if getDistortionType() == RGB_POINT_SAMPLES.  Shared
+    /// by every copy of the configuration.
+    osvr::renderkit::RGBPointDistortionMeshSamples const&
+    getDistortionRGBPointSamples() const;
     /// @name Polynomial distortion
     /// @brief Only valid if getDistortionType() == RGB_SYMMETRIC_POLYNOMIALS
     /// @{
@@ -168,10 +179,11 @@ class OSVRDisplayConfiguration {
     // Distortion
     DistortionType m_distortionType;
     std::string m_distortionTypeString;
-    osvr::renderkit::MonoPointDistortionMeshDescriptions
+    // The point samples are never changed once parsed, so copies of the
+    // configuration (and there are several) share them.
+    osvr::renderkit::MonoPointDistortionMeshSamplesPerEye
         m_distortionMonoPointMesh;
-    osvr::renderkit::RGBPointDistortionMeshDescriptions
-        m_distortionRGBPointMesh;
+    osvr::renderkit::RGBPointDistortionMeshSamples m_distortionRGBPointMesh;
     float m_distortionDistanceScaleX;
     float m_distortionDistanceScaleY;
     std::vector<float> m_distortionPolynomialRed;
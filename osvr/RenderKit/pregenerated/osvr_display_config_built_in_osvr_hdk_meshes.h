@@ -0,0 +1,4742 @@
+/** @file
+@brief Built-in distortion meshes for the OSVR HDKs, as float arrays.
+
+Generated by generate_built_in_osvr_hdk_meshes.py from
+osvr_display_config_built_in_osvr_hdks.h; do not edit.
+
+@date 2026
+
+@author
+Sensics, Inc.
+<http://sensics.com/osvr>
+*/
+
+// Copyright 2026 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+// Standard includes
+#include <stddef.h>
+
+/// The points of one eye of a mesh: from x, from y, to x and to y, each in
+/// an array of its own.
+struct BuiltInMeshEye {
+    size_t points;
+    const float* fromX;
+    const float* fromY;
+    const float* toX;
+    const float* toY;
+};
+
+// OSVR_HDK_13_V1
+static const float osvr_display_mesh_built_in_osvr_hdk13_v1_eye0_from_x[] = {
+  0.9636f, 0.9702f, 0.9752f, 0.9785f, 0.9818f, 0.9835f, 0.9851f, 0.9851f,
+  0.9851f, 0.9851f, 0.9851f, 0.9835f, 0.9818f, 0.9785f, 0.9752f, 0.9702f,
+  0.9636f, 0.9487f, 0.9537f, 0.957f, 0.9603f, 0.9636f, 0.9653f, 0.9669f,
+  0.9686f, 0.9686f, 0.9702f, 0.9686f, 0.9686f, 0.9669f, 0.9653f, 0.9636f,
+  0.9603f, 0.957f, 0.9537f, 0.9487f, 0.9223f, 0.9289f, 0.9339f, 0.9372f,
+  0.9405f, 0.9438f, 0.9454f, 0.9487f, 0.9504f, 0.9504f, 0.9521f, 0.9521f,
+  0.9521f, 0.9504f, 0.9504f, 0.9487f, 0.9454f, 0.9438f, 0.9405f, 0.9372f,
+  0.9339f, 0.9289f, 0.9223f, 0.9008f, 0.9058f, 0.9107f, 0.9157f, 0.919f,
+  0.9223f, 0.9256f, 0.9272f, 0.9306f, 0.9322f, 0.9322f, 0.9339f, 0.9339f,
+  0.9339f, 0.9322f, 0.9322f, 0.9306f, 0.9272f, 0.9256f, 0.9223f, 0.919f,
+  0.9157f, 0.9107f, 0.9058f, 0.9008f, 0.8694f, 0.8776f, 0.8826f, 0.8876f,
+  0.8925f, 0.8958f, 0.8991f, 0.9024f, 0.9058f, 0.9091f, 0.9107f, 0.914f,
+  0.9157f, 0.9157f, 0.9157f, 0.9157f, 0.9157f, 0.914f, 0.9107f, 0.9091f,
+  0.9058f, 0.9024f, 0.8991f, 0.8958f, 0.8925f, 0.8876f, 0.8826f, 0.8776f,
+  0.8694f, 0.8462f, 0.8528f, 0.8578f, 0.8628f, 0.8677f, 0.871f, 0.876f,
+  0.8793f, 0.8826f, 0.8876f, 0.8909f, 0.8925f, 0.8958f, 0.8975f, 0.8975f,
+  0.8975f, 0.8975f, 0.8975f, 0.8958f, 0.8925f, 0.8909f, 0.8876f, 0.8826f,
+  0.8793f, 0.876f, 0.871f, 0.8677f, 0.8628f, 0.8578f, 0.8528f, 0.8462f,
+  0.828f, 0.833f, 0.838f, 0.8429f, 0.8462f, 0.8512f, 0.8545f, 0.8595f,
+  0.8628f, 0.8677f, 0.871f, 0.8743f, 0.876f, 0.8776f, 0.8793f, 0.8793f,
+  0.8793f, 0.8776f, 0.876f, 0.8743f, 0.871f, 0.8677f, 0.8628f, 0.8595f,
+  0.8545f, 0.8512f, 0.8462f, 0.8429f, 0.838f, 0.833f, 0.828f, 0.8016f,
+  0.8065f, 0.8115f, 0.8165f, 0.8198f, 0.8247f, 0.8297f, 0.8347f, 0.8396f,
+  0.8429f, 0.8479f, 0.8512f, 0.8545f, 0.8562f, 0.8578f, 0.8595f, 0.8595f,
+  0.8595f, 0.8578f, 0.8562f, 0.8545f, 0.8512f, 0.8479f, 0.8429f, 0.8396f,
+  0.8347f, 0.8297f, 0.8247f, 0.8198f, 0.8165f, 0.8115f, 0.8065f, 0.8016f,
+  0.7751f, 0.7801f, 0.7851f, 0.7884f, 0.7933f, 0.7983f, 0.8032f, 0.8082f,
+  0.8132f, 0.8181f, 0.8214f, 0.8264f, 0.8297f, 0.833f, 0.8347f, 0.8363f,
+  0.838f, 0.838f, 0.838f, 0.8363f, 0.8347f, 0.833f, 0.8297f, 0.8264f,
+  0.8214f, 0.8181f, 0.8132f, 0.8082f, 0.8032f, 0.7983f, 0.7933f, 0.7884f,
+  0.7851f, 0.7801f, 0.7751f, 0.752f, 0.7569f, 0.7619f, 0.7652f, 0.7702f,
+  0.7751f, 0.7801f, 0.7851f, 0.79f, 0.795f, 0.7999f, 0.8032f, 0.8065f,
+  0.8099f, 0.8115f, 0.8132f, 0.8148f, 0.8148f, 0.8148f, 0.8132f, 0.8115f,
+  0.8099f, 0.8065f, 0.8032f, 0.7999f, 0.795f, 0.79f, 0.7851f, 0.7801f,
+  0.7751f, 0.7702f, 0.7652f, 0.7619f, 0.7569f, 0.752f, 0.7305f, 0.7338f,
+  0.7388f, 0.7421f, 0.747f, 0.752f, 0.7569f, 0.7619f, 0.7669f, 0.7718f,
+  0.7751f, 0.7784f, 0.7817f, 0.7851f, 0.7867f, 0.7884f, 0.79f, 0.79f,
+  0.79f, 0.7884f, 0.7867f, 0.7851f, 0.7817f, 0.7784f, 0.7751f, 0.7718f,
+  0.7669f, 0.7619f, 0.7569f, 0.752f, 0.747f, 0.7421f, 0.7388f, 0.7338f,
+  0.7305f, 0.7255f, 0.7206f, 0.7106f, 0.6908f, 0.6974f, 0.7024f, 0.7057f,
+  0.7106f, 0.714f, 0.7173f, 0.7222f, 0.7272f, 0.7321f, 0.7371f, 0.7421f,
+  0.7454f, 0.7503f, 0.7536f, 0.7569f, 0.7586f, 0.7619f, 0.7636f, 0.7636f,
+  0.7652f, 0.7636f, 0.7636f, 0.7619f, 0.7586f, 0.7569f, 0.7536f, 0.7503f,
+  0.7454f, 0.7421f, 0.7371f, 0.7321f, 0.7272f, 0.7222f, 0.7173f, 0.714f,
+  0.7106f, 0.7057f, 0.7024f, 0.6974f, 0.6908f, 0.6693f, 0.6743f, 0.6776f,
+  0.6809f, 0.6858f, 0.6892f, 0.6925f, 0.6974f, 0.7024f, 0.7073f, 0.7106f,
+  0.7156f, 0.7189f, 0.7222f, 0.7255f, 0.7288f, 0.7321f, 0.7354f, 0.7371f,
+  0.7371f, 0.7371f, 0.7371f, 0.7371f, 0.7354f, 0.7321f, 0.7288f, 0.7255f,
+  0.7222f, 0.7189f, 0.7156f, 0.7106f, 0.7073f, 0.7024f, 0.6974f, 0.6925f,
+  0.6892f, 0.6858f, 0.6809f, 0.6776f, 0.6743f, 0.6693f, 0.6462f, 0.6495f,
+  0.6528f, 0.6561f, 0.6594f, 0.6627f, 0.6677f, 0.671f, 0.6759f, 0.6792f,
+  0.6842f, 0.6875f, 0.6908f, 0.6941f, 0.6974f, 0.7007f, 0.704f, 0.7057f,
+  0.7073f, 0.709f, 0.709f, 0.709f, 0.7073f, 0.7057f, 0.704f, 0.7007f,
+  0.6974f, 0.6941f, 0.6908f, 0.6875f, 0.6842f, 0.6792f, 0.6759f, 0.671f,
+  0.6677f, 0.6627f, 0.6594f, 0.6561f, 0.6528f, 0.6495f, 0.6462f, 0.6227f,
+  0.6257f, 0.6283f, 0.6311f, 0.6341f, 0.6379f, 0.6412f, 0.6445f, 0.6478f,
+  0.6528f, 0.6561f, 0.6594f, 0.6627f, 0.666f, 0.6693f, 0.6726f, 0.6743f,
+  0.6743f, 0.6759f, 0.6759f, 0.6759f, 0.6759f, 0.6759f, 0.6743f, 0.6743f,
+  0.6726f, 0.6693f, 0.666f, 0.6627f, 0.6594f, 0.6561f, 0.6528f, 0.6478f,
+  0.6445f, 0.6412f, 0.6379f, 0.6341f, 0.6311f, 0.6283f, 0.6257f, 0.6227f,
+  0.598f, 0.6005f, 0.6028f, 0.6052f, 0.6078f, 0.6106f, 0.6138f, 0.6171f,
+  0.6204f, 0.6237f, 0.6267f, 0.6295f, 0.6324f, 0.6356f, 0.6379f, 0.6412f,
+  0.6412f, 0.6412f, 0.6396f, 0.6396f, 0.6396f, 0.6396f, 0.6396f, 0.6412f,
+  0.6412f, 0.6412f, 0.6379f, 0.6356f, 0.6324f, 0.6295f, 0.6267f, 0.6237f,
+  0.6204f, 0.6171f, 0.6138f, 0.6106f, 0.6078f, 0.6052f, 0.6028f, 0.6005f,
+  0.598f, 0.5731f, 0.5751f, 0.5769f, 0.5789f, 0.581f, 0.5835f, 0.586f,
+  0.5888f, 0.5914f, 0.5941f, 0.5966f, 0.599f, 0.6015f, 0.6042f, 0.6063f,
+  0.6071f, 0.6066f, 0.6055f, 0.604f, 0.603f, 0.6027f, 0.603f, 0.604f,
+  0.6055f, 0.6066f, 0.6071f, 0.6063f, 0.6042f, 0.6015f, 0.599f, 0.5966f,
+  0.5941f, 0.5914f, 0.5888f, 0.586f, 0.5835f, 0.581f, 0.5789f, 0.5769f,
+  0.5751f, 0.5731f, 0.5478f, 0.5493f, 0.5506f, 0.5521f, 0.5539f, 0.5557f,
+  0.5577f, 0.5599f, 0.562f, 0.564f, 0.5658f, 0.5678f, 0.5698f, 0.5718f,
+  0.5729f, 0.5729f, 0.5718f, 0.5703f, 0.5688f, 0.5678f, 0.5675f, 0.5678f,
+  0.5688f, 0.5703f, 0.5718f, 0.5729f, 0.5729f, 0.5718f, 0.5698f, 0.5678f,
+  0.5658f, 0.564f, 0.562f, 0.5599f, 0.5577f, 0.5557f, 0.5539f, 0.5521f,
+  0.5506f, 0.5493f, 0.5478f, 0.5223f, 0.5233f, 0.5241f, 0.5253f, 0.5265f,
+  0.5276f, 0.5291f, 0.5304f, 0.5319f, 0.5332f, 0.5346f, 0.5359f, 0.5372f,
+  0.5385f, 0.539f, 0.5385f, 0.5375f, 0.5362f, 0.5351f, 0.5342f, 0.5339f,
+  0.5342f, 0.5351f, 0.5362f, 0.5375f, 0.5385f, 0.539f, 0.5385f, 0.5372f,
+  0.5359f, 0.5346f, 0.5332f, 0.5319f, 0.5304f, 0.5291f, 0.5276f, 0.5265f,
+  0.5253f, 0.5241f, 0.5233f, 0.5223f, 0.4967f, 0.4972f, 0.4975f, 0.4982f,
+  0.4987f, 0.4993f, 0.5f, 0.5008f, 0.5015f, 0.5021f, 0.5028f, 0.5035f,
+  0.5043f, 0.5048f, 0.505f, 0.5046f, 0.504f, 0.5031f, 0.5025f, 0.502f,
+  0.5018f, 0.502f, 0.5025f, 0.5031f, 0.504f, 0.5046f, 0.505f, 0.5048f,
+  0.5043f, 0.5035f, 0.5028f, 0.5021f, 0.5015f, 0.5008f, 0.5f, 0.4993f,
+  0.4987f, 0.4982f, 0.4975f, 0.4972f, 0.4967f, 0.4709f, 0.4709f, 0.4709f,
+  0.4709f, 0.4709f, 0.4709f, 0.4709f, 0.4709f, 0.4709f, 0.4709f, 0.4709f,
+  0.4709f, 0.4709f, 0.4709f, 0.4709f, 0.4709f, 0.4709f, 0.4709f, 0.4709f,
+  0.4709f, 0.4709f, 0.4709f, 0.4709f, 0.4709f, 0.4709f, 0.4709f, 0.4709f,
+  0.4709f, 0.4709f, 0.4709f, 0.4709f, 0.4709f, 0.4709f, 0.4709f, 0.4709f,
+  0.4709f, 0.4709f, 0.4709f, 0.4709f, 0.4709f, 0.4709f, 0.4451f, 0.4446f,
+  0.4443f, 0.4436f, 0.4431f, 0.4425f, 0.4418f, 0.441f, 0.4403f, 0.4396f,
+  0.439f, 0.4383f, 0.4375f, 0.437f, 0.4368f, 0.4372f, 0.4378f, 0.4387f,
+  0.4393f, 0.4398f, 0.44f, 0.4398f, 0.4393f, 0.4387f, 0.4378f, 0.4372f,
+  0.4368f, 0.437f, 0.4375f, 0.4383f, 0.439f, 0.4396f, 0.4403f, 0.441f,
+  0.4418f, 0.4425f, 0.4431f, 0.4436f, 0.4443f, 0.4446f, 0.4451f, 0.4195f,
+  0.4185f, 0.4177f, 0.4165f, 0.4153f, 0.4142f, 0.4127f, 0.4114f, 0.4099f,
+  0.4086f, 0.4072f, 0.4059f, 0.4046f, 0.4033f, 0.4028f, 0.4033f, 0.4043f,
+  0.4056f, 0.4067f, 0.4076f, 0.4079f, 0.4076f, 0.4067f, 0.4056f, 0.4043f,
+  0.4033f, 0.4028f, 0.4033f, 0.4046f, 0.4059f, 0.4072f, 0.4086f, 0.4099f,
+  0.4114f, 0.4127f, 0.4142f, 0.4153f, 0.4165f, 0.4177f, 0.4185f, 0.4195f,
+  0.394f, 0.3925f, 0.3912f, 0.3897f, 0.3879f, 0.3861f, 0.3841f, 0.3819f,
+  0.3798f, 0.3778f, 0.376f, 0.374f, 0.372f, 0.37f, 0.3689f, 0.3689f,
+  0.37f, 0.3715f, 0.373f, 0.374f, 0.3743f, 0.374f, 0.373f, 0.3715f,
+  0.37f, 0.3689f, 0.3689f, 0.37f, 0.372f, 0.374f, 0.376f, 0.3778f,
+  0.3798f, 0.3819f, 0.3841f, 0.3861f, 0.3879f, 0.3897f, 0.3912f, 0.3925f,
+  0.394f, 0.3687f, 0.3667f, 0.3649f, 0.3629f, 0.3608f, 0.3583f, 0.3558f,
+  0.353f, 0.3504f, 0.3477f, 0.3452f, 0.3428f, 0.3403f, 0.3376f, 0.3355f,
+  0.3347f, 0.3352f, 0.3363f, 0.3378f, 0.3388f, 0.3391f, 0.3388f, 0.3378f,
+  0.3363f, 0.3352f, 0.3347f, 0.3355f, 0.3376f, 0.3403f, 0.3428f, 0.3452f,
+  0.3477f, 0.3504f, 0.353f, 0.3558f, 0.3583f, 0.3608f, 0.3629f, 0.3649f,
+  0.3667f, 0.3687f, 0.3437f, 0.3413f, 0.339f, 0.3366f, 0.334f, 0.3312f,
+  0.328f, 0.3247f, 0.3214f, 0.3181f, 0.3151f, 0.3123f, 0.3094f, 0.3062f,
+  0.3039f, 0.3006f, 0.3006f, 0.3006f, 0.3022f, 0.3022f, 0.3022f, 0.3022f,
+  0.3022f, 0.3006f, 0.3006f, 0.3006f, 0.3039f, 0.3062f, 0.3094f, 0.3123f,
+  0.3151f, 0.3181f, 0.3214f, 0.3247f, 0.328f, 0.3312f, 0.334f, 0.3366f,
+  0.339f, 0.3413f, 0.3437f, 0.3191f, 0.3161f, 0.3135f, 0.3107f, 0.3077f,
+  0.3039f, 0.3006f, 0.2973f, 0.294f, 0.289f, 0.2857f, 0.2824f, 0.2791f,
+  0.2758f, 0.2725f, 0.2692f, 0.2675f, 0.2675f, 0.2659f, 0.2659f, 0.2659f,
+  0.2659f, 0.2659f, 0.2675f, 0.2675f, 0.2692f, 0.2725f, 0.2758f, 0.2791f,
+  0.2824f, 0.2857f, 0.289f, 0.294f, 0.2973f, 0.3006f, 0.3039f, 0.3077f,
+  0.3107f, 0.3135f, 0.3161f, 0.3191f, 0.2956f, 0.2923f, 0.289f, 0.2857f,
+  0.2824f, 0.2791f, 0.2741f, 0.2708f, 0.2659f, 0.2626f, 0.2576f, 0.2543f,
+  0.251f, 0.2477f, 0.2444f, 0.2411f, 0.2378f, 0.2361f, 0.2345f, 0.2328f,
+  0.2328f, 0.2328f, 0.2345f, 0.2361f, 0.2378f, 0.2411f, 0.2444f, 0.2477f,
+  0.251f, 0.2543f, 0.2576f, 0.2626f, 0.2659f, 0.2708f, 0.2741f, 0.2791f,
+  0.2824f, 0.2857f, 0.289f, 0.2923f, 0.2956f, 0.2725f, 0.2675f, 0.2642f,
+  0.2609f, 0.256f, 0.2526f, 0.2493f, 0.2444f, 0.2394f, 0.2345f, 0.2312f,
+  0.2262f, 0.2229f, 0.2196f, 0.2163f, 0.213f, 0.2097f, 0.2063f, 0.2047f,
+  0.2047f, 0.2047f, 0.2047f, 0.2047f, 0.2063f, 0.2097f, 0.213f, 0.2163f,
+  0.2196f, 0.2229f, 0.2262f, 0.2312f, 0.2345f, 0.2394f, 0.2444f, 0.2493f,
+  0.2526f, 0.256f, 0.2609f, 0.2642f, 0.2675f, 0.2725f, 0.251f, 0.2444f,
+  0.2394f, 0.2361f, 0.2312f, 0.2278f, 0.2245f, 0.2196f, 0.2146f, 0.2097f,
+  0.2047f, 0.1997f, 0.1964f, 0.1915f, 0.1882f, 0.1849f, 0.1832f, 0.1799f,
+  0.1782f, 0.1782f, 0.1766f, 0.1782f, 0.1782f, 0.1799f, 0.1832f, 0.1849f,
+  0.1882f, 0.1915f, 0.1964f, 0.1997f, 0.2047f, 0.2097f, 0.2146f, 0.2196f,
+  0.2245f, 0.2278f, 0.2312f, 0.2361f, 0.2394f, 0.2444f, 0.251f, 0.2312f,
+  0.2212f, 0.2163f, 0.2113f, 0.208f, 0.203f, 0.1997f, 0.1948f, 0.1898f,
+  0.1849f, 0.1799f, 0.1749f, 0.17f, 0.1667f, 0.1634f, 0.1601f, 0.1567f,
+  0.1551f, 0.1534f, 0.1518f, 0.1518f, 0.1518f, 0.1534f, 0.1551f, 0.1567f,
+  0.1601f, 0.1634f, 0.1667f, 0.17f, 0.1749f, 0.1799f, 0.1849f, 0.1898f,
+  0.1948f, 0.1997f, 0.203f, 0.208f, 0.2113f, 0.1898f, 0.1849f, 0.1799f,
+  0.1766f, 0.1716f, 0.1667f, 0.1617f, 0.1567f, 0.1518f, 0.1468f, 0.1419f,
+  0.1386f, 0.1353f, 0.1319f, 0.1303f, 0.1286f, 0.127f, 0.127f, 0.127f,
+  0.1286f, 0.1303f, 0.1319f, 0.1353f, 0.1386f, 0.1419f, 0.1468f, 0.1518f,
+  0.1567f, 0.1617f, 0.1667f, 0.1716f, 0.1766f, 0.1799f, 0.1849f, 0.1898f,
+  0.1667f, 0.1617f, 0.1567f, 0.1534f, 0.1485f, 0.1435f, 0.1386f, 0.1336f,
+  0.1286f, 0.1237f, 0.1204f, 0.1154f, 0.1121f, 0.1088f, 0.1071f, 0.1055f,
+  0.1038f, 0.1038f, 0.1038f, 0.1055f, 0.1071f, 0.1088f, 0.1121f, 0.1154f,
+  0.1204f, 0.1237f, 0.1286f, 0.1336f, 0.1386f, 0.1435f, 0.1485f, 0.1534f,
+  0.1567f, 0.1617f, 0.1667f, 0.1402f, 0.1353f, 0.1303f, 0.1253f, 0.122f,
+  0.1171f, 0.1121f, 0.1071f, 0.1022f, 0.09888f, 0.09392f, 0.09061f, 0.0873f,
+  0.08565f, 0.08399f, 0.08234f, 0.08234f, 0.08234f, 0.08399f, 0.08565f, 0.0873f,
+  0.09061f, 0.09392f, 0.09888f, 0.1022f, 0.1071f, 0.1121f, 0.1171f, 0.122f,
+  0.1253f, 0.1303f, 0.1353f, 0.1402f, 0.1138f, 0.1088f, 0.1038f, 0.09888f,
+  0.09557f, 0.09061f, 0.0873f, 0.08234f, 0.07903f, 0.07407f, 0.07077f, 0.06746f,
+  0.06581f, 0.06415f, 0.0625f, 0.0625f, 0.0625f, 0.06415f, 0.06581f, 0.06746f,
+  0.07077f, 0.07407f, 0.07903f, 0.08234f, 0.0873f, 0.09061f, 0.09557f, 0.09888f,
+  0.1038f, 0.1088f, 0.1138f, 0.09557f, 0.08896f, 0.08399f, 0.07903f, 0.07407f,
+  0.07077f, 0.06581f, 0.0625f, 0.05919f, 0.05423f, 0.05093f, 0.04927f, 0.04597f,
+  0.04431f, 0.04431f, 0.04431f, 0.04431f, 0.04431f, 0.04597f, 0.04927f, 0.05093f,
+  0.05423f, 0.05919f, 0.0625f, 0.06581f, 0.07077f, 0.07407f, 0.07903f, 0.08399f,
+  0.08896f, 0.09557f, 0.07242f, 0.06415f, 0.05919f, 0.05423f, 0.04927f, 0.04597f,
+  0.04266f, 0.03935f, 0.03604f, 0.03274f, 0.03108f, 0.02778f, 0.02612f, 0.02612f,
+  0.02612f, 0.02612f, 0.02612f, 0.02778f, 0.03108f, 0.03274f, 0.03604f, 0.03935f,
+  0.04266f, 0.04597f, 0.04927f, 0.05423f, 0.05919f, 0.06415f, 0.07242f, 0.04101f,
+  0.03604f, 0.03108f, 0.02612f, 0.02282f, 0.01951f, 0.0162f, 0.01455f, 0.01124f,
+  0.00959f, 0.00959f, 0.007937f, 0.007937f, 0.007937f, 0.00959f, 0.00959f, 0.01124f,
+  0.01455f, 0.0162f, 0.01951f, 0.02282f, 0.02612f, 0.03108f, 0.03604f, 0.04101f,
+  0.01951f, 0.0129f, 0.007937f, 0.00463f, 0.001323f, -0.001984f, -0.003638f, -0.006944f,
+  -0.008598f, -0.008598f, -0.01025f, -0.01025f, -0.01025f, -0.008598f, -0.008598f, -0.006944f,
+  -0.003638f, -0.001984f, 0.001323f, 0.00463f, 0.007937f, 0.0129f, 0.01951f, -0.006944f,
+  -0.0119f, -0.01521f, -0.01852f, -0.02183f, -0.02348f, -0.02513f, -0.02679f, -0.02679f,
+  -0.02844f, -0.02679f, -0.02679f, -0.02513f, -0.02348f, -0.02183f, -0.01852f, -0.01521f,
+  -0.0119f, -0.006944f, -0.02183f, -0.02844f, -0.0334f, -0.03671f, -0.04001f, -0.04167f,
+  -0.04332f, -0.04332f, -0.04332f, -0.04332f, -0.04332f, -0.04167f, -0.04001f, -0.03671f,
+  -0.0334f, -0.02844f, -0.02183f,
+};
+static const float osvr_display_mesh_built_in_osvr_hdk13_v1_eye0_from_y[] = {
+  0.3251f, 0.3442f, 0.3654f, 0.3871f, 0.4092f, 0.4317f, 0.4543f, 0.4771f,
+  0.5f, 0.5229f, 0.5457f, 0.5683f, 0.5908f, 0.6129f, 0.6346f, 0.6558f,
+  0.6749f, 0.2986f, 0.3192f, 0.3413f, 0.3624f, 0.3848f, 0.4074f, 0.4303f,
+  0.4534f, 0.4766f, 0.5f, 0.5234f, 0.5466f, 0.5697f, 0.5926f, 0.6152f,
+  0.6376f, 0.6587f, 0.6808f, 0.7014f, 0.2546f, 0.2737f, 0.2942f, 0.3163f,
+  0.3383f, 0.3599f, 0.3827f, 0.4058f, 0.429f, 0.4525f, 0.4762f, 0.5f,
+  0.5238f, 0.5475f, 0.571f, 0.5942f, 0.6173f, 0.6401f, 0.6617f, 0.6837f,
+  0.7058f, 0.7263f, 0.7454f, 0.2296f, 0.2501f, 0.2693f, 0.2913f, 0.3133f,
+  0.3354f, 0.3576f, 0.3805f, 0.404f, 0.4277f, 0.4516f, 0.4757f, 0.5f,
+  0.5243f, 0.5484f, 0.5723f, 0.596f, 0.6195f, 0.6424f, 0.6646f, 0.6867f,
+  0.7087f, 0.7307f, 0.7499f, 0.7704f, 0.1899f, 0.2061f, 0.2252f, 0.2457f,
+  0.2663f, 0.2869f, 0.3089f, 0.3325f, 0.3549f, 0.3783f, 0.4021f, 0.4262f,
+  0.4506f, 0.4753f, 0.5f, 0.5247f, 0.5494f, 0.5738f, 0.5979f, 0.6217f,
+  0.6451f, 0.6675f, 0.6911f, 0.7131f, 0.7337f, 0.7543f, 0.7748f, 0.7939f,
+  0.8101f, 0.1664f, 0.1825f, 0.2016f, 0.2208f, 0.2413f, 0.2619f, 0.284f,
+  0.306f, 0.3295f, 0.3516f, 0.3758f, 0.3999f, 0.4246f, 0.4496f, 0.4747f,
+  0.5f, 0.5253f, 0.5504f, 0.5754f, 0.6001f, 0.6242f, 0.6484f, 0.6705f,
+  0.694f, 0.716f, 0.7381f, 0.7587f, 0.7792f, 0.7984f, 0.8175f, 0.8336f,
+  0.1605f, 0.1781f, 0.1972f, 0.2178f, 0.2384f, 0.259f, 0.281f, 0.3031f,
+  0.3251f, 0.3486f, 0.373f, 0.3977f, 0.4228f, 0.4483f, 0.4741f, 0.5f,
+  0.5259f, 0.5517f, 0.5772f, 0.6023f, 0.627f, 0.6514f, 0.6749f, 0.6969f,
+  0.719f, 0.741f, 0.7616f, 0.7822f, 0.8028f, 0.8219f, 0.8395f, 0.1384f,
+  0.1561f, 0.1737f, 0.1928f, 0.2134f, 0.234f, 0.2546f, 0.2766f, 0.2986f,
+  0.3222f, 0.3457f, 0.3701f, 0.3952f, 0.4209f, 0.4471f, 0.4734f, 0.5f,
+  0.5266f, 0.5529f, 0.5791f, 0.6048f, 0.6299f, 0.6543f, 0.6778f, 0.7014f,
+  0.7234f, 0.7454f, 0.766f, 0.7866f, 0.8072f, 0.8263f, 0.8439f, 0.8616f,
+  0.1164f, 0.134f, 0.1517f, 0.1693f, 0.1899f, 0.209f, 0.2296f, 0.2501f,
+  0.2722f, 0.2942f, 0.3178f, 0.3427f, 0.3671f, 0.3929f, 0.419f, 0.4458f,
+  0.4728f, 0.5f, 0.5272f, 0.5542f, 0.581f, 0.6071f, 0.6329f, 0.6573f,
+  0.6822f, 0.7058f, 0.7278f, 0.7499f, 0.7704f, 0.791f, 0.8101f, 0.8307f,
+  0.8483f, 0.866f, 0.8836f, 0.112f, 0.1296f, 0.1473f, 0.1664f, 0.1855f,
+  0.2046f, 0.2252f, 0.2457f, 0.2678f, 0.2898f, 0.3148f, 0.3383f, 0.3642f,
+  0.3905f, 0.4173f, 0.4446f, 0.4722f, 0.5f, 0.5278f, 0.5554f, 0.5827f,
+  0.6095f, 0.6358f, 0.6617f, 0.6852f, 0.7102f, 0.7322f, 0.7543f, 0.7748f,
+  0.7954f, 0.8145f, 0.8336f, 0.8527f, 0.8704f, 0.888f, 0.1091f, 0.1252f,
+  0.1443f, 0.162f, 0.1811f, 0.2002f, 0.2208f, 0.2413f, 0.2634f, 0.2869f,
+  0.3104f, 0.3354f, 0.3616f, 0.3883f, 0.4156f, 0.4434f, 0.4716f, 0.5f,
+  0.5284f, 0.5566f, 0.5844f, 0.6117f, 0.6384f, 0.6646f, 0.6896f, 0.7131f,
+  0.7366f, 0.7587f, 0.7792f, 0.7998f, 0.8189f, 0.838f, 0.8557f, 0.8748f,
+  0.8909f, 0.9071f, 0.9203f, 0.9262f, 0.06349f, 0.07378f, 0.08848f, 0.1046f,
+  0.1223f, 0.1399f, 0.159f, 0.1767f, 0.1958f, 0.2163f, 0.2369f, 0.259f,
+  0.2825f, 0.3075f, 0.3325f, 0.3591f, 0.3861f, 0.4139f, 0.4422f, 0.471f,
+  0.5f, 0.529f, 0.5578f, 0.5861f, 0.6139f, 0.6409f, 0.6675f, 0.6925f,
+  0.7175f, 0.741f, 0.7631f, 0.7837f, 0.8042f, 0.8233f, 0.841f, 0.8601f,
+  0.8777f, 0.8954f, 0.9115f, 0.9262f, 0.9365f, 0.05761f, 0.06937f, 0.08554f,
+  0.1017f, 0.1193f, 0.137f, 0.1546f, 0.1723f, 0.1914f, 0.2119f, 0.2325f,
+  0.256f, 0.2795f, 0.3045f, 0.3295f, 0.3564f, 0.3839f, 0.4121f, 0.4411f,
+  0.4703f, 0.5f, 0.5297f, 0.5589f, 0.5879f, 0.6161f, 0.6436f, 0.6705f,
+  0.6955f, 0.7205f, 0.744f, 0.7675f, 0.7881f, 0.8086f, 0.8277f, 0.8454f,
+  0.863f, 0.8807f, 0.8983f, 0.9145f, 0.9306f, 0.9424f, 0.0532f, 0.06643f,
+  0.0826f, 0.09877f, 0.1164f, 0.134f, 0.1517f, 0.1693f, 0.1884f, 0.2075f,
+  0.2296f, 0.2516f, 0.2766f, 0.3016f, 0.3266f, 0.3536f, 0.3815f, 0.4103f,
+  0.4399f, 0.4699f, 0.5f, 0.5301f, 0.5601f, 0.5897f, 0.6185f, 0.6464f,
+  0.6734f, 0.6984f, 0.7234f, 0.7484f, 0.7704f, 0.7925f, 0.8116f, 0.8307f,
+  0.8483f, 0.866f, 0.8836f, 0.9012f, 0.9174f, 0.9336f, 0.9468f, 0.05026f,
+  0.06349f, 0.07966f, 0.09583f, 0.1135f, 0.1296f, 0.1473f, 0.1649f, 0.184f,
+  0.2046f, 0.2266f, 0.2487f, 0.2737f, 0.2986f, 0.3236f, 0.3516f, 0.3796f,
+  0.4093f, 0.4394f, 0.4697f, 0.5f, 0.5303f, 0.5606f, 0.5907f, 0.6204f,
+  0.6484f, 0.6764f, 0.7014f, 0.7263f, 0.7513f, 0.7734f, 0.7954f, 0.816f,
+  0.8351f, 0.8527f, 0.8704f, 0.8865f, 0.9042f, 0.9203f, 0.9365f, 0.9497f,
+  0.04733f, 0.06202f, 0.07819f, 0.09436f, 0.1105f, 0.1267f, 0.1443f, 0.162f,
+  0.1811f, 0.2016f, 0.2237f, 0.2457f, 0.2707f, 0.2957f, 0.3207f, 0.3486f,
+  0.3789f, 0.4093f, 0.4399f, 0.47f, 0.5f, 0.53f, 0.5601f, 0.5907f,
+  0.6211f, 0.6514f, 0.6793f, 0.7043f, 0.7293f, 0.7543f, 0.7763f, 0.7984f,
+  0.8189f, 0.838f, 0.8557f, 0.8733f, 0.8895f, 0.9056f, 0.9218f, 0.938f,
+  0.9527f, 0.04586f, 0.06055f, 0.07525f, 0.09289f, 0.1091f, 0.1252f, 0.1414f,
+  0.159f, 0.1781f, 0.1987f, 0.2208f, 0.2443f, 0.2678f, 0.2928f, 0.3192f,
+  0.3486f, 0.3793f, 0.4103f, 0.4408f, 0.4706f, 0.5f, 0.5294f, 0.5592f,
+  0.5897f, 0.6207f, 0.6514f, 0.6808f, 0.7072f, 0.7322f, 0.7557f, 0.7792f,
+  0.8013f, 0.8219f, 0.841f, 0.8586f, 0.8748f, 0.8909f, 0.9071f, 0.9248f,
+  0.9394f, 0.9541f, 0.04439f, 0.05908f, 0.07378f, 0.08995f, 0.1061f, 0.1223f,
+  0.1399f, 0.1576f, 0.1767f, 0.1972f, 0.2193f, 0.2413f, 0.2648f, 0.2913f,
+  0.3192f, 0.3486f, 0.3804f, 0.4117f, 0.4419f, 0.4713f, 0.5f, 0.5287f,
+  0.5581f, 0.5883f, 0.6196f, 0.6514f, 0.6808f, 0.7087f, 0.7352f, 0.7587f,
+  0.7807f, 0.8028f, 0.8233f, 0.8424f, 0.8601f, 0.8777f, 0.8939f, 0.9101f,
+  0.9262f, 0.9409f, 0.9556f, 0.04292f, 0.05761f, 0.07378f, 0.08995f, 0.1046f,
+  0.1208f, 0.1384f, 0.1561f, 0.1752f, 0.1958f, 0.2178f, 0.2399f, 0.2634f,
+  0.2898f, 0.3178f, 0.3501f, 0.3817f, 0.413f, 0.443f, 0.4719f, 0.5f,
+  0.5281f, 0.557f, 0.587f, 0.6183f, 0.6499f, 0.6822f, 0.7102f, 0.7366f,
+  0.7601f, 0.7822f, 0.8042f, 0.8248f, 0.8439f, 0.8616f, 0.8792f, 0.8954f,
+  0.9101f, 0.9262f, 0.9424f, 0.9571f, 0.04145f, 0.05761f, 0.07231f, 0.08848f,
+  0.1046f, 0.1208f, 0.137f, 0.1546f, 0.1737f, 0.1943f, 0.2163f, 0.2399f,
+  0.2634f, 0.2884f, 0.3178f, 0.3501f, 0.3826f, 0.4139f, 0.4437f, 0.4724f,
+  0.5f, 0.5276f, 0.5563f, 0.5861f, 0.6174f, 0.6499f, 0.6822f, 0.7116f,
+  0.7366f, 0.7601f, 0.7837f, 0.8057f, 0.8263f, 0.8454f, 0.863f, 0.8792f,
+  0.8954f, 0.9115f, 0.9277f, 0.9424f, 0.9586f, 0.04145f, 0.05614f, 0.07231f,
+  0.08848f, 0.1046f, 0.1208f, 0.137f, 0.1546f, 0.1737f, 0.1943f, 0.2163f,
+  0.2384f, 0.2634f, 0.2884f, 0.3178f, 0.3501f, 0.3829f, 0.4142f, 0.444f,
+  0.4725f, 0.5f, 0.5275f, 0.556f, 0.5858f, 0.6171f, 0.6499f, 0.6822f,
+  0.7116f, 0.7366f, 0.7616f, 0.7837f, 0.8057f, 0.8263f, 0.8454f, 0.863f,
+  0.8792f, 0.8954f, 0.9115f, 0.9277f, 0.9439f, 0.9586f, 0.04145f, 0.05761f,
+  0.07231f, 0.08848f, 0.1046f, 0.1208f, 0.137f, 0.1546f, 0.1737f, 0.1943f,
+  0.2163f, 0.2399f, 0.2634f, 0.2884f, 0.3178f, 0.3501f, 0.3826f, 0.4139f,
+  0.4437f, 0.4724f, 0.5f, 0.5276f, 0.5563f, 0.5861f, 0.6174f, 0.6499f,
+  0.6822f, 0.7116f, 0.7366f, 0.7601f, 0.7837f, 0.8057f, 0.8263f, 0.8454f,
+  0.863f, 0.8792f, 0.8954f, 0.9115f, 0.9277f, 0.9424f, 0.9586f, 0.04292f,
+  0.05761f, 0.07378f, 0.08995f, 0.1046f, 0.1208f, 0.1384f, 0.1561f, 0.1752f,
+  0.1958f, 0.2178f, 0.2399f, 0.2634f, 0.2898f, 0.3178f, 0.3501f, 0.3817f,
+  0.413f, 0.443f, 0.4719f, 0.5f, 0.5281f, 0.557f, 0.587f, 0.6183f,
+  0.6499f, 0.6822f, 0.7102f, 0.7366f, 0.7601f, 0.7822f, 0.8042f, 0.8248f,
+  0.8439f, 0.8616f, 0.8792f, 0.8954f, 0.9101f, 0.9262f, 0.9424f, 0.9571f,
+  0.04439f, 0.05908f, 0.07378f, 0.08995f, 0.1061f, 0.1223f, 0.1399f, 0.1576f,
+  0.1767f, 0.1972f, 0.2193f, 0.2413f, 0.2648f, 0.2913f, 0.3192f, 0.3486f,
+  0.3804f, 0.4117f, 0.4419f, 0.4713f, 0.5f, 0.5287f, 0.5581f, 0.5883f,
+  0.6196f, 0.6514f, 0.6808f, 0.7087f, 0.7352f, 0.7587f, 0.7807f, 0.8028f,
+  0.8233f, 0.8424f, 0.8601f, 0.8777f, 0.8939f, 0.9101f, 0.9262f, 0.9409f,
+  0.9556f, 0.04586f, 0.06055f, 0.07525f, 0.09289f, 0.1091f, 0.1252f, 0.1414f,
+  0.159f, 0.1781f, 0.1987f, 0.2208f, 0.2443f, 0.2678f, 0.2928f, 0.3192f,
+  0.3486f, 0.3793f, 0.4103f, 0.4408f, 0.4706f, 0.5f, 0.5294f, 0.5592f,
+  0.5897f, 0.6207f, 0.6514f, 0.6808f, 0.7072f, 0.7322f, 0.7557f, 0.7792f,
+  0.8013f, 0.8219f, 0.841f, 0.8586f, 0.8748f, 0.8909f, 0.9071f, 0.9248f,
+  0.9394f, 0.9541f, 0.04733f, 0.06202f, 0.07819f, 0.09436f, 0.1105f, 0.1267f,
+  0.1443f, 0.162f, 0.1811f, 0.2016f, 0.2237f, 0.2457f, 0.2707f, 0.2957f,
+  0.3207f, 0.3486f, 0.3789f, 0.4093f, 0.4399f, 0.47f, 0.5f, 0.53f,
+  0.5601f, 0.5907f, 0.6211f, 0.6514f, 0.6793f, 0.7043f, 0.7293f, 0.7543f,
+  0.7763f, 0.7984f, 0.8189f, 0.838f, 0.8557f, 0.8733f, 0.8895f, 0.9056f,
+  0.9218f, 0.938f, 0.9527f, 0.05026f, 0.06349f, 0.07966f, 0.09583f, 0.1135f,
+  0.1296f, 0.1473f, 0.1649f, 0.184f, 0.2046f, 0.2266f, 0.2487f, 0.2737f,
+  0.2986f, 0.3236f, 0.3516f, 0.3796f, 0.4093f, 0.4394f, 0.4697f, 0.5f,
+  0.5303f, 0.5606f, 0.5907f, 0.6204f, 0.6484f, 0.6764f, 0.7014f, 0.7263f,
+  0.7513f, 0.7734f, 0.7954f, 0.816f, 0.8351f, 0.8527f, 0.8704f, 0.8865f,
+  0.9042f, 0.9203f, 0.9365f, 0.9497f, 0.0532f, 0.06643f, 0.0826f, 0.09877f,
+  0.1164f, 0.134f, 0.1517f, 0.1693f, 0.1884f, 0.2075f, 0.2296f, 0.2516f,
+  0.2766f, 0.3016f, 0.3266f, 0.3536f, 0.3815f, 0.4103f, 0.4399f, 0.4699f,
+  0.5f, 0.5301f, 0.5601f, 0.5897f, 0.6185f, 0.6464f, 0.6734f, 0.6984f,
+  0.7234f, 0.7484f, 0.7704f, 0.7925f, 0.8116f, 0.8307f, 0.8483f, 0.866f,
+  0.8836f, 0.9012f, 0.9174f, 0.9336f, 0.9468f, 0.05761f, 0.06937f, 0.08554f,
+  0.1017f, 0.1193f, 0.137f, 0.1546f, 0.1723f, 0.1914f, 0.2119f, 0.2325f,
+  0.256f, 0.2795f, 0.3045f, 0.3295f, 0.3564f, 0.3839f, 0.4121f, 0.4411f,
+  0.4703f, 0.5f, 0.5297f, 0.5589f, 0.5879f, 0.6161f, 0.6436f, 0.6705f,
+  0.6955f, 0.7205f, 0.744f, 0.7675f, 0.7881f, 0.8086f, 0.8277f, 0.8454f,
+  0.863f, 0.8807f, 0.8983f, 0.9145f, 0.9306f, 0.9424f, 0.06349f, 0.07378f,
+  0.08848f, 0.1046f, 0.1223f, 0.1399f, 0.159f, 0.1767f, 0.1958f, 0.2163f,
+  0.2369f, 0.259f, 0.2825f, 0.3075f, 0.3325f, 0.3591f, 0.3861f, 0.4139f,
+  0.4422f, 0.471f, 0.5f, 0.529f, 0.5578f, 0.5861f, 0.6139f, 0.6409f,
+  0.6675f, 0.6925f, 0.7175f, 0.741f, 0.7631f, 0.7837f, 0.8042f, 0.8233f,
+  0.841f, 0.8601f, 0.8777f, 0.8954f, 0.9115f, 0.9262f, 0.9365f, 0.07378f,
+  0.07966f, 0.09289f, 0.1091f, 0.1252f, 0.1443f, 0.162f, 0.1811f, 0.2002f,
+  0.2208f, 0.2413f, 0.2634f, 0.2869f, 0.3104f, 0.3354f, 0.3616f, 0.3883f,
+  0.4156f, 0.4434f, 0.4716f, 0.5f, 0.5284f, 0.5566f, 0.5844f, 0.6117f,
+  0.6384f, 0.6646f, 0.6896f, 0.7131f, 0.7366f, 0.7587f, 0.7792f, 0.7998f,
+  0.8189f, 0.838f, 0.8557f, 0.8748f, 0.8909f, 0.112f, 0.1296f, 0.1473f,
+  0.1664f, 0.1855f, 0.2046f, 0.2252f, 0.2457f, 0.2678f, 0.2898f, 0.3148f,
+  0.3383f, 0.3642f, 0.3905f, 0.4173f, 0.4446f, 0.4722f, 0.5f, 0.5278f,
+  0.5554f, 0.5827f, 0.6095f, 0.6358f, 0.6617f, 0.6852f, 0.7102f, 0.7322f,
+  0.7543f, 0.7748f, 0.7954f, 0.8145f, 0.8336f, 0.8527f, 0.8704f, 0.888f,
+  0.1164f, 0.134f, 0.1517f, 0.1693f, 0.1899f, 0.209f, 0.2296f, 0.2501f,
+  0.2722f, 0.2942f, 0.3178f, 0.3427f, 0.3671f, 0.3929f, 0.419f, 0.4458f,
+  0.4728f, 0.5f, 0.5272f, 0.5542f, 0.581f, 0.6071f, 0.6329f, 0.6573f,
+  0.6822f, 0.7058f, 0.7278f, 0.7499f, 0.7704f, 0.791f, 0.8101f, 0.8307f,
+  0.8483f, 0.866f, 0.8836f, 0.1384f, 0.1561f, 0.1737f, 0.1928f, 0.2134f,
+  0.234f, 0.2546f, 0.2766f, 0.2986f, 0.3222f, 0.3457f, 0.3701f, 0.3952f,
+  0.4209f, 0.4471f, 0.4734f, 0.5f, 0.5266f, 0.5529f, 0.5791f, 0.6048f,
+  0.6299f, 0.6543f, 0.6778f, 0.7014f, 0.7234f, 0.7454f, 0.766f, 0.7866f,
+  0.8072f, 0.8263f, 0.8439f, 0.8616f, 0.1605f, 0.1781f, 0.1972f, 0.2178f,
+  0.2384f, 0.259f, 0.281f, 0.3031f, 0.3251f, 0.3486f, 0.373f, 0.3977f,
+  0.4228f, 0.4483f, 0.4741f, 0.5f, 0.5259f, 0.5517f, 0.5772f, 0.6023f,
+  0.627f, 0.6514f, 0.6749f, 0.6969f, 0.719f, 0.741f, 0.7616f, 0.7822f,
+  0.8028f, 0.8219f, 0.8395f, 0.1664f, 0.1825f, 0.2016f, 0.2208f, 0.2413f,
+  0.2619f, 0.284f, 0.306f, 0.3295f, 0.3516f, 0.3758f, 0.3999f, 0.4246f,
+  0.4496f, 0.4747f, 0.5f, 0.5253f, 0.5504f, 0.5754f, 0.6001f, 0.6242f,
+  0.6484f, 0.6705f, 0.694f, 0.716f, 0.7381f, 0.7587f, 0.7792f, 0.7984f,
+  0.8175f, 0.8336f, 0.1899f, 0.2061f, 0.2252f, 0.2457f, 0.2663f, 0.2869f,
+  0.3089f, 0.3325f, 0.3549f, 0.3783f, 0.4021f, 0.4262f, 0.4506f, 0.4753f,
+  0.5f, 0.5247f, 0.5494f, 0.5738f, 0.5979f, 0.6217f, 0.6451f, 0.6675f,
+  0.6911f, 0.7131f, 0.7337f, 0.7543f, 0.7748f, 0.7939f, 0.8101f, 0.2296f,
+  0.2501f, 0.2693f, 0.2913f, 0.3133f, 0.3354f, 0.3576f, 0.3805f, 0.404f,
+  0.4277f, 0.4516f, 0.4757f, 0.5f, 0.5243f, 0.5484f, 0.5723f, 0.596f,
+  0.6195f, 0.6424f, 0.6646f, 0.6867f, 0.7087f, 0.7307f, 0.7499f, 0.7704f,
+  0.2546f, 0.2737f, 0.2942f, 0.3163f, 0.3383f, 0.3599f, 0.3827f, 0.4058f,
+  0.429f, 0.4525f, 0.4762f, 0.5f, 0.5238f, 0.5475f, 0.571f, 0.5942f,
+  0.6173f, 0.6401f, 0.6617f, 0.6837f, 0.7058f, 0.7263f, 0.7454f, 0.2986f,
+  0.3192f, 0.3413f, 0.3624f, 0.3848f, 0.4074f, 0.4303f, 0.4534f, 0.4766f,
+  0.5f, 0.5234f, 0.5466f, 0.5697f, 0.5926f, 0.6152f, 0.6376f, 0.6587f,
+  0.6808f, 0.7014f, 0.3251f, 0.3442f, 0.3654f, 0.3871f, 0.4092f, 0.4317f,
+  0.4543f, 0.4771f, 0.5f, 0.5229f, 0.5457f, 0.5683f, 0.5908f, 0.6129f,
+  0.6346f, 0.6558f, 0.6749f,
+};
+static const float osvr_display_mesh_built_in_osvr_hdk13_v1_eye0_to_x[] = {
+  1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f,
+  1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f,
+  1.0f, 0.9745f, 0.9745f, 0.9745f, 0.9745f, 0.9745f, 0.9745f, 0.9745f,
+  0.9745f, 0.9745f, 0.9745f, 0.9745f, 0.9745f, 0.9745f, 0.9745f, 0.9745f,
+  0.9745f, 0.9745f, 0.9745f, 0.9745f, 0.9503f, 0.9503f, 0.9503f, 0.9503f,
+  0.9503f, 0.9503f, 0.9503f, 0.9503f, 0.9503f, 0.9503f, 0.9503f, 0.9503f,
+  0.9503f, 0.9503f, 0.9503f, 0.9503f, 0.9503f, 0.9503f, 0.9503f, 0.9503f,
+  0.9503f, 0.9503f, 0.9503f, 0.9257f, 0.9257f, 0.9257f, 0.9257f, 0.9257f,
+  0.9257f, 0.9257f, 0.9257f, 0.9257f, 0.9257f, 0.9257f, 0.9257f, 0.9257f,
+  0.9257f, 0.9257f, 0.9257f, 0.9257f, 0.9257f, 0.9257f, 0.9257f, 0.9257f,
+  0.9257f, 0.9257f, 0.9257f, 0.9257f, 0.8994f, 0.8994f, 0.8994f, 0.8994f,
+  0.8994f, 0.8994f, 0.8994f, 0.8994f, 0.8994f, 0.8994f, 0.8994f, 0.8994f,
+  0.8994f, 0.8994f, 0.8994f, 0.8994f, 0.8994f, 0.8994f, 0.8994f, 0.8994f,
+  0.8994f, 0.8994f, 0.8994f, 0.8994f, 0.8994f, 0.8994f, 0.8994f, 0.8994f,
+  0.8994f, 0.8745f, 0.8745f, 0.8745f, 0.8745f, 0.8745f, 0.8745f, 0.8745f,
+  0.8745f, 0.8745f, 0.8745f, 0.8745f, 0.8745f, 0.8745f, 0.8745f, 0.8745f,
+  0.8745f, 0.8745f, 0.8745f, 0.8745f, 0.8745f, 0.8745f, 0.8745f, 0.8745f,
+  0.8745f, 0.8745f, 0.8745f, 0.8745f, 0.8745f, 0.8745f, 0.8745f, 0.8745f,
+  0.8495f, 0.8495f, 0.8495f, 0.8495f, 0.8495f, 0.8495f, 0.8495f, 0.8495f,
+  0.8495f, 0.8495f, 0.8495f, 0.8495f, 0.8495f, 0.8495f, 0.8495f, 0.8495f,
+  0.8495f, 0.8495f, 0.8495f, 0.8495f, 0.8495f, 0.8495f, 0.8495f, 0.8495f,
+  0.8495f, 0.8495f, 0.8495f, 0.8495f, 0.8495f, 0.8495f, 0.8495f, 0.8245f,
+  0.8245f, 0.8245f, 0.8245f, 0.8245f, 0.8245f, 0.8245f, 0.8245f, 0.8245f,
+  0.8245f, 0.8245f, 0.8245f, 0.8245f, 0.8245f, 0.8245f, 0.8245f, 0.8245f,
+  0.8245f, 0.8245f, 0.8245f, 0.8245f, 0.8245f, 0.8245f, 0.8245f, 0.8245f,
+  0.8245f, 0.8245f, 0.8245f, 0.8245f, 0.8245f, 0.8245f, 0.8245f, 0.8245f,
+  0.8005f, 0.8005f, 0.8005f, 0.8005f, 0.8005f, 0.8005f, 0.8005f, 0.8005f,
+  0.8005f, 0.8005f, 0.8005f, 0.8005f, 0.8005f, 0.8005f, 0.8005f, 0.8005f,
+  0.8005f, 0.8005f, 0.8005f, 0.8005f, 0.8005f, 0.8005f, 0.8005f, 0.8005f,
+  0.8005f, 0.8005f, 0.8005f, 0.8005f, 0.8005f, 0.8005f, 0.8005f, 0.8005f,
+  0.8005f, 0.8005f, 0.8005f, 0.7754f, 0.7754f, 0.7754f, 0.7754f, 0.7754f,
+  0.7754f, 0.7754f, 0.7754f, 0.7754f, 0.7754f, 0.7754f, 0.7754f, 0.7754f,
+  0.7754f, 0.7754f, 0.7754f, 0.7754f, 0.7754f, 0.7754f, 0.7754f, 0.7754f,
+  0.7754f, 0.7754f, 0.7754f, 0.7754f, 0.7754f, 0.7754f, 0.7754f, 0.7754f,
+  0.7754f, 0.7754f, 0.7754f, 0.7754f, 0.7754f, 0.7754f, 0.7503f, 0.7503f,
+  0.7503f, 0.7503f, 0.7503f, 0.7503f, 0.7503f, 0.7503f, 0.7503f, 0.7503f,
+  0.7503f, 0.7503f, 0.7503f, 0.7503f, 0.7503f, 0.7503f, 0.7503f, 0.7503f,
+  0.7503f, 0.7503f, 0.7503f, 0.7503f, 0.7503f, 0.7503f, 0.7503f, 0.7503f,
+  0.7503f, 0.7503f, 0.7503f, 0.7503f, 0.7503f, 0.7503f, 0.7503f, 0.7503f,
+  0.7503f, 0.7503f, 0.7503f, 0.7503f, 0.7252f, 0.7252f, 0.7252f, 0.7252f,
+  0.7252f, 0.7252f, 0.7252f, 0.7252f, 0.7252f, 0.7252f, 0.7252f, 0.7252f,
+  0.7252f, 0.7252f, 0.7252f, 0.7252f, 0.7252f, 0.7252f, 0.7252f, 0.7252f,
+  0.7252f, 0.7252f, 0.7252f, 0.7252f, 0.7252f, 0.7252f, 0.7252f, 0.7252f,
+  0.7252f, 0.7252f, 0.7252f, 0.7252f, 0.7252f, 0.7252f, 0.7252f, 0.7252f,
+  0.7252f, 0.7252f, 0.7252f, 0.7252f, 0.7252f, 0.7f, 0.7f, 0.7f,
+  0.7f, 0.7f, 0.7f, 0.7f, 0.7f, 0.7f, 0.7f, 0.7f,
+  0.7f, 0.7f, 0.7f, 0.7f, 0.7f, 0.7f, 0.7f, 0.7f,
+  0.7f, 0.7f, 0.7f, 0.7f, 0.7f, 0.7f, 0.7f, 0.7f,
+  0.7f, 0.7f, 0.7f, 0.7f, 0.7f, 0.7f, 0.7f, 0.7f,
+  0.7f, 0.7f, 0.7f, 0.7f, 0.7f, 0.7f, 0.6748f, 0.6748f,
+  0.6748f, 0.6748f, 0.6748f, 0.6748f, 0.6748f, 0.6748f, 0.6748f, 0.6748f,
+  0.6748f, 0.6748f, 0.6748f, 0.6748f, 0.6748f, 0.6748f, 0.6748f, 0.6748f,
+  0.6748f, 0.6748f, 0.6748f, 0.6748f, 0.6748f, 0.6748f, 0.6748f, 0.6748f,
+  0.6748f, 0.6748f, 0.6748f, 0.6748f, 0.6748f, 0.6748f, 0.6748f, 0.6748f,
+  0.6748f, 0.6748f, 0.6748f, 0.6748f, 0.6748f, 0.6748f, 0.6748f, 0.6504f,
+  0.6504f, 0.6504f, 0.6504f, 0.6504f, 0.6504f, 0.6504f, 0.6504f, 0.6504f,
+  0.6504f, 0.6504f, 0.6504f, 0.6504f, 0.6504f, 0.6504f, 0.6504f, 0.6504f,
+  0.6504f, 0.6504f, 0.6504f, 0.6504f, 0.6504f, 0.6504f, 0.6504f, 0.6504f,
+  0.6504f, 0.6504f, 0.6504f, 0.6504f, 0.6504f, 0.6504f, 0.6504f, 0.6504f,
+  0.6504f, 0.6504f, 0.6504f, 0.6504f, 0.6504f, 0.6504f, 0.6504f, 0.6504f,
+  0.6249f, 0.6249f, 0.6249f, 0.6249f, 0.6249f, 0.6249f, 0.6249f, 0.6249f,
+  0.6249f, 0.6249f, 0.6249f, 0.6249f, 0.6249f, 0.6249f, 0.6249f, 0.6249f,
+  0.6249f, 0.6249f, 0.6249f, 0.6249f, 0.6249f, 0.6249f, 0.6249f, 0.6249f,
+  0.6249f, 0.6249f, 0.6249f, 0.6249f, 0.6249f, 0.6249f, 0.6249f, 0.6249f,
+  0.6249f, 0.6249f, 0.6249f, 0.6249f, 0.6249f, 0.6249f, 0.6249f, 0.6249f,
+  0.6249f, 0.6f, 0.6f, 0.6f, 0.6f, 0.6f, 0.6f, 0.6f,
+  0.6f, 0.6f, 0.6f, 0.6f, 0.6f, 0.6f, 0.6f, 0.6f,
+  0.6f, 0.6f, 0.6f, 0.6f, 0.6f, 0.6f, 0.6f, 0.6f,
+  0.6f, 0.6f, 0.6f, 0.6f, 0.6f, 0.6f, 0.6f, 0.6f,
+  0.6f, 0.6f, 0.6f, 0.6f, 0.6f, 0.6f, 0.6f, 0.6f,
+  0.6f, 0.6f, 0.575f, 0.575f, 0.575f, 0.575f, 0.575f, 0.575f,
+  0.575f, 0.575f, 0.575f, 0.575f, 0.575f, 0.575f, 0.575f, 0.575f,
+  0.575f, 0.575f, 0.575f, 0.575f, 0.575f, 0.575f, 0.575f, 0.575f,
+  0.575f, 0.575f, 0.575f, 0.575f, 0.575f, 0.575f, 0.575f, 0.575f,
+  0.575f, 0.575f, 0.575f, 0.575f, 0.575f, 0.575f, 0.575f, 0.575f,
+  0.575f, 0.575f, 0.575f, 0.55f, 0.55f, 0.55f, 0.55f, 0.55f,
+  0.55f, 0.55f, 0.55f, 0.55f, 0.55f, 0.55f, 0.55f, 0.55f,
+  0.55f, 0.55f, 0.55f, 0.55f, 0.55f, 0.55f, 0.55f, 0.55f,
+  0.55f, 0.55f, 0.55f, 0.55f, 0.55f, 0.55f, 0.55f, 0.55f,
+  0.55f, 0.55f, 0.55f, 0.55f, 0.55f, 0.55f, 0.55f, 0.55f,
+  0.55f, 0.55f, 0.55f, 0.55f, 0.525f, 0.525f, 0.525f, 0.525f,
+  0.525f, 0.525f, 0.525f, 0.525f, 0.525f, 0.525f, 0.525f, 0.525f,
+  0.525f, 0.525f, 0.525f, 0.525f, 0.525f, 0.525f, 0.525f, 0.525f,
+  0.525f, 0.525f, 0.525f, 0.525f, 0.525f, 0.525f, 0.525f, 0.525f,
+  0.525f, 0.525f, 0.525f, 0.525f, 0.525f, 0.525f, 0.525f, 0.525f,
+  0.525f, 0.525f, 0.525f, 0.525f, 0.525f, 0.5f, 0.5f, 0.5f,
+  0.5f, 0.5f, 0.5f, 0.5f, 0.5f, 0.5f, 0.5f, 0.5f,
+  0.5f, 0.5f, 0.5f, 0.5f, 0.5f, 0.5f, 0.5f, 0.5f,
+  0.5f, 0.5f, 0.5f, 0.5f, 0.5f, 0.5f, 0.5f, 0.5f,
+  0.5f, 0.5f, 0.5f, 0.5f, 0.5f, 0.5f, 0.5f, 0.5f,
+  0.5f, 0.5f, 0.5f, 0.5f, 0.5f, 0.5f, 0.475f, 0.475f,
+  0.475f, 0.475f, 0.475f, 0.475f, 0.475f, 0.475f, 0.475f, 0.475f,
+  0.475f, 0.475f, 0.475f, 0.475f, 0.475f, 0.475f, 0.475f, 0.475f,
+  0.475f, 0.475f, 0.475f, 0.475f, 0.475f, 0.475f, 0.475f, 0.475f,
+  0.475f, 0.475f, 0.475f, 0.475f, 0.475f, 0.475f, 0.475f, 0.475f,
+  0.475f, 0.475f, 0.475f, 0.475f, 0.475f, 0.475f, 0.475f, 0.45f,
+  0.45f, 0.45f, 0.45f, 0.45f, 0.45f, 0.45f, 0.45f, 0.45f,
+  0.45f, 0.45f, 0.45f, 0.45f, 0.45f, 0.45f, 0.45f, 0.45f,
+  0.45f, 0.45f, 0.45f, 0.45f, 0.45f, 0.45f, 0.45f, 0.45f,
+  0.45f, 0.45f, 0.45f, 0.45f, 0.45f, 0.45f, 0.45f, 0.45f,
+  0.45f, 0.45f, 0.45f, 0.45f, 0.45f, 0.45f, 0.45f, 0.45f,
+  0.425f, 0.425f, 0.425f, 0.425f, 0.425f, 0.425f, 0.425f, 0.425f,
+  0.425f, 0.425f, 0.425f, 0.425f, 0.425f, 0.425f, 0.425f, 0.425f,
+  0.425f, 0.425f, 0.425f, 0.425f, 0.425f, 0.425f, 0.425f, 0.425f,
+  0.425f, 0.425f, 0.425f, 0.425f, 0.425f, 0.425f, 0.425f, 0.425f,
+  0.425f, 0.425f, 0.425f, 0.425f, 0.425f, 0.425f, 0.425f, 0.425f,
+  0.425f, 0.4f, 0.4f, 0.4f, 0.4f, 0.4f, 0.4f, 0.4f,
+  0.4f, 0.4f, 0.4f, 0.4f, 0.4f, 0.4f, 0.4f, 0.4f,
+  0.4f, 0.4f, 0.4f, 0.4f, 0.4f, 0.4f, 0.4f, 0.4f,
+  0.4f, 0.4f, 0.4f, 0.4f, 0.4f, 0.4f, 0.4f, 0.4f,
+  0.4f, 0.4f, 0.4f, 0.4f, 0.4f, 0.4f, 0.4f, 0.4f,
+  0.4f, 0.4f, 0.3751f, 0.3751f, 0.3751f, 0.3751f, 0.3751f, 0.3751f,
+  0.3751f, 0.3751f, 0.3751f, 0.3751f, 0.3751f, 0.3751f, 0.3751f, 0.3751f,
+  0.3751f, 0.3751f, 0.3751f, 0.3751f, 0.3751f, 0.3751f, 0.3751f, 0.3751f,
+  0.3751f, 0.3751f, 0.3751f, 0.3751f, 0.3751f, 0.3751f, 0.3751f, 0.3751f,
+  0.3751f, 0.3751f, 0.3751f, 0.3751f, 0.3751f, 0.3751f, 0.3751f, 0.3751f,
+  0.3751f, 0.3751f, 0.3751f, 0.3496f, 0.3496f, 0.3496f, 0.3496f, 0.3496f,
+  0.3496f, 0.3496f, 0.3496f, 0.3496f, 0.3496f, 0.3496f, 0.3496f, 0.3496f,
+  0.3496f, 0.3496f, 0.3496f, 0.3496f, 0.3496f, 0.3496f, 0.3496f, 0.3496f,
+  0.3496f, 0.3496f, 0.3496f, 0.3496f, 0.3496f, 0.3496f, 0.3496f, 0.3496f,
+  0.3496f, 0.3496f, 0.3496f, 0.3496f, 0.3496f, 0.3496f, 0.3496f, 0.3496f,
+  0.3496f, 0.3496f, 0.3496f, 0.3496f, 0.3252f, 0.3252f, 0.3252f, 0.3252f,
+  0.3252f, 0.3252f, 0.3252f, 0.3252f, 0.3252f, 0.3252f, 0.3252f, 0.3252f,
+  0.3252f, 0.3252f, 0.3252f, 0.3252f, 0.3252f, 0.3252f, 0.3252f, 0.3252f,
+  0.3252f, 0.3252f, 0.3252f, 0.3252f, 0.3252f, 0.3252f, 0.3252f, 0.3252f,
+  0.3252f, 0.3252f, 0.3252f, 0.3252f, 0.3252f, 0.3252f, 0.3252f, 0.3252f,
+  0.3252f, 0.3252f, 0.3252f, 0.3252f, 0.3252f, 0.3f, 0.3f, 0.3f,
+  0.3f, 0.3f, 0.3f, 0.3f, 0.3f, 0.3f, 0.3f, 0.3f,
+  0.3f, 0.3f, 0.3f, 0.3f, 0.3f, 0.3f, 0.3f, 0.3f,
+  0.3f, 0.3f, 0.3f, 0.3f, 0.3f, 0.3f, 0.3f, 0.3f,
+  0.3f, 0.3f, 0.3f, 0.3f, 0.3f, 0.3f, 0.3f, 0.3f,
+  0.3f, 0.3f, 0.3f, 0.3f, 0.3f, 0.3f, 0.2748f, 0.2748f,
+  0.2748f, 0.2748f, 0.2748f, 0.2748f, 0.2748f, 0.2748f, 0.2748f, 0.2748f,
+  0.2748f, 0.2748f, 0.2748f, 0.2748f, 0.2748f, 0.2748f, 0.2748f, 0.2748f,
+  0.2748f, 0.2748f, 0.2748f, 0.2748f, 0.2748f, 0.2748f, 0.2748f, 0.2748f,
+  0.2748f, 0.2748f, 0.2748f, 0.2748f, 0.2748f, 0.2748f, 0.2748f, 0.2748f,
+  0.2748f, 0.2748f, 0.2748f, 0.2748f, 0.2748f, 0.2748f, 0.2748f, 0.2497f,
+  0.2497f, 0.2497f, 0.2497f, 0.2497f, 0.2497f, 0.2497f, 0.2497f, 0.2497f,
+  0.2497f, 0.2497f, 0.2497f, 0.2497f, 0.2497f, 0.2497f, 0.2497f, 0.2497f,
+  0.2497f, 0.2497f, 0.2497f, 0.2497f, 0.2497f, 0.2497f, 0.2497f, 0.2497f,
+  0.2497f, 0.2497f, 0.2497f, 0.2497f, 0.2497f, 0.2497f, 0.2497f, 0.2497f,
+  0.2497f, 0.2497f, 0.2497f, 0.2497f, 0.2497f, 0.2246f, 0.2246f, 0.2246f,
+  0.2246f, 0.2246f, 0.2246f, 0.2246f, 0.2246f, 0.2246f, 0.2246f, 0.2246f,
+  0.2246f, 0.2246f, 0.2246f, 0.2246f, 0.2246f, 0.2246f, 0.2246f, 0.2246f,
+  0.2246f, 0.2246f, 0.2246f, 0.2246f, 0.2246f, 0.2246f, 0.2246f, 0.2246f,
+  0.2246f, 0.2246f, 0.2246f, 0.2246f, 0.2246f, 0.2246f, 0.2246f, 0.2246f,
+  0.1995f, 0.1995f, 0.1995f, 0.1995f, 0.1995f, 0.1995f, 0.1995f, 0.1995f,
+  0.1995f, 0.1995f, 0.1995f, 0.1995f, 0.1995f, 0.1995f, 0.1995f, 0.1995f,
+  0.1995f, 0.1995f, 0.1995f, 0.1995f, 0.1995f, 0.1995f, 0.1995f, 0.1995f,
+  0.1995f, 0.1995f, 0.1995f, 0.1995f, 0.1995f, 0.1995f, 0.1995f, 0.1995f,
+  0.1995f, 0.1995f, 0.1995f, 0.1755f, 0.1755f, 0.1755f, 0.1755f, 0.1755f,
+  0.1755f, 0.1755f, 0.1755f, 0.1755f, 0.1755f, 0.1755f, 0.1755f, 0.1755f,
+  0.1755f, 0.1755f, 0.1755f, 0.1755f, 0.1755f, 0.1755f, 0.1755f, 0.1755f,
+  0.1755f, 0.1755f, 0.1755f, 0.1755f, 0.1755f, 0.1755f, 0.1755f, 0.1755f,
+  0.1755f, 0.1755f, 0.1755f, 0.1755f, 0.1505f, 0.1505f, 0.1505f, 0.1505f,
+  0.1505f, 0.1505f, 0.1505f, 0.1505f, 0.1505f, 0.1505f, 0.1505f, 0.1505f,
+  0.1505f, 0.1505f, 0.1505f, 0.1505f, 0.1505f, 0.1505f, 0.1505f, 0.1505f,
+  0.1505f, 0.1505f, 0.1505f, 0.1505f, 0.1505f, 0.1505f, 0.1505f, 0.1505f,
+  0.1505f, 0.1505f, 0.1505f, 0.1255f, 0.1255f, 0.1255f, 0.1255f, 0.1255f,
+  0.1255f, 0.1255f, 0.1255f, 0.1255f, 0.1255f, 0.1255f, 0.1255f, 0.1255f,
+  0.1255f, 0.1255f, 0.1255f, 0.1255f, 0.1255f, 0.1255f, 0.1255f, 0.1255f,
+  0.1255f, 0.1255f, 0.1255f, 0.1255f, 0.1255f, 0.1255f, 0.1255f, 0.1255f,
+  0.1255f, 0.1255f, 0.1006f, 0.1006f, 0.1006f, 0.1006f, 0.1006f, 0.1006f,
+  0.1006f, 0.1006f, 0.1006f, 0.1006f, 0.1006f, 0.1006f, 0.1006f, 0.1006f,
+  0.1006f, 0.1006f, 0.1006f, 0.1006f, 0.1006f, 0.1006f, 0.1006f, 0.1006f,
+  0.1006f, 0.1006f, 0.1006f, 0.1006f, 0.1006f, 0.1006f, 0.1006f, 0.07432f,
+  0.07432f, 0.07432f, 0.07432f, 0.07432f, 0.07432f, 0.07432f, 0.07432f, 0.07432f,
+  0.07432f, 0.07432f, 0.07432f, 0.07432f, 0.07432f, 0.07432f, 0.07432f, 0.07432f,
+  0.07432f, 0.07432f, 0.07432f, 0.07432f, 0.07432f, 0.07432f, 0.07432f, 0.07432f,
+  0.04974f, 0.04974f, 0.04974f, 0.04974f, 0.04974f, 0.04974f, 0.04974f, 0.04974f,
+  0.04974f, 0.04974f, 0.04974f, 0.04974f, 0.04974f, 0.04974f, 0.04974f, 0.04974f,
+  0.04974f, 0.04974f, 0.04974f, 0.04974f, 0.04974f, 0.04974f, 0.04974f, 0.02551f,
+  0.02551f, 0.02551f, 0.02551f, 0.02551f, 0.02551f, 0.02551f, 0.02551f, 0.02551f,
+  0.02551f, 0.02551f, 0.02551f, 0.02551f, 0.02551f, 0.02551f, 0.02551f, 0.02551f,
+  0.02551f, 0.02551f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f,
+};
+static const float osvr_display_mesh_built_in_osvr_hdk13_v1_eye0_to_y[] = {
+  0.3f, 0.3252f, 0.3496f, 0.3751f, 0.4f, 0.425f, 0.45f, 0.475f,
+  0.5f, 0.525f, 0.55f, 0.575f, 0.6f, 0.6249f, 0.6504f, 0.6748f,
+  0.7f, 0.2748f, 0.3f, 0.3252f, 0.3496f, 0.3751f, 0.4f, 0.425f,
+  0.45f, 0.475f, 0.5f, 0.525f, 0.55f, 0.575f, 0.6f, 0.6249f,
+  0.6504f, 0.6748f, 0.7f, 0.7252f, 0.2246f, 0.2497f, 0.2748f, 0.3f,
+  0.3252f, 0.3496f, 0.3751f, 0.4f, 0.425f, 0.45f, 0.475f, 0.5f,
+  0.525f, 0.55f, 0.575f, 0.6f, 0.6249f, 0.6504f, 0.6748f, 0.7f,
+  0.7252f, 0.7503f, 0.7754f, 0.1995f, 0.2246f, 0.2497f, 0.2748f, 0.3f,
+  0.3252f, 0.3496f, 0.3751f, 0.4f, 0.425f, 0.45f, 0.475f, 0.5f,
+  0.525f, 0.55f, 0.575f, 0.6f, 0.6249f, 0.6504f, 0.6748f, 0.7f,
+  0.7252f, 0.7503f, 0.7754f, 0.8005f, 0.1505f, 0.1755f, 0.1995f, 0.2246f,
+  0.2497f, 0.2748f, 0.3f, 0.3252f, 0.3496f, 0.3751f, 0.4f, 0.425f,
+  0.45f, 0.475f, 0.5f, 0.525f, 0.55f, 0.575f, 0.6f, 0.6249f,
+  0.6504f, 0.6748f, 0.7f, 0.7252f, 0.7503f, 0.7754f, 0.8005f, 0.8245f,
+  0.8495f, 0.1255f, 0.1505f, 0.1755f, 0.1995f, 0.2246f, 0.2497f, 0.2748f,
+  0.3f, 0.3252f, 0.3496f, 0.3751f, 0.4f, 0.425f, 0.45f, 0.475f,
+  0.5f, 0.525f, 0.55f, 0.575f, 0.6f, 0.6249f, 0.6504f, 0.6748f,
+  0.7f, 0.7252f, 0.7503f, 0.7754f, 0.8005f, 0.8245f, 0.8495f, 0.8745f,
+  0.1255f, 0.1505f, 0.1755f, 0.1995f, 0.2246f, 0.2497f, 0.2748f, 0.3f,
+  0.3252f, 0.3496f, 0.3751f, 0.4f, 0.425f, 0.45f, 0.475f, 0.5f,
+  0.525f, 0.55f, 0.575f, 0.6f, 0.6249f, 0.6504f, 0.6748f, 0.7f,
+  0.7252f, 0.7503f, 0.7754f, 0.8005f, 0.8245f, 0.8495f, 0.8745f, 0.1006f,
+  0.1255f, 0.1505f, 0.1755f, 0.1995f, 0.2246f, 0.2497f, 0.2748f, 0.3f,
+  0.3252f, 0.3496f, 0.3751f, 0.4f, 0.425f, 0.45f, 0.475f, 0.5f,
+  0.525f, 0.55f, 0.575f, 0.6f, 0.6249f, 0.6504f, 0.6748f, 0.7f,
+  0.7252f, 0.7503f, 0.7754f, 0.8005f, 0.8245f, 0.8495f, 0.8745f, 0.8994f,
+  0.07432f, 0.1006f, 0.1255f, 0.1505f, 0.1755f, 0.1995f, 0.2246f, 0.2497f,
+  0.2748f, 0.3f, 0.3252f, 0.3496f, 0.3751f, 0.4f, 0.425f, 0.45f,
+  0.475f, 0.5f, 0.525f, 0.55f, 0.575f, 0.6f, 0.6249f, 0.6504f,
+  0.6748f, 0.7f, 0.7252f, 0.7503f, 0.7754f, 0.8005f, 0.8245f, 0.8495f,
+  0.8745f, 0.8994f, 0.9257f, 0.07432f, 0.1006f, 0.1255f, 0.1505f, 0.1755f,
+  0.1995f, 0.2246f, 0.2497f, 0.2748f, 0.3f, 0.3252f, 0.3496f, 0.3751f,
+  0.4f, 0.425f, 0.45f, 0.475f, 0.5f, 0.525f, 0.55f, 0.575f,
+  0.6f, 0.6249f, 0.6504f, 0.6748f, 0.7f, 0.7252f, 0.7503f, 0.7754f,
+  0.8005f, 0.8245f, 0.8495f, 0.8745f, 0.8994f, 0.9257f, 0.07432f, 0.1006f,
+  0.1255f, 0.1505f, 0.1755f, 0.1995f, 0.2246f, 0.2497f, 0.2748f, 0.3f,
+  0.3252f, 0.3496f, 0.3751f, 0.4f, 0.425f, 0.45f, 0.475f, 0.5f,
+  0.525f, 0.55f, 0.575f, 0.6f, 0.6249f, 0.6504f, 0.6748f, 0.7f,
+  0.7252f, 0.7503f, 0.7754f, 0.8005f, 0.8245f, 0.8495f, 0.8745f, 0.8994f,
+  0.9257f, 0.9503f, 0.9745f, 1.0f, 0.0f, 0.02551f, 0.04974f, 0.07432f,
+  0.1006f, 0.1255f, 0.1505f, 0.1755f, 0.1995f, 0.2246f, 0.2497f, 0.2748f,
+  0.3f, 0.3252f, 0.3496f, 0.3751f, 0.4f, 0.425f, 0.45f, 0.475f,
+  0.5f, 0.525f, 0.55f, 0.575f, 0.6f, 0.6249f, 0.6504f, 0.6748f,
+  0.7f, 0.7252f, 0.7503f, 0.7754f, 0.8005f, 0.8245f, 0.8495f, 0.8745f,
+  0.8994f, 0.9257f, 0.9503f, 0.9745f, 1.0f, 0.0f, 0.02551f, 0.04974f,
+  0.07432f, 0.1006f, 0.1255f, 0.1505f, 0.1755f, 0.1995f, 0.2246f, 0.2497f,
+  0.2748f, 0.3f, 0.3252f, 0.3496f, 0.3751f, 0.4f, 0.425f, 0.45f,
+  0.475f, 0.5f, 0.525f, 0.55f, 0.575f, 0.6f, 0.6249f, 0.6504f,
+  0.6748f, 0.7f, 0.7252f, 0.7503f, 0.7754f, 0.8005f, 0.8245f, 0.8495f,
+  0.8745f, 0.8994f, 0.9257f, 0.9503f, 0.9745f, 1.0f, 0.0f, 0.02551f,
+  0.04974f, 0.07432f, 0.1006f, 0.1255f, 0.1505f, 0.1755f, 0.1995f, 0.2246f,
+  0.2497f, 0.2748f, 0.3f, 0.3252f, 0.3496f, 0.3751f, 0.4f, 0.425f,
+  0.45f, 0.475f, 0.5f, 0.525f, 0.55f, 0.575f, 0.6f, 0.6249f,
+  0.6504f, 0.6748f, 0.7f, 0.7252f, 0.7503f, 0.7754f, 0.8005f, 0.8245f,
+  0.8495f, 0.8745f, 0.8994f, 0.9257f, 0.9503f, 0.9745f, 1.0f, 0.0f,
+  0.02551f, 0.04974f, 0.07432f, 0.1006f, 0.1255f, 0.1505f, 0.1755f, 0.1995f,
+  0.2246f, 0.2497f, 0.2748f, 0.3f, 0.3252f, 0.3496f, 0.3751f, 0.4f,
+  0.425f, 0.45f, 0.475f, 0.5f, 0.525f, 0.55f, 0.575f, 0.6f,
+  0.6249f, 0.6504f, 0.6748f, 0.7f, 0.7252f, 0.7503f, 0.7754f, 0.8005f,
+  0.8245f, 0.8495f, 0.8745f, 0.8994f, 0.9257f, 0.9503f, 0.9745f, 1.0f,
+  0.0f, 0.02551f, 0.04974f, 0.07432f, 0.1006f, 0.1255f, 0.1505f, 0.1755f,
+  0.1995f, 0.2246f, 0.2497f, 0.2748f, 0.3f, 0.3252f, 0.3496f, 0.3751f,
+  0.4f, 0.425f, 0.45f, 0.475f, 0.5f, 0.525f, 0.55f, 0.575f,
+  0.6f, 0.6249f, 0.6504f, 0.6748f, 0.7f, 0.7252f, 0.7503f, 0.7754f,
+  0.8005f, 0.8245f, 0.8495f, 0.8745f, 0.8994f, 0.9257f, 0.9503f, 0.9745f,
+  1.0f, 0.0f, 0.02551f, 0.04974f, 0.07432f, 0.1006f, 0.1255f, 0.1505f,
+  0.1755f, 0.1995f, 0.2246f, 0.2497f, 0.2748f, 0.3f, 0.3252f, 0.3496f,
+  0.3751f, 0.4f, 0.425f, 0.45f, 0.475f, 0.5f, 0.525f, 0.55f,
+  0.575f, 0.6f, 0.6249f, 0.6504f, 0.6748f, 0.7f, 0.7252f, 0.7503f,
+  0.7754f, 0.8005f, 0.8245f, 0.8495f, 0.8745f, 0.8994f, 0.9257f, 0.9503f,
+  0.9745f, 1.0f, 0.0f, 0.02551f, 0.04974f, 0.07432f, 0.1006f, 0.1255f,
+  0.1505f, 0.1755f, 0.1995f, 0.2246f, 0.2497f, 0.2748f, 0.3f, 0.3252f,
+  0.3496f, 0.3751f, 0.4f, 0.425f, 0.45f, 0.475f, 0.5f, 0.525f,
+  0.55f, 0.575f, 0.6f, 0.6249f, 0.6504f, 0.6748f, 0.7f, 0.7252f,
+  0.7503f, 0.7754f, 0.8005f, 0.8245f, 0.8495f, 0.8745f, 0.8994f, 0.9257f,
+  0.9503f, 0.9745f, 1.0f, 0.0f, 0.02551f, 0.04974f, 0.07432f, 0.1006f,
+  0.1255f, 0.1505f, 0.1755f, 0.1995f, 0.2246f, 0.2497f, 0.2748f, 0.3f,
+  0.3252f, 0.3496f, 0.3751f, 0.4f, 0.425f, 0.45f, 0.475f, 0.5f,
+  0.525f, 0.55f, 0.575f, 0.6f, 0.6249f, 0.6504f, 0.6748f, 0.7f,
+  0.7252f, 0.7503f, 0.7754f, 0.8005f, 0.8245f, 0.8495f, 0.8745f, 0.8994f,
+  0.9257f, 0.9503f, 0.9745f, 1.0f, 0.0f, 0.02551f, 0.04974f, 0.07432f,
+  0.1006f, 0.1255f, 0.1505f, 0.1755f, 0.1995f, 0.2246f, 0.2497f, 0.2748f,
+  0.3f, 0.3252f, 0.3496f, 0.3751f, 0.4f, 0.425f, 0.45f, 0.475f,
+  0.5f, 0.525f, 0.55f, 0.575f, 0.6f, 0.6249f, 0.6504f, 0.6748f,
+  0.7f, 0.7252f, 0.7503f, 0.7754f, 0.8005f, 0.8245f, 0.8495f, 0.8745f,
+  0.8994f, 0.9257f, 0.9503f, 0.9745f, 1.0f, 0.0f, 0.02551f, 0.04974f,
+  0.07432f, 0.1006f, 0.1255f, 0.1505f, 0.1755f, 0.1995f, 0.2246f, 0.2497f,
+  0.2748f, 0.3f, 0.3252f, 0.3496f, 0.3751f, 0.4f, 0.425f, 0.45f,
+  0.475f, 0.5f, 0.525f, 0.55f, 0.575f, 0.6f, 0.6249f, 0.6504f,
+  0.6748f, 0.7f, 0.7252f, 0.7503f, 0.7754f, 0.8005f, 0.8245f, 0.8495f,
+  0.8745f, 0.8994f, 0.9257f, 0.9503f, 0.9745f, 1.0f, 0.0f, 0.02551f,
+  0.04974f, 0.07432f, 0.1006f, 0.1255f, 0.1505f, 0.1755f, 0.1995f, 0.2246f,
+  0.2497f, 0.2748f, 0.3f, 0.3252f, 0.3496f, 0.3751f, 0.4f, 0.425f,
+  0.45f, 0.475f, 0.5f, 0.525f, 0.55f, 0.575f, 0.6f, 0.6249f,
+  0.6504f, 0.6748f, 0.7f, 0.7252f, 0.7503f, 0.7754f, 0.8005f, 0.8245f,
+  0.8495f, 0.8745f, 0.8994f, 0.9257f, 0.9503f, 0.9745f, 1.0f, 0.0f,
+  0.02551f, 0.04974f, 0.07432f, 0.1006f, 0.1255f, 0.1505f, 0.1755f, 0.1995f,
+  0.2246f, 0.2497f, 0.2748f, 0.3f, 0.3252f, 0.3496f, 0.3751f, 0.4f,
+  0.425f, 0.45f, 0.475f, 0.5f, 0.525f, 0.55f, 0.575f, 0.6f,
+  0.6249f, 0.6504f, 0.6748f, 0.7f, 0.7252f, 0.7503f, 0.7754f, 0.8005f,
+  0.8245f, 0.8495f, 0.8745f, 0.8994f, 0.9257f, 0.9503f, 0.9745f, 1.0f,
+  0.0f, 0.02551f, 0.04974f, 0.07432f, 0.1006f, 0.1255f, 0.1505f, 0.1755f,
+  0.1995f, 0.2246f, 0.2497f, 0.2748f, 0.3f, 0.3252f, 0.3496f, 0.3751f,
+  0.4f, 0.425f, 0.45f, 0.475f, 0.5f, 0.525f, 0.55f, 0.575f,
+  0.6f, 0.6249f, 0.6504f, 0.6748f, 0.7f, 0.7252f, 0.7503f, 0.7754f,
+  0.8005f, 0.8245f, 0.8495f, 0.8745f, 0.8994f, 0.9257f, 0.9503f, 0.9745f,
+  1.0f, 0.0f, 0.02551f, 0.04974f, 0.07432f, 0.1006f, 0.1255f, 0.1505f,
+  0.1755f, 0.1995f, 0.2246f, 0.2497f, 0.2748f, 0.3f, 0.3252f, 0.3496f,
+  0.3751f, 0.4f, 0.425f, 0.45f, 0.475f, 0.5f, 0.525f, 0.55f,
+  0.575f, 0.6f, 0.6249f, 0.6504f, 0.6748f, 0.7f, 0.7252f, 0.7503f,
+  0.7754f, 0.8005f, 0.8245f, 0.8495f, 0.8745f, 0.8994f, 0.9257f, 0.9503f,
+  0.9745f, 1.0f, 0.0f, 0.02551f, 0.04974f, 0.07432f, 0.1006f, 0.1255f,
+  0.1505f, 0.1755f, 0.1995f, 0.2246f, 0.2497f, 0.2748f, 0.3f, 0.3252f,
+  0.3496f, 0.3751f, 0.4f, 0.425f, 0.45f, 0.475f, 0.5f, 0.525f,
+  0.55f, 0.575f, 0.6f, 0.6249f, 0.6504f, 0.6748f, 0.7f, 0.7252f,
+  0.7503f, 0.7754f, 0.8005f, 0.8245f, 0.8495f, 0.8745f, 0.8994f, 0.9257f,
+  0.9503f, 0.9745f, 1.0f, 0.0f, 0.02551f, 0.04974f, 0.07432f, 0.1006f,
+  0.1255f, 0.1505f, 0.1755f, 0.1995f, 0.2246f, 0.2497f, 0.2748f, 0.3f,
+  0.3252f, 0.3496f, 0.3751f, 0.4f, 0.425f, 0.45f, 0.475f, 0.5f,
+  0.525f, 0.55f, 0.575f, 0.6f, 0.6249f, 0.6504f, 0.6748f, 0.7f,
+  0.7252f, 0.7503f, 0.7754f, 0.8005f, 0.8245f, 0.8495f, 0.8745f, 0.8994f,
+  0.9257f, 0.9503f, 0.9745f, 1.0f, 0.0f, 0.02551f, 0.04974f, 0.07432f,
+  0.1006f, 0.1255f, 0.1505f, 0.1755f, 0.1995f, 0.2246f, 0.2497f, 0.2748f,
+  0.3f, 0.3252f, 0.3496f, 0.3751f, 0.4f, 0.425f, 0.45f, 0.475f,
+  0.5f, 0.525f, 0.55f, 0.575f, 0.6f, 0.6249f, 0.6504f, 0.6748f,
+  0.7f, 0.7252f, 0.7503f, 0.7754f, 0.8005f, 0.8245f, 0.8495f, 0.8745f,
+  0.8994f, 0.9257f, 0.9503f, 0.9745f, 1.0f, 0.0f, 0.02551f, 0.04974f,
+  0.07432f, 0.1006f, 0.1255f, 0.1505f, 0.1755f, 0.1995f, 0.2246f, 0.2497f,
+  0.2748f, 0.3f, 0.3252f, 0.3496f, 0.3751f, 0.4f, 0.425f, 0.45f,
+  0.475f, 0.5f, 0.525f, 0.55f, 0.575f, 0.6f, 0.6249f, 0.6504f,
+  0.6748f, 0.7f, 0.7252f, 0.7503f, 0.7754f, 0.8005f, 0.8245f, 0.8495f,
+  0.8745f, 0.8994f, 0.9257f, 0.9503f, 0.9745f, 1.0f, 0.0f, 0.02551f,
+  0.04974f, 0.07432f, 0.1006f, 0.1255f, 0.1505f, 0.1755f, 0.1995f, 0.2246f,
+  0.2497f, 0.2748f, 0.3f, 0.3252f, 0.3496f, 0.3751f, 0.4f, 0.425f,
+  0.45f, 0.475f, 0.5f, 0.525f, 0.55f, 0.575f, 0.6f, 0.6249f,
+  0.6504f, 0.6748f, 0.7f, 0.7252f, 0.7503f, 0.7754f, 0.8005f, 0.8245f,
+  0.8495f, 0.8745f, 0.8994f, 0.9257f, 0.9503f, 0.9745f, 1.0f, 0.0f,
+  0.02551f, 0.04974f, 0.07432f, 0.1006f, 0.1255f, 0.1505f, 0.1755f, 0.1995f,
+  0.2246f, 0.2497f, 0.2748f, 0.3f, 0.3252f, 0.3496f, 0.3751f, 0.4f,
+  0.425f, 0.45f, 0.475f, 0.5f, 0.525f, 0.55f, 0.575f, 0.6f,
+  0.6249f, 0.6504f, 0.6748f, 0.7f, 0.7252f, 0.7503f, 0.7754f, 0.8005f,
+  0.8245f, 0.8495f, 0.8745f, 0.8994f, 0.9257f, 0.07432f, 0.1006f, 0.1255f,
+  0.1505f, 0.1755f, 0.1995f, 0.2246f, 0.2497f, 0.2748f, 0.3f, 0.3252f,
+  0.3496f, 0.3751f, 0.4f, 0.425f, 0.45f, 0.475f, 0.5f, 0.525f,
+  0.55f, 0.575f, 0.6f, 0.6249f, 0.6504f, 0.6748f, 0.7f, 0.7252f,
+  0.7503f, 0.7754f, 0.8005f, 0.8245f, 0.8495f, 0.8745f, 0.8994f, 0.9257f,
+  0.07432f, 0.1006f, 0.1255f, 0.1505f, 0.1755f, 0.1995f, 0.2246f, 0.2497f,
+  0.2748f, 0.3f, 0.3252f, 0.3496f, 0.3751f, 0.4f, 0.425f, 0.45f,
+  0.475f, 0.5f, 0.525f, 0.55f, 0.575f, 0.6f, 0.6249f, 0.6504f,
+  0.6748f, 0.7f, 0.7252f, 0.7503f, 0.7754f, 0.8005f, 0.8245f, 0.8495f,
+  0.8745f, 0.8994f, 0.9257f, 0.1006f, 0.1255f, 0.1505f, 0.1755f, 0.1995f,
+  0.2246f, 0.2497f, 0.2748f, 0.3f, 0.3252f, 0.3496f, 0.3751f, 0.4f,
+  0.425f, 0.45f, 0.475f, 0.5f, 0.525f, 0.55f, 0.575f, 0.6f,
+  0.6249f, 0.6504f, 0.6748f, 0.7f, 0.7252f, 0.7503f, 0.7754f, 0.8005f,
+  0.8245f, 0.8495f, 0.8745f, 0.8994f, 0.1255f, 0.1505f, 0.1755f, 0.1995f,
+  0.2246f, 0.2497f, 0.2748f, 0.3f, 0.3252f, 0.3496f, 0.3751f, 0.4f,
+  0.425f, 0.45f, 0.475f, 0.5f, 0.525f, 0.55f, 0.575f, 0.6f,
+  0.6249f, 0.6504f, 0.6748f, 0.7f, 0.7252f, 0.7503f, 0.7754f, 0.8005f,
+  0.8245f, 0.8495f, 0.8745f, 0.1255f, 0.1505f, 0.1755f, 0.1995f, 0.2246f,
+  0.2497f, 0.2748f, 0.3f, 0.3252f, 0.3496f, 0.3751f, 0.4f, 0.425f,
+  0.45f, 0.475f, 0.5f, 0.525f, 0.55f, 0.575f, 0.6f, 0.6249f,
+  0.6504f, 0.6748f, 0.7f, 0.7252f, 0.7503f, 0.7754f, 0.8005f, 0.8245f,
+  0.8495f, 0.8745f, 0.1505f, 0.1755f, 0.1995f, 0.2246f, 0.2497f, 0.2748f,
+  0.3f, 0.3252f, 0.3496f, 0.3751f, 0.4f, 0.425f, 0.45f, 0.475f,
+  0.5f, 0.525f, 0.55f, 0.575f, 0.6f, 0.6249f, 0.6504f, 0.6748f,
+  0.7f, 0.7252f, 0.7503f, 0.7754f, 0.8005f, 0.8245f, 0.8495f, 0.1995f,
+  0.2246f, 0.2497f, 0.2748f, 0.3f, 0.3252f, 0.3496f, 0.3751f, 0.4f,
+  0.425f, 0.45f, 0.475f, 0.5f, 0.525f, 0.55f, 0.575f, 0.6f,
+  0.6249f, 0.6504f, 0.6748f, 0.7f, 0.7252f, 0.7503f, 0.7754f, 0.8005f,
+  0.2246f, 0.2497f, 0.2748f, 0.3f, 0.3252f, 0.3496f, 0.3751f, 0.4f,
+  0.425f, 0.45f, 0.475f, 0.5f, 0.525f, 0.55f, 0.575f, 0.6f,
+  0.6249f, 0.6504f, 0.6748f, 0.7f, 0.7252f, 0.7503f, 0.7754f, 0.2748f,
+  0.3f, 0.3252f, 0.3496f, 0.3751f, 0.4f, 0.425f, 0.45f, 0.475f,
+  0.5f, 0.525f, 0.55f, 0.575f, 0.6f, 0.6249f, 0.6504f, 0.6748f,
+  0.7f, 0.7252f, 0.3f, 0.3252f, 0.3496f, 0.3751f, 0.4f, 0.425f,
+  0.45f, 0.475f, 0.5f, 0.525f, 0.55f, 0.575f, 0.6f, 0.6249f,
+  0.6504f, 0.6748f, 0.7f,
+};
+static const float osvr_display_mesh_built_in_osvr_hdk13_v1_eye1_from_x[] = {
+  0.03638f, 0.02976f, 0.0248f, 0.02149f, 0.01819f, 0.01653f, 0.01488f, 0.01488f,
+  0.01488f, 0.01488f, 0.01488f, 0.01653f, 0.01819f, 0.02149f, 0.0248f, 0.02976f,
+  0.03638f, 0.05126f, 0.0463f, 0.04299f, 0.03968f, 0.03638f, 0.03472f, 0.03307f,
+  0.03142f, 0.03142f, 0.02976f, 0.03142f, 0.03142f, 0.03307f, 0.03472f, 0.03638f,
+  0.03968f, 0.04299f, 0.0463f, 0.05126f, 0.07771f, 0.0711f, 0.06614f, 0.06283f,
+  0.05952f, 0.05622f, 0.05456f, 0.05126f, 0.0496f, 0.0496f, 0.04795f, 0.04795f,
+  0.04795f, 0.0496f, 0.0496f, 0.05126f, 0.05456f, 0.05622f, 0.05952f, 0.06283f,
+  0.06614f, 0.0711f, 0.07771f, 0.09921f, 0.09425f, 0.08929f, 0.08433f, 0.08102f,
+  0.07771f, 0.0744f, 0.07275f, 0.06944f, 0.06779f, 0.06779f, 0.06614f, 0.06614f,
+  0.06614f, 0.06779f, 0.06779f, 0.06944f, 0.07275f, 0.0744f, 0.07771f, 0.08102f,
+  0.08433f, 0.08929f, 0.09425f, 0.09921f, 0.1306f, 0.1224f, 0.1174f, 0.1124f,
+  0.1075f, 0.1042f, 0.1009f, 0.09755f, 0.09425f, 0.09094f, 0.08929f, 0.08598f,
+  0.08433f, 0.08433f, 0.08433f, 0.08433f, 0.08433f, 0.08598f, 0.08929f, 0.09094f,
+  0.09425f, 0.09755f, 0.1009f, 0.1042f, 0.1075f, 0.1124f, 0.1174f, 0.1224f,
+  0.1306f, 0.1538f, 0.1472f, 0.1422f, 0.1372f, 0.1323f, 0.129f, 0.124f,
+  0.1207f, 0.1174f, 0.1124f, 0.1091f, 0.1075f, 0.1042f, 0.1025f, 0.1025f,
+  0.1025f, 0.1025f, 0.1025f, 0.1042f, 0.1075f, 0.1091f, 0.1124f, 0.1174f,
+  0.1207f, 0.124f, 0.129f, 0.1323f, 0.1372f, 0.1422f, 0.1472f, 0.1538f,
+  0.172f, 0.167f, 0.162f, 0.1571f, 0.1538f, 0.1488f, 0.1455f, 0.1405f,
+  0.1372f, 0.1323f, 0.129f, 0.1257f, 0.124f, 0.1224f, 0.1207f, 0.1207f,
+  0.1207f, 0.1224f, 0.124f, 0.1257f, 0.129f, 0.1323f, 0.1372f, 0.1405f,
+  0.1455f, 0.1488f, 0.1538f, 0.1571f, 0.162f, 0.167f, 0.172f, 0.1984f,
+  0.1935f, 0.1885f, 0.1835f, 0.1802f, 0.1753f, 0.1703f, 0.1653f, 0.1604f,
+  0.1571f, 0.1521f, 0.1488f, 0.1455f, 0.1438f, 0.1422f, 0.1405f, 0.1405f,
+  0.1405f, 0.1422f, 0.1438f, 0.1455f, 0.1488f, 0.1521f, 0.1571f, 0.1604f,
+  0.1653f, 0.1703f, 0.1753f, 0.1802f, 0.1835f, 0.1885f, 0.1935f, 0.1984f,
+  0.2249f, 0.2199f, 0.2149f, 0.2116f, 0.2067f, 0.2017f, 0.1968f, 0.1918f,
+  0.1868f, 0.1819f, 0.1786f, 0.1736f, 0.1703f, 0.167f, 0.1653f, 0.1637f,
+  0.162f, 0.162f, 0.162f, 0.1637f, 0.1653f, 0.167f, 0.1703f, 0.1736f,
+  0.1786f, 0.1819f, 0.1868f, 0.1918f, 0.1968f, 0.2017f, 0.2067f, 0.2116f,
+  0.2149f, 0.2199f, 0.2249f, 0.248f, 0.2431f, 0.2381f, 0.2348f, 0.2298f,
+  0.2249f, 0.2199f, 0.2149f, 0.21f, 0.205f, 0.2001f, 0.1968f, 0.1935f,
+  0.1901f, 0.1885f, 0.1868f, 0.1852f, 0.1852f, 0.1852f, 0.1868f, 0.1885f,
+  0.1901f, 0.1935f, 0.1968f, 0.2001f, 0.205f, 0.21f, 0.2149f, 0.2199f,
+  0.2249f, 0.2298f, 0.2348f, 0.2381f, 0.2431f, 0.248f, 0.2695f, 0.2662f,
+  0.2612f, 0.2579f, 0.253f, 0.248f, 0.2431f, 0.2381f, 0.2331f, 0.2282f,
+  0.2249f, 0.2216f, 0.2183f, 0.2149f, 0.2133f, 0.2116f, 0.21f, 0.21f,
+  0.21f, 0.2116f, 0.2133f, 0.2149f, 0.2183f, 0.2216f, 0.2249f, 0.2282f,
+  0.2331f, 0.2381f, 0.2431f, 0.248f, 0.253f, 0.2579f, 0.2612f, 0.2662f,
+  0.2695f, 0.2745f, 0.2794f, 0.2894f, 0.3092f, 0.3026f, 0.2976f, 0.2943f,
+  0.2894f, 0.286f, 0.2827f, 0.2778f, 0.2728f, 0.2679f, 0.2629f, 0.2579f,
+  0.2546f, 0.2497f, 0.2464f, 0.2431f, 0.2414f, 0.2381f, 0.2364f, 0.2364f,
+  0.2348f, 0.2364f, 0.2364f, 0.2381f, 0.2414f, 0.2431f, 0.2464f, 0.2497f,
+  0.2546f, 0.2579f, 0.2629f, 0.2679f, 0.2728f, 0.2778f, 0.2827f, 0.286f,
+  0.2894f, 0.2943f, 0.2976f, 0.3026f, 0.3092f, 0.3307f, 0.3257f, 0.3224f,
+  0.3191f, 0.3142f, 0.3108f, 0.3075f, 0.3026f, 0.2976f, 0.2927f, 0.2894f,
+  0.2844f, 0.2811f, 0.2778f, 0.2745f, 0.2712f, 0.2679f, 0.2646f, 0.2629f,
+  0.2629f, 0.2629f, 0.2629f, 0.2629f, 0.2646f, 0.2679f, 0.2712f, 0.2745f,
+  0.2778f, 0.2811f, 0.2844f, 0.2894f, 0.2927f, 0.2976f, 0.3026f, 0.3075f,
+  0.3108f, 0.3142f, 0.3191f, 0.3224f, 0.3257f, 0.3307f, 0.3538f, 0.3505f,
+  0.3472f, 0.3439f, 0.3406f, 0.3373f, 0.3323f, 0.329f, 0.3241f, 0.3208f,
+  0.3158f, 0.3125f, 0.3092f, 0.3059f, 0.3026f, 0.2993f, 0.296f, 0.2943f,
+  0.2927f, 0.291f, 0.291f, 0.291f, 0.2927f, 0.2943f, 0.296f, 0.2993f,
+  0.3026f, 0.3059f, 0.3092f, 0.3125f, 0.3158f, 0.3208f, 0.3241f, 0.329f,
+  0.3323f, 0.3373f, 0.3406f, 0.3439f, 0.3472f, 0.3505f, 0.3538f, 0.3773f,
+  0.3743f, 0.3717f, 0.3689f, 0.3659f, 0.3621f, 0.3588f, 0.3555f, 0.3522f,
+  0.3472f, 0.3439f, 0.3406f, 0.3373f, 0.334f, 0.3307f, 0.3274f, 0.3257f,
+  0.3257f, 0.3241f, 0.3241f, 0.3241f, 0.3241f, 0.3241f, 0.3257f, 0.3257f,
+  0.3274f, 0.3307f, 0.334f, 0.3373f, 0.3406f, 0.3439f, 0.3472f, 0.3522f,
+  0.3555f, 0.3588f, 0.3621f, 0.3659f, 0.3689f, 0.3717f, 0.3743f, 0.3773f,
+  0.402f, 0.3995f, 0.3972f, 0.3948f, 0.3922f, 0.3894f, 0.3862f, 0.3829f,
+  0.3796f, 0.3763f, 0.3733f, 0.3705f, 0.3676f, 0.3644f, 0.3621f, 0.3588f,
+  0.3588f, 0.3588f, 0.3604f, 0.3604f, 0.3604f, 0.3604f, 0.3604f, 0.3588f,
+  0.3588f, 0.3588f, 0.3621f, 0.3644f, 0.3676f, 0.3705f, 0.3733f, 0.3763f,
+  0.3796f, 0.3829f, 0.3862f, 0.3894f, 0.3922f, 0.3948f, 0.3972f, 0.3995f,
+  0.402f, 0.4269f, 0.4249f, 0.4231f, 0.4211f, 0.419f, 0.4165f, 0.414f,
+  0.4112f, 0.4086f, 0.4059f, 0.4034f, 0.401f, 0.3985f, 0.3958f, 0.3937f,
+  0.3929f, 0.3934f, 0.3945f, 0.396f, 0.397f, 0.3973f, 0.397f, 0.396f,
+  0.3945f, 0.3934f, 0.3929f, 0.3937f, 0.3958f, 0.3985f, 0.401f, 0.4034f,
+  0.4059f, 0.4086f, 0.4112f, 0.414f, 0.4165f, 0.419f, 0.4211f, 0.4231f,
+  0.4249f, 0.4269f, 0.4522f, 0.4507f, 0.4494f, 0.4479f, 0.4461f, 0.4443f,
+  0.4423f, 0.4401f, 0.438f, 0.436f, 0.4342f, 0.4322f, 0.4302f, 0.4282f,
+  0.4271f, 0.4271f, 0.4282f, 0.4297f, 0.4312f, 0.4322f, 0.4325f, 0.4322f,
+  0.4312f, 0.4297f, 0.4282f, 0.4271f, 0.4271f, 0.4282f, 0.4302f, 0.4322f,
+  0.4342f, 0.436f, 0.438f, 0.4401f, 0.4423f, 0.4443f, 0.4461f, 0.4479f,
+  0.4494f, 0.4507f, 0.4522f, 0.4777f, 0.4767f, 0.4759f, 0.4747f, 0.4735f,
+  0.4724f, 0.4709f, 0.4696f, 0.4681f, 0.4668f, 0.4654f, 0.4641f, 0.4628f,
+  0.4615f, 0.461f, 0.4615f, 0.4625f, 0.4638f, 0.4649f, 0.4658f, 0.4661f,
+  0.4658f, 0.4649f, 0.4638f, 0.4625f, 0.4615f, 0.461f, 0.4615f, 0.4628f,
+  0.4641f, 0.4654f, 0.4668f, 0.4681f, 0.4696f, 0.4709f, 0.4724f, 0.4735f,
+  0.4747f, 0.4759f, 0.4767f, 0.4777f, 0.5033f, 0.5028f, 0.5025f, 0.5018f,
+  0.5013f, 0.5007f, 0.5f, 0.4992f, 0.4985f, 0.4979f, 0.4972f, 0.4965f,
+  0.4957f, 0.4952f, 0.495f, 0.4954f, 0.496f, 0.4969f, 0.4975f, 0.498f,
+  0.4982f, 0.498f, 0.4975f, 0.4969f, 0.496f, 0.4954f, 0.495f, 0.4952f,
+  0.4957f, 0.4965f, 0.4972f, 0.4979f, 0.4985f, 0.4992f, 0.5f, 0.5007f,
+  0.5013f, 0.5018f, 0.5025f, 0.5028f, 0.5033f, 0.5291f, 0.5291f, 0.5291f,
+  0.5291f, 0.5291f, 0.5291f, 0.5291f, 0.5291f, 0.5291f, 0.5291f, 0.5291f,
+  0.5291f, 0.5291f, 0.5291f, 0.5291f, 0.5291f, 0.5291f, 0.5291f, 0.5291f,
+  0.5291f, 0.5291f, 0.5291f, 0.5291f, 0.5291f, 0.5291f, 0.5291f, 0.5291f,
+  0.5291f, 0.5291f, 0.5291f, 0.5291f, 0.5291f, 0.5291f, 0.5291f, 0.5291f,
+  0.5291f, 0.5291f, 0.5291f, 0.5291f, 0.5291f, 0.5291f, 0.5549f, 0.5554f,
+  0.5557f, 0.5564f, 0.5569f, 0.5575f, 0.5582f, 0.559f, 0.5597f, 0.5604f,
+  0.561f, 0.5617f, 0.5625f, 0.563f, 0.5632f, 0.5628f, 0.5622f, 0.5613f,
+  0.5607f, 0.5602f, 0.56f, 0.5602f, 0.5607f, 0.5613f, 0.5622f, 0.5628f,
+  0.5632f, 0.563f, 0.5625f, 0.5617f, 0.561f, 0.5604f, 0.5597f, 0.559f,
+  0.5582f, 0.5575f, 0.5569f, 0.5564f, 0.5557f, 0.5554f, 0.5549f, 0.5805f,
+  0.5815f, 0.5823f, 0.5835f, 0.5847f, 0.5858f, 0.5873f, 0.5886f, 0.5901f,
+  0.5914f, 0.5928f, 0.5941f, 0.5954f, 0.5967f, 0.5972f, 0.5967f, 0.5957f,
+  0.5944f, 0.5933f, 0.5924f, 0.5921f, 0.5924f, 0.5933f, 0.5944f, 0.5957f,
+  0.5967f, 0.5972f, 0.5967f, 0.5954f, 0.5941f, 0.5928f, 0.5914f, 0.5901f,
+  0.5886f, 0.5873f, 0.5858f, 0.5847f, 0.5835f, 0.5823f, 0.5815f, 0.5805f,
+  0.606f, 0.6075f, 0.6088f, 0.6103f, 0.6121f, 0.6139f, 0.6159f, 0.6181f,
+  0.6202f, 0.6222f, 0.624f, 0.626f, 0.628f, 0.63f, 0.6311f, 0.6311f,
+  0.63f, 0.6285f, 0.627f, 0.626f, 0.6257f, 0.626f, 0.627f, 0.6285f,
+  0.63f, 0.6311f, 0.6311f, 0.63f, 0.628f, 0.626f, 0.624f, 0.6222f,
+  0.6202f, 0.6181f, 0.6159f, 0.6139f, 0.6121f, 0.6103f, 0.6088f, 0.6075f,
+  0.606f, 0.6313f, 0.6333f, 0.6351f, 0.6371f, 0.6392f, 0.6417f, 0.6442f,
+  0.647f, 0.6496f, 0.6523f, 0.6548f, 0.6572f, 0.6597f, 0.6624f, 0.6645f,
+  0.6653f, 0.6648f, 0.6637f, 0.6622f, 0.6612f, 0.6609f, 0.6612f, 0.6622f,
+  0.6637f, 0.6648f, 0.6653f, 0.6645f, 0.6624f, 0.6597f, 0.6572f, 0.6548f,
+  0.6523f, 0.6496f, 0.647f, 0.6442f, 0.6417f, 0.6392f, 0.6371f, 0.6351f,
+  0.6333f, 0.6313f, 0.6563f, 0.6587f, 0.661f, 0.6634f, 0.666f, 0.6688f,
+  0.672f, 0.6753f, 0.6786f, 0.6819f, 0.6849f, 0.6877f, 0.6906f, 0.6938f,
+  0.6961f, 0.6994f, 0.6994f, 0.6994f, 0.6978f, 0.6978f, 0.6978f, 0.6978f,
+  0.6978f, 0.6994f, 0.6994f, 0.6994f, 0.6961f, 0.6938f, 0.6906f, 0.6877f,
+  0.6849f, 0.6819f, 0.6786f, 0.6753f, 0.672f, 0.6688f, 0.666f, 0.6634f,
+  0.661f, 0.6587f, 0.6563f, 0.6809f, 0.6839f, 0.6865f, 0.6893f, 0.6923f,
+  0.6961f, 0.6994f, 0.7027f, 0.706f, 0.711f, 0.7143f, 0.7176f, 0.7209f,
+  0.7242f, 0.7275f, 0.7308f, 0.7325f, 0.7325f, 0.7341f, 0.7341f, 0.7341f,
+  0.7341f, 0.7341f, 0.7325f, 0.7325f, 0.7308f, 0.7275f, 0.7242f, 0.7209f,
+  0.7176f, 0.7143f, 0.711f, 0.706f, 0.7027f, 0.6994f, 0.6961f, 0.6923f,
+  0.6893f, 0.6865f, 0.6839f, 0.6809f, 0.7044f, 0.7077f, 0.711f, 0.7143f,
+  0.7176f, 0.7209f, 0.7259f, 0.7292f, 0.7341f, 0.7374f, 0.7424f, 0.7457f,
+  0.749f, 0.7523f, 0.7556f, 0.7589f, 0.7622f, 0.7639f, 0.7655f, 0.7672f,
+  0.7672f, 0.7672f, 0.7655f, 0.7639f, 0.7622f, 0.7589f, 0.7556f, 0.7523f,
+  0.749f, 0.7457f, 0.7424f, 0.7374f, 0.7341f, 0.7292f, 0.7259f, 0.7209f,
+  0.7176f, 0.7143f, 0.711f, 0.7077f, 0.7044f, 0.7275f, 0.7325f, 0.7358f,
+  0.7391f, 0.744f, 0.7474f, 0.7507f, 0.7556f, 0.7606f, 0.7655f, 0.7688f,
+  0.7738f, 0.7771f, 0.7804f, 0.7837f, 0.787f, 0.7903f, 0.7937f, 0.7953f,
+  0.7953f, 0.7953f, 0.7953f, 0.7953f, 0.7937f, 0.7903f, 0.787f, 0.7837f,
+  0.7804f, 0.7771f, 0.7738f, 0.7688f, 0.7655f, 0.7606f, 0.7556f, 0.7507f,
+  0.7474f, 0.744f, 0.7391f, 0.7358f, 0.7325f, 0.7275f, 0.749f, 0.7556f,
+  0.7606f, 0.7639f, 0.7688f, 0.7722f, 0.7755f, 0.7804f, 0.7854f, 0.7903f,
+  0.7953f, 0.8003f, 0.8036f, 0.8085f, 0.8118f, 0.8151f, 0.8168f, 0.8201f,
+  0.8218f, 0.8218f, 0.8234f, 0.8218f, 0.8218f, 0.8201f, 0.8168f, 0.8151f,
+  0.8118f, 0.8085f, 0.8036f, 0.8003f, 0.7953f, 0.7903f, 0.7854f, 0.7804f,
+  0.7755f, 0.7722f, 0.7688f, 0.7639f, 0.7606f, 0.7556f, 0.749f, 0.7688f,
+  0.7788f, 0.7837f, 0.7887f, 0.792f, 0.797f, 0.8003f, 0.8052f, 0.8102f,
+  0.8151f, 0.8201f, 0.8251f, 0.83f, 0.8333f, 0.8366f, 0.8399f, 0.8433f,
+  0.8449f, 0.8466f, 0.8482f, 0.8482f, 0.8482f, 0.8466f, 0.8449f, 0.8433f,
+  0.8399f, 0.8366f, 0.8333f, 0.83f, 0.8251f, 0.8201f, 0.8151f, 0.8102f,
+  0.8052f, 0.8003f, 0.797f, 0.792f, 0.7887f, 0.8102f, 0.8151f, 0.8201f,
+  0.8234f, 0.8284f, 0.8333f, 0.8383f, 0.8433f, 0.8482f, 0.8532f, 0.8581f,
+  0.8614f, 0.8647f, 0.8681f, 0.8697f, 0.8714f, 0.873f, 0.873f, 0.873f,
+  0.8714f, 0.8697f, 0.8681f, 0.8647f, 0.8614f, 0.8581f, 0.8532f, 0.8482f,
+  0.8433f, 0.8383f, 0.8333f, 0.8284f, 0.8234f, 0.8201f, 0.8151f, 0.8102f,
+  0.8333f, 0.8383f, 0.8433f, 0.8466f, 0.8515f, 0.8565f, 0.8614f, 0.8664f,
+  0.8714f, 0.8763f, 0.8796f, 0.8846f, 0.8879f, 0.8912f, 0.8929f, 0.8945f,
+  0.8962f, 0.8962f, 0.8962f, 0.8945f, 0.8929f, 0.8912f, 0.8879f, 0.8846f,
+  0.8796f, 0.8763f, 0.8714f, 0.8664f, 0.8614f, 0.8565f, 0.8515f, 0.8466f,
+  0.8433f, 0.8383f, 0.8333f, 0.8598f, 0.8647f, 0.8697f, 0.8747f, 0.878f,
+  0.8829f, 0.8879f, 0.8929f, 0.8978f, 0.9011f, 0.9061f, 0.9094f, 0.9127f,
+  0.9144f, 0.916f, 0.9177f, 0.9177f, 0.9177f, 0.916f, 0.9144f, 0.9127f,
+  0.9094f, 0.9061f, 0.9011f, 0.8978f, 0.8929f, 0.8879f, 0.8829f, 0.878f,
+  0.8747f, 0.8697f, 0.8647f, 0.8598f, 0.8862f, 0.8912f, 0.8962f, 0.9011f,
+  0.9044f, 0.9094f, 0.9127f, 0.9177f, 0.921f, 0.9259f, 0.9292f, 0.9325f,
+  0.9342f, 0.9358f, 0.9375f, 0.9375f, 0.9375f, 0.9358f, 0.9342f, 0.9325f,
+  0.9292f, 0.9259f, 0.921f, 0.9177f, 0.9127f, 0.9094f, 0.9044f, 0.9011f,
+  0.8962f, 0.8912f, 0.8862f, 0.9044f, 0.911f, 0.916f, 0.921f, 0.9259f,
+  0.9292f, 0.9342f, 0.9375f, 0.9408f, 0.9458f, 0.9491f, 0.9507f, 0.954f,
+  0.9557f, 0.9557f, 0.9557f, 0.9557f, 0.9557f, 0.954f, 0.9507f, 0.9491f,
+  0.9458f, 0.9408f, 0.9375f, 0.9342f, 0.9292f, 0.9259f, 0.921f, 0.916f,
+  0.911f, 0.9044f, 0.9276f, 0.9358f, 0.9408f, 0.9458f, 0.9507f, 0.954f,
+  0.9573f, 0.9606f, 0.964f, 0.9673f, 0.9689f, 0.9722f, 0.9739f, 0.9739f,
+  0.9739f, 0.9739f, 0.9739f, 0.9722f, 0.9689f, 0.9673f, 0.964f, 0.9606f,
+  0.9573f, 0.954f, 0.9507f, 0.9458f, 0.9408f, 0.9358f, 0.9276f, 0.959f,
+  0.964f, 0.9689f, 0.9739f, 0.9772f, 0.9805f, 0.9838f, 0.9854f, 0.9888f,
+  0.9904f, 0.9904f, 0.9921f, 0.9921f, 0.9921f, 0.9904f, 0.9904f, 0.9888f,
+  0.9854f, 0.9838f, 0.9805f, 0.9772f, 0.9739f, 0.9689f, 0.964f, 0.959f,
+  0.9805f, 0.9871f, 0.9921f, 0.9954f, 0.9987f, 1.002f, 1.004f, 1.007f,
+  1.009f, 1.009f, 1.01f, 1.01f, 1.01f, 1.009f, 1.009f, 1.007f,
+  1.004f, 1.002f, 0.9987f, 0.9954f, 0.9921f, 0.9871f, 0.9805f, 1.007f,
+  1.012f, 1.015f, 1.019f, 1.022f, 1.023f, 1.025f, 1.027f, 1.027f,
+  1.028f, 1.027f, 1.027f, 1.025f, 1.023f, 1.022f, 1.019f, 1.015f,
+  1.012f, 1.007f, 1.022f, 1.028f, 1.033f, 1.037f, 1.04f, 1.042f,
+  1.043f, 1.043f, 1.043f, 1.043f, 1.043f, 1.042f, 1.04f, 1.037f,
+  1.033f, 1.028f, 1.022f,
+};
+static const float osvr_display_mesh_built_in_osvr_hdk13_v1_eye1_from_y[] = {
+  0.3251f, 0.3442f, 0.3654f, 0.3871f, 0.4092f, 0.4317f, 0.4543f, 0.4771f,
+  0.5f, 0.5229f, 0.5457f, 0.5683f, 0.5908f, 0.6129f, 0.6346f, 0.6558f,
+  0.6749f, 0.2986f, 0.3192f, 0.3413f, 0.3624f, 0.3848f, 0.4074f, 0.4303f,
+  0.4534f, 0.4766f, 0.5f, 0.5234f, 0.5466f, 0.5697f, 0.5926f, 0.6152f,
+  0.6376f, 0.6587f, 0.6808f, 0.7014f, 0.2546f, 0.2737f, 0.2942f, 0.3163f,
+  0.3383f, 0.3599f, 0.3827f, 0.4058f, 0.429f, 0.4525f, 0.4762f, 0.5f,
+  0.5238f, 0.5475f, 0.571f, 0.5942f, 0.6173f, 0.6401f, 0.6617f, 0.6837f,
+  0.7058f, 0.7263f, 0.7454f, 0.2296f, 0.2501f, 0.2693f, 0.2913f, 0.3133f,
+  0.3354f, 0.3576f, 0.3805f, 0.404f, 0.4277f, 0.4516f, 0.4757f, 0.5f,
+  0.5243f, 0.5484f, 0.5723f, 0.596f, 0.6195f, 0.6424f, 0.6646f, 0.6867f,
+  0.7087f, 0.7307f, 0.7499f, 0.7704f, 0.1899f, 0.2061f, 0.2252f, 0.2457f,
+  0.2663f, 0.2869f, 0.3089f, 0.3325f, 0.3549f, 0.3783f, 0.4021f, 0.4262f,
+  0.4506f, 0.4753f, 0.5f, 0.5247f, 0.5494f, 0.5738f, 0.5979f, 0.6217f,
+  0.6451f, 0.6675f, 0.6911f, 0.7131f, 0.7337f, 0.7543f, 0.7748f, 0.7939f,
+  0.8101f, 0.1664f, 0.1825f, 0.2016f, 0.2208f, 0.2413f, 0.2619f, 0.284f,
+  0.306f, 0.3295f, 0.3516f, 0.3758f, 0.3999f, 0.4246f, 0.4496f, 0.4747f,
+  0.5f, 0.5253f, 0.5504f, 0.5754f, 0.6001f, 0.6242f, 0.6484f, 0.6705f,
+  0.694f, 0.716f, 0.7381f, 0.7587f, 0.7792f, 0.7984f, 0.8175f, 0.8336f,
+  0.1605f, 0.1781f, 0.1972f, 0.2178f, 0.2384f, 0.259f, 0.281f, 0.3031f,
+  0.3251f, 0.3486f, 0.373f, 0.3977f, 0.4228f, 0.4483f, 0.4741f, 0.5f,
+  0.5259f, 0.5517f, 0.5772f, 0.6023f, 0.627f, 0.6514f, 0.6749f, 0.6969f,
+  0.719f, 0.741f, 0.7616f, 0.7822f, 0.8028f, 0.8219f, 0.8395f, 0.1384f,
+  0.1561f, 0.1737f, 0.1928f, 0.2134f, 0.234f, 0.2546f, 0.2766f, 0.2986f,
+  0.3222f, 0.3457f, 0.3701f, 0.3952f, 0.4209f, 0.4471f, 0.4734f, 0.5f,
+  0.5266f, 0.5529f, 0.5791f, 0.6048f, 0.6299f, 0.6543f, 0.6778f, 0.7014f,
+  0.7234f, 0.7454f, 0.766f, 0.7866f, 0.8072f, 0.8263f, 0.8439f, 0.8616f,
+  0.1164f, 0.134f, 0.1517f, 0.1693f, 0.1899f, 0.209f, 0.2296f, 0.2501f,
+  0.2722f, 0.2942f, 0.3178f, 0.3427f, 0.3671f, 0.3929f, 0.419f, 0.4458f,
+  0.4728f, 0.5f, 0.5272f, 0.5542f, 0.581f, 0.6071f, 0.6329f, 0.6573f,
+  0.6822f, 0.7058f, 0.7278f, 0.7499f, 0.7704f, 0.791f, 0.8101f, 0.8307f,
+  0.8483f, 0.866f, 0.8836f, 0.112f, 0.1296f, 0.1473f, 0.1664f, 0.1855f,
+  0.2046f, 0.2252f, 0.2457f, 0.2678f, 0.2898f, 0.3148f, 0.3383f, 0.3642f,
+  0.3905f, 0.4173f, 0.4446f, 0.4722f, 0.5f, 0.5278f, 0.5554f, 0.5827f,
+  0.6095f, 0.6358f, 0.6617f, 0.6852f, 0.7102f, 0.7322f, 0.7543f, 0.7748f,
+  0.7954f, 0.8145f, 0.8336f, 0.8527f, 0.8704f, 0.888f, 0.1091f, 0.1252f,
+  0.1443f, 0.162f, 0.1811f, 0.2002f, 0.2208f, 0.2413f, 0.2634f, 0.2869f,
+  0.3104f, 0.3354f, 0.3616f, 0.3883f, 0.4156f, 0.4434f, 0.4716f, 0.5f,
+  0.5284f, 0.5566f, 0.5844f, 0.6117f, 0.6384f, 0.6646f, 0.6896f, 0.7131f,
+  0.7366f, 0.7587f, 0.7792f, 0.7998f, 0.8189f, 0.838f, 0.8557f, 0.8748f,
+  0.8909f, 0.9071f, 0.9203f, 0.9262f, 0.06349f, 0.07378f, 0.08848f, 0.1046f,
+  0.1223f, 0.1399f, 0.159f, 0.1767f, 0.1958f, 0.2163f, 0.2369f, 0.259f,
+  0.2825f, 0.3075f, 0.3325f, 0.3591f, 0.3861f, 0.4139f, 0.4422f, 0.471f,
+  0.5f, 0.529f, 0.5578f, 0.5861f, 0.6139f, 0.6409f, 0.6675f, 0.6925f,
+  0.7175f, 0.741f, 0.7631f, 0.7837f, 0.8042f, 0.8233f, 0.841f, 0.8601f,
+  0.8777f, 0.8954f, 0.9115f, 0.9262f, 0.9365f, 0.05761f, 0.06937f, 0.08554f,
+  0.1017f, 0.1193f, 0.137f, 0.1546f, 0.1723f, 0.1914f, 0.2119f, 0.2325f,
+  0.256f, 0.2795f, 0.3045f, 0.3295f, 0.3564f, 0.3839f, 0.4121f, 0.4411f,
+  0.4703f, 0.5f, 0.5297f, 0.5589f, 0.5879f, 0.6161f, 0.6436f, 0.6705f,
+  0.6955f, 0.7205f, 0.744f, 0.7675f, 0.7881f, 0.8086f, 0.8277f, 0.8454f,
+  0.863f, 0.8807f, 0.8983f, 0.9145f, 0.9306f, 0.9424f, 0.0532f, 0.06643f,
+  0.0826f, 0.09877f, 0.1164f, 0.134f, 0.1517f, 0.1693f, 0.1884f, 0.2075f,
+  0.2296f, 0.2516f, 0.2766f, 0.3016f, 0.3266f, 0.3536f, 0.3815f, 0.4103f,
+  0.4399f, 0.4699f, 0.5f, 0.5301f, 0.5601f, 0.5897f, 0.6185f, 0.6464f,
+  0.6734f, 0.6984f, 0.7234f, 0.7484f, 0.7704f, 0.7925f, 0.8116f, 0.8307f,
+  0.8483f, 0.866f, 0.8836f, 0.9012f, 0.9174f, 0.9336f, 0.9468f, 0.05026f,
+  0.06349f, 0.07966f, 0.09583f, 0.1135f, 0.1296f, 0.1473f, 0.1649f, 0.184f,
+  0.2046f, 0.2266f, 0.2487f, 0.2737f, 0.2986f, 0.3236f, 0.3516f, 0.3796f,
+  0.4093f, 0.4394f, 0.4697f, 0.5f, 0.5303f, 0.5606f, 0.5907f, 0.6204f,
+  0.6484f, 0.6764f, 0.7014f, 0.7263f, 0.7513f, 0.7734f, 0.7954f, 0.816f,
+  0.8351f, 0.8527f, 0.8704f, 0.8865f, 0.9042f, 0.9203f, 0.9365f, 0.9497f,
+  0.04733f, 0.06202f, 0.07819f, 0.09436f, 0.1105f, 0.1267f, 0.1443f, 0.162f,
+  0.1811f, 0.2016f, 0.2237f, 0.2457f, 0.2707f, 0.2957f, 0.3207f, 0.3486f,
+  0.3789f, 0.4093f, 0.4399f, 0.47f, 0.5f, 0.53f, 0.5601f, 0.5907f,
+  0.6211f, 0.6514f, 0.6793f, 0.7043f, 0.7293f, 0.7543f, 0.7763f, 0.7984f,
+  0.8189f, 0.838f, 0.8557f, 0.8733f, 0.8895f, 0.9056f, 0.9218f, 0.938f,
+  0.9527f, 0.04586f, 0.06055f, 0.07525f, 0.09289f, 0.1091f, 0.1252f, 0.1414f,
+  0.159f, 0.1781f, 0.1987f, 0.2208f, 0.2443f, 0.2678f, 0.2928f, 0.3192f,
+  0.3486f, 0.3793f, 0.4103f, 0.4408f, 0.4706f, 0.5f, 0.5294f, 0.5592f,
+  0.5897f, 0.6207f, 0.6514f, 0.6808f, 0.7072f, 0.7322f, 0.7557f, 0.7792f,
+  0.8013f, 0.8219f, 0.841f, 0.8586f, 0.8748f, 0.8909f, 0.9071f, 0.9248f,
+  0.9394f, 0.9541f, 0.04439f, 0.05908f, 0.07378f, 0.08995f, 0.1061f, 0.1223f,
+  0.1399f, 0.1576f, 0.1767f, 0.1972f, 0.2193f, 0.2413f, 0.2648f, 0.2913f,
+  0.3192f, 0.3486f, 0.3804f, 0.4117f, 0.4419f, 0.4713f, 0.5f, 0.5287f,
+  0.5581f, 0.5883f, 0.6196f, 0.6514f, 0.6808f, 0.7087f, 0.7352f, 0.7587f,
+  0.7807f, 0.8028f, 0.8233f, 0.8424f, 0.8601f, 0.8777f, 0.8939f, 0.9101f,
+  0.9262f, 0.9409f, 0.9556f, 0.04292f, 0.05761f, 0.07378f, 0.08995f, 0.1046f,
+  0.1208f, 0.1384f, 0.1561f, 0.1752f, 0.1958f, 0.2178f, 0.2399f, 0.2634f,
+  0.2898f, 0.3178f, 0.3501f, 0.3817f, 0.413f, 0.443f, 0.4719f, 0.5f,
+  0.5281f, 0.557f, 0.587f, 0.6183f, 0.6499f, 0.6822f, 0.7102f, 0.7366f,
+  0.7601f, 0.7822f, 0.8042f, 0.8248f, 0.8439f, 0.8616f, 0.8792f, 0.8954f,
+  0.9101f, 0.9262f, 0.9424f, 0.9571f, 0.04145f, 0.05761f, 0.07231f, 0.08848f,
+  0.1046f, 0.1208f, 0.137f, 0.1546f, 0.1737f, 0.1943f, 0.2163f, 0.2399f,
+  0.2634f, 0.2884f, 0.3178f, 0.3501f, 0.3826f, 0.4139f, 0.4437f, 0.4724f,
+  0.5f, 0.5276f, 0.5563f, 0.5861f, 0.6174f, 0.6499f, 0.6822f, 0.7116f,
+  0.7366f, 0.7601f, 0.7837f, 0.8057f, 0.8263f, 0.8454f, 0.863f, 0.8792f,
+  0.8954f, 0.9115f, 0.9277f, 0.9424f, 0.9586f, 0.04145f, 0.05614f, 0.07231f,
+  0.08848f, 0.1046f, 0.1208f, 0.137f, 0.1546f, 0.1737f, 0.1943f, 0.2163f,
+  0.2384f, 0.2634f, 0.2884f, 0.3178f, 0.3501f, 0.3829f, 0.4142f, 0.444f,
+  0.4725f, 0.5f, 0.5275f, 0.556f, 0.5858f, 0.6171f, 0.6499f, 0.6822f,
+  0.7116f, 0.7366f, 0.7616f, 0.7837f, 0.8057f, 0.8263f, 0.8454f, 0.863f,
+  0.8792f, 0.8954f, 0.9115f, 0.9277f, 0.9439f, 0.9586f, 0.04145f, 0.05761f,
+  0.07231f, 0.08848f, 0.1046f, 0.1208f, 0.137f, 0.1546f, 0.1737f, 0.1943f,
+  0.2163f, 0.2399f, 0.2634f, 0.2884f, 0.3178f, 0.3501f, 0.3826f, 0.4139f,
+  0.4437f, 0.4724f, 0.5f, 0.5276f, 0.5563f, 0.5861f, 0.6174f, 0.6499f,
+  0.6822f, 0.7116f, 0.7366f, 0.7601f, 0.7837f, 0.8057f, 0.8263f, 0.8454f,
+  0.863f, 0.8792f, 0.8954f, 0.9115f, 0.9277f, 0.9424f, 0.9586f, 0.04292f,
+  0.05761f, 0.07378f, 0.08995f, 0.1046f, 0.1208f, 0.1384f, 0.1561f, 0.1752f,
+  0.1958f, 0.2178f, 0.2399f, 0.2634f, 0.2898f, 0.3178f, 0.3501f, 0.3817f,
+  0.413f, 0.443f, 0.4719f, 0.5f, 0.5281f, 0.557f, 0.587f, 0.6183f,
+  0.6499f, 0.6822f, 0.7102f, 0.7366f, 0.7601f, 0.7822f, 0.8042f, 0.8248f,
+  0.8439f, 0.8616f, 0.8792f, 0.8954f, 0.9101f, 0.9262f, 0.9424f, 0.9571f,
+  0.04439f, 0.05908f, 0.07378f, 0.08995f, 0.1061f, 0.1223f, 0.1399f, 0.1576f,
+  0.1767f, 0.1972f, 0.2193f, 0.2413f, 0.2648f, 0.2913f, 0.3192f, 0.3486f,
+  0.3804f, 0.4117f, 0.4419f, 0.4713f, 0.5f, 0.5287f, 0.5581f, 0.5883f,
+  0.6196f, 0.6514f, 0.6808f, 0.7087f, 0.7352f, 0.7587f, 0.7807f, 0.8028f,
+  0.8233f, 0.8424f, 0.8601f, 0.8777f, 0.8939f, 0.9101f, 0.9262f, 0.9409f,
+  0.9556f, 0.04586f, 0.06055f, 0.07525f, 0.09289f, 0.1091f, 0.1252f, 0.1414f,
+  0.159f, 0.1781f, 0.1987f, 0.2208f, 0.2443f, 0.2678f, 0.2928f, 0.3192f,
+  0.3486f, 0.3793f, 0.4103f, 0.4408f, 0.4706f, 0.5f, 0.5294f, 0.5592f,
+  0.5897f, 0.6207f, 0.6514f, 0.6808f, 0.7072f, 0.7322f, 0.7557f, 0.7792f,
+  0.8013f, 0.8219f, 0.841f, 0.8586f, 0.8748f, 0.8909f, 0.9071f, 0.9248f,
+  0.9394f, 0.9541f, 0.04733f, 0.06202f, 0.07819f, 0.09436f, 0.1105f, 0.1267f,
+  0.1443f, 0.162f, 0.1811f, 0.2016f, 0.2237f, 0.2457f, 0.2707f, 0.2957f,
+  0.3207f, 0.3486f, 0.3789f, 0.4093f, 0.4399f, 0.47f, 0.5f, 0.53f,
+  0.5601f, 0.5907f, 0.6211f, 0.6514f, 0.6793f, 0.7043f, 0.7293f, 0.7543f,
+  0.7763f, 0.7984f, 0.8189f, 0.838f, 0.8557f, 0.8733f, 0.8895f, 0.9056f,
+  0.9218f, 0.938f, 0.9527f, 0.05026f, 0.06349f, 0.07966f, 0.09583f, 0.1135f,
+  0.1296f, 0.1473f, 0.1649f, 0.184f, 0.2046f, 0.2266f, 0.2487f, 0.2737f,
+  0.2986f, 0.3236f, 0.3516f, 0.3796f, 0.4093f, 0.4394f, 0.4697f, 0.5f,
+  0.5303f, 0.5606f, 0.5907f, 0.6204f, 0.6484f, 0.6764f, 0.7014f, 0.7263f,
+  0.7513f, 0.7734f, 0.7954f, 0.816f, 0.8351f, 0.8527f, 0.8704f, 0.8865f,
+  0.9042f, 0.9203f, 0.9365f, 0.9497f, 0.0532f, 0.06643f, 0.0826f, 0.09877f,
+  0.1164f, 0.134f, 0.1517f, 0.1693f, 0.1884f, 0.2075f, 0.2296f, 0.2516f,
+  0.2766f, 0.3016f, 0.3266f, 0.3536f, 0.3815f, 0.4103f, 0.4399f, 0.4699f,
+  0.5f, 0.5301f, 0.5601f, 0.5897f, 0.6185f, 0.6464f, 0.6734f, 0.6984f,
+  0.7234f, 0.7484f, 0.7704f, 0.7925f, 0.8116f, 0.8307f, 0.8483f, 0.866f,
+  0.8836f, 0.9012f, 0.9174f, 0.9336f, 0.9468f, 0.05761f, 0.06937f, 0.08554f,
+  0.1017f, 0.1193f, 0.137f, 0.1546f, 0.1723f, 0.1914f, 0.2119f, 0.2325f,
+  0.256f, 0.2795f, 0.3045f, 0.3295f, 0.3564f, 0.3839f, 0.4121f, 0.4411f,
+  0.4703f, 0.5f, 0.5297f, 0.5589f, 0.5879f, 0.6161f, 0.6436f, 0.6705f,
+  0.6955f, 0.7205f, 0.744f, 0.7675f, 0.7881f, 0.8086f, 0.8277f, 0.8454f,
+  0.863f, 0.8807f, 0.8983f, 0.9145f, 0.9306f, 0.9424f, 0.06349f, 0.07378f,
+  0.08848f, 0.1046f, 0.1223f, 0.1399f, 0.159f, 0.1767f, 0.1958f, 0.2163f,
+  0.2369f, 0.259f, 0.2825f, 0.3075f, 0.3325f, 0.3591f, 0.3861f, 0.4139f,
+  0.4422f, 0.471f, 0.5f, 0.529f, 0.5578f, 0.5861f, 0.6139f, 0.6409f,
+  0.6675f, 0.6925f, 0.7175f, 0.741f, 0.7631f, 0.7837f, 0.8042f, 0.8233f,
+  0.841f, 0.8601f, 0.8777f, 0.8954f, 0.9115f, 0.9262f, 0.9365f, 0.07378f,
+  0.07966f, 0.09289f, 0.1091f, 0.1252f, 0.1443f, 0.162f, 0.1811f, 0.2002f,
+  0.2208f, 0.2413f, 0.2634f, 0.2869f, 0.3104f, 0.3354f, 0.3616f, 0.3883f,
+  0.4156f, 0.4434f, 0.4716f, 0.5f, 0.5284f, 0.5566f, 0.5844f, 0.6117f,
+  0.6384f, 0.6646f, 0.6896f, 0.7131f, 0.7366f, 0.7587f, 0.7792f, 0.7998f,
+  0.8189f, 0.838f, 0.8557f, 0.8748f, 0.8909f, 0.112f, 0.1296f, 0.1473f,
+  0.1664f, 0.1855f, 0.2046f, 0.2252f, 0.2457f, 0.2678f, 0.2898f, 0.3148f,
+  0.3383f, 0.3642f, 0.3905f, 0.4173f, 0.4446f, 0.4722f, 0.5f, 0.5278f,
+  0.5554f, 0.5827f, 0.6095f, 0.6358f, 0.6617f, 0.6852f, 0.7102f, 0.7322f,
+  0.7543f, 0.7748f, 0.7954f, 0.8145f, 0.8336f, 0.8527f, 0.8704f, 0.888f,
+  0.1164f, 0.134f, 0.1517f, 0.1693f, 0.1899f, 0.209f, 0.2296f, 0.2501f,
+  0.2722f, 0.2942f, 0.3178f, 0.3427f, 0.3671f, 0.3929f, 0.419f, 0.4458f,
+  0.4728f, 0.5f, 0.5272f, 0.5542f, 0.581f, 0.6071f, 0.6329f, 0.6573f,
+  0.6822f, 0.7058f, 0.7278f, 0.7499f, 0.7704f, 0.791f, 0.8101f, 0.8307f,
+  0.8483f, 0.866f, 0.8836f, 0.1384f, 0.1561f, 0.1737f, 0.1928f, 0.2134f,
+  0.234f, 0.2546f, 0.2766f, 0.2986f, 0.3222f, 0.3457f, 0.3701f, 0.3952f,
+  0.4209f, 0.4471f, 0.4734f, 0.5f, 0.5266f, 0.5529f, 0.5791f, 0.6048f,
+  0.6299f, 0.6543f, 0.6778f, 0.7014f, 0.7234f, 0.7454f, 0.766f, 0.7866f,
+  0.8072f, 0.8263f, 0.8439f, 0.8616f, 0.1605f, 0.1781f, 0.1972f, 0.2178f,
+  0.2384f, 0.259f, 0.281f, 0.3031f, 0.3251f, 0.3486f, 0.373f, 0.3977f,
+  0.4228f, 0.4483f, 0.4741f, 0.5f, 0.5259f, 0.5517f, 0.5772f, 0.6023f,
+  0.627f, 0.6514f, 0.6749f, 0.6969f, 0.719f, 0.741f, 0.7616f, 0.7822f,
+  0.8028f, 0.8219f, 0.8395f, 0.1664f, 0.1825f, 0.2016f, 0.2208f, 0.2413f,
+  0.2619f, 0.284f, 0.306f, 0.3295f, 0.3516f, 0.3758f, 0.3999f, 0.4246f,
+  0.4496f, 0.4747f, 0.5f, 0.5253f, 0.5504f, 0.5754f, 0.6001f, 0.6242f,
+  0.6484f, 0.6705f, 0.694f, 0.716f, 0.7381f, 0.7587f, 0.7792f, 0.7984f,
+  0.8175f, 0.8336f, 0.1899f, 0.2061f, 0.2252f, 0.2457f, 0.2663f, 0.2869f,
+  0.3089f, 0.3325f, 0.3549f, 0.3783f, 0.4021f, 0.4262f, 0.4506f, 0.4753f,
+  0.5f, 0.5247f, 0.5494f, 0.5738f, 0.5979f, 0.6217f, 0.6451f, 0.6675f,
+  0.6911f, 0.7131f, 0.7337f, 0.7543f, 0.7748f, 0.7939f, 0.8101f, 0.2296f,
+  0.2501f, 0.2693f, 0.2913f, 0.3133f, 0.3354f, 0.3576f, 0.3805f, 0.404f,
+  0.4277f, 0.4516f, 0.4757f, 0.5f, 0.5243f, 0.5484f, 0.5723f, 0.596f,
+  0.6195f, 0.6424f, 0.6646f, 0.6867f, 0.7087f, 0.7307f, 0.7499f, 0.7704f,
+  0.2546f, 0.2737f, 0.2942f, 0.3163f, 0.3383f, 0.3599f, 0.3827f, 0.4058f,
+  0.429f, 0.4525f, 0.4762f, 0.5f, 0.5238f, 0.5475f, 0.571f, 0.5942f,
+  0.6173f, 0.6401f, 0.6617f, 0.6837f, 0.7058f, 0.7263f, 0.7454f, 0.2986f,
+  0.3192f, 0.3413f, 0.3624f, 0.3848f, 0.4074f, 0.4303f, 0.4534f, 0.4766f,
+  0.5f, 0.5234f, 0.5466f, 0.5697f, 0.5926f, 0.6152f, 0.6376f, 0.6587f,
+  0.6808f, 0.7014f, 0.3251f, 0.3442f, 0.3654f, 0.3871f, 0.4092f, 0.4317f,
+  0.4543f, 0.4771f, 0.5f, 0.5229f, 0.5457f, 0.5683f, 0.5908f, 0.6129f,
+  0.6346f, 0.6558f, 0.6749f,
+};
+static const float osvr_display_mesh_built_in_osvr_hdk13_v1_eye1_to_x[] = {
+  0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.02551f, 0.02551f, 0.02551f, 0.02551f, 0.02551f, 0.02551f, 0.02551f,
+  0.02551f, 0.02551f, 0.02551f, 0.02551f, 0.02551f, 0.02551f, 0.02551f, 0.02551f,
+  0.02551f, 0.02551f, 0.02551f, 0.02551f, 0.04974f, 0.04974f, 0.04974f, 0.04974f,
+  0.04974f, 0.04974f, 0.04974f, 0.04974f, 0.04974f, 0.04974f, 0.04974f, 0.04974f,
+  0.04974f, 0.04974f, 0.04974f, 0.04974f, 0.04974f, 0.04974f, 0.04974f, 0.04974f,
+  0.04974f, 0.04974f, 0.04974f, 0.07432f, 0.07432f, 0.07432f, 0.07432f, 0.07432f,
+  0.07432f, 0.07432f, 0.07432f, 0.07432f, 0.07432f, 0.07432f, 0.07432f, 0.07432f,
+  0.07432f, 0.07432f, 0.07432f, 0.07432f, 0.07432f, 0.07432f, 0.07432f, 0.07432f,
+  0.07432f, 0.07432f, 0.07432f, 0.07432f, 0.1006f, 0.1006f, 0.1006f, 0.1006f,
+  0.1006f, 0.1006f, 0.1006f, 0.1006f, 0.1006f, 0.1006f, 0.1006f, 0.1006f,
+  0.1006f, 0.1006f, 0.1006f, 0.1006f, 0.1006f, 0.1006f, 0.1006f, 0.1006f,
+  0.1006f, 0.1006f, 0.1006f, 0.1006f, 0.1006f, 0.1006f, 0.1006f, 0.1006f,
+  0.1006f, 0.1255f, 0.1255f, 0.1255f, 0.1255f, 0.1255f, 0.1255f, 0.1255f,
+  0.1255f, 0.1255f, 0.1255f, 0.1255f, 0.1255f, 0.1255f, 0.1255f, 0.1255f,
+  0.1255f, 0.1255f, 0.1255f, 0.1255f, 0.1255f, 0.1255f, 0.1255f, 0.1255f,
+  0.1255f, 0.1255f, 0.1255f, 0.1255f, 0.1255f, 0.1255f, 0.1255f, 0.1255f,
+  0.1505f, 0.1505f, 0.1505f, 0.1505f, 0.1505f, 0.1505f, 0.1505f, 0.1505f,
+  0.1505f, 0.1505f, 0.1505f, 0.1505f, 0.1505f, 0.1505f, 0.1505f, 0.1505f,
+  0.1505f, 0.1505f, 0.1505f, 0.1505f, 0.1505f, 0.1505f, 0.1505f, 0.1505f,
+  0.1505f, 0.1505f, 0.1505f, 0.1505f, 0.1505f, 0.1505f, 0.1505f, 0.1755f,
+  0.1755f, 0.1755f, 0.1755f, 0.1755f, 0.1755f, 0.1755f, 0.1755f, 0.1755f,
+  0.1755f, 0.1755f, 0.1755f, 0.1755f, 0.1755f, 0.1755f, 0.1755f, 0.1755f,
+  0.1755f, 0.1755f, 0.1755f, 0.1755f, 0.1755f, 0.1755f, 0.1755f, 0.1755f,
+  0.1755f, 0.1755f, 0.1755f, 0.1755f, 0.1755f, 0.1755f, 0.1755f, 0.1755f,
+  0.1995f, 0.1995f, 0.1995f, 0.1995f, 0.1995f, 0.1995f, 0.1995f, 0.1995f,
+  0.1995f, 0.1995f, 0.1995f, 0.1995f, 0.1995f, 0.1995f, 0.1995f, 0.1995f,
+  0.1995f, 0.1995f, 0.1995f, 0.1995f, 0.1995f, 0.1995f, 0.1995f, 0.1995f,
+  0.1995f, 0.1995f, 0.1995f, 0.1995f, 0.1995f, 0.1995f, 0.1995f, 0.1995f,
+  0.1995f, 0.1995f, 0.1995f, 0.2246f, 0.2246f, 0.2246f, 0.2246f, 0.2246f,
+  0.2246f, 0.2246f, 0.2246f, 0.2246f, 0.2246f, 0.2246f, 0.2246f, 0.2246f,
+  0.2246f, 0.2246f, 0.2246f, 0.2246f, 0.2246f, 0.2246f, 0.2246f, 0.2246f,
+  0.2246f, 0.2246f, 0.2246f, 0.2246f, 0.2246f, 0.2246f, 0.2246f, 0.2246f,
+  0.2246f, 0.2246f, 0.2246f, 0.2246f, 0.2246f, 0.2246f, 0.2497f, 0.2497f,
+  0.2497f, 0.2497f, 0.2497f, 0.2497f, 0.2497f, 0.2497f, 0.2497f, 0.2497f,
+  0.2497f, 0.2497f, 0.2497f, 0.2497f, 0.2497f, 0.2497f, 0.2497f, 0.2497f,
+  0.2497f, 0.2497f, 0.2497f, 0.2497f, 0.2497f, 0.2497f, 0.2497f, 0.2497f,
+  0.2497f, 0.2497f, 0.2497f, 0.2497f, 0.2497f, 0.2497f, 0.2497f, 0.2497f,
+  0.2497f, 0.2497f, 0.2497f, 0.2497f, 0.2748f, 0.2748f, 0.2748f, 0.2748f,
+  0.2748f, 0.2748f, 0.2748f, 0.2748f, 0.2748f, 0.2748f, 0.2748f, 0.2748f,
+  0.2748f, 0.2748f, 0.2748f, 0.2748f, 0.2748f, 0.2748f, 0.2748f, 0.2748f,
+  0.2748f, 0.2748f, 0.2748f, 0.2748f, 0.2748f, 0.2748f, 0.2748f, 0.2748f,
+  0.2748f, 0.2748f, 0.2748f, 0.2748f, 0.2748f, 0.2748f, 0.2748f, 0.2748f,
+  0.2748f, 0.2748f, 0.2748f, 0.2748f, 0.2748f, 0.3f, 0.3f, 0.3f,
+  0.3f, 0.3f, 0.3f, 0.3f, 0.3f, 0.3f, 0.3f, 0.3f,
+  0.3f, 0.3f, 0.3f, 0.3f, 0.3f, 0.3f, 0.3f, 0.3f,
+  0.3f, 0.3f, 0.3f, 0.3f, 0.3f, 0.3f, 0.3f, 0.3f,
+  0.3f, 0.3f, 0.3f, 0.3f, 0.3f, 0.3f, 0.3f, 0.3f,
+  0.3f, 0.3f, 0.3f, 0.3f, 0.3f, 0.3f, 0.3252f, 0.3252f,
+  0.3252f, 0.3252f, 0.3252f, 0.3252f, 0.3252f, 0.3252f, 0.3252f, 0.3252f,
+  0.3252f, 0.3252f, 0.3252f, 0.3252f, 0.3252f, 0.3252f, 0.3252f, 0.3252f,
+  0.3252f, 0.3252f, 0.3252f, 0.3252f, 0.3252f, 0.3252f, 0.3252f, 0.3252f,
+  0.3252f, 0.3252f, 0.3252f, 0.3252f, 0.3252f, 0.3252f, 0.3252f, 0.3252f,
+  0.3252f, 0.3252f, 0.3252f, 0.3252f, 0.3252f, 0.3252f, 0.3252f, 0.3496f,
+  0.3496f, 0.3496f, 0.3496f, 0.3496f, 0.3496f, 0.3496f, 0.3496f, 0.3496f,
+  0.3496f, 0.3496f, 0.3496f, 0.3496f, 0.3496f, 0.3496f, 0.3496f, 0.3496f,
+  0.3496f, 0.3496f, 0.3496f, 0.3496f, 0.3496f, 0.3496f, 0.3496f, 0.3496f,
+  0.3496f, 0.3496f, 0.3496f, 0.3496f, 0.3496f, 0.3496f, 0.3496f, 0.3496f,
+  0.3496f, 0.3496f, 0.3496f, 0.3496f, 0.3496f, 0.3496f, 0.3496f, 0.3496f,
+  0.3751f, 0.3751f, 0.3751f, 0.3751f, 0.3751f, 0.3751f, 0.3751f, 0.3751f,
+  0.3751f, 0.3751f, 0.3751f, 0.3751f, 0.3751f, 0.3751f, 0.3751f, 0.3751f,
+  0.3751f, 0.3751f, 0.3751f, 0.3751f, 0.3751f, 0.3751f, 0.3751f, 0.3751f,
+  0.3751f, 0.3751f, 0.3751f, 0.3751f, 0.3751f, 0.3751f, 0.3751f, 0.3751f,
+  0.3751f, 0.3751f, 0.3751f, 0.3751f, 0.3751f, 0.3751f, 0.3751f, 0.3751f,
+  0.3751f, 0.4f, 0.4f, 0.4f, 0.4f, 0.4f, 0.4f, 0.4f,
+  0.4f, 0.4f, 0.4f, 0.4f, 0.4f, 0.4f, 0.4f, 0.4f,
+  0.4f, 0.4f, 0.4f, 0.4f, 0.4f, 0.4f, 0.4f, 0.4f,
+  0.4f, 0.4f, 0.4f, 0.4f, 0.4f, 0.4f, 0.4f, 0.4f,
+  0.4f, 0.4f, 0.4f, 0.4f, 0.4f, 0.4f, 0.4f, 0.4f,
+  0.4f, 0.4f, 0.425f, 0.425f, 0.425f, 0.425f, 0.425f, 0.425f,
+  0.425f, 0.425f, 0.425f, 0.425f, 0.425f, 0.425f, 0.425f, 0.425f,
+  0.425f, 0.425f, 0.425f, 0.425f, 0.425f, 0.425f, 0.425f, 0.425f,
+  0.425f, 0.425f, 0.425f, 0.425f, 0.425f, 0.425f, 0.425f, 0.425f,
+  0.425f, 0.425f, 0.425f, 0.425f, 0.425f, 0.425f, 0.425f, 0.425f,
+  0.425f, 0.425f, 0.425f, 0.45f, 0.45f, 0.45f, 0.45f, 0.45f,
+  0.45f, 0.45f, 0.45f, 0.45f, 0.45f, 0.45f, 0.45f, 0.45f,
+  0.45f, 0.45f, 0.45f, 0.45f, 0.45f, 0.45f, 0.45f, 0.45f,
+  0.45f, 0.45f, 0.45f, 0.45f, 0.45f, 0.45f, 0.45f, 0.45f,
+  0.45f, 0.45f, 0.45f, 0.45f, 0.45f, 0.45f, 0.45f, 0.45f,
+  0.45f, 0.45f, 0.45f, 0.45f, 0.475f, 0.475f, 0.475f, 0.475f,
+  0.475f, 0.475f, 0.475f, 0.475f, 0.475f, 0.475f, 0.475f, 0.475f,
+  0.475f, 0.475f, 0.475f, 0.475f, 0.475f, 0.475f, 0.475f, 0.475f,
+  0.475f, 0.475f, 0.475f, 0.475f, 0.475f, 0.475f, 0.475f, 0.475f,
+  0.475f, 0.475f, 0.475f, 0.475f, 0.475f, 0.475f, 0.475f, 0.475f,
+  0.475f, 0.475f, 0.475f, 0.475f, 0.475f, 0.5f, 0.5f, 0.5f,
+  0.5f, 0.5f, 0.5f, 0.5f, 0.5f, 0.5f, 0.5f, 0.5f,
+  0.5f, 0.5f, 0.5f, 0.5f, 0.5f, 0.5f, 0.5f, 0.5f,
+  0.5f, 0.5f, 0.5f, 0.5f, 0.5f, 0.5f, 0.5f, 0.5f,
+  0.5f, 0.5f, 0.5f, 0.5f, 0.5f, 0.5f, 0.5f, 0.5f,
+  0.5f, 0.5f, 0.5f, 0.5f, 0.5f, 0.5f, 0.525f, 0.525f,
+  0.525f, 0.525f, 0.525f, 0.525f, 0.525f, 0.525f, 0.525f, 0.525f,
+  0.525f, 0.525f, 0.525f, 0.525f, 0.525f, 0.525f, 0.525f, 0.525f,
+  0.525f, 0.525f, 0.525f, 0.525f, 0.525f, 0.525f, 0.525f, 0.525f,
+  0.525f, 0.525f, 0.525f, 0.525f, 0.525f, 0.525f, 0.525f, 0.525f,
+  0.525f, 0.525f, 0.525f, 0.525f, 0.525f, 0.525f, 0.525f, 0.55f,
+  0.55f, 0.55f, 0.55f, 0.55f, 0.55f, 0.55f, 0.55f, 0.55f,
+  0.55f, 0.55f, 0.55f, 0.55f, 0.55f, 0.55f, 0.55f, 0.55f,
+  0.55f, 0.55f, 0.55f, 0.55f, 0.55f, 0.55f, 0.55f, 0.55f,
+  0.55f, 0.55f, 0.55f, 0.55f, 0.55f, 0.55f, 0.55f, 0.55f,
+  0.55f, 0.55f, 0.55f, 0.55f, 0.55f, 0.55f, 0.55f, 0.55f,
+  0.575f, 0.575f, 0.575f, 0.575f, 0.575f, 0.575f, 0.575f, 0.575f,
+  0.575f, 0.575f, 0.575f, 0.575f, 0.575f, 0.575f, 0.575f, 0.575f,
+  0.575f, 0.575f, 0.575f, 0.575f, 0.575f, 0.575f, 0.575f, 0.575f,
+  0.575f, 0.575f, 0.575f, 0.575f, 0.575f, 0.575f, 0.575f, 0.575f,
+  0.575f, 0.575f, 0.575f, 0.575f, 0.575f, 0.575f, 0.575f, 0.575f,
+  0.575f, 0.6f, 0.6f, 0.6f, 0.6f, 0.6f, 0.6f, 0.6f,
+  0.6f, 0.6f, 0.6f, 0.6f, 0.6f, 0.6f, 0.6f, 0.6f,
+  0.6f, 0.6f, 0.6f, 0.6f, 0.6f, 0.6f, 0.6f, 0.6f,
+  0.6f, 0.6f, 0.6f, 0.6f, 0.6f, 0.6f, 0.6f, 0.6f,
+  0.6f, 0.6f, 0.6f, 0.6f, 0.6f, 0.6f, 0.6f, 0.6f,
+  0.6f, 0.6f, 0.6249f, 0.6249f, 0.6249f, 0.6249f, 0.6249f, 0.6249f,
+  0.6249f, 0.6249f, 0.6249f, 0.6249f, 0.6249f, 0.6249f, 0.6249f, 0.6249f,
+  0.6249f, 0.6249f, 0.6249f, 0.6249f, 0.6249f, 0.6249f, 0.6249f, 0.6249f,
+  0.6249f, 0.6249f, 0.6249f, 0.6249f, 0.6249f, 0.6249f, 0.6249f, 0.6249f,
+  0.6249f, 0.6249f, 0.6249f, 0.6249f, 0.6249f, 0.6249f, 0.6249f, 0.6249f,
+  0.6249f, 0.6249f, 0.6249f, 0.6504f, 0.6504f, 0.6504f, 0.6504f, 0.6504f,
+  0.6504f, 0.6504f, 0.6504f, 0.6504f, 0.6504f, 0.6504f, 0.6504f, 0.6504f,
+  0.6504f, 0.6504f, 0.6504f, 0.6504f, 0.6504f, 0.6504f, 0.6504f, 0.6504f,
+  0.6504f, 0.6504f, 0.6504f, 0.6504f, 0.6504f, 0.6504f, 0.6504f, 0.6504f,
+  0.6504f, 0.6504f, 0.6504f, 0.6504f, 0.6504f, 0.6504f, 0.6504f, 0.6504f,
+  0.6504f, 0.6504f, 0.6504f, 0.6504f, 0.6748f, 0.6748f, 0.6748f, 0.6748f,
+  0.6748f, 0.6748f, 0.6748f, 0.6748f, 0.6748f, 0.6748f, 0.6748f, 0.6748f,
+  0.6748f, 0.6748f, 0.6748f, 0.6748f, 0.6748f, 0.6748f, 0.6748f, 0.6748f,
+  0.6748f, 0.6748f, 0.6748f, 0.6748f, 0.6748f, 0.6748f, 0.6748f, 0.6748f,
+  0.6748f, 0.6748f, 0.6748f, 0.6748f, 0.6748f, 0.6748f, 0.6748f, 0.6748f,
+  0.6748f, 0.6748f, 0.6748f, 0.6748f, 0.6748f, 0.7f, 0.7f, 0.7f,
+  0.7f, 0.7f, 0.7f, 0.7f, 0.7f, 0.7f, 0.7f, 0.7f,
+  0.7f, 0.7f, 0.7f, 0.7f, 0.7f, 0.7f, 0.7f, 0.7f,
+  0.7f, 0.7f, 0.7f, 0.7f, 0.7f, 0.7f, 0.7f, 0.7f,
+  0.7f, 0.7f, 0.7f, 0.7f, 0.7f, 0.7f, 0.7f, 0.7f,
+  0.7f, 0.7f, 0.7f, 0.7f, 0.7f, 0.7f, 0.7252f, 0.7252f,
+  0.7252f, 0.7252f, 0.7252f, 0.7252f, 0.7252f, 0.7252f, 0.7252f, 0.7252f,
+  0.7252f, 0.7252f, 0.7252f, 0.7252f, 0.7252f, 0.7252f, 0.7252f, 0.7252f,
+  0.7252f, 0.7252f, 0.7252f, 0.7252f, 0.7252f, 0.7252f, 0.7252f, 0.7252f,
+  0.7252f, 0.7252f, 0.7252f, 0.7252f, 0.7252f, 0.7252f, 0.7252f, 0.7252f,
+  0.7252f, 0.7252f, 0.7252f, 0.7252f, 0.7252f, 0.7252f, 0.7252f, 0.7503f,
+  0.7503f, 0.7503f, 0.7503f, 0.7503f, 0.7503f, 0.7503f, 0.7503f, 0.7503f,
+  0.7503f, 0.7503f, 0.7503f, 0.7503f, 0.7503f, 0.7503f, 0.7503f, 0.7503f,
+  0.7503f, 0.7503f, 0.7503f, 0.7503f, 0.7503f, 0.7503f, 0.7503f, 0.7503f,
+  0.7503f, 0.7503f, 0.7503f, 0.7503f, 0.7503f, 0.7503f, 0.7503f, 0.7503f,
+  0.7503f, 0.7503f, 0.7503f, 0.7503f, 0.7503f, 0.7754f, 0.7754f, 0.7754f,
+  0.7754f, 0.7754f, 0.7754f, 0.7754f, 0.7754f, 0.7754f, 0.7754f, 0.7754f,
+  0.7754f, 0.7754f, 0.7754f, 0.7754f, 0.7754f, 0.7754f, 0.7754f, 0.7754f,
+  0.7754f, 0.7754f, 0.7754f, 0.7754f, 0.7754f, 0.7754f, 0.7754f, 0.7754f,
+  0.7754f, 0.7754f, 0.7754f, 0.7754f, 0.7754f, 0.7754f, 0.7754f, 0.7754f,
+  0.8005f, 0.8005f, 0.8005f, 0.8005f, 0.8005f, 0.8005f, 0.8005f, 0.8005f,
+  0.8005f, 0.8005f, 0.8005f, 0.8005f, 0.8005f, 0.8005f, 0.8005f, 0.8005f,
+  0.8005f, 0.8005f, 0.8005f, 0.8005f, 0.8005f, 0.8005f, 0.8005f, 0.8005f,
+  0.8005f, 0.8005f, 0.8005f, 0.8005f, 0.8005f, 0.8005f, 0.8005f, 0.8005f,
+  0.8005f, 0.8005f, 0.8005f, 0.8245f, 0.8245f, 0.8245f, 0.8245f, 0.8245f,
+  0.8245f, 0.8245f, 0.8245f, 0.8245f, 0.8245f, 0.8245f, 0.8245f, 0.8245f,
+  0.8245f, 0.8245f, 0.8245f, 0.8245f, 0.8245f, 0.8245f, 0.8245f, 0.8245f,
+  0.8245f, 0.8245f, 0.8245f, 0.8245f, 0.8245f, 0.8245f, 0.8245f, 0.8245f,
+  0.8245f, 0.8245f, 0.8245f, 0.8245f, 0.8495f, 0.8495f, 0.8495f, 0.8495f,
+  0.8495f, 0.8495f, 0.8495f, 0.8495f, 0.8495f, 0.8495f, 0.8495f, 0.8495f,
+  0.8495f, 0.8495f, 0.8495f, 0.8495f, 0.8495f, 0.8495f, 0.8495f, 0.8495f,
+  0.8495f, 0.8495f, 0.8495f, 0.8495f, 0.8495f, 0.8495f, 0.8495f, 0.8495f,
+  0.8495f, 0.8495f, 0.8495f, 0.8745f, 0.8745f, 0.8745f, 0.8745f, 0.8745f,
+  0.8745f, 0.8745f, 0.8745f, 0.8745f, 0.8745f, 0.8745f, 0.8745f, 0.8745f,
+  0.8745f, 0.8745f, 0.8745f, 0.8745f, 0.8745f, 0.8745f, 0.8745f, 0.8745f,
+  0.8745f, 0.8745f, 0.8745f, 0.8745f, 0.8745f, 0.8745f, 0.8745f, 0.8745f,
+  0.8745f, 0.8745f, 0.8994f, 0.8994f, 0.8994f, 0.8994f, 0.8994f, 0.8994f,
+  0.8994f, 0.8994f, 0.8994f, 0.8994f, 0.8994f, 0.8994f, 0.8994f, 0.8994f,
+  0.8994f, 0.8994f, 0.8994f, 0.8994f, 0.8994f, 0.8994f, 0.8994f, 0.8994f,
+  0.8994f, 0.8994f, 0.8994f, 0.8994f, 0.8994f, 0.8994f, 0.8994f, 0.9257f,
+  0.9257f, 0.9257f, 0.9257f, 0.9257f, 0.9257f, 0.9257f, 0.9257f, 0.9257f,
+  0.9257f, 0.9257f, 0.9257f, 0.9257f, 0.9257f, 0.9257f, 0.9257f, 0.9257f,
+  0.9257f, 0.9257f, 0.9257f, 0.9257f, 0.9257f, 0.9257f, 0.9257f, 0.9257f,
+  0.9503f, 0.9503f, 0.9503f, 0.9503f, 0.9503f, 0.9503f, 0.9503f, 0.9503f,
+  0.9503f, 0.9503f, 0.9503f, 0.9503f, 0.9503f, 0.9503f, 0.9503f, 0.9503f,
+  0.9503f, 0.9503f, 0.9503f, 0.9503f, 0.9503f, 0.9503f, 0.9503f, 0.9745f,
+  0.9745f, 0.9745f, 0.9745f, 0.9745f, 0.9745f, 0.9745f, 0.9745f, 0.9745f,
+  0.9745f, 0.9745f, 0.9745f, 0.9745f, 0.9745f, 0.9745f, 0.9745f, 0.9745f,
+  0.9745f, 0.9745f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f,
+  1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f,
+  1.0f, 1.0f, 1.0f,
+};
+static const float osvr_display_mesh_built_in_osvr_hdk13_v1_eye1_to_y[] = {
+  0.3f, 0.3252f, 0.3496f, 0.3751f, 0.4f, 0.425f, 0.45f, 0.475f,
+  0.5f, 0.525f, 0.55f, 0.575f, 0.6f, 0.6249f, 0.6504f, 0.6748f,
+  0.7f, 0.2748f, 0.3f, 0.3252f, 0.3496f, 0.3751f, 0.4f, 0.425f,
+  0.45f, 0.475f, 0.5f, 0.525f, 0.55f, 0.575f, 0.6f, 0.6249f,
+  0.6504f, 0.6748f, 0.7f, 0.7252f, 0.2246f, 0.2497f, 0.2748f, 0.3f,
+  0.3252f, 0.3496f, 0.3751f, 0.4f, 0.425f, 0.45f, 0.475f, 0.5f,
+  0.525f, 0.55f, 0.575f, 0.6f, 0.6249f, 0.6504f, 0.6748f, 0.7f,
+  0.7252f, 0.7503f, 0.7754f, 0.1995f, 0.2246f, 0.2497f, 0.2748f, 0.3f,
+  0.3252f, 0.3496f, 0.3751f, 0.4f, 0.425f, 0.45f, 0.475f, 0.5f,
+  0.525f, 0.55f, 0.575f, 0.6f, 0.6249f, 0.6504f, 0.6748f, 0.7f,
+  0.7252f, 0.7503f, 0.7754f, 0.8005f, 0.1505f, 0.1755f, 0.1995f, 0.2246f,
+  0.2497f, 0.2748f, 0.3f, 0.3252f, 0.3496f, 0.3751f, 0.4f, 0.425f,
+  0.45f, 0.475f, 0.5f, 0.525f, 0.55f, 0.575f, 0.6f, 0.6249f,
+  0.6504f, 0.6748f, 0.7f, 0.7252f, 0.7503f, 0.7754f, 0.8005f, 0.8245f,
+  0.8495f, 0.1255f, 0.1505f, 0.1755f, 0.1995f, 0.2246f, 0.2497f, 0.2748f,
+  0.3f, 0.3252f, 0.3496f, 0.3751f, 0.4f, 0.425f, 0.45f, 0.475f,
+  0.5f, 0.525f, 0.55f, 0.575f, 0.6f, 0.6249f, 0.6504f, 0.6748f,
+  0.7f, 0.7252f, 0.7503f, 0.7754f, 0.8005f, 0.8245f, 0.8495f, 0.8745f,
+  0.1255f, 0.1505f, 0.1755f, 0.1995f, 0.2246f, 0.2497f, 0.2748f, 0.3f,
+  0.3252f, 0.3496f, 0.3751f, 0.4f, 0.425f, 0.45f, 0.475f, 0.5f,
+  0.525f, 0.55f, 0.575f, 0.6f, 0.6249f, 0.6504f, 0.6748f, 0.7f,
+  0.7252f, 0.7503f, 0.7754f, 0.8005f, 0.8245f, 0.8495f, 0.8745f, 0.1006f,
+  0.1255f, 0.1505f, 0.1755f, 0.1995f, 0.2246f, 0.2497f, 0.2748f, 0.3f,
+  0.3252f, 0.3496f, 0.3751f, 0.4f, 0.425f, 0.45f, 0.475f, 0.5f,
+  0.525f, 0.55f, 0.575f, 0.6f, 0.6249f, 0.6504f, 0.6748f, 0.7f,
+  0.7252f, 0.7503f, 0.7754f, 0.8005f, 0.8245f, 0.8495f, 0.8745f, 0.8994f,
+  0.07432f, 0.1006f, 0.1255f, 0.1505f, 0.1755f, 0.1995f, 0.2246f, 0.2497f,
+  0.2748f, 0.3f, 0.3252f, 0.3496f, 0.3751f, 0.4f, 0.425f, 0.45f,
+  0.475f, 0.5f, 0.525f, 0.55f, 0.575f, 0.6f, 0.6249f, 0.6504f,
+  0.6748f, 0.7f, 0.7252f, 0.7503f, 0.7754f, 0.8005f, 0.8245f, 0.8495f,
+  0.8745f, 0.8994f, 0.9257f, 0.07432f, 0.1006f, 0.1255f, 0.1505f, 0.1755f,
+  0.1995f, 0.2246f, 0.2497f, 0.2748f, 0.3f, 0.3252f, 0.3496f, 0.3751f,
+  0.4f, 0.425f, 0.45f, 0.475f, 0.5f, 0.525f, 0.55f, 0.575f,
+  0.6f, 0.6249f, 0.6504f, 0.6748f, 0.7f, 0.7252f, 0.7503f, 0.7754f,
+  0.8005f, 0.8245f, 0.8495f, 0.8745f, 0.8994f, 0.9257f, 0.07432f, 0.1006f,
+  0.1255f, 0.1505f, 0.1755f, 0.1995f, 0.2246f, 0.2497f, 0.2748f, 0.3f,
+  0.3252f, 0.3496f, 0.3751f, 0.4f, 0.425f, 0.45f, 0.475f, 0.5f,
+  0.525f, 0.55f, 0.575f, 0.6f, 0.6249f, 0.6504f, 0.6748f, 0.7f,
+  0.7252f, 0.7503f, 0.7754f, 0.8005f, 0.8245f, 0.8495f, 0.8745f, 0.8994f,
+  0.9257f, 0.9503f, 0.9745f, 1.0f, 0.0f, 0.02551f, 0.04974f, 0.07432f,
+  0.1006f, 0.1255f, 0.1505f, 0.1755f, 0.1995f, 0.2246f, 0.2497f, 0.2748f,
+  0.3f, 0.3252f, 0.3496f, 0.3751f, 0.4f, 0.425f, 0.45f, 0.475f,
+  0.5f, 0.525f, 0.55f, 0.575f, 0.6f, 0.6249f, 0.6504f, 0.6748f,
+  0.7f, 0.7252f, 0.7503f, 0.7754f, 0.8005f, 0.8245f, 0.8495f, 0.8745f,
+  0.8994f, 0.9257f, 0.9503f, 0.9745f, 1.0f, 0.0f, 0.02551f, 0.04974f,
+  0.07432f, 0.1006f, 0.1255f, 0.1505f, 0.1755f, 0.1995f, 0.2246f, 0.2497f,
+  0.2748f, 0.3f, 0.3252f, 0.3496f, 0.3751f, 0.4f, 0.425f, 0.45f,
+  0.475f, 0.5f, 0.525f, 0.55f, 0.575f, 0.6f, 0.6249f, 0.6504f,
+  0.6748f, 0.7f, 0.7252f, 0.7503f, 0.7754f, 0.8005f, 0.8245f, 0.8495f,
+  0.8745f, 0.8994f, 0.9257f, 0.9503f, 0.9745f, 1.0f, 0.0f, 0.02551f,
+  0.04974f, 0.07432f, 0.1006f, 0.1255f, 0.1505f, 0.1755f, 0.1995f, 0.2246f,
+  0.2497f, 0.2748f, 0.3f, 0.3252f, 0.3496f, 0.3751f, 0.4f, 0.425f,
+  0.45f, 0.475f, 0.5f, 0.525f, 0.55f, 0.575f, 0.6f, 0.6249f,
+  0.6504f, 0.6748f, 0.7f, 0.7252f, 0.7503f, 0.7754f, 0.8005f, 0.8245f,
+  0.8495f, 0.8745f, 0.8994f, 0.9257f, 0.9503f, 0.9745f, 1.0f, 0.0f,
+  0.02551f, 0.04974f, 0.07432f, 0.1006f, 0.1255f, 0.1505f, 0.1755f, 0.1995f,
+  0.2246f, 0.2497f, 0.2748f, 0.3f, 0.3252f, 0.3496f, 0.3751f, 0.4f,
+  0.425f, 0.45f, 0.475f, 0.5f, 0.525f, 0.55f, 0.575f, 0.6f,
+  0.6249f, 0.6504f, 0.6748f, 0.7f, 0.7252f, 0.7503f, 0.7754f, 0.8005f,
+  0.8245f, 0.8495f, 0.8745f, 0.8994f, 0.9257f, 0.9503f, 0.9745f, 1.0f,
+  0.0f, 0.02551f, 0.04974f, 0.07432f, 0.1006f, 0.1255f, 0.1505f, 0.1755f,
+  0.1995f, 0.2246f, 0.2497f, 0.2748f, 0.3f, 0.3252f, 0.3496f, 0.3751f,
+  0.4f, 0.425f, 0.45f, 0.475f, 0.5f, 0.525f, 0.55f, 0.575f,
+  0.6f, 0.6249f, 0.6504f, 0.6748f, 0.7f, 0.7252f, 0.7503f, 0.7754f,
+  0.8005f, 0.8245f, 0.8495f, 0.8745f, 0.8994f, 0.9257f, 0.9503f, 0.9745f,
+  1.0f, 0.0f, 0.02551f, 0.04974f, 0.07432f, 0.1006f, 0.1255f, 0.1505f,
+  0.1755f, 0.1995f, 0.2246f, 0.2497f, 0.2748f, 0.3f, 0.3252f, 0.3496f,
+  0.3751f, 0.4f, 0.425f, 0.45f, 0.475f, 0.5f, 0.525f, 0.55f,
+  0.575f, 0.6f, 0.6249f, 0.6504f, 0.6748f, 0.7f, 0.7252f, 0.7503f,
+  0.7754f, 0.8005f, 0.8245f, 0.8495f, 0.8745f, 0.8994f, 0.9257f, 0.9503f,
+  0.9745f, 1.0f, 0.0f, 0.02551f, 0.04974f, 0.07432f, 0.1006f, 0.1255f,
+  0.1505f, 0.1755f, 0.1995f, 0.2246f, 0.2497f, 0.2748f, 0.3f, 0.3252f,
+  0.3496f, 0.3751f, 0.4f, 0.425f, 0.45f, 0.475f, 0.5f, 0.525f,
+  0.55f, 0.575f, 0.6f, 0.6249f, 0.6504f, 0.6748f, 0.7f, 0.7252f,
+  0.7503f, 0.7754f, 0.8005f, 0.8245f, 0.8495f, 0.8745f, 0.8994f, 0.9257f,
+  0.9503f, 0.9745f, 1.0f, 0.0f, 0.02551f, 0.04974f, 0.07432f, 0.1006f,
+  0.1255f, 0.1505f, 0.1755f, 0.1995f, 0.2246f, 0.2497f, 0.2748f, 0.3f,
+  0.3252f, 0.3496f, 0.3751f, 0.4f, 0.425f, 0.45f, 0.475f, 0.5f,
+  0.525f, 0.55f, 0.575f, 0.6f, 0.6249f, 0.6504f, 0.6748f, 0.7f,
+  0.7252f, 0.7503f, 0.7754f, 0.8005f, 0.8245f, 0.8495f, 0.8745f, 0.8994f,
+  0.9257f, 0.9503f, 0.9745f, 1.0f, 0.0f, 0.02551f, 0.04974f, 0.07432f,
+  0.1006f, 0.1255f, 0.1505f, 0.1755f, 0.1995f, 0.2246f, 0.2497f, 0.2748f,
+  0.3f, 0.3252f, 0.3496f, 0.3751f, 0.4f, 0.425f, 0.45f, 0.475f,
+  0.5f, 0.525f, 0.55f, 0.575f, 0.6f, 0.6249f, 0.6504f, 0.6748f,
+  0.7f, 0.7252f, 0.7503f, 0.7754f, 0.8005f, 0.8245f, 0.8495f, 0.8745f,
+  0.8994f, 0.9257f, 0.9503f, 0.9745f, 1.0f, 0.0f, 0.02551f, 0.04974f,
+  0.07432f, 0.1006f, 0.1255f, 0.1505f, 0.1755f, 0.1995f, 0.2246f, 0.2497f,
+  0.2748f, 0.3f, 0.3252f, 0.3496f, 0.3751f, 0.4f, 0.425f, 0.45f,
+  0.475f, 0.5f, 0.525f, 0.55f, 0.575f, 0.6f, 0.6249f, 0.6504f,
+  0.6748f, 0.7f, 0.7252f, 0.7503f, 0.7754f, 0.8005f, 0.8245f, 0.8495f,
+  0.8745f, 0.8994f, 0.9257f, 0.9503f, 0.9745f, 1.0f, 0.0f, 0.02551f,
+  0.04974f, 0.07432f, 0.1006f, 0.1255f, 0.1505f, 0.1755f, 0.1995f, 0.2246f,
+  0.2497f, 0.2748f, 0.3f, 0.3252f, 0.3496f, 0.3751f, 0.4f, 0.425f,
+  0.45f, 0.475f, 0.5f, 0.525f, 0.55f, 0.575f, 0.6f, 0.6249f,
+  0.6504f, 0.6748f, 0.7f, 0.7252f, 0.7503f, 0.7754f, 0.8005f, 0.8245f,
+  0.8495f, 0.8745f, 0.8994f, 0.9257f, 0.9503f, 0.9745f, 1.0f, 0.0f,
+  0.02551f, 0.04974f, 0.07432f, 0.1006f, 0.1255f, 0.1505f, 0.1755f, 0.1995f,
+  0.2246f, 0.2497f, 0.2748f, 0.3f, 0.3252f, 0.3496f, 0.3751f, 0.4f,
+  0.425f, 0.45f, 0.475f, 0.5f, 0.525f, 0.55f, 0.575f, 0.6f,
+  0.6249f, 0.6504f, 0.6748f, 0.7f, 0.7252f, 0.7503f, 0.7754f, 0.8005f,
+  0.8245f, 0.8495f, 0.8745f, 0.8994f, 0.9257f, 0.9503f, 0.9745f, 1.0f,
+  0.0f, 0.02551f, 0.04974f, 0.07432f, 0.1006f, 0.1255f, 0.1505f, 0.1755f,
+  0.1995f, 0.2246f, 0.2497f, 0.2748f, 0.3f, 0.3252f, 0.3496f, 0.3751f,
+  0.4f, 0.425f, 0.45f, 0.475f, 0.5f, 0.525f, 0.55f, 0.575f,
+  0.6f, 0.6249f, 0.6504f, 0.6748f, 0.7f, 0.7252f, 0.7503f, 0.7754f,
+  0.8005f, 0.8245f, 0.8495f, 0.8745f, 0.8994f, 0.9257f, 0.9503f, 0.9745f,
+  1.0f, 0.0f, 0.02551f, 0.04974f, 0.07432f, 0.1006f, 0.1255f, 0.1505f,
+  0.1755f, 0.1995f, 0.2246f, 0.2497f, 0.2748f, 0.3f, 0.3252f, 0.3496f,
+  0.3751f, 0.4f, 0.425f, 0.45f, 0.475f, 0.5f, 0.525f, 0.55f,
+  0.575f, 0.6f, 0.6249f, 0.6504f, 0.6748f, 0.7f, 0.7252f, 0.7503f,
+  0.7754f, 0.8005f, 0.8245f, 0.8495f, 0.8745f, 0.8994f, 0.9257f, 0.9503f,
+  0.9745f, 1.0f, 0.0f, 0.02551f, 0.04974f, 0.07432f, 0.1006f, 0.1255f,
+  0.1505f, 0.1755f, 0.1995f, 0.2246f, 0.2497f, 0.2748f, 0.3f, 0.3252f,
+  0.3496f, 0.3751f, 0.4f, 0.425f, 0.45f, 0.475f, 0.5f, 0.525f,
+  0.55f, 0.575f, 0.6f, 0.6249f, 0.6504f, 0.6748f, 0.7f, 0.7252f,
+  0.7503f, 0.7754f, 0.8005f, 0.8245f, 0.8495f, 0.8745f, 0.8994f, 0.9257f,
+  0.9503f, 0.9745f, 1.0f, 0.0f, 0.02551f, 0.04974f, 0.07432f, 0.1006f,
+  0.1255f, 0.1505f, 0.1755f, 0.1995f, 0.2246f, 0.2497f, 0.2748f, 0.3f,
+  0.3252f, 0.3496f, 0.3751f, 0.4f, 0.425f, 0.45f, 0.475f, 0.5f,
+  0.525f, 0.55f, 0.575f, 0.6f, 0.6249f, 0.6504f, 0.6748f, 0.7f,
+  0.7252f, 0.7503f, 0.7754f, 0.8005f, 0.8245f, 0.8495f, 0.8745f, 0.8994f,
+  0.9257f, 0.9503f, 0.9745f, 1.0f, 0.0f, 0.02551f, 0.04974f, 0.07432f,
+  0.1006f, 0.1255f, 0.1505f, 0.1755f, 0.1995f, 0.2246f, 0.2497f, 0.2748f,
+  0.3f, 0.3252f, 0.3496f, 0.3751f, 0.4f, 0.425f, 0.45f, 0.475f,
+  0.5f, 0.525f, 0.55f, 0.575f, 0.6f, 0.6249f, 0.6504f, 0.6748f,
+  0.7f, 0.7252f, 0.7503f, 0.7754f, 0.8005f, 0.8245f, 0.8495f, 0.8745f,
+  0.8994f, 0.9257f, 0.9503f, 0.9745f, 1.0f, 0.0f, 0.02551f, 0.04974f,
+  0.07432f, 0.1006f, 0.1255f, 0.1505f, 0.1755f, 0.1995f, 0.2246f, 0.2497f,
+  0.2748f, 0.3f, 0.3252f, 0.3496f, 0.3751f, 0.4f, 0.425f, 0.45f,
+  0.475f, 0.5f, 0.525f, 0.55f, 0.575f, 0.6f, 0.6249f, 0.6504f,
+  0.6748f, 0.7f, 0.7252f, 0.7503f, 0.7754f, 0.8005f, 0.8245f, 0.8495f,
+  0.8745f, 0.8994f, 0.9257f, 0.9503f, 0.9745f, 1.0f, 0.0f, 0.02551f,
+  0.04974f, 0.07432f, 0.1006f, 0.1255f, 0.1505f, 0.1755f, 0.1995f, 0.2246f,
+  0.2497f, 0.2748f, 0.3f, 0.3252f, 0.3496f, 0.3751f, 0.4f, 0.425f,
+  0.45f, 0.475f, 0.5f, 0.525f, 0.55f, 0.575f, 0.6f, 0.6249f,
+  0.6504f, 0.6748f, 0.7f, 0.7252f, 0.7503f, 0.7754f, 0.8005f, 0.8245f,
+  0.8495f, 0.8745f, 0.8994f, 0.9257f, 0.9503f, 0.9745f, 1.0f, 0.0f,
+  0.02551f, 0.04974f, 0.07432f, 0.1006f, 0.1255f, 0.1505f, 0.1755f, 0.1995f,
+  0.2246f, 0.2497f, 0.2748f, 0.3f, 0.3252f, 0.3496f, 0.3751f, 0.4f,
+  0.425f, 0.45f, 0.475f, 0.5f, 0.525f, 0.55f, 0.575f, 0.6f,
+  0.6249f, 0.6504f, 0.6748f, 0.7f, 0.7252f, 0.7503f, 0.7754f, 0.8005f,
+  0.8245f, 0.8495f, 0.8745f, 0.8994f, 0.9257f, 0.07432f, 0.1006f, 0.1255f,
+  0.1505f, 0.1755f, 0.1995f, 0.2246f, 0.2497f, 0.2748f, 0.3f, 0.3252f,
+  0.3496f, 0.3751f, 0.4f, 0.425f, 0.45f, 0.475f, 0.5f, 0.525f,
+  0.55f, 0.575f, 0.6f, 0.6249f, 0.6504f, 0.6748f, 0.7f, 0.7252f,
+  0.7503f, 0.7754f, 0.8005f, 0.8245f, 0.8495f, 0.8745f, 0.8994f, 0.9257f,
+  0.07432f, 0.1006f, 0.1255f, 0.1505f, 0.1755f, 0.1995f, 0.2246f, 0.2497f,
+  0.2748f, 0.3f, 0.3252f, 0.3496f, 0.3751f, 0.4f, 0.425f, 0.45f,
+  0.475f, 0.5f, 0.525f, 0.55f, 0.575f, 0.6f, 0.6249f, 0.6504f,
+  0.6748f, 0.7f, 0.7252f, 0.7503f, 0.7754f, 0.8005f, 0.8245f, 0.8495f,
+  0.8745f, 0.8994f, 0.9257f, 0.1006f, 0.1255f, 0.1505f, 0.1755f, 0.1995f,
+  0.2246f, 0.2497f, 0.2748f, 0.3f, 0.3252f, 0.3496f, 0.3751f, 0.4f,
+  0.425f, 0.45f, 0.475f, 0.5f, 0.525f, 0.55f, 0.575f, 0.6f,
+  0.6249f, 0.6504f, 0.6748f, 0.7f, 0.7252f, 0.7503f, 0.7754f, 0.8005f,
+  0.8245f, 0.8495f, 0.8745f, 0.8994f, 0.1255f, 0.1505f, 0.1755f, 0.1995f,
+  0.2246f, 0.2497f, 0.2748f, 0.3f, 0.3252f, 0.3496f, 0.3751f, 0.4f,
+  0.425f, 0.45f, 0.475f, 0.5f, 0.525f, 0.55f, 0.575f, 0.6f,
+  0.6249f, 0.6504f, 0.6748f, 0.7f, 0.7252f, 0.7503f, 0.7754f, 0.8005f,
+  0.8245f, 0.8495f, 0.8745f, 0.1255f, 0.1505f, 0.1755f, 0.1995f, 0.2246f,
+  0.2497f, 0.2748f, 0.3f, 0.3252f, 0.3496f, 0.3751f, 0.4f, 0.425f,
+  0.45f, 0.475f, 0.5f, 0.525f, 0.55f, 0.575f, 0.6f, 0.6249f,
+  0.6504f, 0.6748f, 0.7f, 0.7252f, 0.7503f, 0.7754f, 0.8005f, 0.8245f,
+  0.8495f, 0.8745f, 0.1505f, 0.1755f, 0.1995f, 0.2246f, 0.2497f, 0.2748f,
+  0.3f, 0.3252f, 0.3496f, 0.3751f, 0.4f, 0.425f, 0.45f, 0.475f,
+  0.5f, 0.525f, 0.55f, 0.575f, 0.6f, 0.6249f, 0.6504f, 0.6748f,
+  0.7f, 0.7252f, 0.7503f, 0.7754f, 0.8005f, 0.8245f, 0.8495f, 0.1995f,
+  0.2246f, 0.2497f, 0.2748f, 0.3f, 0.3252f, 0.3496f, 0.3751f, 0.4f,
+  0.425f, 0.45f, 0.475f, 0.5f, 0.525f, 0.55f, 0.575f, 0.6f,
+  0.6249f, 0.6504f, 0.6748f, 0.7f, 0.7252f, 0.7503f, 0.7754f, 0.8005f,
+  0.2246f, 0.2497f, 0.2748f, 0.3f, 0.3252f, 0.3496f, 0.3751f, 0.4f,
+  0.425f, 0.45f, 0.475f, 0.5f, 0.525f, 0.55f, 0.575f, 0.6f,
+  0.6249f, 0.6504f, 0.6748f, 0.7f, 0.7252f, 0.7503f, 0.7754f, 0.2748f,
+  0.3f, 0.3252f, 0.3496f, 0.3751f, 0.4f, 0.425f, 0.45f, 0.475f,
+  0.5f, 0.525f, 0.55f, 0.575f, 0.6f, 0.6249f, 0.6504f, 0.6748f,
+  0.7f, 0.7252f, 0.3f, 0.3252f, 0.3496f, 0.3751f, 0.4f, 0.425f,
+  0.45f, 0.475f, 0.5f, 0.525f, 0.55f, 0.575f, 0.6f, 0.6249f,
+  0.6504f, 0.6748f, 0.7f,
+};
+static const BuiltInMeshEye osvr_display_mesh_built_in_osvr_hdk13_v1_eyes[] = {
+  {1411,
+   osvr_display_mesh_built_in_osvr_hdk13_v1_eye0_from_x,
+   osvr_display_mesh_built_in_osvr_hdk13_v1_eye0_from_y,
+   osvr_display_mesh_built_in_osvr_hdk13_v1_eye0_to_x,
+   osvr_display_mesh_built_in_osvr_hdk13_v1_eye0_to_y},
+  {1411,
+   osvr_display_mesh_built_in_osvr_hdk13_v1_eye1_from_x,
+   osvr_display_mesh_built_in_osvr_hdk13_v1_eye1_from_y,
+   osvr_display_mesh_built_in_osvr_hdk13_v1_eye1_to_x,
+   osvr_display_mesh_built_in_osvr_hdk13_v1_eye1_to_y},
+};
+
+// OSVR_HDK_13_V2
+static const float osvr_display_mesh_built_in_osvr_hdk13_v2_eye0_from_x[] = {
+  0.01257f, 0.01257f, 0.01257f, 0.01257f, 0.01257f, 0.01257f, 0.01257f, 0.01257f,
+  0.01257f, 0.0334f, 0.0334f, 0.0334f, 0.0334f, 0.0334f, 0.0334f, 0.0334f,
+  0.0334f, 0.0334f, 0.0334f, 0.0334f, 0.0334f, 0.0334f, 0.0334f, 0.0334f,
+  0.0334f, 0.0334f, 0.05423f, 0.05423f, 0.05423f, 0.05423f, 0.05423f, 0.05423f,
+  0.05423f, 0.05423f, 0.05423f, 0.05423f, 0.05423f, 0.05423f, 0.05423f, 0.05423f,
+  0.05423f, 0.05423f, 0.05423f, 0.05423f, 0.05423f, 0.05423f, 0.05423f, 0.07507f,
+  0.07507f, 0.07507f, 0.07507f, 0.07507f, 0.07507f, 0.07507f, 0.07507f, 0.07507f,
+  0.07507f, 0.07507f, 0.07507f, 0.07507f, 0.07507f, 0.07507f, 0.07507f, 0.07507f,
+  0.07507f, 0.07507f, 0.07507f, 0.07507f, 0.07507f, 0.07507f, 0.07507f, 0.07507f,
+  0.0959f, 0.0959f, 0.0959f, 0.0959f, 0.0959f, 0.0959f, 0.0959f, 0.0959f,
+  0.0959f, 0.0959f, 0.0959f, 0.0959f, 0.0959f, 0.0959f, 0.0959f, 0.0959f,
+  0.0959f, 0.0959f, 0.0959f, 0.0959f, 0.0959f, 0.0959f, 0.0959f, 0.0959f,
+  0.0959f, 0.0959f, 0.0959f, 0.1167f, 0.1167f, 0.1167f, 0.1167f, 0.1167f,
+  0.1167f, 0.1167f, 0.1167f, 0.1167f, 0.1167f, 0.1167f, 0.1167f, 0.1167f,
+  0.1167f, 0.1167f, 0.1167f, 0.1167f, 0.1167f, 0.1167f, 0.1167f, 0.1167f,
+  0.1167f, 0.1167f, 0.1167f, 0.1167f, 0.1167f, 0.1167f, 0.1167f, 0.1167f,
+  0.1376f, 0.1376f, 0.1376f, 0.1376f, 0.1376f, 0.1376f, 0.1376f, 0.1376f,
+  0.1376f, 0.1376f, 0.1376f, 0.1376f, 0.1376f, 0.1376f, 0.1376f, 0.1376f,
+  0.1376f, 0.1376f, 0.1376f, 0.1376f, 0.1376f, 0.1376f, 0.1376f, 0.1376f,
+  0.1376f, 0.1376f, 0.1376f, 0.1376f, 0.1376f, 0.1376f, 0.1376f, 0.1584f,
+  0.1584f, 0.1584f, 0.1584f, 0.1584f, 0.1584f, 0.1584f, 0.1584f, 0.1584f,
+  0.1584f, 0.1584f, 0.1584f, 0.1584f, 0.1584f, 0.1584f, 0.1584f, 0.1584f,
+  0.1584f, 0.1584f, 0.1584f, 0.1584f, 0.1584f, 0.1584f, 0.1584f, 0.1584f,
+  0.1584f, 0.1584f, 0.1584f, 0.1584f, 0.1584f, 0.1584f, 0.1584f, 0.1584f,
+  0.1792f, 0.1792f, 0.1792f, 0.1792f, 0.1792f, 0.1792f, 0.1792f, 0.1792f,
+  0.1792f, 0.1792f, 0.1792f, 0.1792f, 0.1792f, 0.1792f, 0.1792f, 0.1792f,
+  0.1792f, 0.1792f, 0.1792f, 0.1792f, 0.1792f, 0.1792f, 0.1792f, 0.1792f,
+  0.1792f, 0.1792f, 0.1792f, 0.1792f, 0.1792f, 0.1792f, 0.1792f, 0.1792f,
+  0.1792f, 0.1792f, 0.1792f, 0.2001f, 0.2001f, 0.2001f, 0.2001f, 0.2001f,
+  0.2001f, 0.2001f, 0.2001f, 0.2001f, 0.2001f, 0.2001f, 0.2001f, 0.2001f,
+  0.2001f, 0.2001f, 0.2001f, 0.2001f, 0.2001f, 0.2001f, 0.2001f, 0.2001f,
+  0.2001f, 0.2001f, 0.2001f, 0.2001f, 0.2001f, 0.2001f, 0.2001f, 0.2001f,
+  0.2001f, 0.2001f, 0.2001f, 0.2001f, 0.2001f, 0.2001f, 0.2001f, 0.2001f,
+  0.2209f, 0.2209f, 0.2209f, 0.2209f, 0.2209f, 0.2209f, 0.2209f, 0.2209f,
+  0.2209f, 0.2209f, 0.2209f, 0.2209f, 0.2209f, 0.2209f, 0.2209f, 0.2209f,
+  0.2209f, 0.2209f, 0.2209f, 0.2209f, 0.2209f, 0.2209f, 0.2209f, 0.2209f,
+  0.2209f, 0.2209f, 0.2209f, 0.2209f, 0.2209f, 0.2209f, 0.2209f, 0.2209f,
+  0.2209f, 0.2209f, 0.2209f, 0.2209f, 0.2209f, 0.2209f, 0.2209f, 0.2417f,
+  0.2417f, 0.2417f, 0.2417f, 0.2417f, 0.2417f, 0.2417f, 0.2417f, 0.2417f,
+  0.2417f, 0.2417f, 0.2417f, 0.2417f, 0.2417f, 0.2417f, 0.2417f, 0.2417f,
+  0.2417f, 0.2417f, 0.2417f, 0.2417f, 0.2417f, 0.2417f, 0.2417f, 0.2417f,
+  0.2417f, 0.2417f, 0.2417f, 0.2417f, 0.2417f, 0.2417f, 0.2417f, 0.2417f,
+  0.2417f, 0.2417f, 0.2417f, 0.2417f, 0.2417f, 0.2417f, 0.2626f, 0.2626f,
+  0.2626f, 0.2626f, 0.2626f, 0.2626f, 0.2626f, 0.2626f, 0.2626f, 0.2626f,
+  0.2626f, 0.2626f, 0.2626f, 0.2626f, 0.2626f, 0.2626f, 0.2626f, 0.2626f,
+  0.2626f, 0.2626f, 0.2626f, 0.2626f, 0.2626f, 0.2626f, 0.2626f, 0.2626f,
+  0.2626f, 0.2626f, 0.2626f, 0.2626f, 0.2626f, 0.2626f, 0.2626f, 0.2626f,
+  0.2626f, 0.2626f, 0.2626f, 0.2626f, 0.2626f, 0.2626f, 0.2626f, 0.2834f,
+  0.2834f, 0.2834f, 0.2834f, 0.2834f, 0.2834f, 0.2834f, 0.2834f, 0.2834f,
+  0.2834f, 0.2834f, 0.2834f, 0.2834f, 0.2834f, 0.2834f, 0.2834f, 0.2834f,
+  0.2834f, 0.2834f, 0.2834f, 0.2834f, 0.2834f, 0.2834f, 0.2834f, 0.2834f,
+  0.2834f, 0.2834f, 0.2834f, 0.2834f, 0.2834f, 0.2834f, 0.2834f, 0.2834f,
+  0.2834f, 0.2834f, 0.2834f, 0.2834f, 0.2834f, 0.2834f, 0.2834f, 0.2834f,
+  0.3042f, 0.3042f, 0.3042f, 0.3042f, 0.3042f, 0.3042f, 0.3042f, 0.3042f,
+  0.3042f, 0.3042f, 0.3042f, 0.3042f, 0.3042f, 0.3042f, 0.3042f, 0.3042f,
+  0.3042f, 0.3042f, 0.3042f, 0.3042f, 0.3042f, 0.3042f, 0.3042f, 0.3042f,
+  0.3042f, 0.3042f, 0.3042f, 0.3042f, 0.3042f, 0.3042f, 0.3042f, 0.3042f,
+  0.3042f, 0.3042f, 0.3042f, 0.3042f, 0.3042f, 0.3042f, 0.3042f, 0.3042f,
+  0.3042f, 0.3042f, 0.3042f, 0.3251f, 0.3251f, 0.3251f, 0.3251f, 0.3251f,
+  0.3251f, 0.3251f, 0.3251f, 0.3251f, 0.3251f, 0.3251f, 0.3251f, 0.3251f,
+  0.3251f, 0.3251f, 0.3251f, 0.3251f, 0.3251f, 0.3251f, 0.3251f, 0.3251f,
+  0.3251f, 0.3251f, 0.3251f, 0.3251f, 0.3251f, 0.3251f, 0.3251f, 0.3251f,
+  0.3251f, 0.3251f, 0.3251f, 0.3251f, 0.3251f, 0.3251f, 0.3251f, 0.3251f,
+  0.3251f, 0.3251f, 0.3251f, 0.3251f, 0.3251f, 0.3251f, 0.3459f, 0.3459f,
+  0.3459f, 0.3459f, 0.3459f, 0.3459f, 0.3459f, 0.3459f, 0.3459f, 0.3459f,
+  0.3459f, 0.3459f, 0.3459f, 0.3459f, 0.3459f, 0.3459f, 0.3459f, 0.3459f,
+  0.3459f, 0.3459f, 0.3459f, 0.3459f, 0.3459f, 0.3459f, 0.3459f, 0.3459f,
+  0.3459f, 0.3459f, 0.3459f, 0.3459f, 0.3459f, 0.3459f, 0.3459f, 0.3459f,
+  0.3459f, 0.3459f, 0.3459f, 0.3459f, 0.3459f, 0.3459f, 0.3459f, 0.3459f,
+  0.3459f, 0.3667f, 0.3667f, 0.3667f, 0.3667f, 0.3667f, 0.3667f, 0.3667f,
+  0.3667f, 0.3667f, 0.3667f, 0.3667f, 0.3667f, 0.3667f, 0.3667f, 0.3667f,
+  0.3667f, 0.3667f, 0.3667f, 0.3667f, 0.3667f, 0.3667f, 0.3667f, 0.3667f,
+  0.3667f, 0.3667f, 0.3667f, 0.3667f, 0.3667f, 0.3667f, 0.3667f, 0.3667f,
+  0.3667f, 0.3667f, 0.3667f, 0.3667f, 0.3667f, 0.3667f, 0.3667f, 0.3667f,
+  0.3667f, 0.3667f, 0.3667f, 0.3667f, 0.3876f, 0.3876f, 0.3876f, 0.3876f,
+  0.3876f, 0.3876f, 0.3876f, 0.3876f, 0.3876f, 0.3876f, 0.3876f, 0.3876f,
+  0.3876f, 0.3876f, 0.3876f, 0.3876f, 0.3876f, 0.3876f, 0.3876f, 0.3876f,
+  0.3876f, 0.3876f, 0.3876f, 0.3876f, 0.3876f, 0.3876f, 0.3876f, 0.3876f,
+  0.3876f, 0.3876f, 0.3876f, 0.3876f, 0.3876f, 0.3876f, 0.3876f, 0.3876f,
+  0.3876f, 0.3876f, 0.3876f, 0.3876f, 0.3876f, 0.3876f, 0.3876f, 0.3876f,
+  0.3876f, 0.4084f, 0.4084f, 0.4084f, 0.4084f, 0.4084f, 0.4084f, 0.4084f,
+  0.4084f, 0.4084f, 0.4084f, 0.4084f, 0.4084f, 0.4084f, 0.4084f, 0.4084f,
+  0.4084f, 0.4084f, 0.4084f, 0.4084f, 0.4084f, 0.4084f, 0.4084f, 0.4084f,
+  0.4084f, 0.4084f, 0.4084f, 0.4084f, 0.4084f, 0.4084f, 0.4084f, 0.4084f,
+  0.4084f, 0.4084f, 0.4084f, 0.4084f, 0.4084f, 0.4084f, 0.4084f, 0.4084f,
+  0.4084f, 0.4084f, 0.4084f, 0.4084f, 0.4084f, 0.4084f, 0.4292f, 0.4292f,
+  0.4292f, 0.4292f, 0.4292f, 0.4292f, 0.4292f, 0.4292f, 0.4292f, 0.4292f,
+  0.4292f, 0.4292f, 0.4292f, 0.4292f, 0.4292f, 0.4292f, 0.4292f, 0.4292f,
+  0.4292f, 0.4292f, 0.4292f, 0.4292f, 0.4292f, 0.4292f, 0.4292f, 0.4292f,
+  0.4292f, 0.4292f, 0.4292f, 0.4292f, 0.4292f, 0.4292f, 0.4292f, 0.4292f,
+  0.4292f, 0.4292f, 0.4292f, 0.4292f, 0.4292f, 0.4292f, 0.4292f, 0.4292f,
+  0.4292f, 0.4292f, 0.4292f, 0.4501f, 0.4501f, 0.4501f, 0.4501f, 0.4501f,
+  0.4501f, 0.4501f, 0.4501f, 0.4501f, 0.4501f, 0.4501f, 0.4501f, 0.4501f,
+  0.4501f, 0.4501f, 0.4501f, 0.4501f, 0.4501f, 0.4501f, 0.4501f, 0.4501f,
+  0.4501f, 0.4501f, 0.4501f, 0.4501f, 0.4501f, 0.4501f, 0.4501f, 0.4501f,
+  0.4501f, 0.4501f, 0.4501f, 0.4501f, 0.4501f, 0.4501f, 0.4501f, 0.4501f,
+  0.4501f, 0.4501f, 0.4501f, 0.4501f, 0.4501f, 0.4501f, 0.4501f, 0.4501f,
+  0.4709f, 0.4709f, 0.4709f, 0.4709f, 0.4709f, 0.4709f, 0.4709f, 0.4709f,
+  0.4709f, 0.4709f, 0.4709f, 0.4709f, 0.4709f, 0.4709f, 0.4709f, 0.4709f,
+  0.4709f, 0.4709f, 0.4709f, 0.4709f, 0.4709f, 0.4709f, 0.4709f, 0.4709f,
+  0.4709f, 0.4709f, 0.4709f, 0.4709f, 0.4709f, 0.4709f, 0.4709f, 0.4709f,
+  0.4709f, 0.4709f, 0.4709f, 0.4709f, 0.4709f, 0.4709f, 0.4709f, 0.4709f,
+  0.4709f, 0.4709f, 0.4709f, 0.4709f, 0.4709f, 0.4917f, 0.4917f, 0.4917f,
+  0.4917f, 0.4917f, 0.4917f, 0.4917f, 0.4917f, 0.4917f, 0.4917f, 0.4917f,
+  0.4917f, 0.4917f, 0.4917f, 0.4917f, 0.4917f, 0.4917f, 0.4917f, 0.4917f,
+  0.4917f, 0.4917f, 0.4917f, 0.4917f, 0.4917f, 0.4917f, 0.4917f, 0.4917f,
+  0.4917f, 0.4917f, 0.4917f, 0.4917f, 0.4917f, 0.4917f, 0.4917f, 0.4917f,
+  0.4917f, 0.4917f, 0.4917f, 0.4917f, 0.4917f, 0.4917f, 0.4917f, 0.4917f,
+  0.4917f, 0.4917f, 0.5126f, 0.5126f, 0.5126f, 0.5126f, 0.5126f, 0.5126f,
+  0.5126f, 0.5126f, 0.5126f, 0.5126f, 0.5126f, 0.5126f, 0.5126f, 0.5126f,
+  0.5126f, 0.5126f, 0.5126f, 0.5126f, 0.5126f, 0.5126f, 0.5126f, 0.5126f,
+  0.5126f, 0.5126f, 0.5126f, 0.5126f, 0.5126f, 0.5126f, 0.5126f, 0.5126f,
+  0.5126f, 0.5126f, 0.5126f, 0.5126f, 0.5126f, 0.5126f, 0.5126f, 0.5126f,
+  0.5126f, 0.5126f, 0.5126f, 0.5126f, 0.5126f, 0.5126f, 0.5126f, 0.5334f,
+  0.5334f, 0.5334f, 0.5334f, 0.5334f, 0.5334f, 0.5334f, 0.5334f, 0.5334f,
+  0.5334f, 0.5334f, 0.5334f, 0.5334f, 0.5334f, 0.5334f, 0.5334f, 0.5334f,
+  0.5334f, 0.5334f, 0.5334f, 0.5334f, 0.5334f, 0.5334f, 0.5334f, 0.5334f,
+  0.5334f, 0.5334f, 0.5334f, 0.5334f, 0.5334f, 0.5334f, 0.5334f, 0.5334f,
+  0.5334f, 0.5334f, 0.5334f, 0.5334f, 0.5334f, 0.5334f, 0.5334f, 0.5334f,
+  0.5334f, 0.5334f, 0.5334f, 0.5334f, 0.5542f, 0.5542f, 0.5542f, 0.5542f,
+  0.5542f, 0.5542f, 0.5542f, 0.5542f, 0.5542f, 0.5542f, 0.5542f, 0.5542f,
+  0.5542f, 0.5542f, 0.5542f, 0.5542f, 0.5542f, 0.5542f, 0.5542f, 0.5542f,
+  0.5542f, 0.5542f, 0.5542f, 0.5542f, 0.5542f, 0.5542f, 0.5542f, 0.5542f,
+  0.5542f, 0.5542f, 0.5542f, 0.5542f, 0.5542f, 0.5542f, 0.5542f, 0.5542f,
+  0.5542f, 0.5542f, 0.5542f, 0.5542f, 0.5542f, 0.5542f, 0.5542f, 0.5542f,
+  0.5542f, 0.5751f, 0.5751f, 0.5751f, 0.5751f, 0.5751f, 0.5751f, 0.5751f,
+  0.5751f, 0.5751f, 0.5751f, 0.5751f, 0.5751f, 0.5751f, 0.5751f, 0.5751f,
+  0.5751f, 0.5751f, 0.5751f, 0.5751f, 0.5751f, 0.5751f, 0.5751f, 0.5751f,
+  0.5751f, 0.5751f, 0.5751f, 0.5751f, 0.5751f, 0.5751f, 0.5751f, 0.5751f,
+  0.5751f, 0.5751f, 0.5751f, 0.5751f, 0.5751f, 0.5751f, 0.5751f, 0.5751f,
+  0.5751f, 0.5751f, 0.5751f, 0.5751f, 0.5959f, 0.5959f, 0.5959f, 0.5959f,
+  0.5959f, 0.5959f, 0.5959f, 0.5959f, 0.5959f, 0.5959f, 0.5959f, 0.5959f,
+  0.5959f, 0.5959f, 0.5959f, 0.5959f, 0.5959f, 0.5959f, 0.5959f, 0.5959f,
+  0.5959f, 0.5959f, 0.5959f, 0.5959f, 0.5959f, 0.5959f, 0.5959f, 0.5959f,
+  0.5959f, 0.5959f, 0.5959f, 0.5959f, 0.5959f, 0.5959f, 0.5959f, 0.5959f,
+  0.5959f, 0.5959f, 0.5959f, 0.5959f, 0.5959f, 0.5959f, 0.5959f, 0.6167f,
+  0.6167f, 0.6167f, 0.6167f, 0.6167f, 0.6167f, 0.6167f, 0.6167f, 0.6167f,
+  0.6167f, 0.6167f, 0.6167f, 0.6167f, 0.6167f, 0.6167f, 0.6167f, 0.6167f,
+  0.6167f, 0.6167f, 0.6167f, 0.6167f, 0.6167f, 0.6167f, 0.6167f, 0.6167f,
+  0.6167f, 0.6167f, 0.6167f, 0.6167f, 0.6167f, 0.6167f, 0.6167f, 0.6167f,
+  0.6167f, 0.6167f, 0.6167f, 0.6167f, 0.6167f, 0.6167f, 0.6167f, 0.6167f,
+  0.6167f, 0.6167f, 0.6376f, 0.6376f, 0.6376f, 0.6376f, 0.6376f, 0.6376f,
+  0.6376f, 0.6376f, 0.6376f, 0.6376f, 0.6376f, 0.6376f, 0.6376f, 0.6376f,
+  0.6376f, 0.6376f, 0.6376f, 0.6376f, 0.6376f, 0.6376f, 0.6376f, 0.6376f,
+  0.6376f, 0.6376f, 0.6376f, 0.6376f, 0.6376f, 0.6376f, 0.6376f, 0.6376f,
+  0.6376f, 0.6376f, 0.6376f, 0.6376f, 0.6376f, 0.6376f, 0.6376f, 0.6376f,
+  0.6376f, 0.6376f, 0.6376f, 0.6376f, 0.6376f, 0.6584f, 0.6584f, 0.6584f,
+  0.6584f, 0.6584f, 0.6584f, 0.6584f, 0.6584f, 0.6584f, 0.6584f, 0.6584f,
+  0.6584f, 0.6584f, 0.6584f, 0.6584f, 0.6584f, 0.6584f, 0.6584f, 0.6584f,
+  0.6584f, 0.6584f, 0.6584f, 0.6584f, 0.6584f, 0.6584f, 0.6584f, 0.6584f,
+  0.6584f, 0.6584f, 0.6584f, 0.6584f, 0.6584f, 0.6584f, 0.6584f, 0.6584f,
+  0.6584f, 0.6584f, 0.6584f, 0.6584f, 0.6584f, 0.6584f, 0.6792f, 0.6792f,
+  0.6792f, 0.6792f, 0.6792f, 0.6792f, 0.6792f, 0.6792f, 0.6792f, 0.6792f,
+  0.6792f, 0.6792f, 0.6792f, 0.6792f, 0.6792f, 0.6792f, 0.6792f, 0.6792f,
+  0.6792f, 0.6792f, 0.6792f, 0.6792f, 0.6792f, 0.6792f, 0.6792f, 0.6792f,
+  0.6792f, 0.6792f, 0.6792f, 0.6792f, 0.6792f, 0.6792f, 0.6792f, 0.6792f,
+  0.6792f, 0.6792f, 0.6792f, 0.6792f, 0.6792f, 0.6792f, 0.6792f, 0.7001f,
+  0.7001f, 0.7001f, 0.7001f, 0.7001f, 0.7001f, 0.7001f, 0.7001f, 0.7001f,
+  0.7001f, 0.7001f, 0.7001f, 0.7001f, 0.7001f, 0.7001f, 0.7001f, 0.7001f,
+  0.7001f, 0.7001f, 0.7001f, 0.7001f, 0.7001f, 0.7001f, 0.7001f, 0.7001f,
+  0.7001f, 0.7001f, 0.7001f, 0.7001f, 0.7001f, 0.7001f, 0.7001f, 0.7001f,
+  0.7001f, 0.7001f, 0.7001f, 0.7001f, 0.7001f, 0.7001f, 0.7209f, 0.7209f,
+  0.7209f, 0.7209f, 0.7209f, 0.7209f, 0.7209f, 0.7209f, 0.7209f, 0.7209f,
+  0.7209f, 0.7209f, 0.7209f, 0.7209f, 0.7209f, 0.7209f, 0.7209f, 0.7209f,
+  0.7209f, 0.7209f, 0.7209f, 0.7209f, 0.7209f, 0.7209f, 0.7209f, 0.7209f,
+  0.7209f, 0.7209f, 0.7209f, 0.7209f, 0.7209f, 0.7209f, 0.7209f, 0.7209f,
+  0.7209f, 0.7209f, 0.7209f, 0.7209f, 0.7209f, 0.7417f, 0.7417f, 0.7417f,
+  0.7417f, 0.7417f, 0.7417f, 0.7417f, 0.7417f, 0.7417f, 0.7417f, 0.7417f,
+  0.7417f, 0.7417f, 0.7417f, 0.7417f, 0.7417f, 0.7417f, 0.7417f, 0.7417f,
+  0.7417f, 0.7417f, 0.7417f, 0.7417f, 0.7417f, 0.7417f, 0.7417f, 0.7417f,
+  0.7417f, 0.7417f, 0.7417f, 0.7417f, 0.7417f, 0.7417f, 0.7417f, 0.7417f,
+  0.7417f, 0.7417f, 0.7626f, 0.7626f, 0.7626f, 0.7626f, 0.7626f, 0.7626f,
+  0.7626f, 0.7626f, 0.7626f, 0.7626f, 0.7626f, 0.7626f, 0.7626f, 0.7626f,
+  0.7626f, 0.7626f, 0.7626f, 0.7626f, 0.7626f, 0.7626f, 0.7626f, 0.7626f,
+  0.7626f, 0.7626f, 0.7626f, 0.7626f, 0.7626f, 0.7626f, 0.7626f, 0.7626f,
+  0.7626f, 0.7626f, 0.7626f, 0.7626f, 0.7626f, 0.7834f, 0.7834f, 0.7834f,
+  0.7834f, 0.7834f, 0.7834f, 0.7834f, 0.7834f, 0.7834f, 0.7834f, 0.7834f,
+  0.7834f, 0.7834f, 0.7834f, 0.7834f, 0.7834f, 0.7834f, 0.7834f, 0.7834f,
+  0.7834f, 0.7834f, 0.7834f, 0.7834f, 0.7834f, 0.7834f, 0.7834f, 0.7834f,
+  0.7834f, 0.7834f, 0.7834f, 0.7834f, 0.7834f, 0.7834f, 0.8042f, 0.8042f,
+  0.8042f, 0.8042f, 0.8042f, 0.8042f, 0.8042f, 0.8042f, 0.8042f, 0.8042f,
+  0.8042f, 0.8042f, 0.8042f, 0.8042f, 0.8042f, 0.8042f, 0.8042f, 0.8042f,
+  0.8042f, 0.8042f, 0.8042f, 0.8042f, 0.8042f, 0.8042f, 0.8042f, 0.8042f,
+  0.8042f, 0.8042f, 0.8042f, 0.8042f, 0.8042f, 0.8251f, 0.8251f, 0.8251f,
+  0.8251f, 0.8251f, 0.8251f, 0.8251f, 0.8251f, 0.8251f, 0.8251f, 0.8251f,
+  0.8251f, 0.8251f, 0.8251f, 0.8251f, 0.8251f, 0.8251f, 0.8251f, 0.8251f,
+  0.8251f, 0.8251f, 0.8251f, 0.8251f, 0.8251f, 0.8251f, 0.8251f, 0.8251f,
+  0.8251f, 0.8251f, 0.8459f, 0.8459f, 0.8459f, 0.8459f, 0.8459f, 0.8459f,
+  0.8459f, 0.8459f, 0.8459f, 0.8459f, 0.8459f, 0.8459f, 0.8459f, 0.8459f,
+  0.8459f, 0.8459f, 0.8459f, 0.8459f, 0.8459f, 0.8459f, 0.8459f, 0.8459f,
+  0.8459f, 0.8459f, 0.8459f, 0.8459f, 0.8459f, 0.8667f, 0.8667f, 0.8667f,
+  0.8667f, 0.8667f, 0.8667f, 0.8667f, 0.8667f, 0.8667f, 0.8667f, 0.8667f,
+  0.8667f, 0.8667f, 0.8667f, 0.8667f, 0.8667f, 0.8667f, 0.8667f, 0.8667f,
+  0.8667f, 0.8667f, 0.8667f, 0.8667f, 0.8667f, 0.8667f, 0.8876f, 0.8876f,
+  0.8876f, 0.8876f, 0.8876f, 0.8876f, 0.8876f, 0.8876f, 0.8876f, 0.8876f,
+  0.8876f, 0.8876f, 0.8876f, 0.8876f, 0.8876f, 0.8876f, 0.8876f, 0.8876f,
+  0.8876f, 0.8876f, 0.8876f, 0.9084f, 0.9084f, 0.9084f, 0.9084f, 0.9084f,
+  0.9084f, 0.9084f, 0.9084f, 0.9084f, 0.9084f, 0.9084f, 0.9084f, 0.9084f,
+  0.9084f, 0.9084f, 0.9084f, 0.9084f, 0.9292f, 0.9292f, 0.9292f, 0.9292f,
+  0.9292f, 0.9292f, 0.9292f, 0.9292f, 0.9292f,
+};
+static const float osvr_display_mesh_built_in_osvr_hdk13_v2_eye0_from_y[] = {
+  0.4259f, 0.4444f, 0.463f, 0.4815f, 0.5f, 0.5185f, 0.537f, 0.5556f,
+  0.5741f, 0.3519f, 0.3704f, 0.3889f, 0.4074f, 0.4259f, 0.4444f, 0.463f,
+  0.4815f, 0.5f, 0.5185f, 0.537f, 0.5556f, 0.5741f, 0.5926f, 0.6111f,
+  0.6296f, 0.6481f, 0.3148f, 0.3333f, 0.3519f, 0.3704f, 0.3889f, 0.4074f,
+  0.4259f, 0.4444f, 0.463f, 0.4815f, 0.5f, 0.5185f, 0.537f, 0.5556f,
+  0.5741f, 0.5926f, 0.6111f, 0.6296f, 0.6481f, 0.6667f, 0.6852f, 0.2778f,
+  0.2963f, 0.3148f, 0.3333f, 0.3519f, 0.3704f, 0.3889f, 0.4074f, 0.4259f,
+  0.4444f, 0.463f, 0.4815f, 0.5f, 0.5185f, 0.537f, 0.5556f, 0.5741f,
+  0.5926f, 0.6111f, 0.6296f, 0.6481f, 0.6667f, 0.6852f, 0.7037f, 0.7222f,
+  0.2593f, 0.2778f, 0.2963f, 0.3148f, 0.3333f, 0.3519f, 0.3704f, 0.3889f,
+  0.4074f, 0.4259f, 0.4444f, 0.463f, 0.4815f, 0.5f, 0.5185f, 0.537f,
+  0.5556f, 0.5741f, 0.5926f, 0.6111f, 0.6296f, 0.6481f, 0.6667f, 0.6852f,
+  0.7037f, 0.7222f, 0.7407f, 0.2407f, 0.2593f, 0.2778f, 0.2963f, 0.3148f,
+  0.3333f, 0.3519f, 0.3704f, 0.3889f, 0.4074f, 0.4259f, 0.4444f, 0.463f,
+  0.4815f, 0.5f, 0.5185f, 0.537f, 0.5556f, 0.5741f, 0.5926f, 0.6111f,
+  0.6296f, 0.6481f, 0.6667f, 0.6852f, 0.7037f, 0.7222f, 0.7407f, 0.7593f,
+  0.2222f, 0.2407f, 0.2593f, 0.2778f, 0.2963f, 0.3148f, 0.3333f, 0.3519f,
+  0.3704f, 0.3889f, 0.4074f, 0.4259f, 0.4444f, 0.463f, 0.4815f, 0.5f,
+  0.5185f, 0.537f, 0.5556f, 0.5741f, 0.5926f, 0.6111f, 0.6296f, 0.6481f,
+  0.6667f, 0.6852f, 0.7037f, 0.7222f, 0.7407f, 0.7593f, 0.7778f, 0.2037f,
+  0.2222f, 0.2407f, 0.2593f, 0.2778f, 0.2963f, 0.3148f, 0.3333f, 0.3519f,
+  0.3704f, 0.3889f, 0.4074f, 0.4259f, 0.4444f, 0.463f, 0.4815f, 0.5f,
+  0.5185f, 0.537f, 0.5556f, 0.5741f, 0.5926f, 0.6111f, 0.6296f, 0.6481f,
+  0.6667f, 0.6852f, 0.7037f, 0.7222f, 0.7407f, 0.7593f, 0.7778f, 0.7963f,
+  0.1852f, 0.2037f, 0.2222f, 0.2407f, 0.2593f, 0.2778f, 0.2963f, 0.3148f,
+  0.3333f, 0.3519f, 0.3704f, 0.3889f, 0.4074f, 0.4259f, 0.4444f, 0.463f,
+  0.4815f, 0.5f, 0.5185f, 0.537f, 0.5556f, 0.5741f, 0.5926f, 0.6111f,
+  0.6296f, 0.6481f, 0.6667f, 0.6852f, 0.7037f, 0.7222f, 0.7407f, 0.7593f,
+  0.7778f, 0.7963f, 0.8148f, 0.1667f, 0.1852f, 0.2037f, 0.2222f, 0.2407f,
+  0.2593f, 0.2778f, 0.2963f, 0.3148f, 0.3333f, 0.3519f, 0.3704f, 0.3889f,
+  0.4074f, 0.4259f, 0.4444f, 0.463f, 0.4815f, 0.5f, 0.5185f, 0.537f,
+  0.5556f, 0.5741f, 0.5926f, 0.6111f, 0.6296f, 0.6481f, 0.6667f, 0.6852f,
+  0.7037f, 0.7222f, 0.7407f, 0.7593f, 0.7778f, 0.7963f, 0.8148f, 0.8333f,
+  0.1481f, 0.1667f, 0.1852f, 0.2037f, 0.2222f, 0.2407f, 0.2593f, 0.2778f,
+  0.2963f, 0.3148f, 0.3333f, 0.3519f, 0.3704f, 0.3889f, 0.4074f, 0.4259f,
+  0.4444f, 0.463f, 0.4815f, 0.5f, 0.5185f, 0.537f, 0.5556f, 0.5741f,
+  0.5926f, 0.6111f, 0.6296f, 0.6481f, 0.6667f, 0.6852f, 0.7037f, 0.7222f,
+  0.7407f, 0.7593f, 0.7778f, 0.7963f, 0.8148f, 0.8333f, 0.8519f, 0.1481f,
+  0.1667f, 0.1852f, 0.2037f, 0.2222f, 0.2407f, 0.2593f, 0.2778f, 0.2963f,
+  0.3148f, 0.3333f, 0.3519f, 0.3704f, 0.3889f, 0.4074f, 0.4259f, 0.4444f,
+  0.463f, 0.4815f, 0.5f, 0.5185f, 0.537f, 0.5556f, 0.5741f, 0.5926f,
+  0.6111f, 0.6296f, 0.6481f, 0.6667f, 0.6852f, 0.7037f, 0.7222f, 0.7407f,
+  0.7593f, 0.7778f, 0.7963f, 0.8148f, 0.8333f, 0.8519f, 0.1296f, 0.1481f,
+  0.1667f, 0.1852f, 0.2037f, 0.2222f, 0.2407f, 0.2593f, 0.2778f, 0.2963f,
+  0.3148f, 0.3333f, 0.3519f, 0.3704f, 0.3889f, 0.4074f, 0.4259f, 0.4444f,
+  0.463f, 0.4815f, 0.5f, 0.5185f, 0.537f, 0.5556f, 0.5741f, 0.5926f,
+  0.6111f, 0.6296f, 0.6481f, 0.6667f, 0.6852f, 0.7037f, 0.7222f, 0.7407f,
+  0.7593f, 0.7778f, 0.7963f, 0.8148f, 0.8333f, 0.8519f, 0.8704f, 0.1296f,
+  0.1481f, 0.1667f, 0.1852f, 0.2037f, 0.2222f, 0.2407f, 0.2593f, 0.2778f,
+  0.2963f, 0.3148f, 0.3333f, 0.3519f, 0.3704f, 0.3889f, 0.4074f, 0.4259f,
+  0.4444f, 0.463f, 0.4815f, 0.5f, 0.5185f, 0.537f, 0.5556f, 0.5741f,
+  0.5926f, 0.6111f, 0.6296f, 0.6481f, 0.6667f, 0.6852f, 0.7037f, 0.7222f,
+  0.7407f, 0.7593f, 0.7778f, 0.7963f, 0.8148f, 0.8333f, 0.8519f, 0.8704f,
+  0.1111f, 0.1296f, 0.1481f, 0.1667f, 0.1852f, 0.2037f, 0.2222f, 0.2407f,
+  0.2593f, 0.2778f, 0.2963f, 0.3148f, 0.3333f, 0.3519f, 0.3704f, 0.3889f,
+  0.4074f, 0.4259f, 0.4444f, 0.463f, 0.4815f, 0.5f, 0.5185f, 0.537f,
+  0.5556f, 0.5741f, 0.5926f, 0.6111f, 0.6296f, 0.6481f, 0.6667f, 0.6852f,
+  0.7037f, 0.7222f, 0.7407f, 0.7593f, 0.7778f, 0.7963f, 0.8148f, 0.8333f,
+  0.8519f, 0.8704f, 0.8889f, 0.1111f, 0.1296f, 0.1481f, 0.1667f, 0.1852f,
+  0.2037f, 0.2222f, 0.2407f, 0.2593f, 0.2778f, 0.2963f, 0.3148f, 0.3333f,
+  0.3519f, 0.3704f, 0.3889f, 0.4074f, 0.4259f, 0.4444f, 0.463f, 0.4815f,
+  0.5f, 0.5185f, 0.537f, 0.5556f, 0.5741f, 0.5926f, 0.6111f, 0.6296f,
+  0.6481f, 0.6667f, 0.6852f, 0.7037f, 0.7222f, 0.7407f, 0.7593f, 0.7778f,
+  0.7963f, 0.8148f, 0.8333f, 0.8519f, 0.8704f, 0.8889f, 0.1111f, 0.1296f,
+  0.1481f, 0.1667f, 0.1852f, 0.2037f, 0.2222f, 0.2407f, 0.2593f, 0.2778f,
+  0.2963f, 0.3148f, 0.3333f, 0.3519f, 0.3704f, 0.3889f, 0.4074f, 0.4259f,
+  0.4444f, 0.463f, 0.4815f, 0.5f, 0.5185f, 0.537f, 0.5556f, 0.5741f,
+  0.5926f, 0.6111f, 0.6296f, 0.6481f, 0.6667f, 0.6852f, 0.7037f, 0.7222f,
+  0.7407f, 0.7593f, 0.7778f, 0.7963f, 0.8148f, 0.8333f, 0.8519f, 0.8704f,
+  0.8889f, 0.1111f, 0.1296f, 0.1481f, 0.1667f, 0.1852f, 0.2037f, 0.2222f,
+  0.2407f, 0.2593f, 0.2778f, 0.2963f, 0.3148f, 0.3333f, 0.3519f, 0.3704f,
+  0.3889f, 0.4074f, 0.4259f, 0.4444f, 0.463f, 0.4815f, 0.5f, 0.5185f,
+  0.537f, 0.5556f, 0.5741f, 0.5926f, 0.6111f, 0.6296f, 0.6481f, 0.6667f,
+  0.6852f, 0.7037f, 0.7222f, 0.7407f, 0.7593f, 0.7778f, 0.7963f, 0.8148f,
+  0.8333f, 0.8519f, 0.8704f, 0.8889f, 0.09259f, 0.1111f, 0.1296f, 0.1481f,
+  0.1667f, 0.1852f, 0.2037f, 0.2222f, 0.2407f, 0.2593f, 0.2778f, 0.2963f,
+  0.3148f, 0.3333f, 0.3519f, 0.3704f, 0.3889f, 0.4074f, 0.4259f, 0.4444f,
+  0.463f, 0.4815f, 0.5f, 0.5185f, 0.537f, 0.5556f, 0.5741f, 0.5926f,
+  0.6111f, 0.6296f, 0.6481f, 0.6667f, 0.6852f, 0.7037f, 0.7222f, 0.7407f,
+  0.7593f, 0.7778f, 0.7963f, 0.8148f, 0.8333f, 0.8519f, 0.8704f, 0.8889f,
+  0.9074f, 0.09259f, 0.1111f, 0.1296f, 0.1481f, 0.1667f, 0.1852f, 0.2037f,
+  0.2222f, 0.2407f, 0.2593f, 0.2778f, 0.2963f, 0.3148f, 0.3333f, 0.3519f,
+  0.3704f, 0.3889f, 0.4074f, 0.4259f, 0.4444f, 0.463f, 0.4815f, 0.5f,
+  0.5185f, 0.537f, 0.5556f, 0.5741f, 0.5926f, 0.6111f, 0.6296f, 0.6481f,
+  0.6667f, 0.6852f, 0.7037f, 0.7222f, 0.7407f, 0.7593f, 0.7778f, 0.7963f,
+  0.8148f, 0.8333f, 0.8519f, 0.8704f, 0.8889f, 0.9074f, 0.09259f, 0.1111f,
+  0.1296f, 0.1481f, 0.1667f, 0.1852f, 0.2037f, 0.2222f, 0.2407f, 0.2593f,
+  0.2778f, 0.2963f, 0.3148f, 0.3333f, 0.3519f, 0.3704f, 0.3889f, 0.4074f,
+  0.4259f, 0.4444f, 0.463f, 0.4815f, 0.5f, 0.5185f, 0.537f, 0.5556f,
+  0.5741f, 0.5926f, 0.6111f, 0.6296f, 0.6481f, 0.6667f, 0.6852f, 0.7037f,
+  0.7222f, 0.7407f, 0.7593f, 0.7778f, 0.7963f, 0.8148f, 0.8333f, 0.8519f,
+  0.8704f, 0.8889f, 0.9074f, 0.09259f, 0.1111f, 0.1296f, 0.1481f, 0.1667f,
+  0.1852f, 0.2037f, 0.2222f, 0.2407f, 0.2593f, 0.2778f, 0.2963f, 0.3148f,
+  0.3333f, 0.3519f, 0.3704f, 0.3889f, 0.4074f, 0.4259f, 0.4444f, 0.463f,
+  0.4815f, 0.5f, 0.5185f, 0.537f, 0.5556f, 0.5741f, 0.5926f, 0.6111f,
+  0.6296f, 0.6481f, 0.6667f, 0.6852f, 0.7037f, 0.7222f, 0.7407f, 0.7593f,
+  0.7778f, 0.7963f, 0.8148f, 0.8333f, 0.8519f, 0.8704f, 0.8889f, 0.9074f,
+  0.09259f, 0.1111f, 0.1296f, 0.1481f, 0.1667f, 0.1852f, 0.2037f, 0.2222f,
+  0.2407f, 0.2593f, 0.2778f, 0.2963f, 0.3148f, 0.3333f, 0.3519f, 0.3704f,
+  0.3889f, 0.4074f, 0.4259f, 0.4444f, 0.463f, 0.4815f, 0.5f, 0.5185f,
+  0.537f, 0.5556f, 0.5741f, 0.5926f, 0.6111f, 0.6296f, 0.6481f, 0.6667f,
+  0.6852f, 0.7037f, 0.7222f, 0.7407f, 0.7593f, 0.7778f, 0.7963f, 0.8148f,
+  0.8333f, 0.8519f, 0.8704f, 0.8889f, 0.9074f, 0.09259f, 0.1111f, 0.1296f,
+  0.1481f, 0.1667f, 0.1852f, 0.2037f, 0.2222f, 0.2407f, 0.2593f, 0.2778f,
+  0.2963f, 0.3148f, 0.3333f, 0.3519f, 0.3704f, 0.3889f, 0.4074f, 0.4259f,
+  0.4444f, 0.463f, 0.4815f, 0.5f, 0.5185f, 0.537f, 0.5556f, 0.5741f,
+  0.5926f, 0.6111f, 0.6296f, 0.6481f, 0.6667f, 0.6852f, 0.7037f, 0.7222f,
+  0.7407f, 0.7593f, 0.7778f, 0.7963f, 0.8148f, 0.8333f, 0.8519f, 0.8704f,
+  0.8889f, 0.9074f, 0.09259f, 0.1111f, 0.1296f, 0.1481f, 0.1667f, 0.1852f,
+  0.2037f, 0.2222f, 0.2407f, 0.2593f, 0.2778f, 0.2963f, 0.3148f, 0.3333f,
+  0.3519f, 0.3704f, 0.3889f, 0.4074f, 0.4259f, 0.4444f, 0.463f, 0.4815f,
+  0.5f, 0.5185f, 0.537f, 0.5556f, 0.5741f, 0.5926f, 0.6111f, 0.6296f,
+  0.6481f, 0.6667f, 0.6852f, 0.7037f, 0.7222f, 0.7407f, 0.7593f, 0.7778f,
+  0.7963f, 0.8148f, 0.8333f, 0.8519f, 0.8704f, 0.8889f, 0.9074f, 0.09259f,
+  0.1111f, 0.1296f, 0.1481f, 0.1667f, 0.1852f, 0.2037f, 0.2222f, 0.2407f,
+  0.2593f, 0.2778f, 0.2963f, 0.3148f, 0.3333f, 0.3519f, 0.3704f, 0.3889f,
+  0.4074f, 0.4259f, 0.4444f, 0.463f, 0.4815f, 0.5f, 0.5185f, 0.537f,
+  0.5556f, 0.5741f, 0.5926f, 0.6111f, 0.6296f, 0.6481f, 0.6667f, 0.6852f,
+  0.7037f, 0.7222f, 0.7407f, 0.7593f, 0.7778f, 0.7963f, 0.8148f, 0.8333f,
+  0.8519f, 0.8704f, 0.8889f, 0.9074f, 0.09259f, 0.1111f, 0.1296f, 0.1481f,
+  0.1667f, 0.1852f, 0.2037f, 0.2222f, 0.2407f, 0.2593f, 0.2778f, 0.2963f,
+  0.3148f, 0.3333f, 0.3519f, 0.3704f, 0.3889f, 0.4074f, 0.4259f, 0.4444f,
+  0.463f, 0.4815f, 0.5f, 0.5185f, 0.537f, 0.5556f, 0.5741f, 0.5926f,
+  0.6111f, 0.6296f, 0.6481f, 0.6667f, 0.6852f, 0.7037f, 0.7222f, 0.7407f,
+  0.7593f, 0.7778f, 0.7963f, 0.8148f, 0.8333f, 0.8519f, 0.8704f, 0.8889f,
+  0.9074f, 0.1111f, 0.1296f, 0.1481f, 0.1667f, 0.1852f, 0.2037f, 0.2222f,
+  0.2407f, 0.2593f, 0.2778f, 0.2963f, 0.3148f, 0.3333f, 0.3519f, 0.3704f,
+  0.3889f, 0.4074f, 0.4259f, 0.4444f, 0.463f, 0.4815f, 0.5f, 0.5185f,
+  0.537f, 0.5556f, 0.5741f, 0.5926f, 0.6111f, 0.6296f, 0.6481f, 0.6667f,
+  0.6852f, 0.7037f, 0.7222f, 0.7407f, 0.7593f, 0.7778f, 0.7963f, 0.8148f,
+  0.8333f, 0.8519f, 0.8704f, 0.8889f, 0.1111f, 0.1296f, 0.1481f, 0.1667f,
+  0.1852f, 0.2037f, 0.2222f, 0.2407f, 0.2593f, 0.2778f, 0.2963f, 0.3148f,
+  0.3333f, 0.3519f, 0.3704f, 0.3889f, 0.4074f, 0.4259f, 0.4444f, 0.463f,
+  0.4815f, 0.5f, 0.5185f, 0.537f, 0.5556f, 0.5741f, 0.5926f, 0.6111f,
+  0.6296f, 0.6481f, 0.6667f, 0.6852f, 0.7037f, 0.7222f, 0.7407f, 0.7593f,
+  0.7778f, 0.7963f, 0.8148f, 0.8333f, 0.8519f, 0.8704f, 0.8889f, 0.1111f,
+  0.1296f, 0.1481f, 0.1667f, 0.1852f, 0.2037f, 0.2222f, 0.2407f, 0.2593f,
+  0.2778f, 0.2963f, 0.3148f, 0.3333f, 0.3519f, 0.3704f, 0.3889f, 0.4074f,
+  0.4259f, 0.4444f, 0.463f, 0.4815f, 0.5f, 0.5185f, 0.537f, 0.5556f,
+  0.5741f, 0.5926f, 0.6111f, 0.6296f, 0.6481f, 0.6667f, 0.6852f, 0.7037f,
+  0.7222f, 0.7407f, 0.7593f, 0.7778f, 0.7963f, 0.8148f, 0.8333f, 0.8519f,
+  0.8704f, 0.8889f, 0.1111f, 0.1296f, 0.1481f, 0.1667f, 0.1852f, 0.2037f,
+  0.2222f, 0.2407f, 0.2593f, 0.2778f, 0.2963f, 0.3148f, 0.3333f, 0.3519f,
+  0.3704f, 0.3889f, 0.4074f, 0.4259f, 0.4444f, 0.463f, 0.4815f, 0.5f,
+  0.5185f, 0.537f, 0.5556f, 0.5741f, 0.5926f, 0.6111f, 0.6296f, 0.6481f,
+  0.6667f, 0.6852f, 0.7037f, 0.7222f, 0.7407f, 0.7593f, 0.7778f, 0.7963f,
+  0.8148f, 0.8333f, 0.8519f, 0.8704f, 0.8889f, 0.1296f, 0.1481f, 0.1667f,
+  0.1852f, 0.2037f, 0.2222f, 0.2407f, 0.2593f, 0.2778f, 0.2963f, 0.3148f,
+  0.3333f, 0.3519f, 0.3704f, 0.3889f, 0.4074f, 0.4259f, 0.4444f, 0.463f,
+  0.4815f, 0.5f, 0.5185f, 0.537f, 0.5556f, 0.5741f, 0.5926f, 0.6111f,
+  0.6296f, 0.6481f, 0.6667f, 0.6852f, 0.7037f, 0.7222f, 0.7407f, 0.7593f,
+  0.7778f, 0.7963f, 0.8148f, 0.8333f, 0.8519f, 0.8704f, 0.1296f, 0.1481f,
+  0.1667f, 0.1852f, 0.2037f, 0.2222f, 0.2407f, 0.2593f, 0.2778f, 0.2963f,
+  0.3148f, 0.3333f, 0.3519f, 0.3704f, 0.3889f, 0.4074f, 0.4259f, 0.4444f,
+  0.463f, 0.4815f, 0.5f, 0.5185f, 0.537f, 0.5556f, 0.5741f, 0.5926f,
+  0.6111f, 0.6296f, 0.6481f, 0.6667f, 0.6852f, 0.7037f, 0.7222f, 0.7407f,
+  0.7593f, 0.7778f, 0.7963f, 0.8148f, 0.8333f, 0.8519f, 0.8704f, 0.1481f,
+  0.1667f, 0.1852f, 0.2037f, 0.2222f, 0.2407f, 0.2593f, 0.2778f, 0.2963f,
+  0.3148f, 0.3333f, 0.3519f, 0.3704f, 0.3889f, 0.4074f, 0.4259f, 0.4444f,
+  0.463f, 0.4815f, 0.5f, 0.5185f, 0.537f, 0.5556f, 0.5741f, 0.5926f,
+  0.6111f, 0.6296f, 0.6481f, 0.6667f, 0.6852f, 0.7037f, 0.7222f, 0.7407f,
+  0.7593f, 0.7778f, 0.7963f, 0.8148f, 0.8333f, 0.8519f, 0.1481f, 0.1667f,
+  0.1852f, 0.2037f, 0.2222f, 0.2407f, 0.2593f, 0.2778f, 0.2963f, 0.3148f,
+  0.3333f, 0.3519f, 0.3704f, 0.3889f, 0.4074f, 0.4259f, 0.4444f, 0.463f,
+  0.4815f, 0.5f, 0.5185f, 0.537f, 0.5556f, 0.5741f, 0.5926f, 0.6111f,
+  0.6296f, 0.6481f, 0.6667f, 0.6852f, 0.7037f, 0.7222f, 0.7407f, 0.7593f,
+  0.7778f, 0.7963f, 0.8148f, 0.8333f, 0.8519f, 0.1667f, 0.1852f, 0.2037f,
+  0.2222f, 0.2407f, 0.2593f, 0.2778f, 0.2963f, 0.3148f, 0.3333f, 0.3519f,
+  0.3704f, 0.3889f, 0.4074f, 0.4259f, 0.4444f, 0.463f, 0.4815f, 0.5f,
+  0.5185f, 0.537f, 0.5556f, 0.5741f, 0.5926f, 0.6111f, 0.6296f, 0.6481f,
+  0.6667f, 0.6852f, 0.7037f, 0.7222f, 0.7407f, 0.7593f, 0.7778f, 0.7963f,
+  0.8148f, 0.8333f, 0.1852f, 0.2037f, 0.2222f, 0.2407f, 0.2593f, 0.2778f,
+  0.2963f, 0.3148f, 0.3333f, 0.3519f, 0.3704f, 0.3889f, 0.4074f, 0.4259f,
+  0.4444f, 0.463f, 0.4815f, 0.5f, 0.5185f, 0.537f, 0.5556f, 0.5741f,
+  0.5926f, 0.6111f, 0.6296f, 0.6481f, 0.6667f, 0.6852f, 0.7037f, 0.7222f,
+  0.7407f, 0.7593f, 0.7778f, 0.7963f, 0.8148f, 0.2037f, 0.2222f, 0.2407f,
+  0.2593f, 0.2778f, 0.2963f, 0.3148f, 0.3333f, 0.3519f, 0.3704f, 0.3889f,
+  0.4074f, 0.4259f, 0.4444f, 0.463f, 0.4815f, 0.5f, 0.5185f, 0.537f,
+  0.5556f, 0.5741f, 0.5926f, 0.6111f, 0.6296f, 0.6481f, 0.6667f, 0.6852f,
+  0.7037f, 0.7222f, 0.7407f, 0.7593f, 0.7778f, 0.7963f, 0.2222f, 0.2407f,
+  0.2593f, 0.2778f, 0.2963f, 0.3148f, 0.3333f, 0.3519f, 0.3704f, 0.3889f,
+  0.4074f, 0.4259f, 0.4444f, 0.463f, 0.4815f, 0.5f, 0.5185f, 0.537f,
+  0.5556f, 0.5741f, 0.5926f, 0.6111f, 0.6296f, 0.6481f, 0.6667f, 0.6852f,
+  0.7037f, 0.7222f, 0.7407f, 0.7593f, 0.7778f, 0.2407f, 0.2593f, 0.2778f,
+  0.2963f, 0.3148f, 0.3333f, 0.3519f, 0.3704f, 0.3889f, 0.4074f, 0.4259f,
+  0.4444f, 0.463f, 0.4815f, 0.5f, 0.5185f, 0.537f, 0.5556f, 0.5741f,
+  0.5926f, 0.6111f, 0.6296f, 0.6481f, 0.6667f, 0.6852f, 0.7037f, 0.7222f,
+  0.7407f, 0.7593f, 0.2593f, 0.2778f, 0.2963f, 0.3148f, 0.3333f, 0.3519f,
+  0.3704f, 0.3889f, 0.4074f, 0.4259f, 0.4444f, 0.463f, 0.4815f, 0.5f,
+  0.5185f, 0.537f, 0.5556f, 0.5741f, 0.5926f, 0.6111f, 0.6296f, 0.6481f,
+  0.6667f, 0.6852f, 0.7037f, 0.7222f, 0.7407f, 0.2778f, 0.2963f, 0.3148f,
+  0.3333f, 0.3519f, 0.3704f, 0.3889f, 0.4074f, 0.4259f, 0.4444f, 0.463f,
+  0.4815f, 0.5f, 0.5185f, 0.537f, 0.5556f, 0.5741f, 0.5926f, 0.6111f,
+  0.6296f, 0.6481f, 0.6667f, 0.6852f, 0.7037f, 0.7222f, 0.3148f, 0.3333f,
+  0.3519f, 0.3704f, 0.3889f, 0.4074f, 0.4259f, 0.4444f, 0.463f, 0.4815f,
+  0.5f, 0.5185f, 0.537f, 0.5556f, 0.5741f, 0.5926f, 0.6111f, 0.6296f,
+  0.6481f, 0.6667f, 0.6852f, 0.3519f, 0.3704f, 0.3889f, 0.4074f, 0.4259f,
+  0.4444f, 0.463f, 0.4815f, 0.5f, 0.5185f, 0.537f, 0.5556f, 0.5741f,
+  0.5926f, 0.6111f, 0.6296f, 0.6481f, 0.4259f, 0.4444f, 0.463f, 0.4815f,
+  0.5f, 0.5185f, 0.537f, 0.5556f, 0.5741f,
+};
+static const float osvr_display_mesh_built_in_osvr_hdk13_v2_eye0_to_x[] = {
+  0.0f, 0.002598f, 0.00445f, 0.005558f, 0.005927f, 0.005558f, 0.00445f, 0.002598f,
+  0.0f, 0.02095f, 0.02627f, 0.03085f, 0.0347f, 0.03783f, 0.04025f, 0.04197f,
+  0.04301f, 0.04335f, 0.04301f, 0.04197f, 0.04025f, 0.03783f, 0.0347f, 0.03085f,
+  0.02627f, 0.02095f, 0.04545f, 0.05185f, 0.05752f, 0.06247f, 0.06673f, 0.07029f,
+  0.07319f, 0.07543f, 0.07702f, 0.07797f, 0.07828f, 0.07797f, 0.07702f, 0.07543f,
+  0.07319f, 0.07029f, 0.06673f, 0.06247f, 0.05752f, 0.05185f, 0.04545f, 0.06657f,
+  0.07394f, 0.08059f, 0.08653f, 0.09178f, 0.09635f, 0.1003f, 0.1035f, 0.1062f,
+  0.1082f, 0.1097f, 0.1106f, 0.1109f, 0.1106f, 0.1097f, 0.1082f, 0.1062f,
+  0.1035f, 0.1003f, 0.09635f, 0.09178f, 0.08653f, 0.08059f, 0.07394f, 0.06657f,
+  0.09304f, 0.1006f, 0.1074f, 0.1136f, 0.119f, 0.1239f, 0.128f, 0.1316f,
+  0.1346f, 0.137f, 0.1389f, 0.1402f, 0.141f, 0.1412f, 0.141f, 0.1402f,
+  0.1389f, 0.137f, 0.1346f, 0.1316f, 0.128f, 0.1239f, 0.119f, 0.1136f,
+  0.1074f, 0.1006f, 0.09304f, 0.1179f, 0.1256f, 0.1325f, 0.1388f, 0.1445f,
+  0.1495f, 0.1539f, 0.1577f, 0.1609f, 0.1636f, 0.1658f, 0.1674f, 0.1686f,
+  0.1693f, 0.1695f, 0.1693f, 0.1686f, 0.1674f, 0.1658f, 0.1636f, 0.1609f,
+  0.1577f, 0.1539f, 0.1495f, 0.1445f, 0.1388f, 0.1325f, 0.1256f, 0.1179f,
+  0.1415f, 0.1492f, 0.1562f, 0.1626f, 0.1684f, 0.1735f, 0.178f, 0.182f,
+  0.1854f, 0.1883f, 0.1907f, 0.1926f, 0.1941f, 0.1951f, 0.1958f, 0.196f,
+  0.1958f, 0.1951f, 0.1941f, 0.1926f, 0.1907f, 0.1883f, 0.1854f, 0.182f,
+  0.178f, 0.1735f, 0.1684f, 0.1626f, 0.1562f, 0.1492f, 0.1415f, 0.1639f,
+  0.1716f, 0.1787f, 0.1851f, 0.191f, 0.1962f, 0.2008f, 0.2049f, 0.2084f,
+  0.2114f, 0.214f, 0.2161f, 0.2178f, 0.2191f, 0.22f, 0.2205f, 0.2207f,
+  0.2205f, 0.22f, 0.2191f, 0.2178f, 0.2161f, 0.214f, 0.2114f, 0.2084f,
+  0.2049f, 0.2008f, 0.1962f, 0.191f, 0.1851f, 0.1787f, 0.1716f, 0.1639f,
+  0.1854f, 0.193f, 0.2001f, 0.2066f, 0.2124f, 0.2177f, 0.2224f, 0.2265f,
+  0.2301f, 0.2333f, 0.2359f, 0.2382f, 0.24f, 0.2414f, 0.2425f, 0.2433f,
+  0.2438f, 0.2439f, 0.2438f, 0.2433f, 0.2425f, 0.2414f, 0.24f, 0.2382f,
+  0.2359f, 0.2333f, 0.2301f, 0.2265f, 0.2224f, 0.2177f, 0.2124f, 0.2066f,
+  0.2001f, 0.193f, 0.1854f, 0.2061f, 0.2137f, 0.2207f, 0.2271f, 0.233f,
+  0.2382f, 0.2429f, 0.2471f, 0.2508f, 0.254f, 0.2567f, 0.259f, 0.2609f,
+  0.2625f, 0.2637f, 0.2646f, 0.2652f, 0.2656f, 0.2657f, 0.2656f, 0.2652f,
+  0.2646f, 0.2637f, 0.2625f, 0.2609f, 0.259f, 0.2567f, 0.254f, 0.2508f,
+  0.2471f, 0.2429f, 0.2382f, 0.233f, 0.2271f, 0.2207f, 0.2137f, 0.2061f,
+  0.2263f, 0.2337f, 0.2406f, 0.247f, 0.2528f, 0.258f, 0.2627f, 0.2669f,
+  0.2706f, 0.2738f, 0.2766f, 0.2789f, 0.2809f, 0.2825f, 0.2837f, 0.2847f,
+  0.2855f, 0.286f, 0.2862f, 0.2863f, 0.2862f, 0.286f, 0.2855f, 0.2847f,
+  0.2837f, 0.2825f, 0.2809f, 0.2789f, 0.2766f, 0.2738f, 0.2706f, 0.2669f,
+  0.2627f, 0.258f, 0.2528f, 0.247f, 0.2406f, 0.2337f, 0.2263f, 0.2533f,
+  0.2601f, 0.2663f, 0.272f, 0.2772f, 0.2819f, 0.286f, 0.2897f, 0.2929f,
+  0.2957f, 0.2981f, 0.3f, 0.3017f, 0.303f, 0.304f, 0.3047f, 0.3053f,
+  0.3056f, 0.3058f, 0.3059f, 0.3058f, 0.3056f, 0.3053f, 0.3047f, 0.304f,
+  0.303f, 0.3017f, 0.3f, 0.2981f, 0.2957f, 0.2929f, 0.2897f, 0.286f,
+  0.2819f, 0.2772f, 0.272f, 0.2663f, 0.2601f, 0.2533f, 0.2727f, 0.2793f,
+  0.2853f, 0.2909f, 0.2959f, 0.3005f, 0.3046f, 0.3083f, 0.3115f, 0.3143f,
+  0.3166f, 0.3186f, 0.3203f, 0.3216f, 0.3226f, 0.3233f, 0.3238f, 0.3242f,
+  0.3244f, 0.3245f, 0.3246f, 0.3245f, 0.3244f, 0.3242f, 0.3238f, 0.3233f,
+  0.3226f, 0.3216f, 0.3203f, 0.3186f, 0.3166f, 0.3143f, 0.3115f, 0.3083f,
+  0.3046f, 0.3005f, 0.2959f, 0.2909f, 0.2853f, 0.2793f, 0.2727f, 0.2983f,
+  0.3041f, 0.3095f, 0.3144f, 0.3189f, 0.3229f, 0.3265f, 0.3297f, 0.3324f,
+  0.3348f, 0.3368f, 0.3384f, 0.3397f, 0.3407f, 0.3414f, 0.3419f, 0.3422f,
+  0.3424f, 0.3425f, 0.3425f, 0.3425f, 0.3425f, 0.3425f, 0.3424f, 0.3422f,
+  0.3419f, 0.3414f, 0.3407f, 0.3397f, 0.3384f, 0.3368f, 0.3348f, 0.3324f,
+  0.3297f, 0.3265f, 0.3229f, 0.3189f, 0.3144f, 0.3095f, 0.3041f, 0.2983f,
+  0.3175f, 0.323f, 0.3281f, 0.3328f, 0.3371f, 0.341f, 0.3445f, 0.3476f,
+  0.3503f, 0.3526f, 0.3546f, 0.3562f, 0.3575f, 0.3585f, 0.3592f, 0.3597f,
+  0.3599f, 0.36f, 0.36f, 0.36f, 0.3599f, 0.3599f, 0.3599f, 0.36f,
+  0.36f, 0.36f, 0.3599f, 0.3597f, 0.3592f, 0.3585f, 0.3575f, 0.3562f,
+  0.3546f, 0.3526f, 0.3503f, 0.3476f, 0.3445f, 0.341f, 0.3371f, 0.3328f,
+  0.3281f, 0.323f, 0.3175f, 0.3421f, 0.3469f, 0.3513f, 0.3553f, 0.359f,
+  0.3624f, 0.3653f, 0.368f, 0.3702f, 0.3722f, 0.3738f, 0.3751f, 0.3761f,
+  0.3768f, 0.3773f, 0.3775f, 0.3775f, 0.3774f, 0.3773f, 0.3771f, 0.3769f,
+  0.3769f, 0.3769f, 0.3771f, 0.3773f, 0.3774f, 0.3775f, 0.3775f, 0.3773f,
+  0.3768f, 0.3761f, 0.3751f, 0.3738f, 0.3722f, 0.3702f, 0.368f, 0.3653f,
+  0.3624f, 0.359f, 0.3553f, 0.3513f, 0.3469f, 0.3421f, 0.366f, 0.37f,
+  0.3738f, 0.3772f, 0.3803f, 0.3831f, 0.3856f, 0.3878f, 0.3897f, 0.3912f,
+  0.3925f, 0.3935f, 0.3943f, 0.3947f, 0.395f, 0.395f, 0.3949f, 0.3946f,
+  0.3943f, 0.3939f, 0.3937f, 0.3936f, 0.3937f, 0.3939f, 0.3943f, 0.3946f,
+  0.3949f, 0.395f, 0.395f, 0.3947f, 0.3943f, 0.3935f, 0.3925f, 0.3912f,
+  0.3897f, 0.3878f, 0.3856f, 0.3831f, 0.3803f, 0.3772f, 0.3738f, 0.37f,
+  0.366f, 0.3892f, 0.3926f, 0.3957f, 0.3985f, 0.4011f, 0.4033f, 0.4054f,
+  0.4071f, 0.4086f, 0.4099f, 0.4109f, 0.4117f, 0.4122f, 0.4125f, 0.4125f,
+  0.4124f, 0.4121f, 0.4117f, 0.4112f, 0.4107f, 0.4104f, 0.4103f, 0.4104f,
+  0.4107f, 0.4112f, 0.4117f, 0.4121f, 0.4124f, 0.4125f, 0.4125f, 0.4122f,
+  0.4117f, 0.4109f, 0.4099f, 0.4086f, 0.4071f, 0.4054f, 0.4033f, 0.4011f,
+  0.3985f, 0.3957f, 0.3926f, 0.3892f, 0.4091f, 0.412f, 0.4146f, 0.4171f,
+  0.4193f, 0.4214f, 0.4232f, 0.4247f, 0.4261f, 0.4273f, 0.4282f, 0.429f,
+  0.4295f, 0.4299f, 0.43f, 0.43f, 0.4297f, 0.4293f, 0.4288f, 0.4282f,
+  0.4277f, 0.4273f, 0.4271f, 0.4273f, 0.4277f, 0.4282f, 0.4288f, 0.4293f,
+  0.4297f, 0.43f, 0.43f, 0.4299f, 0.4295f, 0.429f, 0.4282f, 0.4273f,
+  0.4261f, 0.4247f, 0.4232f, 0.4214f, 0.4193f, 0.4171f, 0.4146f, 0.412f,
+  0.4091f, 0.4322f, 0.4343f, 0.4363f, 0.4381f, 0.4398f, 0.4413f, 0.4426f,
+  0.4438f, 0.4448f, 0.4457f, 0.4464f, 0.4469f, 0.4473f, 0.4475f, 0.4475f,
+  0.4474f, 0.4471f, 0.4467f, 0.4462f, 0.4456f, 0.445f, 0.4445f, 0.4443f,
+  0.4445f, 0.445f, 0.4456f, 0.4462f, 0.4467f, 0.4471f, 0.4474f, 0.4475f,
+  0.4475f, 0.4473f, 0.4469f, 0.4464f, 0.4457f, 0.4448f, 0.4438f, 0.4426f,
+  0.4413f, 0.4398f, 0.4381f, 0.4363f, 0.4343f, 0.4322f, 0.4549f, 0.4564f,
+  0.4577f, 0.4589f, 0.46f, 0.461f, 0.4619f, 0.4627f, 0.4633f, 0.4639f,
+  0.4643f, 0.4647f, 0.4649f, 0.465f, 0.465f, 0.4649f, 0.4646f, 0.4643f,
+  0.4638f, 0.4633f, 0.4627f, 0.4622f, 0.462f, 0.4622f, 0.4627f, 0.4633f,
+  0.4638f, 0.4643f, 0.4646f, 0.4649f, 0.465f, 0.465f, 0.4649f, 0.4647f,
+  0.4643f, 0.4639f, 0.4633f, 0.4627f, 0.4619f, 0.461f, 0.46f, 0.4589f,
+  0.4577f, 0.4564f, 0.4549f, 0.4775f, 0.4782f, 0.4789f, 0.4795f, 0.4801f,
+  0.4805f, 0.481f, 0.4814f, 0.4817f, 0.482f, 0.4822f, 0.4823f, 0.4825f,
+  0.4825f, 0.4825f, 0.4824f, 0.4823f, 0.4821f, 0.4818f, 0.4815f, 0.4811f,
+  0.4807f, 0.4805f, 0.4807f, 0.4811f, 0.4815f, 0.4818f, 0.4821f, 0.4823f,
+  0.4824f, 0.4825f, 0.4825f, 0.4825f, 0.4823f, 0.4822f, 0.482f, 0.4817f,
+  0.4814f, 0.481f, 0.4805f, 0.4801f, 0.4795f, 0.4789f, 0.4782f, 0.4775f,
+  0.5f, 0.5f, 0.5f, 0.5f, 0.5f, 0.5f, 0.5f, 0.5f,
+  0.5f, 0.5f, 0.5f, 0.5f, 0.5f, 0.5f, 0.5f, 0.5f,
+  0.5f, 0.5f, 0.5f, 0.5f, 0.5f, 0.5f, 0.5f, 0.5f,
+  0.5f, 0.5f, 0.5f, 0.5f, 0.5f, 0.5f, 0.5f, 0.5f,
+  0.5f, 0.5f, 0.5f, 0.5f, 0.5f, 0.5f, 0.5f, 0.5f,
+  0.5f, 0.5f, 0.5f, 0.5f, 0.5f, 0.5225f, 0.5218f, 0.5211f,
+  0.5205f, 0.5199f, 0.5195f, 0.519f, 0.5186f, 0.5183f, 0.518f, 0.5178f,
+  0.5177f, 0.5175f, 0.5175f, 0.5175f, 0.5176f, 0.5177f, 0.5179f, 0.5182f,
+  0.5185f, 0.5189f, 0.5193f, 0.5195f, 0.5193f, 0.5189f, 0.5185f, 0.5182f,
+  0.5179f, 0.5177f, 0.5176f, 0.5175f, 0.5175f, 0.5175f, 0.5177f, 0.5178f,
+  0.518f, 0.5183f, 0.5186f, 0.519f, 0.5195f, 0.5199f, 0.5205f, 0.5211f,
+  0.5218f, 0.5225f, 0.5451f, 0.5436f, 0.5423f, 0.5411f, 0.54f, 0.539f,
+  0.5381f, 0.5373f, 0.5367f, 0.5361f, 0.5357f, 0.5353f, 0.5351f, 0.535f,
+  0.535f, 0.5351f, 0.5354f, 0.5357f, 0.5362f, 0.5367f, 0.5373f, 0.5378f,
+  0.538f, 0.5378f, 0.5373f, 0.5367f, 0.5362f, 0.5357f, 0.5354f, 0.5351f,
+  0.535f, 0.535f, 0.5351f, 0.5353f, 0.5357f, 0.5361f, 0.5367f, 0.5373f,
+  0.5381f, 0.539f, 0.54f, 0.5411f, 0.5423f, 0.5436f, 0.5451f, 0.5678f,
+  0.5657f, 0.5637f, 0.5619f, 0.5602f, 0.5587f, 0.5574f, 0.5562f, 0.5552f,
+  0.5543f, 0.5536f, 0.5531f, 0.5527f, 0.5525f, 0.5525f, 0.5526f, 0.5529f,
+  0.5533f, 0.5538f, 0.5544f, 0.555f, 0.5555f, 0.5557f, 0.5555f, 0.555f,
+  0.5544f, 0.5538f, 0.5533f, 0.5529f, 0.5526f, 0.5525f, 0.5525f, 0.5527f,
+  0.5531f, 0.5536f, 0.5543f, 0.5552f, 0.5562f, 0.5574f, 0.5587f, 0.5602f,
+  0.5619f, 0.5637f, 0.5657f, 0.5678f, 0.5909f, 0.588f, 0.5854f, 0.5829f,
+  0.5807f, 0.5786f, 0.5768f, 0.5753f, 0.5739f, 0.5727f, 0.5718f, 0.571f,
+  0.5705f, 0.5701f, 0.57f, 0.57f, 0.5703f, 0.5707f, 0.5712f, 0.5718f,
+  0.5723f, 0.5727f, 0.5729f, 0.5727f, 0.5723f, 0.5718f, 0.5712f, 0.5707f,
+  0.5703f, 0.57f, 0.57f, 0.5701f, 0.5705f, 0.571f, 0.5718f, 0.5727f,
+  0.5739f, 0.5753f, 0.5768f, 0.5786f, 0.5807f, 0.5829f, 0.5854f, 0.588f,
+  0.5909f, 0.6108f, 0.6074f, 0.6043f, 0.6015f, 0.5989f, 0.5967f, 0.5946f,
+  0.5929f, 0.5914f, 0.5901f, 0.5891f, 0.5883f, 0.5878f, 0.5875f, 0.5875f,
+  0.5876f, 0.5879f, 0.5883f, 0.5888f, 0.5893f, 0.5896f, 0.5897f, 0.5896f,
+  0.5893f, 0.5888f, 0.5883f, 0.5879f, 0.5876f, 0.5875f, 0.5875f, 0.5878f,
+  0.5883f, 0.5891f, 0.5901f, 0.5914f, 0.5929f, 0.5946f, 0.5967f, 0.5989f,
+  0.6015f, 0.6043f, 0.6074f, 0.6108f, 0.634f, 0.63f, 0.6262f, 0.6228f,
+  0.6197f, 0.6169f, 0.6144f, 0.6122f, 0.6103f, 0.6088f, 0.6075f, 0.6065f,
+  0.6057f, 0.6053f, 0.605f, 0.605f, 0.6051f, 0.6054f, 0.6057f, 0.6061f,
+  0.6063f, 0.6064f, 0.6063f, 0.6061f, 0.6057f, 0.6054f, 0.6051f, 0.605f,
+  0.605f, 0.6053f, 0.6057f, 0.6065f, 0.6075f, 0.6088f, 0.6103f, 0.6122f,
+  0.6144f, 0.6169f, 0.6197f, 0.6228f, 0.6262f, 0.63f, 0.634f, 0.6579f,
+  0.6531f, 0.6487f, 0.6447f, 0.641f, 0.6376f, 0.6347f, 0.632f, 0.6298f,
+  0.6278f, 0.6262f, 0.6249f, 0.6239f, 0.6232f, 0.6227f, 0.6225f, 0.6225f,
+  0.6226f, 0.6227f, 0.6229f, 0.6231f, 0.6231f, 0.6231f, 0.6229f, 0.6227f,
+  0.6226f, 0.6225f, 0.6225f, 0.6227f, 0.6232f, 0.6239f, 0.6249f, 0.6262f,
+  0.6278f, 0.6298f, 0.632f, 0.6347f, 0.6376f, 0.641f, 0.6447f, 0.6487f,
+  0.6531f, 0.6579f, 0.6825f, 0.677f, 0.6719f, 0.6672f, 0.6629f, 0.659f,
+  0.6555f, 0.6524f, 0.6497f, 0.6474f, 0.6454f, 0.6438f, 0.6425f, 0.6415f,
+  0.6408f, 0.6403f, 0.6401f, 0.64f, 0.64f, 0.64f, 0.6401f, 0.6401f,
+  0.6401f, 0.64f, 0.64f, 0.64f, 0.6401f, 0.6403f, 0.6408f, 0.6415f,
+  0.6425f, 0.6438f, 0.6454f, 0.6474f, 0.6497f, 0.6524f, 0.6555f, 0.659f,
+  0.6629f, 0.6672f, 0.6719f, 0.677f, 0.6825f, 0.7017f, 0.6959f, 0.6905f,
+  0.6856f, 0.6811f, 0.6771f, 0.6735f, 0.6703f, 0.6676f, 0.6652f, 0.6632f,
+  0.6616f, 0.6603f, 0.6593f, 0.6586f, 0.6581f, 0.6578f, 0.6576f, 0.6575f,
+  0.6575f, 0.6575f, 0.6575f, 0.6575f, 0.6576f, 0.6578f, 0.6581f, 0.6586f,
+  0.6593f, 0.6603f, 0.6616f, 0.6632f, 0.6652f, 0.6676f, 0.6703f, 0.6735f,
+  0.6771f, 0.6811f, 0.6856f, 0.6905f, 0.6959f, 0.7017f, 0.7273f, 0.7207f,
+  0.7147f, 0.7091f, 0.7041f, 0.6995f, 0.6954f, 0.6917f, 0.6885f, 0.6857f,
+  0.6834f, 0.6814f, 0.6797f, 0.6784f, 0.6774f, 0.6767f, 0.6762f, 0.6758f,
+  0.6756f, 0.6755f, 0.6754f, 0.6755f, 0.6756f, 0.6758f, 0.6762f, 0.6767f,
+  0.6774f, 0.6784f, 0.6797f, 0.6814f, 0.6834f, 0.6857f, 0.6885f, 0.6917f,
+  0.6954f, 0.6995f, 0.7041f, 0.7091f, 0.7147f, 0.7207f, 0.7273f, 0.7467f,
+  0.7399f, 0.7337f, 0.728f, 0.7228f, 0.7181f, 0.714f, 0.7103f, 0.7071f,
+  0.7043f, 0.7019f, 0.7f, 0.6983f, 0.697f, 0.696f, 0.6953f, 0.6947f,
+  0.6944f, 0.6942f, 0.6941f, 0.6942f, 0.6944f, 0.6947f, 0.6953f, 0.696f,
+  0.697f, 0.6983f, 0.7f, 0.7019f, 0.7043f, 0.7071f, 0.7103f, 0.714f,
+  0.7181f, 0.7228f, 0.728f, 0.7337f, 0.7399f, 0.7467f, 0.7737f, 0.7663f,
+  0.7594f, 0.753f, 0.7472f, 0.742f, 0.7373f, 0.7331f, 0.7294f, 0.7262f,
+  0.7234f, 0.7211f, 0.7191f, 0.7175f, 0.7163f, 0.7153f, 0.7145f, 0.714f,
+  0.7138f, 0.7137f, 0.7138f, 0.714f, 0.7145f, 0.7153f, 0.7163f, 0.7175f,
+  0.7191f, 0.7211f, 0.7234f, 0.7262f, 0.7294f, 0.7331f, 0.7373f, 0.742f,
+  0.7472f, 0.753f, 0.7594f, 0.7663f, 0.7737f, 0.7939f, 0.7863f, 0.7793f,
+  0.7729f, 0.767f, 0.7618f, 0.7571f, 0.7529f, 0.7492f, 0.746f, 0.7433f,
+  0.741f, 0.7391f, 0.7375f, 0.7363f, 0.7354f, 0.7348f, 0.7344f, 0.7343f,
+  0.7344f, 0.7348f, 0.7354f, 0.7363f, 0.7375f, 0.7391f, 0.741f, 0.7433f,
+  0.746f, 0.7492f, 0.7529f, 0.7571f, 0.7618f, 0.767f, 0.7729f, 0.7793f,
+  0.7863f, 0.7939f, 0.8146f, 0.807f, 0.7999f, 0.7934f, 0.7876f, 0.7823f,
+  0.7776f, 0.7735f, 0.7699f, 0.7667f, 0.7641f, 0.7618f, 0.76f, 0.7586f,
+  0.7575f, 0.7567f, 0.7562f, 0.7561f, 0.7562f, 0.7567f, 0.7575f, 0.7586f,
+  0.76f, 0.7618f, 0.7641f, 0.7667f, 0.7699f, 0.7735f, 0.7776f, 0.7823f,
+  0.7876f, 0.7934f, 0.7999f, 0.807f, 0.8146f, 0.8361f, 0.8284f, 0.8213f,
+  0.8149f, 0.809f, 0.8038f, 0.7992f, 0.7951f, 0.7916f, 0.7886f, 0.786f,
+  0.7839f, 0.7822f, 0.7809f, 0.78f, 0.7795f, 0.7793f, 0.7795f, 0.78f,
+  0.7809f, 0.7822f, 0.7839f, 0.786f, 0.7886f, 0.7916f, 0.7951f, 0.7992f,
+  0.8038f, 0.809f, 0.8149f, 0.8213f, 0.8284f, 0.8361f, 0.8585f, 0.8508f,
+  0.8438f, 0.8374f, 0.8316f, 0.8265f, 0.822f, 0.818f, 0.8146f, 0.8117f,
+  0.8093f, 0.8074f, 0.8059f, 0.8049f, 0.8042f, 0.804f, 0.8042f, 0.8049f,
+  0.8059f, 0.8074f, 0.8093f, 0.8117f, 0.8146f, 0.818f, 0.822f, 0.8265f,
+  0.8316f, 0.8374f, 0.8438f, 0.8508f, 0.8585f, 0.8821f, 0.8744f, 0.8675f,
+  0.8612f, 0.8555f, 0.8505f, 0.8461f, 0.8423f, 0.8391f, 0.8364f, 0.8342f,
+  0.8326f, 0.8314f, 0.8307f, 0.8305f, 0.8307f, 0.8314f, 0.8326f, 0.8342f,
+  0.8364f, 0.8391f, 0.8423f, 0.8461f, 0.8505f, 0.8555f, 0.8612f, 0.8675f,
+  0.8744f, 0.8821f, 0.907f, 0.8994f, 0.8926f, 0.8864f, 0.881f, 0.8761f,
+  0.872f, 0.8684f, 0.8654f, 0.863f, 0.8611f, 0.8598f, 0.859f, 0.8588f,
+  0.859f, 0.8598f, 0.8611f, 0.863f, 0.8654f, 0.8684f, 0.872f, 0.8761f,
+  0.881f, 0.8864f, 0.8926f, 0.8994f, 0.907f, 0.9334f, 0.9261f, 0.9194f,
+  0.9135f, 0.9082f, 0.9036f, 0.8997f, 0.8965f, 0.8938f, 0.8918f, 0.8903f,
+  0.8894f, 0.8891f, 0.8894f, 0.8903f, 0.8918f, 0.8938f, 0.8965f, 0.8997f,
+  0.9036f, 0.9082f, 0.9135f, 0.9194f, 0.9261f, 0.9334f, 0.9545f, 0.9482f,
+  0.9425f, 0.9375f, 0.9333f, 0.9297f, 0.9268f, 0.9246f, 0.923f, 0.922f,
+  0.9217f, 0.922f, 0.923f, 0.9246f, 0.9268f, 0.9297f, 0.9333f, 0.9375f,
+  0.9425f, 0.9482f, 0.9545f, 0.979f, 0.9737f, 0.9692f, 0.9653f, 0.9622f,
+  0.9597f, 0.958f, 0.957f, 0.9567f, 0.957f, 0.958f, 0.9597f, 0.9622f,
+  0.9653f, 0.9692f, 0.9737f, 0.979f, 1.0f, 0.9974f, 0.9956f, 0.9944f,
+  0.9941f, 0.9944f, 0.9956f, 0.9974f, 1.0f,
+};
+static const float osvr_display_mesh_built_in_osvr_hdk13_v2_eye0_to_y[] = {
+  0.4091f, 0.4322f, 0.4549f, 0.4775f, 0.5f, 0.5225f, 0.5451f, 0.5678f,
+  0.5909f, 0.3175f, 0.3421f, 0.366f, 0.3892f, 0.412f, 0.4343f, 0.4564f,
+  0.4782f, 0.5f, 0.5218f, 0.5436f, 0.5657f, 0.588f, 0.6108f, 0.634f,
+  0.6579f, 0.6825f, 0.2727f, 0.2983f, 0.323f, 0.3469f, 0.37f, 0.3926f,
+  0.4146f, 0.4363f, 0.4577f, 0.4789f, 0.5f, 0.5211f, 0.5423f, 0.5637f,
+  0.5854f, 0.6074f, 0.63f, 0.6531f, 0.677f, 0.7017f, 0.7273f, 0.2263f,
+  0.2533f, 0.2793f, 0.3041f, 0.3281f, 0.3513f, 0.3738f, 0.3957f, 0.4171f,
+  0.4381f, 0.4589f, 0.4795f, 0.5f, 0.5205f, 0.5411f, 0.5619f, 0.5829f,
+  0.6043f, 0.6262f, 0.6487f, 0.6719f, 0.6959f, 0.7207f, 0.7467f, 0.7737f,
+  0.2061f, 0.2337f, 0.2601f, 0.2853f, 0.3095f, 0.3328f, 0.3553f, 0.3772f,
+  0.3985f, 0.4193f, 0.4398f, 0.46f, 0.4801f, 0.5f, 0.5199f, 0.54f,
+  0.5602f, 0.5807f, 0.6015f, 0.6228f, 0.6447f, 0.6672f, 0.6905f, 0.7147f,
+  0.7399f, 0.7663f, 0.7939f, 0.1854f, 0.2137f, 0.2406f, 0.2663f, 0.2909f,
+  0.3144f, 0.3371f, 0.359f, 0.3803f, 0.4011f, 0.4214f, 0.4413f, 0.461f,
+  0.4805f, 0.5f, 0.5195f, 0.539f, 0.5587f, 0.5786f, 0.5989f, 0.6197f,
+  0.641f, 0.6629f, 0.6856f, 0.7091f, 0.7337f, 0.7594f, 0.7863f, 0.8146f,
+  0.1639f, 0.193f, 0.2207f, 0.247f, 0.272f, 0.2959f, 0.3189f, 0.341f,
+  0.3624f, 0.3831f, 0.4033f, 0.4232f, 0.4426f, 0.4619f, 0.481f, 0.5f,
+  0.519f, 0.5381f, 0.5574f, 0.5768f, 0.5967f, 0.6169f, 0.6376f, 0.659f,
+  0.6811f, 0.7041f, 0.728f, 0.753f, 0.7793f, 0.807f, 0.8361f, 0.1415f,
+  0.1716f, 0.2001f, 0.2271f, 0.2528f, 0.2772f, 0.3005f, 0.3229f, 0.3445f,
+  0.3653f, 0.3856f, 0.4054f, 0.4247f, 0.4438f, 0.4627f, 0.4814f, 0.5f,
+  0.5186f, 0.5373f, 0.5562f, 0.5753f, 0.5946f, 0.6144f, 0.6347f, 0.6555f,
+  0.6771f, 0.6995f, 0.7228f, 0.7472f, 0.7729f, 0.7999f, 0.8284f, 0.8585f,
+  0.1179f, 0.1492f, 0.1787f, 0.2066f, 0.233f, 0.258f, 0.2819f, 0.3046f,
+  0.3265f, 0.3476f, 0.368f, 0.3878f, 0.4071f, 0.4261f, 0.4448f, 0.4633f,
+  0.4817f, 0.5f, 0.5183f, 0.5367f, 0.5552f, 0.5739f, 0.5929f, 0.6122f,
+  0.632f, 0.6524f, 0.6735f, 0.6954f, 0.7181f, 0.742f, 0.767f, 0.7934f,
+  0.8213f, 0.8508f, 0.8821f, 0.09304f, 0.1256f, 0.1562f, 0.1851f, 0.2124f,
+  0.2382f, 0.2627f, 0.286f, 0.3083f, 0.3297f, 0.3503f, 0.3702f, 0.3897f,
+  0.4086f, 0.4273f, 0.4457f, 0.4639f, 0.482f, 0.5f, 0.518f, 0.5361f,
+  0.5543f, 0.5727f, 0.5914f, 0.6103f, 0.6298f, 0.6497f, 0.6703f, 0.6917f,
+  0.714f, 0.7373f, 0.7618f, 0.7876f, 0.8149f, 0.8438f, 0.8744f, 0.907f,
+  0.06657f, 0.1006f, 0.1325f, 0.1626f, 0.191f, 0.2177f, 0.2429f, 0.2669f,
+  0.2897f, 0.3115f, 0.3324f, 0.3526f, 0.3722f, 0.3912f, 0.4099f, 0.4282f,
+  0.4464f, 0.4643f, 0.4822f, 0.5f, 0.5178f, 0.5357f, 0.5536f, 0.5718f,
+  0.5901f, 0.6088f, 0.6278f, 0.6474f, 0.6676f, 0.6885f, 0.7103f, 0.7331f,
+  0.7571f, 0.7823f, 0.809f, 0.8374f, 0.8675f, 0.8994f, 0.9334f, 0.07394f,
+  0.1074f, 0.1388f, 0.1684f, 0.1962f, 0.2224f, 0.2471f, 0.2706f, 0.2929f,
+  0.3143f, 0.3348f, 0.3546f, 0.3738f, 0.3925f, 0.4109f, 0.429f, 0.4469f,
+  0.4647f, 0.4823f, 0.5f, 0.5177f, 0.5353f, 0.5531f, 0.571f, 0.5891f,
+  0.6075f, 0.6262f, 0.6454f, 0.6652f, 0.6857f, 0.7071f, 0.7294f, 0.7529f,
+  0.7776f, 0.8038f, 0.8316f, 0.8612f, 0.8926f, 0.9261f, 0.04545f, 0.08059f,
+  0.1136f, 0.1445f, 0.1735f, 0.2008f, 0.2265f, 0.2508f, 0.2738f, 0.2957f,
+  0.3166f, 0.3368f, 0.3562f, 0.3751f, 0.3935f, 0.4117f, 0.4295f, 0.4473f,
+  0.4649f, 0.4825f, 0.5f, 0.5175f, 0.5351f, 0.5527f, 0.5705f, 0.5883f,
+  0.6065f, 0.6249f, 0.6438f, 0.6632f, 0.6834f, 0.7043f, 0.7262f, 0.7492f,
+  0.7735f, 0.7992f, 0.8265f, 0.8555f, 0.8864f, 0.9194f, 0.9545f, 0.05185f,
+  0.08653f, 0.119f, 0.1495f, 0.178f, 0.2049f, 0.2301f, 0.254f, 0.2766f,
+  0.2981f, 0.3186f, 0.3384f, 0.3575f, 0.3761f, 0.3943f, 0.4122f, 0.4299f,
+  0.4475f, 0.465f, 0.4825f, 0.5f, 0.5175f, 0.535f, 0.5525f, 0.5701f,
+  0.5878f, 0.6057f, 0.6239f, 0.6425f, 0.6616f, 0.6814f, 0.7019f, 0.7234f,
+  0.746f, 0.7699f, 0.7951f, 0.822f, 0.8505f, 0.881f, 0.9135f, 0.9482f,
+  0.02095f, 0.05752f, 0.09178f, 0.1239f, 0.1539f, 0.182f, 0.2084f, 0.2333f,
+  0.2567f, 0.2789f, 0.3f, 0.3203f, 0.3397f, 0.3585f, 0.3768f, 0.3947f,
+  0.4125f, 0.43f, 0.4475f, 0.465f, 0.4825f, 0.5f, 0.5175f, 0.535f,
+  0.5525f, 0.57f, 0.5875f, 0.6053f, 0.6232f, 0.6415f, 0.6603f, 0.6797f,
+  0.7f, 0.7211f, 0.7433f, 0.7667f, 0.7916f, 0.818f, 0.8461f, 0.8761f,
+  0.9082f, 0.9425f, 0.979f, 0.02627f, 0.06247f, 0.09635f, 0.128f, 0.1577f,
+  0.1854f, 0.2114f, 0.2359f, 0.259f, 0.2809f, 0.3017f, 0.3216f, 0.3407f,
+  0.3592f, 0.3773f, 0.395f, 0.4125f, 0.43f, 0.4474f, 0.4649f, 0.4824f,
+  0.5f, 0.5176f, 0.5351f, 0.5526f, 0.57f, 0.5875f, 0.605f, 0.6227f,
+  0.6408f, 0.6593f, 0.6784f, 0.6983f, 0.7191f, 0.741f, 0.7641f, 0.7886f,
+  0.8146f, 0.8423f, 0.872f, 0.9036f, 0.9375f, 0.9737f, 0.03085f, 0.06673f,
+  0.1003f, 0.1316f, 0.1609f, 0.1883f, 0.214f, 0.2382f, 0.2609f, 0.2825f,
+  0.303f, 0.3226f, 0.3414f, 0.3597f, 0.3775f, 0.395f, 0.4124f, 0.4297f,
+  0.4471f, 0.4646f, 0.4823f, 0.5f, 0.5177f, 0.5354f, 0.5529f, 0.5703f,
+  0.5876f, 0.605f, 0.6225f, 0.6403f, 0.6586f, 0.6774f, 0.697f, 0.7175f,
+  0.7391f, 0.7618f, 0.786f, 0.8117f, 0.8391f, 0.8684f, 0.8997f, 0.9333f,
+  0.9692f, 0.0347f, 0.07029f, 0.1035f, 0.1346f, 0.1636f, 0.1907f, 0.2161f,
+  0.24f, 0.2625f, 0.2837f, 0.304f, 0.3233f, 0.3419f, 0.3599f, 0.3775f,
+  0.3949f, 0.4121f, 0.4293f, 0.4467f, 0.4643f, 0.4821f, 0.5f, 0.5179f,
+  0.5357f, 0.5533f, 0.5707f, 0.5879f, 0.6051f, 0.6225f, 0.6401f, 0.6581f,
+  0.6767f, 0.696f, 0.7163f, 0.7375f, 0.76f, 0.7839f, 0.8093f, 0.8364f,
+  0.8654f, 0.8965f, 0.9297f, 0.9653f, 0.0f, 0.03783f, 0.07319f, 0.1062f,
+  0.137f, 0.1658f, 0.1926f, 0.2178f, 0.2414f, 0.2637f, 0.2847f, 0.3047f,
+  0.3238f, 0.3422f, 0.36f, 0.3774f, 0.3946f, 0.4117f, 0.4288f, 0.4462f,
+  0.4638f, 0.4818f, 0.5f, 0.5182f, 0.5362f, 0.5538f, 0.5712f, 0.5883f,
+  0.6054f, 0.6226f, 0.64f, 0.6578f, 0.6762f, 0.6953f, 0.7153f, 0.7363f,
+  0.7586f, 0.7822f, 0.8074f, 0.8342f, 0.863f, 0.8938f, 0.9268f, 0.9622f,
+  1.0f, 0.002598f, 0.04025f, 0.07543f, 0.1082f, 0.1389f, 0.1674f, 0.1941f,
+  0.2191f, 0.2425f, 0.2646f, 0.2855f, 0.3053f, 0.3242f, 0.3424f, 0.36f,
+  0.3773f, 0.3943f, 0.4112f, 0.4282f, 0.4456f, 0.4633f, 0.4815f, 0.5f,
+  0.5185f, 0.5367f, 0.5544f, 0.5718f, 0.5888f, 0.6057f, 0.6227f, 0.64f,
+  0.6576f, 0.6758f, 0.6947f, 0.7145f, 0.7354f, 0.7575f, 0.7809f, 0.8059f,
+  0.8326f, 0.8611f, 0.8918f, 0.9246f, 0.9597f, 0.9974f, 0.00445f, 0.04197f,
+  0.07702f, 0.1097f, 0.1402f, 0.1686f, 0.1951f, 0.22f, 0.2433f, 0.2652f,
+  0.286f, 0.3056f, 0.3244f, 0.3425f, 0.36f, 0.3771f, 0.3939f, 0.4107f,
+  0.4277f, 0.445f, 0.4627f, 0.4811f, 0.5f, 0.5189f, 0.5373f, 0.555f,
+  0.5723f, 0.5893f, 0.6061f, 0.6229f, 0.64f, 0.6575f, 0.6756f, 0.6944f,
+  0.714f, 0.7348f, 0.7567f, 0.78f, 0.8049f, 0.8314f, 0.8598f, 0.8903f,
+  0.923f, 0.958f, 0.9956f, 0.005558f, 0.04301f, 0.07797f, 0.1106f, 0.141f,
+  0.1693f, 0.1958f, 0.2205f, 0.2438f, 0.2656f, 0.2862f, 0.3058f, 0.3245f,
+  0.3425f, 0.3599f, 0.3769f, 0.3937f, 0.4104f, 0.4273f, 0.4445f, 0.4622f,
+  0.4807f, 0.5f, 0.5193f, 0.5378f, 0.5555f, 0.5727f, 0.5896f, 0.6063f,
+  0.6231f, 0.6401f, 0.6575f, 0.6755f, 0.6942f, 0.7138f, 0.7344f, 0.7562f,
+  0.7795f, 0.8042f, 0.8307f, 0.859f, 0.8894f, 0.922f, 0.957f, 0.9944f,
+  0.005927f, 0.04335f, 0.07828f, 0.1109f, 0.1412f, 0.1695f, 0.196f, 0.2207f,
+  0.2439f, 0.2657f, 0.2863f, 0.3059f, 0.3246f, 0.3425f, 0.3599f, 0.3769f,
+  0.3936f, 0.4103f, 0.4271f, 0.4443f, 0.462f, 0.4805f, 0.5f, 0.5195f,
+  0.538f, 0.5557f, 0.5729f, 0.5897f, 0.6064f, 0.6231f, 0.6401f, 0.6575f,
+  0.6754f, 0.6941f, 0.7137f, 0.7343f, 0.7561f, 0.7793f, 0.804f, 0.8305f,
+  0.8588f, 0.8891f, 0.9217f, 0.9567f, 0.9941f, 0.005558f, 0.04301f, 0.07797f,
+  0.1106f, 0.141f, 0.1693f, 0.1958f, 0.2205f, 0.2438f, 0.2656f, 0.2862f,
+  0.3058f, 0.3245f, 0.3425f, 0.3599f, 0.3769f, 0.3937f, 0.4104f, 0.4273f,
+  0.4445f, 0.4622f, 0.4807f, 0.5f, 0.5193f, 0.5378f, 0.5555f, 0.5727f,
+  0.5896f, 0.6063f, 0.6231f, 0.6401f, 0.6575f, 0.6755f, 0.6942f, 0.7138f,
+  0.7344f, 0.7562f, 0.7795f, 0.8042f, 0.8307f, 0.859f, 0.8894f, 0.922f,
+  0.957f, 0.9944f, 0.00445f, 0.04197f, 0.07702f, 0.1097f, 0.1402f, 0.1686f,
+  0.1951f, 0.22f, 0.2433f, 0.2652f, 0.286f, 0.3056f, 0.3244f, 0.3425f,
+  0.36f, 0.3771f, 0.3939f, 0.4107f, 0.4277f, 0.445f, 0.4627f, 0.4811f,
+  0.5f, 0.5189f, 0.5373f, 0.555f, 0.5723f, 0.5893f, 0.6061f, 0.6229f,
+  0.64f, 0.6575f, 0.6756f, 0.6944f, 0.714f, 0.7348f, 0.7567f, 0.78f,
+  0.8049f, 0.8314f, 0.8598f, 0.8903f, 0.923f, 0.958f, 0.9956f, 0.002598f,
+  0.04025f, 0.07543f, 0.1082f, 0.1389f, 0.1674f, 0.1941f, 0.2191f, 0.2425f,
+  0.2646f, 0.2855f, 0.3053f, 0.3242f, 0.3424f, 0.36f, 0.3773f, 0.3943f,
+  0.4112f, 0.4282f, 0.4456f, 0.4633f, 0.4815f, 0.5f, 0.5185f, 0.5367f,
+  0.5544f, 0.5718f, 0.5888f, 0.6057f, 0.6227f, 0.64f, 0.6576f, 0.6758f,
+  0.6947f, 0.7145f, 0.7354f, 0.7575f, 0.7809f, 0.8059f, 0.8326f, 0.8611f,
+  0.8918f, 0.9246f, 0.9597f, 0.9974f, 0.0f, 0.03783f, 0.07319f, 0.1062f,
+  0.137f, 0.1658f, 0.1926f, 0.2178f, 0.2414f, 0.2637f, 0.2847f, 0.3047f,
+  0.3238f, 0.3422f, 0.36f, 0.3774f, 0.3946f, 0.4117f, 0.4288f, 0.4462f,
+  0.4638f, 0.4818f, 0.5f, 0.5182f, 0.5362f, 0.5538f, 0.5712f, 0.5883f,
+  0.6054f, 0.6226f, 0.64f, 0.6578f, 0.6762f, 0.6953f, 0.7153f, 0.7363f,
+  0.7586f, 0.7822f, 0.8074f, 0.8342f, 0.863f, 0.8938f, 0.9268f, 0.9622f,
+  1.0f, 0.0347f, 0.07029f, 0.1035f, 0.1346f, 0.1636f, 0.1907f, 0.2161f,
+  0.24f, 0.2625f, 0.2837f, 0.304f, 0.3233f, 0.3419f, 0.3599f, 0.3775f,
+  0.3949f, 0.4121f, 0.4293f, 0.4467f, 0.4643f, 0.4821f, 0.5f, 0.5179f,
+  0.5357f, 0.5533f, 0.5707f, 0.5879f, 0.6051f, 0.6225f, 0.6401f, 0.6581f,
+  0.6767f, 0.696f, 0.7163f, 0.7375f, 0.76f, 0.7839f, 0.8093f, 0.8364f,
+  0.8654f, 0.8965f, 0.9297f, 0.9653f, 0.03085f, 0.06673f, 0.1003f, 0.1316f,
+  0.1609f, 0.1883f, 0.214f, 0.2382f, 0.2609f, 0.2825f, 0.303f, 0.3226f,
+  0.3414f, 0.3597f, 0.3775f, 0.395f, 0.4124f, 0.4297f, 0.4471f, 0.4646f,
+  0.4823f, 0.5f, 0.5177f, 0.5354f, 0.5529f, 0.5703f, 0.5876f, 0.605f,
+  0.6225f, 0.6403f, 0.6586f, 0.6774f, 0.697f, 0.7175f, 0.7391f, 0.7618f,
+  0.786f, 0.8117f, 0.8391f, 0.8684f, 0.8997f, 0.9333f, 0.9692f, 0.02627f,
+  0.06247f, 0.09635f, 0.128f, 0.1577f, 0.1854f, 0.2114f, 0.2359f, 0.259f,
+  0.2809f, 0.3017f, 0.3216f, 0.3407f, 0.3592f, 0.3773f, 0.395f, 0.4125f,
+  0.43f, 0.4474f, 0.4649f, 0.4824f, 0.5f, 0.5176f, 0.5351f, 0.5526f,
+  0.57f, 0.5875f, 0.605f, 0.6227f, 0.6408f, 0.6593f, 0.6784f, 0.6983f,
+  0.7191f, 0.741f, 0.7641f, 0.7886f, 0.8146f, 0.8423f, 0.872f, 0.9036f,
+  0.9375f, 0.9737f, 0.02095f, 0.05752f, 0.09178f, 0.1239f, 0.1539f, 0.182f,
+  0.2084f, 0.2333f, 0.2567f, 0.2789f, 0.3f, 0.3203f, 0.3397f, 0.3585f,
+  0.3768f, 0.3947f, 0.4125f, 0.43f, 0.4475f, 0.465f, 0.4825f, 0.5f,
+  0.5175f, 0.535f, 0.5525f, 0.57f, 0.5875f, 0.6053f, 0.6232f, 0.6415f,
+  0.6603f, 0.6797f, 0.7f, 0.7211f, 0.7433f, 0.7667f, 0.7916f, 0.818f,
+  0.8461f, 0.8761f, 0.9082f, 0.9425f, 0.979f, 0.05185f, 0.08653f, 0.119f,
+  0.1495f, 0.178f, 0.2049f, 0.2301f, 0.254f, 0.2766f, 0.2981f, 0.3186f,
+  0.3384f, 0.3575f, 0.3761f, 0.3943f, 0.4122f, 0.4299f, 0.4475f, 0.465f,
+  0.4825f, 0.5f, 0.5175f, 0.535f, 0.5525f, 0.5701f, 0.5878f, 0.6057f,
+  0.6239f, 0.6425f, 0.6616f, 0.6814f, 0.7019f, 0.7234f, 0.746f, 0.7699f,
+  0.7951f, 0.822f, 0.8505f, 0.881f, 0.9135f, 0.9482f, 0.04545f, 0.08059f,
+  0.1136f, 0.1445f, 0.1735f, 0.2008f, 0.2265f, 0.2508f, 0.2738f, 0.2957f,
+  0.3166f, 0.3368f, 0.3562f, 0.3751f, 0.3935f, 0.4117f, 0.4295f, 0.4473f,
+  0.4649f, 0.4825f, 0.5f, 0.5175f, 0.5351f, 0.5527f, 0.5705f, 0.5883f,
+  0.6065f, 0.6249f, 0.6438f, 0.6632f, 0.6834f, 0.7043f, 0.7262f, 0.7492f,
+  0.7735f, 0.7992f, 0.8265f, 0.8555f, 0.8864f, 0.9194f, 0.9545f, 0.07394f,
+  0.1074f, 0.1388f, 0.1684f, 0.1962f, 0.2224f, 0.2471f, 0.2706f, 0.2929f,
+  0.3143f, 0.3348f, 0.3546f, 0.3738f, 0.3925f, 0.4109f, 0.429f, 0.4469f,
+  0.4647f, 0.4823f, 0.5f, 0.5177f, 0.5353f, 0.5531f, 0.571f, 0.5891f,
+  0.6075f, 0.6262f, 0.6454f, 0.6652f, 0.6857f, 0.7071f, 0.7294f, 0.7529f,
+  0.7776f, 0.8038f, 0.8316f, 0.8612f, 0.8926f, 0.9261f, 0.06657f, 0.1006f,
+  0.1325f, 0.1626f, 0.191f, 0.2177f, 0.2429f, 0.2669f, 0.2897f, 0.3115f,
+  0.3324f, 0.3526f, 0.3722f, 0.3912f, 0.4099f, 0.4282f, 0.4464f, 0.4643f,
+  0.4822f, 0.5f, 0.5178f, 0.5357f, 0.5536f, 0.5718f, 0.5901f, 0.6088f,
+  0.6278f, 0.6474f, 0.6676f, 0.6885f, 0.7103f, 0.7331f, 0.7571f, 0.7823f,
+  0.809f, 0.8374f, 0.8675f, 0.8994f, 0.9334f, 0.09304f, 0.1256f, 0.1562f,
+  0.1851f, 0.2124f, 0.2382f, 0.2627f, 0.286f, 0.3083f, 0.3297f, 0.3503f,
+  0.3702f, 0.3897f, 0.4086f, 0.4273f, 0.4457f, 0.4639f, 0.482f, 0.5f,
+  0.518f, 0.5361f, 0.5543f, 0.5727f, 0.5914f, 0.6103f, 0.6298f, 0.6497f,
+  0.6703f, 0.6917f, 0.714f, 0.7373f, 0.7618f, 0.7876f, 0.8149f, 0.8438f,
+  0.8744f, 0.907f, 0.1179f, 0.1492f, 0.1787f, 0.2066f, 0.233f, 0.258f,
+  0.2819f, 0.3046f, 0.3265f, 0.3476f, 0.368f, 0.3878f, 0.4071f, 0.4261f,
+  0.4448f, 0.4633f, 0.4817f, 0.5f, 0.5183f, 0.5367f, 0.5552f, 0.5739f,
+  0.5929f, 0.6122f, 0.632f, 0.6524f, 0.6735f, 0.6954f, 0.7181f, 0.742f,
+  0.767f, 0.7934f, 0.8213f, 0.8508f, 0.8821f, 0.1415f, 0.1716f, 0.2001f,
+  0.2271f, 0.2528f, 0.2772f, 0.3005f, 0.3229f, 0.3445f, 0.3653f, 0.3856f,
+  0.4054f, 0.4247f, 0.4438f, 0.4627f, 0.4814f, 0.5f, 0.5186f, 0.5373f,
+  0.5562f, 0.5753f, 0.5946f, 0.6144f, 0.6347f, 0.6555f, 0.6771f, 0.6995f,
+  0.7228f, 0.7472f, 0.7729f, 0.7999f, 0.8284f, 0.8585f, 0.1639f, 0.193f,
+  0.2207f, 0.247f, 0.272f, 0.2959f, 0.3189f, 0.341f, 0.3624f, 0.3831f,
+  0.4033f, 0.4232f, 0.4426f, 0.4619f, 0.481f, 0.5f, 0.519f, 0.5381f,
+  0.5574f, 0.5768f, 0.5967f, 0.6169f, 0.6376f, 0.659f, 0.6811f, 0.7041f,
+  0.728f, 0.753f, 0.7793f, 0.807f, 0.8361f, 0.1854f, 0.2137f, 0.2406f,
+  0.2663f, 0.2909f, 0.3144f, 0.3371f, 0.359f, 0.3803f, 0.4011f, 0.4214f,
+  0.4413f, 0.461f, 0.4805f, 0.5f, 0.5195f, 0.539f, 0.5587f, 0.5786f,
+  0.5989f, 0.6197f, 0.641f, 0.6629f, 0.6856f, 0.7091f, 0.7337f, 0.7594f,
+  0.7863f, 0.8146f, 0.2061f, 0.2337f, 0.2601f, 0.2853f, 0.3095f, 0.3328f,
+  0.3553f, 0.3772f, 0.3985f, 0.4193f, 0.4398f, 0.46f, 0.4801f, 0.5f,
+  0.5199f, 0.54f, 0.5602f, 0.5807f, 0.6015f, 0.6228f, 0.6447f, 0.6672f,
+  0.6905f, 0.7147f, 0.7399f, 0.7663f, 0.7939f, 0.2263f, 0.2533f, 0.2793f,
+  0.3041f, 0.3281f, 0.3513f, 0.3738f, 0.3957f, 0.4171f, 0.4381f, 0.4589f,
+  0.4795f, 0.5f, 0.5205f, 0.5411f, 0.5619f, 0.5829f, 0.6043f, 0.6262f,
+  0.6487f, 0.6719f, 0.6959f, 0.7207f, 0.7467f, 0.7737f, 0.2727f, 0.2983f,
+  0.323f, 0.3469f, 0.37f, 0.3926f, 0.4146f, 0.4363f, 0.4577f, 0.4789f,
+  0.5f, 0.5211f, 0.5423f, 0.5637f, 0.5854f, 0.6074f, 0.63f, 0.6531f,
+  0.677f, 0.7017f, 0.7273f, 0.3175f, 0.3421f, 0.366f, 0.3892f, 0.412f,
+  0.4343f, 0.4564f, 0.4782f, 0.5f, 0.5218f, 0.5436f, 0.5657f, 0.588f,
+  0.6108f, 0.634f, 0.6579f, 0.6825f, 0.4091f, 0.4322f, 0.4549f, 0.4775f,
+  0.5f, 0.5225f, 0.5451f, 0.5678f, 0.5909f,
+};
+static const float osvr_display_mesh_built_in_osvr_hdk13_v2_eye1_from_x[] = {
+  0.9874f, 0.9874f, 0.9874f, 0.9874f, 0.9874f, 0.9874f, 0.9874f, 0.9874f,
+  0.9874f, 0.9666f, 0.9666f, 0.9666f, 0.9666f, 0.9666f, 0.9666f, 0.9666f,
+  0.9666f, 0.9666f, 0.9666f, 0.9666f, 0.9666f, 0.9666f, 0.9666f, 0.9666f,
+  0.9666f, 0.9666f, 0.9458f, 0.9458f, 0.9458f, 0.9458f, 0.9458f, 0.9458f,
+  0.9458f, 0.9458f, 0.9458f, 0.9458f, 0.9458f, 0.9458f, 0.9458f, 0.9458f,
+  0.9458f, 0.9458f, 0.9458f, 0.9458f, 0.9458f, 0.9458f, 0.9458f, 0.9249f,
+  0.9249f, 0.9249f, 0.9249f, 0.9249f, 0.9249f, 0.9249f, 0.9249f, 0.9249f,
+  0.9249f, 0.9249f, 0.9249f, 0.9249f, 0.9249f, 0.9249f, 0.9249f, 0.9249f,
+  0.9249f, 0.9249f, 0.9249f, 0.9249f, 0.9249f, 0.9249f, 0.9249f, 0.9249f,
+  0.9041f, 0.9041f, 0.9041f, 0.9041f, 0.9041f, 0.9041f, 0.9041f, 0.9041f,
+  0.9041f, 0.9041f, 0.9041f, 0.9041f, 0.9041f, 0.9041f, 0.9041f, 0.9041f,
+  0.9041f, 0.9041f, 0.9041f, 0.9041f, 0.9041f, 0.9041f, 0.9041f, 0.9041f,
+  0.9041f, 0.9041f, 0.9041f, 0.8833f, 0.8833f, 0.8833f, 0.8833f, 0.8833f,
+  0.8833f, 0.8833f, 0.8833f, 0.8833f, 0.8833f, 0.8833f, 0.8833f, 0.8833f,
+  0.8833f, 0.8833f, 0.8833f, 0.8833f, 0.8833f, 0.8833f, 0.8833f, 0.8833f,
+  0.8833f, 0.8833f, 0.8833f, 0.8833f, 0.8833f, 0.8833f, 0.8833f, 0.8833f,
+  0.8624f, 0.8624f, 0.8624f, 0.8624f, 0.8624f, 0.8624f, 0.8624f, 0.8624f,
+  0.8624f, 0.8624f, 0.8624f, 0.8624f, 0.8624f, 0.8624f, 0.8624f, 0.8624f,
+  0.8624f, 0.8624f, 0.8624f, 0.8624f, 0.8624f, 0.8624f, 0.8624f, 0.8624f,
+  0.8624f, 0.8624f, 0.8624f, 0.8624f, 0.8624f, 0.8624f, 0.8624f, 0.8416f,
+  0.8416f, 0.8416f, 0.8416f, 0.8416f, 0.8416f, 0.8416f, 0.8416f, 0.8416f,
+  0.8416f, 0.8416f, 0.8416f, 0.8416f, 0.8416f, 0.8416f, 0.8416f, 0.8416f,
+  0.8416f, 0.8416f, 0.8416f, 0.8416f, 0.8416f, 0.8416f, 0.8416f, 0.8416f,
+  0.8416f, 0.8416f, 0.8416f, 0.8416f, 0.8416f, 0.8416f, 0.8416f, 0.8416f,
+  0.8208f, 0.8208f, 0.8208f, 0.8208f, 0.8208f, 0.8208f, 0.8208f, 0.8208f,
+  0.8208f, 0.8208f, 0.8208f, 0.8208f, 0.8208f, 0.8208f, 0.8208f, 0.8208f,
+  0.8208f, 0.8208f, 0.8208f, 0.8208f, 0.8208f, 0.8208f, 0.8208f, 0.8208f,
+  0.8208f, 0.8208f, 0.8208f, 0.8208f, 0.8208f, 0.8208f, 0.8208f, 0.8208f,
+  0.8208f, 0.8208f, 0.8208f, 0.7999f, 0.7999f, 0.7999f, 0.7999f, 0.7999f,
+  0.7999f, 0.7999f, 0.7999f, 0.7999f, 0.7999f, 0.7999f, 0.7999f, 0.7999f,
+  0.7999f, 0.7999f, 0.7999f, 0.7999f, 0.7999f, 0.7999f, 0.7999f, 0.7999f,
+  0.7999f, 0.7999f, 0.7999f, 0.7999f, 0.7999f, 0.7999f, 0.7999f, 0.7999f,
+  0.7999f, 0.7999f, 0.7999f, 0.7999f, 0.7999f, 0.7999f, 0.7999f, 0.7999f,
+  0.7791f, 0.7791f, 0.7791f, 0.7791f, 0.7791f, 0.7791f, 0.7791f, 0.7791f,
+  0.7791f, 0.7791f, 0.7791f, 0.7791f, 0.7791f, 0.7791f, 0.7791f, 0.7791f,
+  0.7791f, 0.7791f, 0.7791f, 0.7791f, 0.7791f, 0.7791f, 0.7791f, 0.7791f,
+  0.7791f, 0.7791f, 0.7791f, 0.7791f, 0.7791f, 0.7791f, 0.7791f, 0.7791f,
+  0.7791f, 0.7791f, 0.7791f, 0.7791f, 0.7791f, 0.7791f, 0.7791f, 0.7583f,
+  0.7583f, 0.7583f, 0.7583f, 0.7583f, 0.7583f, 0.7583f, 0.7583f, 0.7583f,
+  0.7583f, 0.7583f, 0.7583f, 0.7583f, 0.7583f, 0.7583f, 0.7583f, 0.7583f,
+  0.7583f, 0.7583f, 0.7583f, 0.7583f, 0.7583f, 0.7583f, 0.7583f, 0.7583f,
+  0.7583f, 0.7583f, 0.7583f, 0.7583f, 0.7583f, 0.7583f, 0.7583f, 0.7583f,
+  0.7583f, 0.7583f, 0.7583f, 0.7583f, 0.7583f, 0.7583f, 0.7374f, 0.7374f,
+  0.7374f, 0.7374f, 0.7374f, 0.7374f, 0.7374f, 0.7374f, 0.7374f, 0.7374f,
+  0.7374f, 0.7374f, 0.7374f, 0.7374f, 0.7374f, 0.7374f, 0.7374f, 0.7374f,
+  0.7374f, 0.7374f, 0.7374f, 0.7374f, 0.7374f, 0.7374f, 0.7374f, 0.7374f,
+  0.7374f, 0.7374f, 0.7374f, 0.7374f, 0.7374f, 0.7374f, 0.7374f, 0.7374f,
+  0.7374f, 0.7374f, 0.7374f, 0.7374f, 0.7374f, 0.7374f, 0.7374f, 0.7166f,
+  0.7166f, 0.7166f, 0.7166f, 0.7166f, 0.7166f, 0.7166f, 0.7166f, 0.7166f,
+  0.7166f, 0.7166f, 0.7166f, 0.7166f, 0.7166f, 0.7166f, 0.7166f, 0.7166f,
+  0.7166f, 0.7166f, 0.7166f, 0.7166f, 0.7166f, 0.7166f, 0.7166f, 0.7166f,
+  0.7166f, 0.7166f, 0.7166f, 0.7166f, 0.7166f, 0.7166f, 0.7166f, 0.7166f,
+  0.7166f, 0.7166f, 0.7166f, 0.7166f, 0.7166f, 0.7166f, 0.7166f, 0.7166f,
+  0.6958f, 0.6958f, 0.6958f, 0.6958f, 0.6958f, 0.6958f, 0.6958f, 0.6958f,
+  0.6958f, 0.6958f, 0.6958f, 0.6958f, 0.6958f, 0.6958f, 0.6958f, 0.6958f,
+  0.6958f, 0.6958f, 0.6958f, 0.6958f, 0.6958f, 0.6958f, 0.6958f, 0.6958f,
+  0.6958f, 0.6958f, 0.6958f, 0.6958f, 0.6958f, 0.6958f, 0.6958f, 0.6958f,
+  0.6958f, 0.6958f, 0.6958f, 0.6958f, 0.6958f, 0.6958f, 0.6958f, 0.6958f,
+  0.6958f, 0.6958f, 0.6958f, 0.6749f, 0.6749f, 0.6749f, 0.6749f, 0.6749f,
+  0.6749f, 0.6749f, 0.6749f, 0.6749f, 0.6749f, 0.6749f, 0.6749f, 0.6749f,
+  0.6749f, 0.6749f, 0.6749f, 0.6749f, 0.6749f, 0.6749f, 0.6749f, 0.6749f,
+  0.6749f, 0.6749f, 0.6749f, 0.6749f, 0.6749f, 0.6749f, 0.6749f, 0.6749f,
+  0.6749f, 0.6749f, 0.6749f, 0.6749f, 0.6749f, 0.6749f, 0.6749f, 0.6749f,
+  0.6749f, 0.6749f, 0.6749f, 0.6749f, 0.6749f, 0.6749f, 0.6541f, 0.6541f,
+  0.6541f, 0.6541f, 0.6541f, 0.6541f, 0.6541f, 0.6541f, 0.6541f, 0.6541f,
+  0.6541f, 0.6541f, 0.6541f, 0.6541f, 0.6541f, 0.6541f, 0.6541f, 0.6541f,
+  0.6541f, 0.6541f, 0.6541f, 0.6541f, 0.6541f, 0.6541f, 0.6541f, 0.6541f,
+  0.6541f, 0.6541f, 0.6541f, 0.6541f, 0.6541f, 0.6541f, 0.6541f, 0.6541f,
+  0.6541f, 0.6541f, 0.6541f, 0.6541f, 0.6541f, 0.6541f, 0.6541f, 0.6541f,
+  0.6541f, 0.6333f, 0.6333f, 0.6333f, 0.6333f, 0.6333f, 0.6333f, 0.6333f,
+  0.6333f, 0.6333f, 0.6333f, 0.6333f, 0.6333f, 0.6333f, 0.6333f, 0.6333f,
+  0.6333f, 0.6333f, 0.6333f, 0.6333f, 0.6333f, 0.6333f, 0.6333f, 0.6333f,
+  0.6333f, 0.6333f, 0.6333f, 0.6333f, 0.6333f, 0.6333f, 0.6333f, 0.6333f,
+  0.6333f, 0.6333f, 0.6333f, 0.6333f, 0.6333f, 0.6333f, 0.6333f, 0.6333f,
+  0.6333f, 0.6333f, 0.6333f, 0.6333f, 0.6124f, 0.6124f, 0.6124f, 0.6124f,
+  0.6124f, 0.6124f, 0.6124f, 0.6124f, 0.6124f, 0.6124f, 0.6124f, 0.6124f,
+  0.6124f, 0.6124f, 0.6124f, 0.6124f, 0.6124f, 0.6124f, 0.6124f, 0.6124f,
+  0.6124f, 0.6124f, 0.6124f, 0.6124f, 0.6124f, 0.6124f, 0.6124f, 0.6124f,
+  0.6124f, 0.6124f, 0.6124f, 0.6124f, 0.6124f, 0.6124f, 0.6124f, 0.6124f,
+  0.6124f, 0.6124f, 0.6124f, 0.6124f, 0.6124f, 0.6124f, 0.6124f, 0.6124f,
+  0.6124f, 0.5916f, 0.5916f, 0.5916f, 0.5916f, 0.5916f, 0.5916f, 0.5916f,
+  0.5916f, 0.5916f, 0.5916f, 0.5916f, 0.5916f, 0.5916f, 0.5916f, 0.5916f,
+  0.5916f, 0.5916f, 0.5916f, 0.5916f, 0.5916f, 0.5916f, 0.5916f, 0.5916f,
+  0.5916f, 0.5916f, 0.5916f, 0.5916f, 0.5916f, 0.5916f, 0.5916f, 0.5916f,
+  0.5916f, 0.5916f, 0.5916f, 0.5916f, 0.5916f, 0.5916f, 0.5916f, 0.5916f,
+  0.5916f, 0.5916f, 0.5916f, 0.5916f, 0.5916f, 0.5916f, 0.5708f, 0.5708f,
+  0.5708f, 0.5708f, 0.5708f, 0.5708f, 0.5708f, 0.5708f, 0.5708f, 0.5708f,
+  0.5708f, 0.5708f, 0.5708f, 0.5708f, 0.5708f, 0.5708f, 0.5708f, 0.5708f,
+  0.5708f, 0.5708f, 0.5708f, 0.5708f, 0.5708f, 0.5708f, 0.5708f, 0.5708f,
+  0.5708f, 0.5708f, 0.5708f, 0.5708f, 0.5708f, 0.5708f, 0.5708f, 0.5708f,
+  0.5708f, 0.5708f, 0.5708f, 0.5708f, 0.5708f, 0.5708f, 0.5708f, 0.5708f,
+  0.5708f, 0.5708f, 0.5708f, 0.5499f, 0.5499f, 0.5499f, 0.5499f, 0.5499f,
+  0.5499f, 0.5499f, 0.5499f, 0.5499f, 0.5499f, 0.5499f, 0.5499f, 0.5499f,
+  0.5499f, 0.5499f, 0.5499f, 0.5499f, 0.5499f, 0.5499f, 0.5499f, 0.5499f,
+  0.5499f, 0.5499f, 0.5499f, 0.5499f, 0.5499f, 0.5499f, 0.5499f, 0.5499f,
+  0.5499f, 0.5499f, 0.5499f, 0.5499f, 0.5499f, 0.5499f, 0.5499f, 0.5499f,
+  0.5499f, 0.5499f, 0.5499f, 0.5499f, 0.5499f, 0.5499f, 0.5499f, 0.5499f,
+  0.5291f, 0.5291f, 0.5291f, 0.5291f, 0.5291f, 0.5291f, 0.5291f, 0.5291f,
+  0.5291f, 0.5291f, 0.5291f, 0.5291f, 0.5291f, 0.5291f, 0.5291f, 0.5291f,
+  0.5291f, 0.5291f, 0.5291f, 0.5291f, 0.5291f, 0.5291f, 0.5291f, 0.5291f,
+  0.5291f, 0.5291f, 0.5291f, 0.5291f, 0.5291f, 0.5291f, 0.5291f, 0.5291f,
+  0.5291f, 0.5291f, 0.5291f, 0.5291f, 0.5291f, 0.5291f, 0.5291f, 0.5291f,
+  0.5291f, 0.5291f, 0.5291f, 0.5291f, 0.5291f, 0.5083f, 0.5083f, 0.5083f,
+  0.5083f, 0.5083f, 0.5083f, 0.5083f, 0.5083f, 0.5083f, 0.5083f, 0.5083f,
+  0.5083f, 0.5083f, 0.5083f, 0.5083f, 0.5083f, 0.5083f, 0.5083f, 0.5083f,
+  0.5083f, 0.5083f, 0.5083f, 0.5083f, 0.5083f, 0.5083f, 0.5083f, 0.5083f,
+  0.5083f, 0.5083f, 0.5083f, 0.5083f, 0.5083f, 0.5083f, 0.5083f, 0.5083f,
+  0.5083f, 0.5083f, 0.5083f, 0.5083f, 0.5083f, 0.5083f, 0.5083f, 0.5083f,
+  0.5083f, 0.5083f, 0.4874f, 0.4874f, 0.4874f, 0.4874f, 0.4874f, 0.4874f,
+  0.4874f, 0.4874f, 0.4874f, 0.4874f, 0.4874f, 0.4874f, 0.4874f, 0.4874f,
+  0.4874f, 0.4874f, 0.4874f, 0.4874f, 0.4874f, 0.4874f, 0.4874f, 0.4874f,
+  0.4874f, 0.4874f, 0.4874f, 0.4874f, 0.4874f, 0.4874f, 0.4874f, 0.4874f,
+  0.4874f, 0.4874f, 0.4874f, 0.4874f, 0.4874f, 0.4874f, 0.4874f, 0.4874f,
+  0.4874f, 0.4874f, 0.4874f, 0.4874f, 0.4874f, 0.4874f, 0.4874f, 0.4666f,
+  0.4666f, 0.4666f, 0.4666f, 0.4666f, 0.4666f, 0.4666f, 0.4666f, 0.4666f,
+  0.4666f, 0.4666f, 0.4666f, 0.4666f, 0.4666f, 0.4666f, 0.4666f, 0.4666f,
+  0.4666f, 0.4666f, 0.4666f, 0.4666f, 0.4666f, 0.4666f, 0.4666f, 0.4666f,
+  0.4666f, 0.4666f, 0.4666f, 0.4666f, 0.4666f, 0.4666f, 0.4666f, 0.4666f,
+  0.4666f, 0.4666f, 0.4666f, 0.4666f, 0.4666f, 0.4666f, 0.4666f, 0.4666f,
+  0.4666f, 0.4666f, 0.4666f, 0.4666f, 0.4458f, 0.4458f, 0.4458f, 0.4458f,
+  0.4458f, 0.4458f, 0.4458f, 0.4458f, 0.4458f, 0.4458f, 0.4458f, 0.4458f,
+  0.4458f, 0.4458f, 0.4458f, 0.4458f, 0.4458f, 0.4458f, 0.4458f, 0.4458f,
+  0.4458f, 0.4458f, 0.4458f, 0.4458f, 0.4458f, 0.4458f, 0.4458f, 0.4458f,
+  0.4458f, 0.4458f, 0.4458f, 0.4458f, 0.4458f, 0.4458f, 0.4458f, 0.4458f,
+  0.4458f, 0.4458f, 0.4458f, 0.4458f, 0.4458f, 0.4458f, 0.4458f, 0.4458f,
+  0.4458f, 0.4249f, 0.4249f, 0.4249f, 0.4249f, 0.4249f, 0.4249f, 0.4249f,
+  0.4249f, 0.4249f, 0.4249f, 0.4249f, 0.4249f, 0.4249f, 0.4249f, 0.4249f,
+  0.4249f, 0.4249f, 0.4249f, 0.4249f, 0.4249f, 0.4249f, 0.4249f, 0.4249f,
+  0.4249f, 0.4249f, 0.4249f, 0.4249f, 0.4249f, 0.4249f, 0.4249f, 0.4249f,
+  0.4249f, 0.4249f, 0.4249f, 0.4249f, 0.4249f, 0.4249f, 0.4249f, 0.4249f,
+  0.4249f, 0.4249f, 0.4249f, 0.4249f, 0.4041f, 0.4041f, 0.4041f, 0.4041f,
+  0.4041f, 0.4041f, 0.4041f, 0.4041f, 0.4041f, 0.4041f, 0.4041f, 0.4041f,
+  0.4041f, 0.4041f, 0.4041f, 0.4041f, 0.4041f, 0.4041f, 0.4041f, 0.4041f,
+  0.4041f, 0.4041f, 0.4041f, 0.4041f, 0.4041f, 0.4041f, 0.4041f, 0.4041f,
+  0.4041f, 0.4041f, 0.4041f, 0.4041f, 0.4041f, 0.4041f, 0.4041f, 0.4041f,
+  0.4041f, 0.4041f, 0.4041f, 0.4041f, 0.4041f, 0.4041f, 0.4041f, 0.3833f,
+  0.3833f, 0.3833f, 0.3833f, 0.3833f, 0.3833f, 0.3833f, 0.3833f, 0.3833f,
+  0.3833f, 0.3833f, 0.3833f, 0.3833f, 0.3833f, 0.3833f, 0.3833f, 0.3833f,
+  0.3833f, 0.3833f, 0.3833f, 0.3833f, 0.3833f, 0.3833f, 0.3833f, 0.3833f,
+  0.3833f, 0.3833f, 0.3833f, 0.3833f, 0.3833f, 0.3833f, 0.3833f, 0.3833f,
+  0.3833f, 0.3833f, 0.3833f, 0.3833f, 0.3833f, 0.3833f, 0.3833f, 0.3833f,
+  0.3833f, 0.3833f, 0.3624f, 0.3624f, 0.3624f, 0.3624f, 0.3624f, 0.3624f,
+  0.3624f, 0.3624f, 0.3624f, 0.3624f, 0.3624f, 0.3624f, 0.3624f, 0.3624f,
+  0.3624f, 0.3624f, 0.3624f, 0.3624f, 0.3624f, 0.3624f, 0.3624f, 0.3624f,
+  0.3624f, 0.3624f, 0.3624f, 0.3624f, 0.3624f, 0.3624f, 0.3624f, 0.3624f,
+  0.3624f, 0.3624f, 0.3624f, 0.3624f, 0.3624f, 0.3624f, 0.3624f, 0.3624f,
+  0.3624f, 0.3624f, 0.3624f, 0.3624f, 0.3624f, 0.3416f, 0.3416f, 0.3416f,
+  0.3416f, 0.3416f, 0.3416f, 0.3416f, 0.3416f, 0.3416f, 0.3416f, 0.3416f,
+  0.3416f, 0.3416f, 0.3416f, 0.3416f, 0.3416f, 0.3416f, 0.3416f, 0.3416f,
+  0.3416f, 0.3416f, 0.3416f, 0.3416f, 0.3416f, 0.3416f, 0.3416f, 0.3416f,
+  0.3416f, 0.3416f, 0.3416f, 0.3416f, 0.3416f, 0.3416f, 0.3416f, 0.3416f,
+  0.3416f, 0.3416f, 0.3416f, 0.3416f, 0.3416f, 0.3416f, 0.3208f, 0.3208f,
+  0.3208f, 0.3208f, 0.3208f, 0.3208f, 0.3208f, 0.3208f, 0.3208f, 0.3208f,
+  0.3208f, 0.3208f, 0.3208f, 0.3208f, 0.3208f, 0.3208f, 0.3208f, 0.3208f,
+  0.3208f, 0.3208f, 0.3208f, 0.3208f, 0.3208f, 0.3208f, 0.3208f, 0.3208f,
+  0.3208f, 0.3208f, 0.3208f, 0.3208f, 0.3208f, 0.3208f, 0.3208f, 0.3208f,
+  0.3208f, 0.3208f, 0.3208f, 0.3208f, 0.3208f, 0.3208f, 0.3208f, 0.2999f,
+  0.2999f, 0.2999f, 0.2999f, 0.2999f, 0.2999f, 0.2999f, 0.2999f, 0.2999f,
+  0.2999f, 0.2999f, 0.2999f, 0.2999f, 0.2999f, 0.2999f, 0.2999f, 0.2999f,
+  0.2999f, 0.2999f, 0.2999f, 0.2999f, 0.2999f, 0.2999f, 0.2999f, 0.2999f,
+  0.2999f, 0.2999f, 0.2999f, 0.2999f, 0.2999f, 0.2999f, 0.2999f, 0.2999f,
+  0.2999f, 0.2999f, 0.2999f, 0.2999f, 0.2999f, 0.2999f, 0.2791f, 0.2791f,
+  0.2791f, 0.2791f, 0.2791f, 0.2791f, 0.2791f, 0.2791f, 0.2791f, 0.2791f,
+  0.2791f, 0.2791f, 0.2791f, 0.2791f, 0.2791f, 0.2791f, 0.2791f, 0.2791f,
+  0.2791f, 0.2791f, 0.2791f, 0.2791f, 0.2791f, 0.2791f, 0.2791f, 0.2791f,
+  0.2791f, 0.2791f, 0.2791f, 0.2791f, 0.2791f, 0.2791f, 0.2791f, 0.2791f,
+  0.2791f, 0.2791f, 0.2791f, 0.2791f, 0.2791f, 0.2583f, 0.2583f, 0.2583f,
+  0.2583f, 0.2583f, 0.2583f, 0.2583f, 0.2583f, 0.2583f, 0.2583f, 0.2583f,
+  0.2583f, 0.2583f, 0.2583f, 0.2583f, 0.2583f, 0.2583f, 0.2583f, 0.2583f,
+  0.2583f, 0.2583f, 0.2583f, 0.2583f, 0.2583f, 0.2583f, 0.2583f, 0.2583f,
+  0.2583f, 0.2583f, 0.2583f, 0.2583f, 0.2583f, 0.2583f, 0.2583f, 0.2583f,
+  0.2583f, 0.2583f, 0.2374f, 0.2374f, 0.2374f, 0.2374f, 0.2374f, 0.2374f,
+  0.2374f, 0.2374f, 0.2374f, 0.2374f, 0.2374f, 0.2374f, 0.2374f, 0.2374f,
+  0.2374f, 0.2374f, 0.2374f, 0.2374f, 0.2374f, 0.2374f, 0.2374f, 0.2374f,
+  0.2374f, 0.2374f, 0.2374f, 0.2374f, 0.2374f, 0.2374f, 0.2374f, 0.2374f,
+  0.2374f, 0.2374f, 0.2374f, 0.2374f, 0.2374f, 0.2166f, 0.2166f, 0.2166f,
+  0.2166f, 0.2166f, 0.2166f, 0.2166f, 0.2166f, 0.2166f, 0.2166f, 0.2166f,
+  0.2166f, 0.2166f, 0.2166f, 0.2166f, 0.2166f, 0.2166f, 0.2166f, 0.2166f,
+  0.2166f, 0.2166f, 0.2166f, 0.2166f, 0.2166f, 0.2166f, 0.2166f, 0.2166f,
+  0.2166f, 0.2166f, 0.2166f, 0.2166f, 0.2166f, 0.2166f, 0.1958f, 0.1958f,
+  0.1958f, 0.1958f, 0.1958f, 0.1958f, 0.1958f, 0.1958f, 0.1958f, 0.1958f,
+  0.1958f, 0.1958f, 0.1958f, 0.1958f, 0.1958f, 0.1958f, 0.1958f, 0.1958f,
+  0.1958f, 0.1958f, 0.1958f, 0.1958f, 0.1958f, 0.1958f, 0.1958f, 0.1958f,
+  0.1958f, 0.1958f, 0.1958f, 0.1958f, 0.1958f, 0.1749f, 0.1749f, 0.1749f,
+  0.1749f, 0.1749f, 0.1749f, 0.1749f, 0.1749f, 0.1749f, 0.1749f, 0.1749f,
+  0.1749f, 0.1749f, 0.1749f, 0.1749f, 0.1749f, 0.1749f, 0.1749f, 0.1749f,
+  0.1749f, 0.1749f, 0.1749f, 0.1749f, 0.1749f, 0.1749f, 0.1749f, 0.1749f,
+  0.1749f, 0.1749f, 0.1541f, 0.1541f, 0.1541f, 0.1541f, 0.1541f, 0.1541f,
+  0.1541f, 0.1541f, 0.1541f, 0.1541f, 0.1541f, 0.1541f, 0.1541f, 0.1541f,
+  0.1541f, 0.1541f, 0.1541f, 0.1541f, 0.1541f, 0.1541f, 0.1541f, 0.1541f,
+  0.1541f, 0.1541f, 0.1541f, 0.1541f, 0.1541f, 0.1333f, 0.1333f, 0.1333f,
+  0.1333f, 0.1333f, 0.1333f, 0.1333f, 0.1333f, 0.1333f, 0.1333f, 0.1333f,
+  0.1333f, 0.1333f, 0.1333f, 0.1333f, 0.1333f, 0.1333f, 0.1333f, 0.1333f,
+  0.1333f, 0.1333f, 0.1333f, 0.1333f, 0.1333f, 0.1333f, 0.1124f, 0.1124f,
+  0.1124f, 0.1124f, 0.1124f, 0.1124f, 0.1124f, 0.1124f, 0.1124f, 0.1124f,
+  0.1124f, 0.1124f, 0.1124f, 0.1124f, 0.1124f, 0.1124f, 0.1124f, 0.1124f,
+  0.1124f, 0.1124f, 0.1124f, 0.0916f, 0.0916f, 0.0916f, 0.0916f, 0.0916f,
+  0.0916f, 0.0916f, 0.0916f, 0.0916f, 0.0916f, 0.0916f, 0.0916f, 0.0916f,
+  0.0916f, 0.0916f, 0.0916f, 0.0916f, 0.07077f, 0.07077f, 0.07077f, 0.07077f,
+  0.07077f, 0.07077f, 0.07077f, 0.07077f, 0.07077f,
+};
+static const float osvr_display_mesh_built_in_osvr_hdk13_v2_eye1_from_y[] = {
+  0.4259f, 0.4444f, 0.463f, 0.4815f, 0.5f, 0.5185f, 0.537f, 0.5556f,
+  0.5741f, 0.3519f, 0.3704f, 0.3889f, 0.4074f, 0.4259f, 0.4444f, 0.463f,
+  0.4815f, 0.5f, 0.5185f, 0.537f, 0.5556f, 0.5741f, 0.5926f, 0.6111f,
+  0.6296f, 0.6481f, 0.3148f, 0.3333f, 0.3519f, 0.3704f, 0.3889f, 0.4074f,
+  0.4259f, 0.4444f, 0.463f, 0.4815f, 0.5f, 0.5185f, 0.537f, 0.5556f,
+  0.5741f, 0.5926f, 0.6111f, 0.6296f, 0.6481f, 0.6667f, 0.6852f, 0.2778f,
+  0.2963f, 0.3148f, 0.3333f, 0.3519f, 0.3704f, 0.3889f, 0.4074f, 0.4259f,
+  0.4444f, 0.463f, 0.4815f, 0.5f, 0.5185f, 0.537f, 0.5556f, 0.5741f,
+  0.5926f, 0.6111f, 0.6296f, 0.6481f, 0.6667f, 0.6852f, 0.7037f, 0.7222f,
+  0.2593f, 0.2778f, 0.2963f, 0.3148f, 0.3333f, 0.3519f, 0.3704f, 0.3889f,
+  0.4074f, 0.4259f, 0.4444f, 0.463f, 0.4815f, 0.5f, 0.5185f, 0.537f,
+  0.5556f, 0.5741f, 0.5926f, 0.6111f, 0.6296f, 0.6481f, 0.6667f, 0.6852f,
+  0.7037f, 0.7222f, 0.7407f, 0.2407f, 0.2593f, 0.2778f, 0.2963f, 0.3148f,
+  0.3333f, 0.3519f, 0.3704f, 0.3889f, 0.4074f, 0.4259f, 0.4444f, 0.463f,
+  0.4815f, 0.5f, 0.5185f, 0.537f, 0.5556f, 0.5741f, 0.5926f, 0.6111f,
+  0.6296f, 0.6481f, 0.6667f, 0.6852f, 0.7037f, 0.7222f, 0.7407f, 0.7593f,
+  0.2222f, 0.2407f, 0.2593f, 0.2778f, 0.2963f, 0.3148f, 0.3333f, 0.3519f,
+  0.3704f, 0.3889f, 0.4074f, 0.4259f, 0.4444f, 0.463f, 0.4815f, 0.5f,
+  0.5185f, 0.537f, 0.5556f, 0.5741f, 0.5926f, 0.6111f, 0.6296f, 0.6481f,
+  0.6667f, 0.6852f, 0.7037f, 0.7222f, 0.7407f, 0.7593f, 0.7778f, 0.2037f,
+  0.2222f, 0.2407f, 0.2593f, 0.2778f, 0.2963f, 0.3148f, 0.3333f, 0.3519f,
+  0.3704f, 0.3889f, 0.4074f, 0.4259f, 0.4444f, 0.463f, 0.4815f, 0.5f,
+  0.5185f, 0.537f, 0.5556f, 0.5741f, 0.5926f, 0.6111f, 0.6296f, 0.6481f,
+  0.6667f, 0.6852f, 0.7037f, 0.7222f, 0.7407f, 0.7593f, 0.7778f, 0.7963f,
+  0.1852f, 0.2037f, 0.2222f, 0.2407f, 0.2593f, 0.2778f, 0.2963f, 0.3148f,
+  0.3333f, 0.3519f, 0.3704f, 0.3889f, 0.4074f, 0.4259f, 0.4444f, 0.463f,
+  0.4815f, 0.5f, 0.5185f, 0.537f, 0.5556f, 0.5741f, 0.5926f, 0.6111f,
+  0.6296f, 0.6481f, 0.6667f, 0.6852f, 0.7037f, 0.7222f, 0.7407f, 0.7593f,
+  0.7778f, 0.7963f, 0.8148f, 0.1667f, 0.1852f, 0.2037f, 0.2222f, 0.2407f,
+  0.2593f, 0.2778f, 0.2963f, 0.3148f, 0.3333f, 0.3519f, 0.3704f, 0.3889f,
+  0.4074f, 0.4259f, 0.4444f, 0.463f, 0.4815f, 0.5f, 0.5185f, 0.537f,
+  0.5556f, 0.5741f, 0.5926f, 0.6111f, 0.6296f, 0.6481f, 0.6667f, 0.6852f,
+  0.7037f, 0.7222f, 0.7407f, 0.7593f, 0.7778f, 0.7963f, 0.8148f, 0.8333f,
+  0.1481f, 0.1667f, 0.1852f, 0.2037f, 0.2222f, 0.2407f, 0.2593f, 0.2778f,
+  0.2963f, 0.3148f, 0.3333f, 0.3519f, 0.3704f, 0.3889f, 0.4074f, 0.4259f,
+  0.4444f, 0.463f, 0.4815f, 0.5f, 0.5185f, 0.537f, 0.5556f, 0.5741f,
+  0.5926f, 0.6111f, 0.6296f, 0.6481f, 0.6667f, 0.6852f, 0.7037f, 0.7222f,
+  0.7407f, 0.7593f, 0.7778f, 0.7963f, 0.8148f, 0.8333f, 0.8519f, 0.1481f,
+  0.1667f, 0.1852f, 0.2037f, 0.2222f, 0.2407f, 0.2593f, 0.2778f, 0.2963f,
+  0.3148f, 0.3333f, 0.3519f, 0.3704f, 0.3889f, 0.4074f, 0.4259f, 0.4444f,
+  0.463f, 0.4815f, 0.5f, 0.5185f, 0.537f, 0.5556f, 0.5741f, 0.5926f,
+  0.6111f, 0.6296f, 0.6481f, 0.6667f, 0.6852f, 0.7037f, 0.7222f, 0.7407f,
+  0.7593f, 0.7778f, 0.7963f, 0.8148f, 0.8333f, 0.8519f, 0.1296f, 0.1481f,
+  0.1667f, 0.1852f, 0.2037f, 0.2222f, 0.2407f, 0.2593f, 0.2778f, 0.2963f,
+  0.3148f, 0.3333f, 0.3519f, 0.3704f, 0.3889f, 0.4074f, 0.4259f, 0.4444f,
+  0.463f, 0.4815f, 0.5f, 0.5185f, 0.537f, 0.5556f, 0.5741f, 0.5926f,
+  0.6111f, 0.6296f, 0.6481f, 0.6667f, 0.6852f, 0.7037f, 0.7222f, 0.7407f,
+  0.7593f, 0.7778f, 0.7963f, 0.8148f, 0.8333f, 0.8519f, 0.8704f, 0.1296f,
+  0.1481f, 0.1667f, 0.1852f, 0.2037f, 0.2222f, 0.2407f, 0.2593f, 0.2778f,
+  0.2963f, 0.3148f, 0.3333f, 0.3519f, 0.3704f, 0.3889f, 0.4074f, 0.4259f,
+  0.4444f, 0.463f, 0.4815f, 0.5f, 0.5185f, 0.537f, 0.5556f, 0.5741f,
+  0.5926f, 0.6111f, 0.6296f, 0.6481f, 0.6667f, 0.6852f, 0.7037f, 0.7222f,
+  0.7407f, 0.7593f, 0.7778f, 0.7963f, 0.8148f, 0.8333f, 0.8519f, 0.8704f,
+  0.1111f, 0.1296f, 0.1481f, 0.1667f, 0.1852f, 0.2037f, 0.2222f, 0.2407f,
+  0.2593f, 0.2778f, 0.2963f, 0.3148f, 0.3333f, 0.3519f, 0.3704f, 0.3889f,
+  0.4074f, 0.4259f, 0.4444f, 0.463f, 0.4815f, 0.5f, 0.5185f, 0.537f,
+  0.5556f, 0.5741f, 0.5926f, 0.6111f, 0.6296f, 0.6481f, 0.6667f, 0.6852f,
+  0.7037f, 0.7222f, 0.7407f, 0.7593f, 0.7778f, 0.7963f, 0.8148f, 0.8333f,
+  0.8519f, 0.8704f, 0.8889f, 0.1111f, 0.1296f, 0.1481f, 0.1667f, 0.1852f,
+  0.2037f, 0.2222f, 0.2407f, 0.2593f, 0.2778f, 0.2963f, 0.3148f, 0.3333f,
+  0.3519f, 0.3704f, 0.3889f, 0.4074f, 0.4259f, 0.4444f, 0.463f, 0.4815f,
+  0.5f, 0.5185f, 0.537f, 0.5556f, 0.5741f, 0.5926f, 0.6111f, 0.6296f,
+  0.6481f, 0.6667f, 0.6852f, 0.7037f, 0.7222f, 0.7407f, 0.7593f, 0.7778f,
+  0.7963f, 0.8148f, 0.8333f, 0.8519f, 0.8704f, 0.8889f, 0.1111f, 0.1296f,
+  0.1481f, 0.1667f, 0.1852f, 0.2037f, 0.2222f, 0.2407f, 0.2593f, 0.2778f,
+  0.2963f, 0.3148f, 0.3333f, 0.3519f, 0.3704f, 0.3889f, 0.4074f, 0.4259f,
+  0.4444f, 0.463f, 0.4815f, 0.5f, 0.5185f, 0.537f, 0.5556f, 0.5741f,
+  0.5926f, 0.6111f, 0.6296f, 0.6481f, 0.6667f, 0.6852f, 0.7037f, 0.7222f,
+  0.7407f, 0.7593f, 0.7778f, 0.7963f, 0.8148f, 0.8333f, 0.8519f, 0.8704f,
+  0.8889f, 0.1111f, 0.1296f, 0.1481f, 0.1667f, 0.1852f, 0.2037f, 0.2222f,
+  0.2407f, 0.2593f, 0.2778f, 0.2963f, 0.3148f, 0.3333f, 0.3519f, 0.3704f,
+  0.3889f, 0.4074f, 0.4259f, 0.4444f, 0.463f, 0.4815f, 0.5f, 0.5185f,
+  0.537f, 0.5556f, 0.5741f, 0.5926f, 0.6111f, 0.6296f, 0.6481f, 0.6667f,
+  0.6852f, 0.7037f, 0.7222f, 0.7407f, 0.7593f, 0.7778f, 0.7963f, 0.8148f,
+  0.8333f, 0.8519f, 0.8704f, 0.8889f, 0.09259f, 0.1111f, 0.1296f, 0.1481f,
+  0.1667f, 0.1852f, 0.2037f, 0.2222f, 0.2407f, 0.2593f, 0.2778f, 0.2963f,
+  0.3148f, 0.3333f, 0.3519f, 0.3704f, 0.3889f, 0.4074f, 0.4259f, 0.4444f,
+  0.463f, 0.4815f, 0.5f, 0.5185f, 0.537f, 0.5556f, 0.5741f, 0.5926f,
+  0.6111f, 0.6296f, 0.6481f, 0.6667f, 0.6852f, 0.7037f, 0.7222f, 0.7407f,
+  0.7593f, 0.7778f, 0.7963f, 0.8148f, 0.8333f, 0.8519f, 0.8704f, 0.8889f,
+  0.9074f, 0.09259f, 0.1111f, 0.1296f, 0.1481f, 0.1667f, 0.1852f, 0.2037f,
+  0.2222f, 0.2407f, 0.2593f, 0.2778f, 0.2963f, 0.3148f, 0.3333f, 0.3519f,
+  0.3704f, 0.3889f, 0.4074f, 0.4259f, 0.4444f, 0.463f, 0.4815f, 0.5f,
+  0.5185f, 0.537f, 0.5556f, 0.5741f, 0.5926f, 0.6111f, 0.6296f, 0.6481f,
+  0.6667f, 0.6852f, 0.7037f, 0.7222f, 0.7407f, 0.7593f, 0.7778f, 0.7963f,
+  0.8148f, 0.8333f, 0.8519f, 0.8704f, 0.8889f, 0.9074f, 0.09259f, 0.1111f,
+  0.1296f, 0.1481f, 0.1667f, 0.1852f, 0.2037f, 0.2222f, 0.2407f, 0.2593f,
+  0.2778f, 0.2963f, 0.3148f, 0.3333f, 0.3519f, 0.3704f, 0.3889f, 0.4074f,
+  0.4259f, 0.4444f, 0.463f, 0.4815f, 0.5f, 0.5185f, 0.537f, 0.5556f,
+  0.5741f, 0.5926f, 0.6111f, 0.6296f, 0.6481f, 0.6667f, 0.6852f, 0.7037f,
+  0.7222f, 0.7407f, 0.7593f, 0.7778f, 0.7963f, 0.8148f, 0.8333f, 0.8519f,
+  0.8704f, 0.8889f, 0.9074f, 0.09259f, 0.1111f, 0.1296f, 0.1481f, 0.1667f,
+  0.1852f, 0.2037f, 0.2222f, 0.2407f, 0.2593f, 0.2778f, 0.2963f, 0.3148f,
+  0.3333f, 0.3519f, 0.3704f, 0.3889f, 0.4074f, 0.4259f, 0.4444f, 0.463f,
+  0.4815f, 0.5f, 0.5185f, 0.537f, 0.5556f, 0.5741f, 0.5926f, 0.6111f,
+  0.6296f, 0.6481f, 0.6667f, 0.6852f, 0.7037f, 0.7222f, 0.7407f, 0.7593f,
+  0.7778f, 0.7963f, 0.8148f, 0.8333f, 0.8519f, 0.8704f, 0.8889f, 0.9074f,
+  0.09259f, 0.1111f, 0.1296f, 0.1481f, 0.1667f, 0.1852f, 0.2037f, 0.2222f,
+  0.2407f, 0.2593f, 0.2778f, 0.2963f, 0.3148f, 0.3333f, 0.3519f, 0.3704f,
+  0.3889f, 0.4074f, 0.4259f, 0.4444f, 0.463f, 0.4815f, 0.5f, 0.5185f,
+  0.537f, 0.5556f, 0.5741f, 0.5926f, 0.6111f, 0.6296f, 0.6481f, 0.6667f,
+  0.6852f, 0.7037f, 0.7222f, 0.7407f, 0.7593f, 0.7778f, 0.7963f, 0.8148f,
+  0.8333f, 0.8519f, 0.8704f, 0.8889f, 0.9074f, 0.09259f, 0.1111f, 0.1296f,
+  0.1481f, 0.1667f, 0.1852f, 0.2037f, 0.2222f, 0.2407f, 0.2593f, 0.2778f,
+  0.2963f, 0.3148f, 0.3333f, 0.3519f, 0.3704f, 0.3889f, 0.4074f, 0.4259f,
+  0.4444f, 0.463f, 0.4815f, 0.5f, 0.5185f, 0.537f, 0.5556f, 0.5741f,
+  0.5926f, 0.6111f, 0.6296f, 0.6481f, 0.6667f, 0.6852f, 0.7037f, 0.7222f,
+  0.7407f, 0.7593f, 0.7778f, 0.7963f, 0.8148f, 0.8333f, 0.8519f, 0.8704f,
+  0.8889f, 0.9074f, 0.09259f, 0.1111f, 0.1296f, 0.1481f, 0.1667f, 0.1852f,
+  0.2037f, 0.2222f, 0.2407f, 0.2593f, 0.2778f, 0.2963f, 0.3148f, 0.3333f,
+  0.3519f, 0.3704f, 0.3889f, 0.4074f, 0.4259f, 0.4444f, 0.463f, 0.4815f,
+  0.5f, 0.5185f, 0.537f, 0.5556f, 0.5741f, 0.5926f, 0.6111f, 0.6296f,
+  0.6481f, 0.6667f, 0.6852f, 0.7037f, 0.7222f, 0.7407f, 0.7593f, 0.7778f,
+  0.7963f, 0.8148f, 0.8333f, 0.8519f, 0.8704f, 0.8889f, 0.9074f, 0.09259f,
+  0.1111f, 0.1296f, 0.1481f, 0.1667f, 0.1852f, 0.2037f, 0.2222f, 0.2407f,
+  0.2593f, 0.2778f, 0.2963f, 0.3148f, 0.3333f, 0.3519f, 0.3704f, 0.3889f,
+  0.4074f, 0.4259f, 0.4444f, 0.463f, 0.4815f, 0.5f, 0.5185f, 0.537f,
+  0.5556f, 0.5741f, 0.5926f, 0.6111f, 0.6296f, 0.6481f, 0.6667f, 0.6852f,
+  0.7037f, 0.7222f, 0.7407f, 0.7593f, 0.7778f, 0.7963f, 0.8148f, 0.8333f,
+  0.8519f, 0.8704f, 0.8889f, 0.9074f, 0.09259f, 0.1111f, 0.1296f, 0.1481f,
+  0.1667f, 0.1852f, 0.2037f, 0.2222f, 0.2407f, 0.2593f, 0.2778f, 0.2963f,
+  0.3148f, 0.3333f, 0.3519f, 0.3704f, 0.3889f, 0.4074f, 0.4259f, 0.4444f,
+  0.463f, 0.4815f, 0.5f, 0.5185f, 0.537f, 0.5556f, 0.5741f, 0.5926f,
+  0.6111f, 0.6296f, 0.6481f, 0.6667f, 0.6852f, 0.7037f, 0.7222f, 0.7407f,
+  0.7593f, 0.7778f, 0.7963f, 0.8148f, 0.8333f, 0.8519f, 0.8704f, 0.8889f,
+  0.9074f, 0.1111f, 0.1296f, 0.1481f, 0.1667f, 0.1852f, 0.2037f, 0.2222f,
+  0.2407f, 0.2593f, 0.2778f, 0.2963f, 0.3148f, 0.3333f, 0.3519f, 0.3704f,
+  0.3889f, 0.4074f, 0.4259f, 0.4444f, 0.463f, 0.4815f, 0.5f, 0.5185f,
+  0.537f, 0.5556f, 0.5741f, 0.5926f, 0.6111f, 0.6296f, 0.6481f, 0.6667f,
+  0.6852f, 0.7037f, 0.7222f, 0.7407f, 0.7593f, 0.7778f, 0.7963f, 0.8148f,
+  0.8333f, 0.8519f, 0.8704f, 0.8889f, 0.1111f, 0.1296f, 0.1481f, 0.1667f,
+  0.1852f, 0.2037f, 0.2222f, 0.2407f, 0.2593f, 0.2778f, 0.2963f, 0.3148f,
+  0.3333f, 0.3519f, 0.3704f, 0.3889f, 0.4074f, 0.4259f, 0.4444f, 0.463f,
+  0.4815f, 0.5f, 0.5185f, 0.537f, 0.5556f, 0.5741f, 0.5926f, 0.6111f,
+  0.6296f, 0.6481f, 0.6667f, 0.6852f, 0.7037f, 0.7222f, 0.7407f, 0.7593f,
+  0.7778f, 0.7963f, 0.8148f, 0.8333f, 0.8519f, 0.8704f, 0.8889f, 0.1111f,
+  0.1296f, 0.1481f, 0.1667f, 0.1852f, 0.2037f, 0.2222f, 0.2407f, 0.2593f,
+  0.2778f, 0.2963f, 0.3148f, 0.3333f, 0.3519f, 0.3704f, 0.3889f, 0.4074f,
+  0.4259f, 0.4444f, 0.463f, 0.4815f, 0.5f, 0.5185f, 0.537f, 0.5556f,
+  0.5741f, 0.5926f, 0.6111f, 0.6296f, 0.6481f, 0.6667f, 0.6852f, 0.7037f,
+  0.7222f, 0.7407f, 0.7593f, 0.7778f, 0.7963f, 0.8148f, 0.8333f, 0.8519f,
+  0.8704f, 0.8889f, 0.1111f, 0.1296f, 0.1481f, 0.1667f, 0.1852f, 0.2037f,
+  0.2222f, 0.2407f, 0.2593f, 0.2778f, 0.2963f, 0.3148f, 0.3333f, 0.3519f,
+  0.3704f, 0.3889f, 0.4074f, 0.4259f, 0.4444f, 0.463f, 0.4815f, 0.5f,
+  0.5185f, 0.537f, 0.5556f, 0.5741f, 0.5926f, 0.6111f, 0.6296f, 0.6481f,
+  0.6667f, 0.6852f, 0.7037f, 0.7222f, 0.7407f, 0.7593f, 0.7778f, 0.7963f,
+  0.8148f, 0.8333f, 0.8519f, 0.8704f, 0.8889f, 0.1296f, 0.1481f, 0.1667f,
+  0.1852f, 0.2037f, 0.2222f, 0.2407f, 0.2593f, 0.2778f, 0.2963f, 0.3148f,
+  0.3333f, 0.3519f, 0.3704f, 0.3889f, 0.4074f, 0.4259f, 0.4444f, 0.463f,
+  0.4815f, 0.5f, 0.5185f, 0.537f, 0.5556f, 0.5741f, 0.5926f, 0.6111f,
+  0.6296f, 0.6481f, 0.6667f, 0.6852f, 0.7037f, 0.7222f, 0.7407f, 0.7593f,
+  0.7778f, 0.7963f, 0.8148f, 0.8333f, 0.8519f, 0.8704f, 0.1296f, 0.1481f,
+  0.1667f, 0.1852f, 0.2037f, 0.2222f, 0.2407f, 0.2593f, 0.2778f, 0.2963f,
+  0.3148f, 0.3333f, 0.3519f, 0.3704f, 0.3889f, 0.4074f, 0.4259f, 0.4444f,
+  0.463f, 0.4815f, 0.5f, 0.5185f, 0.537f, 0.5556f, 0.5741f, 0.5926f,
+  0.6111f, 0.6296f, 0.6481f, 0.6667f, 0.6852f, 0.7037f, 0.7222f, 0.7407f,
+  0.7593f, 0.7778f, 0.7963f, 0.8148f, 0.8333f, 0.8519f, 0.8704f, 0.1481f,
+  0.1667f, 0.1852f, 0.2037f, 0.2222f, 0.2407f, 0.2593f, 0.2778f, 0.2963f,
+  0.3148f, 0.3333f, 0.3519f, 0.3704f, 0.3889f, 0.4074f, 0.4259f, 0.4444f,
+  0.463f, 0.4815f, 0.5f, 0.5185f, 0.537f, 0.5556f, 0.5741f, 0.5926f,
+  0.6111f, 0.6296f, 0.6481f, 0.6667f, 0.6852f, 0.7037f, 0.7222f, 0.7407f,
+  0.7593f, 0.7778f, 0.7963f, 0.8148f, 0.8333f, 0.8519f, 0.1481f, 0.1667f,
+  0.1852f, 0.2037f, 0.2222f, 0.2407f, 0.2593f, 0.2778f, 0.2963f, 0.3148f,
+  0.3333f, 0.3519f, 0.3704f, 0.3889f, 0.4074f, 0.4259f, 0.4444f, 0.463f,
+  0.4815f, 0.5f, 0.5185f, 0.537f, 0.5556f, 0.5741f, 0.5926f, 0.6111f,
+  0.6296f, 0.6481f, 0.6667f, 0.6852f, 0.7037f, 0.7222f, 0.7407f, 0.7593f,
+  0.7778f, 0.7963f, 0.8148f, 0.8333f, 0.8519f, 0.1667f, 0.1852f, 0.2037f,
+  0.2222f, 0.2407f, 0.2593f, 0.2778f, 0.2963f, 0.3148f, 0.3333f, 0.3519f,
+  0.3704f, 0.3889f, 0.4074f, 0.4259f, 0.4444f, 0.463f, 0.4815f, 0.5f,
+  0.5185f, 0.537f, 0.5556f, 0.5741f, 0.5926f, 0.6111f, 0.6296f, 0.6481f,
+  0.6667f, 0.6852f, 0.7037f, 0.7222f, 0.7407f, 0.7593f, 0.7778f, 0.7963f,
+  0.8148f, 0.8333f, 0.1852f, 0.2037f, 0.2222f, 0.2407f, 0.2593f, 0.2778f,
+  0.2963f, 0.3148f, 0.3333f, 0.3519f, 0.3704f, 0.3889f, 0.4074f, 0.4259f,
+  0.4444f, 0.463f, 0.4815f, 0.5f, 0.5185f, 0.537f, 0.5556f, 0.5741f,
+  0.5926f, 0.6111f, 0.6296f, 0.6481f, 0.6667f, 0.6852f, 0.7037f, 0.7222f,
+  0.7407f, 0.7593f, 0.7778f, 0.7963f, 0.8148f, 0.2037f, 0.2222f, 0.2407f,
+  0.2593f, 0.2778f, 0.2963f, 0.3148f, 0.3333f, 0.3519f, 0.3704f, 0.3889f,
+  0.4074f, 0.4259f, 0.4444f, 0.463f, 0.4815f, 0.5f, 0.5185f, 0.537f,
+  0.5556f, 0.5741f, 0.5926f, 0.6111f, 0.6296f, 0.6481f, 0.6667f, 0.6852f,
+  0.7037f, 0.7222f, 0.7407f, 0.7593f, 0.7778f, 0.7963f, 0.2222f, 0.2407f,
+  0.2593f, 0.2778f, 0.2963f, 0.3148f, 0.3333f, 0.3519f, 0.3704f, 0.3889f,
+  0.4074f, 0.4259f, 0.4444f, 0.463f, 0.4815f, 0.5f, 0.5185f, 0.537f,
+  0.5556f, 0.5741f, 0.5926f, 0.6111f, 0.6296f, 0.6481f, 0.6667f, 0.6852f,
+  0.7037f, 0.7222f, 0.7407f, 0.7593f, 0.7778f, 0.2407f, 0.2593f, 0.2778f,
+  0.2963f, 0.3148f, 0.3333f, 0.3519f, 0.3704f, 0.3889f, 0.4074f, 0.4259f,
+  0.4444f, 0.463f, 0.4815f, 0.5f, 0.5185f, 0.537f, 0.5556f, 0.5741f,
+  0.5926f, 0.6111f, 0.6296f, 0.6481f, 0.6667f, 0.6852f, 0.7037f, 0.7222f,
+  0.7407f, 0.7593f, 0.2593f, 0.2778f, 0.2963f, 0.3148f, 0.3333f, 0.3519f,
+  0.3704f, 0.3889f, 0.4074f, 0.4259f, 0.4444f, 0.463f, 0.4815f, 0.5f,
+  0.5185f, 0.537f, 0.5556f, 0.5741f, 0.5926f, 0.6111f, 0.6296f, 0.6481f,
+  0.6667f, 0.6852f, 0.7037f, 0.7222f, 0.7407f, 0.2778f, 0.2963f, 0.3148f,
+  0.3333f, 0.3519f, 0.3704f, 0.3889f, 0.4074f, 0.4259f, 0.4444f, 0.463f,
+  0.4815f, 0.5f, 0.5185f, 0.537f, 0.5556f, 0.5741f, 0.5926f, 0.6111f,
+  0.6296f, 0.6481f, 0.6667f, 0.6852f, 0.7037f, 0.7222f, 0.3148f, 0.3333f,
+  0.3519f, 0.3704f, 0.3889f, 0.4074f, 0.4259f, 0.4444f, 0.463f, 0.4815f,
+  0.5f, 0.5185f, 0.537f, 0.5556f, 0.5741f, 0.5926f, 0.6111f, 0.6296f,
+  0.6481f, 0.6667f, 0.6852f, 0.3519f, 0.3704f, 0.3889f, 0.4074f, 0.4259f,
+  0.4444f, 0.463f, 0.4815f, 0.5f, 0.5185f, 0.537f, 0.5556f, 0.5741f,
+  0.5926f, 0.6111f, 0.6296f, 0.6481f, 0.4259f, 0.4444f, 0.463f, 0.4815f,
+  0.5f, 0.5185f, 0.537f, 0.5556f, 0.5741f,
+};
+static const float osvr_display_mesh_built_in_osvr_hdk13_v2_eye1_to_x[] = {
+  1.0f, 0.9974f, 0.9956f, 0.9944f, 0.9941f, 0.9944f, 0.9956f, 0.9974f,
+  1.0f, 0.979f, 0.9737f, 0.9692f, 0.9653f, 0.9622f, 0.9597f, 0.958f,
+  0.957f, 0.9567f, 0.957f, 0.958f, 0.9597f, 0.9622f, 0.9653f, 0.9692f,
+  0.9737f, 0.979f, 0.9545f, 0.9482f, 0.9425f, 0.9375f, 0.9333f, 0.9297f,
+  0.9268f, 0.9246f, 0.923f, 0.922f, 0.9217f, 0.922f, 0.923f, 0.9246f,
+  0.9268f, 0.9297f, 0.9333f, 0.9375f, 0.9425f, 0.9482f, 0.9545f, 0.9334f,
+  0.9261f, 0.9194f, 0.9135f, 0.9082f, 0.9036f, 0.8997f, 0.8965f, 0.8938f,
+  0.8918f, 0.8903f, 0.8894f, 0.8891f, 0.8894f, 0.8903f, 0.8918f, 0.8938f,
+  0.8965f, 0.8997f, 0.9036f, 0.9082f, 0.9135f, 0.9194f, 0.9261f, 0.9334f,
+  0.907f, 0.8994f, 0.8926f, 0.8864f, 0.881f, 0.8761f, 0.872f, 0.8684f,
+  0.8654f, 0.863f, 0.8611f, 0.8598f, 0.859f, 0.8588f, 0.859f, 0.8598f,
+  0.8611f, 0.863f, 0.8654f, 0.8684f, 0.872f, 0.8761f, 0.881f, 0.8864f,
+  0.8926f, 0.8994f, 0.907f, 0.8821f, 0.8744f, 0.8675f, 0.8612f, 0.8555f,
+  0.8505f, 0.8461f, 0.8423f, 0.8391f, 0.8364f, 0.8342f, 0.8326f, 0.8314f,
+  0.8307f, 0.8305f, 0.8307f, 0.8314f, 0.8326f, 0.8342f, 0.8364f, 0.8391f,
+  0.8423f, 0.8461f, 0.8505f, 0.8555f, 0.8612f, 0.8675f, 0.8744f, 0.8821f,
+  0.8585f, 0.8508f, 0.8438f, 0.8374f, 0.8316f, 0.8265f, 0.822f, 0.818f,
+  0.8146f, 0.8117f, 0.8093f, 0.8074f, 0.8059f, 0.8049f, 0.8042f, 0.804f,
+  0.8042f, 0.8049f, 0.8059f, 0.8074f, 0.8093f, 0.8117f, 0.8146f, 0.818f,
+  0.822f, 0.8265f, 0.8316f, 0.8374f, 0.8438f, 0.8508f, 0.8585f, 0.8361f,
+  0.8284f, 0.8213f, 0.8149f, 0.809f, 0.8038f, 0.7992f, 0.7951f, 0.7916f,
+  0.7886f, 0.786f, 0.7839f, 0.7822f, 0.7809f, 0.78f, 0.7795f, 0.7793f,
+  0.7795f, 0.78f, 0.7809f, 0.7822f, 0.7839f, 0.786f, 0.7886f, 0.7916f,
+  0.7951f, 0.7992f, 0.8038f, 0.809f, 0.8149f, 0.8213f, 0.8284f, 0.8361f,
+  0.8146f, 0.807f, 0.7999f, 0.7934f, 0.7876f, 0.7823f, 0.7776f, 0.7735f,
+  0.7699f, 0.7667f, 0.7641f, 0.7618f, 0.76f, 0.7586f, 0.7575f, 0.7567f,
+  0.7562f, 0.7561f, 0.7562f, 0.7567f, 0.7575f, 0.7586f, 0.76f, 0.7618f,
+  0.7641f, 0.7667f, 0.7699f, 0.7735f, 0.7776f, 0.7823f, 0.7876f, 0.7934f,
+  0.7999f, 0.807f, 0.8146f, 0.7939f, 0.7863f, 0.7793f, 0.7729f, 0.767f,
+  0.7618f, 0.7571f, 0.7529f, 0.7492f, 0.746f, 0.7433f, 0.741f, 0.7391f,
+  0.7375f, 0.7363f, 0.7354f, 0.7348f, 0.7344f, 0.7343f, 0.7344f, 0.7348f,
+  0.7354f, 0.7363f, 0.7375f, 0.7391f, 0.741f, 0.7433f, 0.746f, 0.7492f,
+  0.7529f, 0.7571f, 0.7618f, 0.767f, 0.7729f, 0.7793f, 0.7863f, 0.7939f,
+  0.7737f, 0.7663f, 0.7594f, 0.753f, 0.7472f, 0.742f, 0.7373f, 0.7331f,
+  0.7294f, 0.7262f, 0.7234f, 0.7211f, 0.7191f, 0.7175f, 0.7163f, 0.7153f,
+  0.7145f, 0.714f, 0.7138f, 0.7137f, 0.7138f, 0.714f, 0.7145f, 0.7153f,
+  0.7163f, 0.7175f, 0.7191f, 0.7211f, 0.7234f, 0.7262f, 0.7294f, 0.7331f,
+  0.7373f, 0.742f, 0.7472f, 0.753f, 0.7594f, 0.7663f, 0.7737f, 0.7467f,
+  0.7399f, 0.7337f, 0.728f, 0.7228f, 0.7181f, 0.714f, 0.7103f, 0.7071f,
+  0.7043f, 0.7019f, 0.7f, 0.6983f, 0.697f, 0.696f, 0.6953f, 0.6947f,
+  0.6944f, 0.6942f, 0.6941f, 0.6942f, 0.6944f, 0.6947f, 0.6953f, 0.696f,
+  0.697f, 0.6983f, 0.7f, 0.7019f, 0.7043f, 0.7071f, 0.7103f, 0.714f,
+  0.7181f, 0.7228f, 0.728f, 0.7337f, 0.7399f, 0.7467f, 0.7273f, 0.7207f,
+  0.7147f, 0.7091f, 0.7041f, 0.6995f, 0.6954f, 0.6917f, 0.6885f, 0.6857f,
+  0.6834f, 0.6814f, 0.6797f, 0.6784f, 0.6774f, 0.6767f, 0.6762f, 0.6758f,
+  0.6756f, 0.6755f, 0.6754f, 0.6755f, 0.6756f, 0.6758f, 0.6762f, 0.6767f,
+  0.6774f, 0.6784f, 0.6797f, 0.6814f, 0.6834f, 0.6857f, 0.6885f, 0.6917f,
+  0.6954f, 0.6995f, 0.7041f, 0.7091f, 0.7147f, 0.7207f, 0.7273f, 0.7017f,
+  0.6959f, 0.6905f, 0.6856f, 0.6811f, 0.6771f, 0.6735f, 0.6703f, 0.6676f,
+  0.6652f, 0.6632f, 0.6616f, 0.6603f, 0.6593f, 0.6586f, 0.6581f, 0.6578f,
+  0.6576f, 0.6575f, 0.6575f, 0.6575f, 0.6575f, 0.6575f, 0.6576f, 0.6578f,
+  0.6581f, 0.6586f, 0.6593f, 0.6603f, 0.6616f, 0.6632f, 0.6652f, 0.6676f,
+  0.6703f, 0.6735f, 0.6771f, 0.6811f, 0.6856f, 0.6905f, 0.6959f, 0.7017f,
+  0.6825f, 0.677f, 0.6719f, 0.6672f, 0.6629f, 0.659f, 0.6555f, 0.6524f,
+  0.6497f, 0.6474f, 0.6454f, 0.6438f, 0.6425f, 0.6415f, 0.6408f, 0.6403f,
+  0.6401f, 0.64f, 0.64f, 0.64f, 0.6401f, 0.6401f, 0.6401f, 0.64f,
+  0.64f, 0.64f, 0.6401f, 0.6403f, 0.6408f, 0.6415f, 0.6425f, 0.6438f,
+  0.6454f, 0.6474f, 0.6497f, 0.6524f, 0.6555f, 0.659f, 0.6629f, 0.6672f,
+  0.6719f, 0.677f, 0.6825f, 0.6579f, 0.6531f, 0.6487f, 0.6447f, 0.641f,
+  0.6376f, 0.6347f, 0.632f, 0.6298f, 0.6278f, 0.6262f, 0.6249f, 0.6239f,
+  0.6232f, 0.6227f, 0.6225f, 0.6225f, 0.6226f, 0.6227f, 0.6229f, 0.6231f,
+  0.6231f, 0.6231f, 0.6229f, 0.6227f, 0.6226f, 0.6225f, 0.6225f, 0.6227f,
+  0.6232f, 0.6239f, 0.6249f, 0.6262f, 0.6278f, 0.6298f, 0.632f, 0.6347f,
+  0.6376f, 0.641f, 0.6447f, 0.6487f, 0.6531f, 0.6579f, 0.634f, 0.63f,
+  0.6262f, 0.6228f, 0.6197f, 0.6169f, 0.6144f, 0.6122f, 0.6103f, 0.6088f,
+  0.6075f, 0.6065f, 0.6057f, 0.6053f, 0.605f, 0.605f, 0.6051f, 0.6054f,
+  0.6057f, 0.6061f, 0.6063f, 0.6064f, 0.6063f, 0.6061f, 0.6057f, 0.6054f,
+  0.6051f, 0.605f, 0.605f, 0.6053f, 0.6057f, 0.6065f, 0.6075f, 0.6088f,
+  0.6103f, 0.6122f, 0.6144f, 0.6169f, 0.6197f, 0.6228f, 0.6262f, 0.63f,
+  0.634f, 0.6108f, 0.6074f, 0.6043f, 0.6015f, 0.5989f, 0.5967f, 0.5946f,
+  0.5929f, 0.5914f, 0.5901f, 0.5891f, 0.5883f, 0.5878f, 0.5875f, 0.5875f,
+  0.5876f, 0.5879f, 0.5883f, 0.5888f, 0.5893f, 0.5896f, 0.5897f, 0.5896f,
+  0.5893f, 0.5888f, 0.5883f, 0.5879f, 0.5876f, 0.5875f, 0.5875f, 0.5878f,
+  0.5883f, 0.5891f, 0.5901f, 0.5914f, 0.5929f, 0.5946f, 0.5967f, 0.5989f,
+  0.6015f, 0.6043f, 0.6074f, 0.6108f, 0.5909f, 0.588f, 0.5854f, 0.5829f,
+  0.5807f, 0.5786f, 0.5768f, 0.5753f, 0.5739f, 0.5727f, 0.5718f, 0.571f,
+  0.5705f, 0.5701f, 0.57f, 0.57f, 0.5703f, 0.5707f, 0.5712f, 0.5718f,
+  0.5723f, 0.5727f, 0.5729f, 0.5727f, 0.5723f, 0.5718f, 0.5712f, 0.5707f,
+  0.5703f, 0.57f, 0.57f, 0.5701f, 0.5705f, 0.571f, 0.5718f, 0.5727f,
+  0.5739f, 0.5753f, 0.5768f, 0.5786f, 0.5807f, 0.5829f, 0.5854f, 0.588f,
+  0.5909f, 0.5678f, 0.5657f, 0.5637f, 0.5619f, 0.5602f, 0.5587f, 0.5574f,
+  0.5562f, 0.5552f, 0.5543f, 0.5536f, 0.5531f, 0.5527f, 0.5525f, 0.5525f,
+  0.5526f, 0.5529f, 0.5533f, 0.5538f, 0.5544f, 0.555f, 0.5555f, 0.5557f,
+  0.5555f, 0.555f, 0.5544f, 0.5538f, 0.5533f, 0.5529f, 0.5526f, 0.5525f,
+  0.5525f, 0.5527f, 0.5531f, 0.5536f, 0.5543f, 0.5552f, 0.5562f, 0.5574f,
+  0.5587f, 0.5602f, 0.5619f, 0.5637f, 0.5657f, 0.5678f, 0.5451f, 0.5436f,
+  0.5423f, 0.5411f, 0.54f, 0.539f, 0.5381f, 0.5373f, 0.5367f, 0.5361f,
+  0.5357f, 0.5353f, 0.5351f, 0.535f, 0.535f, 0.5351f, 0.5354f, 0.5357f,
+  0.5362f, 0.5367f, 0.5373f, 0.5378f, 0.538f, 0.5378f, 0.5373f, 0.5367f,
+  0.5362f, 0.5357f, 0.5354f, 0.5351f, 0.535f, 0.535f, 0.5351f, 0.5353f,
+  0.5357f, 0.5361f, 0.5367f, 0.5373f, 0.5381f, 0.539f, 0.54f, 0.5411f,
+  0.5423f, 0.5436f, 0.5451f, 0.5225f, 0.5218f, 0.5211f, 0.5205f, 0.5199f,
+  0.5195f, 0.519f, 0.5186f, 0.5183f, 0.518f, 0.5178f, 0.5177f, 0.5175f,
+  0.5175f, 0.5175f, 0.5176f, 0.5177f, 0.5179f, 0.5182f, 0.5185f, 0.5189f,
+  0.5193f, 0.5195f, 0.5193f, 0.5189f, 0.5185f, 0.5182f, 0.5179f, 0.5177f,
+  0.5176f, 0.5175f, 0.5175f, 0.5175f, 0.5177f, 0.5178f, 0.518f, 0.5183f,
+  0.5186f, 0.519f, 0.5195f, 0.5199f, 0.5205f, 0.5211f, 0.5218f, 0.5225f,
+  0.5f, 0.5f, 0.5f, 0.5f, 0.5f, 0.5f, 0.5f, 0.5f,
+  0.5f, 0.5f, 0.5f, 0.5f, 0.5f, 0.5f, 0.5f, 0.5f,
+  0.5f, 0.5f, 0.5f, 0.5f, 0.5f, 0.5f, 0.5f, 0.5f,
+  0.5f, 0.5f, 0.5f, 0.5f, 0.5f, 0.5f, 0.5f, 0.5f,
+  0.5f, 0.5f, 0.5f, 0.5f, 0.5f, 0.5f, 0.5f, 0.5f,
+  0.5f, 0.5f, 0.5f, 0.5f, 0.5f, 0.4775f, 0.4782f, 0.4789f,
+  0.4795f, 0.4801f, 0.4805f, 0.481f, 0.4814f, 0.4817f, 0.482f, 0.4822f,
+  0.4823f, 0.4825f, 0.4825f, 0.4825f, 0.4824f, 0.4823f, 0.4821f, 0.4818f,
+  0.4815f, 0.4811f, 0.4807f, 0.4805f, 0.4807f, 0.4811f, 0.4815f, 0.4818f,
+  0.4821f, 0.4823f, 0.4824f, 0.4825f, 0.4825f, 0.4825f, 0.4823f, 0.4822f,
+  0.482f, 0.4817f, 0.4814f, 0.481f, 0.4805f, 0.4801f, 0.4795f, 0.4789f,
+  0.4782f, 0.4775f, 0.4549f, 0.4564f, 0.4577f, 0.4589f, 0.46f, 0.461f,
+  0.4619f, 0.4627f, 0.4633f, 0.4639f, 0.4643f, 0.4647f, 0.4649f, 0.465f,
+  0.465f, 0.4649f, 0.4646f, 0.4643f, 0.4638f, 0.4633f, 0.4627f, 0.4622f,
+  0.462f, 0.4622f, 0.4627f, 0.4633f, 0.4638f, 0.4643f, 0.4646f, 0.4649f,
+  0.465f, 0.465f, 0.4649f, 0.4647f, 0.4643f, 0.4639f, 0.4633f, 0.4627f,
+  0.4619f, 0.461f, 0.46f, 0.4589f, 0.4577f, 0.4564f, 0.4549f, 0.4322f,
+  0.4343f, 0.4363f, 0.4381f, 0.4398f, 0.4413f, 0.4426f, 0.4438f, 0.4448f,
+  0.4457f, 0.4464f, 0.4469f, 0.4473f, 0.4475f, 0.4475f, 0.4474f, 0.4471f,
+  0.4467f, 0.4462f, 0.4456f, 0.445f, 0.4445f, 0.4443f, 0.4445f, 0.445f,
+  0.4456f, 0.4462f, 0.4467f, 0.4471f, 0.4474f, 0.4475f, 0.4475f, 0.4473f,
+  0.4469f, 0.4464f, 0.4457f, 0.4448f, 0.4438f, 0.4426f, 0.4413f, 0.4398f,
+  0.4381f, 0.4363f, 0.4343f, 0.4322f, 0.4091f, 0.412f, 0.4146f, 0.4171f,
+  0.4193f, 0.4214f, 0.4232f, 0.4247f, 0.4261f, 0.4273f, 0.4282f, 0.429f,
+  0.4295f, 0.4299f, 0.43f, 0.43f, 0.4297f, 0.4293f, 0.4288f, 0.4282f,
+  0.4277f, 0.4273f, 0.4271f, 0.4273f, 0.4277f, 0.4282f, 0.4288f, 0.4293f,
+  0.4297f, 0.43f, 0.43f, 0.4299f, 0.4295f, 0.429f, 0.4282f, 0.4273f,
+  0.4261f, 0.4247f, 0.4232f, 0.4214f, 0.4193f, 0.4171f, 0.4146f, 0.412f,
+  0.4091f, 0.3892f, 0.3926f, 0.3957f, 0.3985f, 0.4011f, 0.4033f, 0.4054f,
+  0.4071f, 0.4086f, 0.4099f, 0.4109f, 0.4117f, 0.4122f, 0.4125f, 0.4125f,
+  0.4124f, 0.4121f, 0.4117f, 0.4112f, 0.4107f, 0.4104f, 0.4103f, 0.4104f,
+  0.4107f, 0.4112f, 0.4117f, 0.4121f, 0.4124f, 0.4125f, 0.4125f, 0.4122f,
+  0.4117f, 0.4109f, 0.4099f, 0.4086f, 0.4071f, 0.4054f, 0.4033f, 0.4011f,
+  0.3985f, 0.3957f, 0.3926f, 0.3892f, 0.366f, 0.37f, 0.3738f, 0.3772f,
+  0.3803f, 0.3831f, 0.3856f, 0.3878f, 0.3897f, 0.3912f, 0.3925f, 0.3935f,
+  0.3943f, 0.3947f, 0.395f, 0.395f, 0.3949f, 0.3946f, 0.3943f, 0.3939f,
+  0.3937f, 0.3936f, 0.3937f, 0.3939f, 0.3943f, 0.3946f, 0.3949f, 0.395f,
+  0.395f, 0.3947f, 0.3943f, 0.3935f, 0.3925f, 0.3912f, 0.3897f, 0.3878f,
+  0.3856f, 0.3831f, 0.3803f, 0.3772f, 0.3738f, 0.37f, 0.366f, 0.3421f,
+  0.3469f, 0.3513f, 0.3553f, 0.359f, 0.3624f, 0.3653f, 0.368f, 0.3702f,
+  0.3722f, 0.3738f, 0.3751f, 0.3761f, 0.3768f, 0.3773f, 0.3775f, 0.3775f,
+  0.3774f, 0.3773f, 0.3771f, 0.3769f, 0.3769f, 0.3769f, 0.3771f, 0.3773f,
+  0.3774f, 0.3775f, 0.3775f, 0.3773f, 0.3768f, 0.3761f, 0.3751f, 0.3738f,
+  0.3722f, 0.3702f, 0.368f, 0.3653f, 0.3624f, 0.359f, 0.3553f, 0.3513f,
+  0.3469f, 0.3421f, 0.3175f, 0.323f, 0.3281f, 0.3328f, 0.3371f, 0.341f,
+  0.3445f, 0.3476f, 0.3503f, 0.3526f, 0.3546f, 0.3562f, 0.3575f, 0.3585f,
+  0.3592f, 0.3597f, 0.3599f, 0.36f, 0.36f, 0.36f, 0.3599f, 0.3599f,
+  0.3599f, 0.36f, 0.36f, 0.36f, 0.3599f, 0.3597f, 0.3592f, 0.3585f,
+  0.3575f, 0.3562f, 0.3546f, 0.3526f, 0.3503f, 0.3476f, 0.3445f, 0.341f,
+  0.3371f, 0.3328f, 0.3281f, 0.323f, 0.3175f, 0.2983f, 0.3041f, 0.3095f,
+  0.3144f, 0.3189f, 0.3229f, 0.3265f, 0.3297f, 0.3324f, 0.3348f, 0.3368f,
+  0.3384f, 0.3397f, 0.3407f, 0.3414f, 0.3419f, 0.3422f, 0.3424f, 0.3425f,
+  0.3425f, 0.3425f, 0.3425f, 0.3425f, 0.3424f, 0.3422f, 0.3419f, 0.3414f,
+  0.3407f, 0.3397f, 0.3384f, 0.3368f, 0.3348f, 0.3324f, 0.3297f, 0.3265f,
+  0.3229f, 0.3189f, 0.3144f, 0.3095f, 0.3041f, 0.2983f, 0.2727f, 0.2793f,
+  0.2853f, 0.2909f, 0.2959f, 0.3005f, 0.3046f, 0.3083f, 0.3115f, 0.3143f,
+  0.3166f, 0.3186f, 0.3203f, 0.3216f, 0.3226f, 0.3233f, 0.3238f, 0.3242f,
+  0.3244f, 0.3245f, 0.3246f, 0.3245f, 0.3244f, 0.3242f, 0.3238f, 0.3233f,
+  0.3226f, 0.3216f, 0.3203f, 0.3186f, 0.3166f, 0.3143f, 0.3115f, 0.3083f,
+  0.3046f, 0.3005f, 0.2959f, 0.2909f, 0.2853f, 0.2793f, 0.2727f, 0.2533f,
+  0.2601f, 0.2663f, 0.272f, 0.2772f, 0.2819f, 0.286f, 0.2897f, 0.2929f,
+  0.2957f, 0.2981f, 0.3f, 0.3017f, 0.303f, 0.304f, 0.3047f, 0.3053f,
+  0.3056f, 0.3058f, 0.3059f, 0.3058f, 0.3056f, 0.3053f, 0.3047f, 0.304f,
+  0.303f, 0.3017f, 0.3f, 0.2981f, 0.2957f, 0.2929f, 0.2897f, 0.286f,
+  0.2819f, 0.2772f, 0.272f, 0.2663f, 0.2601f, 0.2533f, 0.2263f, 0.2337f,
+  0.2406f, 0.247f, 0.2528f, 0.258f, 0.2627f, 0.2669f, 0.2706f, 0.2738f,
+  0.2766f, 0.2789f, 0.2809f, 0.2825f, 0.2837f, 0.2847f, 0.2855f, 0.286f,
+  0.2862f, 0.2863f, 0.2862f, 0.286f, 0.2855f, 0.2847f, 0.2837f, 0.2825f,
+  0.2809f, 0.2789f, 0.2766f, 0.2738f, 0.2706f, 0.2669f, 0.2627f, 0.258f,
+  0.2528f, 0.247f, 0.2406f, 0.2337f, 0.2263f, 0.2061f, 0.2137f, 0.2207f,
+  0.2271f, 0.233f, 0.2382f, 0.2429f, 0.2471f, 0.2508f, 0.254f, 0.2567f,
+  0.259f, 0.2609f, 0.2625f, 0.2637f, 0.2646f, 0.2652f, 0.2656f, 0.2657f,
+  0.2656f, 0.2652f, 0.2646f, 0.2637f, 0.2625f, 0.2609f, 0.259f, 0.2567f,
+  0.254f, 0.2508f, 0.2471f, 0.2429f, 0.2382f, 0.233f, 0.2271f, 0.2207f,
+  0.2137f, 0.2061f, 0.1854f, 0.193f, 0.2001f, 0.2066f, 0.2124f, 0.2177f,
+  0.2224f, 0.2265f, 0.2301f, 0.2333f, 0.2359f, 0.2382f, 0.24f, 0.2414f,
+  0.2425f, 0.2433f, 0.2438f, 0.2439f, 0.2438f, 0.2433f, 0.2425f, 0.2414f,
+  0.24f, 0.2382f, 0.2359f, 0.2333f, 0.2301f, 0.2265f, 0.2224f, 0.2177f,
+  0.2124f, 0.2066f, 0.2001f, 0.193f, 0.1854f, 0.1639f, 0.1716f, 0.1787f,
+  0.1851f, 0.191f, 0.1962f, 0.2008f, 0.2049f, 0.2084f, 0.2114f, 0.214f,
+  0.2161f, 0.2178f, 0.2191f, 0.22f, 0.2205f, 0.2207f, 0.2205f, 0.22f,
+  0.2191f, 0.2178f, 0.2161f, 0.214f, 0.2114f, 0.2084f, 0.2049f, 0.2008f,
+  0.1962f, 0.191f, 0.1851f, 0.1787f, 0.1716f, 0.1639f, 0.1415f, 0.1492f,
+  0.1562f, 0.1626f, 0.1684f, 0.1735f, 0.178f, 0.182f, 0.1854f, 0.1883f,
+  0.1907f, 0.1926f, 0.1941f, 0.1951f, 0.1958f, 0.196f, 0.1958f, 0.1951f,
+  0.1941f, 0.1926f, 0.1907f, 0.1883f, 0.1854f, 0.182f, 0.178f, 0.1735f,
+  0.1684f, 0.1626f, 0.1562f, 0.1492f, 0.1415f, 0.1179f, 0.1256f, 0.1325f,
+  0.1388f, 0.1445f, 0.1495f, 0.1539f, 0.1577f, 0.1609f, 0.1636f, 0.1658f,
+  0.1674f, 0.1686f, 0.1693f, 0.1695f, 0.1693f, 0.1686f, 0.1674f, 0.1658f,
+  0.1636f, 0.1609f, 0.1577f, 0.1539f, 0.1495f, 0.1445f, 0.1388f, 0.1325f,
+  0.1256f, 0.1179f, 0.09304f, 0.1006f, 0.1074f, 0.1136f, 0.119f, 0.1239f,
+  0.128f, 0.1316f, 0.1346f, 0.137f, 0.1389f, 0.1402f, 0.141f, 0.1412f,
+  0.141f, 0.1402f, 0.1389f, 0.137f, 0.1346f, 0.1316f, 0.128f, 0.1239f,
+  0.119f, 0.1136f, 0.1074f, 0.1006f, 0.09304f, 0.06657f, 0.07394f, 0.08059f,
+  0.08653f, 0.09178f, 0.09635f, 0.1003f, 0.1035f, 0.1062f, 0.1082f, 0.1097f,
+  0.1106f, 0.1109f, 0.1106f, 0.1097f, 0.1082f, 0.1062f, 0.1035f, 0.1003f,
+  0.09635f, 0.09178f, 0.08653f, 0.08059f, 0.07394f, 0.06657f, 0.04545f, 0.05185f,
+  0.05752f, 0.06247f, 0.06673f, 0.07029f, 0.07319f, 0.07543f, 0.07702f, 0.07797f,
+  0.07828f, 0.07797f, 0.07702f, 0.07543f, 0.07319f, 0.07029f, 0.06673f, 0.06247f,
+  0.05752f, 0.05185f, 0.04545f, 0.02095f, 0.02627f, 0.03085f, 0.0347f, 0.03783f,
+  0.04025f, 0.04197f, 0.04301f, 0.04335f, 0.04301f, 0.04197f, 0.04025f, 0.03783f,
+  0.0347f, 0.03085f, 0.02627f, 0.02095f, 0.0f, 0.002598f, 0.00445f, 0.005558f,
+  0.005927f, 0.005558f, 0.00445f, 0.002598f, 0.0f,
+};
+static const float osvr_display_mesh_built_in_osvr_hdk13_v2_eye1_to_y[] = {
+  0.4091f, 0.4322f, 0.4549f, 0.4775f, 0.5f, 0.5225f, 0.5451f, 0.5678f,
+  0.5909f, 0.3175f, 0.3421f, 0.366f, 0.3892f, 0.412f, 0.4343f, 0.4564f,
+  0.4782f, 0.5f, 0.5218f, 0.5436f, 0.5657f, 0.588f, 0.6108f, 0.634f,
+  0.6579f, 0.6825f, 0.2727f, 0.2983f, 0.323f, 0.3469f, 0.37f, 0.3926f,
+  0.4146f, 0.4363f, 0.4577f, 0.4789f, 0.5f, 0.5211f, 0.5423f, 0.5637f,
+  0.5854f, 0.6074f, 0.63f, 0.6531f, 0.677f, 0.7017f, 0.7273f, 0.2263f,
+  0.2533f, 0.2793f, 0.3041f, 0.3281f, 0.3513f, 0.3738f, 0.3957f, 0.4171f,
+  0.4381f, 0.4589f, 0.4795f, 0.5f, 0.5205f, 0.5411f, 0.5619f, 0.5829f,
+  0.6043f, 0.6262f, 0.6487f, 0.6719f, 0.6959f, 0.7207f, 0.7467f, 0.7737f,
+  0.2061f, 0.2337f, 0.2601f, 0.2853f, 0.3095f, 0.3328f, 0.3553f, 0.3772f,
+  0.3985f, 0.4193f, 0.4398f, 0.46f, 0.4801f, 0.5f, 0.5199f, 0.54f,
+  0.5602f, 0.5807f, 0.6015f, 0.6228f, 0.6447f, 0.6672f, 0.6905f, 0.7147f,
+  0.7399f, 0.7663f, 0.7939f, 0.1854f, 0.2137f, 0.2406f, 0.2663f, 0.2909f,
+  0.3144f, 0.3371f, 0.359f, 0.3803f, 0.4011f, 0.4214f, 0.4413f, 0.461f,
+  0.4805f, 0.5f, 0.5195f, 0.539f, 0.5587f, 0.5786f, 0.5989f, 0.6197f,
+  0.641f, 0.6629f, 0.6856f, 0.7091f, 0.7337f, 0.7594f, 0.7863f, 0.8146f,
+  0.1639f, 0.193f, 0.2207f, 0.247f, 0.272f, 0.2959f, 0.3189f, 0.341f,
+  0.3624f, 0.3831f, 0.4033f, 0.4232f, 0.4426f, 0.4619f, 0.481f, 0.5f,
+  0.519f, 0.5381f, 0.5574f, 0.5768f, 0.5967f, 0.6169f, 0.6376f, 0.659f,
+  0.6811f, 0.7041f, 0.728f, 0.753f, 0.7793f, 0.807f, 0.8361f, 0.1415f,
+  0.1716f, 0.2001f, 0.2271f, 0.2528f, 0.2772f, 0.3005f, 0.3229f, 0.3445f,
+  0.3653f, 0.3856f, 0.4054f, 0.4247f, 0.4438f, 0.4627f, 0.4814f, 0.5f,
+  0.5186f, 0.5373f, 0.5562f, 0.5753f, 0.5946f, 0.6144f, 0.6347f, 0.6555f,
+  0.6771f, 0.6995f, 0.7228f, 0.7472f, 0.7729f, 0.7999f, 0.8284f, 0.8585f,
+  0.1179f, 0.1492f, 0.1787f, 0.2066f, 0.233f, 0.258f, 0.2819f, 0.3046f,
+  0.3265f, 0.3476f, 0.368f, 0.3878f, 0.4071f, 0.4261f, 0.4448f, 0.4633f,
+  0.4817f, 0.5f, 0.5183f, 0.5367f, 0.5552f, 0.5739f, 0.5929f, 0.6122f,
+  0.632f, 0.6524f, 0.6735f, 0.6954f, 0.7181f, 0.742f, 0.767f, 0.7934f,
+  0.8213f, 0.8508f, 0.8821f, 0.09304f, 0.1256f, 0.1562f, 0.1851f, 0.2124f,
+  0.2382f, 0.2627f, 0.286f, 0.3083f, 0.3297f, 0.3503f, 0.3702f, 0.3897f,
+  0.4086f, 0.4273f, 0.4457f, 0.4639f, 0.482f, 0.5f, 0.518f, 0.5361f,
+  0.5543f, 0.5727f, 0.5914f, 0.6103f, 0.6298f, 0.6497f, 0.6703f, 0.6917f,
+  0.714f, 0.7373f, 0.7618f, 0.7876f, 0.8149f, 0.8438f, 0.8744f, 0.907f,
+  0.06657f, 0.1006f, 0.1325f, 0.1626f, 0.191f, 0.2177f, 0.2429f, 0.2669f,
+  0.2897f, 0.3115f, 0.3324f, 0.3526f, 0.3722f, 0.3912f, 0.4099f, 0.4282f,
+  0.4464f, 0.4643f, 0.4822f, 0.5f, 0.5178f, 0.5357f, 0.5536f, 0.5718f,
+  0.5901f, 0.6088f, 0.6278f, 0.6474f, 0.6676f, 0.6885f, 0.7103f, 0.7331f,
+  0.7571f, 0.7823f, 0.809f, 0.8374f, 0.8675f, 0.8994f, 0.9334f, 0.07394f,
+  0.1074f, 0.1388f, 0.1684f, 0.1962f, 0.2224f, 0.2471f, 0.2706f, 0.2929f,
+  0.3143f, 0.3348f, 0.3546f, 0.3738f, 0.3925f, 0.4109f, 0.429f, 0.4469f,
+  0.4647f, 0.4823f, 0.5f, 0.5177f, 0.5353f, 0.5531f, 0.571f, 0.5891f,
+  0.6075f, 0.6262f, 0.6454f, 0.6652f, 0.6857f, 0.7071f, 0.7294f, 0.7529f,
+  0.7776f, 0.8038f, 0.8316f, 0.8612f, 0.8926f, 0.9261f, 0.04545f, 0.08059f,
+  0.1136f, 0.1445f, 0.1735f, 0.2008f, 0.2265f, 0.2508f, 0.2738f, 0.2957f,
+  0.3166f, 0.3368f, 0.3562f, 0.3751f, 0.3935f, 0.4117f, 0.4295f, 0.4473f,
+  0.4649f, 0.4825f, 0.5f, 0.5175f, 0.5351f, 0.5527f, 0.5705f, 0.5883f,
+  0.6065f, 0.6249f, 0.6438f, 0.6632f, 0.6834f, 0.7043f, 0.7262f, 0.7492f,
+  0.7735f, 0.7992f, 0.8265f, 0.8555f, 0.8864f, 0.9194f, 0.9545f, 0.05185f,
+  0.08653f, 0.119f, 0.1495f, 0.178f, 0.2049f, 0.2301f, 0.254f, 0.2766f,
+  0.2981f, 0.3186f, 0.3384f, 0.3575f, 0.3761f, 0.3943f, 0.4122f, 0.4299f,
+  0.4475f, 0.465f, 0.4825f, 0.5f, 0.5175f, 0.535f, 0.5525f, 0.5701f,
+  0.5878f, 0.6057f, 0.6239f, 0.6425f, 0.6616f, 0.6814f, 0.7019f, 0.7234f,
+  0.746f, 0.7699f, 0.7951f, 0.822f, 0.8505f, 0.881f, 0.9135f, 0.9482f,
+  0.02095f, 0.05752f, 0.09178f, 0.1239f, 0.1539f, 0.182f, 0.2084f, 0.2333f,
+  0.2567f, 0.2789f, 0.3f, 0.3203f, 0.3397f, 0.3585f, 0.3768f, 0.3947f,
+  0.4125f, 0.43f, 0.4475f, 0.465f, 0.4825f, 0.5f, 0.5175f, 0.535f,
+  0.5525f, 0.57f, 0.5875f, 0.6053f, 0.6232f, 0.6415f, 0.6603f, 0.6797f,
+  0.7f, 0.7211f, 0.7433f, 0.7667f, 0.7916f, 0.818f, 0.8461f, 0.8761f,
+  0.9082f, 0.9425f, 0.979f, 0.02627f, 0.06247f, 0.09635f, 0.128f, 0.1577f,
+  0.1854f, 0.2114f, 0.2359f, 0.259f, 0.2809f, 0.3017f, 0.3216f, 0.3407f,
+  0.3592f, 0.3773f, 0.395f, 0.4125f, 0.43f, 0.4474f, 0.4649f, 0.4824f,
+  0.5f, 0.5176f, 0.5351f, 0.5526f, 0.57f, 0.5875f, 0.605f, 0.6227f,
+  0.6408f, 0.6593f, 0.6784f, 0.6983f, 0.7191f, 0.741f, 0.7641f, 0.7886f,
+  0.8146f, 0.8423f, 0.872f, 0.9036f, 0.9375f, 0.9737f, 0.03085f, 0.06673f,
+  0.1003f, 0.1316f, 0.1609f, 0.1883f, 0.214f, 0.2382f, 0.2609f, 0.2825f,
+  0.303f, 0.3226f, 0.3414f, 0.3597f, 0.3775f, 0.395f, 0.4124f, 0.4297f,
+  0.4471f, 0.4646f, 0.4823f, 0.5f, 0.5177f, 0.5354f, 0.5529f, 0.5703f,
+  0.5876f, 0.605f, 0.6225f, 0.6403f, 0.6586f, 0.6774f, 0.697f, 0.7175f,
+  0.7391f, 0.7618f, 0.786f, 0.8117f, 0.8391f, 0.8684f, 0.8997f, 0.9333f,
+  0.9692f, 0.0347f, 0.07029f, 0.1035f, 0.1346f, 0.1636f, 0.1907f, 0.2161f,
+  0.24f, 0.2625f, 0.2837f, 0.304f, 0.3233f, 0.3419f, 0.3599f, 0.3775f,
+  0.3949f, 0.4121f, 0.4293f, 0.4467f, 0.4643f, 0.4821f, 0.5f, 0.5179f,
+  0.5357f, 0.5533f, 0.5707f, 0.5879f, 0.6051f, 0.6225f, 0.6401f, 0.6581f,
+  0.6767f, 0.696f, 0.7163f, 0.7375f, 0.76f, 0.7839f, 0.8093f, 0.8364f,
+  0.8654f, 0.8965f, 0.9297f, 0.9653f, 0.0f, 0.03783f, 0.07319f, 0.1062f,
+  0.137f, 0.1658f, 0.1926f, 0.2178f, 0.2414f, 0.2637f, 0.2847f, 0.3047f,
+  0.3238f, 0.3422f, 0.36f, 0.3774f, 0.3946f, 0.4117f, 0.4288f, 0.4462f,
+  0.4638f, 0.4818f, 0.5f, 0.5182f, 0.5362f, 0.5538f, 0.5712f, 0.5883f,
+  0.6054f, 0.6226f, 0.64f, 0.6578f, 0.6762f, 0.6953f, 0.7153f, 0.7363f,
+  0.7586f, 0.7822f, 0.8074f, 0.8342f, 0.863f, 0.8938f, 0.9268f, 0.9622f,
+  1.0f, 0.002598f, 0.04025f, 0.07543f, 0.1082f, 0.1389f, 0.1674f, 0.1941f,
+  0.2191f, 0.2425f, 0.2646f, 0.2855f, 0.3053f, 0.3242f, 0.3424f, 0.36f,
+  0.3773f, 0.3943f, 0.4112f, 0.4282f, 0.4456f, 0.4633f, 0.4815f, 0.5f,
+  0.5185f, 0.5367f, 0.5544f, 0.5718f, 0.5888f, 0.6057f, 0.6227f, 0.64f,
+  0.6576f, 0.6758f, 0.6947f, 0.7145f, 0.7354f, 0.7575f, 0.7809f, 0.8059f,
+  0.8326f, 0.8611f, 0.8918f, 0.9246f, 0.9597f, 0.9974f, 0.00445f, 0.04197f,
+  0.07702f, 0.1097f, 0.1402f, 0.1686f, 0.1951f, 0.22f, 0.2433f, 0.2652f,
+  0.286f, 0.3056f, 0.3244f, 0.3425f, 0.36f, 0.3771f, 0.3939f, 0.4107f,
+  0.4277f, 0.445f, 0.4627f, 0.4811f, 0.5f, 0.5189f, 0.5373f, 0.555f,
+  0.5723f, 0.5893f, 0.6061f, 0.6229f, 0.64f, 0.6575f, 0.6756f, 0.6944f,
+  0.714f, 0.7348f, 0.7567f, 0.78f, 0.8049f, 0.8314f, 0.8598f, 0.8903f,
+  0.923f, 0.958f, 0.9956f, 0.005558f, 0.04301f, 0.07797f, 0.1106f, 0.141f,
+  0.1693f, 0.1958f, 0.2205f, 0.2438f, 0.2656f, 0.2862f, 0.3058f, 0.3245f,
+  0.3425f, 0.3599f, 0.3769f, 0.3937f, 0.4104f, 0.4273f, 0.4445f, 0.4622f,
+  0.4807f, 0.5f, 0.5193f, 0.5378f, 0.5555f, 0.5727f, 0.5896f, 0.6063f,
+  0.6231f, 0.6401f, 0.6575f, 0.6755f, 0.6942f, 0.7138f, 0.7344f, 0.7562f,
+  0.7795f, 0.8042f, 0.8307f, 0.859f, 0.8894f, 0.922f, 0.957f, 0.9944f,
+  0.005927f, 0.04335f, 0.07828f, 0.1109f, 0.1412f, 0.1695f, 0.196f, 0.2207f,
+  0.2439f, 0.2657f, 0.2863f, 0.3059f, 0.3246f, 0.3425f, 0.3599f, 0.3769f,
+  0.3936f, 0.4103f, 0.4271f, 0.4443f, 0.462f, 0.4805f, 0.5f, 0.5195f,
+  0.538f, 0.5557f, 0.5729f, 0.5897f, 0.6064f, 0.6231f, 0.6401f, 0.6575f,
+  0.6754f, 0.6941f, 0.7137f, 0.7343f, 0.7561f, 0.7793f, 0.804f, 0.8305f,
+  0.8588f, 0.8891f, 0.9217f, 0.9567f, 0.9941f, 0.005558f, 0.04301f, 0.07797f,
+  0.1106f, 0.141f, 0.1693f, 0.1958f, 0.2205f, 0.2438f, 0.2656f, 0.2862f,
+  0.3058f, 0.3245f, 0.3425f, 0.3599f, 0.3769f, 0.3937f, 0.4104f, 0.4273f,
+  0.4445f, 0.4622f, 0.4807f, 0.5f, 0.5193f, 0.5378f, 0.5555f, 0.5727f,
+  0.5896f, 0.6063f, 0.6231f, 0.6401f, 0.6575f, 0.6755f, 0.6942f, 0.7138f,
+  0.7344f, 0.7562f, 0.7795f, 0.8042f, 0.8307f, 0.859f, 0.8894f, 0.922f,
+  0.957f, 0.9944f, 0.00445f, 0.04197f, 0.07702f, 0.1097f, 0.1402f, 0.1686f,
+  0.1951f, 0.22f, 0.2433f, 0.2652f, 0.286f, 0.3056f, 0.3244f, 0.3425f,
+  0.36f, 0.3771f, 0.3939f, 0.4107f, 0.4277f, 0.445f, 0.4627f, 0.4811f,
+  0.5f, 0.5189f, 0.5373f, 0.555f, 0.5723f, 0.5893f, 0.6061f, 0.6229f,
+  0.64f, 0.6575f, 0.6756f, 0.6944f, 0.714f, 0.7348f, 0.7567f, 0.78f,
+  0.8049f, 0.8314f, 0.8598f, 0.8903f, 0.923f, 0.958f, 0.9956f, 0.002598f,
+  0.04025f, 0.07543f, 0.1082f, 0.1389f, 0.1674f, 0.1941f, 0.2191f, 0.2425f,
+  0.2646f, 0.2855f, 0.3053f, 0.3242f, 0.3424f, 0.36f, 0.3773f, 0.3943f,
+  0.4112f, 0.4282f, 0.4456f, 0.4633f, 0.4815f, 0.5f, 0.5185f, 0.5367f,
+  0.5544f, 0.5718f, 0.5888f, 0.6057f, 0.6227f, 0.64f, 0.6576f, 0.6758f,
+  0.6947f, 0.7145f, 0.7354f, 0.7575f, 0.7809f, 0.8059f, 0.8326f, 0.8611f,
+  0.8918f, 0.9246f, 0.9597f, 0.9974f, 0.0f, 0.03783f, 0.07319f, 0.1062f,
+  0.137f, 0.1658f, 0.1926f, 0.2178f, 0.2414f, 0.2637f, 0.2847f, 0.3047f,
+  0.3238f, 0.3422f, 0.36f, 0.3774f, 0.3946f, 0.4117f, 0.4288f, 0.4462f,
+  0.4638f, 0.4818f, 0.5f, 0.5182f, 0.5362f, 0.5538f, 0.5712f, 0.5883f,
+  0.6054f, 0.6226f, 0.64f, 0.6578f, 0.6762f, 0.6953f, 0.7153f, 0.7363f,
+  0.7586f, 0.7822f, 0.8074f, 0.8342f, 0.863f, 0.8938f, 0.9268f, 0.9622f,
+  1.0f, 0.0347f, 0.07029f, 0.1035f, 0.1346f, 0.1636f, 0.1907f, 0.2161f,
+  0.24f, 0.2625f, 0.2837f, 0.304f, 0.3233f, 0.3419f, 0.3599f, 0.3775f,
+  0.3949f, 0.4121f, 0.4293f, 0.4467f, 0.4643f, 0.4821f, 0.5f, 0.5179f,
+  0.5357f, 0.5533f, 0.5707f, 0.5879f, 0.6051f, 0.6225f, 0.6401f, 0.6581f,
+  0.6767f, 0.696f, 0.7163f, 0.7375f, 0.76f, 0.7839f, 0.8093f, 0.8364f,
+  0.8654f, 0.8965f, 0.9297f, 0.9653f, 0.03085f, 0.06673f, 0.1003f, 0.1316f,
+  0.1609f, 0.1883f, 0.214f, 0.2382f, 0.2609f, 0.2825f, 0.303f, 0.3226f,
+  0.3414f, 0.3597f, 0.3775f, 0.395f, 0.4124f, 0.4297f, 0.4471f, 0.4646f,
+  0.4823f, 0.5f, 0.5177f, 0.5354f, 0.5529f, 0.5703f, 0.5876f, 0.605f,
+  0.6225f, 0.6403f, 0.6586f, 0.6774f, 0.697f, 0.7175f, 0.7391f, 0.7618f,
+  0.786f, 0.8117f, 0.8391f, 0.8684f, 0.8997f, 0.9333f, 0.9692f, 0.02627f,
+  0.06247f, 0.09635f, 0.128f, 0.1577f, 0.1854f, 0.2114f, 0.2359f, 0.259f,
+  0.2809f, 0.3017f, 0.3216f, 0.3407f, 0.3592f, 0.3773f, 0.395f, 0.4125f,
+  0.43f, 0.4474f, 0.4649f, 0.4824f, 0.5f, 0.5176f, 0.5351f, 0.5526f,
+  0.57f, 0.5875f, 0.605f, 0.6227f, 0.6408f, 0.6593f, 0.6784f, 0.6983f,
+  0.7191f, 0.741f, 0.7641f, 0.7886f, 0.8146f, 0.8423f, 0.872f, 0.9036f,
+  0.9375f, 0.9737f, 0.02095f, 0.05752f, 0.09178f, 0.1239f, 0.1539f, 0.182f,
+  0.2084f, 0.2333f, 0.2567f, 0.2789f, 0.3f, 0.3203f, 0.3397f, 0.3585f,
+  0.3768f, 0.3947f, 0.4125f, 0.43f, 0.4475f, 0.465f, 0.4825f, 0.5f,
+  0.5175f, 0.535f, 0.5525f, 0.57f, 0.5875f, 0.6053f, 0.6232f, 0.6415f,
+  0.6603f, 0.6797f, 0.7f, 0.7211f, 0.7433f, 0.7667f, 0.7916f, 0.818f,
+  0.8461f, 0.8761f, 0.9082f, 0.9425f, 0.979f, 0.05185f, 0.08653f, 0.119f,
+  0.1495f, 0.178f, 0.2049f, 0.2301f, 0.254f, 0.2766f, 0.2981f, 0.3186f,
+  0.3384f, 0.3575f, 0.3761f, 0.3943f, 0.4122f, 0.4299f, 0.4475f, 0.465f,
+  0.4825f, 0.5f, 0.5175f, 0.535f, 0.5525f, 0.5701f, 0.5878f, 0.6057f,
+  0.6239f, 0.6425f, 0.6616f, 0.6814f, 0.7019f, 0.7234f, 0.746f, 0.7699f,
+  0.7951f, 0.822f, 0.8505f, 0.881f, 0.9135f, 0.9482f, 0.04545f, 0.08059f,
+  0.1136f, 0.1445f, 0.1735f, 0.2008f, 0.2265f, 0.2508f, 0.2738f, 0.2957f,
+  0.3166f, 0.3368f, 0.3562f, 0.3751f, 0.3935f, 0.4117f, 0.4295f, 0.4473f,
+  0.4649f, 0.4825f, 0.5f, 0.5175f, 0.5351f, 0.5527f, 0.5705f, 0.5883f,
+  0.6065f, 0.6249f, 0.6438f, 0.6632f, 0.6834f, 0.7043f, 0.7262f, 0.7492f,
+  0.7735f, 0.7992f, 0.8265f, 0.8555f, 0.8864f, 0.9194f, 0.9545f, 0.07394f,
+  0.1074f, 0.1388f, 0.1684f, 0.1962f, 0.2224f, 0.2471f, 0.2706f, 0.2929f,
+  0.3143f, 0.3348f, 0.3546f, 0.3738f, 0.3925f, 0.4109f, 0.429f, 0.4469f,
+  0.4647f, 0.4823f, 0.5f, 0.5177f, 0.5353f, 0.5531f, 0.571f, 0.5891f,
+  0.6075f, 0.6262f, 0.6454f, 0.6652f, 0.6857f, 0.7071f, 0.7294f, 0.7529f,
+  0.7776f, 0.8038f, 0.8316f, 0.8612f, 0.8926f, 0.9261f, 0.06657f, 0.1006f,
+  0.1325f, 0.1626f, 0.191f, 0.2177f, 0.2429f, 0.2669f, 0.2897f, 0.3115f,
+  0.3324f, 0.3526f, 0.3722f, 0.3912f, 0.4099f, 0.4282f, 0.4464f, 0.4643f,
+  0.4822f, 0.5f, 0.5178f, 0.5357f, 0.5536f, 0.5718f, 0.5901f, 0.6088f,
+  0.6278f, 0.6474f, 0.6676f, 0.6885f, 0.7103f, 0.7331f, 0.7571f, 0.7823f,
+  0.809f, 0.8374f, 0.8675f, 0.8994f, 0.9334f, 0.09304f, 0.1256f, 0.1562f,
+  0.1851f, 0.2124f, 0.2382f, 0.2627f, 0.286f, 0.3083f, 0.3297f, 0.3503f,
+  0.3702f, 0.3897f, 0.4086f, 0.4273f, 0.4457f, 0.4639f, 0.482f, 0.5f,
+  0.518f, 0.5361f, 0.5543f, 0.5727f, 0.5914f, 0.6103f, 0.6298f, 0.6497f,
+  0.6703f, 0.6917f, 0.714f, 0.7373f, 0.7618f, 0.7876f, 0.8149f, 0.8438f,
+  0.8744f, 0.907f, 0.1179f, 0.1492f, 0.1787f, 0.2066f, 0.233f, 0.258f,
+  0.2819f, 0.3046f, 0.3265f, 0.3476f, 0.368f, 0.3878f, 0.4071f, 0.4261f,
+  0.4448f, 0.4633f, 0.4817f, 0.5f, 0.5183f, 0.5367f, 0.5552f, 0.5739f,
+  0.5929f, 0.6122f, 0.632f, 0.6524f, 0.6735f, 0.6954f, 0.7181f, 0.742f,
+  0.767f, 0.7934f, 0.8213f, 0.8508f, 0.8821f, 0.1415f, 0.1716f, 0.2001f,
+  0.2271f, 0.2528f, 0.2772f, 0.3005f, 0.3229f, 0.3445f, 0.3653f, 0.3856f,
+  0.4054f, 0.4247f, 0.4438f, 0.4627f, 0.4814f, 0.5f, 0.5186f, 0.5373f,
+  0.5562f, 0.5753f, 0.5946f, 0.6144f, 0.6347f, 0.6555f, 0.6771f, 0.6995f,
+  0.7228f, 0.7472f, 0.7729f, 0.7999f, 0.8284f, 0.8585f, 0.1639f, 0.193f,
+  0.2207f, 0.247f, 0.272f, 0.2959f, 0.3189f, 0.341f, 0.3624f, 0.3831f,
+  0.4033f, 0.4232f, 0.4426f, 0.4619f, 0.481f, 0.5f, 0.519f, 0.5381f,
+  0.5574f, 0.5768f, 0.5967f, 0.6169f, 0.6376f, 0.659f, 0.6811f, 0.7041f,
+  0.728f, 0.753f, 0.7793f, 0.807f, 0.8361f, 0.1854f, 0.2137f, 0.2406f,
+  0.2663f, 0.2909f, 0.3144f, 0.3371f, 0.359f, 0.3803f, 0.4011f, 0.4214f,
+  0.4413f, 0.461f, 0.4805f, 0.5f, 0.5195f, 0.539f, 0.5587f, 0.5786f,
+  0.5989f, 0.6197f, 0.641f, 0.6629f, 0.6856f, 0.7091f, 0.7337f, 0.7594f,
+  0.7863f, 0.8146f, 0.2061f, 0.2337f, 0.2601f, 0.2853f, 0.3095f, 0.3328f,
+  0.3553f, 0.3772f, 0.3985f, 0.4193f, 0.4398f, 0.46f, 0.4801f, 0.5f,
+  0.5199f, 0.54f, 0.5602f, 0.5807f, 0.6015f, 0.6228f, 0.6447f, 0.6672f,
+  0.6905f, 0.7147f, 0.7399f, 0.7663f, 0.7939f, 0.2263f, 0.2533f, 0.2793f,
+  0.3041f, 0.3281f, 0.3513f, 0.3738f, 0.3957f, 0.4171f, 0.4381f, 0.4589f,
+  0.4795f, 0.5f, 0.5205f, 0.5411f, 0.5619f, 0.5829f, 0.6043f, 0.6262f,
+  0.6487f, 0.6719f, 0.6959f, 0.7207f, 0.7467f, 0.7737f, 0.2727f, 0.2983f,
+  0.323f, 0.3469f, 0.37f, 0.3926f, 0.4146f, 0.4363f, 0.4577f, 0.4789f,
+  0.5f, 0.5211f, 0.5423f, 0.5637f, 0.5854f, 0.6074f, 0.63f, 0.6531f,
+  0.677f, 0.7017f, 0.7273f, 0.3175f, 0.3421f, 0.366f, 0.3892f, 0.412f,
+  0.4343f, 0.4564f, 0.4782f, 0.5f, 0.5218f, 0.5436f, 0.5657f, 0.588f,
+  0.6108f, 0.634f, 0.6579f, 0.6825f, 0.4091f, 0.4322f, 0.4549f, 0.4775f,
+  0.5f, 0.5225f, 0.5451f, 0.5678f, 0.5909f,
+};
+static const BuiltInMeshEye osvr_display_mesh_built_in_osvr_hdk13_v2_eyes[] = {
+  {1597,
+   osvr_display_mesh_built_in_osvr_hdk13_v2_eye0_from_x,
+   osvr_display_mesh_built_in_osvr_hdk13_v2_eye0_from_y,
+   osvr_display_mesh_built_in_osvr_hdk13_v2_eye0_to_x,
+   osvr_display_mesh_built_in_osvr_hdk13_v2_eye0_to_y},
+  {1597,
+   osvr_display_mesh_built_in_osvr_hdk13_v2_eye1_from_x,
+   osvr_display_mesh_built_in_osvr_hdk13_v2_eye1_from_y,
+   osvr_display_mesh_built_in_osvr_hdk13_v2_eye1_to_x,
+   osvr_display_mesh_built_in_osvr_hdk13_v2_eye1_to_y},
+};
+
+// OSVR_HDK_20_V1
+static const float osvr_display_mesh_built_in_osvr_hdk20_v1_eye0_from_x[] = {
+  0.983f, 0.9969f, 1.006f, 1.012f, 1.017f, 1.02f, 1.023f, 1.025f,
+  1.026f, 1.028f, 1.028f, 1.029f, 1.029f, 1.029f, 1.029f, 1.029f,
+  1.028f, 1.028f, 1.026f, 1.025f, 1.023f, 1.02f, 1.017f, 1.012f,
+  1.006f, 0.9969f, 0.983f, 0.9676f, 0.9799f, 0.9877f, 0.9923f, 0.9954f,
+  0.9985f, 1.002f, 1.003f, 1.005f, 1.006f, 1.008f, 1.008f, 1.009f,
+  1.009f, 1.009f, 1.009f, 1.009f, 1.008f, 1.008f, 1.006f, 1.005f,
+  1.003f, 1.002f, 0.9985f, 0.9954f, 0.9923f, 0.9877f, 0.9799f, 0.9676f,
+  0.9491f, 0.9599f, 0.966f, 0.9707f, 0.9738f, 0.9769f, 0.9784f, 0.9815f,
+  0.983f, 0.9846f, 0.9861f, 0.9877f, 0.9892f, 0.9892f, 0.9907f, 0.9907f,
+  0.9907f, 0.9892f, 0.9892f, 0.9877f, 0.9861f, 0.9846f, 0.983f, 0.9815f,
+  0.9784f, 0.9769f, 0.9738f, 0.9707f, 0.966f, 0.9599f, 0.9491f, 0.9198f,
+  0.9275f, 0.9367f, 0.9429f, 0.9475f, 0.9506f, 0.9537f, 0.9568f, 0.9583f,
+  0.9599f, 0.963f, 0.9645f, 0.966f, 0.9691f, 0.9707f, 0.9707f, 0.9722f,
+  0.9722f, 0.9722f, 0.9707f, 0.9707f, 0.9691f, 0.966f, 0.9645f, 0.963f,
+  0.9599f, 0.9583f, 0.9568f, 0.9537f, 0.9506f, 0.9475f, 0.9429f, 0.9367f,
+  0.9275f, 0.9198f, 0.8966f, 0.909f, 0.9136f, 0.9198f, 0.9244f, 0.9275f,
+  0.9306f, 0.9321f, 0.9352f, 0.9383f, 0.9398f, 0.9429f, 0.946f, 0.9475f,
+  0.9506f, 0.9522f, 0.9522f, 0.9537f, 0.9537f, 0.9537f, 0.9522f, 0.9522f,
+  0.9506f, 0.9475f, 0.946f, 0.9429f, 0.9398f, 0.9383f, 0.9352f, 0.9321f,
+  0.9306f, 0.9275f, 0.9244f, 0.9198f, 0.9136f, 0.909f, 0.8966f, 0.8719f,
+  0.8843f, 0.892f, 0.8966f, 0.8997f, 0.9028f, 0.9059f, 0.909f, 0.912f,
+  0.9136f, 0.9167f, 0.9198f, 0.9228f, 0.9259f, 0.929f, 0.9321f, 0.9336f,
+  0.9352f, 0.9352f, 0.9352f, 0.9352f, 0.9352f, 0.9336f, 0.9321f, 0.929f,
+  0.9259f, 0.9228f, 0.9198f, 0.9167f, 0.9136f, 0.912f, 0.909f, 0.9059f,
+  0.9028f, 0.8997f, 0.8966f, 0.892f, 0.8843f, 0.8719f, 0.8596f, 0.8673f,
+  0.8719f, 0.875f, 0.8781f, 0.8812f, 0.8843f, 0.8873f, 0.8904f, 0.8935f,
+  0.8966f, 0.9012f, 0.9043f, 0.9074f, 0.9105f, 0.912f, 0.9151f, 0.9167f,
+  0.9167f, 0.9167f, 0.9167f, 0.9167f, 0.9151f, 0.912f, 0.9105f, 0.9074f,
+  0.9043f, 0.9012f, 0.8966f, 0.8935f, 0.8904f, 0.8873f, 0.8843f, 0.8812f,
+  0.8781f, 0.875f, 0.8719f, 0.8673f, 0.8596f, 0.8333f, 0.841f, 0.8472f,
+  0.8503f, 0.8534f, 0.8565f, 0.8596f, 0.8611f, 0.8657f, 0.8688f, 0.8719f,
+  0.8765f, 0.8796f, 0.8843f, 0.8873f, 0.8904f, 0.8935f, 0.8951f, 0.8966f,
+  0.8981f, 0.8981f, 0.8981f, 0.8966f, 0.8951f, 0.8935f, 0.8904f, 0.8873f,
+  0.8843f, 0.8796f, 0.8765f, 0.8719f, 0.8688f, 0.8657f, 0.8611f, 0.8596f,
+  0.8565f, 0.8534f, 0.8503f, 0.8472f, 0.841f, 0.8333f, 0.8148f, 0.821f,
+  0.8256f, 0.8272f, 0.8318f, 0.8333f, 0.8364f, 0.8395f, 0.8426f, 0.8472f,
+  0.8519f, 0.8549f, 0.8596f, 0.8627f, 0.8673f, 0.8704f, 0.8719f, 0.875f,
+  0.8765f, 0.8765f, 0.8765f, 0.8765f, 0.8765f, 0.875f, 0.8719f, 0.8704f,
+  0.8673f, 0.8627f, 0.8596f, 0.8549f, 0.8519f, 0.8472f, 0.8426f, 0.8395f,
+  0.8364f, 0.8333f, 0.8318f, 0.8272f, 0.8256f, 0.821f, 0.8148f, 0.7963f,
+  0.7994f, 0.8025f, 0.8056f, 0.8086f, 0.8102f, 0.8133f, 0.8179f, 0.821f,
+  0.8256f, 0.8302f, 0.8333f, 0.838f, 0.841f, 0.8457f, 0.8472f, 0.8503f,
+  0.8519f, 0.8534f, 0.8549f, 0.8549f, 0.8549f, 0.8534f, 0.8519f, 0.8503f,
+  0.8472f, 0.8457f, 0.841f, 0.838f, 0.8333f, 0.8302f, 0.8256f, 0.821f,
+  0.8179f, 0.8133f, 0.8102f, 0.8086f, 0.8056f, 0.8025f, 0.7994f, 0.7963f,
+  0.7747f, 0.7778f, 0.7793f, 0.7809f, 0.784f, 0.787f, 0.7901f, 0.7948f,
+  0.7978f, 0.8025f, 0.8071f, 0.8117f, 0.8148f, 0.8179f, 0.8225f, 0.8241f,
+  0.8272f, 0.8287f, 0.8302f, 0.8318f, 0.8318f, 0.8318f, 0.8302f, 0.8287f,
+  0.8272f, 0.8241f, 0.8225f, 0.8179f, 0.8148f, 0.8117f, 0.8071f, 0.8025f,
+  0.7978f, 0.7948f, 0.7901f, 0.787f, 0.784f, 0.7809f, 0.7793f, 0.7778f,
+  0.7747f, 0.7515f, 0.7531f, 0.7562f, 0.7577f, 0.7608f, 0.7639f, 0.767f,
+  0.7716f, 0.7747f, 0.7793f, 0.784f, 0.787f, 0.7917f, 0.7948f, 0.7978f,
+  0.8009f, 0.8025f, 0.8056f, 0.8071f, 0.8086f, 0.8086f, 0.8086f, 0.8071f,
+  0.8056f, 0.8025f, 0.8009f, 0.7978f, 0.7948f, 0.7917f, 0.787f, 0.784f,
+  0.7793f, 0.7747f, 0.7716f, 0.767f, 0.7639f, 0.7608f, 0.7577f, 0.7562f,
+  0.7531f, 0.7515f, 0.7284f, 0.7299f, 0.7315f, 0.7346f, 0.7377f, 0.7407f,
+  0.7438f, 0.7469f, 0.7515f, 0.7546f, 0.7593f, 0.7623f, 0.7654f, 0.7685f,
+  0.7731f, 0.7762f, 0.7778f, 0.7809f, 0.7824f, 0.7824f, 0.784f, 0.7824f,
+  0.7824f, 0.7809f, 0.7778f, 0.7762f, 0.7731f, 0.7685f, 0.7654f, 0.7623f,
+  0.7593f, 0.7546f, 0.7515f, 0.7469f, 0.7438f, 0.7407f, 0.7377f, 0.7346f,
+  0.7315f, 0.7299f, 0.7284f, 0.7052f, 0.7068f, 0.7083f, 0.7099f, 0.713f,
+  0.716f, 0.7191f, 0.7222f, 0.7269f, 0.7299f, 0.733f, 0.7361f, 0.7392f,
+  0.7438f, 0.7469f, 0.75f, 0.7515f, 0.7546f, 0.7546f, 0.7562f, 0.7562f,
+  0.7562f, 0.7546f, 0.7546f, 0.7515f, 0.75f, 0.7469f, 0.7438f, 0.7392f,
+  0.7361f, 0.733f, 0.7299f, 0.7269f, 0.7222f, 0.7191f, 0.716f, 0.713f,
+  0.7099f, 0.7083f, 0.7068f, 0.7052f, 0.6807f, 0.6821f, 0.6836f, 0.6856f,
+  0.6883f, 0.6914f, 0.6944f, 0.6975f, 0.7006f, 0.7037f, 0.7068f, 0.7099f,
+  0.713f, 0.716f, 0.7191f, 0.7222f, 0.7238f, 0.7253f, 0.7253f, 0.7253f,
+  0.7238f, 0.7253f, 0.7253f, 0.7253f, 0.7238f, 0.7222f, 0.7191f, 0.716f,
+  0.713f, 0.7099f, 0.7068f, 0.7037f, 0.7006f, 0.6975f, 0.6944f, 0.6914f,
+  0.6883f, 0.6856f, 0.6836f, 0.6821f, 0.6807f, 0.6566f, 0.6577f, 0.6591f,
+  0.661f, 0.6633f, 0.6657f, 0.6684f, 0.6711f, 0.6739f, 0.6767f, 0.6793f,
+  0.6821f, 0.6849f, 0.6878f, 0.6898f, 0.6929f, 0.6929f, 0.6929f, 0.6914f,
+  0.6914f, 0.6914f, 0.6914f, 0.6914f, 0.6929f, 0.6929f, 0.6929f, 0.6898f,
+  0.6878f, 0.6849f, 0.6821f, 0.6793f, 0.6767f, 0.6739f, 0.6711f, 0.6684f,
+  0.6657f, 0.6633f, 0.661f, 0.6591f, 0.6577f, 0.6566f, 0.6323f, 0.6332f,
+  0.6344f, 0.636f, 0.638f, 0.64f, 0.6421f, 0.6444f, 0.6468f, 0.6491f,
+  0.6512f, 0.6535f, 0.656f, 0.6585f, 0.6605f, 0.6611f, 0.6606f, 0.6594f,
+  0.6582f, 0.6573f, 0.6569f, 0.6573f, 0.6582f, 0.6594f, 0.6606f, 0.6611f,
+  0.6605f, 0.6585f, 0.656f, 0.6535f, 0.6512f, 0.6491f, 0.6468f, 0.6444f,
+  0.6421f, 0.64f, 0.638f, 0.636f, 0.6344f, 0.6332f, 0.6323f, 0.6077f,
+  0.6085f, 0.6096f, 0.6106f, 0.6122f, 0.6139f, 0.6156f, 0.6173f, 0.6191f,
+  0.6208f, 0.6225f, 0.6244f, 0.6264f, 0.6282f, 0.6293f, 0.6292f, 0.6281f,
+  0.6267f, 0.6255f, 0.6245f, 0.6242f, 0.6245f, 0.6255f, 0.6267f, 0.6281f,
+  0.6292f, 0.6293f, 0.6282f, 0.6264f, 0.6244f, 0.6225f, 0.6208f, 0.6191f,
+  0.6173f, 0.6156f, 0.6139f, 0.6122f, 0.6106f, 0.6096f, 0.6085f, 0.6077f,
+  0.5832f, 0.5838f, 0.5844f, 0.5852f, 0.5863f, 0.5873f, 0.5886f, 0.5898f,
+  0.5909f, 0.5921f, 0.5934f, 0.5946f, 0.596f, 0.5971f, 0.5975f, 0.5971f,
+  0.5961f, 0.5949f, 0.5938f, 0.5931f, 0.5929f, 0.5931f, 0.5938f, 0.5949f,
+  0.5961f, 0.5971f, 0.5975f, 0.5971f, 0.596f, 0.5946f, 0.5934f, 0.5921f,
+  0.5909f, 0.5898f, 0.5886f, 0.5873f, 0.5863f, 0.5852f, 0.5844f, 0.5838f,
+  0.5832f, 0.5586f, 0.559f, 0.5593f, 0.5596f, 0.5602f, 0.5608f, 0.5613f,
+  0.5619f, 0.5625f, 0.5631f, 0.5637f, 0.5644f, 0.5651f, 0.5656f, 0.5657f,
+  0.5654f, 0.5648f, 0.5642f, 0.5636f, 0.5631f, 0.563f, 0.5631f, 0.5636f,
+  0.5642f, 0.5648f, 0.5654f, 0.5657f, 0.5656f, 0.5651f, 0.5644f, 0.5637f,
+  0.5631f, 0.5625f, 0.5619f, 0.5613f, 0.5608f, 0.5602f, 0.5596f, 0.5593f,
+  0.559f, 0.5586f, 0.534f, 0.534f, 0.534f, 0.534f, 0.534f, 0.534f,
+  0.534f, 0.534f, 0.534f, 0.534f, 0.534f, 0.534f, 0.534f, 0.534f,
+  0.534f, 0.534f, 0.534f, 0.534f, 0.534f, 0.534f, 0.534f, 0.534f,
+  0.534f, 0.534f, 0.534f, 0.534f, 0.534f, 0.534f, 0.534f, 0.534f,
+  0.534f, 0.534f, 0.534f, 0.534f, 0.534f, 0.534f, 0.534f, 0.534f,
+  0.534f, 0.534f, 0.534f, 0.5093f, 0.509f, 0.5086f, 0.5083f, 0.5077f,
+  0.5071f, 0.5066f, 0.506f, 0.5054f, 0.5048f, 0.5042f, 0.5035f, 0.5028f,
+  0.5023f, 0.5022f, 0.5025f, 0.5031f, 0.5037f, 0.5043f, 0.5048f, 0.5049f,
+  0.5048f, 0.5043f, 0.5037f, 0.5031f, 0.5025f, 0.5022f, 0.5023f, 0.5028f,
+  0.5035f, 0.5042f, 0.5048f, 0.5054f, 0.506f, 0.5066f, 0.5071f, 0.5077f,
+  0.5083f, 0.5086f, 0.509f, 0.5093f, 0.4847f, 0.4841f, 0.4835f, 0.4827f,
+  0.4816f, 0.4806f, 0.4793f, 0.4781f, 0.477f, 0.4758f, 0.4745f, 0.4733f,
+  0.4719f, 0.4708f, 0.4704f, 0.4708f, 0.4718f, 0.473f, 0.4741f, 0.4748f,
+  0.475f, 0.4748f, 0.4741f, 0.473f, 0.4718f, 0.4708f, 0.4704f, 0.4708f,
+  0.4719f, 0.4733f, 0.4745f, 0.4758f, 0.477f, 0.4781f, 0.4793f, 0.4806f,
+  0.4816f, 0.4827f, 0.4835f, 0.4841f, 0.4847f, 0.4602f, 0.4594f, 0.4583f,
+  0.4573f, 0.4557f, 0.454f, 0.4523f, 0.4506f, 0.4488f, 0.4471f, 0.4454f,
+  0.4435f, 0.4415f, 0.4397f, 0.4386f, 0.4387f, 0.4398f, 0.4412f, 0.4424f,
+  0.4434f, 0.4437f, 0.4434f, 0.4424f, 0.4412f, 0.4398f, 0.4387f, 0.4386f,
+  0.4397f, 0.4415f, 0.4435f, 0.4454f, 0.4471f, 0.4488f, 0.4506f, 0.4523f,
+  0.454f, 0.4557f, 0.4573f, 0.4583f, 0.4594f, 0.4602f, 0.4356f, 0.4347f,
+  0.4335f, 0.4319f, 0.4299f, 0.4279f, 0.4258f, 0.4235f, 0.4211f, 0.4188f,
+  0.4167f, 0.4144f, 0.4119f, 0.4094f, 0.4074f, 0.4068f, 0.4073f, 0.4085f,
+  0.4097f, 0.4106f, 0.411f, 0.4106f, 0.4097f, 0.4085f, 0.4073f, 0.4068f,
+  0.4074f, 0.4094f, 0.4119f, 0.4144f, 0.4167f, 0.4188f, 0.4211f, 0.4235f,
+  0.4258f, 0.4279f, 0.4299f, 0.4319f, 0.4335f, 0.4347f, 0.4356f, 0.4113f,
+  0.4102f, 0.4088f, 0.4069f, 0.4046f, 0.4022f, 0.3995f, 0.3968f, 0.394f,
+  0.3912f, 0.3886f, 0.3858f, 0.383f, 0.3801f, 0.3781f, 0.375f, 0.375f,
+  0.375f, 0.3765f, 0.3765f, 0.3765f, 0.3765f, 0.3765f, 0.375f, 0.375f,
+  0.375f, 0.3781f, 0.3801f, 0.383f, 0.3858f, 0.3886f, 0.3912f, 0.394f,
+  0.3968f, 0.3995f, 0.4022f, 0.4046f, 0.4069f, 0.4088f, 0.4102f, 0.4113f,
+  0.3872f, 0.3858f, 0.3843f, 0.3823f, 0.3796f, 0.3765f, 0.3735f, 0.3704f,
+  0.3673f, 0.3642f, 0.3611f, 0.358f, 0.3549f, 0.3519f, 0.3488f, 0.3457f,
+  0.3441f, 0.3426f, 0.3426f, 0.3426f, 0.3441f, 0.3426f, 0.3426f, 0.3426f,
+  0.3441f, 0.3457f, 0.3488f, 0.3519f, 0.3549f, 0.358f, 0.3611f, 0.3642f,
+  0.3673f, 0.3704f, 0.3735f, 0.3765f, 0.3796f, 0.3823f, 0.3843f, 0.3858f,
+  0.3872f, 0.3627f, 0.3611f, 0.3596f, 0.358f, 0.3549f, 0.3519f, 0.3488f,
+  0.3457f, 0.341f, 0.338f, 0.3349f, 0.3318f, 0.3287f, 0.3241f, 0.321f,
+  0.3179f, 0.3164f, 0.3133f, 0.3133f, 0.3117f, 0.3117f, 0.3117f, 0.3133f,
+  0.3133f, 0.3164f, 0.3179f, 0.321f, 0.3241f, 0.3287f, 0.3318f, 0.3349f,
+  0.338f, 0.341f, 0.3457f, 0.3488f, 0.3519f, 0.3549f, 0.358f, 0.3596f,
+  0.3611f, 0.3627f, 0.3395f, 0.338f, 0.3364f, 0.3333f, 0.3302f, 0.3272f,
+  0.3241f, 0.321f, 0.3164f, 0.3133f, 0.3086f, 0.3056f, 0.3025f, 0.2994f,
+  0.2948f, 0.2917f, 0.2901f, 0.287f, 0.2855f, 0.2855f, 0.284f, 0.2855f,
+  0.2855f, 0.287f, 0.2901f, 0.2917f, 0.2948f, 0.2994f, 0.3025f, 0.3056f,
+  0.3086f, 0.3133f, 0.3164f, 0.321f, 0.3241f, 0.3272f, 0.3302f, 0.3333f,
+  0.3364f, 0.338f, 0.3395f, 0.3164f, 0.3148f, 0.3117f, 0.3102f, 0.3071f,
+  0.304f, 0.3009f, 0.2963f, 0.2932f, 0.2886f, 0.284f, 0.2809f, 0.2762f,
+  0.2731f, 0.2701f, 0.267f, 0.2654f, 0.2623f, 0.2608f, 0.2593f, 0.2593f,
+  0.2593f, 0.2608f, 0.2623f, 0.2654f, 0.267f, 0.2701f, 0.2731f, 0.2762f,
+  0.2809f, 0.284f, 0.2886f, 0.2932f, 0.2963f, 0.3009f, 0.304f, 0.3071f,
+  0.3102f, 0.3117f, 0.3148f, 0.3164f, 0.2932f, 0.2901f, 0.2886f, 0.287f,
+  0.284f, 0.2809f, 0.2778f, 0.2731f, 0.2701f, 0.2654f, 0.2608f, 0.2562f,
+  0.2531f, 0.25f, 0.2454f, 0.2438f, 0.2407f, 0.2392f, 0.2377f, 0.2361f,
+  0.2361f, 0.2361f, 0.2377f, 0.2392f, 0.2407f, 0.2438f, 0.2454f, 0.25f,
+  0.2531f, 0.2562f, 0.2608f, 0.2654f, 0.2701f, 0.2731f, 0.2778f, 0.2809f,
+  0.284f, 0.287f, 0.2886f, 0.2901f, 0.2932f, 0.2716f, 0.2685f, 0.2654f,
+  0.2623f, 0.2593f, 0.2577f, 0.2546f, 0.25f, 0.2469f, 0.2423f, 0.2377f,
+  0.2346f, 0.2299f, 0.2269f, 0.2222f, 0.2207f, 0.2176f, 0.216f, 0.2145f,
+  0.213f, 0.213f, 0.213f, 0.2145f, 0.216f, 0.2176f, 0.2207f, 0.2222f,
+  0.2269f, 0.2299f, 0.2346f, 0.2377f, 0.2423f, 0.2469f, 0.25f, 0.2546f,
+  0.2577f, 0.2593f, 0.2623f, 0.2654f, 0.2685f, 0.2716f, 0.2531f, 0.2469f,
+  0.2423f, 0.2407f, 0.2361f, 0.2346f, 0.2315f, 0.2284f, 0.2253f, 0.2207f,
+  0.216f, 0.213f, 0.2083f, 0.2052f, 0.2006f, 0.1975f, 0.196f, 0.1929f,
+  0.1914f, 0.1914f, 0.1914f, 0.1914f, 0.1914f, 0.1929f, 0.196f, 0.1975f,
+  0.2006f, 0.2052f, 0.2083f, 0.213f, 0.216f, 0.2207f, 0.2253f, 0.2284f,
+  0.2315f, 0.2346f, 0.2361f, 0.2407f, 0.2423f, 0.2469f, 0.2531f, 0.2346f,
+  0.2207f, 0.2176f, 0.2145f, 0.2114f, 0.2083f, 0.2068f, 0.2022f, 0.1991f,
+  0.196f, 0.1914f, 0.1883f, 0.1836f, 0.1806f, 0.1775f, 0.1744f, 0.1728f,
+  0.1713f, 0.1698f, 0.1698f, 0.1698f, 0.1713f, 0.1728f, 0.1744f, 0.1775f,
+  0.1806f, 0.1836f, 0.1883f, 0.1914f, 0.196f, 0.1991f, 0.2022f, 0.2068f,
+  0.2083f, 0.2114f, 0.2145f, 0.2176f, 0.2207f, 0.2346f, 0.2222f, 0.2083f,
+  0.2006f, 0.196f, 0.1929f, 0.1898f, 0.1867f, 0.1836f, 0.1806f, 0.1775f,
+  0.1744f, 0.1713f, 0.1667f, 0.1636f, 0.1605f, 0.1574f, 0.1559f, 0.1528f,
+  0.1512f, 0.1512f, 0.1512f, 0.1512f, 0.1512f, 0.1528f, 0.1559f, 0.1574f,
+  0.1605f, 0.1636f, 0.1667f, 0.1713f, 0.1744f, 0.1775f, 0.1806f, 0.1836f,
+  0.1867f, 0.1898f, 0.1929f, 0.196f, 0.2006f, 0.2083f, 0.2222f, 0.196f,
+  0.1836f, 0.1759f, 0.1713f, 0.1682f, 0.1651f, 0.162f, 0.159f, 0.1559f,
+  0.1543f, 0.1512f, 0.1481f, 0.1451f, 0.142f, 0.1389f, 0.1358f, 0.1343f,
+  0.1327f, 0.1327f, 0.1327f, 0.1327f, 0.1327f, 0.1343f, 0.1358f, 0.1389f,
+  0.142f, 0.1451f, 0.1481f, 0.1512f, 0.1543f, 0.1559f, 0.159f, 0.162f,
+  0.1651f, 0.1682f, 0.1713f, 0.1759f, 0.1836f, 0.196f, 0.1713f, 0.159f,
+  0.1543f, 0.1481f, 0.1435f, 0.1404f, 0.1373f, 0.1358f, 0.1327f, 0.1296f,
+  0.1281f, 0.125f, 0.1219f, 0.1204f, 0.1173f, 0.1157f, 0.1157f, 0.1142f,
+  0.1142f, 0.1142f, 0.1157f, 0.1157f, 0.1173f, 0.1204f, 0.1219f, 0.125f,
+  0.1281f, 0.1296f, 0.1327f, 0.1358f, 0.1373f, 0.1404f, 0.1435f, 0.1481f,
+  0.1543f, 0.159f, 0.1713f, 0.1481f, 0.1404f, 0.125f, 0.1204f, 0.1173f,
+  0.1142f, 0.1111f, 0.1096f, 0.108f, 0.1049f, 0.1034f, 0.1019f, 0.09877f,
+  0.09722f, 0.09722f, 0.09568f, 0.09568f, 0.09568f, 0.09722f, 0.09722f, 0.09877f,
+  0.1019f, 0.1034f, 0.1049f, 0.108f, 0.1096f, 0.1111f, 0.1142f, 0.1173f,
+  0.1204f, 0.125f, 0.1404f, 0.1481f, 0.1358f, 0.1188f, 0.108f, 0.1019f,
+  0.09722f, 0.09414f, 0.09105f, 0.08951f, 0.08642f, 0.08488f, 0.08333f, 0.08179f,
+  0.08025f, 0.0787f, 0.0787f, 0.07716f, 0.07716f, 0.07716f, 0.0787f, 0.0787f,
+  0.08025f, 0.08179f, 0.08333f, 0.08488f, 0.08642f, 0.08951f, 0.09105f, 0.09414f,
+  0.09722f, 0.1019f, 0.108f, 0.1188f, 0.1358f, 0.1003f, 0.08796f, 0.08025f,
+  0.07562f, 0.07253f, 0.06944f, 0.06636f, 0.06481f, 0.06327f, 0.06173f, 0.06019f,
+  0.06019f, 0.05864f, 0.05864f, 0.05864f, 0.05864f, 0.05864f, 0.06019f, 0.06019f,
+  0.06173f, 0.06327f, 0.06481f, 0.06636f, 0.06944f, 0.07253f, 0.07562f, 0.08025f,
+  0.08796f, 0.1003f, 0.08488f, 0.07099f, 0.06173f, 0.05556f, 0.05093f, 0.04784f,
+  0.04475f, 0.04321f, 0.04167f, 0.04012f, 0.04012f, 0.03858f, 0.03858f, 0.03858f,
+  0.03858f, 0.03858f, 0.04012f, 0.04012f, 0.04167f, 0.04321f, 0.04475f, 0.04784f,
+  0.05093f, 0.05556f, 0.06173f, 0.07099f, 0.08488f,
+};
+static const float osvr_display_mesh_built_in_osvr_hdk20_v1_eye0_from_y[] = {
+  0.2375f, 0.25f, 0.2667f, 0.2847f, 0.3042f, 0.325f, 0.3458f, 0.3676f,
+  0.3893f, 0.4113f, 0.4333f, 0.4554f, 0.4778f, 0.5f, 0.5222f, 0.5446f,
+  0.5667f, 0.5888f, 0.6107f, 0.6324f, 0.6542f, 0.675f, 0.6958f, 0.7153f,
+  0.7333f, 0.75f, 0.7625f, 0.2125f, 0.225f, 0.2431f, 0.2611f, 0.2806f,
+  0.3014f, 0.3222f, 0.3444f, 0.3661f, 0.3882f, 0.4103f, 0.4326f, 0.455f,
+  0.4775f, 0.5f, 0.5225f, 0.545f, 0.5674f, 0.5897f, 0.6118f, 0.6339f,
+  0.6556f, 0.6778f, 0.6986f, 0.7194f, 0.7389f, 0.7569f, 0.775f, 0.7875f,
+  0.1889f, 0.2028f, 0.2194f, 0.2375f, 0.2583f, 0.2792f, 0.3f, 0.3208f,
+  0.3431f, 0.3647f, 0.3869f, 0.4093f, 0.4318f, 0.4544f, 0.4772f, 0.5f,
+  0.5228f, 0.5456f, 0.5682f, 0.5907f, 0.6131f, 0.6353f, 0.6569f, 0.6792f,
+  0.7f, 0.7208f, 0.7417f, 0.7625f, 0.7806f, 0.7972f, 0.8111f, 0.1514f,
+  0.1667f, 0.1792f, 0.1958f, 0.2153f, 0.2347f, 0.2556f, 0.2764f, 0.2972f,
+  0.3194f, 0.3417f, 0.3631f, 0.3854f, 0.4079f, 0.4307f, 0.4537f, 0.4768f,
+  0.5f, 0.5232f, 0.5463f, 0.5693f, 0.5921f, 0.6146f, 0.6369f, 0.6583f,
+  0.6806f, 0.7028f, 0.7236f, 0.7444f, 0.7653f, 0.7847f, 0.8042f, 0.8208f,
+  0.8333f, 0.8486f, 0.1319f, 0.1417f, 0.1583f, 0.1736f, 0.1931f, 0.2125f,
+  0.2319f, 0.2528f, 0.275f, 0.2958f, 0.3167f, 0.3389f, 0.3611f, 0.3836f,
+  0.4064f, 0.4296f, 0.4529f, 0.4764f, 0.5f, 0.5236f, 0.5471f, 0.5704f,
+  0.5936f, 0.6164f, 0.6389f, 0.6611f, 0.6833f, 0.7042f, 0.725f, 0.7472f,
+  0.7681f, 0.7875f, 0.8069f, 0.8264f, 0.8417f, 0.8583f, 0.8681f, 0.1139f,
+  0.1208f, 0.1347f, 0.1528f, 0.1708f, 0.1903f, 0.2097f, 0.2306f, 0.2514f,
+  0.2722f, 0.2931f, 0.3139f, 0.3361f, 0.3583f, 0.3814f, 0.4046f, 0.4281f,
+  0.4519f, 0.4758f, 0.5f, 0.5242f, 0.5481f, 0.5719f, 0.5954f, 0.6186f,
+  0.6417f, 0.6639f, 0.6861f, 0.7069f, 0.7278f, 0.7486f, 0.7694f, 0.7903f,
+  0.8097f, 0.8292f, 0.8472f, 0.8653f, 0.8792f, 0.8861f, 0.1028f, 0.1139f,
+  0.1306f, 0.1486f, 0.1681f, 0.1875f, 0.2069f, 0.2278f, 0.2486f, 0.2694f,
+  0.2903f, 0.3111f, 0.3333f, 0.3556f, 0.379f, 0.4026f, 0.4265f, 0.4508f,
+  0.4754f, 0.5f, 0.5246f, 0.5492f, 0.5735f, 0.5974f, 0.621f, 0.6444f,
+  0.6667f, 0.6889f, 0.7097f, 0.7306f, 0.7514f, 0.7722f, 0.7931f, 0.8125f,
+  0.8319f, 0.8514f, 0.8694f, 0.8861f, 0.8972f, 0.08472f, 0.09444f, 0.1097f,
+  0.1278f, 0.1458f, 0.1653f, 0.1847f, 0.2056f, 0.225f, 0.2444f, 0.2653f,
+  0.2861f, 0.3083f, 0.3306f, 0.3528f, 0.3765f, 0.4006f, 0.425f, 0.4497f,
+  0.4749f, 0.5f, 0.5251f, 0.5503f, 0.575f, 0.5994f, 0.6235f, 0.6472f,
+  0.6694f, 0.6917f, 0.7139f, 0.7347f, 0.7556f, 0.775f, 0.7944f, 0.8153f,
+  0.8347f, 0.8542f, 0.8722f, 0.8903f, 0.9056f, 0.9153f, 0.07639f, 0.09028f,
+  0.1069f, 0.125f, 0.1431f, 0.1625f, 0.1819f, 0.2014f, 0.2222f, 0.2417f,
+  0.2625f, 0.2833f, 0.3042f, 0.3264f, 0.35f, 0.374f, 0.3985f, 0.4233f,
+  0.4488f, 0.4743f, 0.5f, 0.5257f, 0.5513f, 0.5767f, 0.6015f, 0.626f,
+  0.65f, 0.6736f, 0.6958f, 0.7167f, 0.7375f, 0.7583f, 0.7778f, 0.7986f,
+  0.8181f, 0.8375f, 0.8569f, 0.875f, 0.8931f, 0.9097f, 0.9236f, 0.07083f,
+  0.08611f, 0.1042f, 0.1222f, 0.1417f, 0.1597f, 0.1792f, 0.1986f, 0.2181f,
+  0.2375f, 0.2583f, 0.2792f, 0.3014f, 0.3236f, 0.3472f, 0.3715f, 0.3964f,
+  0.4218f, 0.4476f, 0.4737f, 0.5f, 0.5263f, 0.5524f, 0.5782f, 0.6036f,
+  0.6285f, 0.6528f, 0.6764f, 0.6986f, 0.7208f, 0.7417f, 0.7625f, 0.7819f,
+  0.8014f, 0.8208f, 0.8403f, 0.8583f, 0.8778f, 0.8958f, 0.9139f, 0.9292f,
+  0.06667f, 0.08333f, 0.1014f, 0.1208f, 0.1389f, 0.1583f, 0.1764f, 0.1958f,
+  0.2139f, 0.2333f, 0.2542f, 0.275f, 0.2972f, 0.3208f, 0.3444f, 0.3692f,
+  0.3944f, 0.4203f, 0.4465f, 0.4732f, 0.5f, 0.5268f, 0.5535f, 0.5797f,
+  0.6056f, 0.6308f, 0.6556f, 0.6792f, 0.7028f, 0.725f, 0.7458f, 0.7667f,
+  0.7861f, 0.8042f, 0.8236f, 0.8417f, 0.8611f, 0.8792f, 0.8986f, 0.9167f,
+  0.9333f, 0.06389f, 0.08194f, 0.1f, 0.1194f, 0.1361f, 0.1556f, 0.1736f,
+  0.1917f, 0.2111f, 0.2306f, 0.25f, 0.2722f, 0.2944f, 0.3181f, 0.3417f,
+  0.3667f, 0.3924f, 0.4186f, 0.4454f, 0.4726f, 0.5f, 0.5274f, 0.5546f,
+  0.5814f, 0.6076f, 0.6333f, 0.6583f, 0.6819f, 0.7056f, 0.7278f, 0.75f,
+  0.7694f, 0.7889f, 0.8083f, 0.8264f, 0.8444f, 0.8639f, 0.8806f, 0.9f,
+  0.9181f, 0.9361f, 0.0625f, 0.08056f, 0.09861f, 0.1167f, 0.1347f, 0.1528f,
+  0.1694f, 0.1889f, 0.2069f, 0.2264f, 0.2472f, 0.2681f, 0.2917f, 0.3153f,
+  0.3389f, 0.3642f, 0.3901f, 0.4168f, 0.4442f, 0.4719f, 0.5f, 0.5281f,
+  0.5558f, 0.5832f, 0.6099f, 0.6358f, 0.6611f, 0.6847f, 0.7083f, 0.7319f,
+  0.7528f, 0.7736f, 0.7931f, 0.8111f, 0.8306f, 0.8472f, 0.8653f, 0.8833f,
+  0.9014f, 0.9194f, 0.9375f, 0.06111f, 0.07917f, 0.09722f, 0.1153f, 0.1319f,
+  0.15f, 0.1667f, 0.1847f, 0.2042f, 0.2236f, 0.2444f, 0.2653f, 0.2889f,
+  0.3111f, 0.3361f, 0.3615f, 0.3879f, 0.4151f, 0.4432f, 0.4715f, 0.5f,
+  0.5285f, 0.5568f, 0.5849f, 0.6121f, 0.6385f, 0.6639f, 0.6889f, 0.7111f,
+  0.7347f, 0.7556f, 0.7764f, 0.7958f, 0.8153f, 0.8333f, 0.85f, 0.8681f,
+  0.8847f, 0.9028f, 0.9208f, 0.9389f, 0.05972f, 0.07778f, 0.09583f, 0.1125f,
+  0.1292f, 0.1472f, 0.1639f, 0.1819f, 0.2f, 0.2194f, 0.2403f, 0.2625f,
+  0.2847f, 0.3083f, 0.3333f, 0.3597f, 0.3861f, 0.4142f, 0.4428f, 0.4714f,
+  0.5f, 0.5286f, 0.5572f, 0.5858f, 0.6139f, 0.6403f, 0.6667f, 0.6917f,
+  0.7153f, 0.7375f, 0.7597f, 0.7806f, 0.8f, 0.8181f, 0.8361f, 0.8528f,
+  0.8708f, 0.8875f, 0.9042f, 0.9222f, 0.9403f, 0.05833f, 0.07639f, 0.09444f,
+  0.1111f, 0.1278f, 0.1444f, 0.1611f, 0.1792f, 0.1972f, 0.2181f, 0.2389f,
+  0.2597f, 0.2819f, 0.3056f, 0.3306f, 0.3569f, 0.3856f, 0.4143f, 0.4432f,
+  0.4717f, 0.5f, 0.5283f, 0.5568f, 0.5857f, 0.6144f, 0.6431f, 0.6694f,
+  0.6944f, 0.7181f, 0.7403f, 0.7611f, 0.7819f, 0.8028f, 0.8208f, 0.8389f,
+  0.8556f, 0.8722f, 0.8889f, 0.9056f, 0.9236f, 0.9417f, 0.05694f, 0.075f,
+  0.09306f, 0.1097f, 0.125f, 0.1417f, 0.1597f, 0.1764f, 0.1958f, 0.2153f,
+  0.2361f, 0.2583f, 0.2806f, 0.3042f, 0.3292f, 0.3569f, 0.386f, 0.4153f,
+  0.444f, 0.4722f, 0.5f, 0.5278f, 0.556f, 0.5847f, 0.614f, 0.6431f,
+  0.6708f, 0.6958f, 0.7194f, 0.7417f, 0.7639f, 0.7847f, 0.8042f, 0.8236f,
+  0.8403f, 0.8583f, 0.875f, 0.8903f, 0.9069f, 0.925f, 0.9431f, 0.05694f,
+  0.075f, 0.09167f, 0.1083f, 0.1236f, 0.1403f, 0.1569f, 0.175f, 0.1931f,
+  0.2139f, 0.2347f, 0.2556f, 0.2778f, 0.3014f, 0.3278f, 0.3569f, 0.3871f,
+  0.4165f, 0.4451f, 0.4728f, 0.5f, 0.5272f, 0.5549f, 0.5835f, 0.6129f,
+  0.6431f, 0.6722f, 0.6986f, 0.7222f, 0.7444f, 0.7653f, 0.7861f, 0.8069f,
+  0.825f, 0.8431f, 0.8597f, 0.8764f, 0.8917f, 0.9083f, 0.925f, 0.9431f,
+  0.05556f, 0.07361f, 0.09028f, 0.1069f, 0.1236f, 0.1389f, 0.1556f, 0.1736f,
+  0.1917f, 0.2125f, 0.2333f, 0.2542f, 0.2764f, 0.3014f, 0.3278f, 0.3583f,
+  0.3882f, 0.4176f, 0.4461f, 0.4733f, 0.5f, 0.5267f, 0.5539f, 0.5824f,
+  0.6118f, 0.6417f, 0.6722f, 0.6986f, 0.7236f, 0.7458f, 0.7667f, 0.7875f,
+  0.8083f, 0.8264f, 0.8444f, 0.8611f, 0.8764f, 0.8931f, 0.9097f, 0.9264f,
+  0.9444f, 0.05556f, 0.07361f, 0.09028f, 0.1069f, 0.1222f, 0.1389f, 0.1556f,
+  0.1722f, 0.1917f, 0.2111f, 0.2319f, 0.2528f, 0.2764f, 0.3f, 0.3278f,
+  0.3583f, 0.389f, 0.4185f, 0.4468f, 0.4737f, 0.5f, 0.5263f, 0.5532f,
+  0.5815f, 0.611f, 0.6417f, 0.6722f, 0.7f, 0.7236f, 0.7472f, 0.7681f,
+  0.7889f, 0.8083f, 0.8278f, 0.8444f, 0.8611f, 0.8778f, 0.8931f, 0.9097f,
+  0.9264f, 0.9444f, 0.05556f, 0.07361f, 0.09028f, 0.1069f, 0.1222f, 0.1389f,
+  0.1556f, 0.1722f, 0.1917f, 0.2111f, 0.2319f, 0.2528f, 0.275f, 0.3f,
+  0.3292f, 0.3583f, 0.3893f, 0.4187f, 0.4469f, 0.4739f, 0.5f, 0.5261f,
+  0.5531f, 0.5813f, 0.6107f, 0.6417f, 0.6708f, 0.7f, 0.725f, 0.7472f,
+  0.7681f, 0.7889f, 0.8083f, 0.8278f, 0.8444f, 0.8611f, 0.8778f, 0.8931f,
+  0.9097f, 0.9264f, 0.9444f, 0.05556f, 0.07361f, 0.09028f, 0.1069f, 0.1222f,
+  0.1389f, 0.1556f, 0.1722f, 0.1917f, 0.2111f, 0.2319f, 0.2528f, 0.2764f,
+  0.3f, 0.3278f, 0.3583f, 0.389f, 0.4185f, 0.4468f, 0.4737f, 0.5f,
+  0.5263f, 0.5532f, 0.5815f, 0.611f, 0.6417f, 0.6722f, 0.7f, 0.7236f,
+  0.7472f, 0.7681f, 0.7889f, 0.8083f, 0.8278f, 0.8444f, 0.8611f, 0.8778f,
+  0.8931f, 0.9097f, 0.9264f, 0.9444f, 0.05556f, 0.07361f, 0.09028f, 0.1069f,
+  0.1236f, 0.1389f, 0.1556f, 0.1736f, 0.1917f, 0.2125f, 0.2333f, 0.2542f,
+  0.2764f, 0.3014f, 0.3278f, 0.3583f, 0.3882f, 0.4176f, 0.4461f, 0.4733f,
+  0.5f, 0.5267f, 0.5539f, 0.5824f, 0.6118f, 0.6417f, 0.6722f, 0.6986f,
+  0.7236f, 0.7458f, 0.7667f, 0.7875f, 0.8083f, 0.8264f, 0.8444f, 0.8611f,
+  0.8764f, 0.8931f, 0.9097f, 0.9264f, 0.9444f, 0.05694f, 0.075f, 0.09167f,
+  0.1083f, 0.1236f, 0.1403f, 0.1569f, 0.175f, 0.1931f, 0.2139f, 0.2347f,
+  0.2556f, 0.2778f, 0.3014f, 0.3278f, 0.3569f, 0.3871f, 0.4165f, 0.4451f,
+  0.4728f, 0.5f, 0.5272f, 0.5549f, 0.5835f, 0.6129f, 0.6431f, 0.6722f,
+  0.6986f, 0.7222f, 0.7444f, 0.7653f, 0.7861f, 0.8069f, 0.825f, 0.8431f,
+  0.8597f, 0.8764f, 0.8917f, 0.9083f, 0.925f, 0.9431f, 0.05694f, 0.075f,
+  0.09306f, 0.1097f, 0.125f, 0.1417f, 0.1597f, 0.1764f, 0.1958f, 0.2153f,
+  0.2361f, 0.2583f, 0.2806f, 0.3042f, 0.3292f, 0.3569f, 0.386f, 0.4153f,
+  0.444f, 0.4722f, 0.5f, 0.5278f, 0.556f, 0.5847f, 0.614f, 0.6431f,
+  0.6708f, 0.6958f, 0.7194f, 0.7417f, 0.7639f, 0.7847f, 0.8042f, 0.8236f,
+  0.8403f, 0.8583f, 0.875f, 0.8903f, 0.9069f, 0.925f, 0.9431f, 0.05833f,
+  0.07639f, 0.09444f, 0.1111f, 0.1278f, 0.1444f, 0.1611f, 0.1792f, 0.1972f,
+  0.2181f, 0.2389f, 0.2597f, 0.2819f, 0.3056f, 0.3306f, 0.3569f, 0.3856f,
+  0.4143f, 0.4432f, 0.4717f, 0.5f, 0.5283f, 0.5568f, 0.5857f, 0.6144f,
+  0.6431f, 0.6694f, 0.6944f, 0.7181f, 0.7403f, 0.7611f, 0.7819f, 0.8028f,
+  0.8208f, 0.8389f, 0.8556f, 0.8722f, 0.8889f, 0.9056f, 0.9236f, 0.9417f,
+  0.05972f, 0.07778f, 0.09583f, 0.1125f, 0.1292f, 0.1472f, 0.1639f, 0.1819f,
+  0.2f, 0.2194f, 0.2403f, 0.2625f, 0.2847f, 0.3083f, 0.3333f, 0.3597f,
+  0.3861f, 0.4142f, 0.4428f, 0.4714f, 0.5f, 0.5286f, 0.5572f, 0.5858f,
+  0.6139f, 0.6403f, 0.6667f, 0.6917f, 0.7153f, 0.7375f, 0.7597f, 0.7806f,
+  0.8f, 0.8181f, 0.8361f, 0.8528f, 0.8708f, 0.8875f, 0.9042f, 0.9222f,
+  0.9403f, 0.06111f, 0.07917f, 0.09722f, 0.1153f, 0.1319f, 0.15f, 0.1667f,
+  0.1847f, 0.2042f, 0.2236f, 0.2444f, 0.2653f, 0.2889f, 0.3111f, 0.3361f,
+  0.3615f, 0.3879f, 0.4151f, 0.4432f, 0.4715f, 0.5f, 0.5285f, 0.5568f,
+  0.5849f, 0.6121f, 0.6385f, 0.6639f, 0.6889f, 0.7111f, 0.7347f, 0.7556f,
+  0.7764f, 0.7958f, 0.8153f, 0.8333f, 0.85f, 0.8681f, 0.8847f, 0.9028f,
+  0.9208f, 0.9389f, 0.0625f, 0.08056f, 0.09861f, 0.1167f, 0.1347f, 0.1528f,
+  0.1694f, 0.1889f, 0.2069f, 0.2264f, 0.2472f, 0.2681f, 0.2917f, 0.3153f,
+  0.3389f, 0.3642f, 0.3901f, 0.4168f, 0.4442f, 0.4719f, 0.5f, 0.5281f,
+  0.5558f, 0.5832f, 0.6099f, 0.6358f, 0.6611f, 0.6847f, 0.7083f, 0.7319f,
+  0.7528f, 0.7736f, 0.7931f, 0.8111f, 0.8306f, 0.8472f, 0.8653f, 0.8833f,
+  0.9014f, 0.9194f, 0.9375f, 0.06389f, 0.08194f, 0.1f, 0.1194f, 0.1361f,
+  0.1556f, 0.1736f, 0.1917f, 0.2111f, 0.2306f, 0.25f, 0.2722f, 0.2944f,
+  0.3181f, 0.3417f, 0.3667f, 0.3924f, 0.4186f, 0.4454f, 0.4726f, 0.5f,
+  0.5274f, 0.5546f, 0.5814f, 0.6076f, 0.6333f, 0.6583f, 0.6819f, 0.7056f,
+  0.7278f, 0.75f, 0.7694f, 0.7889f, 0.8083f, 0.8264f, 0.8444f, 0.8639f,
+  0.8806f, 0.9f, 0.9181f, 0.9361f, 0.06667f, 0.08333f, 0.1014f, 0.1208f,
+  0.1389f, 0.1583f, 0.1764f, 0.1958f, 0.2139f, 0.2333f, 0.2542f, 0.275f,
+  0.2972f, 0.3208f, 0.3444f, 0.3692f, 0.3944f, 0.4203f, 0.4465f, 0.4732f,
+  0.5f, 0.5268f, 0.5535f, 0.5797f, 0.6056f, 0.6308f, 0.6556f, 0.6792f,
+  0.7028f, 0.725f, 0.7458f, 0.7667f, 0.7861f, 0.8042f, 0.8236f, 0.8417f,
+  0.8611f, 0.8792f, 0.8986f, 0.9167f, 0.9333f, 0.07083f, 0.08611f, 0.1042f,
+  0.1222f, 0.1417f, 0.1597f, 0.1792f, 0.1986f, 0.2181f, 0.2375f, 0.2583f,
+  0.2792f, 0.3014f, 0.3236f, 0.3472f, 0.3715f, 0.3964f, 0.4218f, 0.4476f,
+  0.4737f, 0.5f, 0.5263f, 0.5524f, 0.5782f, 0.6036f, 0.6285f, 0.6528f,
+  0.6764f, 0.6986f, 0.7208f, 0.7417f, 0.7625f, 0.7819f, 0.8014f, 0.8208f,
+  0.8403f, 0.8583f, 0.8778f, 0.8958f, 0.9139f, 0.9292f, 0.07639f, 0.09028f,
+  0.1069f, 0.125f, 0.1431f, 0.1625f, 0.1819f, 0.2014f, 0.2222f, 0.2417f,
+  0.2625f, 0.2833f, 0.3042f, 0.3264f, 0.35f, 0.374f, 0.3985f, 0.4233f,
+  0.4488f, 0.4743f, 0.5f, 0.5257f, 0.5513f, 0.5767f, 0.6015f, 0.626f,
+  0.65f, 0.6736f, 0.6958f, 0.7167f, 0.7375f, 0.7583f, 0.7778f, 0.7986f,
+  0.8181f, 0.8375f, 0.8569f, 0.875f, 0.8931f, 0.9097f, 0.9236f, 0.08472f,
+  0.1097f, 0.1278f, 0.1458f, 0.1653f, 0.1847f, 0.2056f, 0.225f, 0.2444f,
+  0.2653f, 0.2861f, 0.3083f, 0.3306f, 0.3528f, 0.3765f, 0.4006f, 0.425f,
+  0.4497f, 0.4749f, 0.5f, 0.5251f, 0.5503f, 0.575f, 0.5994f, 0.6235f,
+  0.6472f, 0.6694f, 0.6917f, 0.7139f, 0.7347f, 0.7556f, 0.775f, 0.7944f,
+  0.8153f, 0.8347f, 0.8542f, 0.8722f, 0.8903f, 0.9153f, 0.09861f, 0.1028f,
+  0.1139f, 0.1306f, 0.1486f, 0.1681f, 0.1875f, 0.2069f, 0.2278f, 0.2486f,
+  0.2694f, 0.2903f, 0.3111f, 0.3333f, 0.3556f, 0.379f, 0.4026f, 0.4265f,
+  0.4508f, 0.4754f, 0.5f, 0.5246f, 0.5492f, 0.5735f, 0.5974f, 0.621f,
+  0.6444f, 0.6667f, 0.6889f, 0.7097f, 0.7306f, 0.7514f, 0.7722f, 0.7931f,
+  0.8125f, 0.8319f, 0.8514f, 0.8694f, 0.8861f, 0.8972f, 0.9014f, 0.1139f,
+  0.1208f, 0.1347f, 0.1528f, 0.1708f, 0.1903f, 0.2097f, 0.2306f, 0.2514f,
+  0.2722f, 0.2931f, 0.3139f, 0.3361f, 0.3583f, 0.3814f, 0.4046f, 0.4281f,
+  0.4519f, 0.4758f, 0.5f, 0.5242f, 0.5481f, 0.5719f, 0.5954f, 0.6186f,
+  0.6417f, 0.6639f, 0.6861f, 0.7069f, 0.7278f, 0.7486f, 0.7694f, 0.7903f,
+  0.8097f, 0.8292f, 0.8472f, 0.8653f, 0.8792f, 0.8861f, 0.1319f, 0.1417f,
+  0.1583f, 0.1736f, 0.1931f, 0.2125f, 0.2319f, 0.2528f, 0.275f, 0.2958f,
+  0.3167f, 0.3389f, 0.3611f, 0.3836f, 0.4064f, 0.4296f, 0.4529f, 0.4764f,
+  0.5f, 0.5236f, 0.5471f, 0.5704f, 0.5936f, 0.6164f, 0.6389f, 0.6611f,
+  0.6833f, 0.7042f, 0.725f, 0.7472f, 0.7681f, 0.7875f, 0.8069f, 0.8264f,
+  0.8417f, 0.8583f, 0.8681f, 0.1514f, 0.1667f, 0.1958f, 0.2153f, 0.2347f,
+  0.2556f, 0.2764f, 0.2972f, 0.3194f, 0.3417f, 0.3631f, 0.3854f, 0.4079f,
+  0.4307f, 0.4537f, 0.4768f, 0.5f, 0.5232f, 0.5463f, 0.5693f, 0.5921f,
+  0.6146f, 0.6369f, 0.6583f, 0.6806f, 0.7028f, 0.7236f, 0.7444f, 0.7653f,
+  0.7847f, 0.8042f, 0.8333f, 0.8486f, 0.1819f, 0.1889f, 0.2028f, 0.2194f,
+  0.2375f, 0.2583f, 0.2792f, 0.3f, 0.3208f, 0.3431f, 0.3647f, 0.3869f,
+  0.4093f, 0.4318f, 0.4544f, 0.4772f, 0.5f, 0.5228f, 0.5456f, 0.5682f,
+  0.5907f, 0.6131f, 0.6353f, 0.6569f, 0.6792f, 0.7f, 0.7208f, 0.7417f,
+  0.7625f, 0.7806f, 0.7972f, 0.8111f, 0.8181f, 0.2125f, 0.225f, 0.2431f,
+  0.2611f, 0.2806f, 0.3014f, 0.3222f, 0.3444f, 0.3661f, 0.3882f, 0.4103f,
+  0.4326f, 0.455f, 0.4775f, 0.5f, 0.5225f, 0.545f, 0.5674f, 0.5897f,
+  0.6118f, 0.6339f, 0.6556f, 0.6778f, 0.6986f, 0.7194f, 0.7389f, 0.7569f,
+  0.775f, 0.7875f, 0.2375f, 0.25f, 0.2667f, 0.2847f, 0.3042f, 0.325f,
+  0.3458f, 0.3676f, 0.3893f, 0.4113f, 0.4333f, 0.4554f, 0.4778f, 0.5f,
+  0.5222f, 0.5446f, 0.5667f, 0.5888f, 0.6107f, 0.6324f, 0.6542f, 0.675f,
+  0.6958f, 0.7153f, 0.7333f, 0.75f, 0.7625f,
+};
+static const float osvr_display_mesh_built_in_osvr_hdk20_v1_eye0_to_x[] = {
+  1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f,
+  1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f,
+  1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f,
+  1.0f, 1.0f, 1.0f, 0.9745f, 0.9745f, 0.9745f, 0.9745f, 0.9745f,
+  0.9745f, 0.9745f, 0.9745f, 0.9745f, 0.9745f, 0.9745f, 0.9745f, 0.9745f,
+  0.9745f, 0.9745f, 0.9745f, 0.9745f, 0.9745f, 0.9745f, 0.9745f, 0.9745f,
+  0.9745f, 0.9745f, 0.9745f, 0.9745f, 0.9745f, 0.9745f, 0.9745f, 0.9745f,
+  0.9503f, 0.9503f, 0.9503f, 0.9503f, 0.9503f, 0.9503f, 0.9503f, 0.9503f,
+  0.9503f, 0.9503f, 0.9503f, 0.9503f, 0.9503f, 0.9503f, 0.9503f, 0.9503f,
+  0.9503f, 0.9503f, 0.9503f, 0.9503f, 0.9503f, 0.9503f, 0.9503f, 0.9503f,
+  0.9503f, 0.9503f, 0.9503f, 0.9503f, 0.9503f, 0.9503f, 0.9503f, 0.9257f,
+  0.9257f, 0.9257f, 0.9257f, 0.9257f, 0.9257f, 0.9257f, 0.9257f, 0.9257f,
+  0.9257f, 0.9257f, 0.9257f, 0.9257f, 0.9257f, 0.9257f, 0.9257f, 0.9257f,
+  0.9257f, 0.9257f, 0.9257f, 0.9257f, 0.9257f, 0.9257f, 0.9257f, 0.9257f,
+  0.9257f, 0.9257f, 0.9257f, 0.9257f, 0.9257f, 0.9257f, 0.9257f, 0.9257f,
+  0.9257f, 0.9257f, 0.8994f, 0.8994f, 0.8994f, 0.8994f, 0.8994f, 0.8994f,
+  0.8994f, 0.8994f, 0.8994f, 0.8994f, 0.8994f, 0.8994f, 0.8994f, 0.8994f,
+  0.8994f, 0.8994f, 0.8994f, 0.8994f, 0.8994f, 0.8994f, 0.8994f, 0.8994f,
+  0.8994f, 0.8994f, 0.8994f, 0.8994f, 0.8994f, 0.8994f, 0.8994f, 0.8994f,
+  0.8994f, 0.8994f, 0.8994f, 0.8994f, 0.8994f, 0.8994f, 0.8994f, 0.8745f,
+  0.8745f, 0.8745f, 0.8745f, 0.8745f, 0.8745f, 0.8745f, 0.8745f, 0.8745f,
+  0.8745f, 0.8745f, 0.8745f, 0.8745f, 0.8745f, 0.8745f, 0.8745f, 0.8745f,
+  0.8745f, 0.8745f, 0.8745f, 0.8745f, 0.8745f, 0.8745f, 0.8745f, 0.8745f,
+  0.8745f, 0.8745f, 0.8745f, 0.8745f, 0.8745f, 0.8745f, 0.8745f, 0.8745f,
+  0.8745f, 0.8745f, 0.8745f, 0.8745f, 0.8745f, 0.8745f, 0.8495f, 0.8495f,
+  0.8495f, 0.8495f, 0.8495f, 0.8495f, 0.8495f, 0.8495f, 0.8495f, 0.8495f,
+  0.8495f, 0.8495f, 0.8495f, 0.8495f, 0.8495f, 0.8495f, 0.8495f, 0.8495f,
+  0.8495f, 0.8495f, 0.8495f, 0.8495f, 0.8495f, 0.8495f, 0.8495f, 0.8495f,
+  0.8495f, 0.8495f, 0.8495f, 0.8495f, 0.8495f, 0.8495f, 0.8495f, 0.8495f,
+  0.8495f, 0.8495f, 0.8495f, 0.8495f, 0.8495f, 0.8245f, 0.8245f, 0.8245f,
+  0.8245f, 0.8245f, 0.8245f, 0.8245f, 0.8245f, 0.8245f, 0.8245f, 0.8245f,
+  0.8245f, 0.8245f, 0.8245f, 0.8245f, 0.8245f, 0.8245f, 0.8245f, 0.8245f,
+  0.8245f, 0.8245f, 0.8245f, 0.8245f, 0.8245f, 0.8245f, 0.8245f, 0.8245f,
+  0.8245f, 0.8245f, 0.8245f, 0.8245f, 0.8245f, 0.8245f, 0.8245f, 0.8245f,
+  0.8245f, 0.8245f, 0.8245f, 0.8245f, 0.8245f, 0.8245f, 0.8005f, 0.8005f,
+  0.8005f, 0.8005f, 0.8005f, 0.8005f, 0.8005f, 0.8005f, 0.8005f, 0.8005f,
+  0.8005f, 0.8005f, 0.8005f, 0.8005f, 0.8005f, 0.8005f, 0.8005f, 0.8005f,
+  0.8005f, 0.8005f, 0.8005f, 0.8005f, 0.8005f, 0.8005f, 0.8005f, 0.8005f,
+  0.8005f, 0.8005f, 0.8005f, 0.8005f, 0.8005f, 0.8005f, 0.8005f, 0.8005f,
+  0.8005f, 0.8005f, 0.8005f, 0.8005f, 0.8005f, 0.8005f, 0.8005f, 0.7754f,
+  0.7754f, 0.7754f, 0.7754f, 0.7754f, 0.7754f, 0.7754f, 0.7754f, 0.7754f,
+  0.7754f, 0.7754f, 0.7754f, 0.7754f, 0.7754f, 0.7754f, 0.7754f, 0.7754f,
+  0.7754f, 0.7754f, 0.7754f, 0.7754f, 0.7754f, 0.7754f, 0.7754f, 0.7754f,
+  0.7754f, 0.7754f, 0.7754f, 0.7754f, 0.7754f, 0.7754f, 0.7754f, 0.7754f,
+  0.7754f, 0.7754f, 0.7754f, 0.7754f, 0.7754f, 0.7754f, 0.7754f, 0.7754f,
+  0.7503f, 0.7503f, 0.7503f, 0.7503f, 0.7503f, 0.7503f, 0.7503f, 0.7503f,
+  0.7503f, 0.7503f, 0.7503f, 0.7503f, 0.7503f, 0.7503f, 0.7503f, 0.7503f,
+  0.7503f, 0.7503f, 0.7503f, 0.7503f, 0.7503f, 0.7503f, 0.7503f, 0.7503f,
+  0.7503f, 0.7503f, 0.7503f, 0.7503f, 0.7503f, 0.7503f, 0.7503f, 0.7503f,
+  0.7503f, 0.7503f, 0.7503f, 0.7503f, 0.7503f, 0.7503f, 0.7503f, 0.7503f,
+  0.7503f, 0.7252f, 0.7252f, 0.7252f, 0.7252f, 0.7252f, 0.7252f, 0.7252f,
+  0.7252f, 0.7252f, 0.7252f, 0.7252f, 0.7252f, 0.7252f, 0.7252f, 0.7252f,
+  0.7252f, 0.7252f, 0.7252f, 0.7252f, 0.7252f, 0.7252f, 0.7252f, 0.7252f,
+  0.7252f, 0.7252f, 0.7252f, 0.7252f, 0.7252f, 0.7252f, 0.7252f, 0.7252f,
+  0.7252f, 0.7252f, 0.7252f, 0.7252f, 0.7252f, 0.7252f, 0.7252f, 0.7252f,
+  0.7252f, 0.7252f, 0.7f, 0.7f, 0.7f, 0.7f, 0.7f, 0.7f,
+  0.7f, 0.7f, 0.7f, 0.7f, 0.7f, 0.7f, 0.7f, 0.7f,
+  0.7f, 0.7f, 0.7f, 0.7f, 0.7f, 0.7f, 0.7f, 0.7f,
+  0.7f, 0.7f, 0.7f, 0.7f, 0.7f, 0.7f, 0.7f, 0.7f,
+  0.7f, 0.7f, 0.7f, 0.7f, 0.7f, 0.7f, 0.7f, 0.7f,
+  0.7f, 0.7f, 0.7f, 0.6748f, 0.6748f, 0.6748f, 0.6748f, 0.6748f,
+  0.6748f, 0.6748f, 0.6748f, 0.6748f, 0.6748f, 0.6748f, 0.6748f, 0.6748f,
+  0.6748f, 0.6748f, 0.6748f, 0.6748f, 0.6748f, 0.6748f, 0.6748f, 0.6748f,
+  0.6748f, 0.6748f, 0.6748f, 0.6748f, 0.6748f, 0.6748f, 0.6748f, 0.6748f,
+  0.6748f, 0.6748f, 0.6748f, 0.6748f, 0.6748f, 0.6748f, 0.6748f, 0.6748f,
+  0.6748f, 0.6748f, 0.6748f, 0.6748f, 0.6504f, 0.6504f, 0.6504f, 0.6504f,
+  0.6504f, 0.6504f, 0.6504f, 0.6504f, 0.6504f, 0.6504f, 0.6504f, 0.6504f,
+  0.6504f, 0.6504f, 0.6504f, 0.6504f, 0.6504f, 0.6504f, 0.6504f, 0.6504f,
+  0.6504f, 0.6504f, 0.6504f, 0.6504f, 0.6504f, 0.6504f, 0.6504f, 0.6504f,
+  0.6504f, 0.6504f, 0.6504f, 0.6504f, 0.6504f, 0.6504f, 0.6504f, 0.6504f,
+  0.6504f, 0.6504f, 0.6504f, 0.6504f, 0.6504f, 0.6249f, 0.6249f, 0.6249f,
+  0.6249f, 0.6249f, 0.6249f, 0.6249f, 0.6249f, 0.6249f, 0.6249f, 0.6249f,
+  0.6249f, 0.6249f, 0.6249f, 0.6249f, 0.6249f, 0.6249f, 0.6249f, 0.6249f,
+  0.6249f, 0.6249f, 0.6249f, 0.6249f, 0.6249f, 0.6249f, 0.6249f, 0.6249f,
+  0.6249f, 0.6249f, 0.6249f, 0.6249f, 0.6249f, 0.6249f, 0.6249f, 0.6249f,
+  0.6249f, 0.6249f, 0.6249f, 0.6249f, 0.6249f, 0.6249f, 0.6f, 0.6f,
+  0.6f, 0.6f, 0.6f, 0.6f, 0.6f, 0.6f, 0.6f, 0.6f,
+  0.6f, 0.6f, 0.6f, 0.6f, 0.6f, 0.6f, 0.6f, 0.6f,
+  0.6f, 0.6f, 0.6f, 0.6f, 0.6f, 0.6f, 0.6f, 0.6f,
+  0.6f, 0.6f, 0.6f, 0.6f, 0.6f, 0.6f, 0.6f, 0.6f,
+  0.6f, 0.6f, 0.6f, 0.6f, 0.6f, 0.6f, 0.6f, 0.575f,
+  0.575f, 0.575f, 0.575f, 0.575f, 0.575f, 0.575f, 0.575f, 0.575f,
+  0.575f, 0.575f, 0.575f, 0.575f, 0.575f, 0.575f, 0.575f, 0.575f,
+  0.575f, 0.575f, 0.575f, 0.575f, 0.575f, 0.575f, 0.575f, 0.575f,
+  0.575f, 0.575f, 0.575f, 0.575f, 0.575f, 0.575f, 0.575f, 0.575f,
+  0.575f, 0.575f, 0.575f, 0.575f, 0.575f, 0.575f, 0.575f, 0.575f,
+  0.55f, 0.55f, 0.55f, 0.55f, 0.55f, 0.55f, 0.55f, 0.55f,
+  0.55f, 0.55f, 0.55f, 0.55f, 0.55f, 0.55f, 0.55f, 0.55f,
+  0.55f, 0.55f, 0.55f, 0.55f, 0.55f, 0.55f, 0.55f, 0.55f,
+  0.55f, 0.55f, 0.55f, 0.55f, 0.55f, 0.55f, 0.55f, 0.55f,
+  0.55f, 0.55f, 0.55f, 0.55f, 0.55f, 0.55f, 0.55f, 0.55f,
+  0.55f, 0.525f, 0.525f, 0.525f, 0.525f, 0.525f, 0.525f, 0.525f,
+  0.525f, 0.525f, 0.525f, 0.525f, 0.525f, 0.525f, 0.525f, 0.525f,
+  0.525f, 0.525f, 0.525f, 0.525f, 0.525f, 0.525f, 0.525f, 0.525f,
+  0.525f, 0.525f, 0.525f, 0.525f, 0.525f, 0.525f, 0.525f, 0.525f,
+  0.525f, 0.525f, 0.525f, 0.525f, 0.525f, 0.525f, 0.525f, 0.525f,
+  0.525f, 0.525f, 0.5f, 0.5f, 0.5f, 0.5f, 0.5f, 0.5f,
+  0.5f, 0.5f, 0.5f, 0.5f, 0.5f, 0.5f, 0.5f, 0.5f,
+  0.5f, 0.5f, 0.5f, 0.5f, 0.5f, 0.5f, 0.5f, 0.5f,
+  0.5f, 0.5f, 0.5f, 0.5f, 0.5f, 0.5f, 0.5f, 0.5f,
+  0.5f, 0.5f, 0.5f, 0.5f, 0.5f, 0.5f, 0.5f, 0.5f,
+  0.5f, 0.5f, 0.5f, 0.475f, 0.475f, 0.475f, 0.475f, 0.475f,
+  0.475f, 0.475f, 0.475f, 0.475f, 0.475f, 0.475f, 0.475f, 0.475f,
+  0.475f, 0.475f, 0.475f, 0.475f, 0.475f, 0.475f, 0.475f, 0.475f,
+  0.475f, 0.475f, 0.475f, 0.475f, 0.475f, 0.475f, 0.475f, 0.475f,
+  0.475f, 0.475f, 0.475f, 0.475f, 0.475f, 0.475f, 0.475f, 0.475f,
+  0.475f, 0.475f, 0.475f, 0.475f, 0.45f, 0.45f, 0.45f, 0.45f,
+  0.45f, 0.45f, 0.45f, 0.45f, 0.45f, 0.45f, 0.45f, 0.45f,
+  0.45f, 0.45f, 0.45f, 0.45f, 0.45f, 0.45f, 0.45f, 0.45f,
+  0.45f, 0.45f, 0.45f, 0.45f, 0.45f, 0.45f, 0.45f, 0.45f,
+  0.45f, 0.45f, 0.45f, 0.45f, 0.45f, 0.45f, 0.45f, 0.45f,
+  0.45f, 0.45f, 0.45f, 0.45f, 0.45f, 0.425f, 0.425f, 0.425f,
+  0.425f, 0.425f, 0.425f, 0.425f, 0.425f, 0.425f, 0.425f, 0.425f,
+  0.425f, 0.425f, 0.425f, 0.425f, 0.425f, 0.425f, 0.425f, 0.425f,
+  0.425f, 0.425f, 0.425f, 0.425f, 0.425f, 0.425f, 0.425f, 0.425f,
+  0.425f, 0.425f, 0.425f, 0.425f, 0.425f, 0.425f, 0.425f, 0.425f,
+  0.425f, 0.425f, 0.425f, 0.425f, 0.425f, 0.425f, 0.4f, 0.4f,
+  0.4f, 0.4f, 0.4f, 0.4f, 0.4f, 0.4f, 0.4f, 0.4f,
+  0.4f, 0.4f, 0.4f, 0.4f, 0.4f, 0.4f, 0.4f, 0.4f,
+  0.4f, 0.4f, 0.4f, 0.4f, 0.4f, 0.4f, 0.4f, 0.4f,
+  0.4f, 0.4f, 0.4f, 0.4f, 0.4f, 0.4f, 0.4f, 0.4f,
+  0.4f, 0.4f, 0.4f, 0.4f, 0.4f, 0.4f, 0.4f, 0.3751f,
+  0.3751f, 0.3751f, 0.3751f, 0.3751f, 0.3751f, 0.3751f, 0.3751f, 0.3751f,
+  0.3751f, 0.3751f, 0.3751f, 0.3751f, 0.3751f, 0.3751f, 0.3751f, 0.3751f,
+  0.3751f, 0.3751f, 0.3751f, 0.3751f, 0.3751f, 0.3751f, 0.3751f, 0.3751f,
+  0.3751f, 0.3751f, 0.3751f, 0.3751f, 0.3751f, 0.3751f, 0.3751f, 0.3751f,
+  0.3751f, 0.3751f, 0.3751f, 0.3751f, 0.3751f, 0.3751f, 0.3751f, 0.3751f,
+  0.3496f, 0.3496f, 0.3496f, 0.3496f, 0.3496f, 0.3496f, 0.3496f, 0.3496f,
+  0.3496f, 0.3496f, 0.3496f, 0.3496f, 0.3496f, 0.3496f, 0.3496f, 0.3496f,
+  0.3496f, 0.3496f, 0.3496f, 0.3496f, 0.3496f, 0.3496f, 0.3496f, 0.3496f,
+  0.3496f, 0.3496f, 0.3496f, 0.3496f, 0.3496f, 0.3496f, 0.3496f, 0.3496f,
+  0.3496f, 0.3496f, 0.3496f, 0.3496f, 0.3496f, 0.3496f, 0.3496f, 0.3496f,
+  0.3496f, 0.3252f, 0.3252f, 0.3252f, 0.3252f, 0.3252f, 0.3252f, 0.3252f,
+  0.3252f, 0.3252f, 0.3252f, 0.3252f, 0.3252f, 0.3252f, 0.3252f, 0.3252f,
+  0.3252f, 0.3252f, 0.3252f, 0.3252f, 0.3252f, 0.3252f, 0.3252f, 0.3252f,
+  0.3252f, 0.3252f, 0.3252f, 0.3252f, 0.3252f, 0.3252f, 0.3252f, 0.3252f,
+  0.3252f, 0.3252f, 0.3252f, 0.3252f, 0.3252f, 0.3252f, 0.3252f, 0.3252f,
+  0.3252f, 0.3252f, 0.3f, 0.3f, 0.3f, 0.3f, 0.3f, 0.3f,
+  0.3f, 0.3f, 0.3f, 0.3f, 0.3f, 0.3f, 0.3f, 0.3f,
+  0.3f, 0.3f, 0.3f, 0.3f, 0.3f, 0.3f, 0.3f, 0.3f,
+  0.3f, 0.3f, 0.3f, 0.3f, 0.3f, 0.3f, 0.3f, 0.3f,
+  0.3f, 0.3f, 0.3f, 0.3f, 0.3f, 0.3f, 0.3f, 0.3f,
+  0.3f, 0.3f, 0.3f, 0.2748f, 0.2748f, 0.2748f, 0.2748f, 0.2748f,
+  0.2748f, 0.2748f, 0.2748f, 0.2748f, 0.2748f, 0.2748f, 0.2748f, 0.2748f,
+  0.2748f, 0.2748f, 0.2748f, 0.2748f, 0.2748f, 0.2748f, 0.2748f, 0.2748f,
+  0.2748f, 0.2748f, 0.2748f, 0.2748f, 0.2748f, 0.2748f, 0.2748f, 0.2748f,
+  0.2748f, 0.2748f, 0.2748f, 0.2748f, 0.2748f, 0.2748f, 0.2748f, 0.2748f,
+  0.2748f, 0.2748f, 0.2748f, 0.2748f, 0.2497f, 0.2497f, 0.2497f, 0.2497f,
+  0.2497f, 0.2497f, 0.2497f, 0.2497f, 0.2497f, 0.2497f, 0.2497f, 0.2497f,
+  0.2497f, 0.2497f, 0.2497f, 0.2497f, 0.2497f, 0.2497f, 0.2497f, 0.2497f,
+  0.2497f, 0.2497f, 0.2497f, 0.2497f, 0.2497f, 0.2497f, 0.2497f, 0.2497f,
+  0.2497f, 0.2497f, 0.2497f, 0.2497f, 0.2497f, 0.2497f, 0.2497f, 0.2497f,
+  0.2497f, 0.2497f, 0.2497f, 0.2497f, 0.2497f, 0.2246f, 0.2246f, 0.2246f,
+  0.2246f, 0.2246f, 0.2246f, 0.2246f, 0.2246f, 0.2246f, 0.2246f, 0.2246f,
+  0.2246f, 0.2246f, 0.2246f, 0.2246f, 0.2246f, 0.2246f, 0.2246f, 0.2246f,
+  0.2246f, 0.2246f, 0.2246f, 0.2246f, 0.2246f, 0.2246f, 0.2246f, 0.2246f,
+  0.2246f, 0.2246f, 0.2246f, 0.2246f, 0.2246f, 0.2246f, 0.2246f, 0.2246f,
+  0.2246f, 0.2246f, 0.2246f, 0.2246f, 0.2246f, 0.2246f, 0.1995f, 0.1995f,
+  0.1995f, 0.1995f, 0.1995f, 0.1995f, 0.1995f, 0.1995f, 0.1995f, 0.1995f,
+  0.1995f, 0.1995f, 0.1995f, 0.1995f, 0.1995f, 0.1995f, 0.1995f, 0.1995f,
+  0.1995f, 0.1995f, 0.1995f, 0.1995f, 0.1995f, 0.1995f, 0.1995f, 0.1995f,
+  0.1995f, 0.1995f, 0.1995f, 0.1995f, 0.1995f, 0.1995f, 0.1995f, 0.1995f,
+  0.1995f, 0.1995f, 0.1995f, 0.1995f, 0.1995f, 0.1995f, 0.1995f, 0.1755f,
+  0.1755f, 0.1755f, 0.1755f, 0.1755f, 0.1755f, 0.1755f, 0.1755f, 0.1755f,
+  0.1755f, 0.1755f, 0.1755f, 0.1755f, 0.1755f, 0.1755f, 0.1755f, 0.1755f,
+  0.1755f, 0.1755f, 0.1755f, 0.1755f, 0.1755f, 0.1755f, 0.1755f, 0.1755f,
+  0.1755f, 0.1755f, 0.1755f, 0.1755f, 0.1755f, 0.1755f, 0.1755f, 0.1755f,
+  0.1755f, 0.1755f, 0.1755f, 0.1755f, 0.1755f, 0.1755f, 0.1505f, 0.1505f,
+  0.1505f, 0.1505f, 0.1505f, 0.1505f, 0.1505f, 0.1505f, 0.1505f, 0.1505f,
+  0.1505f, 0.1505f, 0.1505f, 0.1505f, 0.1505f, 0.1505f, 0.1505f, 0.1505f,
+  0.1505f, 0.1505f, 0.1505f, 0.1505f, 0.1505f, 0.1505f, 0.1505f, 0.1505f,
+  0.1505f, 0.1505f, 0.1505f, 0.1505f, 0.1505f, 0.1505f, 0.1505f, 0.1505f,
+  0.1505f, 0.1505f, 0.1505f, 0.1505f, 0.1505f, 0.1505f, 0.1505f, 0.1255f,
+  0.1255f, 0.1255f, 0.1255f, 0.1255f, 0.1255f, 0.1255f, 0.1255f, 0.1255f,
+  0.1255f, 0.1255f, 0.1255f, 0.1255f, 0.1255f, 0.1255f, 0.1255f, 0.1255f,
+  0.1255f, 0.1255f, 0.1255f, 0.1255f, 0.1255f, 0.1255f, 0.1255f, 0.1255f,
+  0.1255f, 0.1255f, 0.1255f, 0.1255f, 0.1255f, 0.1255f, 0.1255f, 0.1255f,
+  0.1255f, 0.1255f, 0.1255f, 0.1255f, 0.1255f, 0.1255f, 0.1006f, 0.1006f,
+  0.1006f, 0.1006f, 0.1006f, 0.1006f, 0.1006f, 0.1006f, 0.1006f, 0.1006f,
+  0.1006f, 0.1006f, 0.1006f, 0.1006f, 0.1006f, 0.1006f, 0.1006f, 0.1006f,
+  0.1006f, 0.1006f, 0.1006f, 0.1006f, 0.1006f, 0.1006f, 0.1006f, 0.1006f,
+  0.1006f, 0.1006f, 0.1006f, 0.1006f, 0.1006f, 0.1006f, 0.1006f, 0.1006f,
+  0.1006f, 0.1006f, 0.1006f, 0.07432f, 0.07432f, 0.07432f, 0.07432f, 0.07432f,
+  0.07432f, 0.07432f, 0.07432f, 0.07432f, 0.07432f, 0.07432f, 0.07432f, 0.07432f,
+  0.07432f, 0.07432f, 0.07432f, 0.07432f, 0.07432f, 0.07432f, 0.07432f, 0.07432f,
+  0.07432f, 0.07432f, 0.07432f, 0.07432f, 0.07432f, 0.07432f, 0.07432f, 0.07432f,
+  0.07432f, 0.07432f, 0.07432f, 0.07432f, 0.04974f, 0.04974f, 0.04974f, 0.04974f,
+  0.04974f, 0.04974f, 0.04974f, 0.04974f, 0.04974f, 0.04974f, 0.04974f, 0.04974f,
+  0.04974f, 0.04974f, 0.04974f, 0.04974f, 0.04974f, 0.04974f, 0.04974f, 0.04974f,
+  0.04974f, 0.04974f, 0.04974f, 0.04974f, 0.04974f, 0.04974f, 0.04974f, 0.04974f,
+  0.04974f, 0.04974f, 0.04974f, 0.04974f, 0.04974f, 0.02551f, 0.02551f, 0.02551f,
+  0.02551f, 0.02551f, 0.02551f, 0.02551f, 0.02551f, 0.02551f, 0.02551f, 0.02551f,
+  0.02551f, 0.02551f, 0.02551f, 0.02551f, 0.02551f, 0.02551f, 0.02551f, 0.02551f,
+  0.02551f, 0.02551f, 0.02551f, 0.02551f, 0.02551f, 0.02551f, 0.02551f, 0.02551f,
+  0.02551f, 0.02551f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+};
+static const float osvr_display_mesh_built_in_osvr_hdk20_v1_eye0_to_y[] = {
+  0.1755f, 0.1995f, 0.2246f, 0.2497f, 0.2748f, 0.3f, 0.3252f, 0.3496f,
+  0.3751f, 0.4f, 0.425f, 0.45f, 0.475f, 0.5f, 0.525f, 0.55f,
+  0.575f, 0.6f, 0.6249f, 0.6504f, 0.6748f, 0.7f, 0.7252f, 0.7503f,
+  0.7754f, 0.8005f, 0.8245f, 0.1505f, 0.1755f, 0.1995f, 0.2246f, 0.2497f,
+  0.2748f, 0.3f, 0.3252f, 0.3496f, 0.3751f, 0.4f, 0.425f, 0.45f,
+  0.475f, 0.5f, 0.525f, 0.55f, 0.575f, 0.6f, 0.6249f, 0.6504f,
+  0.6748f, 0.7f, 0.7252f, 0.7503f, 0.7754f, 0.8005f, 0.8245f, 0.8495f,
+  0.1255f, 0.1505f, 0.1755f, 0.1995f, 0.2246f, 0.2497f, 0.2748f, 0.3f,
+  0.3252f, 0.3496f, 0.3751f, 0.4f, 0.425f, 0.45f, 0.475f, 0.5f,
+  0.525f, 0.55f, 0.575f, 0.6f, 0.6249f, 0.6504f, 0.6748f, 0.7f,
+  0.7252f, 0.7503f, 0.7754f, 0.8005f, 0.8245f, 0.8495f, 0.8745f, 0.07432f,
+  0.1006f, 0.1255f, 0.1505f, 0.1755f, 0.1995f, 0.2246f, 0.2497f, 0.2748f,
+  0.3f, 0.3252f, 0.3496f, 0.3751f, 0.4f, 0.425f, 0.45f, 0.475f,
+  0.5f, 0.525f, 0.55f, 0.575f, 0.6f, 0.6249f, 0.6504f, 0.6748f,
+  0.7f, 0.7252f, 0.7503f, 0.7754f, 0.8005f, 0.8245f, 0.8495f, 0.8745f,
+  0.8994f, 0.9257f, 0.04974f, 0.07432f, 0.1006f, 0.1255f, 0.1505f, 0.1755f,
+  0.1995f, 0.2246f, 0.2497f, 0.2748f, 0.3f, 0.3252f, 0.3496f, 0.3751f,
+  0.4f, 0.425f, 0.45f, 0.475f, 0.5f, 0.525f, 0.55f, 0.575f,
+  0.6f, 0.6249f, 0.6504f, 0.6748f, 0.7f, 0.7252f, 0.7503f, 0.7754f,
+  0.8005f, 0.8245f, 0.8495f, 0.8745f, 0.8994f, 0.9257f, 0.9503f, 0.02551f,
+  0.04974f, 0.07432f, 0.1006f, 0.1255f, 0.1505f, 0.1755f, 0.1995f, 0.2246f,
+  0.2497f, 0.2748f, 0.3f, 0.3252f, 0.3496f, 0.3751f, 0.4f, 0.425f,
+  0.45f, 0.475f, 0.5f, 0.525f, 0.55f, 0.575f, 0.6f, 0.6249f,
+  0.6504f, 0.6748f, 0.7f, 0.7252f, 0.7503f, 0.7754f, 0.8005f, 0.8245f,
+  0.8495f, 0.8745f, 0.8994f, 0.9257f, 0.9503f, 0.9745f, 0.02551f, 0.04974f,
+  0.07432f, 0.1006f, 0.1255f, 0.1505f, 0.1755f, 0.1995f, 0.2246f, 0.2497f,
+  0.2748f, 0.3f, 0.3252f, 0.3496f, 0.3751f, 0.4f, 0.425f, 0.45f,
+  0.475f, 0.5f, 0.525f, 0.55f, 0.575f, 0.6f, 0.6249f, 0.6504f,
+  0.6748f, 0.7f, 0.7252f, 0.7503f, 0.7754f, 0.8005f, 0.8245f, 0.8495f,
+  0.8745f, 0.8994f, 0.9257f, 0.9503f, 0.9745f, 0.0f, 0.02551f, 0.04974f,
+  0.07432f, 0.1006f, 0.1255f, 0.1505f, 0.1755f, 0.1995f, 0.2246f, 0.2497f,
+  0.2748f, 0.3f, 0.3252f, 0.3496f, 0.3751f, 0.4f, 0.425f, 0.45f,
+  0.475f, 0.5f, 0.525f, 0.55f, 0.575f, 0.6f, 0.6249f, 0.6504f,
+  0.6748f, 0.7f, 0.7252f, 0.7503f, 0.7754f, 0.8005f, 0.8245f, 0.8495f,
+  0.8745f, 0.8994f, 0.9257f, 0.9503f, 0.9745f, 1.0f, 0.0f, 0.02551f,
+  0.04974f, 0.07432f, 0.1006f, 0.1255f, 0.1505f, 0.1755f, 0.1995f, 0.2246f,
+  0.2497f, 0.2748f, 0.3f, 0.3252f, 0.3496f, 0.3751f, 0.4f, 0.425f,
+  0.45f, 0.475f, 0.5f, 0.525f, 0.55f, 0.575f, 0.6f, 0.6249f,
+  0.6504f, 0.6748f, 0.7f, 0.7252f, 0.7503f, 0.7754f, 0.8005f, 0.8245f,
+  0.8495f, 0.8745f, 0.8994f, 0.9257f, 0.9503f, 0.9745f, 1.0f, 0.0f,
+  0.02551f, 0.04974f, 0.07432f, 0.1006f, 0.1255f, 0.1505f, 0.1755f, 0.1995f,
+  0.2246f, 0.2497f, 0.2748f, 0.3f, 0.3252f, 0.3496f, 0.3751f, 0.4f,
+  0.425f, 0.45f, 0.475f, 0.5f, 0.525f, 0.55f, 0.575f, 0.6f,
+  0.6249f, 0.6504f, 0.6748f, 0.7f, 0.7252f, 0.7503f, 0.7754f, 0.8005f,
+  0.8245f, 0.8495f, 0.8745f, 0.8994f, 0.9257f, 0.9503f, 0.9745f, 1.0f,
+  0.0f, 0.02551f, 0.04974f, 0.07432f, 0.1006f, 0.1255f, 0.1505f, 0.1755f,
+  0.1995f, 0.2246f, 0.2497f, 0.2748f, 0.3f, 0.3252f, 0.3496f, 0.3751f,
+  0.4f, 0.425f, 0.45f, 0.475f, 0.5f, 0.525f, 0.55f, 0.575f,
+  0.6f, 0.6249f, 0.6504f, 0.6748f, 0.7f, 0.7252f, 0.7503f, 0.7754f,
+  0.8005f, 0.8245f, 0.8495f, 0.8745f, 0.8994f, 0.9257f, 0.9503f, 0.9745f,
+  1.0f, 0.0f, 0.02551f, 0.04974f, 0.07432f, 0.1006f, 0.1255f, 0.1505f,
+  0.1755f, 0.1995f, 0.2246f, 0.2497f, 0.2748f, 0.3f, 0.3252f, 0.3496f,
+  0.3751f, 0.4f, 0.425f, 0.45f, 0.475f, 0.5f, 0.525f, 0.55f,
+  0.575f, 0.6f, 0.6249f, 0.6504f, 0.6748f, 0.7f, 0.7252f, 0.7503f,
+  0.7754f, 0.8005f, 0.8245f, 0.8495f, 0.8745f, 0.8994f, 0.9257f, 0.9503f,
+  0.9745f, 1.0f, 0.0f, 0.02551f, 0.04974f, 0.07432f, 0.1006f, 0.1255f,
+  0.1505f, 0.1755f, 0.1995f, 0.2246f, 0.2497f, 0.2748f, 0.3f, 0.3252f,
+  0.3496f, 0.3751f, 0.4f, 0.425f, 0.45f, 0.475f, 0.5f, 0.525f,
+  0.55f, 0.575f, 0.6f, 0.6249f, 0.6504f, 0.6748f, 0.7f, 0.7252f,
+  0.7503f, 0.7754f, 0.8005f, 0.8245f, 0.8495f, 0.8745f, 0.8994f, 0.9257f,
+  0.9503f, 0.9745f, 1.0f, 0.0f, 0.02551f, 0.04974f, 0.07432f, 0.1006f,
+  0.1255f, 0.1505f, 0.1755f, 0.1995f, 0.2246f, 0.2497f, 0.2748f, 0.3f,
+  0.3252f, 0.3496f, 0.3751f, 0.4f, 0.425f, 0.45f, 0.475f, 0.5f,
+  0.525f, 0.55f, 0.575f, 0.6f, 0.6249f, 0.6504f, 0.6748f, 0.7f,
+  0.7252f, 0.7503f, 0.7754f, 0.8005f, 0.8245f, 0.8495f, 0.8745f, 0.8994f,
+  0.9257f, 0.9503f, 0.9745f, 1.0f, 0.0f, 0.02551f, 0.04974f, 0.07432f,
+  0.1006f, 0.1255f, 0.1505f, 0.1755f, 0.1995f, 0.2246f, 0.2497f, 0.2748f,
+  0.3f, 0.3252f, 0.3496f, 0.3751f, 0.4f, 0.425f, 0.45f, 0.475f,
+  0.5f, 0.525f, 0.55f, 0.575f, 0.6f, 0.6249f, 0.6504f, 0.6748f,
+  0.7f, 0.7252f, 0.7503f, 0.7754f, 0.8005f, 0.8245f, 0.8495f, 0.8745f,
+  0.8994f, 0.9257f, 0.9503f, 0.9745f, 1.0f, 0.0f, 0.02551f, 0.04974f,
+  0.07432f, 0.1006f, 0.1255f, 0.1505f, 0.1755f, 0.1995f, 0.2246f, 0.2497f,
+  0.2748f, 0.3f, 0.3252f, 0.3496f, 0.3751f, 0.4f, 0.425f, 0.45f,
+  0.475f, 0.5f, 0.525f, 0.55f, 0.575f, 0.6f, 0.6249f, 0.6504f,
+  0.6748f, 0.7f, 0.7252f, 0.7503f, 0.7754f, 0.8005f, 0.8245f, 0.8495f,
+  0.8745f, 0.8994f, 0.9257f, 0.9503f, 0.9745f, 1.0f, 0.0f, 0.02551f,
+  0.04974f, 0.07432f, 0.1006f, 0.1255f, 0.1505f, 0.1755f, 0.1995f, 0.2246f,
+  0.2497f, 0.2748f, 0.3f, 0.3252f, 0.3496f, 0.3751f, 0.4f, 0.425f,
+  0.45f, 0.475f, 0.5f, 0.525f, 0.55f, 0.575f, 0.6f, 0.6249f,
+  0.6504f, 0.6748f, 0.7f, 0.7252f, 0.7503f, 0.7754f, 0.8005f, 0.8245f,
+  0.8495f, 0.8745f, 0.8994f, 0.9257f, 0.9503f, 0.9745f, 1.0f, 0.0f,
+  0.02551f, 0.04974f, 0.07432f, 0.1006f, 0.1255f, 0.1505f, 0.1755f, 0.1995f,
+  0.2246f, 0.2497f, 0.2748f, 0.3f, 0.3252f, 0.3496f, 0.3751f, 0.4f,
+  0.425f, 0.45f, 0.475f, 0.5f, 0.525f, 0.55f, 0.575f, 0.6f,
+  0.6249f, 0.6504f, 0.6748f, 0.7f, 0.7252f, 0.7503f, 0.7754f, 0.8005f,
+  0.8245f, 0.8495f, 0.8745f, 0.8994f, 0.9257f, 0.9503f, 0.9745f, 1.0f,
+  0.0f, 0.02551f, 0.04974f, 0.07432f, 0.1006f, 0.1255f, 0.1505f, 0.1755f,
+  0.1995f, 0.2246f, 0.2497f, 0.2748f, 0.3f, 0.3252f, 0.3496f, 0.3751f,
+  0.4f, 0.425f, 0.45f, 0.475f, 0.5f, 0.525f, 0.55f, 0.575f,
+  0.6f, 0.6249f, 0.6504f, 0.6748f, 0.7f, 0.7252f, 0.7503f, 0.7754f,
+  0.8005f, 0.8245f, 0.8495f, 0.8745f, 0.8994f, 0.9257f, 0.9503f, 0.9745f,
+  1.0f, 0.0f, 0.02551f, 0.04974f, 0.07432f, 0.1006f, 0.1255f, 0.1505f,
+  0.1755f, 0.1995f, 0.2246f, 0.2497f, 0.2748f, 0.3f, 0.3252f, 0.3496f,
+  0.3751f, 0.4f, 0.425f, 0.45f, 0.475f, 0.5f, 0.525f, 0.55f,
+  0.575f, 0.6f, 0.6249f, 0.6504f, 0.6748f, 0.7f, 0.7252f, 0.7503f,
+  0.7754f, 0.8005f, 0.8245f, 0.8495f, 0.8745f, 0.8994f, 0.9257f, 0.9503f,
+  0.9745f, 1.0f, 0.0f, 0.02551f, 0.04974f, 0.07432f, 0.1006f, 0.1255f,
+  0.1505f, 0.1755f, 0.1995f, 0.2246f, 0.2497f, 0.2748f, 0.3f, 0.3252f,
+  0.3496f, 0.3751f, 0.4f, 0.425f, 0.45f, 0.475f, 0.5f, 0.525f,
+  0.55f, 0.575f, 0.6f, 0.6249f, 0.6504f, 0.6748f, 0.7f, 0.7252f,
+  0.7503f, 0.7754f, 0.8005f, 0.8245f, 0.8495f, 0.8745f, 0.8994f, 0.9257f,
+  0.9503f, 0.9745f, 1.0f, 0.0f, 0.02551f, 0.04974f, 0.07432f, 0.1006f,
+  0.1255f, 0.1505f, 0.1755f, 0.1995f, 0.2246f, 0.2497f, 0.2748f, 0.3f,
+  0.3252f, 0.3496f, 0.3751f, 0.4f, 0.425f, 0.45f, 0.475f, 0.5f,
+  0.525f, 0.55f, 0.575f, 0.6f, 0.6249f, 0.6504f, 0.6748f, 0.7f,
+  0.7252f, 0.7503f, 0.7754f, 0.8005f, 0.8245f, 0.8495f, 0.8745f, 0.8994f,
+  0.9257f, 0.9503f, 0.9745f, 1.0f, 0.0f, 0.02551f, 0.04974f, 0.07432f,
+  0.1006f, 0.1255f, 0.1505f, 0.1755f, 0.1995f, 0.2246f, 0.2497f, 0.2748f,
+  0.3f, 0.3252f, 0.3496f, 0.3751f, 0.4f, 0.425f, 0.45f, 0.475f,
+  0.5f, 0.525f, 0.55f, 0.575f, 0.6f, 0.6249f, 0.6504f, 0.6748f,
+  0.7f, 0.7252f, 0.7503f, 0.7754f, 0.8005f, 0.8245f, 0.8495f, 0.8745f,
+  0.8994f, 0.9257f, 0.9503f, 0.9745f, 1.0f, 0.0f, 0.02551f, 0.04974f,
+  0.07432f, 0.1006f, 0.1255f, 0.1505f, 0.1755f, 0.1995f, 0.2246f, 0.2497f,
+  0.2748f, 0.3f, 0.3252f, 0.3496f, 0.3751f, 0.4f, 0.425f, 0.45f,
+  0.475f, 0.5f, 0.525f, 0.55f, 0.575f, 0.6f, 0.6249f, 0.6504f,
+  0.6748f, 0.7f, 0.7252f, 0.7503f, 0.7754f, 0.8005f, 0.8245f, 0.8495f,
+  0.8745f, 0.8994f, 0.9257f, 0.9503f, 0.9745f, 1.0f, 0.0f, 0.02551f,
+  0.04974f, 0.07432f, 0.1006f, 0.1255f, 0.1505f, 0.1755f, 0.1995f, 0.2246f,
+  0.2497f, 0.2748f, 0.3f, 0.3252f, 0.3496f, 0.3751f, 0.4f, 0.425f,
+  0.45f, 0.475f, 0.5f, 0.525f, 0.55f, 0.575f, 0.6f, 0.6249f,
+  0.6504f, 0.6748f, 0.7f, 0.7252f, 0.7503f, 0.7754f, 0.8005f, 0.8245f,
+  0.8495f, 0.8745f, 0.8994f, 0.9257f, 0.9503f, 0.9745f, 1.0f, 0.0f,
+  0.02551f, 0.04974f, 0.07432f, 0.1006f, 0.1255f, 0.1505f, 0.1755f, 0.1995f,
+  0.2246f, 0.2497f, 0.2748f, 0.3f, 0.3252f, 0.3496f, 0.3751f, 0.4f,
+  0.425f, 0.45f, 0.475f, 0.5f, 0.525f, 0.55f, 0.575f, 0.6f,
+  0.6249f, 0.6504f, 0.6748f, 0.7f, 0.7252f, 0.7503f, 0.7754f, 0.8005f,
+  0.8245f, 0.8495f, 0.8745f, 0.8994f, 0.9257f, 0.9503f, 0.9745f, 1.0f,
+  0.0f, 0.02551f, 0.04974f, 0.07432f, 0.1006f, 0.1255f, 0.1505f, 0.1755f,
+  0.1995f, 0.2246f, 0.2497f, 0.2748f, 0.3f, 0.3252f, 0.3496f, 0.3751f,
+  0.4f, 0.425f, 0.45f, 0.475f, 0.5f, 0.525f, 0.55f, 0.575f,
+  0.6f, 0.6249f, 0.6504f, 0.6748f, 0.7f, 0.7252f, 0.7503f, 0.7754f,
+  0.8005f, 0.8245f, 0.8495f, 0.8745f, 0.8994f, 0.9257f, 0.9503f, 0.9745f,
+  1.0f, 0.0f, 0.02551f, 0.04974f, 0.07432f, 0.1006f, 0.1255f, 0.1505f,
+  0.1755f, 0.1995f, 0.2246f, 0.2497f, 0.2748f, 0.3f, 0.3252f, 0.3496f,
+  0.3751f, 0.4f, 0.425f, 0.45f, 0.475f, 0.5f, 0.525f, 0.55f,
+  0.575f, 0.6f, 0.6249f, 0.6504f, 0.6748f, 0.7f, 0.7252f, 0.7503f,
+  0.7754f, 0.8005f, 0.8245f, 0.8495f, 0.8745f, 0.8994f, 0.9257f, 0.9503f,
+  0.9745f, 1.0f, 0.0f, 0.02551f, 0.04974f, 0.07432f, 0.1006f, 0.1255f,
+  0.1505f, 0.1755f, 0.1995f, 0.2246f, 0.2497f, 0.2748f, 0.3f, 0.3252f,
+  0.3496f, 0.3751f, 0.4f, 0.425f, 0.45f, 0.475f, 0.5f, 0.525f,
+  0.55f, 0.575f, 0.6f, 0.6249f, 0.6504f, 0.6748f, 0.7f, 0.7252f,
+  0.7503f, 0.7754f, 0.8005f, 0.8245f, 0.8495f, 0.8745f, 0.8994f, 0.9257f,
+  0.9503f, 0.9745f, 1.0f, 0.0f, 0.02551f, 0.04974f, 0.07432f, 0.1006f,
+  0.1255f, 0.1505f, 0.1755f, 0.1995f, 0.2246f, 0.2497f, 0.2748f, 0.3f,
+  0.3252f, 0.3496f, 0.3751f, 0.4f, 0.425f, 0.45f, 0.475f, 0.5f,
+  0.525f, 0.55f, 0.575f, 0.6f, 0.6249f, 0.6504f, 0.6748f, 0.7f,
+  0.7252f, 0.7503f, 0.7754f, 0.8005f, 0.8245f, 0.8495f, 0.8745f, 0.8994f,
+  0.9257f, 0.9503f, 0.9745f, 1.0f, 0.0f, 0.02551f, 0.04974f, 0.07432f,
+  0.1006f, 0.1255f, 0.1505f, 0.1755f, 0.1995f, 0.2246f, 0.2497f, 0.2748f,
+  0.3f, 0.3252f, 0.3496f, 0.3751f, 0.4f, 0.425f, 0.45f, 0.475f,
+  0.5f, 0.525f, 0.55f, 0.575f, 0.6f, 0.6249f, 0.6504f, 0.6748f,
+  0.7f, 0.7252f, 0.7503f, 0.7754f, 0.8005f, 0.8245f, 0.8495f, 0.8745f,
+  0.8994f, 0.9257f, 0.9503f, 0.9745f, 1.0f, 0.0f, 0.02551f, 0.04974f,
+  0.07432f, 0.1006f, 0.1255f, 0.1505f, 0.1755f, 0.1995f, 0.2246f, 0.2497f,
+  0.2748f, 0.3f, 0.3252f, 0.3496f, 0.3751f, 0.4f, 0.425f, 0.45f,
+  0.475f, 0.5f, 0.525f, 0.55f, 0.575f, 0.6f, 0.6249f, 0.6504f,
+  0.6748f, 0.7f, 0.7252f, 0.7503f, 0.7754f, 0.8005f, 0.8245f, 0.8495f,
+  0.8745f, 0.8994f, 0.9257f, 0.9503f, 0.9745f, 1.0f, 0.0f, 0.02551f,
+  0.04974f, 0.07432f, 0.1006f, 0.1255f, 0.1505f, 0.1755f, 0.1995f, 0.2246f,
+  0.2497f, 0.2748f, 0.3f, 0.3252f, 0.3496f, 0.3751f, 0.4f, 0.425f,
+  0.45f, 0.475f, 0.5f, 0.525f, 0.55f, 0.575f, 0.6f, 0.6249f,
+  0.6504f, 0.6748f, 0.7f, 0.7252f, 0.7503f, 0.7754f, 0.8005f, 0.8245f,
+  0.8495f, 0.8745f, 0.8994f, 0.9257f, 0.9503f, 0.9745f, 1.0f, 0.0f,
+  0.04974f, 0.07432f, 0.1006f, 0.1255f, 0.1505f, 0.1755f, 0.1995f, 0.2246f,
+  0.2497f, 0.2748f, 0.3f, 0.3252f, 0.3496f, 0.3751f, 0.4f, 0.425f,
+  0.45f, 0.475f, 0.5f, 0.525f, 0.55f, 0.575f, 0.6f, 0.6249f,
+  0.6504f, 0.6748f, 0.7f, 0.7252f, 0.7503f, 0.7754f, 0.8005f, 0.8245f,
+  0.8495f, 0.8745f, 0.8994f, 0.9257f, 0.9503f, 1.0f, 0.0f, 0.02551f,
+  0.04974f, 0.07432f, 0.1006f, 0.1255f, 0.1505f, 0.1755f, 0.1995f, 0.2246f,
+  0.2497f, 0.2748f, 0.3f, 0.3252f, 0.3496f, 0.3751f, 0.4f, 0.425f,
+  0.45f, 0.475f, 0.5f, 0.525f, 0.55f, 0.575f, 0.6f, 0.6249f,
+  0.6504f, 0.6748f, 0.7f, 0.7252f, 0.7503f, 0.7754f, 0.8005f, 0.8245f,
+  0.8495f, 0.8745f, 0.8994f, 0.9257f, 0.9503f, 0.9745f, 1.0f, 0.02551f,
+  0.04974f, 0.07432f, 0.1006f, 0.1255f, 0.1505f, 0.1755f, 0.1995f, 0.2246f,
+  0.2497f, 0.2748f, 0.3f, 0.3252f, 0.3496f, 0.3751f, 0.4f, 0.425f,
+  0.45f, 0.475f, 0.5f, 0.525f, 0.55f, 0.575f, 0.6f, 0.6249f,
+  0.6504f, 0.6748f, 0.7f, 0.7252f, 0.7503f, 0.7754f, 0.8005f, 0.8245f,
+  0.8495f, 0.8745f, 0.8994f, 0.9257f, 0.9503f, 0.9745f, 0.04974f, 0.07432f,
+  0.1006f, 0.1255f, 0.1505f, 0.1755f, 0.1995f, 0.2246f, 0.2497f, 0.2748f,
+  0.3f, 0.3252f, 0.3496f, 0.3751f, 0.4f, 0.425f, 0.45f, 0.475f,
+  0.5f, 0.525f, 0.55f, 0.575f, 0.6f, 0.6249f, 0.6504f, 0.6748f,
+  0.7f, 0.7252f, 0.7503f, 0.7754f, 0.8005f, 0.8245f, 0.8495f, 0.8745f,
+  0.8994f, 0.9257f, 0.9503f, 0.07432f, 0.1006f, 0.1505f, 0.1755f, 0.1995f,
+  0.2246f, 0.2497f, 0.2748f, 0.3f, 0.3252f, 0.3496f, 0.3751f, 0.4f,
+  0.425f, 0.45f, 0.475f, 0.5f, 0.525f, 0.55f, 0.575f, 0.6f,
+  0.6249f, 0.6504f, 0.6748f, 0.7f, 0.7252f, 0.7503f, 0.7754f, 0.8005f,
+  0.8245f, 0.8495f, 0.8994f, 0.9257f, 0.1006f, 0.1255f, 0.1505f, 0.1755f,
+  0.1995f, 0.2246f, 0.2497f, 0.2748f, 0.3f, 0.3252f, 0.3496f, 0.3751f,
+  0.4f, 0.425f, 0.45f, 0.475f, 0.5f, 0.525f, 0.55f, 0.575f,
+  0.6f, 0.6249f, 0.6504f, 0.6748f, 0.7f, 0.7252f, 0.7503f, 0.7754f,
+  0.8005f, 0.8245f, 0.8495f, 0.8745f, 0.8994f, 0.1505f, 0.1755f, 0.1995f,
+  0.2246f, 0.2497f, 0.2748f, 0.3f, 0.3252f, 0.3496f, 0.3751f, 0.4f,
+  0.425f, 0.45f, 0.475f, 0.5f, 0.525f, 0.55f, 0.575f, 0.6f,
+  0.6249f, 0.6504f, 0.6748f, 0.7f, 0.7252f, 0.7503f, 0.7754f, 0.8005f,
+  0.8245f, 0.8495f, 0.1755f, 0.1995f, 0.2246f, 0.2497f, 0.2748f, 0.3f,
+  0.3252f, 0.3496f, 0.3751f, 0.4f, 0.425f, 0.45f, 0.475f, 0.5f,
+  0.525f, 0.55f, 0.575f, 0.6f, 0.6249f, 0.6504f, 0.6748f, 0.7f,
+  0.7252f, 0.7503f, 0.7754f, 0.8005f, 0.8245f,
+};
+static const float osvr_display_mesh_built_in_osvr_hdk20_v1_eye1_from_x[] = {
+  0.01698f, 0.003086f, -0.006173f, -0.01235f, -0.01698f, -0.02006f, -0.02315f, -0.02469f,
+  -0.02623f, -0.02778f, -0.02778f, -0.02932f, -0.02932f, -0.02932f, -0.02932f, -0.02932f,
+  -0.02778f, -0.02778f, -0.02623f, -0.02469f, -0.02315f, -0.02006f, -0.01698f, -0.01235f,
+  -0.006173f, 0.003086f, 0.01698f, 0.03241f, 0.02006f, 0.01235f, 0.007716f, 0.00463f,
+  0.001543f, -0.001543f, -0.003086f, -0.00463f, -0.006173f, -0.007716f, -0.007716f, -0.009259f,
+  -0.009259f, -0.009259f, -0.009259f, -0.009259f, -0.007716f, -0.007716f, -0.006173f, -0.00463f,
+  -0.003086f, -0.001543f, 0.001543f, 0.00463f, 0.007716f, 0.01235f, 0.02006f, 0.03241f,
+  0.05093f, 0.04012f, 0.03395f, 0.02932f, 0.02623f, 0.02315f, 0.0216f, 0.01852f,
+  0.01698f, 0.01543f, 0.01389f, 0.01235f, 0.0108f, 0.0108f, 0.009259f, 0.009259f,
+  0.009259f, 0.0108f, 0.0108f, 0.01235f, 0.01389f, 0.01543f, 0.01698f, 0.01852f,
+  0.0216f, 0.02315f, 0.02623f, 0.02932f, 0.03395f, 0.04012f, 0.05093f, 0.08025f,
+  0.07253f, 0.06327f, 0.0571f, 0.05247f, 0.04938f, 0.0463f, 0.04321f, 0.04167f,
+  0.04012f, 0.03704f, 0.03549f, 0.03395f, 0.03086f, 0.02932f, 0.02932f, 0.02778f,
+  0.02778f, 0.02778f, 0.02932f, 0.02932f, 0.03086f, 0.03395f, 0.03549f, 0.03704f,
+  0.04012f, 0.04167f, 0.04321f, 0.0463f, 0.04938f, 0.05247f, 0.0571f, 0.06327f,
+  0.07253f, 0.08025f, 0.1034f, 0.09105f, 0.08642f, 0.08025f, 0.07562f, 0.07253f,
+  0.06944f, 0.0679f, 0.06481f, 0.06173f, 0.06019f, 0.0571f, 0.05401f, 0.05247f,
+  0.04938f, 0.04784f, 0.04784f, 0.0463f, 0.0463f, 0.0463f, 0.04784f, 0.04784f,
+  0.04938f, 0.05247f, 0.05401f, 0.0571f, 0.06019f, 0.06173f, 0.06481f, 0.0679f,
+  0.06944f, 0.07253f, 0.07562f, 0.08025f, 0.08642f, 0.09105f, 0.1034f, 0.1281f,
+  0.1157f, 0.108f, 0.1034f, 0.1003f, 0.09722f, 0.09414f, 0.09105f, 0.08796f,
+  0.08642f, 0.08333f, 0.08025f, 0.07716f, 0.07407f, 0.07099f, 0.0679f, 0.06636f,
+  0.06481f, 0.06481f, 0.06481f, 0.06481f, 0.06481f, 0.06636f, 0.0679f, 0.07099f,
+  0.07407f, 0.07716f, 0.08025f, 0.08333f, 0.08642f, 0.08796f, 0.09105f, 0.09414f,
+  0.09722f, 0.1003f, 0.1034f, 0.108f, 0.1157f, 0.1281f, 0.1404f, 0.1327f,
+  0.1281f, 0.125f, 0.1219f, 0.1188f, 0.1157f, 0.1127f, 0.1096f, 0.1065f,
+  0.1034f, 0.09877f, 0.09568f, 0.09259f, 0.08951f, 0.08796f, 0.08488f, 0.08333f,
+  0.08333f, 0.08333f, 0.08333f, 0.08333f, 0.08488f, 0.08796f, 0.08951f, 0.09259f,
+  0.09568f, 0.09877f, 0.1034f, 0.1065f, 0.1096f, 0.1127f, 0.1157f, 0.1188f,
+  0.1219f, 0.125f, 0.1281f, 0.1327f, 0.1404f, 0.1667f, 0.159f, 0.1528f,
+  0.1497f, 0.1466f, 0.1435f, 0.1404f, 0.1389f, 0.1343f, 0.1312f, 0.1281f,
+  0.1235f, 0.1204f, 0.1157f, 0.1127f, 0.1096f, 0.1065f, 0.1049f, 0.1034f,
+  0.1019f, 0.1019f, 0.1019f, 0.1034f, 0.1049f, 0.1065f, 0.1096f, 0.1127f,
+  0.1157f, 0.1204f, 0.1235f, 0.1281f, 0.1312f, 0.1343f, 0.1389f, 0.1404f,
+  0.1435f, 0.1466f, 0.1497f, 0.1528f, 0.159f, 0.1667f, 0.1852f, 0.179f,
+  0.1744f, 0.1728f, 0.1682f, 0.1667f, 0.1636f, 0.1605f, 0.1574f, 0.1528f,
+  0.1481f, 0.1451f, 0.1404f, 0.1373f, 0.1327f, 0.1296f, 0.1281f, 0.125f,
+  0.1235f, 0.1235f, 0.1235f, 0.1235f, 0.1235f, 0.125f, 0.1281f, 0.1296f,
+  0.1327f, 0.1373f, 0.1404f, 0.1451f, 0.1481f, 0.1528f, 0.1574f, 0.1605f,
+  0.1636f, 0.1667f, 0.1682f, 0.1728f, 0.1744f, 0.179f, 0.1852f, 0.2037f,
+  0.2006f, 0.1975f, 0.1944f, 0.1914f, 0.1898f, 0.1867f, 0.1821f, 0.179f,
+  0.1744f, 0.1698f, 0.1667f, 0.162f, 0.159f, 0.1543f, 0.1528f, 0.1497f,
+  0.1481f, 0.1466f, 0.1451f, 0.1451f, 0.1451f, 0.1466f, 0.1481f, 0.1497f,
+  0.1528f, 0.1543f, 0.159f, 0.162f, 0.1667f, 0.1698f, 0.1744f, 0.179f,
+  0.1821f, 0.1867f, 0.1898f, 0.1914f, 0.1944f, 0.1975f, 0.2006f, 0.2037f,
+  0.2253f, 0.2222f, 0.2207f, 0.2191f, 0.216f, 0.213f, 0.2099f, 0.2052f,
+  0.2022f, 0.1975f, 0.1929f, 0.1883f, 0.1852f, 0.1821f, 0.1775f, 0.1759f,
+  0.1728f, 0.1713f, 0.1698f, 0.1682f, 0.1682f, 0.1682f, 0.1698f, 0.1713f,
+  0.1728f, 0.1759f, 0.1775f, 0.1821f, 0.1852f, 0.1883f, 0.1929f, 0.1975f,
+  0.2022f, 0.2052f, 0.2099f, 0.213f, 0.216f, 0.2191f, 0.2207f, 0.2222f,
+  0.2253f, 0.2485f, 0.2469f, 0.2438f, 0.2423f, 0.2392f, 0.2361f, 0.233f,
+  0.2284f, 0.2253f, 0.2207f, 0.216f, 0.213f, 0.2083f, 0.2052f, 0.2022f,
+  0.1991f, 0.1975f, 0.1944f, 0.1929f, 0.1914f, 0.1914f, 0.1914f, 0.1929f,
+  0.1944f, 0.1975f, 0.1991f, 0.2022f, 0.2052f, 0.2083f, 0.213f, 0.216f,
+  0.2207f, 0.2253f, 0.2284f, 0.233f, 0.2361f, 0.2392f, 0.2423f, 0.2438f,
+  0.2469f, 0.2485f, 0.2716f, 0.2701f, 0.2685f, 0.2654f, 0.2623f, 0.2593f,
+  0.2562f, 0.2531f, 0.2485f, 0.2454f, 0.2407f, 0.2377f, 0.2346f, 0.2315f,
+  0.2269f, 0.2238f, 0.2222f, 0.2191f, 0.2176f, 0.2176f, 0.216f, 0.2176f,
+  0.2176f, 0.2191f, 0.2222f, 0.2238f, 0.2269f, 0.2315f, 0.2346f, 0.2377f,
+  0.2407f, 0.2454f, 0.2485f, 0.2531f, 0.2562f, 0.2593f, 0.2623f, 0.2654f,
+  0.2685f, 0.2701f, 0.2716f, 0.2948f, 0.2932f, 0.2917f, 0.2901f, 0.287f,
+  0.284f, 0.2809f, 0.2778f, 0.2731f, 0.2701f, 0.267f, 0.2639f, 0.2608f,
+  0.2562f, 0.2531f, 0.25f, 0.2485f, 0.2454f, 0.2454f, 0.2438f, 0.2438f,
+  0.2438f, 0.2454f, 0.2454f, 0.2485f, 0.25f, 0.2531f, 0.2562f, 0.2608f,
+  0.2639f, 0.267f, 0.2701f, 0.2731f, 0.2778f, 0.2809f, 0.284f, 0.287f,
+  0.2901f, 0.2917f, 0.2932f, 0.2948f, 0.3193f, 0.3179f, 0.3164f, 0.3144f,
+  0.3117f, 0.3086f, 0.3056f, 0.3025f, 0.2994f, 0.2963f, 0.2932f, 0.2901f,
+  0.287f, 0.284f, 0.2809f, 0.2778f, 0.2762f, 0.2747f, 0.2747f, 0.2747f,
+  0.2762f, 0.2747f, 0.2747f, 0.2747f, 0.2762f, 0.2778f, 0.2809f, 0.284f,
+  0.287f, 0.2901f, 0.2932f, 0.2963f, 0.2994f, 0.3025f, 0.3056f, 0.3086f,
+  0.3117f, 0.3144f, 0.3164f, 0.3179f, 0.3193f, 0.3434f, 0.3423f, 0.3409f,
+  0.339f, 0.3367f, 0.3343f, 0.3316f, 0.3289f, 0.3261f, 0.3233f, 0.3207f,
+  0.3179f, 0.3151f, 0.3122f, 0.3102f, 0.3071f, 0.3071f, 0.3071f, 0.3086f,
+  0.3086f, 0.3086f, 0.3086f, 0.3086f, 0.3071f, 0.3071f, 0.3071f, 0.3102f,
+  0.3122f, 0.3151f, 0.3179f, 0.3207f, 0.3233f, 0.3261f, 0.3289f, 0.3316f,
+  0.3343f, 0.3367f, 0.339f, 0.3409f, 0.3423f, 0.3434f, 0.3677f, 0.3668f,
+  0.3656f, 0.364f, 0.362f, 0.36f, 0.3579f, 0.3556f, 0.3532f, 0.3509f,
+  0.3488f, 0.3465f, 0.344f, 0.3415f, 0.3395f, 0.3389f, 0.3394f, 0.3406f,
+  0.3418f, 0.3427f, 0.3431f, 0.3427f, 0.3418f, 0.3406f, 0.3394f, 0.3389f,
+  0.3395f, 0.3415f, 0.344f, 0.3465f, 0.3488f, 0.3509f, 0.3532f, 0.3556f,
+  0.3579f, 0.36f, 0.362f, 0.364f, 0.3656f, 0.3668f, 0.3677f, 0.3923f,
+  0.3915f, 0.3904f, 0.3894f, 0.3878f, 0.3861f, 0.3844f, 0.3827f, 0.3809f,
+  0.3792f, 0.3775f, 0.3756f, 0.3736f, 0.3718f, 0.3707f, 0.3708f, 0.3719f,
+  0.3733f, 0.3745f, 0.3755f, 0.3758f, 0.3755f, 0.3745f, 0.3733f, 0.3719f,
+  0.3708f, 0.3707f, 0.3718f, 0.3736f, 0.3756f, 0.3775f, 0.3792f, 0.3809f,
+  0.3827f, 0.3844f, 0.3861f, 0.3878f, 0.3894f, 0.3904f, 0.3915f, 0.3923f,
+  0.4168f, 0.4162f, 0.4156f, 0.4148f, 0.4137f, 0.4127f, 0.4114f, 0.4102f,
+  0.4091f, 0.4079f, 0.4066f, 0.4054f, 0.404f, 0.4029f, 0.4025f, 0.4029f,
+  0.4039f, 0.4051f, 0.4062f, 0.4069f, 0.4071f, 0.4069f, 0.4062f, 0.4051f,
+  0.4039f, 0.4029f, 0.4025f, 0.4029f, 0.404f, 0.4054f, 0.4066f, 0.4079f,
+  0.4091f, 0.4102f, 0.4114f, 0.4127f, 0.4137f, 0.4148f, 0.4156f, 0.4162f,
+  0.4168f, 0.4414f, 0.441f, 0.4407f, 0.4404f, 0.4398f, 0.4392f, 0.4387f,
+  0.4381f, 0.4375f, 0.4369f, 0.4363f, 0.4356f, 0.4349f, 0.4344f, 0.4343f,
+  0.4346f, 0.4352f, 0.4358f, 0.4364f, 0.4369f, 0.437f, 0.4369f, 0.4364f,
+  0.4358f, 0.4352f, 0.4346f, 0.4343f, 0.4344f, 0.4349f, 0.4356f, 0.4363f,
+  0.4369f, 0.4375f, 0.4381f, 0.4387f, 0.4392f, 0.4398f, 0.4404f, 0.4407f,
+  0.441f, 0.4414f, 0.466f, 0.466f, 0.466f, 0.466f, 0.466f, 0.466f,
+  0.466f, 0.466f, 0.466f, 0.466f, 0.466f, 0.466f, 0.466f, 0.466f,
+  0.466f, 0.466f, 0.466f, 0.466f, 0.466f, 0.466f, 0.466f, 0.466f,
+  0.466f, 0.466f, 0.466f, 0.466f, 0.466f, 0.466f, 0.466f, 0.466f,
+  0.466f, 0.466f, 0.466f, 0.466f, 0.466f, 0.466f, 0.466f, 0.466f,
+  0.466f, 0.466f, 0.466f, 0.4907f, 0.491f, 0.4914f, 0.4917f, 0.4923f,
+  0.4929f, 0.4934f, 0.494f, 0.4946f, 0.4952f, 0.4958f, 0.4965f, 0.4972f,
+  0.4977f, 0.4978f, 0.4975f, 0.4969f, 0.4963f, 0.4957f, 0.4952f, 0.4951f,
+  0.4952f, 0.4957f, 0.4963f, 0.4969f, 0.4975f, 0.4978f, 0.4977f, 0.4972f,
+  0.4965f, 0.4958f, 0.4952f, 0.4946f, 0.494f, 0.4934f, 0.4929f, 0.4923f,
+  0.4917f, 0.4914f, 0.491f, 0.4907f, 0.5153f, 0.5159f, 0.5165f, 0.5173f,
+  0.5184f, 0.5194f, 0.5207f, 0.5219f, 0.523f, 0.5242f, 0.5255f, 0.5267f,
+  0.5281f, 0.5292f, 0.5296f, 0.5292f, 0.5282f, 0.527f, 0.5259f, 0.5252f,
+  0.525f, 0.5252f, 0.5259f, 0.527f, 0.5282f, 0.5292f, 0.5296f, 0.5292f,
+  0.5281f, 0.5267f, 0.5255f, 0.5242f, 0.523f, 0.5219f, 0.5207f, 0.5194f,
+  0.5184f, 0.5173f, 0.5165f, 0.5159f, 0.5153f, 0.5398f, 0.5406f, 0.5417f,
+  0.5427f, 0.5443f, 0.546f, 0.5477f, 0.5494f, 0.5512f, 0.5529f, 0.5546f,
+  0.5565f, 0.5585f, 0.5603f, 0.5614f, 0.5613f, 0.5602f, 0.5588f, 0.5576f,
+  0.5566f, 0.5563f, 0.5566f, 0.5576f, 0.5588f, 0.5602f, 0.5613f, 0.5614f,
+  0.5603f, 0.5585f, 0.5565f, 0.5546f, 0.5529f, 0.5512f, 0.5494f, 0.5477f,
+  0.546f, 0.5443f, 0.5427f, 0.5417f, 0.5406f, 0.5398f, 0.5644f, 0.5653f,
+  0.5665f, 0.5681f, 0.5701f, 0.5721f, 0.5742f, 0.5765f, 0.5789f, 0.5812f,
+  0.5833f, 0.5856f, 0.5881f, 0.5906f, 0.5926f, 0.5932f, 0.5927f, 0.5915f,
+  0.5903f, 0.5894f, 0.589f, 0.5894f, 0.5903f, 0.5915f, 0.5927f, 0.5932f,
+  0.5926f, 0.5906f, 0.5881f, 0.5856f, 0.5833f, 0.5812f, 0.5789f, 0.5765f,
+  0.5742f, 0.5721f, 0.5701f, 0.5681f, 0.5665f, 0.5653f, 0.5644f, 0.5887f,
+  0.5898f, 0.5912f, 0.5931f, 0.5954f, 0.5978f, 0.6005f, 0.6032f, 0.606f,
+  0.6088f, 0.6114f, 0.6142f, 0.617f, 0.6199f, 0.6219f, 0.625f, 0.625f,
+  0.625f, 0.6235f, 0.6235f, 0.6235f, 0.6235f, 0.6235f, 0.625f, 0.625f,
+  0.625f, 0.6219f, 0.6199f, 0.617f, 0.6142f, 0.6114f, 0.6088f, 0.606f,
+  0.6032f, 0.6005f, 0.5978f, 0.5954f, 0.5931f, 0.5912f, 0.5898f, 0.5887f,
+  0.6128f, 0.6142f, 0.6157f, 0.6177f, 0.6204f, 0.6235f, 0.6265f, 0.6296f,
+  0.6327f, 0.6358f, 0.6389f, 0.642f, 0.6451f, 0.6481f, 0.6512f, 0.6543f,
+  0.6559f, 0.6574f, 0.6574f, 0.6574f, 0.6559f, 0.6574f, 0.6574f, 0.6574f,
+  0.6559f, 0.6543f, 0.6512f, 0.6481f, 0.6451f, 0.642f, 0.6389f, 0.6358f,
+  0.6327f, 0.6296f, 0.6265f, 0.6235f, 0.6204f, 0.6177f, 0.6157f, 0.6142f,
+  0.6128f, 0.6373f, 0.6389f, 0.6404f, 0.642f, 0.6451f, 0.6481f, 0.6512f,
+  0.6543f, 0.659f, 0.662f, 0.6651f, 0.6682f, 0.6713f, 0.6759f, 0.679f,
+  0.6821f, 0.6836f, 0.6867f, 0.6867f, 0.6883f, 0.6883f, 0.6883f, 0.6867f,
+  0.6867f, 0.6836f, 0.6821f, 0.679f, 0.6759f, 0.6713f, 0.6682f, 0.6651f,
+  0.662f, 0.659f, 0.6543f, 0.6512f, 0.6481f, 0.6451f, 0.642f, 0.6404f,
+  0.6389f, 0.6373f, 0.6605f, 0.662f, 0.6636f, 0.6667f, 0.6698f, 0.6728f,
+  0.6759f, 0.679f, 0.6836f, 0.6867f, 0.6914f, 0.6944f, 0.6975f, 0.7006f,
+  0.7052f, 0.7083f, 0.7099f, 0.713f, 0.7145f, 0.7145f, 0.716f, 0.7145f,
+  0.7145f, 0.713f, 0.7099f, 0.7083f, 0.7052f, 0.7006f, 0.6975f, 0.6944f,
+  0.6914f, 0.6867f, 0.6836f, 0.679f, 0.6759f, 0.6728f, 0.6698f, 0.6667f,
+  0.6636f, 0.662f, 0.6605f, 0.6836f, 0.6852f, 0.6883f, 0.6898f, 0.6929f,
+  0.696f, 0.6991f, 0.7037f, 0.7068f, 0.7114f, 0.716f, 0.7191f, 0.7238f,
+  0.7269f, 0.7299f, 0.733f, 0.7346f, 0.7377f, 0.7392f, 0.7407f, 0.7407f,
+  0.7407f, 0.7392f, 0.7377f, 0.7346f, 0.733f, 0.7299f, 0.7269f, 0.7238f,
+  0.7191f, 0.716f, 0.7114f, 0.7068f, 0.7037f, 0.6991f, 0.696f, 0.6929f,
+  0.6898f, 0.6883f, 0.6852f, 0.6836f, 0.7068f, 0.7099f, 0.7114f, 0.713f,
+  0.716f, 0.7191f, 0.7222f, 0.7269f, 0.7299f, 0.7346f, 0.7392f, 0.7438f,
+  0.7469f, 0.75f, 0.7546f, 0.7562f, 0.7593f, 0.7608f, 0.7623f, 0.7639f,
+  0.7639f, 0.7639f, 0.7623f, 0.7608f, 0.7593f, 0.7562f, 0.7546f, 0.75f,
+  0.7469f, 0.7438f, 0.7392f, 0.7346f, 0.7299f, 0.7269f, 0.7222f, 0.7191f,
+  0.716f, 0.713f, 0.7114f, 0.7099f, 0.7068f, 0.7284f, 0.7315f, 0.7346f,
+  0.7377f, 0.7407f, 0.7423f, 0.7454f, 0.75f, 0.7531f, 0.7577f, 0.7623f,
+  0.7654f, 0.7701f, 0.7731f, 0.7778f, 0.7793f, 0.7824f, 0.784f, 0.7855f,
+  0.787f, 0.787f, 0.787f, 0.7855f, 0.784f, 0.7824f, 0.7793f, 0.7778f,
+  0.7731f, 0.7701f, 0.7654f, 0.7623f, 0.7577f, 0.7531f, 0.75f, 0.7454f,
+  0.7423f, 0.7407f, 0.7377f, 0.7346f, 0.7315f, 0.7284f, 0.7469f, 0.7531f,
+  0.7577f, 0.7593f, 0.7639f, 0.7654f, 0.7685f, 0.7716f, 0.7747f, 0.7793f,
+  0.784f, 0.787f, 0.7917f, 0.7948f, 0.7994f, 0.8025f, 0.804f, 0.8071f,
+  0.8086f, 0.8086f, 0.8086f, 0.8086f, 0.8086f, 0.8071f, 0.804f, 0.8025f,
+  0.7994f, 0.7948f, 0.7917f, 0.787f, 0.784f, 0.7793f, 0.7747f, 0.7716f,
+  0.7685f, 0.7654f, 0.7639f, 0.7593f, 0.7577f, 0.7531f, 0.7469f, 0.7654f,
+  0.7793f, 0.7824f, 0.7855f, 0.7886f, 0.7917f, 0.7932f, 0.7978f, 0.8009f,
+  0.804f, 0.8086f, 0.8117f, 0.8164f, 0.8194f, 0.8225f, 0.8256f, 0.8272f,
+  0.8287f, 0.8302f, 0.8302f, 0.8302f, 0.8287f, 0.8272f, 0.8256f, 0.8225f,
+  0.8194f, 0.8164f, 0.8117f, 0.8086f, 0.804f, 0.8009f, 0.7978f, 0.7932f,
+  0.7917f, 0.7886f, 0.7855f, 0.7824f, 0.7793f, 0.7654f, 0.7778f, 0.7917f,
+  0.7994f, 0.804f, 0.8071f, 0.8102f, 0.8133f, 0.8164f, 0.8194f, 0.8225f,
+  0.8256f, 0.8287f, 0.8333f, 0.8364f, 0.8395f, 0.8426f, 0.8441f, 0.8472f,
+  0.8488f, 0.8488f, 0.8488f, 0.8488f, 0.8488f, 0.8472f, 0.8441f, 0.8426f,
+  0.8395f, 0.8364f, 0.8333f, 0.8287f, 0.8256f, 0.8225f, 0.8194f, 0.8164f,
+  0.8133f, 0.8102f, 0.8071f, 0.804f, 0.7994f, 0.7917f, 0.7778f, 0.804f,
+  0.8164f, 0.8241f, 0.8287f, 0.8318f, 0.8349f, 0.838f, 0.841f, 0.8441f,
+  0.8457f, 0.8488f, 0.8519f, 0.8549f, 0.858f, 0.8611f, 0.8642f, 0.8657f,
+  0.8673f, 0.8673f, 0.8673f, 0.8673f, 0.8673f, 0.8657f, 0.8642f, 0.8611f,
+  0.858f, 0.8549f, 0.8519f, 0.8488f, 0.8457f, 0.8441f, 0.841f, 0.838f,
+  0.8349f, 0.8318f, 0.8287f, 0.8241f, 0.8164f, 0.804f, 0.8287f, 0.841f,
+  0.8457f, 0.8519f, 0.8565f, 0.8596f, 0.8627f, 0.8642f, 0.8673f, 0.8704f,
+  0.8719f, 0.875f, 0.8781f, 0.8796f, 0.8827f, 0.8843f, 0.8843f, 0.8858f,
+  0.8858f, 0.8858f, 0.8843f, 0.8843f, 0.8827f, 0.8796f, 0.8781f, 0.875f,
+  0.8719f, 0.8704f, 0.8673f, 0.8642f, 0.8627f, 0.8596f, 0.8565f, 0.8519f,
+  0.8457f, 0.841f, 0.8287f, 0.8519f, 0.8596f, 0.875f, 0.8796f, 0.8827f,
+  0.8858f, 0.8889f, 0.8904f, 0.892f, 0.8951f, 0.8966f, 0.8981f, 0.9012f,
+  0.9028f, 0.9028f, 0.9043f, 0.9043f, 0.9043f, 0.9028f, 0.9028f, 0.9012f,
+  0.8981f, 0.8966f, 0.8951f, 0.892f, 0.8904f, 0.8889f, 0.8858f, 0.8827f,
+  0.8796f, 0.875f, 0.8596f, 0.8519f, 0.8642f, 0.8812f, 0.892f, 0.8981f,
+  0.9028f, 0.9059f, 0.909f, 0.9105f, 0.9136f, 0.9151f, 0.9167f, 0.9182f,
+  0.9198f, 0.9213f, 0.9213f, 0.9228f, 0.9228f, 0.9228f, 0.9213f, 0.9213f,
+  0.9198f, 0.9182f, 0.9167f, 0.9151f, 0.9136f, 0.9105f, 0.909f, 0.9059f,
+  0.9028f, 0.8981f, 0.892f, 0.8812f, 0.8642f, 0.8997f, 0.912f, 0.9198f,
+  0.9244f, 0.9275f, 0.9306f, 0.9336f, 0.9352f, 0.9367f, 0.9383f, 0.9398f,
+  0.9398f, 0.9414f, 0.9414f, 0.9414f, 0.9414f, 0.9414f, 0.9398f, 0.9398f,
+  0.9383f, 0.9367f, 0.9352f, 0.9336f, 0.9306f, 0.9275f, 0.9244f, 0.9198f,
+  0.912f, 0.8997f, 0.9151f, 0.929f, 0.9383f, 0.9444f, 0.9491f, 0.9522f,
+  0.9552f, 0.9568f, 0.9583f, 0.9599f, 0.9599f, 0.9614f, 0.9614f, 0.9614f,
+  0.9614f, 0.9614f, 0.9599f, 0.9599f, 0.9583f, 0.9568f, 0.9552f, 0.9522f,
+  0.9491f, 0.9444f, 0.9383f, 0.929f, 0.9151f,
+};
+static const float osvr_display_mesh_built_in_osvr_hdk20_v1_eye1_from_y[] = {
+  0.2375f, 0.25f, 0.2667f, 0.2847f, 0.3042f, 0.325f, 0.3458f, 0.3676f,
+  0.3893f, 0.4113f, 0.4333f, 0.4554f, 0.4778f, 0.5f, 0.5222f, 0.5446f,
+  0.5667f, 0.5888f, 0.6107f, 0.6324f, 0.6542f, 0.675f, 0.6958f, 0.7153f,
+  0.7333f, 0.75f, 0.7625f, 0.2125f, 0.225f, 0.2431f, 0.2611f, 0.2806f,
+  0.3014f, 0.3222f, 0.3444f, 0.3661f, 0.3882f, 0.4103f, 0.4326f, 0.455f,
+  0.4775f, 0.5f, 0.5225f, 0.545f, 0.5674f, 0.5897f, 0.6118f, 0.6339f,
+  0.6556f, 0.6778f, 0.6986f, 0.7194f, 0.7389f, 0.7569f, 0.775f, 0.7875f,
+  0.1889f, 0.2028f, 0.2194f, 0.2375f, 0.2583f, 0.2792f, 0.3f, 0.3208f,
+  0.3431f, 0.3647f, 0.3869f, 0.4093f, 0.4318f, 0.4544f, 0.4772f, 0.5f,
+  0.5228f, 0.5456f, 0.5682f, 0.5907f, 0.6131f, 0.6353f, 0.6569f, 0.6792f,
+  0.7f, 0.7208f, 0.7417f, 0.7625f, 0.7806f, 0.7972f, 0.8111f, 0.1514f,
+  0.1667f, 0.1792f, 0.1958f, 0.2153f, 0.2347f, 0.2556f, 0.2764f, 0.2972f,
+  0.3194f, 0.3417f, 0.3631f, 0.3854f, 0.4079f, 0.4307f, 0.4537f, 0.4768f,
+  0.5f, 0.5232f, 0.5463f, 0.5693f, 0.5921f, 0.6146f, 0.6369f, 0.6583f,
+  0.6806f, 0.7028f, 0.7236f, 0.7444f, 0.7653f, 0.7847f, 0.8042f, 0.8208f,
+  0.8333f, 0.8486f, 0.1319f, 0.1417f, 0.1583f, 0.1736f, 0.1931f, 0.2125f,
+  0.2319f, 0.2528f, 0.275f, 0.2958f, 0.3167f, 0.3389f, 0.3611f, 0.3836f,
+  0.4064f, 0.4296f, 0.4529f, 0.4764f, 0.5f, 0.5236f, 0.5471f, 0.5704f,
+  0.5936f, 0.6164f, 0.6389f, 0.6611f, 0.6833f, 0.7042f, 0.725f, 0.7472f,
+  0.7681f, 0.7875f, 0.8069f, 0.8264f, 0.8417f, 0.8583f, 0.8681f, 0.1139f,
+  0.1208f, 0.1347f, 0.1528f, 0.1708f, 0.1903f, 0.2097f, 0.2306f, 0.2514f,
+  0.2722f, 0.2931f, 0.3139f, 0.3361f, 0.3583f, 0.3814f, 0.4046f, 0.4281f,
+  0.4519f, 0.4758f, 0.5f, 0.5242f, 0.5481f, 0.5719f, 0.5954f, 0.6186f,
+  0.6417f, 0.6639f, 0.6861f, 0.7069f, 0.7278f, 0.7486f, 0.7694f, 0.7903f,
+  0.8097f, 0.8292f, 0.8472f, 0.8653f, 0.8792f, 0.8861f, 0.1028f, 0.1139f,
+  0.1306f, 0.1486f, 0.1681f, 0.1875f, 0.2069f, 0.2278f, 0.2486f, 0.2694f,
+  0.2903f, 0.3111f, 0.3333f, 0.3556f, 0.379f, 0.4026f, 0.4265f, 0.4508f,
+  0.4754f, 0.5f, 0.5246f, 0.5492f, 0.5735f, 0.5974f, 0.621f, 0.6444f,
+  0.6667f, 0.6889f, 0.7097f, 0.7306f, 0.7514f, 0.7722f, 0.7931f, 0.8125f,
+  0.8319f, 0.8514f, 0.8694f, 0.8861f, 0.8972f, 0.08472f, 0.09444f, 0.1097f,
+  0.1278f, 0.1458f, 0.1653f, 0.1847f, 0.2056f, 0.225f, 0.2444f, 0.2653f,
+  0.2861f, 0.3083f, 0.3306f, 0.3528f, 0.3765f, 0.4006f, 0.425f, 0.4497f,
+  0.4749f, 0.5f, 0.5251f, 0.5503f, 0.575f, 0.5994f, 0.6235f, 0.6472f,
+  0.6694f, 0.6917f, 0.7139f, 0.7347f, 0.7556f, 0.775f, 0.7944f, 0.8153f,
+  0.8347f, 0.8542f, 0.8722f, 0.8903f, 0.9056f, 0.9153f, 0.07639f, 0.09028f,
+  0.1069f, 0.125f, 0.1431f, 0.1625f, 0.1819f, 0.2014f, 0.2222f, 0.2417f,
+  0.2625f, 0.2833f, 0.3042f, 0.3264f, 0.35f, 0.374f, 0.3985f, 0.4233f,
+  0.4488f, 0.4743f, 0.5f, 0.5257f, 0.5513f, 0.5767f, 0.6015f, 0.626f,
+  0.65f, 0.6736f, 0.6958f, 0.7167f, 0.7375f, 0.7583f, 0.7778f, 0.7986f,
+  0.8181f, 0.8375f, 0.8569f, 0.875f, 0.8931f, 0.9097f, 0.9236f, 0.07083f,
+  0.08611f, 0.1042f, 0.1222f, 0.1417f, 0.1597f, 0.1792f, 0.1986f, 0.2181f,
+  0.2375f, 0.2583f, 0.2792f, 0.3014f, 0.3236f, 0.3472f, 0.3715f, 0.3964f,
+  0.4218f, 0.4476f, 0.4737f, 0.5f, 0.5263f, 0.5524f, 0.5782f, 0.6036f,
+  0.6285f, 0.6528f, 0.6764f, 0.6986f, 0.7208f, 0.7417f, 0.7625f, 0.7819f,
+  0.8014f, 0.8208f, 0.8403f, 0.8583f, 0.8778f, 0.8958f, 0.9139f, 0.9292f,
+  0.06667f, 0.08333f, 0.1014f, 0.1208f, 0.1389f, 0.1583f, 0.1764f, 0.1958f,
+  0.2139f, 0.2333f, 0.2542f, 0.275f, 0.2972f, 0.3208f, 0.3444f, 0.3692f,
+  0.3944f, 0.4203f, 0.4465f, 0.4732f, 0.5f, 0.5268f, 0.5535f, 0.5797f,
+  0.6056f, 0.6308f, 0.6556f, 0.6792f, 0.7028f, 0.725f, 0.7458f, 0.7667f,
+  0.7861f, 0.8042f, 0.8236f, 0.8417f, 0.8611f, 0.8792f, 0.8986f, 0.9167f,
+  0.9333f, 0.06389f, 0.08194f, 0.1f, 0.1194f, 0.1361f, 0.1556f, 0.1736f,
+  0.1917f, 0.2111f, 0.2306f, 0.25f, 0.2722f, 0.2944f, 0.3181f, 0.3417f,
+  0.3667f, 0.3924f, 0.4186f, 0.4454f, 0.4726f, 0.5f, 0.5274f, 0.5546f,
+  0.5814f, 0.6076f, 0.6333f, 0.6583f, 0.6819f, 0.7056f, 0.7278f, 0.75f,
+  0.7694f, 0.7889f, 0.8083f, 0.8264f, 0.8444f, 0.8639f, 0.8806f, 0.9f,
+  0.9181f, 0.9361f, 0.0625f, 0.08056f, 0.09861f, 0.1167f, 0.1347f, 0.1528f,
+  0.1694f, 0.1889f, 0.2069f, 0.2264f, 0.2472f, 0.2681f, 0.2917f, 0.3153f,
+  0.3389f, 0.3642f, 0.3901f, 0.4168f, 0.4442f, 0.4719f, 0.5f, 0.5281f,
+  0.5558f, 0.5832f, 0.6099f, 0.6358f, 0.6611f, 0.6847f, 0.7083f, 0.7319f,
+  0.7528f, 0.7736f, 0.7931f, 0.8111f, 0.8306f, 0.8472f, 0.8653f, 0.8833f,
+  0.9014f, 0.9194f, 0.9375f, 0.06111f, 0.07917f, 0.09722f, 0.1153f, 0.1319f,
+  0.15f, 0.1667f, 0.1847f, 0.2042f, 0.2236f, 0.2444f, 0.2653f, 0.2889f,
+  0.3111f, 0.3361f, 0.3615f, 0.3879f, 0.4151f, 0.4432f, 0.4715f, 0.5f,
+  0.5285f, 0.5568f, 0.5849f, 0.6121f, 0.6385f, 0.6639f, 0.6889f, 0.7111f,
+  0.7347f, 0.7556f, 0.7764f, 0.7958f, 0.8153f, 0.8333f, 0.85f, 0.8681f,
+  0.8847f, 0.9028f, 0.9208f, 0.9389f, 0.05972f, 0.07778f, 0.09583f, 0.1125f,
+  0.1292f, 0.1472f, 0.1639f, 0.1819f, 0.2f, 0.2194f, 0.2403f, 0.2625f,
+  0.2847f, 0.3083f, 0.3333f, 0.3597f, 0.3861f, 0.4142f, 0.4428f, 0.4714f,
+  0.5f, 0.5286f, 0.5572f, 0.5858f, 0.6139f, 0.6403f, 0.6667f, 0.6917f,
+  0.7153f, 0.7375f, 0.7597f, 0.7806f, 0.8f, 0.8181f, 0.8361f, 0.8528f,
+  0.8708f, 0.8875f, 0.9042f, 0.9222f, 0.9403f, 0.05833f, 0.07639f, 0.09444f,
+  0.1111f, 0.1278f, 0.1444f, 0.1611f, 0.1792f, 0.1972f, 0.2181f, 0.2389f,
+  0.2597f, 0.2819f, 0.3056f, 0.3306f, 0.3569f, 0.3856f, 0.4143f, 0.4432f,
+  0.4717f, 0.5f, 0.5283f, 0.5568f, 0.5857f, 0.6144f, 0.6431f, 0.6694f,
+  0.6944f, 0.7181f, 0.7403f, 0.7611f, 0.7819f, 0.8028f, 0.8208f, 0.8389f,
+  0.8556f, 0.8722f, 0.8889f, 0.9056f, 0.9236f, 0.9417f, 0.05694f, 0.075f,
+  0.09306f, 0.1097f, 0.125f, 0.1417f, 0.1597f, 0.1764f, 0.1958f, 0.2153f,
+  0.2361f, 0.2583f, 0.2806f, 0.3042f, 0.3292f, 0.3569f, 0.386f, 0.4153f,
+  0.444f, 0.4722f, 0.5f, 0.5278f, 0.556f, 0.5847f, 0.614f, 0.6431f,
+  0.6708f, 0.6958f, 0.7194f, 0.7417f, 0.7639f, 0.7847f, 0.8042f, 0.8236f,
+  0.8403f, 0.8583f, 0.875f, 0.8903f, 0.9069f, 0.925f, 0.9431f, 0.05694f,
+  0.075f, 0.09167f, 0.1083f, 0.1236f, 0.1403f, 0.1569f, 0.175f, 0.1931f,
+  0.2139f, 0.2347f, 0.2556f, 0.2778f, 0.3014f, 0.3278f, 0.3569f, 0.3871f,
+  0.4165f, 0.4451f, 0.4728f, 0.5f, 0.5272f, 0.5549f, 0.5835f, 0.6129f,
+  0.6431f, 0.6722f, 0.6986f, 0.7222f, 0.7444f, 0.7653f, 0.7861f, 0.8069f,
+  0.825f, 0.8431f, 0.8597f, 0.8764f, 0.8917f, 0.9083f, 0.925f, 0.9431f,
+  0.05556f, 0.07361f, 0.09028f, 0.1069f, 0.1236f, 0.1389f, 0.1556f, 0.1736f,
+  0.1917f, 0.2125f, 0.2333f, 0.2542f, 0.2764f, 0.3014f, 0.3278f, 0.3583f,
+  0.3882f, 0.4176f, 0.4461f, 0.4733f, 0.5f, 0.5267f, 0.5539f, 0.5824f,
+  0.6118f, 0.6417f, 0.6722f, 0.6986f, 0.7236f, 0.7458f, 0.7667f, 0.7875f,
+  0.8083f, 0.8264f, 0.8444f, 0.8611f, 0.8764f, 0.8931f, 0.9097f, 0.9264f,
+  0.9444f, 0.05556f, 0.07361f, 0.09028f, 0.1069f, 0.1222f, 0.1389f, 0.1556f,
+  0.1722f, 0.1917f, 0.2111f, 0.2319f, 0.2528f, 0.2764f, 0.3f, 0.3278f,
+  0.3583f, 0.389f, 0.4185f, 0.4468f, 0.4737f, 0.5f, 0.5263f, 0.5532f,
+  0.5815f, 0.611f, 0.6417f, 0.6722f, 0.7f, 0.7236f, 0.7472f, 0.7681f,
+  0.7889f, 0.8083f, 0.8278f, 0.8444f, 0.8611f, 0.8778f, 0.8931f, 0.9097f,
+  0.9264f, 0.9444f, 0.05556f, 0.07361f, 0.09028f, 0.1069f, 0.1222f, 0.1389f,
+  0.1556f, 0.1722f, 0.1917f, 0.2111f, 0.2319f, 0.2528f, 0.275f, 0.3f,
+  0.3292f, 0.3583f, 0.3893f, 0.4187f, 0.4469f, 0.4739f, 0.5f, 0.5261f,
+  0.5531f, 0.5813f, 0.6107f, 0.6417f, 0.6708f, 0.7f, 0.725f, 0.7472f,
+  0.7681f, 0.7889f, 0.8083f, 0.8278f, 0.8444f, 0.8611f, 0.8778f, 0.8931f,
+  0.9097f, 0.9264f, 0.9444f, 0.05556f, 0.07361f, 0.09028f, 0.1069f, 0.1222f,
+  0.1389f, 0.1556f, 0.1722f, 0.1917f, 0.2111f, 0.2319f, 0.2528f, 0.2764f,
+  0.3f, 0.3278f, 0.3583f, 0.389f, 0.4185f, 0.4468f, 0.4737f, 0.5f,
+  0.5263f, 0.5532f, 0.5815f, 0.611f, 0.6417f, 0.6722f, 0.7f, 0.7236f,
+  0.7472f, 0.7681f, 0.7889f, 0.8083f, 0.8278f, 0.8444f, 0.8611f, 0.8778f,
+  0.8931f, 0.9097f, 0.9264f, 0.9444f, 0.05556f, 0.07361f, 0.09028f, 0.1069f,
+  0.1236f, 0.1389f, 0.1556f, 0.1736f, 0.1917f, 0.2125f, 0.2333f, 0.2542f,
+  0.2764f, 0.3014f, 0.3278f, 0.3583f, 0.3882f, 0.4176f, 0.4461f, 0.4733f,
+  0.5f, 0.5267f, 0.5539f, 0.5824f, 0.6118f, 0.6417f, 0.6722f, 0.6986f,
+  0.7236f, 0.7458f, 0.7667f, 0.7875f, 0.8083f, 0.8264f, 0.8444f, 0.8611f,
+  0.8764f, 0.8931f, 0.9097f, 0.9264f, 0.9444f, 0.05694f, 0.075f, 0.09167f,
+  0.1083f, 0.1236f, 0.1403f, 0.1569f, 0.175f, 0.1931f, 0.2139f, 0.2347f,
+  0.2556f, 0.2778f, 0.3014f, 0.3278f, 0.3569f, 0.3871f, 0.4165f, 0.4451f,
+  0.4728f, 0.5f, 0.5272f, 0.5549f, 0.5835f, 0.6129f, 0.6431f, 0.6722f,
+  0.6986f, 0.7222f, 0.7444f, 0.7653f, 0.7861f, 0.8069f, 0.825f, 0.8431f,
+  0.8597f, 0.8764f, 0.8917f, 0.9083f, 0.925f, 0.9431f, 0.05694f, 0.075f,
+  0.09306f, 0.1097f, 0.125f, 0.1417f, 0.1597f, 0.1764f, 0.1958f, 0.2153f,
+  0.2361f, 0.2583f, 0.2806f, 0.3042f, 0.3292f, 0.3569f, 0.386f, 0.4153f,
+  0.444f, 0.4722f, 0.5f, 0.5278f, 0.556f, 0.5847f, 0.614f, 0.6431f,
+  0.6708f, 0.6958f, 0.7194f, 0.7417f, 0.7639f, 0.7847f, 0.8042f, 0.8236f,
+  0.8403f, 0.8583f, 0.875f, 0.8903f, 0.9069f, 0.925f, 0.9431f, 0.05833f,
+  0.07639f, 0.09444f, 0.1111f, 0.1278f, 0.1444f, 0.1611f, 0.1792f, 0.1972f,
+  0.2181f, 0.2389f, 0.2597f, 0.2819f, 0.3056f, 0.3306f, 0.3569f, 0.3856f,
+  0.4143f, 0.4432f, 0.4717f, 0.5f, 0.5283f, 0.5568f, 0.5857f, 0.6144f,
+  0.6431f, 0.6694f, 0.6944f, 0.7181f, 0.7403f, 0.7611f, 0.7819f, 0.8028f,
+  0.8208f, 0.8389f, 0.8556f, 0.8722f, 0.8889f, 0.9056f, 0.9236f, 0.9417f,
+  0.05972f, 0.07778f, 0.09583f, 0.1125f, 0.1292f, 0.1472f, 0.1639f, 0.1819f,
+  0.2f, 0.2194f, 0.2403f, 0.2625f, 0.2847f, 0.3083f, 0.3333f, 0.3597f,
+  0.3861f, 0.4142f, 0.4428f, 0.4714f, 0.5f, 0.5286f, 0.5572f, 0.5858f,
+  0.6139f, 0.6403f, 0.6667f, 0.6917f, 0.7153f, 0.7375f, 0.7597f, 0.7806f,
+  0.8f, 0.8181f, 0.8361f, 0.8528f, 0.8708f, 0.8875f, 0.9042f, 0.9222f,
+  0.9403f, 0.06111f, 0.07917f, 0.09722f, 0.1153f, 0.1319f, 0.15f, 0.1667f,
+  0.1847f, 0.2042f, 0.2236f, 0.2444f, 0.2653f, 0.2889f, 0.3111f, 0.3361f,
+  0.3615f, 0.3879f, 0.4151f, 0.4432f, 0.4715f, 0.5f, 0.5285f, 0.5568f,
+  0.5849f, 0.6121f, 0.6385f, 0.6639f, 0.6889f, 0.7111f, 0.7347f, 0.7556f,
+  0.7764f, 0.7958f, 0.8153f, 0.8333f, 0.85f, 0.8681f, 0.8847f, 0.9028f,
+  0.9208f, 0.9389f, 0.0625f, 0.08056f, 0.09861f, 0.1167f, 0.1347f, 0.1528f,
+  0.1694f, 0.1889f, 0.2069f, 0.2264f, 0.2472f, 0.2681f, 0.2917f, 0.3153f,
+  0.3389f, 0.3642f, 0.3901f, 0.4168f, 0.4442f, 0.4719f, 0.5f, 0.5281f,
+  0.5558f, 0.5832f, 0.6099f, 0.6358f, 0.6611f, 0.6847f, 0.7083f, 0.7319f,
+  0.7528f, 0.7736f, 0.7931f, 0.8111f, 0.8306f, 0.8472f, 0.8653f, 0.8833f,
+  0.9014f, 0.9194f, 0.9375f, 0.06389f, 0.08194f, 0.1f, 0.1194f, 0.1361f,
+  0.1556f, 0.1736f, 0.1917f, 0.2111f, 0.2306f, 0.25f, 0.2722f, 0.2944f,
+  0.3181f, 0.3417f, 0.3667f, 0.3924f, 0.4186f, 0.4454f, 0.4726f, 0.5f,
+  0.5274f, 0.5546f, 0.5814f, 0.6076f, 0.6333f, 0.6583f, 0.6819f, 0.7056f,
+  0.7278f, 0.75f, 0.7694f, 0.7889f, 0.8083f, 0.8264f, 0.8444f, 0.8639f,
+  0.8806f, 0.9f, 0.9181f, 0.9361f, 0.06667f, 0.08333f, 0.1014f, 0.1208f,
+  0.1389f, 0.1583f, 0.1764f, 0.1958f, 0.2139f, 0.2333f, 0.2542f, 0.275f,
+  0.2972f, 0.3208f, 0.3444f, 0.3692f, 0.3944f, 0.4203f, 0.4465f, 0.4732f,
+  0.5f, 0.5268f, 0.5535f, 0.5797f, 0.6056f, 0.6308f, 0.6556f, 0.6792f,
+  0.7028f, 0.725f, 0.7458f, 0.7667f, 0.7861f, 0.8042f, 0.8236f, 0.8417f,
+  0.8611f, 0.8792f, 0.8986f, 0.9167f, 0.9333f, 0.07083f, 0.08611f, 0.1042f,
+  0.1222f, 0.1417f, 0.1597f, 0.1792f, 0.1986f, 0.2181f, 0.2375f, 0.2583f,
+  0.2792f, 0.3014f, 0.3236f, 0.3472f, 0.3715f, 0.3964f, 0.4218f, 0.4476f,
+  0.4737f, 0.5f, 0.5263f, 0.5524f, 0.5782f, 0.6036f, 0.6285f, 0.6528f,
+  0.6764f, 0.6986f, 0.7208f, 0.7417f, 0.7625f, 0.7819f, 0.8014f, 0.8208f,
+  0.8403f, 0.8583f, 0.8778f, 0.8958f, 0.9139f, 0.9292f, 0.07639f, 0.09028f,
+  0.1069f, 0.125f, 0.1431f, 0.1625f, 0.1819f, 0.2014f, 0.2222f, 0.2417f,
+  0.2625f, 0.2833f, 0.3042f, 0.3264f, 0.35f, 0.374f, 0.3985f, 0.4233f,
+  0.4488f, 0.4743f, 0.5f, 0.5257f, 0.5513f, 0.5767f, 0.6015f, 0.626f,
+  0.65f, 0.6736f, 0.6958f, 0.7167f, 0.7375f, 0.7583f, 0.7778f, 0.7986f,
+  0.8181f, 0.8375f, 0.8569f, 0.875f, 0.8931f, 0.9097f, 0.9236f, 0.08472f,
+  0.1097f, 0.1278f, 0.1458f, 0.1653f, 0.1847f, 0.2056f, 0.225f, 0.2444f,
+  0.2653f, 0.2861f, 0.3083f, 0.3306f, 0.3528f, 0.3765f, 0.4006f, 0.425f,
+  0.4497f, 0.4749f, 0.5f, 0.5251f, 0.5503f, 0.575f, 0.5994f, 0.6235f,
+  0.6472f, 0.6694f, 0.6917f, 0.7139f, 0.7347f, 0.7556f, 0.775f, 0.7944f,
+  0.8153f, 0.8347f, 0.8542f, 0.8722f, 0.8903f, 0.9153f, 0.09861f, 0.1028f,
+  0.1139f, 0.1306f, 0.1486f, 0.1681f, 0.1875f, 0.2069f, 0.2278f, 0.2486f,
+  0.2694f, 0.2903f, 0.3111f, 0.3333f, 0.3556f, 0.379f, 0.4026f, 0.4265f,
+  0.4508f, 0.4754f, 0.5f, 0.5246f, 0.5492f, 0.5735f, 0.5974f, 0.621f,
+  0.6444f, 0.6667f, 0.6889f, 0.7097f, 0.7306f, 0.7514f, 0.7722f, 0.7931f,
+  0.8125f, 0.8319f, 0.8514f, 0.8694f, 0.8861f, 0.8972f, 0.9014f, 0.1139f,
+  0.1208f, 0.1347f, 0.1528f, 0.1708f, 0.1903f, 0.2097f, 0.2306f, 0.2514f,
+  0.2722f, 0.2931f, 0.3139f, 0.3361f, 0.3583f, 0.3814f, 0.4046f, 0.4281f,
+  0.4519f, 0.4758f, 0.5f, 0.5242f, 0.5481f, 0.5719f, 0.5954f, 0.6186f,
+  0.6417f, 0.6639f, 0.6861f, 0.7069f, 0.7278f, 0.7486f, 0.7694f, 0.7903f,
+  0.8097f, 0.8292f, 0.8472f, 0.8653f, 0.8792f, 0.8861f, 0.1319f, 0.1417f,
+  0.1583f, 0.1736f, 0.1931f, 0.2125f, 0.2319f, 0.2528f, 0.275f, 0.2958f,
+  0.3167f, 0.3389f, 0.3611f, 0.3836f, 0.4064f, 0.4296f, 0.4529f, 0.4764f,
+  0.5f, 0.5236f, 0.5471f, 0.5704f, 0.5936f, 0.6164f, 0.6389f, 0.6611f,
+  0.6833f, 0.7042f, 0.725f, 0.7472f, 0.7681f, 0.7875f, 0.8069f, 0.8264f,
+  0.8417f, 0.8583f, 0.8681f, 0.1514f, 0.1667f, 0.1958f, 0.2153f, 0.2347f,
+  0.2556f, 0.2764f, 0.2972f, 0.3194f, 0.3417f, 0.3631f, 0.3854f, 0.4079f,
+  0.4307f, 0.4537f, 0.4768f, 0.5f, 0.5232f, 0.5463f, 0.5693f, 0.5921f,
+  0.6146f, 0.6369f, 0.6583f, 0.6806f, 0.7028f, 0.7236f, 0.7444f, 0.7653f,
+  0.7847f, 0.8042f, 0.8333f, 0.8486f, 0.1819f, 0.1889f, 0.2028f, 0.2194f,
+  0.2375f, 0.2583f, 0.2792f, 0.3f, 0.3208f, 0.3431f, 0.3647f, 0.3869f,
+  0.4093f, 0.4318f, 0.4544f, 0.4772f, 0.5f, 0.5228f, 0.5456f, 0.5682f,
+  0.5907f, 0.6131f, 0.6353f, 0.6569f, 0.6792f, 0.7f, 0.7208f, 0.7417f,
+  0.7625f, 0.7806f, 0.7972f, 0.8111f, 0.8181f, 0.2125f, 0.225f, 0.2431f,
+  0.2611f, 0.2806f, 0.3014f, 0.3222f, 0.3444f, 0.3661f, 0.3882f, 0.4103f,
+  0.4326f, 0.455f, 0.4775f, 0.5f, 0.5225f, 0.545f, 0.5674f, 0.5897f,
+  0.6118f, 0.6339f, 0.6556f, 0.6778f, 0.6986f, 0.7194f, 0.7389f, 0.7569f,
+  0.775f, 0.7875f, 0.2375f, 0.25f, 0.2667f, 0.2847f, 0.3042f, 0.325f,
+  0.3458f, 0.3676f, 0.3893f, 0.4113f, 0.4333f, 0.4554f, 0.4778f, 0.5f,
+  0.5222f, 0.5446f, 0.5667f, 0.5888f, 0.6107f, 0.6324f, 0.6542f, 0.675f,
+  0.6958f, 0.7153f, 0.7333f, 0.75f, 0.7625f,
+};
+static const float osvr_display_mesh_built_in_osvr_hdk20_v1_eye1_to_x[] = {
+  0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.02551f, 0.02551f, 0.02551f, 0.02551f, 0.02551f,
+  0.02551f, 0.02551f, 0.02551f, 0.02551f, 0.02551f, 0.02551f, 0.02551f, 0.02551f,
+  0.02551f, 0.02551f, 0.02551f, 0.02551f, 0.02551f, 0.02551f, 0.02551f, 0.02551f,
+  0.02551f, 0.02551f, 0.02551f, 0.02551f, 0.02551f, 0.02551f, 0.02551f, 0.02551f,
+  0.04974f, 0.04974f, 0.04974f, 0.04974f, 0.04974f, 0.04974f, 0.04974f, 0.04974f,
+  0.04974f, 0.04974f, 0.04974f, 0.04974f, 0.04974f, 0.04974f, 0.04974f, 0.04974f,
+  0.04974f, 0.04974f, 0.04974f, 0.04974f, 0.04974f, 0.04974f, 0.04974f, 0.04974f,
+  0.04974f, 0.04974f, 0.04974f, 0.04974f, 0.04974f, 0.04974f, 0.04974f, 0.07432f,
+  0.07432f, 0.07432f, 0.07432f, 0.07432f, 0.07432f, 0.07432f, 0.07432f, 0.07432f,
+  0.07432f, 0.07432f, 0.07432f, 0.07432f, 0.07432f, 0.07432f, 0.07432f, 0.07432f,
+  0.07432f, 0.07432f, 0.07432f, 0.07432f, 0.07432f, 0.07432f, 0.07432f, 0.07432f,
+  0.07432f, 0.07432f, 0.07432f, 0.07432f, 0.07432f, 0.07432f, 0.07432f, 0.07432f,
+  0.07432f, 0.07432f, 0.1006f, 0.1006f, 0.1006f, 0.1006f, 0.1006f, 0.1006f,
+  0.1006f, 0.1006f, 0.1006f, 0.1006f, 0.1006f, 0.1006f, 0.1006f, 0.1006f,
+  0.1006f, 0.1006f, 0.1006f, 0.1006f, 0.1006f, 0.1006f, 0.1006f, 0.1006f,
+  0.1006f, 0.1006f, 0.1006f, 0.1006f, 0.1006f, 0.1006f, 0.1006f, 0.1006f,
+  0.1006f, 0.1006f, 0.1006f, 0.1006f, 0.1006f, 0.1006f, 0.1006f, 0.1255f,
+  0.1255f, 0.1255f, 0.1255f, 0.1255f, 0.1255f, 0.1255f, 0.1255f, 0.1255f,
+  0.1255f, 0.1255f, 0.1255f, 0.1255f, 0.1255f, 0.1255f, 0.1255f, 0.1255f,
+  0.1255f, 0.1255f, 0.1255f, 0.1255f, 0.1255f, 0.1255f, 0.1255f, 0.1255f,
+  0.1255f, 0.1255f, 0.1255f, 0.1255f, 0.1255f, 0.1255f, 0.1255f, 0.1255f,
+  0.1255f, 0.1255f, 0.1255f, 0.1255f, 0.1255f, 0.1255f, 0.1505f, 0.1505f,
+  0.1505f, 0.1505f, 0.1505f, 0.1505f, 0.1505f, 0.1505f, 0.1505f, 0.1505f,
+  0.1505f, 0.1505f, 0.1505f, 0.1505f, 0.1505f, 0.1505f, 0.1505f, 0.1505f,
+  0.1505f, 0.1505f, 0.1505f, 0.1505f, 0.1505f, 0.1505f, 0.1505f, 0.1505f,
+  0.1505f, 0.1505f, 0.1505f, 0.1505f, 0.1505f, 0.1505f, 0.1505f, 0.1505f,
+  0.1505f, 0.1505f, 0.1505f, 0.1505f, 0.1505f, 0.1755f, 0.1755f, 0.1755f,
+  0.1755f, 0.1755f, 0.1755f, 0.1755f, 0.1755f, 0.1755f, 0.1755f, 0.1755f,
+  0.1755f, 0.1755f, 0.1755f, 0.1755f, 0.1755f, 0.1755f, 0.1755f, 0.1755f,
+  0.1755f, 0.1755f, 0.1755f, 0.1755f, 0.1755f, 0.1755f, 0.1755f, 0.1755f,
+  0.1755f, 0.1755f, 0.1755f, 0.1755f, 0.1755f, 0.1755f, 0.1755f, 0.1755f,
+  0.1755f, 0.1755f, 0.1755f, 0.1755f, 0.1755f, 0.1755f, 0.1995f, 0.1995f,
+  0.1995f, 0.1995f, 0.1995f, 0.1995f, 0.1995f, 0.1995f, 0.1995f, 0.1995f,
+  0.1995f, 0.1995f, 0.1995f, 0.1995f, 0.1995f, 0.1995f, 0.1995f, 0.1995f,
+  0.1995f, 0.1995f, 0.1995f, 0.1995f, 0.1995f, 0.1995f, 0.1995f, 0.1995f,
+  0.1995f, 0.1995f, 0.1995f, 0.1995f, 0.1995f, 0.1995f, 0.1995f, 0.1995f,
+  0.1995f, 0.1995f, 0.1995f, 0.1995f, 0.1995f, 0.1995f, 0.1995f, 0.2246f,
+  0.2246f, 0.2246f, 0.2246f, 0.2246f, 0.2246f, 0.2246f, 0.2246f, 0.2246f,
+  0.2246f, 0.2246f, 0.2246f, 0.2246f, 0.2246f, 0.2246f, 0.2246f, 0.2246f,
+  0.2246f, 0.2246f, 0.2246f, 0.2246f, 0.2246f, 0.2246f, 0.2246f, 0.2246f,
+  0.2246f, 0.2246f, 0.2246f, 0.2246f, 0.2246f, 0.2246f, 0.2246f, 0.2246f,
+  0.2246f, 0.2246f, 0.2246f, 0.2246f, 0.2246f, 0.2246f, 0.2246f, 0.2246f,
+  0.2497f, 0.2497f, 0.2497f, 0.2497f, 0.2497f, 0.2497f, 0.2497f, 0.2497f,
+  0.2497f, 0.2497f, 0.2497f, 0.2497f, 0.2497f, 0.2497f, 0.2497f, 0.2497f,
+  0.2497f, 0.2497f, 0.2497f, 0.2497f, 0.2497f, 0.2497f, 0.2497f, 0.2497f,
+  0.2497f, 0.2497f, 0.2497f, 0.2497f, 0.2497f, 0.2497f, 0.2497f, 0.2497f,
+  0.2497f, 0.2497f, 0.2497f, 0.2497f, 0.2497f, 0.2497f, 0.2497f, 0.2497f,
+  0.2497f, 0.2748f, 0.2748f, 0.2748f, 0.2748f, 0.2748f, 0.2748f, 0.2748f,
+  0.2748f, 0.2748f, 0.2748f, 0.2748f, 0.2748f, 0.2748f, 0.2748f, 0.2748f,
+  0.2748f, 0.2748f, 0.2748f, 0.2748f, 0.2748f, 0.2748f, 0.2748f, 0.2748f,
+  0.2748f, 0.2748f, 0.2748f, 0.2748f, 0.2748f, 0.2748f, 0.2748f, 0.2748f,
+  0.2748f, 0.2748f, 0.2748f, 0.2748f, 0.2748f, 0.2748f, 0.2748f, 0.2748f,
+  0.2748f, 0.2748f, 0.3f, 0.3f, 0.3f, 0.3f, 0.3f, 0.3f,
+  0.3f, 0.3f, 0.3f, 0.3f, 0.3f, 0.3f, 0.3f, 0.3f,
+  0.3f, 0.3f, 0.3f, 0.3f, 0.3f, 0.3f, 0.3f, 0.3f,
+  0.3f, 0.3f, 0.3f, 0.3f, 0.3f, 0.3f, 0.3f, 0.3f,
+  0.3f, 0.3f, 0.3f, 0.3f, 0.3f, 0.3f, 0.3f, 0.3f,
+  0.3f, 0.3f, 0.3f, 0.3252f, 0.3252f, 0.3252f, 0.3252f, 0.3252f,
+  0.3252f, 0.3252f, 0.3252f, 0.3252f, 0.3252f, 0.3252f, 0.3252f, 0.3252f,
+  0.3252f, 0.3252f, 0.3252f, 0.3252f, 0.3252f, 0.3252f, 0.3252f, 0.3252f,
+  0.3252f, 0.3252f, 0.3252f, 0.3252f, 0.3252f, 0.3252f, 0.3252f, 0.3252f,
+  0.3252f, 0.3252f, 0.3252f, 0.3252f, 0.3252f, 0.3252f, 0.3252f, 0.3252f,
+  0.3252f, 0.3252f, 0.3252f, 0.3252f, 0.3496f, 0.3496f, 0.3496f, 0.3496f,
+  0.3496f, 0.3496f, 0.3496f, 0.3496f, 0.3496f, 0.3496f, 0.3496f, 0.3496f,
+  0.3496f, 0.3496f, 0.3496f, 0.3496f, 0.3496f, 0.3496f, 0.3496f, 0.3496f,
+  0.3496f, 0.3496f, 0.3496f, 0.3496f, 0.3496f, 0.3496f, 0.3496f, 0.3496f,
+  0.3496f, 0.3496f, 0.3496f, 0.3496f, 0.3496f, 0.3496f, 0.3496f, 0.3496f,
+  0.3496f, 0.3496f, 0.3496f, 0.3496f, 0.3496f, 0.3751f, 0.3751f, 0.3751f,
+  0.3751f, 0.3751f, 0.3751f, 0.3751f, 0.3751f, 0.3751f, 0.3751f, 0.3751f,
+  0.3751f, 0.3751f, 0.3751f, 0.3751f, 0.3751f, 0.3751f, 0.3751f, 0.3751f,
+  0.3751f, 0.3751f, 0.3751f, 0.3751f, 0.3751f, 0.3751f, 0.3751f, 0.3751f,
+  0.3751f, 0.3751f, 0.3751f, 0.3751f, 0.3751f, 0.3751f, 0.3751f, 0.3751f,
+  0.3751f, 0.3751f, 0.3751f, 0.3751f, 0.3751f, 0.3751f, 0.4f, 0.4f,
+  0.4f, 0.4f, 0.4f, 0.4f, 0.4f, 0.4f, 0.4f, 0.4f,
+  0.4f, 0.4f, 0.4f, 0.4f, 0.4f, 0.4f, 0.4f, 0.4f,
+  0.4f, 0.4f, 0.4f, 0.4f, 0.4f, 0.4f, 0.4f, 0.4f,
+  0.4f, 0.4f, 0.4f, 0.4f, 0.4f, 0.4f, 0.4f, 0.4f,
+  0.4f, 0.4f, 0.4f, 0.4f, 0.4f, 0.4f, 0.4f, 0.425f,
+  0.425f, 0.425f, 0.425f, 0.425f, 0.425f, 0.425f, 0.425f, 0.425f,
+  0.425f, 0.425f, 0.425f, 0.425f, 0.425f, 0.425f, 0.425f, 0.425f,
+  0.425f, 0.425f, 0.425f, 0.425f, 0.425f, 0.425f, 0.425f, 0.425f,
+  0.425f, 0.425f, 0.425f, 0.425f, 0.425f, 0.425f, 0.425f, 0.425f,
+  0.425f, 0.425f, 0.425f, 0.425f, 0.425f, 0.425f, 0.425f, 0.425f,
+  0.45f, 0.45f, 0.45f, 0.45f, 0.45f, 0.45f, 0.45f, 0.45f,
+  0.45f, 0.45f, 0.45f, 0.45f, 0.45f, 0.45f, 0.45f, 0.45f,
+  0.45f, 0.45f, 0.45f, 0.45f, 0.45f, 0.45f, 0.45f, 0.45f,
+  0.45f, 0.45f, 0.45f, 0.45f, 0.45f, 0.45f, 0.45f, 0.45f,
+  0.45f, 0.45f, 0.45f, 0.45f, 0.45f, 0.45f, 0.45f, 0.45f,
+  0.45f, 0.475f, 0.475f, 0.475f, 0.475f, 0.475f, 0.475f, 0.475f,
+  0.475f, 0.475f, 0.475f, 0.475f, 0.475f, 0.475f, 0.475f, 0.475f,
+  0.475f, 0.475f, 0.475f, 0.475f, 0.475f, 0.475f, 0.475f, 0.475f,
+  0.475f, 0.475f, 0.475f, 0.475f, 0.475f, 0.475f, 0.475f, 0.475f,
+  0.475f, 0.475f, 0.475f, 0.475f, 0.475f, 0.475f, 0.475f, 0.475f,
+  0.475f, 0.475f, 0.5f, 0.5f, 0.5f, 0.5f, 0.5f, 0.5f,
+  0.5f, 0.5f, 0.5f, 0.5f, 0.5f, 0.5f, 0.5f, 0.5f,
+  0.5f, 0.5f, 0.5f, 0.5f, 0.5f, 0.5f, 0.5f, 0.5f,
+  0.5f, 0.5f, 0.5f, 0.5f, 0.5f, 0.5f, 0.5f, 0.5f,
+  0.5f, 0.5f, 0.5f, 0.5f, 0.5f, 0.5f, 0.5f, 0.5f,
+  0.5f, 0.5f, 0.5f, 0.525f, 0.525f, 0.525f, 0.525f, 0.525f,
+  0.525f, 0.525f, 0.525f, 0.525f, 0.525f, 0.525f, 0.525f, 0.525f,
+  0.525f, 0.525f, 0.525f, 0.525f, 0.525f, 0.525f, 0.525f, 0.525f,
+  0.525f, 0.525f, 0.525f, 0.525f, 0.525f, 0.525f, 0.525f, 0.525f,
+  0.525f, 0.525f, 0.525f, 0.525f, 0.525f, 0.525f, 0.525f, 0.525f,
+  0.525f, 0.525f, 0.525f, 0.525f, 0.55f, 0.55f, 0.55f, 0.55f,
+  0.55f, 0.55f, 0.55f, 0.55f, 0.55f, 0.55f, 0.55f, 0.55f,
+  0.55f, 0.55f, 0.55f, 0.55f, 0.55f, 0.55f, 0.55f, 0.55f,
+  0.55f, 0.55f, 0.55f, 0.55f, 0.55f, 0.55f, 0.55f, 0.55f,
+  0.55f, 0.55f, 0.55f, 0.55f, 0.55f, 0.55f, 0.55f, 0.55f,
+  0.55f, 0.55f, 0.55f, 0.55f, 0.55f, 0.575f, 0.575f, 0.575f,
+  0.575f, 0.575f, 0.575f, 0.575f, 0.575f, 0.575f, 0.575f, 0.575f,
+  0.575f, 0.575f, 0.575f, 0.575f, 0.575f, 0.575f, 0.575f, 0.575f,
+  0.575f, 0.575f, 0.575f, 0.575f, 0.575f, 0.575f, 0.575f, 0.575f,
+  0.575f, 0.575f, 0.575f, 0.575f, 0.575f, 0.575f, 0.575f, 0.575f,
+  0.575f, 0.575f, 0.575f, 0.575f, 0.575f, 0.575f, 0.6f, 0.6f,
+  0.6f, 0.6f, 0.6f, 0.6f, 0.6f, 0.6f, 0.6f, 0.6f,
+  0.6f, 0.6f, 0.6f, 0.6f, 0.6f, 0.6f, 0.6f, 0.6f,
+  0.6f, 0.6f, 0.6f, 0.6f, 0.6f, 0.6f, 0.6f, 0.6f,
+  0.6f, 0.6f, 0.6f, 0.6f, 0.6f, 0.6f, 0.6f, 0.6f,
+  0.6f, 0.6f, 0.6f, 0.6f, 0.6f, 0.6f, 0.6f, 0.6249f,
+  0.6249f, 0.6249f, 0.6249f, 0.6249f, 0.6249f, 0.6249f, 0.6249f, 0.6249f,
+  0.6249f, 0.6249f, 0.6249f, 0.6249f, 0.6249f, 0.6249f, 0.6249f, 0.6249f,
+  0.6249f, 0.6249f, 0.6249f, 0.6249f, 0.6249f, 0.6249f, 0.6249f, 0.6249f,
+  0.6249f, 0.6249f, 0.6249f, 0.6249f, 0.6249f, 0.6249f, 0.6249f, 0.6249f,
+  0.6249f, 0.6249f, 0.6249f, 0.6249f, 0.6249f, 0.6249f, 0.6249f, 0.6249f,
+  0.6504f, 0.6504f, 0.6504f, 0.6504f, 0.6504f, 0.6504f, 0.6504f, 0.6504f,
+  0.6504f, 0.6504f, 0.6504f, 0.6504f, 0.6504f, 0.6504f, 0.6504f, 0.6504f,
+  0.6504f, 0.6504f, 0.6504f, 0.6504f, 0.6504f, 0.6504f, 0.6504f, 0.6504f,
+  0.6504f, 0.6504f, 0.6504f, 0.6504f, 0.6504f, 0.6504f, 0.6504f, 0.6504f,
+  0.6504f, 0.6504f, 0.6504f, 0.6504f, 0.6504f, 0.6504f, 0.6504f, 0.6504f,
+  0.6504f, 0.6748f, 0.6748f, 0.6748f, 0.6748f, 0.6748f, 0.6748f, 0.6748f,
+  0.6748f, 0.6748f, 0.6748f, 0.6748f, 0.6748f, 0.6748f, 0.6748f, 0.6748f,
+  0.6748f, 0.6748f, 0.6748f, 0.6748f, 0.6748f, 0.6748f, 0.6748f, 0.6748f,
+  0.6748f, 0.6748f, 0.6748f, 0.6748f, 0.6748f, 0.6748f, 0.6748f, 0.6748f,
+  0.6748f, 0.6748f, 0.6748f, 0.6748f, 0.6748f, 0.6748f, 0.6748f, 0.6748f,
+  0.6748f, 0.6748f, 0.7f, 0.7f, 0.7f, 0.7f, 0.7f, 0.7f,
+  0.7f, 0.7f, 0.7f, 0.7f, 0.7f, 0.7f, 0.7f, 0.7f,
+  0.7f, 0.7f, 0.7f, 0.7f, 0.7f, 0.7f, 0.7f, 0.7f,
+  0.7f, 0.7f, 0.7f, 0.7f, 0.7f, 0.7f, 0.7f, 0.7f,
+  0.7f, 0.7f, 0.7f, 0.7f, 0.7f, 0.7f, 0.7f, 0.7f,
+  0.7f, 0.7f, 0.7f, 0.7252f, 0.7252f, 0.7252f, 0.7252f, 0.7252f,
+  0.7252f, 0.7252f, 0.7252f, 0.7252f, 0.7252f, 0.7252f, 0.7252f, 0.7252f,
+  0.7252f, 0.7252f, 0.7252f, 0.7252f, 0.7252f, 0.7252f, 0.7252f, 0.7252f,
+  0.7252f, 0.7252f, 0.7252f, 0.7252f, 0.7252f, 0.7252f, 0.7252f, 0.7252f,
+  0.7252f, 0.7252f, 0.7252f, 0.7252f, 0.7252f, 0.7252f, 0.7252f, 0.7252f,
+  0.7252f, 0.7252f, 0.7252f, 0.7252f, 0.7503f, 0.7503f, 0.7503f, 0.7503f,
+  0.7503f, 0.7503f, 0.7503f, 0.7503f, 0.7503f, 0.7503f, 0.7503f, 0.7503f,
+  0.7503f, 0.7503f, 0.7503f, 0.7503f, 0.7503f, 0.7503f, 0.7503f, 0.7503f,
+  0.7503f, 0.7503f, 0.7503f, 0.7503f, 0.7503f, 0.7503f, 0.7503f, 0.7503f,
+  0.7503f, 0.7503f, 0.7503f, 0.7503f, 0.7503f, 0.7503f, 0.7503f, 0.7503f,
+  0.7503f, 0.7503f, 0.7503f, 0.7503f, 0.7503f, 0.7754f, 0.7754f, 0.7754f,
+  0.7754f, 0.7754f, 0.7754f, 0.7754f, 0.7754f, 0.7754f, 0.7754f, 0.7754f,
+  0.7754f, 0.7754f, 0.7754f, 0.7754f, 0.7754f, 0.7754f, 0.7754f, 0.7754f,
+  0.7754f, 0.7754f, 0.7754f, 0.7754f, 0.7754f, 0.7754f, 0.7754f, 0.7754f,
+  0.7754f, 0.7754f, 0.7754f, 0.7754f, 0.7754f, 0.7754f, 0.7754f, 0.7754f,
+  0.7754f, 0.7754f, 0.7754f, 0.7754f, 0.7754f, 0.7754f, 0.8005f, 0.8005f,
+  0.8005f, 0.8005f, 0.8005f, 0.8005f, 0.8005f, 0.8005f, 0.8005f, 0.8005f,
+  0.8005f, 0.8005f, 0.8005f, 0.8005f, 0.8005f, 0.8005f, 0.8005f, 0.8005f,
+  0.8005f, 0.8005f, 0.8005f, 0.8005f, 0.8005f, 0.8005f, 0.8005f, 0.8005f,
+  0.8005f, 0.8005f, 0.8005f, 0.8005f, 0.8005f, 0.8005f, 0.8005f, 0.8005f,
+  0.8005f, 0.8005f, 0.8005f, 0.8005f, 0.8005f, 0.8005f, 0.8005f, 0.8245f,
+  0.8245f, 0.8245f, 0.8245f, 0.8245f, 0.8245f, 0.8245f, 0.8245f, 0.8245f,
+  0.8245f, 0.8245f, 0.8245f, 0.8245f, 0.8245f, 0.8245f, 0.8245f, 0.8245f,
+  0.8245f, 0.8245f, 0.8245f, 0.8245f, 0.8245f, 0.8245f, 0.8245f, 0.8245f,
+  0.8245f, 0.8245f, 0.8245f, 0.8245f, 0.8245f, 0.8245f, 0.8245f, 0.8245f,
+  0.8245f, 0.8245f, 0.8245f, 0.8245f, 0.8245f, 0.8245f, 0.8495f, 0.8495f,
+  0.8495f, 0.8495f, 0.8495f, 0.8495f, 0.8495f, 0.8495f, 0.8495f, 0.8495f,
+  0.8495f, 0.8495f, 0.8495f, 0.8495f, 0.8495f, 0.8495f, 0.8495f, 0.8495f,
+  0.8495f, 0.8495f, 0.8495f, 0.8495f, 0.8495f, 0.8495f, 0.8495f, 0.8495f,
+  0.8495f, 0.8495f, 0.8495f, 0.8495f, 0.8495f, 0.8495f, 0.8495f, 0.8495f,
+  0.8495f, 0.8495f, 0.8495f, 0.8495f, 0.8495f, 0.8495f, 0.8495f, 0.8745f,
+  0.8745f, 0.8745f, 0.8745f, 0.8745f, 0.8745f, 0.8745f, 0.8745f, 0.8745f,
+  0.8745f, 0.8745f, 0.8745f, 0.8745f, 0.8745f, 0.8745f, 0.8745f, 0.8745f,
+  0.8745f, 0.8745f, 0.8745f, 0.8745f, 0.8745f, 0.8745f, 0.8745f, 0.8745f,
+  0.8745f, 0.8745f, 0.8745f, 0.8745f, 0.8745f, 0.8745f, 0.8745f, 0.8745f,
+  0.8745f, 0.8745f, 0.8745f, 0.8745f, 0.8745f, 0.8745f, 0.8994f, 0.8994f,
+  0.8994f, 0.8994f, 0.8994f, 0.8994f, 0.8994f, 0.8994f, 0.8994f, 0.8994f,
+  0.8994f, 0.8994f, 0.8994f, 0.8994f, 0.8994f, 0.8994f, 0.8994f, 0.8994f,
+  0.8994f, 0.8994f, 0.8994f, 0.8994f, 0.8994f, 0.8994f, 0.8994f, 0.8994f,
+  0.8994f, 0.8994f, 0.8994f, 0.8994f, 0.8994f, 0.8994f, 0.8994f, 0.8994f,
+  0.8994f, 0.8994f, 0.8994f, 0.9257f, 0.9257f, 0.9257f, 0.9257f, 0.9257f,
+  0.9257f, 0.9257f, 0.9257f, 0.9257f, 0.9257f, 0.9257f, 0.9257f, 0.9257f,
+  0.9257f, 0.9257f, 0.9257f, 0.9257f, 0.9257f, 0.9257f, 0.9257f, 0.9257f,
+  0.9257f, 0.9257f, 0.9257f, 0.9257f, 0.9257f, 0.9257f, 0.9257f, 0.9257f,
+  0.9257f, 0.9257f, 0.9257f, 0.9257f, 0.9503f, 0.9503f, 0.9503f, 0.9503f,
+  0.9503f, 0.9503f, 0.9503f, 0.9503f, 0.9503f, 0.9503f, 0.9503f, 0.9503f,
+  0.9503f, 0.9503f, 0.9503f, 0.9503f, 0.9503f, 0.9503f, 0.9503f, 0.9503f,
+  0.9503f, 0.9503f, 0.9503f, 0.9503f, 0.9503f, 0.9503f, 0.9503f, 0.9503f,
+  0.9503f, 0.9503f, 0.9503f, 0.9503f, 0.9503f, 0.9745f, 0.9745f, 0.9745f,
+  0.9745f, 0.9745f, 0.9745f, 0.9745f, 0.9745f, 0.9745f, 0.9745f, 0.9745f,
+  0.9745f, 0.9745f, 0.9745f, 0.9745f, 0.9745f, 0.9745f, 0.9745f, 0.9745f,
+  0.9745f, 0.9745f, 0.9745f, 0.9745f, 0.9745f, 0.9745f, 0.9745f, 0.9745f,
+  0.9745f, 0.9745f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f,
+  1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f,
+  1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f,
+  1.0f, 1.0f, 1.0f, 1.0f, 1.0f,
+};
+static const float osvr_display_mesh_built_in_osvr_hdk20_v1_eye1_to_y[] = {
+  0.1755f, 0.1995f, 0.2246f, 0.2497f, 0.2748f, 0.3f, 0.3252f, 0.3496f,
+  0.3751f, 0.4f, 0.425f, 0.45f, 0.475f, 0.5f, 0.525f, 0.55f,
+  0.575f, 0.6f, 0.6249f, 0.6504f, 0.6748f, 0.7f, 0.7252f, 0.7503f,
+  0.7754f, 0.8005f, 0.8245f, 0.1505f, 0.1755f, 0.1995f, 0.2246f, 0.2497f,
+  0.2748f, 0.3f, 0.3252f, 0.3496f, 0.3751f, 0.4f, 0.425f, 0.45f,
+  0.475f, 0.5f, 0.525f, 0.55f, 0.575f, 0.6f, 0.6249f, 0.6504f,
+  0.6748f, 0.7f, 0.7252f, 0.7503f, 0.7754f, 0.8005f, 0.8245f, 0.8495f,
+  0.1255f, 0.1505f, 0.1755f, 0.1995f, 0.2246f, 0.2497f, 0.2748f, 0.3f,
+  0.3252f, 0.3496f, 0.3751f, 0.4f, 0.425f, 0.45f, 0.475f, 0.5f,
+  0.525f, 0.55f, 0.575f, 0.6f, 0.6249f, 0.6504f, 0.6748f, 0.7f,
+  0.7252f, 0.7503f, 0.7754f, 0.8005f, 0.8245f, 0.8495f, 0.8745f, 0.07432f,
+  0.1006f, 0.1255f, 0.1505f, 0.1755f, 0.1995f, 0.2246f, 0.2497f, 0.2748f,
+  0.3f, 0.3252f, 0.3496f, 0.3751f, 0.4f, 0.425f, 0.45f, 0.475f,
+  0.5f, 0.525f, 0.55f, 0.575f, 0.6f, 0.6249f, 0.6504f, 0.6748f,
+  0.7f, 0.7252f, 0.7503f, 0.7754f, 0.8005f, 0.8245f, 0.8495f, 0.8745f,
+  0.8994f, 0.9257f, 0.04974f, 0.07432f, 0.1006f, 0.1255f, 0.1505f, 0.1755f,
+  0.1995f, 0.2246f, 0.2497f, 0.2748f, 0.3f, 0.3252f, 0.3496f, 0.3751f,
+  0.4f, 0.425f, 0.45f, 0.475f, 0.5f, 0.525f, 0.55f, 0.575f,
+  0.6f, 0.6249f, 0.6504f, 0.6748f, 0.7f, 0.7252f, 0.7503f, 0.7754f,
+  0.8005f, 0.8245f, 0.8495f, 0.8745f, 0.8994f, 0.9257f, 0.9503f, 0.02551f,
+  0.04974f, 0.07432f, 0.1006f, 0.1255f, 0.1505f, 0.1755f, 0.1995f, 0.2246f,
+  0.2497f, 0.2748f, 0.3f, 0.3252f, 0.3496f, 0.3751f, 0.4f, 0.425f,
+  0.45f, 0.475f, 0.5f, 0.525f, 0.55f, 0.575f, 0.6f, 0.6249f,
+  0.6504f, 0.6748f, 0.7f, 0.7252f, 0.7503f, 0.7754f, 0.8005f, 0.8245f,
+  0.8495f, 0.8745f, 0.8994f, 0.9257f, 0.9503f, 0.9745f, 0.02551f, 0.04974f,
+  0.07432f, 0.1006f, 0.1255f, 0.1505f, 0.1755f, 0.1995f, 0.2246f, 0.2497f,
+  0.2748f, 0.3f, 0.3252f, 0.3496f, 0.3751f, 0.4f, 0.425f, 0.45f,
+  0.475f, 0.5f, 0.525f, 0.55f, 0.575f, 0.6f, 0.6249f, 0.6504f,
+  0.6748f, 0.7f, 0.7252f, 0.7503f, 0.7754f, 0.8005f, 0.8245f, 0.8495f,
+  0.8745f, 0.8994f, 0.9257f, 0.9503f, 0.9745f, 0.0f, 0.02551f, 0.04974f,
+  0.07432f, 0.1006f, 0.1255f, 0.1505f, 0.1755f, 0.1995f, 0.2246f, 0.2497f,
+  0.2748f, 0.3f, 0.3252f, 0.3496f, 0.3751f, 0.4f, 0.425f, 0.45f,
+  0.475f, 0.5f, 0.525f, 0.55f, 0.575f, 0.6f, 0.6249f, 0.6504f,
+  0.6748f, 0.7f, 0.7252f, 0.7503f, 0.7754f, 0.8005f, 0.8245f, 0.8495f,
+  0.8745f, 0.8994f, 0.9257f, 0.9503f, 0.9745f, 1.0f, 0.0f, 0.02551f,
+  0.04974f, 0.07432f, 0.1006f, 0.1255f, 0.1505f, 0.1755f, 0.1995f, 0.2246f,
+  0.2497f, 0.2748f, 0.3f, 0.3252f, 0.3496f, 0.3751f, 0.4f, 0.425f,
+  0.45f, 0.475f, 0.5f, 0.525f, 0.55f, 0.575f, 0.6f, 0.6249f,
+  0.6504f, 0.6748f, 0.7f, 0.7252f, 0.7503f, 0.7754f, 0.8005f, 0.8245f,
+  0.8495f, 0.8745f, 0.8994f, 0.9257f, 0.9503f, 0.9745f, 1.0f, 0.0f,
+  0.02551f, 0.04974f, 0.07432f, 0.1006f, 0.1255f, 0.1505f, 0.1755f, 0.1995f,
+  0.2246f, 0.2497f, 0.2748f, 0.3f, 0.3252f, 0.3496f, 0.3751f, 0.4f,
+  0.425f, 0.45f, 0.475f, 0.5f, 0.525f, 0.55f, 0.575f, 0.6f,
+  0.6249f, 0.6504f, 0.6748f, 0.7f, 0.7252f, 0.7503f, 0.7754f, 0.8005f,
+  0.8245f, 0.8495f, 0.8745f, 0.8994f, 0.9257f, 0.9503f, 0.9745f, 1.0f,
+  0.0f, 0.02551f, 0.04974f, 0.07432f, 0.1006f, 0.1255f, 0.1505f, 0.1755f,
+  0.1995f, 0.2246f, 0.2497f, 0.2748f, 0.3f, 0.3252f, 0.3496f, 0.3751f,
+  0.4f, 0.425f, 0.45f, 0.475f, 0.5f, 0.525f, 0.55f, 0.575f,
+  0.6f, 0.6249f, 0.6504f, 0.6748f, 0.7f, 0.7252f, 0.7503f, 0.7754f,
+  0.8005f, 0.8245f, 0.8495f, 0.8745f, 0.8994f, 0.9257f, 0.9503f, 0.9745f,
+  1.0f, 0.0f, 0.02551f, 0.04974f, 0.07432f, 0.1006f, 0.1255f, 0.1505f,
+  0.1755f, 0.1995f, 0.2246f, 0.2497f, 0.2748f, 0.3f, 0.3252f, 0.3496f,
+  0.3751f, 0.4f, 0.425f, 0.45f, 0.475f, 0.5f, 0.525f, 0.55f,
+  0.575f, 0.6f, 0.6249f, 0.6504f, 0.6748f, 0.7f, 0.7252f, 0.7503f,
+  0.7754f, 0.8005f, 0.8245f, 0.8495f, 0.8745f, 0.8994f, 0.9257f, 0.9503f,
+  0.9745f, 1.0f, 0.0f, 0.02551f, 0.04974f, 0.07432f, 0.1006f, 0.1255f,
+  0.1505f, 0.1755f, 0.1995f, 0.2246f, 0.2497f, 0.2748f, 0.3f, 0.3252f,
+  0.3496f, 0.3751f, 0.4f, 0.425f, 0.45f, 0.475f, 0.5f, 0.525f,
+  0.55f, 0.575f, 0.6f, 0.6249f, 0.6504f, 0.6748f, 0.7f, 0.7252f,
+  0.7503f, 0.7754f, 0.8005f, 0.8245f, 0.8495f, 0.8745f, 0.8994f, 0.9257f,
+  0.9503f, 0.9745f, 1.0f, 0.0f, 0.02551f, 0.04974f, 0.07432f, 0.1006f,
+  0.1255f, 0.1505f, 0.1755f, 0.1995f, 0.2246f, 0.2497f, 0.2748f, 0.3f,
+  0.3252f, 0.3496f, 0.3751f, 0.4f, 0.425f, 0.45f, 0.475f, 0.5f,
+  0.525f, 0.55f, 0.575f, 0.6f, 0.6249f, 0.6504f, 0.6748f, 0.7f,
+  0.7252f, 0.7503f, 0.7754f, 0.8005f, 0.8245f, 0.8495f, 0.8745f, 0.8994f,
+  0.9257f, 0.9503f, 0.9745f, 1.0f, 0.0f, 0.02551f, 0.04974f, 0.07432f,
+  0.1006f, 0.1255f, 0.1505f, 0.1755f, 0.1995f, 0.2246f, 0.2497f, 0.2748f,
+  0.3f, 0.3252f, 0.3496f, 0.3751f, 0.4f, 0.425f, 0.45f, 0.475f,
+  0.5f, 0.525f, 0.55f, 0.575f, 0.6f, 0.6249f, 0.6504f, 0.6748f,
+  0.7f, 0.7252f, 0.7503f, 0.7754f, 0.8005f, 0.8245f, 0.8495f, 0.8745f,
+  0.8994f, 0.9257f, 0.9503f, 0.9745f, 1.0f, 0.0f, 0.02551f, 0.04974f,
+  0.07432f, 0.1006f, 0.1255f, 0.1505f, 0.1755f, 0.1995f, 0.2246f, 0.2497f,
+  0.2748f, 0.3f, 0.3252f, 0.3496f, 0.3751f, 0.4f, 0.425f, 0.45f,
+  0.475f, 0.5f, 0.525f, 0.55f, 0.575f, 0.6f, 0.6249f, 0.6504f,
+  0.6748f, 0.7f, 0.7252f, 0.7503f, 0.7754f, 0.8005f, 0.8245f, 0.8495f,
+  0.8745f, 0.8994f, 0.9257f, 0.9503f, 0.9745f, 1.0f, 0.0f, 0.02551f,
+  0.04974f, 0.07432f, 0.1006f, 0.1255f, 0.1505f, 0.1755f, 0.1995f, 0.2246f,
+  0.2497f, 0.2748f, 0.3f, 0.3252f, 0.3496f, 0.3751f, 0.4f, 0.425f,
+  0.45f, 0.475f, 0.5f, 0.525f, 0.55f, 0.575f, 0.6f, 0.6249f,
+  0.6504f, 0.6748f, 0.7f, 0.7252f, 0.7503f, 0.7754f, 0.8005f, 0.8245f,
+  0.8495f, 0.8745f, 0.8994f, 0.9257f, 0.9503f, 0.9745f, 1.0f, 0.0f,
+  0.02551f, 0.04974f, 0.07432f, 0.1006f, 0.1255f, 0.1505f, 0.1755f, 0.1995f,
+  0.2246f, 0.2497f, 0.2748f, 0.3f, 0.3252f, 0.3496f, 0.3751f, 0.4f,
+  0.425f, 0.45f, 0.475f, 0.5f, 0.525f, 0.55f, 0.575f, 0.6f,
+  0.6249f, 0.6504f, 0.6748f, 0.7f, 0.7252f, 0.7503f, 0.7754f, 0.8005f,
+  0.8245f, 0.8495f, 0.8745f, 0.8994f, 0.9257f, 0.9503f, 0.9745f, 1.0f,
+  0.0f, 0.02551f, 0.04974f, 0.07432f, 0.1006f, 0.1255f, 0.1505f, 0.1755f,
+  0.1995f, 0.2246f, 0.2497f, 0.2748f, 0.3f, 0.3252f, 0.3496f, 0.3751f,
+  0.4f, 0.425f, 0.45f, 0.475f, 0.5f, 0.525f, 0.55f, 0.575f,
+  0.6f, 0.6249f, 0.6504f, 0.6748f, 0.7f, 0.7252f, 0.7503f, 0.7754f,
+  0.8005f, 0.8245f, 0.8495f, 0.8745f, 0.8994f, 0.9257f, 0.9503f, 0.9745f,
+  1.0f, 0.0f, 0.02551f, 0.04974f, 0.07432f, 0.1006f, 0.1255f, 0.1505f,
+  0.1755f, 0.1995f, 0.2246f, 0.2497f, 0.2748f, 0.3f, 0.3252f, 0.3496f,
+  0.3751f, 0.4f, 0.425f, 0.45f, 0.475f, 0.5f, 0.525f, 0.55f,
+  0.575f, 0.6f, 0.6249f, 0.6504f, 0.6748f, 0.7f, 0.7252f, 0.7503f,
+  0.7754f, 0.8005f, 0.8245f, 0.8495f, 0.8745f, 0.8994f, 0.9257f, 0.9503f,
+  0.9745f, 1.0f, 0.0f, 0.02551f, 0.04974f, 0.07432f, 0.1006f, 0.1255f,
+  0.1505f, 0.1755f, 0.1995f, 0.2246f, 0.2497f, 0.2748f, 0.3f, 0.3252f,
+  0.3496f, 0.3751f, 0.4f, 0.425f, 0.45f, 0.475f, 0.5f, 0.525f,
+  0.55f, 0.575f, 0.6f, 0.6249f, 0.6504f, 0.6748f, 0.7f, 0.7252f,
+  0.7503f, 0.7754f, 0.8005f, 0.8245f, 0.8495f, 0.8745f, 0.8994f, 0.9257f,
+  0.9503f, 0.9745f, 1.0f, 0.0f, 0.02551f, 0.04974f, 0.07432f, 0.1006f,
+  0.1255f, 0.1505f, 0.1755f, 0.1995f, 0.2246f, 0.2497f, 0.2748f, 0.3f,
+  0.3252f, 0.3496f, 0.3751f, 0.4f, 0.425f, 0.45f, 0.475f, 0.5f,
+  0.525f, 0.55f, 0.575f, 0.6f, 0.6249f, 0.6504f, 0.6748f, 0.7f,
+  0.7252f, 0.7503f, 0.7754f, 0.8005f, 0.8245f, 0.8495f, 0.8745f, 0.8994f,
+  0.9257f, 0.9503f, 0.9745f, 1.0f, 0.0f, 0.02551f, 0.04974f, 0.07432f,
+  0.1006f, 0.1255f, 0.1505f, 0.1755f, 0.1995f, 0.2246f, 0.2497f, 0.2748f,
+  0.3f, 0.3252f, 0.3496f, 0.3751f, 0.4f, 0.425f, 0.45f, 0.475f,
+  0.5f, 0.525f, 0.55f, 0.575f, 0.6f, 0.6249f, 0.6504f, 0.6748f,
+  0.7f, 0.7252f, 0.7503f, 0.7754f, 0.8005f, 0.8245f, 0.8495f, 0.8745f,
+  0.8994f, 0.9257f, 0.9503f, 0.9745f, 1.0f, 0.0f, 0.02551f, 0.04974f,
+  0.07432f, 0.1006f, 0.1255f, 0.1505f, 0.1755f, 0.1995f, 0.2246f, 0.2497f,
+  0.2748f, 0.3f, 0.3252f, 0.3496f, 0.3751f, 0.4f, 0.425f, 0.45f,
+  0.475f, 0.5f, 0.525f, 0.55f, 0.575f, 0.6f, 0.6249f, 0.6504f,
+  0.6748f, 0.7f, 0.7252f, 0.7503f, 0.7754f, 0.8005f, 0.8245f, 0.8495f,
+  0.8745f, 0.8994f, 0.9257f, 0.9503f, 0.9745f, 1.0f, 0.0f, 0.02551f,
+  0.04974f, 0.07432f, 0.1006f, 0.1255f, 0.1505f, 0.1755f, 0.1995f, 0.2246f,
+  0.2497f, 0.2748f, 0.3f, 0.3252f, 0.3496f, 0.3751f, 0.4f, 0.425f,
+  0.45f, 0.475f, 0.5f, 0.525f, 0.55f, 0.575f, 0.6f, 0.6249f,
+  0.6504f, 0.6748f, 0.7f, 0.7252f, 0.7503f, 0.7754f, 0.8005f, 0.8245f,
+  0.8495f, 0.8745f, 0.8994f, 0.9257f, 0.9503f, 0.9745f, 1.0f, 0.0f,
+  0.02551f, 0.04974f, 0.07432f, 0.1006f, 0.1255f, 0.1505f, 0.1755f, 0.1995f,
+  0.2246f, 0.2497f, 0.2748f, 0.3f, 0.3252f, 0.3496f, 0.3751f, 0.4f,
+  0.425f, 0.45f, 0.475f, 0.5f, 0.525f, 0.55f, 0.575f, 0.6f,
+  0.6249f, 0.6504f, 0.6748f, 0.7f, 0.7252f, 0.7503f, 0.7754f, 0.8005f,
+  0.8245f, 0.8495f, 0.8745f, 0.8994f, 0.9257f, 0.9503f, 0.9745f, 1.0f,
+  0.0f, 0.02551f, 0.04974f, 0.07432f, 0.1006f, 0.1255f, 0.1505f, 0.1755f,
+  0.1995f, 0.2246f, 0.2497f, 0.2748f, 0.3f, 0.3252f, 0.3496f, 0.3751f,
+  0.4f, 0.425f, 0.45f, 0.475f, 0.5f, 0.525f, 0.55f, 0.575f,
+  0.6f, 0.6249f, 0.6504f, 0.6748f, 0.7f, 0.7252f, 0.7503f, 0.7754f,
+  0.8005f, 0.8245f, 0.8495f, 0.8745f, 0.8994f, 0.9257f, 0.9503f, 0.9745f,
+  1.0f, 0.0f, 0.02551f, 0.04974f, 0.07432f, 0.1006f, 0.1255f, 0.1505f,
+  0.1755f, 0.1995f, 0.2246f, 0.2497f, 0.2748f, 0.3f, 0.3252f, 0.3496f,
+  0.3751f, 0.4f, 0.425f, 0.45f, 0.475f, 0.5f, 0.525f, 0.55f,
+  0.575f, 0.6f, 0.6249f, 0.6504f, 0.6748f, 0.7f, 0.7252f, 0.7503f,
+  0.7754f, 0.8005f, 0.8245f, 0.8495f, 0.8745f, 0.8994f, 0.9257f, 0.9503f,
+  0.9745f, 1.0f, 0.0f, 0.02551f, 0.04974f, 0.07432f, 0.1006f, 0.1255f,
+  0.1505f, 0.1755f, 0.1995f, 0.2246f, 0.2497f, 0.2748f, 0.3f, 0.3252f,
+  0.3496f, 0.3751f, 0.4f, 0.425f, 0.45f, 0.475f, 0.5f, 0.525f,
+  0.55f, 0.575f, 0.6f, 0.6249f, 0.6504f, 0.6748f, 0.7f, 0.7252f,
+  0.7503f, 0.7754f, 0.8005f, 0.8245f, 0.8495f, 0.8745f, 0.8994f, 0.9257f,
+  0.9503f, 0.9745f, 1.0f, 0.0f, 0.02551f, 0.04974f, 0.07432f, 0.1006f,
+  0.1255f, 0.1505f, 0.1755f, 0.1995f, 0.2246f, 0.2497f, 0.2748f, 0.3f,
+  0.3252f, 0.3496f, 0.3751f, 0.4f, 0.425f, 0.45f, 0.475f, 0.5f,
+  0.525f, 0.55f, 0.575f, 0.6f, 0.6249f, 0.6504f, 0.6748f, 0.7f,
+  0.7252f, 0.7503f, 0.7754f, 0.8005f, 0.8245f, 0.8495f, 0.8745f, 0.8994f,
+  0.9257f, 0.9503f, 0.9745f, 1.0f, 0.0f, 0.02551f, 0.04974f, 0.07432f,
+  0.1006f, 0.1255f, 0.1505f, 0.1755f, 0.1995f, 0.2246f, 0.2497f, 0.2748f,
+  0.3f, 0.3252f, 0.3496f, 0.3751f, 0.4f, 0.425f, 0.45f, 0.475f,
+  0.5f, 0.525f, 0.55f, 0.575f, 0.6f, 0.6249f, 0.6504f, 0.6748f,
+  0.7f, 0.7252f, 0.7503f, 0.7754f, 0.8005f, 0.8245f, 0.8495f, 0.8745f,
+  0.8994f, 0.9257f, 0.9503f, 0.9745f, 1.0f, 0.0f, 0.02551f, 0.04974f,
+  0.07432f, 0.1006f, 0.1255f, 0.1505f, 0.1755f, 0.1995f, 0.2246f, 0.2497f,
+  0.2748f, 0.3f, 0.3252f, 0.3496f, 0.3751f, 0.4f, 0.425f, 0.45f,
+  0.475f, 0.5f, 0.525f, 0.55f, 0.575f, 0.6f, 0.6249f, 0.6504f,
+  0.6748f, 0.7f, 0.7252f, 0.7503f, 0.7754f, 0.8005f, 0.8245f, 0.8495f,
+  0.8745f, 0.8994f, 0.9257f, 0.9503f, 0.9745f, 1.0f, 0.0f, 0.02551f,
+  0.04974f, 0.07432f, 0.1006f, 0.1255f, 0.1505f, 0.1755f, 0.1995f, 0.2246f,
+  0.2497f, 0.2748f, 0.3f, 0.3252f, 0.3496f, 0.3751f, 0.4f, 0.425f,
+  0.45f, 0.475f, 0.5f, 0.525f, 0.55f, 0.575f, 0.6f, 0.6249f,
+  0.6504f, 0.6748f, 0.7f, 0.7252f, 0.7503f, 0.7754f, 0.8005f, 0.8245f,
+  0.8495f, 0.8745f, 0.8994f, 0.9257f, 0.9503f, 0.9745f, 1.0f, 0.0f,
+  0.04974f, 0.07432f, 0.1006f, 0.1255f, 0.1505f, 0.1755f, 0.1995f, 0.2246f,
+  0.2497f, 0.2748f, 0.3f, 0.3252f, 0.3496f, 0.3751f, 0.4f, 0.425f,
+  0.45f, 0.475f, 0.5f, 0.525f, 0.55f, 0.575f, 0.6f, 0.6249f,
+  0.6504f, 0.6748f, 0.7f, 0.7252f, 0.7503f, 0.7754f, 0.8005f, 0.8245f,
+  0.8495f, 0.8745f, 0.8994f, 0.9257f, 0.9503f, 1.0f, 0.0f, 0.02551f,
+  0.04974f, 0.07432f, 0.1006f, 0.1255f, 0.1505f, 0.1755f, 0.1995f, 0.2246f,
+  0.2497f, 0.2748f, 0.3f, 0.3252f, 0.3496f, 0.3751f, 0.4f, 0.425f,
+  0.45f, 0.475f, 0.5f, 0.525f, 0.55f, 0.575f, 0.6f, 0.6249f,
+  0.6504f, 0.6748f, 0.7f, 0.7252f, 0.7503f, 0.7754f, 0.8005f, 0.8245f,
+  0.8495f, 0.8745f, 0.8994f, 0.9257f, 0.9503f, 0.9745f, 1.0f, 0.02551f,
+  0.04974f, 0.07432f, 0.1006f, 0.1255f, 0.1505f, 0.1755f, 0.1995f, 0.2246f,
+  0.2497f, 0.2748f, 0.3f, 0.3252f, 0.3496f, 0.3751f, 0.4f, 0.425f,
+  0.45f, 0.475f, 0.5f, 0.525f, 0.55f, 0.575f, 0.6f, 0.6249f,
+  0.6504f, 0.6748f, 0.7f, 0.7252f, 0.7503f, 0.7754f, 0.8005f, 0.8245f,
+  0.8495f, 0.8745f, 0.8994f, 0.9257f, 0.9503f, 0.9745f, 0.04974f, 0.07432f,
+  0.1006f, 0.1255f, 0.1505f, 0.1755f, 0.1995f, 0.2246f, 0.2497f, 0.2748f,
+  0.3f, 0.3252f, 0.3496f, 0.3751f, 0.4f, 0.425f, 0.45f, 0.475f,
+  0.5f, 0.525f, 0.55f, 0.575f, 0.6f, 0.6249f, 0.6504f, 0.6748f,
+  0.7f, 0.7252f, 0.7503f, 0.7754f, 0.8005f, 0.8245f, 0.8495f, 0.8745f,
+  0.8994f, 0.9257f, 0.9503f, 0.07432f, 0.1006f, 0.1505f, 0.1755f, 0.1995f,
+  0.2246f, 0.2497f, 0.2748f, 0.3f, 0.3252f, 0.3496f, 0.3751f, 0.4f,
+  0.425f, 0.45f, 0.475f, 0.5f, 0.525f, 0.55f, 0.575f, 0.6f,
+  0.6249f, 0.6504f, 0.6748f, 0.7f, 0.7252f, 0.7503f, 0.7754f, 0.8005f,
+  0.8245f, 0.8495f, 0.8994f, 0.9257f, 0.1006f, 0.1255f, 0.1505f, 0.1755f,
+  0.1995f, 0.2246f, 0.2497f, 0.2748f, 0.3f, 0.3252f, 0.3496f, 0.3751f,
+  0.4f, 0.425f, 0.45f, 0.475f, 0.5f, 0.525f, 0.55f, 0.575f,
+  0.6f, 0.6249f, 0.6504f, 0.6748f, 0.7f, 0.7252f, 0.7503f, 0.7754f,
+  0.8005f, 0.8245f, 0.8495f, 0.8745f, 0.8994f, 0.1505f, 0.1755f, 0.1995f,
+  0.2246f, 0.2497f, 0.2748f, 0.3f, 0.3252f, 0.3496f, 0.3751f, 0.4f,
+  0.425f, 0.45f, 0.475f, 0.5f, 0.525f, 0.55f, 0.575f, 0.6f,
+  0.6249f, 0.6504f, 0.6748f, 0.7f, 0.7252f, 0.7503f, 0.7754f, 0.8005f,
+  0.8245f, 0.8495f, 0.1755f, 0.1995f, 0.2246f, 0.2497f, 0.2748f, 0.3f,
+  0.3252f, 0.3496f, 0.3751f, 0.4f, 0.425f, 0.45f, 0.475f, 0.5f,
+  0.525f, 0.55f, 0.575f, 0.6f, 0.6249f, 0.6504f, 0.6748f, 0.7f,
+  0.7252f, 0.7503f, 0.7754f, 0.8005f, 0.8245f,
+};
+static const BuiltInMeshEye osvr_display_mesh_built_in_osvr_hdk20_v1_eyes[] = {
+  {1581,
+   osvr_display_mesh_built_in_osvr_hdk20_v1_eye0_from_x,
+   osvr_display_mesh_built_in_osvr_hdk20_v1_eye0_from_y,
+   osvr_display_mesh_built_in_osvr_hdk20_v1_eye0_to_x,
+   osvr_display_mesh_built_in_osvr_hdk20_v1_eye0_to_y},
+  {1581,
+   osvr_display_mesh_built_in_osvr_hdk20_v1_eye1_from_x,
+   osvr_display_mesh_built_in_osvr_hdk20_v1_eye1_from_y,
+   osvr_display_mesh_built_in_osvr_hdk20_v1_eye1_to_x,
+   osvr_display_mesh_built_in_osvr_hdk20_v1_eye1_to_y},
+};
+
+/// The built-in meshes, by mono_point_samples_built_in name.
+static const struct {
+    const char* name;
+    const BuiltInMeshEye* eyePoints; //< Points of each eye
+    size_t eyes;
+} osvr_display_mesh_built_in_osvr_hdks[] = {
+  {"OSVR_HDK_13_V1", osvr_display_mesh_built_in_osvr_hdk13_v1_eyes, 2},
+  {"OSVR_HDK_13_V2", osvr_display_mesh_built_in_osvr_hdk13_v2_eyes, 2},
+  {"OSVR_HDK_20_V1", osvr_display_mesh_built_in_osvr_hdk20_v1_eyes, 2},
+};
@@ -0,0 +1,164 @@
+/** @file
+@brief Tests that the steady-state frame path does not allocate memory.
+
+@date 2026
+
+@author
+Sensics, Inc.
+<http://sensics.com/osvr>
+*/
+
+// Copyright 2026 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Internal Includes
+#include "TestRenderManager.h"
+
+// Library/third-party includes
+#include <catch2/catch.hpp>
+
+// Standard includes
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include <vector>
+
+using namespace osvr::renderkit;
+using namespace osvr::renderkit::test;
+
+/// Whether allocations are being counted, and how many there have been.
+static std::atomic<bool> g_counting(false);
+static std::atomic<size_t> g_allocations(0);
+
+void* operator new(std::size_t size) {
+    if (g_counting) {
+        g_allocations++;
+    }
+    void* p = std::malloc(size ? size : 1);
+    if (p == nullptr) {
+        throw std::bad_alloc();
+    }
+    return p;
+}
+
+void* operator new[](std::size_t size) { return operator new(size); }
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept {
+    try {
+        return operator new(size);
+    } catch (std::bad_alloc&) {
+        return nullptr;
+    }
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept {
+    return operator new(size, std::nothrow);
+}
+
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete[](void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+void operator delete[](void* p, std::size_t) noexcept { std::free(p); }
+
+/// Counts the allocations made, on any thread, while it exists.
+class AllocationCounter {
+  public:
+    AllocationCounter() {
+        g_allocations = 0;
+        g_counting = true;
+    }
+    ~AllocationCounter() { g_counting = false; }
+    size_t count() const { return g_allocations; }
+};
+
+/// Frames to run before counting, to let everything reach its size.
+static const int WARM_UP_FRAMES = 5;
+
+/// Frames to count allocations over.
+static const int COUNTED_FRAMES = 20;
+
+static void renderNothing(void* /*userData*/, GraphicsLibrary /*library*/,
+                          RenderBuffer /*buffers*/,
+                          OSVR_ViewportDescription /*viewport*/,
+                          OSVR_PoseState /*pose*/,
+                          OSVR_ProjectionMatrix /*projection*/,
+                          OSVR_TimeValue /*deadline*/) {}
+
+TEST_CASE("Presenting render buffers does not allocate", "[allocation]") {
+    RenderManager::ConstructorParameters p = nullParameters(0);
+    SECTION("Without time warp") {}
+    SECTION("With time warp") { p.m_enableTimeWarp = true; }
+    SECTION("With display timing") { p = nullParameters(1000); }
+    TestRenderManager rm(p);
+    REQUIRE(rm.OpenDisplay().status == RenderManager::COMPLETE);
+    REQUIRE(rm.RegisterRenderBuffers(std::vector<RenderBuffer>(2)));
+    Frame frame;
+    for (int i = 0; i < WARM_UP_FRAMES; i++) {
+        REQUIRE(presentFrame(rm, frame));
+    }
+
+    size_t allocations;
+    bool presented = true;
+    {
+        AllocationCounter counter;
+        for (int i = 0; i < COUNTED_FRAMES; i++) {
+            presented = presentFrame(rm, frame) && presented;
+        }
+        allocations = counter.count();
+    }
+    CHECK(presented);
+    CHECK(allocations == 0);
+}
+
+TEST_CASE("Rendering through callbacks does not allocate", "[allocation]") {
+    TestRenderManager rm(nullParameters(0));
+    REQUIRE(rm.OpenDisplay().status == RenderManager::COMPLETE);
+    REQUIRE(rm.AddRenderCallback("/", renderNothing));
+    RenderManager::RenderParams params;
+    for (int i = 0; i < WARM_UP_FRAMES; i++) {
+        REQUIRE(rm.Render(params));
+    }
+
+    size_t allocations;
+    bool rendered = true;
+    {
+        AllocationCounter counter;
+        for (int i = 0; i < COUNTED_FRAMES; i++) {
+            rendered = rm.Render(params) && rendered;
+        }
+        allocations = counter.count();
+    }
+    CHECK(rendered);
+    CHECK(allocations == 0);
+}
+
+TEST_CASE("Only the GetRenderInfo() that returns a new vector allocates",
+          "[allocation]") {
+    TestRenderManager rm(nullParameters(0));
+    REQUIRE(rm.OpenDisplay().status == RenderManager::COMPLETE);
+    RenderManager::RenderParams params;
+    std::vector<RenderInfo> info;
+    REQUIRE(rm.GetRenderInfo(params, info) == 2);
+
+    size_t reused, returned;
+    {
+        AllocationCounter counter;
+        rm.GetRenderInfo(params, info);
+        reused = counter.count();
+        info = rm.GetRenderInfo(params);
+        returned = counter.count() - reused;
+    }
+    CHECK(reused == 0);
+    CHECK(returned > 0);
+}
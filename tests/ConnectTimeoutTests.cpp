@@ -0,0 +1,80 @@
+/** @file
+@brief Tests of createRenderManager() giving up on a server that does not
+send its configuration.
+
+@date 2026
+
+@author
+Sensics, Inc.
+<http://sensics.com/osvr>
+*/
+
+// Copyright 2026 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Internal Includes
+#include "RenderManager.h"
+
+// Library/third-party includes
+#include <catch2/catch.hpp>
+
+// Standard includes
+#include <chrono>
+#include <cstdlib>
+
+using namespace osvr::renderkit;
+
+typedef std::chrono::steady_clock Clock;
+
+/// Set or clear the connect-timeout environment variable.
+static void setTimeoutVariable(const char* value) {
+    const char* name = "OSVR_RENDERMANAGER_CONNECT_TIMEOUT";
+#ifdef _WIN32
+    _putenv_s(name, (value != nullptr) ? value : "");
+#else
+    if (value != nullptr) {
+        setenv(name, value, 1);
+    } else {
+        unsetenv(name);
+    }
+#endif
+}
+
+/// Seconds that creating a RenderManager took to give up, with no server
+/// to hear from.
+static double secondsToGiveUp(double connectTimeoutSeconds) {
+    Clock::time_point start = Clock::now();
+    RenderManager* rm = createRenderManager(nullptr, "Null", GraphicsLibrary(),
+                                            connectTimeoutSeconds);
+    CHECK(rm == nullptr);
+    delete rm;
+    return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+TEST_CASE("createRenderManager() gives up after the timeout it is given",
+          "[connect]") {
+    setTimeoutVariable(nullptr);
+    double seconds = secondsToGiveUp(0.05);
+    CHECK(seconds >= 0.05);
+    CHECK(seconds < 2);
+}
+
+TEST_CASE("The connect-timeout environment variable overrides the caller",
+          "[connect]") {
+    setTimeoutVariable("0.05");
+    double seconds = secondsToGiveUp(60);
+    setTimeoutVariable(nullptr);
+    CHECK(seconds >= 0.05);
+    CHECK(seconds < 2);
+}
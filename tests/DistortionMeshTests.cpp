@@ -0,0 +1,116 @@
+/** @file
+@brief Tests of computing distortion meshes from point samples.
+
+@date 2026
+
+@author
+Sensics, Inc.
+<http://sensics.com/osvr>
+*/
+
+// Copyright 2026 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Internal Includes
+#include "TestRenderManager.h"
+
+// Library/third-party includes
+#include <catch2/catch.hpp>
+
+// Standard includes
+#include <memory>
+#include <vector>
+
+using namespace osvr::renderkit;
+using namespace osvr::renderkit::test;
+
+typedef RenderManager::DistortionParameters DistortionParameters;
+typedef TestRenderManager::DistortionMesh DistortionMesh;
+
+/// A grid of points for each of two eyes, squeezing the image toward the
+/// middle and shifting the second eye's to the right.
+static MonoPointDistortionMeshDescriptions gridSamples() {
+    MonoPointDistortionMeshDescriptions eyes(2);
+    for (size_t eye = 0; eye < 2; eye++) {
+        for (int y = 0; y <= 4; y++) {
+            for (int x = 0; x <= 4; x++) {
+                double fromX = x / 4.0;
+                double fromY = y / 4.0;
+                eyes[eye].push_back({{{{fromX, fromY}},
+                                      {{0.05 + 0.9 * fromX + 0.02 * eye,
+                                        0.05 + 0.9 * fromY}}}});
+            }
+        }
+    }
+    return eyes;
+}
+
+TEST_CASE("Meshes from the nested-vector samples match the shared ones",
+          "[distortionMesh]") {
+    TestRenderManager rm(nullParameters(0));
+    MonoPointDistortionMeshDescriptions described = gridSamples();
+
+    DistortionParameters nested;
+    nested.m_type = DistortionParameters::mono_point_samples;
+    nested.m_desiredTriangles = 200;
+    DistortionParameters shared = nested;
+    nested.m_monoPointSamples = described;
+    for (const MonoPointDistortionMeshDescription& eye : described) {
+        shared.m_monoPointMeshSamples.push_back(
+            MonoPointDistortionMeshSamplesPtr(
+                new MonoPointDistortionMeshSamples(eye)));
+    }
+
+    DistortionParameters undistorted;
+    undistorted.m_desiredTriangles = nested.m_desiredTriangles;
+
+    std::vector<DistortionMesh> fromNested, fromShared, plain;
+    REQUIRE(rm.ComputeDistortionMeshes(
+        RenderManager::SQUARE, std::vector<DistortionParameters>(2, nested),
+        fromNested));
+    REQUIRE(rm.ComputeDistortionMeshes(
+        RenderManager::SQUARE, std::vector<DistortionParameters>(2, shared),
+        fromShared));
+    REQUIRE(rm.ComputeDistortionMeshes(
+        RenderManager::SQUARE,
+        std::vector<DistortionParameters>(2, undistorted), plain));
+
+    REQUIRE(fromNested.size() == 2);
+    REQUIRE(fromShared.size() == 2);
+    size_t different = 0;
+    size_t moved = 0;
+    for (size_t eye = 0; eye < 2; eye++) {
+        REQUIRE(fromNested[eye].vertices.size() > 4);
+        REQUIRE(fromNested[eye].vertices.size() ==
+                fromShared[eye].vertices.size());
+        REQUIRE(fromNested[eye].vertices.size() ==
+                plain[eye].vertices.size());
+        CHECK(fromNested[eye].indices == fromShared[eye].indices);
+        for (size_t i = 0; i < fromNested[eye].vertices.size(); i++) {
+            const auto& a = fromNested[eye].vertices[i];
+            const auto& b = fromShared[eye].vertices[i];
+            if ((a.m_pos != b.m_pos) || (a.m_texRed != b.m_texRed) ||
+                (a.m_texGreen != b.m_texGreen) ||
+                (a.m_texBlue != b.m_texBlue)) {
+                different++;
+            }
+            if (a.m_texGreen != plain[eye].vertices[i].m_texGreen) {
+                moved++;
+            }
+        }
+    }
+    CHECK(different == 0);
+    // The samples were used, rather than an undistorted mesh being made.
+    CHECK(moved > 0);
+}
@@ -0,0 +1,175 @@
+/** @file
+@brief Tests of the dynamic render-resolution controller on the Null
+RenderManager.
+
+@date 2026
+
+@author
+Sensics, Inc.
+<http://sensics.com/osvr>
+*/
+
+// Copyright 2026 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Internal Includes
+#include "TestRenderManager.h"
+
+// Library/third-party includes
+#include <catch2/catch.hpp>
+
+// Standard includes
+#include <cmath>
+#include <vector>
+
+using namespace osvr::renderkit;
+using namespace osvr::renderkit::test;
+
+/// Refresh interval of the simulated display, in seconds.
+static const double INTERVAL = 0.01;
+
+/// Report frames that kept us busy for the given fraction of a refresh.
+static void frames(TestRenderManager& rm, unsigned count, double load,
+                   bool missedRetrace = false) {
+    for (unsigned i = 0; i < count; i++) {
+        rm.UpdateDynamicResolutionInternal(load * INTERVAL, missedRetrace);
+    }
+}
+
+TEST_CASE("Dynamic resolution shrinks after a few slow frames",
+          "[dynamicResolution]") {
+    TestRenderManager rm(nullParameters(1 / INTERVAL));
+    REQUIRE(rm.OpenDisplay().status == RenderManager::COMPLETE);
+    REQUIRE(rm.SetDynamicResolution(true, 0.5f, 1.0f));
+    CHECK(rm.GetDynamicResolutionScale() == 1.0f);
+
+    // Two frames over budget are not enough.
+    frames(rm, 2, 0.95);
+    CHECK(rm.GetDynamicResolutionScale() == 1.0f);
+
+    // The third shrinks by enough to bring the load to its target, since
+    // the cost goes as the number of pixels.
+    frames(rm, 1, 0.95);
+    CHECK(rm.GetDynamicResolutionScale() ==
+          Approx(std::sqrt(0.8 / 0.95)).epsilon(1e-5));
+
+    // A much slower frame is limited to the largest step.
+    frames(rm, 3, 2.0);
+    CHECK(rm.GetDynamicResolutionScale() ==
+          Approx(std::sqrt(0.8 / 0.95) * 0.8).epsilon(1e-5));
+}
+
+TEST_CASE("Dynamic resolution ignores frames in its dead band",
+          "[dynamicResolution]") {
+    TestRenderManager rm(nullParameters(1 / INTERVAL));
+    REQUIRE(rm.OpenDisplay().status == RenderManager::COMPLETE);
+    REQUIRE(rm.SetDynamicResolution(true, 0.5f, 1.0f));
+
+    // A frame between the thresholds restarts the count of slow frames.
+    frames(rm, 2, 0.95);
+    frames(rm, 1, 0.8);
+    frames(rm, 2, 0.95);
+    CHECK(rm.GetDynamicResolutionScale() == 1.0f);
+    frames(rm, 1, 0.95);
+    CHECK(rm.GetDynamicResolutionScale() < 1.0f);
+
+    // And of fast frames.
+    float scale = rm.GetDynamicResolutionScale();
+    frames(rm, 44, 0.3);
+    frames(rm, 1, 0.7);
+    frames(rm, 44, 0.3);
+    CHECK(rm.GetDynamicResolutionScale() == scale);
+}
+
+TEST_CASE("Dynamic resolution grows slowly and only up to its maximum",
+          "[dynamicResolution]") {
+    TestRenderManager rm(nullParameters(1 / INTERVAL));
+    REQUIRE(rm.OpenDisplay().status == RenderManager::COMPLETE);
+    REQUIRE(rm.SetDynamicResolution(true, 0.5f, 0.9f));
+    CHECK(rm.GetDynamicResolutionScale() == 0.9f);
+    frames(rm, 3, 0.95);
+    float shrunk = rm.GetDynamicResolutionScale();
+    REQUIRE(shrunk < 0.9f);
+
+    // It takes 45 fast frames to grow, by at most 10%.
+    frames(rm, 44, 0.3);
+    CHECK(rm.GetDynamicResolutionScale() == shrunk);
+    frames(rm, 1, 0.3);
+    CHECK(rm.GetDynamicResolutionScale() ==
+          Approx(std::min(shrunk * 1.1, 0.9)).epsilon(1e-5));
+
+    // It never goes above the maximum.
+    frames(rm, 45 * 4, 0.3);
+    CHECK(rm.GetDynamicResolutionScale() == 0.9f);
+}
+
+TEST_CASE("Dynamic resolution never goes below its minimum",
+          "[dynamicResolution]") {
+    TestRenderManager rm(nullParameters(1 / INTERVAL));
+    REQUIRE(rm.OpenDisplay().status == RenderManager::COMPLETE);
+    REQUIRE(rm.SetDynamicResolution(true, 0.6f, 1.0f));
+    frames(rm, 3 * 20, 3.0);
+    CHECK(rm.GetDynamicResolutionScale() == 0.6f);
+}
+
+TEST_CASE("Missed retraces count against the resolution",
+          "[dynamicResolution]") {
+    TestRenderManager rm(nullParameters(1 / INTERVAL));
+    REQUIRE(rm.OpenDisplay().status == RenderManager::COMPLETE);
+    REQUIRE(rm.SetDynamicResolution(true, 0.5f, 1.0f));
+
+    // Even when the frames themselves were quick.
+    frames(rm, 3, 0.5, true);
+    float scale = rm.GetDynamicResolutionScale();
+    CHECK(scale < 1.0f);
+    CHECK(scale >= 0.8f * 0.999f);
+}
+
+TEST_CASE("Dynamic resolution bounds are checked", "[dynamicResolution]") {
+    TestRenderManager rm(nullParameters(1 / INTERVAL));
+    REQUIRE(rm.OpenDisplay().status == RenderManager::COMPLETE);
+    CHECK_FALSE(rm.SetDynamicResolution(true, 0.0f, 1.0f));
+    CHECK_FALSE(rm.SetDynamicResolution(true, 0.5f, 1.5f));
+    CHECK_FALSE(rm.SetDynamicResolution(true, 0.8f, 0.5f));
+    CHECK_FALSE(rm.m_dynamicResolution.enabled);
+
+    // Turning it off goes back to full resolution.
+    REQUIRE(rm.SetDynamicResolution(true, 0.5f, 1.0f));
+    frames(rm, 3, 0.95);
+    REQUIRE(rm.GetDynamicResolutionScale() < 1.0f);
+    REQUIRE(rm.SetDynamicResolution(false));
+    CHECK(rm.GetDynamicResolutionScale() == 1.0f);
+    frames(rm, 3, 0.95);
+    CHECK(rm.GetDynamicResolutionScale() == 1.0f);
+}
+
+TEST_CASE("Render viewports are scaled down with the resolution",
+          "[dynamicResolution]") {
+    TestRenderManager rm(nullParameters(1 / INTERVAL));
+    REQUIRE(rm.OpenDisplay().status == RenderManager::COMPLETE);
+    RenderManager::RenderParams params;
+    std::vector<RenderInfo> full, scaled;
+    REQUIRE(rm.GetRenderInfo(params, full) == 2);
+
+    REQUIRE(rm.SetDynamicResolution(true, 0.5f, 0.75f));
+    REQUIRE(rm.GetRenderInfo(params, scaled) == 2);
+    for (size_t eye = 0; eye < full.size(); eye++) {
+        const OSVR_ViewportDescription& f = full[eye].viewport;
+        const OSVR_ViewportDescription& s = scaled[eye].viewport;
+        CHECK(s.left == f.left);
+        CHECK(s.lower == f.lower);
+        CHECK(s.width == std::floor(f.width * 0.75));
+        CHECK(s.height == std::floor(f.height * 0.75));
+    }
+}
@@ -0,0 +1,151 @@
+/** @file
+@brief Tests of missed-refresh classification on the Null RenderManager.
+
+@date 2026
+
+@author
+Sensics, Inc.
+<http://sensics.com/osvr>
+*/
+
+// Copyright 2026 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Internal Includes
+#include "TestRenderManager.h"
+
+// Library/third-party includes
+#include <catch2/catch.hpp>
+
+// Standard includes
+#include <chrono>
+#include <thread>
+#include <vector>
+
+using namespace osvr::renderkit;
+using namespace osvr::renderkit::test;
+
+/// Frame drops reported to the callback.
+struct Drops {
+    std::vector<FrameDropType> types;
+    std::vector<uint64_t> frames;
+};
+
+static void recordDrop(void* userData, FrameDropType type, uint64_t frame) {
+    Drops* drops = static_cast<Drops*>(userData);
+    drops->types.push_back(type);
+    drops->frames.push_back(frame);
+}
+
+TEST_CASE("Missed refreshes are blamed on the late stage", "[frameDrops]") {
+    RenderManager::ConstructorParameters p = nullParameters(0);
+    p.m_enableTimeWarp = true;
+    TestRenderManager rm(p);
+    Drops drops;
+    REQUIRE(rm.SetFrameDropCallback(recordDrop, &drops));
+
+    // The present was aiming for the retrace 10 ms after the previous one
+    // and takes 2 ms, so each stage had to be done by 8 ms.
+    OSVR_TimeValue previous;
+    osvrTimeValueGetNow(&previous);
+    rm.m_framePacing.refreshInterval = 0.01;
+    rm.m_framePacing.presentSeconds = 0.002;
+    rm.m_frameTiming.frames = 5;
+    FrameTimingRecord& timing = rm.m_frameTiming.current;
+    timing = FrameTimingRecord();
+
+    // The application handed the frame over too late.
+    timing.presentEntry = offsetTime(previous, 0.009);
+    timing.warpComputed = offsetTime(previous, 0.0095);
+    rm.ClassifyMissedRetraceInternal(previous);
+
+    // Time warp finished too late.
+    timing.presentEntry = offsetTime(previous, 0.005);
+    timing.warpComputed = offsetTime(previous, 0.009);
+    rm.ClassifyMissedRetraceInternal(previous);
+
+    // Everything was in time, so the present itself was too slow.
+    timing.warpComputed = offsetTime(previous, 0.006);
+    rm.ClassifyMissedRetraceInternal(previous);
+
+    // Re-presenting an old frame is never the application's fault.
+    timing.repeat = true;
+    timing.presentEntry = offsetTime(previous, 0.009);
+    rm.ClassifyMissedRetraceInternal(previous);
+
+    REQUIRE(drops.types.size() == 4);
+    CHECK(drops.types[0] == FRAME_DROP_APP);
+    CHECK(drops.types[1] == FRAME_DROP_LATE_WARP);
+    CHECK(drops.types[2] == FRAME_DROP_COMPOSITOR);
+    CHECK(drops.types[3] == FRAME_DROP_COMPOSITOR);
+    for (uint64_t frame : drops.frames) {
+        CHECK(frame == 4);
+    }
+
+    FrameDropStats stats;
+    REQUIRE(rm.GetFrameDropStats(stats));
+    CHECK(stats.appMisses == 1);
+    CHECK(stats.lateWarps == 1);
+    CHECK(stats.compositorMisses == 2);
+
+    rm.ResetFrameDropStats();
+    REQUIRE(rm.GetFrameDropStats(stats));
+    CHECK(stats.presents == 0);
+    CHECK(stats.appMisses == 0);
+    CHECK(stats.lateWarps == 0);
+    CHECK(stats.compositorMisses == 0);
+}
+
+TEST_CASE("Late warps are only blamed when time warping", "[frameDrops]") {
+    TestRenderManager rm(nullParameters(0));
+    OSVR_TimeValue previous;
+    osvrTimeValueGetNow(&previous);
+    rm.m_framePacing.refreshInterval = 0.01;
+    rm.m_framePacing.presentSeconds = 0.002;
+    FrameTimingRecord& timing = rm.m_frameTiming.current;
+    timing = FrameTimingRecord();
+    timing.presentEntry = offsetTime(previous, 0.005);
+    timing.warpComputed = offsetTime(previous, 0.009);
+    rm.ClassifyMissedRetraceInternal(previous);
+
+    FrameDropStats stats;
+    REQUIRE(rm.GetFrameDropStats(stats));
+    CHECK(stats.lateWarps == 0);
+    CHECK(stats.compositorMisses == 1);
+}
+
+TEST_CASE("A late application frame is counted as a drop", "[frameDrops]") {
+    TestRenderManager rm(nullParameters(100));
+    REQUIRE(rm.OpenDisplay().status == RenderManager::COMPLETE);
+    REQUIRE(rm.RegisterRenderBuffers(std::vector<RenderBuffer>(2)));
+    Drops drops;
+    REQUIRE(rm.SetFrameDropCallback(recordDrop, &drops));
+    Frame frame;
+
+    // Presents block until a retrace, which lets us learn the refresh
+    // interval; then one comes a few refreshes late.
+    for (int i = 0; i < 5; i++) {
+        REQUIRE(presentFrame(rm, frame));
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(25));
+    REQUIRE(presentFrame(rm, frame));
+
+    FrameDropStats stats;
+    REQUIRE(rm.GetFrameDropStats(stats));
+    CHECK(stats.presents == 6);
+    CHECK(stats.appMisses >= 1);
+    REQUIRE_FALSE(drops.types.empty());
+    CHECK(drops.types.back() == FRAME_DROP_APP);
+    CHECK(drops.frames.back() == 5);
+}
@@ -0,0 +1,237 @@
+/** @file
+@brief Tests of frame pacing and retrace prediction on the Null
+RenderManager.
+
+@date 2026
+
+@author
+Sensics, Inc.
+<http://sensics.com/osvr>
+*/
+
+// Copyright 2026 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Internal Includes
+#include "TestRenderManager.h"
+
+// Library/third-party includes
+#include <catch2/catch.hpp>
+
+// Standard includes
+#include <chrono>
+#include <cmath>
+#include <thread>
+
+using namespace osvr::renderkit;
+using namespace osvr::renderkit::test;
+
+/// How far a time may be from where we expect it, given that the Null
+/// display's timing is reported in whole microseconds.
+static const double TIME_MARGIN = 1e-5;
+
+/// How many refresh intervals after the simulated display's first retrace
+/// a time is; a whole number for a predicted retrace.
+static double refreshesSinceFirst(TestRenderManager& rm,
+                                  const OSVR_TimeValue& t) {
+    return osvrTimeValueDurationSeconds(&t, &rm.m_firstRetrace) /
+           rm.m_refreshInterval;
+}
+
+TEST_CASE("Next retrace is predicted from the display timing",
+          "[pacing]") {
+    TestRenderManager rm(nullParameters(100));
+    REQUIRE(rm.OpenDisplay().status == RenderManager::COMPLETE);
+
+    OSVR_TimeValue now, next;
+    double interval;
+    osvrTimeValueGetNow(&now);
+    REQUIRE(rm.GetNextRetraceInternal(now, next, interval));
+    CHECK(interval == Approx(0.01).margin(TIME_MARGIN));
+    double until = osvrTimeValueDurationSeconds(&next, &now);
+    CHECK(until > 0);
+    CHECK(until <= 0.01 + TIME_MARGIN);
+    double refreshes = refreshesSinceFirst(rm, next);
+    CHECK(refreshes == Approx(std::round(refreshes)).margin(1e-3));
+}
+
+TEST_CASE("Refresh interval is estimated from completed presents",
+          "[pacing]") {
+    // With no display timing, the interval comes from the spacing of
+    // vertical-sync'ed presents.
+    TestRenderManager rm(nullParameters(0));
+    OSVR_TimeValue t0;
+    osvrTimeValueGetNow(&t0);
+
+    OSVR_TimeValue next;
+    double interval;
+    CHECK_FALSE(rm.GetNextRetraceInternal(t0, next, interval));
+
+    CHECK_FALSE(rm.RecordPresentTimingInternal(t0, 0.001));
+    CHECK(rm.m_framePacing.refreshInterval == 0);
+    CHECK_FALSE(rm.RecordPresentTimingInternal(offsetTime(t0, 0.011), 0.001));
+    CHECK(rm.m_framePacing.refreshInterval == Approx(0.011));
+    CHECK_FALSE(rm.RecordPresentTimingInternal(offsetTime(t0, 0.022), 0.001));
+    CHECK(rm.m_framePacing.refreshInterval == Approx(0.011));
+
+    // The next retrace follows the last present by whole intervals.
+    REQUIRE(rm.GetNextRetraceInternal(offsetTime(t0, 0.025), next, interval));
+    CHECK(interval == Approx(0.011));
+    CHECK(osvrTimeValueDurationSeconds(&next, &t0) ==
+          Approx(0.033).margin(TIME_MARGIN));
+
+    // A present three intervals after the last missed two retraces and
+    // does not disturb the estimate.
+    CHECK(rm.RecordPresentTimingInternal(offsetTime(t0, 0.055), 0.001));
+    CHECK(rm.m_framePacing.refreshInterval == Approx(0.011));
+
+    // Nor does one much too close to the last.
+    CHECK_FALSE(
+        rm.RecordPresentTimingInternal(offsetTime(t0, 0.0555), 0.001));
+    CHECK(rm.m_framePacing.refreshInterval == Approx(0.011));
+}
+
+TEST_CASE("Refresh interval is not estimated without vertical sync",
+          "[pacing]") {
+    RenderManager::ConstructorParameters p = nullParameters(0);
+    p.m_verticalSync = false;
+    TestRenderManager rm(p);
+    OSVR_TimeValue t0;
+    osvrTimeValueGetNow(&t0);
+    for (int i = 0; i < 4; i++) {
+        CHECK_FALSE(
+            rm.RecordPresentTimingInternal(offsetTime(t0, 0.01 * i), 0.001));
+    }
+    CHECK(rm.m_framePacing.refreshInterval == 0);
+}
+
+TEST_CASE("Frames shown for several refreshes aim at frame boundaries",
+          "[pacing]") {
+    TestRenderManager rm(nullParameters(0));
+    OSVR_TimeValue t0;
+    osvrTimeValueGetNow(&t0);
+    rm.m_framePacing.refreshInterval = 0.01;
+    rm.m_framePacing.lastPresentDone = t0;
+    rm.m_framePacing.refreshesPerFrame = 2;
+    OSVR_TimeValue now = offsetTime(t0, 0.001);
+    OSVR_TimeValue next;
+    double interval;
+
+    SECTION("Last present started a frame") {
+        // The next refresh repeats it, and the presenter picks up a new
+        // frame when that refresh's swap returns.
+        rm.m_framePacing.presentPhase = 0;
+        REQUIRE(rm.GetNextFrameRetraceInternal(now, next, interval));
+        CHECK(osvrTimeValueDurationSeconds(&next, &t0) ==
+              Approx(0.01).margin(TIME_MARGIN));
+        CHECK(interval == Approx(0.02));
+    }
+    SECTION("Last present repeated a frame") {
+        // A new frame was picked up when it returned, so the next chance
+        // is a whole frame later.
+        rm.m_framePacing.presentPhase = 1;
+        REQUIRE(rm.GetNextFrameRetraceInternal(now, next, interval));
+        CHECK(osvrTimeValueDurationSeconds(&next, &t0) ==
+              Approx(0.02).margin(TIME_MARGIN));
+        CHECK(interval == Approx(0.02));
+    }
+    SECTION("Every refresh shows a new frame") {
+        rm.m_framePacing.refreshesPerFrame = 1;
+        REQUIRE(rm.GetNextFrameRetraceInternal(now, next, interval));
+        CHECK(osvrTimeValueDurationSeconds(&next, &t0) ==
+              Approx(0.01).margin(TIME_MARGIN));
+        CHECK(interval == Approx(0.01));
+    }
+}
+
+TEST_CASE("Present lead covers the present and the time-warp window",
+          "[pacing]") {
+    RenderManager::ConstructorParameters p = nullParameters(0);
+    SECTION("Without time warp") {
+        TestRenderManager rm(p);
+        rm.m_framePacing.presentSeconds = 0.002;
+        CHECK(rm.FramePresentLeadSecondsInternal() == Approx(0.0025));
+    }
+    SECTION("With a time-warp window wider than the present") {
+        p.m_enableTimeWarp = true;
+        p.m_maxMSBeforeVsyncTimeWarp = 3;
+        TestRenderManager rm(p);
+        rm.m_framePacing.presentSeconds = 0.002;
+        CHECK(rm.FramePresentLeadSecondsInternal() == Approx(0.0035));
+    }
+}
+
+TEST_CASE("EndFrame() needs a matching BeginFrame()", "[pacing]") {
+    TestRenderManager rm(nullParameters(100));
+    REQUIRE(rm.OpenDisplay().status == RenderManager::COMPLETE);
+    CHECK_FALSE(rm.EndFrame());
+    CHECK(rm.BeginFrame());
+    CHECK(rm.EndFrame());
+    CHECK_FALSE(rm.EndFrame());
+}
+
+TEST_CASE("Frames are checked against their retrace deadline",
+          "[pacing]") {
+    TestRenderManager rm(nullParameters(100));
+    REQUIRE(rm.OpenDisplay().status == RenderManager::COMPLETE);
+    FramePacingInfo info;
+
+    // A frame that hands off right away makes the retrace BeginFrame()
+    // picked, which is far enough off to allow for its render time.
+    REQUIRE(rm.BeginFrame());
+    REQUIRE(rm.m_framePacing.haveTargetRetrace);
+    double refreshes =
+        refreshesSinceFirst(rm, rm.m_framePacing.targetRetrace);
+    CHECK(refreshes == Approx(std::round(refreshes)).margin(1e-3));
+    REQUIRE(rm.EndFrame());
+    REQUIRE(rm.GetFramePacingInfo(info));
+    CHECK(info.framesPaced == 1);
+    CHECK(info.missedDeadlines == 0);
+    CHECK_FALSE(info.lastFrameMissedDeadline);
+    CHECK(info.refreshIntervalSeconds == Approx(0.01).margin(TIME_MARGIN));
+
+    // One that takes three refreshes misses it.
+    REQUIRE(rm.BeginFrame());
+    std::this_thread::sleep_for(std::chrono::milliseconds(30));
+    REQUIRE(rm.EndFrame());
+    REQUIRE(rm.GetFramePacingInfo(info));
+    CHECK(info.framesPaced == 2);
+    CHECK(info.missedDeadlines == 1);
+    CHECK(info.lastFrameMissedDeadline);
+    CHECK(info.estimatedRenderSeconds > 0);
+}
+
+TEST_CASE("WaitForNextFrameStart() wakes one frame's lead before a retrace",
+          "[pacing]") {
+    TestRenderManager rm(nullParameters(100));
+    REQUIRE(rm.OpenDisplay().status == RenderManager::COMPLETE);
+
+    // Say that frames take more than a refresh to render, so the frame
+    // has to aim past the next retrace.
+    rm.m_framePacing.renderSeconds = 0.015;
+    double lead = 0.015 + rm.FramePresentLeadSecondsInternal();
+    OSVR_TimeValue before, woke;
+    osvrTimeValueGetNow(&before);
+    REQUIRE(rm.WaitForNextFrameStart());
+    osvrTimeValueGetNow(&woke);
+    REQUIRE(rm.BeginFrame());
+    REQUIRE(rm.m_framePacing.haveTargetRetrace);
+    const OSVR_TimeValue& target = rm.m_framePacing.targetRetrace;
+
+    CHECK(osvrTimeValueDurationSeconds(&target, &before) >= lead);
+    CHECK(osvrTimeValueDurationSeconds(&target, &woke) <= lead + TIME_MARGIN);
+    double refreshes = refreshesSinceFirst(rm, target);
+    CHECK(refreshes == Approx(std::round(refreshes)).margin(1e-3));
+    REQUIRE(rm.EndFrame());
+}
@@ -0,0 +1,165 @@
+/** @file
+@brief Tests of the frame-timing history and its percentiles on the Null
+RenderManager.
+
+@date 2026
+
+@author
+Sensics, Inc.
+<http://sensics.com/osvr>
+*/
+
+// Copyright 2026 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Internal Includes
+#include "TestRenderManager.h"
+#include "RenderManagerC.h"
+
+// Library/third-party includes
+#include <catch2/catch.hpp>
+
+// Standard includes
+#include <vector>
+
+using namespace osvr::renderkit;
+using namespace osvr::renderkit::test;
+
+/// Add a present to the history that took the given time from entry to
+/// swap return, with one eye submitted in the middle.
+static void publish(TestRenderManager& rm, const OSVR_TimeValue& start,
+                    double presentSeconds, double gpuSeconds = 0) {
+    FrameTimingRecord& r = rm.m_frameTiming.current;
+    r = FrameTimingRecord();
+    r.presentEntry = start;
+    r.vsyncWaitExit = start;
+    r.warpComputed = start;
+    r.numEyes = 1;
+    r.eyeSubmitStart[0] = start;
+    r.eyeSubmitEnd[0] = offsetTime(start, presentSeconds / 2);
+    r.swapReturn = offsetTime(start, presentSeconds);
+    r.gpuPresentSeconds = gpuSeconds;
+    rm.PublishFrameTimingInternal();
+}
+
+TEST_CASE("Frame-timing percentiles", "[frameTiming]") {
+    TestRenderManager rm(nullParameters(0));
+    FrameTimingStats stats;
+    CHECK_FALSE(rm.GetFrameTimingStats(stats));
+    CHECK(stats.frames == 0);
+
+    // Presents of 1 to 100 ms, published in a scrambled order.
+    OSVR_TimeValue start;
+    osvrTimeValueGetNow(&start);
+    for (int i = 0; i < 100; i++) {
+        int ms = 1 + (i * 37) % 100;
+        publish(rm, start, ms * 1e-3, (i % 2) ? ms * 1e-4 : 0);
+    }
+    REQUIRE(rm.GetFrameTimingStats(stats));
+    CHECK(stats.frames == 100);
+
+    // The percentile is the nearest-ranked value.
+    const double margin = 2e-6;
+    CHECK(stats.presentSeconds.p50 == Approx(0.051).margin(margin));
+    CHECK(stats.presentSeconds.p90 == Approx(0.090).margin(margin));
+    CHECK(stats.presentSeconds.p99 == Approx(0.099).margin(margin));
+    CHECK(stats.presentSeconds.max == Approx(0.100).margin(margin));
+    CHECK(stats.swapSeconds.max == Approx(0.050).margin(margin));
+    CHECK(stats.vsyncWaitSeconds.max == 0);
+    CHECK(stats.warpSeconds.max == 0);
+
+    // Only presents that were timed on the GPU count towards its stats,
+    // and no pose was latched for time warp.
+    CHECK(stats.gpuPresentSeconds.max == Approx(0.0100).margin(margin));
+    CHECK(stats.gpuPresentSeconds.p50 > 0);
+    CHECK(stats.poseToSwapSeconds.max == 0);
+}
+
+TEST_CASE("Frame-timing history keeps the most-recent records",
+          "[frameTiming]") {
+    TestRenderManager rm(nullParameters(0));
+    const size_t history = TestRenderManager::FrameTimingState::HISTORY;
+    OSVR_TimeValue start;
+    osvrTimeValueGetNow(&start);
+    for (size_t i = 0; i < history + 44; i++) {
+        publish(rm, start, 1e-3);
+    }
+
+    std::vector<FrameTimingRecord> records(history + 10);
+    size_t numRecords;
+    REQUIRE(rm.GetFrameTimingRecords(records.data(), records.size(),
+                                     numRecords));
+    REQUIRE(numRecords == history);
+    CHECK(records[0].frame == 44);
+    CHECK(records[history - 1].frame == history + 43);
+
+    // Asking for fewer gets the newest, oldest first.
+    REQUIRE(rm.GetFrameTimingRecords(records.data(), 10, numRecords));
+    REQUIRE(numRecords == 10);
+    for (size_t i = 0; i < numRecords; i++) {
+        CHECK(records[i].frame == history + 34 + i);
+    }
+
+    FrameTimingStats stats;
+    REQUIRE(rm.GetFrameTimingStats(stats));
+    CHECK(stats.frames == history);
+
+    // A NULL array is only allowed when asking for nothing.
+    CHECK(rm.GetFrameTimingRecords(nullptr, 0, numRecords));
+    CHECK(numRecords == 0);
+    CHECK_FALSE(rm.GetFrameTimingRecords(nullptr, 1, numRecords));
+
+    // The C API fills in the same records.
+    OSVR_RenderManager crm = reinterpret_cast<OSVR_RenderManager>(
+        static_cast<RenderManager*>(&rm));
+    std::vector<OSVR_FrameTimingRecord> cRecords(10);
+    REQUIRE(osvrRenderManagerGetFrameTimingRecords(
+                crm, cRecords.data(), cRecords.size(), &numRecords) ==
+            OSVR_RETURN_SUCCESS);
+    REQUIRE(numRecords == 10);
+    for (size_t i = 0; i < numRecords; i++) {
+        CHECK(cRecords[i].frame == history + 34 + i);
+        CHECK(cRecords[i].numEyes == 1);
+        CHECK(cRecords[i].repeat == OSVR_FALSE);
+    }
+    CHECK(osvrRenderManagerGetFrameTimingRecords(crm, nullptr, 1,
+                                                 &numRecords) ==
+          OSVR_RETURN_FAILURE);
+}
+
+TEST_CASE("Presents are recorded in the frame-timing history",
+          "[frameTiming]") {
+    TestRenderManager rm(nullParameters(0));
+    REQUIRE(rm.OpenDisplay().status == RenderManager::COMPLETE);
+    REQUIRE(rm.RegisterRenderBuffers(std::vector<RenderBuffer>(2)));
+    Frame frame;
+    for (int i = 0; i < 3; i++) {
+        REQUIRE(presentFrame(rm, frame));
+    }
+
+    FrameTimingRecord records[3];
+    size_t numRecords;
+    REQUIRE(rm.GetFrameTimingRecords(records, 3, numRecords));
+    REQUIRE(numRecords == 3);
+    for (size_t i = 0; i < numRecords; i++) {
+        const FrameTimingRecord& r = records[i];
+        CHECK(r.frame == i);
+        CHECK_FALSE(r.repeat);
+        CHECK(r.numEyes == 2);
+        CHECK_FALSE(osvrTimeValueGreater(&r.presentEntry, &r.vsyncWaitExit));
+        CHECK_FALSE(osvrTimeValueGreater(&r.warpComputed,
+                                         &r.eyeSubmitStart[0]));
+        CHECK_FALSE(osvrTimeValueGreater(&r.eyeSubmitEnd[1], &r.swapReturn));
+    }
+}
@@ -0,0 +1,264 @@
+/** @file
+@brief Tests of recording and replaying RenderManager's inputs.
+
+@date 2026
+
+@author
+Sensics, Inc.
+<http://sensics.com/osvr>
+*/
+
+// Copyright 2026 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Internal Includes
+#include "RenderManagerInputLog.h"
+
+// Library/third-party includes
+#include <catch2/catch.hpp>
+
+// Standard includes
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+using namespace osvr::renderkit;
+
+typedef InputLog::Stream Stream;
+static const Stream APP = InputLog::APPLICATION_STREAM;
+static const Stream PRESENT = InputLog::PRESENT_STREAM;
+
+/// A log file in the working directory that is removed when done with.
+class LogFile {
+  public:
+    explicit LogFile(const char* name) : m_name(name) {}
+    ~LogFile() { std::remove(m_name.c_str()); }
+    const std::string& name() const { return m_name; }
+
+    /// Replace the file's contents.
+    void write(const std::vector<char>& data) const {
+        std::ofstream f(m_name.c_str(), std::ios::binary | std::ios::trunc);
+        f.write(data.data(), data.size());
+    }
+
+    /// Read the file's contents.
+    std::vector<char> read() const {
+        std::ifstream f(m_name.c_str(), std::ios::binary);
+        return std::vector<char>((std::istreambuf_iterator<char>(f)),
+                                 std::istreambuf_iterator<char>());
+    }
+
+  private:
+    std::string m_name;
+};
+
+static OSVR_PoseState makePose(double x) {
+    OSVR_PoseState pose;
+    pose.translation.data[0] = x;
+    pose.translation.data[1] = 2 * x;
+    pose.translation.data[2] = 3 * x;
+    pose.rotation.data[0] = 0.5;
+    pose.rotation.data[1] = 0.5;
+    pose.rotation.data[2] = -0.5;
+    pose.rotation.data[3] = 0.5;
+    return pose;
+}
+
+static OSVR_TimeValue makeTime(OSVR_TimeValue_Seconds seconds,
+                               OSVR_TimeValue_Microseconds microseconds) {
+    OSVR_TimeValue t;
+    t.seconds = seconds;
+    t.microseconds = microseconds;
+    return t;
+}
+
+static bool samePose(const OSVR_PoseState& a, const OSVR_PoseState& b) {
+    for (size_t i = 0; i < 3; i++) {
+        if (a.translation.data[i] != b.translation.data[i]) {
+            return false;
+        }
+    }
+    for (size_t i = 0; i < 4; i++) {
+        if (a.rotation.data[i] != b.rotation.data[i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/// Record a frame's worth of inputs: an update and parameters on the
+/// application's stream, a pose, a velocity, a clock reading, and the
+/// display timing on the presenter's.
+static void recordFrame(const std::string& fileName) {
+    std::unique_ptr<InputLog> log = InputLog::OpenForRecording(fileName);
+    REQUIRE(log);
+    CHECK_FALSE(log->Replaying());
+
+    OSVR_ReturnCode result = OSVR_RETURN_SUCCESS;
+    REQUIRE(log->ClientUpdate(APP, result));
+
+    RenderManager::RenderParams params;
+    OSVR_PoseState worldFromRoom = makePose(1);
+    params.worldFromRoomAppend = &worldFromRoom;
+    params.nearClipDistanceMeters = 0.25;
+    params.farClipDistanceMeters = 50;
+    params.IPDMeters = 0.061;
+    REQUIRE(log->Params(APP, params));
+
+    OSVR_TimeValue stamp = makeTime(100, 250000);
+    OSVR_PoseState pose = makePose(4);
+    log->Pose(APP, 0, result, stamp, pose);
+
+    OSVR_VelocityState velocity = {};
+    velocity.linearVelocity.data[0] = 0.5;
+    velocity.linearVelocityValid = true;
+    velocity.angularVelocity.dt = 0.01;
+    log->Velocity(APP, result, stamp, velocity);
+
+    OSVR_TimeValue now = makeTime(100, 260000);
+    log->Now(APP, now);
+
+    RenderTimingInfo info;
+    info.hardwareDisplayInterval = makeTime(0, 11111);
+    info.timeSincelastVerticalRetrace = makeTime(0, 2000);
+    info.timeUntilNextPresentRequired = makeTime(0, 6000);
+    bool valid = true;
+    log->TimingInfo(PRESENT, 1, valid, info);
+}
+
+TEST_CASE("Recorded inputs replay as they were recorded", "[inputLog]") {
+    LogFile file("InputLogTests-roundTrip.log");
+    recordFrame(file.name());
+
+    std::unique_ptr<InputLog> log = InputLog::OpenForReplay(file.name());
+    REQUIRE(log);
+    CHECK(log->Replaying());
+
+    // The presenter's stream replays independently of the application's.
+    RenderTimingInfo info = {};
+    bool valid = false;
+    log->TimingInfo(PRESENT, 1, valid, info);
+    CHECK(valid);
+    CHECK(info.hardwareDisplayInterval.microseconds == 11111);
+    CHECK(info.timeSincelastVerticalRetrace.microseconds == 2000);
+    CHECK(info.timeUntilNextPresentRequired.microseconds == 6000);
+
+    OSVR_ReturnCode result = OSVR_RETURN_FAILURE;
+    CHECK(log->ClientUpdate(APP, result));
+    CHECK(result == OSVR_RETURN_SUCCESS);
+
+    RenderManager::RenderParams params;
+    REQUIRE(log->Params(APP, params));
+    REQUIRE(params.worldFromRoomAppend != nullptr);
+    CHECK(samePose(*params.worldFromRoomAppend, makePose(1)));
+    CHECK(params.roomFromHeadReplace == nullptr);
+    CHECK(params.nearClipDistanceMeters == 0.25);
+    CHECK(params.farClipDistanceMeters == 50);
+    CHECK(params.IPDMeters == 0.061);
+
+    OSVR_TimeValue stamp = {};
+    OSVR_PoseState pose = makePose(0);
+    result = OSVR_RETURN_FAILURE;
+    log->Pose(APP, 0, result, stamp, pose);
+    CHECK(result == OSVR_RETURN_SUCCESS);
+    CHECK(samePose(pose, makePose(4)));
+
+    OSVR_VelocityState velocity = {};
+    log->Velocity(APP, result, stamp, velocity);
+    CHECK(velocity.linearVelocity.data[0] == 0.5);
+    CHECK(velocity.linearVelocityValid);
+    CHECK(velocity.angularVelocity.dt == 0.01);
+
+    // Times are shifted to the replay's clock, keeping their spacing.
+    OSVR_TimeValue now = {};
+    log->Now(APP, now);
+    CHECK(osvrTimeValueDurationSeconds(&now, &stamp) == Approx(0.01));
+
+    // After that, the log has run out.
+    CHECK_FALSE(log->ClientUpdate(APP, result));
+}
+
+TEST_CASE("A truncated input log replays up to the damage", "[inputLog]") {
+    LogFile file("InputLogTests-truncated.log");
+    {
+        std::unique_ptr<InputLog> log =
+            InputLog::OpenForRecording(file.name());
+        REQUIRE(log);
+        OSVR_ReturnCode result = OSVR_RETURN_SUCCESS;
+        REQUIRE(log->ClientUpdate(APP, result));
+        result = OSVR_RETURN_FAILURE;
+        REQUIRE(log->ClientUpdate(APP, result));
+    }
+    std::vector<char> data = file.read();
+    data.resize(data.size() - 3);
+    file.write(data);
+
+    std::unique_ptr<InputLog> log = InputLog::OpenForReplay(file.name());
+    REQUIRE(log);
+    OSVR_ReturnCode result = OSVR_RETURN_FAILURE;
+    CHECK(log->ClientUpdate(APP, result));
+    CHECK(result == OSVR_RETURN_SUCCESS);
+    CHECK_FALSE(log->ClientUpdate(APP, result));
+}
+
+TEST_CASE("Replay stops when the log does not match the inputs read",
+          "[inputLog]") {
+    LogFile file("InputLogTests-mismatched.log");
+    recordFrame(file.name());
+
+    SECTION("Wrong kind of entry") {
+        std::unique_ptr<InputLog> log = InputLog::OpenForReplay(file.name());
+        REQUIRE(log);
+        RenderManager::RenderParams params;
+        CHECK_FALSE(log->Params(APP, params));
+        CHECK(params.worldFromRoomAppend == nullptr);
+
+        // And does not start again.
+        OSVR_ReturnCode result = OSVR_RETURN_FAILURE;
+        CHECK_FALSE(log->ClientUpdate(APP, result));
+    }
+    SECTION("Wrong index") {
+        std::unique_ptr<InputLog> log = InputLog::OpenForReplay(file.name());
+        REQUIRE(log);
+        RenderTimingInfo info = {};
+        bool valid = false;
+        log->TimingInfo(PRESENT, 0, valid, info);
+        CHECK_FALSE(valid);
+        OSVR_ReturnCode result = OSVR_RETURN_FAILURE;
+        CHECK_FALSE(log->ClientUpdate(APP, result));
+    }
+}
+
+TEST_CASE("Files that are not input logs are rejected", "[inputLog]") {
+    LogFile file("InputLogTests-invalid.log");
+    CHECK_FALSE(InputLog::OpenForReplay(file.name()));
+
+    std::vector<char> data = {'O', 'S', 'V', 'R'};
+    file.write(data);
+    CHECK_FALSE(InputLog::OpenForReplay(file.name()));
+
+    recordFrame(file.name());
+    data = file.read();
+    data[0] = 'X';
+    file.write(data);
+    CHECK_FALSE(InputLog::OpenForReplay(file.name()));
+
+    // The version follows the magic number.
+    data[0] = 'O';
+    data[8]++;
+    file.write(data);
+    CHECK_FALSE(InputLog::OpenForReplay(file.name()));
+}
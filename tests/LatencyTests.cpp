@@ -0,0 +1,144 @@
+/** @file
+@brief Tests of the motion-to-photon latency histograms on the Null
+RenderManager.
+
+@date 2026
+
+@author
+Sensics, Inc.
+<http://sensics.com/osvr>
+*/
+
+// Copyright 2026 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Internal Includes
+#include "TestRenderManager.h"
+
+// Library/third-party includes
+#include <catch2/catch.hpp>
+
+// Standard includes
+#include <vector>
+
+using namespace osvr::renderkit;
+using namespace osvr::renderkit::test;
+
+typedef TestRenderManager::LatencyHistogram Histogram;
+
+TEST_CASE("Latencies are counted in 250 microsecond buckets", "[latency]") {
+    Histogram h;
+    h.clear();
+    h.add(0);
+    h.add(249);
+    h.add(250);
+    h.add(1000);
+    h.add(Histogram::BUCKETS * Histogram::BUCKET_MICROSECONDS - 1);
+    h.add(Histogram::BUCKETS * Histogram::BUCKET_MICROSECONDS);
+    h.add(1000000);
+
+    CHECK(h.counts[0] == 2);
+    CHECK(h.counts[1] == 1);
+    CHECK(h.counts[4] == 1);
+    // The last bucket counts everything beyond it too.
+    CHECK(h.counts[Histogram::BUCKETS - 1] == 3);
+    CHECK(h.samples == 7);
+    CHECK(h.maxMicroseconds == 1000000);
+    CHECK(h.sumMicroseconds == 0 + 249 + 250 + 1000 + 63999 + 64000 +
+                                   1000000);
+
+    h.clear();
+    CHECK(h.samples == 0);
+    CHECK(h.counts[0] == 0);
+}
+
+TEST_CASE("Latency percentiles are bucket upper edges capped at the maximum",
+          "[latency]") {
+    TestRenderManager rm(nullParameters(0));
+    Histogram& h = rm.m_latency.histograms[1][LATENCY_APP_POSE];
+    for (int i = 0; i < 90; i++) {
+        h.add(1100);
+    }
+    for (int i = 0; i < 10; i++) {
+        h.add(5100);
+    }
+
+    LatencyStats stats;
+    REQUIRE(rm.GetMotionToPhotonLatency(1, LATENCY_APP_POSE, stats));
+    CHECK(stats.samples == 100);
+    CHECK(stats.meanSeconds == Approx(1500e-6));
+    CHECK(stats.p50Seconds == Approx(1250e-6));
+    CHECK(stats.p90Seconds == Approx(1250e-6));
+    CHECK(stats.p99Seconds == Approx(5100e-6));
+    CHECK(stats.maxSeconds == Approx(5100e-6));
+
+    // The other pose source and the other eyes are separate.
+    REQUIRE(rm.GetMotionToPhotonLatency(1, LATENCY_TIME_WARP_POSE, stats));
+    CHECK(stats.samples == 0);
+    REQUIRE(rm.GetMotionToPhotonLatency(0, LATENCY_APP_POSE, stats));
+    CHECK(stats.samples == 0);
+
+    std::vector<uint64_t> counts;
+    double bucketSeconds;
+    REQUIRE(rm.GetMotionToPhotonHistogram(1, LATENCY_APP_POSE, counts,
+                                          bucketSeconds));
+    CHECK(counts.size() == Histogram::BUCKETS);
+    CHECK(bucketSeconds == Approx(250e-6));
+    CHECK(counts[4] == 90);
+    CHECK(counts[20] == 10);
+
+    rm.ResetMotionToPhotonLatency();
+    REQUIRE(rm.GetMotionToPhotonLatency(1, LATENCY_APP_POSE, stats));
+    CHECK(stats.samples == 0);
+    CHECK(stats.p99Seconds == 0);
+}
+
+TEST_CASE("The newest of several matching poses gives the app-pose latency",
+          "[latency]") {
+    TestRenderManager rm(nullParameters(0));
+    rm.m_params.m_verticalSyncBlocksRendering = true;
+
+    // A still head: every pose handed out is the same, from tracker
+    // reports 10 ms apart, more of them than the history holds.
+    OSVR_TimeValue base = {1000, 0};
+    std::vector<RenderInfo> info(2);
+    rm.m_headPoseTimestampValid = true;
+    for (int i = 0; i < 10; i++) {
+        rm.m_headPoseTimestamp = offsetTime(base, i * 0.01);
+        rm.RecordPoseTimestampsInternal(info);
+    }
+
+    // Swapped 10 ms after the newest report.
+    rm.RecordMotionToPhotonInternal(info, false, OSVR_TimeValue(),
+                                    offsetTime(base, 0.1));
+    LatencyStats stats;
+    for (size_t eye = 0; eye < 2; eye++) {
+        REQUIRE(rm.GetMotionToPhotonLatency(eye, LATENCY_APP_POSE, stats));
+        CHECK(stats.samples == 1);
+        CHECK(stats.maxSeconds == Approx(0.01));
+    }
+}
+
+TEST_CASE("Latency requests out of range fail", "[latency]") {
+    TestRenderManager rm(nullParameters(0));
+    LatencyStats stats;
+    CHECK_FALSE(rm.GetMotionToPhotonLatency(FRAME_TIMING_MAX_EYES,
+                                            LATENCY_APP_POSE, stats));
+    CHECK_FALSE(rm.GetMotionToPhotonLatency(
+        0, static_cast<LatencySource>(2), stats));
+    std::vector<uint64_t> counts;
+    double bucketSeconds;
+    CHECK_FALSE(rm.GetMotionToPhotonHistogram(
+        FRAME_TIMING_MAX_EYES, LATENCY_APP_POSE, counts, bucketSeconds));
+}
@@ -0,0 +1,291 @@
+/** @file
+@brief Tests of the OpenGL RenderManager presenting offscreen through EGL,
+which runs without a display on a software renderer such as llvmpipe.
+
+@date 2026
+
+@author
+Sensics, Inc.
+<http://sensics.com/osvr>
+*/
+
+// Copyright 2026 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Internal Includes
+#include <GL/glew.h>
+#include "RenderManagerOpenGLOffscreen.h"
+#include "GraphicsLibraryOpenGL.h"
+#include "TestRenderManager.h"
+
+// Library/third-party includes
+#include <catch2/catch.hpp>
+
+// Standard includes
+#include <array>
+#include <cstdint>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace osvr::renderkit;
+using namespace osvr::renderkit::test;
+
+/// An offscreen OpenGL RenderManager that can be made directly, without a
+/// server.
+class TestOffscreenRenderManager : public RenderManagerOpenGLOffscreen {
+  public:
+    explicit TestOffscreenRenderManager(const ConstructorParameters& p)
+        : RenderManagerOpenGLOffscreen(nullptr, p) {}
+};
+
+/// What the displays looked like when they were handed to the application.
+struct Displays {
+    int width = 0;
+    int height = 0;
+    std::vector<uint8_t> pixels; //< RGBA, bottom row first
+    size_t presented = 0;
+
+    /// The color of a pixel, counting rows from the bottom.  Alpha is
+    /// left out because the display's is not defined.
+    std::array<uint8_t, 3> at(int x, int y) const {
+        const uint8_t* p = &pixels[4 * (y * width + x)];
+        return {{p[0], p[1], p[2]}};
+    }
+};
+
+static void readDisplay(void* userData, size_t /*display*/,
+                        GLuint /*framebuffer*/, GLuint /*colorTexture*/,
+                        int width, int height) {
+    Displays* d = static_cast<Displays*>(userData);
+    d->width = width;
+    d->height = height;
+    d->pixels.resize(4 * width * height);
+    glReadPixels(0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE,
+                 d->pixels.data());
+    d->presented++;
+}
+
+/// The captures handed to the application's captureCallback.
+struct Captures {
+    size_t count = 0;
+    int width = 0;
+    int height = 0;
+    std::array<uint8_t, 3> left = {{0, 0, 0}}; //< Color in the left eye
+};
+
+static void countCapture(void* userData, size_t /*display*/, int /*eye*/,
+                         const uint8_t* pixels, int width, int height) {
+    Captures* c = static_cast<Captures*>(userData);
+    c->width = width;
+    c->height = height;
+    const uint8_t* p = &pixels[4 * ((height / 2) * width + width / 4)];
+    c->left = {{p[0], p[1], p[2]}};
+    c->count++;
+}
+
+/// Parameters for a 64x32 side-by-side display presented offscreen.
+static RenderManager::ConstructorParameters
+offscreenParameters(GraphicsLibraryOpenGL& library) {
+    RenderManager::ConstructorParameters p = nullParameters(0, 64, 32);
+    p.m_renderLibrary = "OpenGLOffscreen";
+    p.m_graphicsLibrary.OpenGL = &library;
+    return p;
+}
+
+/// Make a texture of one color to render into.
+static GLuint makeTexture(int width, int height, uint8_t r, uint8_t g,
+                          uint8_t b) {
+    std::vector<uint8_t> pixels;
+    for (int i = 0; i < width * height; i++) {
+        pixels.insert(pixels.end(), {r, g, b, 255});
+    }
+    GLuint texture;
+    glGenTextures(1, &texture);
+    glBindTexture(GL_TEXTURE_2D, texture);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, width, height, 0, GL_RGBA,
+                 GL_UNSIGNED_BYTE, pixels.data());
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    glBindTexture(GL_TEXTURE_2D, 0);
+    return texture;
+}
+
+/// A red left eye and a green right one, registered with rm and ready to
+/// present in frame.
+class EyeTextures {
+  public:
+    EyeTextures(RenderManager& rm, Frame& frame) : m_textures(2) {
+        REQUIRE(rm.GetRenderInfo(frame.params, frame.info) == 2);
+        int width = static_cast<int>(frame.info[0].viewport.width);
+        int height = static_cast<int>(frame.info[0].viewport.height);
+        m_textures[0].colorBufferName = makeTexture(width, height, 255, 0, 0);
+        m_textures[1].colorBufferName = makeTexture(width, height, 0, 255, 0);
+        frame.buffers.resize(2);
+        for (size_t eye = 0; eye < 2; eye++) {
+            m_textures[eye].depthStencilBufferName = 0;
+            frame.buffers[eye].OpenGL = &m_textures[eye];
+        }
+        REQUIRE(rm.RegisterRenderBuffers(frame.buffers));
+    }
+
+    ~EyeTextures() {
+        for (RenderBufferOpenGL& t : m_textures) {
+            glDeleteTextures(1, &t.colorBufferName);
+        }
+    }
+
+  private:
+    std::vector<RenderBufferOpenGL> m_textures;
+};
+
+/// Collects what is written to std::cerr while it exists.
+class CapturedOutput {
+  public:
+    CapturedOutput() : m_old(std::cerr.rdbuf(m_text.rdbuf())) {}
+    ~CapturedOutput() { std::cerr.rdbuf(m_old); }
+    std::string text() const { return m_text.str(); }
+
+  private:
+    std::ostringstream m_text;
+    std::streambuf* m_old;
+};
+
+TEST_CASE("The offscreen OpenGL RenderManager presents a frame",
+          "[openGLOffscreen]") {
+    GraphicsLibraryOpenGL library;
+    Displays displays;
+    library.displayFramebufferCallback = readDisplay;
+    library.displayFramebufferUserData = &displays;
+    TestOffscreenRenderManager rm(offscreenParameters(library));
+    REQUIRE(rm.OpenDisplay().status == RenderManager::COMPLETE);
+    Frame frame;
+    EyeTextures textures(rm, frame);
+
+    REQUIRE(rm.PresentRenderBuffers(frame.buffers, frame.info, frame.params));
+    REQUIRE(displays.presented == 1);
+    REQUIRE(displays.width == 64);
+    REQUIRE(displays.height == 32);
+    std::array<uint8_t, 3> red = {{255, 0, 0}};
+    std::array<uint8_t, 3> green = {{0, 255, 0}};
+    CHECK(displays.at(16, 16) == red);
+    CHECK(displays.at(48, 16) == green);
+}
+
+TEST_CASE("The offscreen OpenGL RenderManager compiles its shaders on a "
+          "worker thread",
+          "[openGLOffscreen]") {
+    GraphicsLibraryOpenGL library;
+    Displays displays;
+    library.displayFramebufferCallback = readDisplay;
+    library.displayFramebufferUserData = &displays;
+    TestOffscreenRenderManager rm(offscreenParameters(library));
+    REQUIRE(rm.OpenDisplay().status == RenderManager::COMPLETE);
+
+    std::vector<StartupStageTiming> stages;
+    REQUIRE(rm.GetStartupTiming(stages));
+    const StartupStageTiming* compile = nullptr;
+    for (const StartupStageTiming& stage : stages) {
+        CHECK(stage.succeeded);
+        if (std::string(stage.name) == "CompileShaders") {
+            compile = &stage;
+        }
+    }
+    REQUIRE(compile != nullptr);
+    CHECK(compile->worker);
+
+    // The program linked in the other context draws in ours.
+    Frame frame;
+    EyeTextures textures(rm, frame);
+    REQUIRE(rm.PresentRenderBuffers(frame.buffers, frame.info, frame.params));
+    REQUIRE(displays.presented == 1);
+    std::array<uint8_t, 3> red = {{255, 0, 0}};
+    CHECK(displays.at(16, 16) == red);
+}
+
+TEST_CASE("Captures are handed over two presents after they are taken",
+          "[openGLOffscreen]") {
+    GraphicsLibraryOpenGL library;
+    Captures captures;
+    library.captureCallback = countCapture;
+    library.captureUserData = &captures;
+    RenderManager::ConstructorParameters p = offscreenParameters(library);
+    p.m_captureBuffers = 3;
+    TestOffscreenRenderManager rm(p);
+    REQUIRE(rm.OpenDisplay().status == RenderManager::COMPLETE);
+    Frame frame;
+    EyeTextures textures(rm, frame);
+
+    for (size_t present = 1; present <= 4; present++) {
+        REQUIRE(
+            rm.PresentRenderBuffers(frame.buffers, frame.info, frame.params));
+        // Even once the read-backs have finished, the captures from this
+        // present and the one before are held back.
+        glFinish();
+        CHECK(captures.count == (present > 2 ? present - 2 : 0));
+    }
+    CHECK(captures.width == 64);
+    CHECK(captures.height == 32);
+    std::array<uint8_t, 3> red = {{255, 0, 0}};
+    CHECK(captures.left == red);
+}
+
+TEST_CASE("Every OpenGL error checking mode reports an error made mid-frame",
+          "[openGLOffscreen]") {
+    typedef RenderManager::ConstructorParameters Params;
+    GraphicsLibraryOpenGL library;
+    Params p = offscreenParameters(library);
+    SECTION("default") {
+        // Whichever mode the library's build picks.
+        CHECK(p.m_glErrorChecking == Params::DefaultGLErrorChecking);
+    }
+    SECTION("full") { p.m_glErrorChecking = Params::FullGLErrorChecking; }
+    SECTION("frameEnd") {
+        p.m_glErrorChecking = Params::FrameEndGLErrorChecking;
+    }
+    SECTION("sampled") {
+        // The first frame is checked step by step, the second is not.
+        p.m_glErrorChecking = Params::SampledGLErrorChecking;
+        p.m_glErrorCheckInterval = 60;
+    }
+    SECTION("debugOutput") {
+        p.m_glErrorChecking = Params::DebugOutputGLErrorChecking;
+    }
+    TestOffscreenRenderManager rm(p);
+    REQUIRE(rm.OpenDisplay().status == RenderManager::COMPLETE);
+    Frame frame;
+    EyeTextures textures(rm, frame);
+    REQUIRE(rm.PresentRenderBuffers(frame.buffers, frame.info, frame.params));
+
+    // The application makes an error while rendering the next frame.
+    std::string reported;
+    bool presented;
+    {
+        CapturedOutput output;
+        REQUIRE(rm.GetRenderInfo(frame.params, frame.info) == 2);
+        glEnable(0xFFFF);
+        presented =
+            rm.PresentRenderBuffers(frame.buffers, frame.info, frame.params);
+        reported = output.text();
+    }
+    CHECK_FALSE(presented);
+    // The debug-output callback gives the driver's message number rather
+    // than GL_INVALID_ENUM.
+    CHECK(reported.find("OpenGL error") != std::string::npos);
+
+    // It was cleared, so the frame after that is not blamed for it.
+    CHECK(glGetError() == GL_NO_ERROR);
+    CHECK(rm.PresentRenderBuffers(frame.buffers, frame.info, frame.params));
+}
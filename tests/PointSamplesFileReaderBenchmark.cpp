@@ -0,0 +1,134 @@
+/** @file
+@brief Measures how fast dense point-sample distortion files are read, by
+PointSamplesFileReader and, for comparison, by parsing them into a JSON
+document.
+
+Usage: PointSamplesFileReaderBenchmark [points per eye] [repetitions]
+
+@date 2026
+
+@author
+Sensics, Inc.
+<http://sensics.com/osvr>
+*/
+
+// Copyright 2026 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Internal Includes
+#include "PointSamplesFileReader.h"
+
+// Library/third-party includes
+#include <json/reader.h>
+#include <json/value.h>
+
+// Standard includes
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <iterator>
+#include <string>
+
+using namespace osvr::renderkit;
+
+typedef std::chrono::steady_clock Clock;
+
+static const char* FILE_NAME = "PointSamplesFileReaderBenchmark.json";
+
+/// Write a display descriptor with a regular grid of about pointsPerEye
+/// points for each eye, with coordinates written the way calibration
+/// tools write them.  Returns the size of the file.
+static size_t writePointFile(size_t pointsPerEye) {
+    size_t side = 2;
+    while (side * side < pointsPerEye) {
+        side++;
+    }
+    std::ofstream f(FILE_NAME, std::ios::binary | std::ios::trunc);
+    f << std::fixed << std::setprecision(6);
+    f << "{\n \"display\": {\n  \"hmd\": {\n   \"distortion\": {\n"
+         "    \"type\": \"mono_point_samples\",\n"
+         "    \"mono_point_samples\": [\n";
+    for (int eye = 0; eye < 2; eye++) {
+        f << (eye ? ",\n" : "") << "     [\n";
+        for (size_t i = 0; i < side * side; i++) {
+            double x = static_cast<double>(i % side) / (side - 1);
+            double y = static_cast<double>(i / side) / (side - 1);
+            double r2 = (x - 0.5) * (x - 0.5) + (y - 0.5) * (y - 0.5);
+            f << (i ? ",\n" : "") << "      [[" << x << ", " << y << "], ["
+              << 0.5 + (x - 0.5) * (1 + 0.2 * r2) << ", "
+              << 0.5 + (y - 0.5) * (1 + 0.2 * r2) << "]]";
+        }
+        f << "\n     ]";
+    }
+    f << "\n    ]\n   }\n  }\n }\n}\n";
+    return static_cast<size_t>(f.tellp());
+}
+
+/// Seconds for the fastest of the given number of runs of f.
+template <typename F> static double fastest(int repetitions, F f) {
+    double best = 1e30;
+    for (int i = 0; i < repetitions; i++) {
+        Clock::time_point start = Clock::now();
+        if (!f()) {
+            std::cerr << "Reading " << FILE_NAME << " failed\n";
+            std::exit(1);
+        }
+        best = std::min(
+            best, std::chrono::duration<double>(Clock::now() - start).count());
+    }
+    return best;
+}
+
+int main(int argc, char* argv[]) {
+    size_t pointsPerEye =
+        (argc > 1) ? static_cast<size_t>(std::atol(argv[1])) : 250000;
+    int repetitions = (argc > 2) ? std::atoi(argv[2]) : 5;
+    double megabytes = writePointFile(pointsPerEye) / 1e6;
+
+    size_t points = 0;
+    double reader = fastest(repetitions, [&] {
+        MonoPointDistortionMeshSamplesPerEye mesh;
+        PointSamplesFileReader r;
+        r.addSamples("mono_point_samples", mesh);
+        bool ret = r.read(FILE_NAME);
+        points = r.points();
+        return ret;
+    });
+
+    // What the display configuration did before: read the whole file and
+    // parse it into a document.
+    double document = fastest(repetitions, [&] {
+        std::ifstream f(FILE_NAME, std::ios::binary);
+        std::string text((std::istreambuf_iterator<char>(f)),
+                         std::istreambuf_iterator<char>());
+        Json::Value root;
+        Json::Reader jsonReader;
+        return jsonReader.parse(text, root, false) &&
+               root["display"]["hmd"]["distortion"]["mono_point_samples"]
+                       .size() == 2;
+    });
+    std::remove(FILE_NAME);
+
+    std::cout << points << " points, " << megabytes << " MB, fastest of "
+              << repetitions << "\n"
+              << "PointSamplesFileReader: " << reader * 1e3 << " ms, "
+              << megabytes / reader << " MB/s\n"
+              << "JSON document:          " << document * 1e3 << " ms, "
+              << megabytes / document << " MB/s\n";
+    return 0;
+}
@@ -0,0 +1,178 @@
+/** @file
+@brief Tests of reading point-sample distortion meshes from external files.
+
+@date 2026
+
+@author
+Sensics, Inc.
+<http://sensics.com/osvr>
+*/
+
+// Copyright 2026 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Internal Includes
+#include "PointSamplesFileReader.h"
+
+// Library/third-party includes
+#include <catch2/catch.hpp>
+
+// Standard includes
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+using namespace osvr::renderkit;
+
+/// A point file in the working directory that is removed when done with.
+class PointFile {
+  public:
+    PointFile(const char* name, const std::string& text) : m_name(name) {
+        std::ofstream f(m_name.c_str(), std::ios::binary | std::ios::trunc);
+        f << text;
+    }
+    ~PointFile() { std::remove(m_name.c_str()); }
+    const std::string& name() const { return m_name; }
+
+  private:
+    std::string m_name;
+};
+
+/// A display descriptor holding the given members of the distortion
+/// object, along with others that are to be skipped.
+static std::string descriptor(const std::string& distortion) {
+    return "{\n"
+           "  \"meta\": {\"schemaVersion\": 1, \"note\": \"a \\\"[\\\" {\"},\n"
+           "  \"display\": {\n"
+           "    \"static\": [true, false, null, -1.5e-3, [[]], {}],\n"
+           "    \"hmd\": {\n"
+           "      \"distortion\": {\n" +
+           distortion +
+           "\n      },\n"
+           "      \"eyes\": [{\"center_proj_x\": 0.5}]\n"
+           "    }\n"
+           "  }\n"
+           "}\n";
+}
+
+TEST_CASE("Point samples are read into the meshes asked for",
+          "[pointSamples]") {
+    PointFile file(
+        "PointSamplesFileReaderTests-mono.json",
+        descriptor("\"type\": \"mono_point_samples\",\n"
+                   "\"red_point_samples\": [[[[9, 9], [9, 9]]]],\n"
+                   "\"mono_point_samples\": [\n"
+                   "  [[[0.25, 0.5], [0.3, 0.55]], [[1, 0], [1e-1, -2]]],\n"
+                   "  [[[0.75,0.5],[0.7,0.45]]]\n"
+                   "]"));
+    MonoPointDistortionMeshSamplesPerEye mesh;
+    PointSamplesFileReader reader;
+    reader.addSamples("mono_point_samples", mesh);
+    REQUIRE(reader.read(file.name()));
+    CHECK(reader.error().empty());
+    CHECK(reader.points() == 3);
+    CHECK(reader.bytes() > 0);
+
+    REQUIRE(mesh.size() == 2);
+    REQUIRE(mesh[0]->size() == 2);
+    CHECK(mesh[0]->fromX(0) == 0.25f);
+    CHECK(mesh[0]->fromY(0) == 0.5f);
+    CHECK(mesh[0]->toX(0) == 0.3f);
+    CHECK(mesh[0]->toY(0) == 0.55f);
+    CHECK(mesh[0]->fromX(1) == 1);
+    CHECK(mesh[0]->toX(1) == 0.1f);
+    CHECK(mesh[0]->toY(1) == -2);
+    REQUIRE(mesh[1]->size() == 1);
+    CHECK(mesh[1]->toY(0) == 0.45f);
+}
+
+TEST_CASE("Points spanning the reader's chunks are read whole",
+          "[pointSamples]") {
+    // Enough points that the file is several 64 KB chunks long.
+    const size_t count = 20000;
+    std::ostringstream points;
+    points << "\"green_point_samples\": [[";
+    for (size_t i = 0; i < count; i++) {
+        points << (i ? ", " : "") << "[[" << i << ".25, -" << i
+               << "], [0.125, " << i % 7 << "]]";
+    }
+    points << "], [[[0, 0], [1, 1]]]]";
+    PointFile file("PointSamplesFileReaderTests-chunks.json",
+                   descriptor(points.str()));
+
+    MonoPointDistortionMeshSamplesPerEye red, green;
+    PointSamplesFileReader reader;
+    reader.addSamples("red_point_samples", red);
+    reader.addSamples("green_point_samples", green);
+    REQUIRE(reader.read(file.name()));
+    CHECK(reader.bytes() > 3 * 64 * 1024);
+    CHECK(reader.points() == count + 1);
+    CHECK(red.empty());
+    REQUIRE(green.size() == 2);
+    REQUIRE(green[0]->size() == count);
+    size_t wrong = 0;
+    for (size_t i = 0; i < count; i++) {
+        if (green[0]->fromX(i) != static_cast<float>(i + 0.25) ||
+            green[0]->fromY(i) != -static_cast<float>(i) ||
+            green[0]->toX(i) != 0.125f ||
+            green[0]->toY(i) != static_cast<float>(i % 7)) {
+            wrong++;
+        }
+    }
+    CHECK(wrong == 0);
+    CHECK(green[1]->toY(0) == 1);
+}
+
+TEST_CASE("Malformed point files are reported with their line",
+          "[pointSamples]") {
+    std::string distortion;
+    std::string expected;
+    SECTION("Point with a missing coordinate") {
+        distortion = "\"mono_point_samples\": [[[[0, 0], [1]]]]";
+        expected = "Line 7: Expected ','";
+    }
+    SECTION("Empty eye") {
+        distortion = "\"mono_point_samples\": [[[[0, 0], [1, 1]]], []]";
+        expected = "Line 7: Empty mono_point_samples list for eye";
+    }
+    SECTION("Bad number") {
+        distortion = "\"x\": 1,\n\"mono_point_samples\": [[[[0, 0], [1-, 1]]]]";
+        expected = "Line 8: Malformed number '1-'";
+    }
+    SECTION("Truncated") {
+        distortion = "\"mono_point_samples\": [[[[0, 0], [1, 1]]]]";
+        expected = "Unexpected end of file";
+    }
+    std::string text = descriptor(distortion);
+    if (expected == "Unexpected end of file") {
+        text.resize(text.size() - 20);
+    }
+    PointFile file("PointSamplesFileReaderTests-malformed.json", text);
+
+    MonoPointDistortionMeshSamplesPerEye mesh;
+    PointSamplesFileReader reader;
+    reader.addSamples("mono_point_samples", mesh);
+    CHECK_FALSE(reader.read(file.name()));
+    INFO(reader.error());
+    CHECK(reader.error().find(expected) != std::string::npos);
+}
+
+TEST_CASE("A missing point file is reported", "[pointSamples]") {
+    MonoPointDistortionMeshSamplesPerEye mesh;
+    PointSamplesFileReader reader;
+    reader.addSamples("mono_point_samples", mesh);
+    CHECK_FALSE(reader.read("PointSamplesFileReaderTests-missing.json"));
+    CHECK(reader.error().find("Couldn't open") != std::string::npos);
+}
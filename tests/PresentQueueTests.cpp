@@ -0,0 +1,255 @@
+/** @file
+@brief Tests of present tokens, synchronous and queued, on the Null
+RenderManager.
+
+@date 2026
+
+@author
+Sensics, Inc.
+<http://sensics.com/osvr>
+*/
+
+// Copyright 2026 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Internal Includes
+#include "TestRenderManager.h"
+
+// Library/third-party includes
+#include <catch2/catch.hpp>
+
+// Standard includes
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+using namespace osvr::renderkit;
+using namespace osvr::renderkit::test;
+
+/// Open the display and register the (NULL) buffers to present from.
+static void open(TestRenderManager& rm) {
+    REQUIRE(rm.OpenDisplay().status == RenderManager::COMPLETE);
+    REQUIRE(rm.RegisterRenderBuffers(std::vector<RenderBuffer>(2)));
+}
+
+TEST_CASE("Synchronous presents complete their tokens", "[presentQueue]") {
+    TestRenderManager rm(nullParameters(0));
+    open(rm);
+    Frame frame;
+
+    CHECK(rm.GetPresentStatus(0) == PRESENT_UNKNOWN);
+    CHECK(rm.GetPresentStatus(1) == PRESENT_UNKNOWN);
+
+    PresentToken token = 0;
+    REQUIRE(presentFrame(rm, frame, &token));
+    CHECK(token == 1);
+    CHECK(rm.GetPresentStatus(token) == PRESENT_SUCCEEDED);
+    CHECK(rm.WaitForPresent(token) == PRESENT_SUCCEEDED);
+    CHECK(rm.GetPresentStatus(token + 1) == PRESENT_UNKNOWN);
+    CHECK(rm.m_presentedFrames == 1);
+}
+
+TEST_CASE("Failed presents fail their tokens", "[presentQueue]") {
+    TestRenderManager rm(nullParameters(0));
+    REQUIRE(rm.OpenDisplay().status == RenderManager::COMPLETE);
+    Frame frame;
+
+    // Presenting without registering buffers fails.
+    PresentToken token = 0;
+    CHECK_FALSE(presentFrame(rm, frame, &token));
+    CHECK(rm.GetPresentStatus(token) == PRESENT_FAILED);
+}
+
+TEST_CASE("Only the most-recent tokens are remembered", "[presentQueue]") {
+    TestRenderManager rm(nullParameters(0));
+    open(rm);
+    Frame frame;
+
+    std::vector<PresentToken> tokens;
+    for (size_t i = 0; i < TestRenderManager::PresentQueueState::
+                                   STATUS_HISTORY + 4;
+         i++) {
+        PresentToken token;
+        REQUIRE(presentFrame(rm, frame, &token));
+        tokens.push_back(token);
+    }
+    for (size_t i = 1; i < tokens.size(); i++) {
+        CHECK(tokens[i] == tokens[i - 1] + 1);
+    }
+    size_t remembered = TestRenderManager::PresentQueueState::STATUS_HISTORY;
+    size_t forgotten = tokens.size() - remembered;
+    for (size_t i = 0; i < forgotten; i++) {
+        CHECK(rm.GetPresentStatus(tokens[i]) == PRESENT_UNKNOWN);
+    }
+    for (size_t i = forgotten; i < tokens.size(); i++) {
+        CHECK(rm.GetPresentStatus(tokens[i]) == PRESENT_SUCCEEDED);
+    }
+}
+
+TEST_CASE("Queued presents are presented in order", "[presentQueue]") {
+    RenderManager::ConstructorParameters p = nullParameters(100);
+    p.m_presentQueueDepth = 2;
+    TestRenderManager rm(p);
+    open(rm);
+    Frame frame;
+
+    std::vector<PresentToken> tokens;
+    for (size_t i = 0; i < 6; i++) {
+        PresentToken token;
+        REQUIRE(presentFrame(rm, frame, &token));
+        PresentStatus status = rm.GetPresentStatus(token);
+        CHECK(((status == PRESENT_PENDING) ||
+               (status == PRESENT_SUCCEEDED)));
+        tokens.push_back(token);
+    }
+
+    // Once a frame is done, so are all of those before it.
+    CHECK(rm.WaitForPresent(tokens.back()) == PRESENT_SUCCEEDED);
+    for (PresentToken token : tokens) {
+        CHECK(rm.GetPresentStatus(token) == PRESENT_SUCCEEDED);
+    }
+    CHECK(rm.m_presentedFrames == tokens.size());
+}
+
+TEST_CASE("A frame shown for several refreshes stays pending until replaced",
+          "[presentQueue]") {
+    RenderManager::ConstructorParameters p = nullParameters(100);
+    p.m_refreshesPerFrame = 2;
+    TestRenderManager rm(p);
+    open(rm);
+    Frame frame;
+
+    PresentToken first, second;
+    REQUIRE(presentFrame(rm, frame, &first));
+
+    // With nothing to replace it, the presenter keeps showing it.
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    CHECK(rm.GetPresentStatus(first) == PRESENT_PENDING);
+    FrameTimingRecord records[4];
+    size_t numRecords;
+    REQUIRE(rm.GetFrameTimingRecords(records, 4, numRecords));
+    REQUIRE(numRecords >= 3);
+    CHECK(records[numRecords - 1].repeat);
+
+    REQUIRE(presentFrame(rm, frame, &second));
+    CHECK(rm.WaitForPresent(first) == PRESENT_SUCCEEDED);
+    CHECK(rm.GetPresentStatus(second) == PRESENT_PENDING);
+}
+
+TEST_CASE("Presents from another thread wait for a queued present",
+          "[presentQueue]") {
+    RenderManager::ConstructorParameters p = nullParameters(200);
+    p.m_presentQueueDepth = 2;
+    TestRenderManager rm(p);
+    open(rm);
+
+    // While the presenter thread waits for vsync, another thread renders,
+    // presents a solid color and replaces the distortion meshes, all of
+    // which change the state that the queued present is using.
+    std::atomic<bool> done(false);
+    size_t otherPresents = 0;
+    std::thread other([&] {
+        RenderManager::RenderParams params;
+        std::vector<RenderManager::DistortionParameters> distort(
+            2, RenderManager::DistortionParameters());
+        for (unsigned i = 0; !done; i++) {
+            CHECK(rm.Render(params));
+            RGBColorf color = {0, 0, 0};
+            CHECK(rm.PresentSolidColor(color));
+            distort[0].m_desiredTriangles = (i % 2) ? 2 : 8;
+            CHECK(rm.UpdateDistortionMeshes(RenderManager::SQUARE, distort));
+            otherPresents += 2;
+        }
+    });
+
+    Frame frame;
+    std::vector<PresentToken> tokens;
+    for (size_t i = 0; i < 40; i++) {
+        PresentToken token;
+        REQUIRE(presentFrame(rm, frame, &token));
+        tokens.push_back(token);
+    }
+    CHECK(rm.WaitForPresent(tokens.back()) == PRESENT_SUCCEEDED);
+    done = true;
+    other.join();
+    for (size_t i = tokens.size() - 8; i < tokens.size(); i++) {
+        CHECK(rm.GetPresentStatus(tokens[i]) == PRESENT_SUCCEEDED);
+    }
+    CHECK(rm.m_presentedFrames == tokens.size() + otherPresents);
+
+    // Each present got its own record, none of which was started over by
+    // another present part way through.
+    const size_t history = TestRenderManager::FrameTimingState::HISTORY;
+    std::vector<FrameTimingRecord> records(history);
+    size_t numRecords;
+    REQUIRE(rm.GetFrameTimingRecords(records.data(), records.size(),
+                                     numRecords));
+    REQUIRE(numRecords > 0);
+    for (size_t i = 0; i < numRecords; i++) {
+        const FrameTimingRecord& r = records[i];
+        CHECK(r.numEyes == 2);
+        CHECK_FALSE(osvrTimeValueGreater(&r.presentEntry, &r.warpComputed));
+        CHECK_FALSE(osvrTimeValueGreater(&r.warpComputed,
+                                         &r.eyeSubmitStart[0]));
+        CHECK_FALSE(osvrTimeValueGreater(&r.eyeSubmitEnd[1], &r.swapReturn));
+        if (i > 0) {
+            CHECK(osvrTimeValueGreater(&r.presentEntry,
+                                       &records[i - 1].swapReturn));
+        }
+    }
+}
+
+TEST_CASE("Present-thread scheduling is applied once, to the presenter",
+          "[presentQueue]") {
+    // Raising the nice value needs no permission.
+    RenderManager::ConstructorParameters p = nullParameters(0);
+    p.m_presentThreadNice = 1;
+    std::thread::id caller = std::this_thread::get_id();
+    PresentThreadSchedulingInfo info;
+
+    SECTION("Synchronous presents leave the application's thread alone") {
+        TestRenderManager rm(p);
+        open(rm);
+        Frame frame;
+        REQUIRE(presentFrame(rm, frame));
+        REQUIRE(presentFrame(rm, frame));
+        CHECK_FALSE(rm.GetPresentThreadScheduling(info));
+        CHECK(rm.m_presentThreadId == std::thread::id());
+    }
+    SECTION("Unless that was asked for") {
+        p.m_presentThreadApplyToCaller = true;
+        TestRenderManager rm(p);
+        open(rm);
+        Frame frame;
+        REQUIRE(presentFrame(rm, frame));
+        CHECK(rm.GetPresentThreadScheduling(info));
+        CHECK(rm.m_presentThreadId == caller);
+    }
+    SECTION("Queued presents apply it to the presenter thread") {
+        p.m_presentQueueDepth = 2;
+        p.m_presentThreadApplyToCaller = true;
+        TestRenderManager rm(p);
+        open(rm);
+        Frame frame;
+        PresentToken token = 0;
+        for (int i = 0; i < 3; i++) {
+            REQUIRE(presentFrame(rm, frame, &token));
+        }
+        CHECK(rm.WaitForPresent(token) == PRESENT_SUCCEEDED);
+        CHECK(rm.GetPresentThreadScheduling(info));
+        CHECK(rm.m_presentThreadId != std::thread::id());
+        CHECK(rm.m_presentThreadId != caller);
+    }
+}
@@ -0,0 +1,103 @@
+/** @file
+@brief Tests of the per-eye viewports and projections that RenderManager
+keeps from frame to frame.
+
+@date 2026
+
+@author
+Sensics, Inc.
+<http://sensics.com/osvr>
+*/
+
+// Copyright 2026 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Internal Includes
+#include "TestRenderManager.h"
+
+// Library/third-party includes
+#include <catch2/catch.hpp>
+
+// Standard includes
+#include <vector>
+
+using namespace osvr::renderkit;
+using namespace osvr::renderkit::test;
+
+static bool sameProjection(const OSVR_ProjectionMatrix& a,
+                           const OSVR_ProjectionMatrix& b) {
+    return a.left == b.left && a.right == b.right && a.top == b.top &&
+           a.bottom == b.bottom && a.nearClip == b.nearClip &&
+           a.farClip == b.farClip;
+}
+
+TEST_CASE("Projections follow the application's clipping planes",
+          "[renderGeometry]") {
+    TestRenderManager rm(nullParameters(0));
+    REQUIRE(rm.OpenDisplay().status == RenderManager::COMPLETE);
+    RenderManager::RenderParams params;
+    params.nearClipDistanceMeters = 0.1;
+    std::vector<RenderInfo> nearer, farther, again;
+    REQUIRE(rm.GetRenderInfo(params, nearer) == 2);
+    params.nearClipDistanceMeters = 0.5;
+    REQUIRE(rm.GetRenderInfo(params, farther) == 2);
+    params.nearClipDistanceMeters = 0.1;
+    REQUIRE(rm.GetRenderInfo(params, again) == 2);
+
+    for (size_t eye = 0; eye < 2; eye++) {
+        CHECK(nearer[eye].projection.nearClip == 0.1);
+        CHECK(farther[eye].projection.nearClip == 0.5);
+        CHECK(sameProjection(nearer[eye].projection, again[eye].projection));
+        CHECK(nearer[eye].viewport.width == farther[eye].viewport.width);
+    }
+}
+
+TEST_CASE("Presenting with other clipping planes keeps the projections",
+          "[renderGeometry]") {
+    TestRenderManager rm(nullParameters(0));
+    REQUIRE(rm.OpenDisplay().status == RenderManager::COMPLETE);
+    REQUIRE(rm.RegisterRenderBuffers(std::vector<RenderBuffer>(2)));
+    Frame frame;
+    frame.params.nearClipDistanceMeters = 0.1;
+    RenderManager::RenderParams presentParams;
+    presentParams.nearClipDistanceMeters = 2;
+    presentParams.farClipDistanceMeters = 3;
+
+    // Render with one pair of clipping planes and present what was
+    // rendered with parameters that have another, for a few frames.
+    std::vector<OSVR_ProjectionMatrix> first;
+    for (int i = 0; i < 3; i++) {
+        REQUIRE(rm.GetRenderInfo(frame.params, frame.info) == 2);
+        frame.buffers.resize(frame.info.size());
+        REQUIRE(rm.PresentRenderBuffers(frame.buffers, frame.info,
+                                        presentParams));
+        if (i == 0) {
+            first = rm.m_renderGeometry.projections[1].eyes;
+        }
+    }
+
+    // Both sets of projections are kept, the application's unchanged,
+    // rather than one replacing the other each time.
+    const auto& projections = rm.m_renderGeometry.projections;
+    REQUIRE(projections[0].valid);
+    REQUIRE(projections[1].valid);
+    CHECK(projections[0].nearClip == 2);
+    CHECK(projections[1].nearClip == 0.1);
+    REQUIRE(projections[1].eyes.size() == 2);
+    for (size_t eye = 0; eye < 2; eye++) {
+        CHECK(sameProjection(projections[1].eyes[eye], first[eye]));
+        CHECK(sameProjection(projections[1].eyes[eye],
+                             frame.info[eye].projection));
+    }
+}
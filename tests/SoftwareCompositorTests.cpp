@@ -0,0 +1,288 @@
+/** @file
+@brief Tests of the RenderManager that composites on the CPU.
+
+@date 2026
+
+@author
+Sensics, Inc.
+<http://sensics.com/osvr>
+*/
+
+// Copyright 2026 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Internal Includes
+#include "RenderManagerSoftware.h"
+#include "TestRenderManager.h"
+
+// Library/third-party includes
+#include <catch2/catch.hpp>
+
+// Standard includes
+#include <array>
+#include <cstdint>
+#include <vector>
+
+using namespace osvr::renderkit;
+using namespace osvr::renderkit::test;
+
+/// A software RenderManager that can be made directly, without a server,
+/// whose compositing internals are open to the tests, and which can be
+/// given the time warp to present with.
+class TestSoftwareRenderManager : public RenderManagerSoftware {
+  public:
+    explicit TestSoftwareRenderManager(const ConstructorParameters& p)
+        : RenderManagerSoftware(nullptr, p) {}
+
+    using RenderManager::matrix16;
+    using RenderManagerSoftware::EyeComposite;
+    using RenderManagerSoftware::WarpedVertex;
+    using RenderManagerSoftware::compositeBand;
+
+    /// Used in place of the time warp computed from the poses, if set.
+    const matrix16* timeWarp = nullptr;
+
+  protected:
+    bool PresentEye(PresentEyeParameters params) override {
+        matrix16 warp;
+        if (timeWarp != nullptr) {
+            warp = *timeWarp;
+            params.m_timeWarp = &warp;
+        }
+        return RenderManagerSoftware::PresentEye(params);
+    }
+};
+
+typedef TestSoftwareRenderManager::matrix16 matrix16;
+
+/// An RGBA image and the buffer describing it.
+struct Image {
+    std::vector<uint8_t> pixels;
+    RenderBufferSoftware buffer;
+
+    Image(size_t width, size_t height) : pixels(width * height * 4, 0) {
+        buffer.data = pixels.data();
+        buffer.width = width;
+        buffer.height = height;
+        buffer.stride = width * 4;
+    }
+
+    uint8_t* at(size_t x, size_t y) {
+        return &pixels[y * buffer.stride + x * 4];
+    }
+
+    /// Fill with a pattern in which neighboring pixels all differ.
+    void fillPattern(int seed) {
+        for (size_t y = 0; y < buffer.height; y++) {
+            for (size_t x = 0; x < buffer.width; x++) {
+                uint8_t* p = at(x, y);
+                p[0] = static_cast<uint8_t>(x * 7 + y * 3 + seed);
+                p[1] = static_cast<uint8_t>(x * 13 + y * 29 + seed);
+                p[2] = static_cast<uint8_t>(x * 5 + y * 17 + 3 * seed);
+                p[3] = 255;
+            }
+        }
+    }
+};
+
+/// Copies of the finished display images.
+struct Displays {
+    std::vector<std::vector<uint8_t> > pixels;
+    size_t width = 0;
+    size_t height = 0;
+
+    std::array<uint8_t, 4> at(size_t display, size_t x, size_t y) const {
+        const uint8_t* p = &pixels[display][4 * (y * width + x)];
+        return {{p[0], p[1], p[2], p[3]}};
+    }
+};
+
+static void copyDisplay(void* userData, size_t display,
+                        const RenderBufferSoftware& image) {
+    Displays* d = static_cast<Displays*>(userData);
+    d->width = image.width;
+    d->height = image.height;
+    d->pixels.resize(display + 1);
+    d->pixels[display].clear();
+    for (size_t y = 0; y < image.height; y++) {
+        const uint8_t* row = image.data + y * image.stride;
+        d->pixels[display].insert(d->pixels[display].end(), row,
+                                  row + image.width * 4);
+    }
+}
+
+/// Present a patterned image for each eye of a side-by-side display with
+/// no distortion, and return what was displayed.
+static Displays presentPatterns(int width, int height, unsigned threads,
+                                const matrix16* timeWarp,
+                                std::vector<Image>& eyes) {
+    GraphicsLibrarySoftware library;
+    Displays displays;
+    library.displayImageCallback = copyDisplay;
+    library.displayImageUserData = &displays;
+    RenderManager::ConstructorParameters p =
+        nullParameters(0, width, height);
+    p.m_renderLibrary = "Software";
+    p.m_graphicsLibrary.Software = &library;
+    p.m_softwareCompositorThreads = threads;
+    TestSoftwareRenderManager rm(p);
+    rm.timeWarp = timeWarp;
+    REQUIRE(rm.OpenDisplay().status == RenderManager::COMPLETE);
+
+    Frame frame;
+    REQUIRE(rm.GetRenderInfo(frame.params, frame.info) == 2);
+    eyes.clear();
+    frame.buffers.resize(2);
+    for (size_t eye = 0; eye < 2; eye++) {
+        eyes.push_back(
+            Image(static_cast<size_t>(frame.info[eye].viewport.width),
+                  static_cast<size_t>(frame.info[eye].viewport.height)));
+    }
+    for (size_t eye = 0; eye < 2; eye++) {
+        eyes[eye].fillPattern(static_cast<int>(eye) * 100);
+        frame.buffers[eye].Software = &eyes[eye].buffer;
+    }
+    REQUIRE(rm.RegisterRenderBuffers(frame.buffers));
+    REQUIRE(rm.PresentRenderBuffers(frame.buffers, frame.info, frame.params));
+    REQUIRE(displays.pixels.size() == 1);
+    return displays;
+}
+
+/// A time warp that moves where each eye samples by the given fraction of
+/// its buffer.
+static matrix16 translation(float s, float t) {
+    matrix16 m = {{1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, s, t, 0, 1}};
+    return m;
+}
+
+TEST_CASE("With no distortion the eye buffers are displayed exactly",
+          "[software]") {
+    std::vector<Image> eyes;
+    Displays displays = presentPatterns(128, 64, 1, nullptr, eyes);
+    REQUIRE(displays.width == 128);
+    REQUIRE(displays.height == 64);
+    REQUIRE(eyes[0].buffer.width == 64);
+    REQUIRE(eyes[0].buffer.height == 64);
+
+    size_t wrong = 0;
+    for (size_t eye = 0; eye < 2; eye++) {
+        for (size_t y = 0; y < 64; y++) {
+            for (size_t x = 0; x < 64; x++) {
+                const uint8_t* p = eyes[eye].at(x, y);
+                std::array<uint8_t, 4> expected = {{p[0], p[1], p[2], 255}};
+                if (displays.at(0, eye * 64 + x, y) != expected) {
+                    wrong++;
+                }
+            }
+        }
+    }
+    CHECK(wrong == 0);
+}
+
+TEST_CASE("A time-warp translation shifts the displayed image",
+          "[software]") {
+    // Four texels to the right and two up, so each displayed pixel shows
+    // the one that far away in the buffer.
+    matrix16 warp = translation(4.0f / 64, 2.0f / 64);
+    std::vector<Image> eyes;
+    Displays displays = presentPatterns(128, 64, 1, &warp, eyes);
+
+    size_t wrong = 0;
+    for (size_t eye = 0; eye < 2; eye++) {
+        for (size_t y = 0; y + 2 < 64; y++) {
+            for (size_t x = 0; x + 4 < 64; x++) {
+                const uint8_t* p = eyes[eye].at(x + 4, y + 2);
+                std::array<uint8_t, 4> expected = {{p[0], p[1], p[2], 255}};
+                if (displays.at(0, eye * 64 + x, y) != expected) {
+                    wrong++;
+                }
+            }
+        }
+    }
+    CHECK(wrong == 0);
+
+    // Beyond the buffer, the border is black.
+    std::array<uint8_t, 4> black = {{0, 0, 0, 255}};
+    CHECK(displays.at(0, 63, 10) == black);
+    CHECK(displays.at(0, 10, 63) == black);
+}
+
+TEST_CASE("The result does not depend on the number of threads",
+          "[software]") {
+    // A fractional shift, so that every pixel is filtered, on a display
+    // tall enough for several bands of rows.
+    matrix16 warp = translation(2.3f / 64, -1.7f / 160);
+    std::vector<Image> eyes;
+    Displays one = presentPatterns(128, 160, 1, &warp, eyes);
+    Displays several = presentPatterns(128, 160, 4, &warp, eyes);
+    CHECK(one.pixels == several.pixels);
+}
+
+TEST_CASE("Pixels on edges shared by triangles are drawn once",
+          "[software]") {
+    typedef TestSoftwareRenderManager::WarpedVertex Vertex;
+
+    // Two squares side by side, each split along a diagonal, with every
+    // edge running through pixel centers.
+    const float xs[3] = {0.5f, 4.5f, 8.5f};
+    const float ys[2] = {0.5f, 8.5f};
+    std::vector<Vertex> vertices;
+    for (float y : ys) {
+        for (float x : xs) {
+            Vertex v = {};
+            v.x = x;
+            v.y = y;
+            vertices.push_back(v);
+        }
+    }
+    const std::vector<std::vector<uint16_t> > triangles = {
+        {0, 1, 4}, {0, 4, 3}, {1, 2, 5}, {1, 5, 4}};
+
+    // Every vertex samples the source's one texel.
+    Image source(1, 1);
+    source.fillPattern(0);
+    std::vector<int> drawn(10 * 10, 0);
+    for (const std::vector<uint16_t>& indices : triangles) {
+        Image target(10, 10);
+        TestSoftwareRenderManager::EyeComposite eye;
+        eye.vertices = &vertices;
+        eye.source = &source.buffer;
+        eye.target = &target.buffer;
+        eye.indices = &indices;
+        eye.left = 0;
+        eye.lower = 0;
+        eye.right = 10;
+        eye.upper = 10;
+        TestSoftwareRenderManager::compositeBand(&eye, 0);
+        for (size_t y = 0; y < 10; y++) {
+            for (size_t x = 0; x < 10; x++) {
+                // Drawn pixels are opaque.
+                drawn[y * 10 + x] += (target.at(x, y)[3] == 255) ? 1 : 0;
+            }
+        }
+    }
+
+    // Pixels inside the outline, including those on the shared edges,
+    // are drawn by exactly one triangle; none are drawn twice.
+    for (size_t y = 0; y < 10; y++) {
+        for (size_t x = 0; x < 10; x++) {
+            INFO("x = " << x << ", y = " << y);
+            if ((x >= 1) && (x < 8) && (y >= 1) && (y < 8)) {
+                CHECK(drawn[y * 10 + x] == 1);
+            } else {
+                CHECK(drawn[y * 10 + x] <= 1);
+            }
+        }
+    }
+}
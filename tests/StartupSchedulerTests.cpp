@@ -0,0 +1,205 @@
+/** @file
+@brief Tests of the scheduler that runs the stages of opening a display.
+
+@date 2026
+
+@author
+Sensics, Inc.
+<http://sensics.com/osvr>
+*/
+
+// Copyright 2026 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Internal Includes
+#include "RenderManagerStartupScheduler.h"
+
+// Library/third-party includes
+#include <catch2/catch.hpp>
+
+// Standard includes
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace osvr::renderkit;
+
+/// The order stages ran in, written from several threads.
+class RunOrder {
+  public:
+    /// Work for a stage that records when it ran.  It sleeps first, if
+    /// asked to, and fails if asked to.
+    std::function<bool()> stage(const std::string& name, bool succeed = true,
+                                int sleepMs = 0) {
+        return [this, name, succeed, sleepMs] {
+            if (sleepMs > 0) {
+                std::this_thread::sleep_for(
+                    std::chrono::milliseconds(sleepMs));
+            }
+            ran(name);
+            return succeed;
+        };
+    }
+
+    /// Work for a stage that only succeeds if another stage runs while it
+    /// is waiting for it.
+    std::function<bool()> stageWaitingFor(const std::string& name,
+                                          const std::string& other) {
+        return [this, name, other] {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            bool seen = m_changed.wait_for(
+                lock, std::chrono::seconds(5),
+                [&] { return find(other) >= 0; });
+            lock.unlock();
+            ran(name);
+            return seen;
+        };
+    }
+
+    /// Where in the order a stage ran, or -1 if it did not.
+    int position(const std::string& name) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return find(name);
+    }
+
+    std::thread::id thread(const std::string& name) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        int i = find(name);
+        return (i < 0) ? std::thread::id() : m_threads[i];
+    }
+
+  private:
+    void ran(const std::string& name) {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_order.push_back(name);
+            m_threads.push_back(std::this_thread::get_id());
+        }
+        m_changed.notify_all();
+    }
+
+    int find(const std::string& name) {
+        auto it = std::find(m_order.begin(), m_order.end(), name);
+        return (it == m_order.end()) ? -1
+                                     : static_cast<int>(it - m_order.begin());
+    }
+
+    std::mutex m_mutex;
+    std::condition_variable m_changed;
+    std::vector<std::string> m_order;
+    std::vector<std::thread::id> m_threads;
+};
+
+TEST_CASE("Stages run after the stages they depend on", "[startup]") {
+    StartupScheduler scheduler;
+    RunOrder order;
+    auto window = scheduler.add("window", true, {}, order.stage("window"));
+
+    // The meshes are computed while the context is set up.
+    auto meshes = scheduler.add("meshes", false, {},
+                                order.stageWaitingFor("meshes", "context"));
+    auto context =
+        scheduler.add("context", true, {window}, order.stage("context"));
+    auto upload = scheduler.add("upload", true, {context, meshes},
+                                order.stage("upload"));
+    scheduler.add("present", false, {upload}, order.stage("present"));
+
+    REQUIRE(scheduler.run(nullptr));
+    CHECK(order.position("window") < order.position("context"));
+    CHECK(order.position("context") < order.position("upload"));
+    CHECK(order.position("meshes") < order.position("upload"));
+    CHECK(order.position("upload") < order.position("present"));
+
+    // Only the worker stages leave the calling thread.
+    std::thread::id caller = std::this_thread::get_id();
+    CHECK(order.thread("window") == caller);
+    CHECK(order.thread("context") == caller);
+    CHECK(order.thread("upload") == caller);
+    CHECK(order.thread("meshes") != caller);
+    CHECK(order.thread("present") != caller);
+
+    const std::vector<StartupStageTiming>& timing = scheduler.timing();
+    REQUIRE(timing.size() == 5);
+    CHECK(std::string(timing[0].name) == "window");
+    CHECK(std::string(timing[4].name) == "present");
+    for (const StartupStageTiming& t : timing) {
+        CHECK(t.ran);
+        CHECK(t.succeeded);
+        CHECK(t.seconds >= 0);
+    }
+    CHECK_FALSE(timing[0].worker);
+    CHECK(timing[1].worker);
+    CHECK(timing[3].startSeconds >= timing[1].startSeconds +
+                                        timing[1].seconds - 1e-3);
+
+    std::string summary = scheduler.summary();
+    CHECK(summary.find("meshes") != std::string::npos);
+    CHECK(summary.find("upload") != std::string::npos);
+}
+
+TEST_CASE("A failed stage stops the stages after it", "[startup]") {
+    StartupScheduler scheduler;
+    RunOrder order;
+
+    SECTION("On the calling thread") {
+        auto window =
+            scheduler.add("window", true, {}, order.stage("window", false));
+        scheduler.add("context", true, {window}, order.stage("context"));
+        scheduler.add("meshes", false, {window}, order.stage("meshes"));
+        CHECK_FALSE(scheduler.run(nullptr));
+    }
+    SECTION("On a worker thread") {
+        auto window = scheduler.add("window", false, {},
+                                    order.stage("window", false, 5));
+        scheduler.add("context", true, {window}, order.stage("context"));
+        scheduler.add("meshes", false, {window}, order.stage("meshes"));
+        CHECK_FALSE(scheduler.run(nullptr));
+    }
+
+    const std::vector<StartupStageTiming>& timing = scheduler.timing();
+    REQUIRE(timing.size() == 3);
+    CHECK(timing[0].ran);
+    CHECK_FALSE(timing[0].succeeded);
+    CHECK_FALSE(timing[1].ran);
+    CHECK_FALSE(timing[1].succeeded);
+    CHECK_FALSE(timing[2].ran);
+    CHECK(order.position("context") == -1);
+    CHECK(order.position("meshes") == -1);
+}
+
+TEST_CASE("A failed stage waits for the stages already running",
+          "[startup]") {
+    StartupScheduler scheduler;
+    RunOrder order;
+    scheduler.add("meshes", false, {}, order.stage("meshes", true, 30));
+    auto window =
+        scheduler.add("window", true, {}, order.stage("window", false));
+    scheduler.add("context", true, {window}, order.stage("context"));
+
+    CHECK_FALSE(scheduler.run(nullptr));
+
+    // The worker that had started was finished before run() returned.
+    CHECK(order.position("meshes") >= 0);
+    const std::vector<StartupStageTiming>& timing = scheduler.timing();
+    REQUIRE(timing.size() == 3);
+    CHECK(timing[0].ran);
+    CHECK(timing[0].succeeded);
+    CHECK_FALSE(timing[1].succeeded);
+    CHECK_FALSE(timing[2].ran);
+}
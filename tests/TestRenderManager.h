@@ -0,0 +1,162 @@
+/** @file
+@brief Helpers shared by the RenderManager tests: a Null RenderManager
+whose internal state the tests can reach, and the parameters to make one.
+
+@date 2026
+
+@author
+Sensics, Inc.
+<http://sensics.com/osvr>
+*/
+
+// Copyright 2026 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+// Internal Includes
+#include "RenderManagerNull.h"
+
+// Library/third-party includes
+#include <osvr/Util/TimeValueC.h>
+
+// Standard includes
+#include <cmath>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace osvr {
+namespace renderkit {
+namespace test {
+
+    /// @brief Display descriptor for a single side-by-side display with
+    /// two eyes and no distortion.
+    inline std::string displayDescriptor(int width = 1920, int height = 1080) {
+        std::ostringstream s;
+        s << "{ \"hmd\": {"
+             " \"field_of_view\": { \"monocular_horizontal\": 90,"
+             " \"monocular_vertical\": 90 },"
+             " \"resolutions\": [ { \"width\": "
+          << width << ", \"height\": " << height
+          << ", \"video_inputs\": 1,"
+             " \"display_mode\": \"horz_side_by_side\" } ],"
+             " \"distortion\": {},"
+             " \"eyes\": [ { \"center_proj_x\": 0.5,"
+             " \"center_proj_y\": 0.5 },"
+             " { \"center_proj_x\": 0.5, \"center_proj_y\": 0.5 } ]"
+             " } }";
+        return s.str();
+    }
+
+    /// @brief Parameters for a Null RenderManager with vertical sync,
+    /// no time warp and a simulated display refreshing at refreshRate
+    /// (0 for a display that does not report its refresh timing) and
+    /// the given resolution.
+    inline RenderManager::ConstructorParameters
+    nullParameters(double refreshRate, int width = 1920, int height = 1080) {
+        RenderManager::ConstructorParameters p;
+        p.m_renderLibrary = "Null";
+        p.m_displayConfiguration.parse(displayDescriptor(width, height));
+        p.m_distortionParameters.assign(
+            p.m_displayConfiguration.getEyes().size(),
+            RenderManager::DistortionParameters());
+        p.m_verticalSync = true;
+        p.m_enableTimeWarp = false;
+        p.m_maxMSBeforeVsyncTimeWarp = 0;
+        p.m_nullRefreshRate = refreshRate;
+        return p;
+    }
+
+    /// @brief A Null RenderManager that can be made directly, without a
+    /// server, and whose internal state is open to the tests.
+    class TestRenderManager : public RenderManagerNull {
+      public:
+        explicit TestRenderManager(const ConstructorParameters& p)
+            : RenderManagerNull(nullptr, p) {}
+
+        using RenderManager::DistortionMesh;
+        using RenderManager::FramePacingState;
+        using RenderManager::FrameTimingState;
+        using RenderManager::LatencyHistogram;
+        using RenderManager::PresentQueueState;
+
+        using RenderManager::m_mutex;
+        using RenderManager::m_params;
+        using RenderManager::m_framePacing;
+        using RenderManager::m_frameTiming;
+        using RenderManager::m_dynamicResolution;
+        using RenderManager::m_latency;
+        using RenderManager::m_frameDrops;
+        using RenderManager::m_presentQueue;
+        using RenderManager::m_inputLog;
+        using RenderManager::m_renderGeometry;
+        using RenderManager::m_headPoseTimestamp;
+        using RenderManager::m_headPoseTimestampValid;
+        using RenderManager::m_presentThreadId;
+        using RenderManagerNull::m_firstRetrace;
+        using RenderManagerNull::m_refreshInterval;
+        using RenderManagerNull::m_presentedFrames;
+        using RenderManagerNull::m_presentedEyes;
+
+        using RenderManager::GetNextRetraceInternal;
+        using RenderManager::GetNextFrameRetraceInternal;
+        using RenderManager::FramePresentLeadSecondsInternal;
+        using RenderManager::RecordPresentTimingInternal;
+        using RenderManager::PublishFrameTimingInternal;
+        using RenderManager::UpdateDynamicResolutionInternal;
+        using RenderManager::ClassifyMissedRetraceInternal;
+        using RenderManager::RecordPoseTimestampsInternal;
+        using RenderManager::RecordMotionToPhotonInternal;
+        using RenderManager::ComputeDistortionMeshes;
+    };
+
+    /// @brief What an application keeps from frame to frame to present
+    /// with GetRenderInfo() and PresentRenderBuffers().
+    struct Frame {
+        RenderManager::RenderParams params;
+        std::vector<RenderInfo> info;
+        std::vector<RenderBuffer> buffers;
+        std::vector<OSVR_ViewportDescription> viewports;
+    };
+
+    /// @brief Get the render info for a frame and present it, reusing the
+    /// storage in frame.
+    inline bool presentFrame(RenderManager& rm, Frame& frame,
+                             PresentToken* token = nullptr) {
+        if (rm.GetRenderInfo(frame.params, frame.info) == 0) {
+            return false;
+        }
+        frame.buffers.resize(frame.info.size());
+        return rm.PresentRenderBuffers(frame.buffers, frame.info,
+                                       frame.params, frame.viewports, false,
+                                       token);
+    }
+
+    /// @brief A time the given number of seconds after base.
+    inline OSVR_TimeValue offsetTime(const OSVR_TimeValue& base,
+                                     double seconds) {
+        OSVR_TimeValue ret = base;
+        double whole = std::floor(seconds);
+        OSVR_TimeValue delta;
+        delta.seconds = static_cast<OSVR_TimeValue_Seconds>(whole);
+        delta.microseconds = static_cast<OSVR_TimeValue_Microseconds>(
+            std::lround((seconds - whole) * 1e6));
+        osvrTimeValueSum(&ret, &delta);
+        return ret;
+    }
+
+} // namespace test
+} // namespace renderkit
+} // namespace osvr